@@ -156,6 +156,23 @@ public:
    * once the point set is changed. */
   void ConsiderPoint(const PointType &);
 
+  /** Maintain the bounds incrementally instead of rescanning all points
+   * whenever the container is modified. In this mode a change of the
+   * container merely expands the cached bounds with ConsiderPoint() calls
+   * made by the owner of the points; since expansion alone can only grow
+   * the box, an exact recompute is still performed after
+   * ExactRecomputePeriod consecutive incremental refreshes. Off by
+   * default, in which case every container modification triggers a full
+   * rescan as before. */
+  itkSetMacro(UseIncrementalBounds, bool);
+  itkGetConstMacro(UseIncrementalBounds, bool);
+  itkBooleanMacro(UseIncrementalBounds);
+
+  /** Number of incremental refreshes after which the bounds are recomputed
+   * exactly from all points. Only used when UseIncrementalBounds is on. */
+  itkSetMacro(ExactRecomputePeriod, unsigned int);
+  itkGetConstMacro(ExactRecomputePeriod, unsigned int);
+
   /** Get the length squared of the diagonal of the bounding box.
    * Returns zero if bounding box cannot be computed. Note that the
    * Accumulate type is used to represent the length. */
@@ -184,6 +201,11 @@ private:
   mutable BoundsArrayType     m_Bounds;
   mutable TimeStamp           m_BoundsMTime; // The last time the bounds
                                              // were computed.
+
+  bool                  m_UseIncrementalBounds{ false };
+  unsigned int          m_ExactRecomputePeriod{ 64 };
+  mutable unsigned int  m_IncrementalRefreshCount{ 0 };
+  mutable bool          m_BoundsComputedExactly{ false };
 };
 } // end namespace itk
 
@@ -48,6 +48,8 @@ BoundingBox< TPointIdentifier, VPointDimension, TCoordRep, TPointsContainer >
     os << m_Bounds[2 * i] << "," << m_Bounds[2 * i + 1] << " ";
     }
   os << " )" << std::endl;
+  os << indent << "UseIncrementalBounds: " << m_UseIncrementalBounds << std::endl;
+  os << indent << "ExactRecomputePeriod: " << m_ExactRecomputePeriod << std::endl;
 }
 
 /**
@@ -152,16 +154,32 @@ BoundingBox< TPointIdentifier, VPointDimension, TCoordRep, TPointsContainer >
     if ( m_PointsContainer->Size() < 1 )
       {
       m_Bounds.Fill(NumericTraits< CoordRepType >::ZeroValue());
+      m_BoundsComputedExactly = false;
       m_BoundsMTime.Modified();
       return false;
       }
 
+    if ( m_UseIncrementalBounds && m_BoundsComputedExactly
+         && m_IncrementalRefreshCount < m_ExactRecomputePeriod )
+      {
+      // trust the expand-only maintenance done through ConsiderPoint();
+      // the expansion can only overestimate, so recompute exactly once
+      // every ExactRecomputePeriod refreshes
+      ++m_IncrementalRefreshCount;
+      m_BoundsMTime.Modified();
+      return true;
+      }
+
     PointsContainerConstIterator        ci = m_PointsContainer->Begin();
     Point< TCoordRep, VPointDimension > point = ci->Value();      //point value
+
+    // work on a local copy of the bounds; the branchless updates of a
+    // plain array vectorize where the compiler can prove independence
+    CoordRepType bounds[PointDimension * 2];
     for ( unsigned int i = 0; i < PointDimension; i++ )
       {
-      m_Bounds[2 * i] = point[i];
-      m_Bounds[2 * i + 1] = point[i];
+      bounds[2 * i] = point[i];
+      bounds[2 * i + 1] = point[i];
       }
     ++ci;
 
@@ -169,21 +187,23 @@ BoundingBox< TPointIdentifier, VPointDimension, TCoordRep, TPointsContainer >
     //the bounding box.
     while ( ci != m_PointsContainer->End() )
       {
-      point = ci->Value();     //point value
+      const Point< TCoordRep, VPointDimension > & pnt = ci->Value();
       for ( unsigned int i = 0; i < PointDimension; i++ )
         {
-        if ( point[i] < m_Bounds[2 * i] )
-          {
-          m_Bounds[2 * i] = point[i];
-          }
-        if ( point[i] > m_Bounds[2 * i + 1] )
-          {
-          m_Bounds[2 * i + 1] = point[i];
-          }
+        const CoordRepType v = pnt[i];
+        bounds[2 * i] = ( v < bounds[2 * i] ) ? v : bounds[2 * i];
+        bounds[2 * i + 1] = ( v > bounds[2 * i + 1] ) ? v : bounds[2 * i + 1];
         }
       ++ci;
       } //for all points in container
 
+    for ( unsigned int i = 0; i < PointDimension * 2; i++ )
+      {
+      m_Bounds[i] = bounds[i];
+      }
+
+    m_BoundsComputedExactly = true;
+    m_IncrementalRefreshCount = 0;
     m_BoundsMTime.Modified();
     }
 
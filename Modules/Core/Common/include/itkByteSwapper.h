@@ -94,10 +94,10 @@ public:
    * swapped and written (in binary) to the ostream
    * given. A total of num values of type T are written
    * and swapped. 2, 4 and 8 byte swapping
-   * can be handled. Single byte types are not swapped;
-   * others raise an exception. The method is used to
-   * swap to and from Big Endian. */
-  static void SwapWriteRangeFromSystemToBigEndian(T *p, int num,
+   * can be handled. Single byte types are written
+   * without swapping; others raise an exception. The method
+   * is used to swap to and from Big Endian. */
+  static void SwapWriteRangeFromSystemToBigEndian(T *p, BufferSizeType num,
                                                   OStreamType *fp);
 
   /** Generic swap method handles type T. The swapping is
@@ -118,10 +118,10 @@ public:
    * swapped and written (in binary) to the ostream
    * given. A total of num values of type T are written
    * and swapped. 2, 4 and 8 byte swapping
-   * can be handled. Single byte types are not swapped;
-   * others raise an exception. The method is used to
-   * swap to and from Little Endian. */
-  static void SwapWriteRangeFromSystemToLittleEndian(T *p, int num,
+   * can be handled. Single byte types are written
+   * without swapping; others raise an exception. The method
+   * is used to swap to and from Little Endian. */
+  static void SwapWriteRangeFromSystemToLittleEndian(T *p, BufferSizeType num,
                                                      OStreamType *fp);
 
 protected:
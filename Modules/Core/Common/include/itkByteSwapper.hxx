@@ -29,10 +29,98 @@
 #define itkByteSwapper_hxx
 #include "itkByteSwapper.h"
 #include <memory>
+#include <cstdlib>
 #include <cstring>
 
 namespace itk
 {
+namespace ByteSwapperDetail
+{
+// Single word byte reversals. The compiler builtins map to one
+// bswap/rev instruction per word, and loops over them are recognized
+// by the vectorizer and turned into SIMD byte shuffles (pshufb on
+// x86, rev on ARM) operating on whole registers at a time.
+inline uint16_t ReverseBytes(uint16_t word)
+{
+#if defined( __GNUC__ ) || defined( __clang__ )
+  return __builtin_bswap16(word);
+#elif defined( _MSC_VER )
+  return _byteswap_ushort(word);
+#else
+  return static_cast< uint16_t >( ( word << 8 ) | ( word >> 8 ) );
+#endif
+}
+
+inline uint32_t ReverseBytes(uint32_t word)
+{
+#if defined( __GNUC__ ) || defined( __clang__ )
+  return __builtin_bswap32(word);
+#elif defined( _MSC_VER )
+  return _byteswap_ulong(word);
+#else
+  return ( word << 24 )
+         | ( ( word & 0x0000ff00u ) << 8 )
+         | ( ( word >> 8 ) & 0x0000ff00u )
+         | ( word >> 24 );
+#endif
+}
+
+inline uint64_t ReverseBytes(uint64_t word)
+{
+#if defined( __GNUC__ ) || defined( __clang__ )
+  return __builtin_bswap64(word);
+#elif defined( _MSC_VER )
+  return _byteswap_uint64(word);
+#else
+  return ( word << 56 )
+         | ( ( word & 0x000000000000ff00ull ) << 40 )
+         | ( ( word & 0x0000000000ff0000ull ) << 24 )
+         | ( ( word & 0x00000000ff000000ull ) << 8 )
+         | ( ( word >> 8 ) & 0x00000000ff000000ull )
+         | ( ( word >> 24 ) & 0x0000000000ff0000ull )
+         | ( ( word >> 40 ) & 0x000000000000ff00ull )
+         | ( word >> 56 );
+#endif
+}
+
+// Reverse the bytes of num words of WordType in place, one cache line
+// per outer iteration. The fixed trip count of the inner loop is what
+// lets the vectorizer emit byte-shuffle instructions for it; the words
+// move through memcpy to keep the accesses alignment safe.
+template< typename WordType >
+inline void ReverseByteRange(void *ptr, SizeValueType num)
+{
+  using BufferSizeType = SizeValueType;
+
+  constexpr BufferSizeType cacheLineSize = 64;
+  constexpr BufferSizeType wordsPerBlock = cacheLineSize / sizeof( WordType );
+
+  auto * pos = reinterpret_cast< char * >( ptr );
+
+  while ( num >= wordsPerBlock )
+    {
+    for ( unsigned int i = 0; i < wordsPerBlock; ++i )
+      {
+      WordType word;
+      memcpy(&word, pos + i * sizeof( WordType ), sizeof( WordType ));
+      word = ReverseBytes(word);
+      memcpy(pos + i * sizeof( WordType ), &word, sizeof( WordType ));
+      }
+    pos += cacheLineSize;
+    num -= wordsPerBlock;
+    }
+
+  while ( num )
+    {
+    WordType word;
+    memcpy(&word, pos, sizeof( WordType ));
+    word = ReverseBytes(word);
+    memcpy(pos, &word, sizeof( WordType ));
+    pos += sizeof( WordType );
+    --num;
+    }
+}
+} // end namespace ByteSwapperDetail
 // The following are the public methods --------------------------------
 //
 // Machine definitions
@@ -126,21 +214,23 @@ ByteSwapper< T >
 template< typename T >
 void
 ByteSwapper< T >
-::SwapWriteRangeFromSystemToBigEndian(T *p, int num, OStreamType *fp)
+::SwapWriteRangeFromSystemToBigEndian(T *p, BufferSizeType num, OStreamType *fp)
 {
-  num *= sizeof( T );
-  fp->write( (char *)p, num );
+  fp->write( (char *)p, static_cast< std::streamsize >( num * sizeof( T ) ) );
 }
 
 #else
 template< typename T >
 void
 ByteSwapper< T >
-::SwapWriteRangeFromSystemToBigEndian(T *p, int num, OStreamType *fp)
+::SwapWriteRangeFromSystemToBigEndian(T *p, BufferSizeType num, OStreamType *fp)
 {
   switch ( sizeof( T ) )
     {
     case 1:
+      // single byte data does not need swapping, but it still has to
+      // be written out
+      fp->write( (char *)p, static_cast< std::streamsize >( num ) );
       return;
     case 2:
       ByteSwapper< T >::SwapWrite2Range( (void *)p, num, fp );
@@ -226,11 +316,14 @@ ByteSwapper< T >
 template< typename T >
 void
 ByteSwapper< T >
-::SwapWriteRangeFromSystemToLittleEndian(T *p, int num, OStreamType *fp)
+::SwapWriteRangeFromSystemToLittleEndian(T *p, BufferSizeType num, OStreamType *fp)
 {
   switch ( sizeof( T ) )
     {
     case 1:
+      // single byte data does not need swapping, but it still has to
+      // be written out
+      fp->write( (char *)p, static_cast< std::streamsize >( num ) );
       return;
     case 2:
       ByteSwapper< T >::SwapWrite2Range( (void *)p, num, fp );
@@ -250,10 +343,9 @@ ByteSwapper< T >
 template< typename T >
 void
 ByteSwapper< T >
-::SwapWriteRangeFromSystemToLittleEndian(T *p, int num, OStreamType *fp)
+::SwapWriteRangeFromSystemToLittleEndian(T *p, BufferSizeType num, OStreamType *fp)
 {
-  num *= sizeof( T );
-  fp->write( (char *)p, num );
+  fp->write( (char *)p, static_cast< std::streamsize >( num * sizeof( T ) ) );
 }
 
 #endif
@@ -269,10 +361,11 @@ void
 ByteSwapper< T >
 ::Swap2(void *pin)
 {
-  auto * p = reinterpret_cast< unsigned short * >( pin );
-  const unsigned short h1 = (*p) << static_cast<short unsigned int>(8);
-  const unsigned short h2 = (*p) >> static_cast<short unsigned int>(8);
-  *p = h1 | h2;
+  uint16_t word;
+
+  memcpy(&word, pin, 2);
+  word = ByteSwapperDetail::ReverseBytes(word);
+  memcpy(pin, &word, 2);
 }
 
 // Swap bunch of bytes. Num is the number of two byte words to swap.
@@ -281,14 +374,7 @@ void
 ByteSwapper< T >
 ::Swap2Range(void *ptr, BufferSizeType num)
 {
-  auto * pos = reinterpret_cast< char * >( ptr );
-  for ( BufferSizeType i = 0; i < num; i++ )
-    {
-    const char one_byte = pos[0];
-    pos[0] = pos[1];
-    pos[1] = one_byte;
-    pos = pos + 2;
-    }
+  ByteSwapperDetail::ReverseByteRange< uint16_t >(ptr, num);
 }
 
 // Swap bunch of bytes. Num is the number of four byte words to swap.
@@ -307,14 +393,8 @@ ByteSwapper< T >
     {
     memcpy(cpy, ptr, chunkSize * 2);
 
-    char * pos = cpy;
-    for ( BufferSizeType i = 0; i < chunkSize; i++ )
-      {
-      const char one_byte = pos[0];
-      pos[0] = pos[1];
-      pos[1] = one_byte;
-      pos = pos + 2;
-      }
+    ByteSwapper< T >::Swap2Range( (void *)cpy, chunkSize );
+
     fp->write( (char *)cpy, static_cast<std::streamsize>(2 * chunkSize) );
     ptr = (char *)ptr + chunkSize * 2;
     num -= chunkSize;
@@ -334,16 +414,11 @@ void
 ByteSwapper< T >
 ::Swap4(void *ptr)
 {
-  char  one_byte;
-  auto * p = reinterpret_cast< char * >( ptr );
-
-  one_byte    = p[0];
-  p[0] = p[3];
-  p[3] = one_byte;
+  uint32_t word;
 
-  one_byte    = p[1];
-  p[1] = p[2];
-  p[2] = one_byte;
+  memcpy(&word, ptr, 4);
+  word = ByteSwapperDetail::ReverseBytes(word);
+  memcpy(ptr, &word, 4);
 }
 
 // Swap bunch of bytes. Num is the number of four byte words to swap.
@@ -352,19 +427,7 @@ void
 ByteSwapper< T >
 ::Swap4Range(void *ptr, BufferSizeType num)
 {
-  auto * pos = reinterpret_cast< char * >( ptr );
-
-  for ( BufferSizeType i = 0; i < num; i++ )
-    {
-    char one_byte = pos[0];
-    pos[0] = pos[3];
-    pos[3] = one_byte;
-
-    one_byte = pos[1];
-    pos[1] = pos[2];
-    pos[2] = one_byte;
-    pos = pos + 4;
-    }
+  ByteSwapperDetail::ReverseByteRange< uint32_t >(ptr, num);
 }
 
 // Swap bunch of bytes. Num is the number of four byte words to swap.
@@ -385,18 +448,8 @@ ByteSwapper< T >
     {
     memcpy(cpy, ptr, chunkSize * 4);
 
-    char * pos = cpy;
-    for ( BufferSizeType i = 0; i < chunkSize; i++ )
-      {
-      char one_byte = pos[0];
-      pos[0] = pos[3];
-      pos[3] = one_byte;
-
-      one_byte = pos[1];
-      pos[1] = pos[2];
-      pos[2] = one_byte;
-      pos = pos + 4;
-      }
+    ByteSwapper< T >::Swap4Range( (void *)cpy, chunkSize );
+
     fp->write( (char *)cpy, static_cast<std::streamsize>(4 * chunkSize) );
     ptr  = (char *)ptr + chunkSize * 4;
     num -= chunkSize;
@@ -416,24 +469,11 @@ void
 ByteSwapper< T >
 ::Swap8(void *ptr)
 {
-  char  one_byte;
-  auto * p = reinterpret_cast< char * >( ptr );
-
-  one_byte    = p[0];
-  p[0] = p[7];
-  p[7] = one_byte;
+  uint64_t word;
 
-  one_byte    = p[1];
-  p[1] = p[6];
-  p[6] = one_byte;
-
-  one_byte    = p[2];
-  p[2] = p[5];
-  p[5] = one_byte;
-
-  one_byte    = p[3];
-  p[3] = p[4];
-  p[4] = one_byte;
+  memcpy(&word, ptr, 8);
+  word = ByteSwapperDetail::ReverseBytes(word);
+  memcpy(ptr, &word, 8);
 }
 
 // Swap bunch of bytes. Num is the number of eight byte words to swap.
@@ -442,27 +482,7 @@ void
 ByteSwapper< T >
 ::Swap8Range(void *ptr, BufferSizeType num)
 {
-  auto * pos = reinterpret_cast< char * >( ptr );
-
-  for ( BufferSizeType i = 0; i < num; i++ )
-    {
-    char one_byte    = pos[0];
-    pos[0] = pos[7];
-    pos[7] = one_byte;
-
-    one_byte    = pos[1];
-    pos[1] = pos[6];
-    pos[6] = one_byte;
-
-    one_byte    = pos[2];
-    pos[2] = pos[5];
-    pos[5] = one_byte;
-
-    one_byte    = pos[3];
-    pos[3] = pos[4];
-    pos[4] = one_byte;
-    pos = pos + 8;
-    }
+  ByteSwapperDetail::ReverseByteRange< uint64_t >(ptr, num);
 }
 
 // Swap bunch of bytes. Num is the number of four byte words to swap.
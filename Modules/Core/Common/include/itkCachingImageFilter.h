@@ -0,0 +1,174 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkCachingImageFilter_h
+#define itkCachingImageFilter_h
+
+#include "itkImageToImageFilter.h"
+
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+namespace itk
+{
+/** \class CachingImageFilter
+ * \brief Pass-through filter that caches computed output tiles.
+ *
+ * The filter divides its image domain into a fixed grid of tiles, aligned
+ * to the index of the largest possible region. A requested region is
+ * satisfied by assembling the covering tiles: tiles already in the cache
+ * are copied straight into the output, and only the missing ones drive an
+ * update of the upstream pipeline, one tile at a time, like
+ * StreamingImageFilter does for its stream divisions. Interactive and
+ * patch-sampling workloads that repeatedly pull overlapping regions
+ * through an expensive pipeline therefore recompute each tile once
+ * instead of on every request.
+ *
+ * The cache is bounded by a configurable byte budget and evicts tiles in
+ * least-recently-used order. It is flushed automatically when the
+ * upstream pipeline is modified or the image geometry changes, and can be
+ * flushed manually with FlushCache(). The CacheHits and CacheMisses
+ * counters report how well the tile size and budget match the access
+ * pattern.
+ *
+ * Like StreamingImageFilter, this filter drives the upstream pipeline
+ * itself from UpdateOutputData() and has no GenerateData() method.
+ *
+ * \sa StreamingImageFilter
+ * \ingroup ITKSystemObjects
+ * \ingroup DataProcessing
+ * \ingroup ITKCommon
+ */
+template< typename TImage >
+class ITK_TEMPLATE_EXPORT CachingImageFilter:public ImageToImageFilter< TImage, TImage >
+{
+public:
+  ITK_DISALLOW_COPY_AND_ASSIGN(CachingImageFilter);
+
+  /** Standard class type aliases. */
+  using Self = CachingImageFilter;
+  using Superclass = ImageToImageFilter< TImage, TImage >;
+  using Pointer = SmartPointer< Self >;
+  using ConstPointer = SmartPointer< const Self >;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(CachingImageFilter, ImageToImageFilter);
+
+  /** Some type alias for the input and output. */
+  using ImageType = TImage;
+  using ImagePointer = typename ImageType::Pointer;
+  using RegionType = typename ImageType::RegionType;
+  using IndexType = typename ImageType::IndexType;
+  using SizeType = typename ImageType::SizeType;
+  using PixelType = typename ImageType::PixelType;
+  using InternalPixelType = typename ImageType::InternalPixelType;
+
+  /** Dimension of the image. */
+  static constexpr unsigned int ImageDimension = ImageType::ImageDimension;
+
+  /** Set/Get the tile edge length in pixels. The domain is divided into
+   * cubic tiles of this size, aligned to the largest possible region.
+   * Smaller tiles waste less computation at region boundaries, larger
+   * tiles amortize the per-tile upstream update cost. Changing the length
+   * flushes the cache. */
+  virtual void SetTileLength(SizeValueType length);
+
+  itkGetConstReferenceMacro(TileLength, SizeValueType);
+
+  /** Set/Get the cache byte budget. When an inserted tile pushes the
+   * cache over the budget, least recently used tiles are evicted. The
+   * default is 256 MiB. */
+  itkSetMacro(MaximumCacheSizeInBytes, SizeValueType);
+  itkGetConstReferenceMacro(MaximumCacheSizeInBytes, SizeValueType);
+
+  /** Number of requested tiles served from the cache, and number that had
+   * to be computed upstream. */
+  itkGetConstReferenceMacro(CacheHits, SizeValueType);
+  itkGetConstReferenceMacro(CacheMisses, SizeValueType);
+
+  /** Bytes currently held by cached tiles. */
+  itkGetConstReferenceMacro(CacheSizeInBytes, SizeValueType);
+
+  /** Discard all cached tiles. */
+  void FlushCache();
+
+  /** Override UpdateOutputData() from ProcessObject to assemble the
+   * requested region from cached tiles, driving the upstream pipeline
+   * only for the missing ones. */
+  void UpdateOutputData(DataObject *output) override;
+
+  /** Override PropagateRequestedRegion from ProcessObject. Upstream
+   * requested regions are managed tile by tile inside UpdateOutputData,
+   * so propagation stops here. */
+  void PropagateRequestedRegion(DataObject *output) override;
+
+protected:
+  CachingImageFilter();
+  ~CachingImageFilter() override = default;
+  void PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  /** One cached tile: its (clipped) region and a copy of its pixels. */
+  struct TileEntry
+  {
+    RegionType Region;
+    std::vector< InternalPixelType > Pixels;
+    typename std::list< SizeValueType >::iterator LruIterator;
+  };
+
+  /** The grid tile holding the given key, clipped to the largest
+   * possible region. */
+  RegionType GetTileRegion(SizeValueType key, const RegionType & largestRegion) const;
+
+  /** Drop least recently used tiles until the cache fits the budget,
+   * never evicting the given key. */
+  void EvictToBudget(SizeValueType protectedKey);
+
+  SizeValueType m_TileLength{ 64 };
+  SizeValueType m_MaximumCacheSizeInBytes{ static_cast< SizeValueType >( 256 ) * 1024 * 1024 };
+
+  std::unordered_map< SizeValueType, TileEntry > m_Tiles;
+
+  /** Keys ordered from most to least recently used. */
+  std::list< SizeValueType > m_LruList;
+
+  SizeValueType m_CacheSizeInBytes{ 0 };
+  SizeValueType m_CacheHits{ 0 };
+  SizeValueType m_CacheMisses{ 0 };
+
+  /** Pipeline state the cache contents correspond to. */
+  ModifiedTimeType m_CachedPipelineMTime{ 0 };
+  RegionType       m_CachedLargestRegion;
+
+#ifdef ITK_USE_CONCEPT_CHECKING
+  // Begin concept checking
+  itkConceptMacro( ImageHasNumericTraitsCheck,
+                   ( Concept::HasNumericTraits< InternalPixelType > ) );
+  // End concept checking
+#endif
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#include "itkCachingImageFilter.hxx"
+#endif
+
+#endif
@@ -0,0 +1,332 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkCachingImageFilter_hxx
+#define itkCachingImageFilter_hxx
+
+#include "itkCachingImageFilter.h"
+#include "itkImageAlgorithm.h"
+
+#include <algorithm>
+
+namespace itk
+{
+template< typename TImage >
+CachingImageFilter< TImage >
+::CachingImageFilter()
+{
+}
+
+template< typename TImage >
+void
+CachingImageFilter< TImage >
+::SetTileLength(SizeValueType length)
+{
+  length = std::max< SizeValueType >( 1, length );
+  if ( length != m_TileLength )
+    {
+    m_TileLength = length;
+    this->FlushCache();
+    this->Modified();
+    }
+}
+
+template< typename TImage >
+void
+CachingImageFilter< TImage >
+::FlushCache()
+{
+  m_Tiles.clear();
+  m_LruList.clear();
+  m_CacheSizeInBytes = 0;
+}
+
+template< typename TImage >
+void
+CachingImageFilter< TImage >
+::PropagateRequestedRegion(DataObject *output)
+{
+  /**
+   * check flag to avoid executing forever if there is a loop
+   */
+  if ( this->m_Updating )
+    {
+    return;
+    }
+
+  /**
+   * Give the subclass a chance to indicate that it will provide
+   * more data then required for the output.
+   */
+  this->EnlargeOutputRequestedRegion(output);
+
+  /**
+   * Give the subclass a chance to define how to set the requested
+   * regions for each of its outputs, given this output's requested
+   * region.
+   */
+  this->GenerateOutputRequestedRegion(output);
+
+  // The input requested regions are managed tile by tile inside
+  // UpdateOutputData, so neither GenerateInputRequestedRegion nor the
+  // inputs' PropagateRequestedRegion are called here.
+}
+
+template< typename TImage >
+typename CachingImageFilter< TImage >::RegionType
+CachingImageFilter< TImage >
+::GetTileRegion(SizeValueType key, const RegionType & largestRegion) const
+{
+  RegionType tileRegion;
+  SizeValueType stride = 1;
+  for ( unsigned int d = 0; d < ImageDimension; ++d )
+    {
+    const SizeValueType tilesAlongDimension =
+      ( largestRegion.GetSize(d) + m_TileLength - 1 ) / m_TileLength;
+    const SizeValueType coordinate = ( key / stride ) % tilesAlongDimension;
+    stride *= tilesAlongDimension;
+
+    const IndexValueType start = largestRegion.GetIndex(d)
+                                 + static_cast< IndexValueType >( coordinate * m_TileLength );
+    const IndexValueType end = largestRegion.GetIndex(d)
+                               + static_cast< IndexValueType >( largestRegion.GetSize(d) );
+    tileRegion.SetIndex( d, start );
+    tileRegion.SetSize( d, std::min< SizeValueType >( m_TileLength, end - start ) );
+    }
+  return tileRegion;
+}
+
+template< typename TImage >
+void
+CachingImageFilter< TImage >
+::EvictToBudget(SizeValueType protectedKey)
+{
+  while ( m_CacheSizeInBytes > m_MaximumCacheSizeInBytes && !m_LruList.empty() )
+    {
+    const SizeValueType victim = m_LruList.back();
+    if ( victim == protectedKey )
+      {
+      break; // a single tile larger than the budget stays cached
+      }
+    auto victimIterator = m_Tiles.find( victim );
+    m_CacheSizeInBytes -= victimIterator->second.Pixels.size() * sizeof( InternalPixelType );
+    m_Tiles.erase( victimIterator );
+    m_LruList.pop_back();
+    }
+}
+
+template< typename TImage >
+void
+CachingImageFilter< TImage >
+::UpdateOutputData( DataObject *itkNotUsed(output) )
+{
+  /**
+   * prevent chasing our tail
+   */
+  if ( this->m_Updating )
+    {
+    return;
+    }
+
+  /**
+   * Prepare all the outputs. This may deallocate previous bulk data.
+   */
+  this->PrepareOutputs();
+
+  /**
+   * Make sure we have the necessary inputs
+   */
+  const itk::ProcessObject::DataObjectPointerArraySizeType &ninputs = this->GetNumberOfValidRequiredInputs();
+  if ( ninputs < this->GetNumberOfRequiredInputs() )
+    {
+    itkExceptionMacro(
+      << "At least " << static_cast< unsigned int >( this->GetNumberOfRequiredInputs() )
+      << " inputs are required but only " << ninputs << " are specified.");
+    return;
+    }
+
+  this->InvokeEvent( StartEvent() );
+
+  this->SetAbortGenerateData(0);
+  this->UpdateProgress(0.0);
+  this->m_Updating = true;
+
+  /**
+   * Allocate the output buffer.
+   */
+  ImageType *outputPtr = this->GetOutput(0);
+  const RegionType outputRegion = outputPtr->GetRequestedRegion();
+  outputPtr->SetBufferedRegion(outputRegion);
+  outputPtr->Allocate();
+
+  auto * inputPtr = const_cast< ImageType * >( this->GetInput(0) );
+
+  /**
+   * The cache is only valid for the upstream pipeline state and geometry
+   * it was filled under.
+   */
+  const RegionType largestRegion = outputPtr->GetLargestPossibleRegion();
+  const ModifiedTimeType pipelineMTime = inputPtr->GetPipelineMTime();
+  if ( pipelineMTime != m_CachedPipelineMTime || largestRegion != m_CachedLargestRegion )
+    {
+    this->FlushCache();
+    m_CachedPipelineMTime = pipelineMTime;
+    m_CachedLargestRegion = largestRegion;
+    }
+
+  const unsigned int components = outputPtr->GetNumberOfComponentsPerPixel();
+
+  /**
+   * A tile image wraps a cache entry's pixel vector so ImageAlgorithm::Copy
+   * can move pixels in and out of the cache without per-pixel indexing.
+   */
+  auto wrapTile = [outputPtr, components]( TileEntry & entry ) -> ImagePointer
+    {
+    ImagePointer tileImage = ImageType::New();
+    tileImage->CopyInformation( outputPtr );
+    tileImage->SetNumberOfComponentsPerPixel( components );
+    tileImage->SetRegions( entry.Region );
+    tileImage->GetPixelContainer()->SetImportPointer(
+      entry.Pixels.data(), entry.Pixels.size(), false );
+    return tileImage;
+    };
+
+  /**
+   * The range of grid tiles covering the requested region, and the key
+   * strides of the tile grid over the whole domain.
+   */
+  SizeValueType firstTileCoordinate[ImageDimension];
+  SizeValueType lastTileCoordinate[ImageDimension];
+  SizeValueType keyStride[ImageDimension];
+  SizeValueType stride = 1;
+  SizeValueType numberOfTiles = 1;
+  for ( unsigned int d = 0; d < ImageDimension; ++d )
+    {
+    firstTileCoordinate[d] =
+      static_cast< SizeValueType >( outputRegion.GetIndex(d) - largestRegion.GetIndex(d) )
+      / m_TileLength;
+    lastTileCoordinate[d] =
+      static_cast< SizeValueType >( outputRegion.GetIndex(d) - largestRegion.GetIndex(d)
+                                    + static_cast< IndexValueType >( outputRegion.GetSize(d) ) - 1 )
+      / m_TileLength;
+    keyStride[d] = stride;
+    stride *= ( largestRegion.GetSize(d) + m_TileLength - 1 ) / m_TileLength;
+    numberOfTiles *= lastTileCoordinate[d] - firstTileCoordinate[d] + 1;
+    }
+
+  for ( SizeValueType tile = 0;
+        tile < numberOfTiles && !this->GetAbortGenerateData();
+        ++tile )
+    {
+    SizeValueType key = 0;
+    SizeValueType remainder = tile;
+    for ( unsigned int d = 0; d < ImageDimension; ++d )
+      {
+      const SizeValueType extent = lastTileCoordinate[d] - firstTileCoordinate[d] + 1;
+      key += ( firstTileCoordinate[d] + remainder % extent ) * keyStride[d];
+      remainder /= extent;
+      }
+
+    auto entryIterator = m_Tiles.find( key );
+    if ( entryIterator == m_Tiles.end() )
+      {
+      ++m_CacheMisses;
+
+      const RegionType tileRegion = this->GetTileRegion( key, largestRegion );
+      inputPtr->SetRequestedRegion(tileRegion);
+      inputPtr->PropagateRequestedRegion();
+      inputPtr->UpdateOutputData();
+
+      TileEntry entry;
+      entry.Region = tileRegion;
+      entry.Pixels.resize( tileRegion.GetNumberOfPixels() * components );
+
+      m_LruList.push_front( key );
+      entry.LruIterator = m_LruList.begin();
+      entryIterator = m_Tiles.emplace( key, std::move( entry ) ).first;
+
+      ImagePointer tileImage = wrapTile( entryIterator->second );
+      ImageAlgorithm::Copy( inputPtr, tileImage.GetPointer(), tileRegion, tileRegion );
+
+      m_CacheSizeInBytes +=
+        entryIterator->second.Pixels.size() * sizeof( InternalPixelType );
+      this->EvictToBudget( key );
+      }
+    else
+      {
+      ++m_CacheHits;
+      // move the tile to the front of the LRU order
+      m_LruList.splice( m_LruList.begin(), m_LruList, entryIterator->second.LruIterator );
+      }
+
+    RegionType copyRegion = entryIterator->second.Region;
+    copyRegion.Crop( outputRegion );
+    ImagePointer tileImage = wrapTile( entryIterator->second );
+    ImageAlgorithm::Copy( tileImage.GetPointer(), outputPtr, copyRegion, copyRegion );
+
+    this->UpdateProgress( static_cast<float>( tile + 1 ) / static_cast<float>( numberOfTiles ) );
+    }
+
+  /**
+   * If we ended due to aborting, push the progress up to 1.0 (since
+   * it probably didn't end there)
+   */
+  if ( !this->GetAbortGenerateData() )
+    {
+    this->UpdateProgress(1.0);
+    }
+
+  // Notify end event observers
+  this->InvokeEvent( EndEvent() );
+
+  /**
+   * Now we have to mark the data as up to date.
+   */
+  for ( unsigned int idx = 0; idx < this->GetNumberOfOutputs(); ++idx )
+    {
+    if ( this->GetOutput(idx) )
+      {
+      this->GetOutput(idx)->DataHasBeenGenerated();
+      }
+    }
+
+  /**
+   * Release any inputs if marked for release
+   */
+  this->ReleaseInputs();
+
+  // Mark that we are no longer updating the data in this filter
+  this->m_Updating = false;
+}
+
+template< typename TImage >
+void
+CachingImageFilter< TImage >
+::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  os << indent << "TileLength: " << m_TileLength << std::endl;
+  os << indent << "MaximumCacheSizeInBytes: " << m_MaximumCacheSizeInBytes << std::endl;
+  os << indent << "CacheSizeInBytes: " << m_CacheSizeInBytes << std::endl;
+  os << indent << "Cached tiles: " << m_Tiles.size() << std::endl;
+  os << indent << "CacheHits: " << m_CacheHits << std::endl;
+  os << indent << "CacheMisses: " << m_CacheMisses << std::endl;
+}
+} // end namespace itk
+
+#endif
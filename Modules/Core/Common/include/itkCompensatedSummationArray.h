@@ -0,0 +1,108 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkCompensatedSummationArray_h
+#define itkCompensatedSummationArray_h
+
+#include "itkNumericTraits.h"
+#include "itkIntTypes.h"
+#include "itkConceptChecking.h"
+
+#include <vector>
+
+namespace itk
+{
+
+/** \class CompensatedSummationArray
+ * \brief Accumulate an array of running compensated sums in one pass.
+ *
+ * This class maintains a fixed-length array of independent compensated
+ * (Kahan) summations.  It produces the same result, entry for entry, as
+ * an array of CompensatedSummation objects, but stores the sums and the
+ * compensations in separate contiguous arrays.  The per-entry summation
+ * step in AddElements() therefore runs over unit-stride memory without
+ * a loop-carried dependence between entries, which allows the compiler
+ * to vectorize what is otherwise a chain of dependent additions.
+ *
+ * The intended use is the reduction of per-sample contributions into a
+ * long accumulator, e.g. a metric derivative accumulated over sampled
+ * points:
+ *
+   \code
+     CompensatedSummationArray<double> accumulator( numberOfParameters );
+     for( SizeValueType sample = 0; sample < numberOfSamples; ++sample )
+       {
+       accumulator.AddElements( localDerivative.data_block() );
+       }
+     double firstEntry = accumulator.GetSum( 0 );
+   \endcode
+ *
+ * \sa CompensatedSummation
+ * \ingroup ITKCommon
+ */
+template < typename TFloat >
+class ITK_TEMPLATE_EXPORT CompensatedSummationArray
+{
+public:
+  /** Type of the input elements. */
+  using FloatType = TFloat;
+
+  /** Type used for the sums and compensations. */
+  using AccumulateType = typename NumericTraits< FloatType >::AccumulateType;
+
+  /** Standard class type aliases. */
+  using Self = CompensatedSummationArray;
+
+  /** Constructors. The array starts out with all entries zero. */
+  CompensatedSummationArray() = default;
+  explicit CompensatedSummationArray( SizeValueType length );
+
+  /** Set the number of entries. The sums and compensations are reset
+   * to zero. */
+  void SetLength( SizeValueType length );
+
+  /** Get the number of entries. */
+  SizeValueType GetLength() const;
+
+  /** Perform one compensated summation step for every entry, adding
+   * \c elements[i] to entry i. The supplied array must hold at least
+   * GetLength() values. */
+  void AddElements( const FloatType * elements );
+
+  /** Reset all sums and compensations to zero. */
+  void ResetToZero();
+
+  /** Get the sum accumulated in the given entry. */
+  const AccumulateType & GetSum( SizeValueType index ) const;
+
+private:
+  std::vector< AccumulateType > m_Sum;
+  std::vector< AccumulateType > m_Compensation;
+
+// Maybe support more types in the future with template specialization.
+#ifdef ITK_USE_CONCEPT_CHECKING
+  itkConceptMacro( OnlyDefinedForFloatingPointTypes, ( itk::Concept::IsFloatingPoint< TFloat > ) );
+#endif // ITK_USE_CONCEPT_CHECKING
+};
+
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#include "itkCompensatedSummationArray.hxx"
+#endif
+
+#endif
@@ -0,0 +1,105 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkCompensatedSummationArray_hxx
+#define itkCompensatedSummationArray_hxx
+
+#include "itkCompensatedSummationArray.h"
+
+namespace itk
+{
+
+template < typename TFloat >
+CompensatedSummationArray< TFloat >
+::CompensatedSummationArray( SizeValueType length )
+{
+  this->SetLength( length );
+}
+
+template < typename TFloat >
+void
+CompensatedSummationArray< TFloat >
+::SetLength( SizeValueType length )
+{
+  this->m_Sum.assign( length, NumericTraits< AccumulateType >::ZeroValue() );
+  this->m_Compensation.assign( length, NumericTraits< AccumulateType >::ZeroValue() );
+}
+
+template < typename TFloat >
+SizeValueType
+CompensatedSummationArray< TFloat >
+::GetLength() const
+{
+  return static_cast< SizeValueType >( this->m_Sum.size() );
+}
+
+#ifdef __INTEL_COMPILER
+#pragma optimize("", off)
+#endif // __INTEL_COMPILER
+#ifdef _MSC_VER
+#pragma float_control(push)
+#pragma float_control( precise, on )
+#endif // _MSC_VER i.e. Microsoft Visual Studio
+template < typename TFloat >
+void
+CompensatedSummationArray< TFloat >
+::AddElements( const FloatType * elements )
+{
+  AccumulateType * sum = this->m_Sum.data();
+  AccumulateType * compensation = this->m_Compensation.data();
+  const size_t length = this->m_Sum.size();
+
+  // The same steps as CompensatedSummationAddElement, performed for
+  // each entry. The entries are mutually independent, so the loop can
+  // be vectorized; the ordering of the operations within one entry must
+  // not be changed.
+  for ( size_t i = 0; i < length; ++i )
+    {
+    const auto compensatedInput = static_cast< AccumulateType >( elements[i] - compensation[i] );
+    const AccumulateType tempSum = sum[i] + compensatedInput;
+    // Warning: watch out for the compiler optimizing this out!
+    compensation[i] = ( tempSum - sum[i] ) - compensatedInput;
+    sum[i] = tempSum;
+    }
+}
+#ifdef __INTEL_COMPILER
+#pragma optimize("", on)
+#endif // __INTEL_COMPILER
+#ifdef _MSC_VER
+#pragma float_control(pop)
+#endif // _MSC_VER
+
+template < typename TFloat >
+void
+CompensatedSummationArray< TFloat >
+::ResetToZero()
+{
+  this->m_Sum.assign( this->m_Sum.size(), NumericTraits< AccumulateType >::ZeroValue() );
+  this->m_Compensation.assign( this->m_Compensation.size(), NumericTraits< AccumulateType >::ZeroValue() );
+}
+
+template < typename TFloat >
+const typename CompensatedSummationArray< TFloat >::AccumulateType &
+CompensatedSummationArray< TFloat >
+::GetSum( SizeValueType index ) const
+{
+  return this->m_Sum[index];
+}
+
+} // end namespace itk
+
+#endif
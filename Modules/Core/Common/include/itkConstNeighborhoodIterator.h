@@ -166,6 +166,16 @@ public:
    * returning a Neighborhood of pixel values. */
   ITK_ITERATOR_VIRTUAL NeighborhoodType GetNeighborhood() const ITK_ITERATOR_FINAL;
 
+  /** Copies the pixel values of the active neighborhood into the
+   * caller-provided buffer, which must hold at least Size() elements.
+   * The values are written in the same linear order used by GetPixel()
+   * and GetNeighborhood(). Away from the region boundary the copy runs
+   * row by row over contiguous image memory, skipping the per-pixel
+   * bounds logic of GetPixel(), so filters that read every neighborhood
+   * element can gather the block once and vectorize their arithmetic
+   * over it. */
+  ITK_ITERATOR_VIRTUAL void GatherNeighborhood(PixelType *outputBuffer) const ITK_ITERATOR_FINAL;
+
   /** Returns the pixel value located at a linear array location i. */
   ITK_ITERATOR_VIRTUAL PixelType GetPixel(const NeighborIndexType i) const ITK_ITERATOR_FINAL
   {
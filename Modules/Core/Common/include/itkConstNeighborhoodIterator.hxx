@@ -401,6 +401,41 @@ ConstNeighborhoodIterator< TImage, TBoundaryCondition >
   return ans;
 }
 
+template< typename TImage, typename TBoundaryCondition >
+void
+ConstNeighborhoodIterator< TImage, TBoundaryCondition >
+::GatherNeighborhood(PixelType *outputBuffer) const
+{
+  const auto size = static_cast< NeighborIndexType >( this->Size() );
+
+  if ( !m_NeedToUseBoundaryCondition || this->InBounds() )
+    {
+    // The image buffer is contiguous along the fastest-moving dimension,
+    // so each neighborhood row can be read as one sequential block. The
+    // distance between neighboring pixels is taken from the pointer array
+    // because it is larger than one internal element for VectorImage.
+    const auto rowLength = static_cast< NeighborIndexType >( this->GetSize(0) );
+    const OffsetValueType pixelStride = ( rowLength > 1 ) ?
+      ( this->operator[](1) - this->operator[](0) ) : 1;
+    for ( NeighborIndexType rowBegin = 0; rowBegin < size; rowBegin += rowLength )
+      {
+      const InternalPixelType *row = this->operator[](rowBegin);
+      for ( NeighborIndexType i = 0; i < rowLength; ++i, row += pixelStride )
+        {
+        outputBuffer[rowBegin + i] = m_NeighborhoodAccessorFunctor.Get(row);
+        }
+      }
+    return;
+    }
+
+  // The neighborhood overlaps the region boundary; fall back to the
+  // per-pixel bounds logic.
+  for ( NeighborIndexType i = 0; i < size; ++i )
+    {
+    outputBuffer[i] = this->GetPixel(i);
+    }
+}
+
 template< typename TImage, typename TBoundaryCondition >
 void
 ConstNeighborhoodIterator< TImage, TBoundaryCondition >
@@ -53,6 +53,11 @@ namespace itk
  *  \c DetermineNumberOfWorkUnitsToUse, \c BeforeThreadedExecution, \c ThreadedExecution,
  *  and \c AfterThreadedExecution virtual methods.
  *
+ *  When \c Execute is invoked from inside a thread pool worker -- i.e. the
+ *  domain threader is nested inside another parallel region -- the domain is
+ *  processed serially in the calling worker thread, so nested use composes
+ *  without oversubscribing the machine.
+ *
  *  \tparam TDomainPartitioner A class that inherits from
  *  ThreadedDomainPartitioner.
  *  \tparam TAssociate  The associated class that uses a derived version of
@@ -19,6 +19,7 @@
 #define itkDomainThreader_hxx
 
 #include "itkDomainThreader.h"
+#include "itkThreadPool.h"
 
 namespace itk
 {
@@ -83,6 +84,14 @@ DomainThreader< TDomainPartitioner, TAssociate >
 {
   ThreadIdType numberOfWorkUnits = this->GetNumberOfWorkUnits();
 
+  // When already executing inside a parallel region, process the domain
+  // in the calling worker thread. Nested thread teams would oversubscribe
+  // the machine, and the outer parallel loop already saturates the cores.
+  if( ThreadPool::IsPoolWorker() )
+    {
+    numberOfWorkUnits = 1;
+    }
+
   // Attempt a single dummy partition, just to get the number of subdomains actually created
   DomainType subdomain;
   this->m_NumberOfWorkUnitsUsed = this->m_DomainPartitioner->PartitionDomain(0,
@@ -19,6 +19,7 @@
 #define itkExtractImageFilter_h
 
 #include "itkInPlaceImageFilter.h"
+#include "itkIsSame.h"
 #include "itkSmartPointer.h"
 #include "itkExtractImageFilterRegionCopier.h"
 
@@ -220,6 +221,19 @@ public:
   void SetExtractionRegion(InputImageRegionType extractRegion);
   itkGetConstMacro(ExtractionRegion, InputImageRegionType);
 
+  /** Enable/Disable producing the output as a zero-copy view into the
+   * input buffer. A view is only possible when the input and output
+   * image types are the same and the extraction region is one
+   * contiguous run of the input buffer: full extent in the faster
+   * varying dimensions, optionally a sub-range in one dimension, and
+   * size one in all slower dimensions. Otherwise the usual copy is
+   * made. The view shares ownership of the input pixel container, so
+   * it remains valid after the input image is released, but writes
+   * through it are visible in the input buffer. Off by default. */
+  itkSetMacro(ViewOutput, bool);
+  itkGetConstMacro(ViewOutput, bool);
+  itkBooleanMacro(ViewOutput);
+
 #ifdef ITK_USE_CONCEPT_CHECKING
   // Begin concept checking
   itkConceptMacro( InputCovertibleToOutputCheck,
@@ -275,7 +289,20 @@ protected:
   OutputImageRegionType m_OutputImageRegion;
 
 private:
+  /** Produce the output as a view aliasing the input buffer. Returns
+   * false when the extraction region is not a contiguous block of the
+   * input memory; the caller then falls back to copying. */
+  bool GenerateViewOutput(const TrueType &);
+
+  // with different image types the output cannot alias the input
+  bool GenerateViewOutput(const FalseType &)
+  {
+    return false;
+  }
+
   DIRECTIONCOLLAPSESTRATEGY m_DirectionCollapseStrategy;
+
+  bool m_ViewOutput;
 };
 } // end namespace itk
 
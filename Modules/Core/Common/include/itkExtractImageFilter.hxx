@@ -31,7 +31,8 @@ namespace itk
 template< typename TInputImage, typename TOutputImage >
 ExtractImageFilter< TInputImage, TOutputImage >
 ::ExtractImageFilter():
-  m_DirectionCollapseStrategy(DIRECTIONCOLLAPSETOUNKOWN)
+  m_DirectionCollapseStrategy(DIRECTIONCOLLAPSETOUNKOWN),
+  m_ViewOutput(false)
 {
   Superclass::InPlaceOff();
   this->DynamicMultiThreadingOn();
@@ -50,6 +51,7 @@ ExtractImageFilter< TInputImage, TOutputImage >
   os << indent << "ExtractionRegion: " << m_ExtractionRegion << std::endl;
   os << indent << "OutputImageRegion: " << m_OutputImageRegion << std::endl;
   os << indent << "DirectionCollapseStrategy: " << m_DirectionCollapseStrategy << std::endl;
+  os << indent << "ViewOutput: " << ( m_ViewOutput ? "On" : "Off" ) << std::endl;
 }
 
 template< typename TInputImage, typename TOutputImage >
@@ -266,6 +268,13 @@ void
 ExtractImageFilter< TInputImage, TOutputImage >
 ::GenerateData()
 {
+  // When requested, try to alias the input buffer instead of copying.
+  if ( m_ViewOutput
+       && this->GenerateViewOutput( IsSame< TInputImage, TOutputImage >() ) )
+    {
+    this->UpdateProgress( 1.0 );
+    return;
+    }
 
   // InPlace::AllocateOutputs set the running in place ivar.
   // This method will be called again, by GenerateData, but there is
@@ -288,6 +297,66 @@ ExtractImageFilter< TInputImage, TOutputImage >
   this->Superclass::GenerateData();
 }
 
+template< typename TInputImage, typename TOutputImage >
+bool
+ExtractImageFilter< TInputImage, TOutputImage >
+::GenerateViewOutput(const TrueType &)
+{
+  const InputImageType *inputPtr = this->GetInput();
+  OutputImageType      *outputPtr = this->GetOutput();
+
+  const InputImageRegionType & bufferedRegion = inputPtr->GetBufferedRegion();
+  const SizeValueType numberOfBufferedPixels = bufferedRegion.GetNumberOfPixels();
+
+  if ( inputPtr->GetBufferPointer() == nullptr
+       || numberOfBufferedPixels == 0
+       || !bufferedRegion.IsInside( m_ExtractionRegion ) )
+    {
+    return false;
+    }
+
+  // The extracted block must be one contiguous run of the input buffer:
+  // full extent in the faster varying dimensions, optionally a sub-range
+  // in one dimension, and size one in all slower dimensions.
+  bool fullExtentSoFar = true;
+  for ( unsigned int i = 0; i < InputImageDimension; ++i )
+    {
+    if ( !fullExtentSoFar && m_ExtractionRegion.GetSize()[i] > 1 )
+      {
+      return false;
+      }
+    if ( m_ExtractionRegion.GetSize()[i] != bufferedRegion.GetSize()[i]
+         || m_ExtractionRegion.GetIndex()[i] != bufferedRegion.GetIndex()[i] )
+      {
+      fullExtentSoFar = false;
+      }
+    }
+
+  // Number of buffer elements per pixel. This is greater than one for
+  // images that store the pixel components directly, e.g. VectorImage.
+  const SizeValueType elementsPerPixel =
+    inputPtr->GetPixelContainer()->Size() / numberOfBufferedPixels;
+
+  const OffsetValueType pixelOffset =
+    inputPtr->ComputeOffset( m_ExtractionRegion.GetIndex() );
+
+  outputPtr->SetBufferedRegion(m_OutputImageRegion);
+
+  using OutputPixelContainerType = typename OutputImageType::PixelContainer;
+  using ElementType = typename OutputPixelContainerType::Element;
+
+  typename OutputPixelContainerType::Pointer view = OutputPixelContainerType::New();
+  auto * buffer = const_cast< ElementType * >( inputPtr->GetBufferPointer() );
+  view->SetImportPointer( buffer + pixelOffset * static_cast< OffsetValueType >( elementsPerPixel ),
+                          m_ExtractionRegion.GetNumberOfPixels() * elementsPerPixel,
+                          false );
+  // share ownership so the buffer outlives a released input image
+  view->SetBufferOwner( inputPtr->GetPixelContainer() );
+  outputPtr->SetPixelContainer(view);
+
+  return true;
+}
+
 /**
  * ExtractImageFilter can be implemented as a multithreaded filter.
  * Therefore, this implementation provides a DynamicThreadedGenerateData()
@@ -172,7 +172,11 @@ public:
 
 
   /** Allocate the image memory. The size of the image must
-   * already be set, e.g. by calling SetRegions(). */
+   * already be set, e.g. by calling SetRegions(). When the global
+   * parallel first-touch policy is enabled the pages of the new buffer
+   * are faulted (and, if requested, zeroed) in parallel.
+   *
+   * \sa ImageAllocatorBase::SetGlobalParallelFirstTouch */
   void Allocate(bool initializePixels = false) override;
 
   /** Restore the data object to its initial state. This means releasing
@@ -291,6 +295,10 @@ protected:
   void ComputeIndexToPhysicalPointMatrices() override;
   using Superclass::Graft;
 private:
+  /** Fault the pages of a freshly allocated buffer in parallel, with
+   * the same region decomposition later filter threads will use. */
+  void ParallelFirstTouch(bool initializePixels);
+
   /** Memory for the current buffer. */
   PixelContainerPointer m_Buffer;
 };
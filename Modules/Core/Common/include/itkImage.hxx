@@ -30,7 +30,11 @@
 
 #include "itkImage.h"
 #include "itkProcessObject.h"
+#include "itkImageAllocatorBase.h"
+#include "itkMultiThreaderBase.h"
 #include <algorithm>
+#include <cstring>
+#include <type_traits>
 
 namespace itk
 {
@@ -53,9 +57,80 @@ Image< TPixel, VImageDimension >
   this->ComputeOffsetTable();
   num = static_cast<SizeValueType>(this->GetOffsetTable()[VImageDimension]);
 
+  if ( ImageAllocatorBase::GetGlobalParallelFirstTouch()
+       && std::is_trivially_default_constructible< TPixel >::value
+       && num > 0 )
+    {
+    // Allocate without touching the memory, then fault (and possibly
+    // zero) the pages in parallel. Reserve would otherwise fault every
+    // page on this thread, either through the zero-fill or the first
+    // writing pass over the buffer.
+    m_Buffer->Reserve(num, false);
+    this->ParallelFirstTouch(initializePixels);
+    return;
+    }
+
   m_Buffer->Reserve(num, initializePixels);
 }
 
+template< typename TPixel, unsigned int VImageDimension >
+void
+Image< TPixel, VImageDimension >
+::ParallelFirstTouch(bool initializePixels)
+{
+  const RegionType bufferedRegion = this->GetBufferedRegion();
+  TPixel *         buffer = this->GetBufferPointer();
+
+  // The regions handed out below follow the same decomposition later
+  // ParallelizeImageRegion based filter threads will use, so pages end
+  // up on the NUMA node of the thread that will process them.
+  MultiThreaderBase::Pointer threader = MultiThreaderBase::New();
+  threader->ParallelizeImageRegion< VImageDimension >(
+    bufferedRegion,
+    [this, buffer, initializePixels](const RegionType & region)
+      {
+      // A touch interval no larger than any common page size; touching
+      // more often than the actual page size only costs a few stores.
+      constexpr SizeValueType pageSize = 4096;
+
+      const SizeValueType lineLength = region.GetSize(0);
+      const SizeValueType numberOfLines = region.GetNumberOfPixels() / lineLength;
+
+      IndexType lineIndex = region.GetIndex();
+      for ( SizeValueType line = 0; line < numberOfLines; ++line )
+        {
+        auto *              lineStart =
+          reinterpret_cast< unsigned char * >( buffer + this->ComputeOffset(lineIndex) );
+        const SizeValueType lineBytes = lineLength * sizeof( TPixel );
+
+        if ( initializePixels )
+          {
+          memset( static_cast< void * >( lineStart ), 0, lineBytes );
+          }
+        else
+          {
+          for ( SizeValueType b = 0; b < lineBytes; b += pageSize )
+            {
+            lineStart[b] = 0;
+            }
+          }
+
+        // advance to the next scanline of the region
+        for ( unsigned int i = 1; i < VImageDimension; ++i )
+          {
+          ++lineIndex[i];
+          if ( lineIndex[i] < region.GetIndex()[i]
+                              + static_cast< OffsetValueType >( region.GetSize()[i] ) )
+            {
+            break;
+            }
+          lineIndex[i] = region.GetIndex()[i];
+          }
+        }
+      },
+    nullptr);
+}
+
 
 template< typename TPixel, unsigned int VImageDimension >
 void
@@ -0,0 +1,102 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkImageAllocatorBase_h
+#define itkImageAllocatorBase_h
+
+#include "itkObject.h"
+#include "itkObjectFactory.h"
+
+namespace itk
+{
+/** \class ImageAllocatorBase
+ * \brief Policy object providing raw memory for image pixel buffers.
+ *
+ * ImportImageContainer obtains its pixel buffer through the global
+ * default allocator when one has been installed, instead of plain
+ * new[]. This allows applications that cycle through many large volumes
+ * to plug in pooling or huge-page backed allocation strategies without
+ * touching the image classes.
+ *
+ * The base implementation simply forwards to ::operator new and
+ * ::operator delete. Subclasses override Allocate and Deallocate;
+ * both must be concurrent thread safe, as images are allocated and
+ * released from multiple threads.
+ *
+ * Installing a global allocator is not concurrent thread safe and
+ * should be done during application start-up, before any images are
+ * allocated.
+ *
+ * \sa PoolImageAllocator
+ * \sa ImportImageContainer
+ *
+ * \ingroup ImageObjects
+ * \ingroup ITKSystemObjects
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT ImageAllocatorBase : public Object
+{
+public:
+  ITK_DISALLOW_COPY_AND_ASSIGN(ImageAllocatorBase);
+
+  /** Standard class type aliases. */
+  using Self = ImageAllocatorBase;
+  using Superclass = Object;
+  using Pointer = SmartPointer< Self >;
+  using ConstPointer = SmartPointer< const Self >;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(ImageAllocatorBase, Object);
+
+  /** Allocate a block of at least the given number of bytes, suitably
+   * aligned for any pixel type. Throws std::bad_alloc on failure. */
+  virtual void * Allocate(SizeValueType numberOfBytes);
+
+  /** Return a block previously obtained from Allocate. The byte count
+   * must match the one passed to Allocate. */
+  virtual void Deallocate(void * buffer, SizeValueType numberOfBytes);
+
+  /** Set/Get the allocator used for image pixel buffers. The default is
+   * nullptr, which makes ImportImageContainer use new[]/delete[].
+   * Setting the global allocator is not concurrent thread safe. */
+  static void SetGlobalDefaultAllocator( ImageAllocatorBase * allocator );
+  static ImageAllocatorBase * GetGlobalDefaultAllocator();
+
+  /** Set/Get whether Image::Allocate faults the pages of a freshly
+   * allocated buffer in parallel, using the same region decomposition
+   * later filter threads will use. Serial zero-filling (or the first
+   * writing pass of a filter) otherwise faults every page on one
+   * thread, which dominates allocation time for multi-gigabyte images
+   * and places all pages on one NUMA node. Off by default; setting the
+   * flag is not concurrent thread safe. */
+  static void SetGlobalParallelFirstTouch( bool enabled );
+  static bool GetGlobalParallelFirstTouch();
+
+protected:
+  ImageAllocatorBase();
+  ~ImageAllocatorBase() override;
+
+private:
+  static Pointer m_GlobalDefaultAllocator;
+  static bool    m_GlobalParallelFirstTouch;
+};
+} // end namespace itk
+
+#endif
@@ -0,0 +1,135 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkImageRegionSplitterCacheAwareTile_h
+#define itkImageRegionSplitterCacheAwareTile_h
+
+#include "itkImageRegionSplitterBase.h"
+
+namespace itk
+{
+/** \class ImageRegionSplitterCacheAwareTile
+ * \brief Divide a region into cache-sized multidimensional tiles.
+ *
+ * The default ImageRegionSplitterSlowDimension slices only the slowest
+ * dimension of a region. On large 3D images this produces long thin
+ * slabs whose working set far exceeds the processor cache, so a
+ * neighborhood filter reloads every scanline's neighbors from main
+ * memory. This splitter instead divides the region along several
+ * dimensions, like ImageRegionSplitterMultidimensional, but chooses
+ * which dimension to split from an estimate of the per-tile working
+ * set:
+ *
+ * \li While a tile (padded by KernelRadius on every side and scaled by
+ * BytesPerPixel) does not fit in the cache, the dimension with the
+ * largest padded extent is split, shrinking tiles toward a square-ish
+ * shape that maximizes neighborhood reuse.
+ * \li Once tiles fit in the cache, any further splits needed to reach
+ * the requested number of pieces are taken from the slowest splittable
+ * dimension, which preserves scanline contiguity and costs no reuse.
+ *
+ * The cache size is detected from the processor's level 2 data cache
+ * and may be overridden with SetCacheSize for experimentation or for
+ * machines the detection does not know. KernelRadius should be set to
+ * the neighborhood radius of the consuming filter (zero for pointwise
+ * filters) and BytesPerPixel to the pixel size of the streamed image.
+ *
+ * Like the other splitters, no more than the requested number of
+ * pieces is ever returned.
+ *
+ * \sa ImageRegionSplitterSlowDimension
+ * \sa ImageRegionSplitterMultidimensional
+ *
+ * \ingroup ITKSystemObjects
+ * \ingroup DataProcessing
+ * \ingroup ITKCommon
+ */
+
+class ITKCommon_EXPORT ImageRegionSplitterCacheAwareTile
+  : public ImageRegionSplitterBase
+{
+public:
+  ITK_DISALLOW_COPY_AND_ASSIGN(ImageRegionSplitterCacheAwareTile);
+
+  /** Standard class type aliases. */
+  using Self = ImageRegionSplitterCacheAwareTile;
+  using Superclass = ImageRegionSplitterBase;
+  using Pointer = SmartPointer< Self >;
+  using ConstPointer = SmartPointer< const Self >;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(ImageRegionSplitterCacheAwareTile, ImageRegionSplitterBase);
+
+  /** Set/Get the number of bytes of one pixel of the streamed image,
+   * used to convert tile extents into working-set bytes. Defaults to
+   * the size of a float. */
+  itkSetMacro(BytesPerPixel, unsigned int);
+  itkGetConstMacro(BytesPerPixel, unsigned int);
+
+  /** Set/Get the neighborhood radius of the consuming filter. Each
+   * tile is padded by this radius on every side when its working set
+   * is estimated. Defaults to zero. */
+  itkSetMacro(KernelRadius, SizeValueType);
+  itkGetConstMacro(KernelRadius, SizeValueType);
+
+  /** Set/Get the cache size in bytes a tile's working set should fit
+   * in. The default of zero detects the processor's level 2 data
+   * cache. */
+  itkSetMacro(CacheSize, SizeValueType);
+  itkGetConstMacro(CacheSize, SizeValueType);
+
+protected:
+  ImageRegionSplitterCacheAwareTile();
+
+  unsigned int GetNumberOfSplitsInternal(unsigned int dim,
+                                         const IndexValueType regionIndex[],
+                                         const SizeValueType regionSize[],
+                                         unsigned int requestedNumber) const override;
+
+  unsigned int GetSplitInternal(unsigned int dim,
+                                unsigned int i,
+                                unsigned int numberOfPieces,
+                                IndexValueType regionIndex[],
+                                SizeValueType regionSize[]) const override;
+
+  void PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  unsigned int ComputeSplits(unsigned int dim,
+                             unsigned int requestedNumber,
+                             const SizeValueType regionSize[],
+                             unsigned int splits[]) const;
+
+  /** Working-set bytes of one tile of the given splits. */
+  double ComputeTileWorkingSet(unsigned int dim,
+                               const SizeValueType regionSize[],
+                               const unsigned int splits[]) const;
+
+  /** The cache size to target: m_CacheSize when set, the detected
+   * level 2 data cache otherwise. */
+  SizeValueType GetEffectiveCacheSize() const;
+
+  unsigned int  m_BytesPerPixel;
+  SizeValueType m_KernelRadius;
+  SizeValueType m_CacheSize;
+};
+} // end namespace itk
+
+#endif
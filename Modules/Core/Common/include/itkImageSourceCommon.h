@@ -42,6 +42,14 @@ struct ITKCommon_EXPORT ImageSourceCommon
    * Provide access to a common static object for image region splitting
    */
   static  const ImageRegionSplitterBase*  GetGlobalDefaultSplitter();
+
+  /**
+   * Replace the common splitter used by image sources that do not
+   * override GetImageRegionSplitter. Passing nullptr restores the
+   * built-in ImageRegionSplitterSlowDimension. The object is shared by
+   * all filters, so it should be configured before pipelines execute.
+   */
+  static  void  SetGlobalDefaultSplitter(ImageRegionSplitterBase *splitter);
 };
 
 } // end namespace itk
@@ -20,6 +20,7 @@
 
 #include "itkObject.h"
 #include "itkObjectFactory.h"
+#include "itkImageAllocatorBase.h"
 #include <utility>
 
 namespace itk
@@ -75,6 +76,24 @@ public:
   void SetImportPointer(TElement *ptr, TElementIdentifier num,
                         bool LetContainerManageMemory = false);
 
+  /** Set the pointer from which the image data is imported, releasing
+   * it through the given allocator's Deallocate() instead of delete[]
+   * once the container manages the memory. This is used to adopt
+   * buffers with a custom release action, such as unmapping a
+   * memory-mapped file. */
+  void SetImportPointer(TElement *ptr, TElementIdentifier num,
+                        bool LetContainerManageMemory,
+                        ImageAllocatorBase *allocator);
+
+  /** Register the object that owns the memory behind an imported,
+   * non-owning buffer (LetContainerManageMemory false). The owner is
+   * held until the buffer is replaced or released, so a container that
+   * is a view into another container's memory keeps that memory alive. */
+  void SetBufferOwner(const Object *owner)
+  { m_BufferOwner = owner; this->Modified(); }
+  const Object * GetBufferOwner() const
+  { return m_BufferOwner; }
+
   /** Index operator. This version can be an lvalue. */
   TElement & operator[](const ElementIdentifier id)
   { return m_ImportPointer[id]; }
@@ -182,6 +201,16 @@ private:
   TElementIdentifier m_Size;
   TElementIdentifier m_Capacity;
   bool               m_ContainerManageMemory;
+
+  /** The allocator the current buffer was obtained from, or nullptr when
+   * the buffer came from new[] or an external import. Recorded at
+   * allocation time so the matching Deallocate is used even if the
+   * global default allocator changes afterwards. */
+  mutable ImageAllocatorBase::Pointer m_Allocator;
+
+  /** Owner of the memory behind a non-owning imported buffer, or
+   * nullptr. Held only to extend the owner's lifetime. */
+  Object::ConstPointer m_BufferOwner;
 };
 } // end namespace itk
 
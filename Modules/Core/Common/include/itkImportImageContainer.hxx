@@ -29,6 +29,10 @@
 #define itkImportImageContainer_hxx
 
 #include "itkImportImageContainer.h"
+#include "itkPipelineProfiler.h"
+
+#include <cstring>
+#include <type_traits>
 
 namespace itk
 {
@@ -65,13 +69,19 @@ ImportImageContainer< TElementIdentifier, TElement >
     {
     if ( size > m_Capacity )
       {
+      // AllocateElements records the allocator of the new buffer; the old
+      // buffer must be released with the allocator it came from.
+      ImageAllocatorBase::Pointer oldAllocator = m_Allocator;
       TElement *temp = this->AllocateElements(size, UseDefaultConstructor);
+      ImageAllocatorBase::Pointer newAllocator = m_Allocator;
       // only copy the portion of the data used in the old buffer
       std::copy(m_ImportPointer,
                 m_ImportPointer+m_Size,
                 temp);
 
+      m_Allocator = oldAllocator;
       DeallocateManagedMemory();
+      m_Allocator = newAllocator;
 
       m_ImportPointer = temp;
       m_ContainerManageMemory = true;
@@ -109,12 +119,17 @@ ImportImageContainer< TElementIdentifier, TElement >
     if ( m_Size < m_Capacity )
       {
       const TElementIdentifier size = m_Size;
+      // see the matching dance in Reserve
+      ImageAllocatorBase::Pointer oldAllocator = m_Allocator;
       TElement *               temp = this->AllocateElements(size, false);
+      ImageAllocatorBase::Pointer newAllocator = m_Allocator;
       std::copy(m_ImportPointer,
                 m_ImportPointer+m_Size,
                 temp);
 
+      m_Allocator = oldAllocator;
       DeallocateManagedMemory();
+      m_Allocator = newAllocator;
 
       m_ImportPointer = temp;
       m_ContainerManageMemory = true;
@@ -168,6 +183,18 @@ ImportImageContainer< TElementIdentifier, TElement >
   this->Modified();
 }
 
+template< typename TElementIdentifier, typename TElement >
+void
+ImportImageContainer< TElementIdentifier, TElement >
+::SetImportPointer(TElement *ptr, TElementIdentifier num,
+                   bool LetContainerManageMemory,
+                   ImageAllocatorBase *allocator)
+{
+  // releases any previous buffer and resets m_Allocator
+  this->SetImportPointer(ptr, num, LetContainerManageMemory);
+  m_Allocator = allocator;
+}
+
 template< typename TElementIdentifier, typename TElement >
 TElement *ImportImageContainer< TElementIdentifier, TElement >
 ::AllocateElements(ElementIdentifier size, bool UseDefaultConstructor ) const
@@ -179,13 +206,27 @@ TElement *ImportImageContainer< TElementIdentifier, TElement >
 
   try
     {
-    if ( UseDefaultConstructor )
+    ImageAllocatorBase * allocator = ImageAllocatorBase::GetGlobalDefaultAllocator();
+    if ( allocator
+         && std::is_trivially_default_constructible< TElement >::value
+         && std::is_trivially_destructible< TElement >::value )
+      {
+      data = static_cast< TElement * >( allocator->Allocate( size * sizeof( TElement ) ) );
+      if ( UseDefaultConstructor && data )
+        {
+        memset( static_cast< void * >( data ), 0, size * sizeof( TElement ) );
+        }
+      m_Allocator = allocator;
+      }
+    else if ( UseDefaultConstructor )
       {
       data = new TElement[size](); //POD types initialized to 0, others use default constructor.
+      m_Allocator = nullptr;
       }
     else
       {
       data = new TElement[size]; //Faster but uninitialized
+      m_Allocator = nullptr;
       }
     }
   catch ( ... )
@@ -200,6 +241,11 @@ TElement *ImportImageContainer< TElementIdentifier, TElement >
                                 "Failed to allocate memory for image.",
                                 ITK_LOCATION);
     }
+  if ( PipelineProfiler::GetEnabled() )
+    {
+    PipelineProfiler::RegisterAllocation(
+      data, static_cast< SizeValueType >( size ) * sizeof( TElement ) );
+    }
   return data;
 }
 
@@ -210,8 +256,21 @@ void ImportImageContainer< TElementIdentifier, TElement >
   // Encapsulate all image memory deallocation here
   if ( m_ContainerManageMemory )
     {
-    delete[] m_ImportPointer;
+    if ( m_ImportPointer && PipelineProfiler::GetEnabled() )
+      {
+      PipelineProfiler::RegisterDeallocation( m_ImportPointer );
+      }
+    if ( m_Allocator )
+      {
+      m_Allocator->Deallocate( m_ImportPointer, m_Capacity * sizeof( TElement ) );
+      }
+    else
+      {
+      delete[] m_ImportPointer;
+      }
     }
+  m_Allocator = nullptr;
+  m_BufferOwner = nullptr;
   m_ImportPointer = nullptr;
   m_Capacity = 0;
   m_Size = 0;
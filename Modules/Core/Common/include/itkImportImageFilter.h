@@ -19,6 +19,7 @@
 #define itkImportImageFilter_h
 
 #include "itkImageSource.h"
+#include "itkSharedMemorySegment.h"
 
 namespace itk
 {
@@ -91,6 +92,13 @@ public:
   void SetImportPointer(TPixel *ptr, SizeValueType num,
       bool LetImageContainerManageMemory);
 
+  /** Import the pixel buffer from a shared memory segment created or
+   * opened by the application. The number of pixels is derived from the
+   * segment size. The output image holds a reference to the segment
+   * through its pixel container, so the mapping stays valid for as long
+   * as any image uses it, independently of this filter's lifetime. */
+  void SetSharedMemorySegment(SharedMemorySegment *segment);
+
   /** Set the region object that defines the size and starting index
    * for the imported image. This will serve as the LargestPossibleRegion,
    * the BufferedRegion, and the RequestedRegion.
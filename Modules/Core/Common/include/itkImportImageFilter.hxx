@@ -111,6 +111,24 @@ ImportImageFilter< TPixel, VImageDimension >
     }
 }
 
+/**
+ *
+ */
+template< typename TPixel, unsigned int VImageDimension >
+void
+ImportImageFilter< TPixel, VImageDimension >
+::SetSharedMemorySegment(SharedMemorySegment *segment)
+{
+  m_Size = segment->GetNumberOfBytes() / sizeof( TPixel );
+  m_ImportImageContainer = ImportImageContainerType::New();
+  // The container does not own the mapping; the segment does, and the
+  // buffer owner reference keeps it alive while the image exists.
+  m_ImportImageContainer->SetImportPointer(
+    static_cast< TPixel * >( segment->GetBufferPointer() ), m_Size, false );
+  m_ImportImageContainer->SetBufferOwner( segment );
+  this->Modified();
+}
+
 /**
  *
  */
@@ -30,6 +30,8 @@
 
 #include "itkMathDetail.h"
 #include "itkConceptChecking.h"
+#include <cstring>
+#include <limits>
 #include <vnl/vnl_math.h>
 
 /* Only maintain backwards compatibility with old versions
@@ -737,6 +739,112 @@ ITKCommon_EXPORT unsigned long      GreatestPrimeFactor( unsigned long n );
 ITKCommon_EXPORT unsigned long long GreatestPrimeFactor( unsigned long long n );
 
 
+/** Fast approximation of std::exp for double arguments.
+ *
+ * The argument is reduced to x = n ln2 + r with |r| <= ln2 / 2, exp(r)
+ * is evaluated as a degree-9 polynomial, and the result is scaled by
+ * 2^n assembled directly in the exponent bits. The relative error stays
+ * below 1e-11, far under one unit in the last place of a float, so the
+ * approximation is exact for every pixel type with less precision than
+ * double. All operations are plain inline arithmetic, which lets the
+ * compiler keep pixel loops vectorizable instead of calling out to the
+ * math library for every pixel. NaN arguments pass through, arguments
+ * above 709 saturate to infinity (marginally before std::exp, which
+ * overflows near 709.8), and arguments below -708 return zero. */
+inline double FastApproximateExp( const double & x )
+{
+  if ( std::isnan( x ) )
+    {
+    return x;
+    }
+  if ( x > 709.0 )
+    {
+    return std::numeric_limits< double >::infinity();
+    }
+  if ( x < -708.0 )
+    {
+    return 0.0;
+    }
+
+  // x = n ln2 + r, with ln2 split in two pieces to keep the reduction
+  // accurate.
+  const double n = std::floor( x * log2e + 0.5 );
+  constexpr double ln2Hi = 6.93145751953125e-1;
+  constexpr double ln2Lo = 1.42860682030941723212e-6;
+  const double r = ( x - n * ln2Hi ) - n * ln2Lo;
+
+  // Degree-9 polynomial for exp(r) on [-ln2/2, ln2/2].
+  double p = 1.0 / 362880.0;
+  p = p * r + 1.0 / 40320.0;
+  p = p * r + 1.0 / 5040.0;
+  p = p * r + 1.0 / 720.0;
+  p = p * r + 1.0 / 120.0;
+  p = p * r + 1.0 / 24.0;
+  p = p * r + 1.0 / 6.0;
+  p = p * r + 0.5;
+  p = p * r + 1.0;
+  p = p * r + 1.0;
+
+  // Scale by 2^n through the exponent bits. n stays within [-1021, 1023]
+  // because of the range checks above, so the scale is a normal number.
+  const auto bits =
+    static_cast< uint64_t >( static_cast< int64_t >( n ) + 1023 ) << 52;
+  double scale;
+  std::memcpy( &scale, &bits, sizeof( scale ) );
+
+  return p * scale;
+}
+
+/** Fast approximation of std::log for double arguments.
+ *
+ * The argument is split into mantissa and exponent, the mantissa is
+ * normalized to [sqrt(1/2), sqrt(2)) and its logarithm evaluated with
+ * the atanh series, then the exponent contribution is added back with a
+ * split ln2. The absolute error stays below 1e-10, under one unit in
+ * the last place of a float result over the full range. Arguments that
+ * are not positive normal numbers (zero, negatives, subnormals,
+ * infinities, NaN) are passed through std::log for the exact IEEE
+ * behavior.
+ * \sa FastApproximateExp */
+inline double FastApproximateLog( const double & x )
+{
+  if ( ! ( x >= std::numeric_limits< double >::min()
+           && x < std::numeric_limits< double >::infinity() ) )
+    {
+    return std::log( x );
+    }
+
+  // Split off the exponent and normalize the mantissa m to
+  // [sqrt(1/2), sqrt(2)) so the series below stays short.
+  uint64_t bits;
+  std::memcpy( &bits, &x, sizeof( bits ) );
+  auto exponent =
+    static_cast< double >( static_cast< int >( ( bits >> 52 ) & 0x7FF ) - 1022 );
+  bits = ( bits & 0x000FFFFFFFFFFFFFull ) | 0x3FE0000000000000ull;
+  double m;
+  std::memcpy( &m, &bits, sizeof( m ) );
+  if ( m < sqrt1_2 )
+    {
+    m *= 2.0;
+    exponent -= 1.0;
+    }
+
+  // log(m) = 2 atanh( (m - 1) / (m + 1) )
+  const double s = ( m - 1.0 ) / ( m + 1.0 );
+  const double z = s * s;
+  double p = 2.0 / 11.0;
+  p = p * z + 2.0 / 9.0;
+  p = p * z + 2.0 / 7.0;
+  p = p * z + 2.0 / 5.0;
+  p = p * z + 2.0 / 3.0;
+  p = p * z + 2.0;
+  p = p * s;
+
+  constexpr double ln2Hi = 6.93147180369123816490e-1;
+  constexpr double ln2Lo = 1.90821492927058770002e-10;
+  return exponent * ln2Hi + ( p + exponent * ln2Lo );
+}
+
 /*==========================================
  * Alias the vnl_math functions in the itk::Math
  * namespace. If possible, use the std:: equivalents
@@ -21,6 +21,7 @@
 #include "itkMetaDataObjectBase.h"
 #include <vector>
 #include <map>
+#include <memory>
 #include <string>
 
 namespace itk
@@ -35,6 +36,11 @@ namespace itk
  * classes, is designed to provide a mechanism for storing a collection of
  * arbitrary data types. The main motivation for such a collection is to
  * associate arbitrary data elements with itk DataObjects.
+ *
+ * The dictionary is copy-on-write: copying or assigning shares the
+ * underlying map, and the map is only cloned when a sharing dictionary
+ * is modified. The const index operator does not create an entry for a
+ * missing key; it returns nullptr instead.
  * \ingroup ITKCommon
  */
 class ITKCommon_EXPORT MetaDataDictionary
@@ -113,7 +119,13 @@ public:
   void Clear();
 
 private:
-  MetaDataDictionaryMapType *m_Dictionary;
+  /** Detach from any sharing copies before a mutation. Copies of a
+   * dictionary share one immutable map; the map is only cloned here,
+   * when a sharing dictionary is about to be modified. This makes
+   * propagating metadata through pipelines O(1) per filter. */
+  void MakeUnique();
+
+  std::shared_ptr< MetaDataDictionaryMapType > m_Dictionary;
 };
 }
 #endif // itkMetaDataDictionary_h
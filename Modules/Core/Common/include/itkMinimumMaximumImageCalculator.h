@@ -109,6 +109,21 @@ protected:
   void PrintSelf(std::ostream & os, Indent indent) const override;
 
 private:
+  /** Whether index a precedes index b in the scan order of the image
+   * (first index changes fastest). Used to keep the serial
+   * first-occurrence semantics when merging per-thread results. */
+  static bool IsIndexEarlier(const IndexType & a, const IndexType & b)
+  {
+    for ( unsigned int dim = TInputImage::ImageDimension; dim > 0; --dim )
+      {
+      if ( a[dim - 1] != b[dim - 1] )
+        {
+        return a[dim - 1] < b[dim - 1];
+        }
+      }
+    return false;
+  }
+
   PixelType         m_Minimum;
   PixelType         m_Maximum;
   ImageConstPointer m_Image;
@@ -20,8 +20,12 @@
 
 #include "itkMinimumMaximumImageCalculator.h"
 #include "itkImageRegionConstIteratorWithIndex.h"
+#include "itkMath.h"
+#include "itkMultiThreaderBase.h"
 #include "itkNumericTraits.h"
 
+#include <mutex>
+
 namespace itk
 {
 
@@ -47,25 +51,66 @@ MinimumMaximumImageCalculator< TInputImage >
     m_Region = m_Image->GetRequestedRegion();
     }
 
-  ImageRegionConstIteratorWithIndex< TInputImage > it(m_Image, m_Region);
   m_Maximum = NumericTraits< PixelType >::NonpositiveMin();
   m_Minimum = NumericTraits< PixelType >::max();
 
-  while ( !it.IsAtEnd() )
+  // each thread scans its piece of the region exactly as the serial
+  // version did and the (value, index) partials are merged under the
+  // lock, with ties between threads resolved to the index that the
+  // serial scan would have visited first
+  std::mutex mutex;
+  MultiThreaderBase::Pointer multiThreader = MultiThreaderBase::New();
+  multiThreader->template ParallelizeImageRegion< TInputImage::ImageDimension >(
+    m_Region,
+    [this, &mutex](const RegionType & regionForThread)
     {
-    const PixelType value = it.Get();
-    if ( value > m_Maximum )
-      {
-      m_Maximum = value;
-      m_IndexOfMaximum = it.GetIndex();
-      }
-    if ( value < m_Minimum )
-      {
-      m_Minimum = value;
-      m_IndexOfMinimum = it.GetIndex();
-      }
-    ++it;
-    }
+      PixelType localMaximum = NumericTraits< PixelType >::NonpositiveMin();
+      PixelType localMinimum = NumericTraits< PixelType >::max();
+      IndexType localIndexOfMaximum;
+      IndexType localIndexOfMinimum;
+      localIndexOfMaximum.Fill(0);
+      localIndexOfMinimum.Fill(0);
+      bool foundMaximum = false;
+      bool foundMinimum = false;
+
+      ImageRegionConstIteratorWithIndex< TInputImage > it(m_Image, regionForThread);
+      while ( !it.IsAtEnd() )
+        {
+        const PixelType value = it.Get();
+        if ( value > localMaximum )
+          {
+          localMaximum = value;
+          localIndexOfMaximum = it.GetIndex();
+          foundMaximum = true;
+          }
+        if ( value < localMinimum )
+          {
+          localMinimum = value;
+          localIndexOfMinimum = it.GetIndex();
+          foundMinimum = true;
+          }
+        ++it;
+        }
+
+      std::lock_guard< std::mutex > mutexHolder(mutex);
+      if ( foundMaximum
+           && ( localMaximum > m_Maximum
+                || ( Math::ExactlyEquals(localMaximum, m_Maximum)
+                     && IsIndexEarlier(localIndexOfMaximum, m_IndexOfMaximum) ) ) )
+        {
+        m_Maximum = localMaximum;
+        m_IndexOfMaximum = localIndexOfMaximum;
+        }
+      if ( foundMinimum
+           && ( localMinimum < m_Minimum
+                || ( Math::ExactlyEquals(localMinimum, m_Minimum)
+                     && IsIndexEarlier(localIndexOfMinimum, m_IndexOfMinimum) ) ) )
+        {
+        m_Minimum = localMinimum;
+        m_IndexOfMinimum = localIndexOfMinimum;
+        }
+    },
+    nullptr);
 }
 
 template< typename TInputImage >
@@ -77,19 +122,43 @@ MinimumMaximumImageCalculator< TInputImage >
     {
     m_Region = m_Image->GetRequestedRegion();
     }
-  ImageRegionConstIteratorWithIndex< TInputImage > it(m_Image, m_Region);
   m_Minimum = NumericTraits< PixelType >::max();
 
-  while ( !it.IsAtEnd() )
+  std::mutex mutex;
+  MultiThreaderBase::Pointer multiThreader = MultiThreaderBase::New();
+  multiThreader->template ParallelizeImageRegion< TInputImage::ImageDimension >(
+    m_Region,
+    [this, &mutex](const RegionType & regionForThread)
     {
-    const PixelType value = it.Get();
-    if ( value < m_Minimum )
-      {
-      m_Minimum = value;
-      m_IndexOfMinimum = it.GetIndex();
-      }
-    ++it;
-    }
+      PixelType localMinimum = NumericTraits< PixelType >::max();
+      IndexType localIndexOfMinimum;
+      localIndexOfMinimum.Fill(0);
+      bool foundMinimum = false;
+
+      ImageRegionConstIteratorWithIndex< TInputImage > it(m_Image, regionForThread);
+      while ( !it.IsAtEnd() )
+        {
+        const PixelType value = it.Get();
+        if ( value < localMinimum )
+          {
+          localMinimum = value;
+          localIndexOfMinimum = it.GetIndex();
+          foundMinimum = true;
+          }
+        ++it;
+        }
+
+      std::lock_guard< std::mutex > mutexHolder(mutex);
+      if ( foundMinimum
+           && ( localMinimum < m_Minimum
+                || ( Math::ExactlyEquals(localMinimum, m_Minimum)
+                     && IsIndexEarlier(localIndexOfMinimum, m_IndexOfMinimum) ) ) )
+        {
+        m_Minimum = localMinimum;
+        m_IndexOfMinimum = localIndexOfMinimum;
+        }
+    },
+    nullptr);
 }
 
 template< typename TInputImage >
@@ -101,19 +170,43 @@ MinimumMaximumImageCalculator< TInputImage >
     {
     m_Region = m_Image->GetRequestedRegion();
     }
-  ImageRegionConstIteratorWithIndex< TInputImage > it(m_Image, m_Region);
   m_Maximum = NumericTraits< PixelType >::NonpositiveMin();
 
-  while ( !it.IsAtEnd() )
+  std::mutex mutex;
+  MultiThreaderBase::Pointer multiThreader = MultiThreaderBase::New();
+  multiThreader->template ParallelizeImageRegion< TInputImage::ImageDimension >(
+    m_Region,
+    [this, &mutex](const RegionType & regionForThread)
     {
-    const PixelType value = it.Get();
-    if ( value > m_Maximum )
-      {
-      m_Maximum = value;
-      m_IndexOfMaximum = it.GetIndex();
-      }
-    ++it;
-    }
+      PixelType localMaximum = NumericTraits< PixelType >::NonpositiveMin();
+      IndexType localIndexOfMaximum;
+      localIndexOfMaximum.Fill(0);
+      bool foundMaximum = false;
+
+      ImageRegionConstIteratorWithIndex< TInputImage > it(m_Image, regionForThread);
+      while ( !it.IsAtEnd() )
+        {
+        const PixelType value = it.Get();
+        if ( value > localMaximum )
+          {
+          localMaximum = value;
+          localIndexOfMaximum = it.GetIndex();
+          foundMaximum = true;
+          }
+        ++it;
+        }
+
+      std::lock_guard< std::mutex > mutexHolder(mutex);
+      if ( foundMaximum
+           && ( localMaximum > m_Maximum
+                || ( Math::ExactlyEquals(localMaximum, m_Maximum)
+                     && IsIndexEarlier(localIndexOfMaximum, m_IndexOfMaximum) ) ) )
+        {
+        m_Maximum = localMaximum;
+        m_IndexOfMaximum = localIndexOfMaximum;
+        }
+    },
+    nullptr);
 }
 
 template< typename TInputImage >
@@ -34,8 +34,12 @@
 #include "itkIntTypes.h"
 #include "itkImageRegion.h"
 #include "itkImageIORegion.h"
+#include <chrono>
 #include <functional>
+#include <iostream>
+#include <mutex>
 #include <thread>
+#include <vector>
 
 
 namespace itk
@@ -105,7 +109,7 @@ public:
 
   /** Currently supported types of multi-threader implementations.
    * Last will change with additional implementations. */
-  enum ThreaderType { Platform = 0, First = Platform, Pool, TBB, Last = TBB, Unknown = -1 };
+  enum ThreaderType { Platform = 0, First = Platform, Pool, TBB, WorkStealing, Last = WorkStealing, Unknown = -1 };
 
   /** Convert a threader name into its enum type. */
   static ThreaderType ThreaderTypeFromString(std::string threaderString);
@@ -124,6 +128,9 @@ public:
       case ThreaderType::TBB:
         return "TBB";
         break;
+      case ThreaderType::WorkStealing:
+        return "WorkStealing";
+        break;
       case ThreaderType::Unknown:
       default:
         return "Unknown";
@@ -340,6 +347,49 @@ INTEL_PRAGMA_WARN_POP
       ThreadingFunctorType funcP,
       ProcessObject* filter);
 
+  /** One record per parallel dispatch, collected when threading statistics
+   * are enabled. TotalWorkUnitTime divided by CallWallTime is the effective
+   * parallelism of the call; MaxWorkUnitTime against the per-work-unit mean
+   * exposes load imbalance. StolenWorkUnits is only filled in by threaders
+   * that rebalance, such as WorkStealingMultiThreader. */
+  struct ThreadingStatisticsRecord
+  {
+    std::string FilterName;
+
+    /** Number of timed work unit executions. For ParallelizeArray this is
+     * the number of array indices processed. */
+    SizeValueType NumberOfWorkUnits{ 0 };
+
+    /** Wall clock duration of the whole dispatch, in seconds. */
+    double CallWallTime{ 0.0 };
+
+    /** Total, shortest and longest work unit execution time, in seconds. */
+    double TotalWorkUnitTime{ 0.0 };
+    double MinWorkUnitTime{ 0.0 };
+    double MaxWorkUnitTime{ 0.0 };
+
+    /** Work units executed by a thread other than the one they were
+     * initially assigned to. */
+    SizeValueType StolenWorkUnits{ 0 };
+  };
+
+  /** Turn collection of per-dispatch threading statistics on or off for the
+   * whole process. The check is a single relaxed atomic load, so the
+   * counters can stay compiled into production builds. */
+  static void SetCollectThreadingStatistics(bool collect);
+
+  static bool GetCollectThreadingStatistics();
+
+  /** Discard all accumulated threading statistics records. */
+  static void ClearThreadingStatistics();
+
+  /** Return a copy of the records accumulated so far, in dispatch order. */
+  static std::vector< ThreadingStatisticsRecord > GetThreadingStatistics();
+
+  /** Print the accumulated records aggregated per filter name, with
+   * effective parallelism and imbalance figures. */
+  static void ReportThreadingStatistics(std::ostream & os = std::cout);
+
   /** Set/Get the pointer to MultiThreaderBaseGlobals.
    * Note that these functions are not part of the public API and should not be
    * used outside of ITK. They are an implementation detail and will be
@@ -357,6 +407,44 @@ protected:
    * If "abort generate data" is set, throws the ProcessAborted exception. */
   static void HandleFilterProgress(ProcessObject *filter, float progress = -1.0f);
 
+  /** Accumulates per-work-unit execution times for one parallel dispatch.
+   * A threader implementation wraps its functor before handing it to the
+   * workers, keeps the accumulator alive until all work units have
+   * completed, and then calls Record() to append a
+   * ThreadingStatisticsRecord to the global statistics. */
+  class ITKCommon_EXPORT ThreadingStatisticsAccumulator
+  {
+  public:
+    /** Construction marks the wall clock start of the dispatch. */
+    ThreadingStatisticsAccumulator();
+
+    /** Return a functor that times each invocation of the given one. The
+     * wrapped functor refers back to this accumulator, which must outlive
+     * it. */
+    ThreadingFunctorType WrapRegionFunctor(ThreadingFunctorType funcP);
+
+    ArrayThreadingFunctorType WrapArrayFunctor(ArrayThreadingFunctorType aFunc);
+
+    /** Count work units executed by a thread other than the one they were
+     * initially assigned to. */
+    void AddStolenWorkUnits(SizeValueType count);
+
+    /** Close the dispatch and append a record carrying the given filter's
+     * class name to the global statistics. */
+    void Record(ProcessObject * filter);
+
+  private:
+    void AddSample(double seconds);
+
+    std::chrono::steady_clock::time_point m_Start;
+    std::mutex    m_Mutex;
+    SizeValueType m_Count{ 0 };
+    double        m_Total{ 0.0 };
+    double        m_Min{ 0.0 };
+    double        m_Max{ 0.0 };
+    SizeValueType m_Stolen{ 0 };
+  };
+
   struct ArrayCallback
   {
     ArrayThreadingFunctorType functor;
@@ -154,6 +154,14 @@ public:
   /** Remove all observers . */
   void RemoveAllObservers();
 
+  /** Coalesce high-frequency events for the observer with this tag:
+   * its command is only executed on every Nth matching event. An
+   * interval of 1 (the default) executes on every event; a value of 0
+   * is treated as 1. Intermediate events are counted but not
+   * dispatched, which bounds the observer cost of events invoked in
+   * tight loops, such as per-iteration optimizer events. */
+  void SetObserverDispatchInterval(unsigned long tag, unsigned int interval);
+
   /** Return true if an observer is registered for this event. */
   bool HasObserver(const EventObject & event) const;
 
@@ -97,6 +97,17 @@ public:
    */
   static void RegisterFactoryInternal(ObjectFactoryBase *);
 
+  /** Queue a null-terminated list of factory registration functions to
+   * run the first time an instance of the given category (base class
+   * name, e.g. "itkImageIOBase") is requested through CreateInstance or
+   * CreateAllInstance. This is used by the per-application factory
+   * register managers so that built-in factories of a category are only
+   * instantiated when the category is first used, instead of during
+   * static initialization; short-lived processes that never touch a
+   * category skip its registration cost entirely. */
+  static void RegisterDeferredFactories(const char *categoryClassName,
+                                        void (**registrationList)());
+
   /** Position at which the new factory will be registered in the
    *  internal factory container.
    */
@@ -243,6 +254,10 @@ private:
   /** Register default factories which are not loaded at run time. */
   static void RegisterInternal();
 
+  /** Run the deferred registration functions queued for the category,
+   * if any. Called on the instance creation paths. */
+  static void ExecuteDeferredRegistration(const char *categoryClassName);
+
   /** Load dynamic factories from the ITK_AUTOLOAD_PATH */
   static void LoadDynamicFactories();
 
@@ -0,0 +1,178 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkPipelineProfiler_h
+#define itkPipelineProfiler_h
+
+#include "itkMacro.h"
+#include "itkIntTypes.h"
+
+#include <atomic>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace itk
+{
+/** \class PipelineProfiler
+ * \brief Global, always-available profiler for pipeline execution.
+ *
+ * The profiler collects one record per filter execution without any manual
+ * instrumentation: when profiling is enabled, ProcessObject::UpdateOutputData
+ * surrounds GenerateData() with measurements and ImportImageContainer
+ * reports the bulk buffers it allocates. Each record carries the filter
+ * class name, wall clock time, process CPU time accumulated by all threads,
+ * the number of bytes of pixel buffers allocated while the filter ran, and
+ * the number of work units the filter was configured with. The ratio of CPU
+ * to wall time indicates how well the execution parallelized.
+ *
+ * The state is process wide. Checking the enabled flag is a single relaxed
+ * atomic load, so leaving the profiler compiled into production builds
+ * costs nearly nothing while it is off. Typical use:
+ *
+ * \code
+ * itk::PipelineProfiler::SetEnabled( true );
+ * reader->Update();
+ * pipeline->Update();
+ * itk::PipelineProfiler::Report( std::cout );
+ * \endcode
+ *
+ * Records accumulate until Clear() is called. Recording is thread safe;
+ * filters updated concurrently each contribute their own record, but the
+ * allocation counter is global, so buffers allocated by concurrently
+ * executing filters may be attributed to either of them.
+ *
+ * In addition to the per-execution records, the profiler keeps a memory
+ * accounting registry: every bulk buffer ImportImageContainer allocates is
+ * charged to the filter updating on the allocating thread and released
+ * when the container frees it, giving live and peak byte counts per filter
+ * and a process-wide high-water mark. This attributes mid-pipeline memory
+ * spikes to the filters holding the buffers, which sampling the resident
+ * set size with MemoryProbe cannot do.
+ *
+ * \sa ProcessObject
+ * \sa TimeProbesCollectorBase
+ * \ingroup ITKSystemObjects
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT PipelineProfiler
+{
+public:
+  /** Measurements taken around one filter execution. */
+  struct FilterRecord
+  {
+    /** Class name of the filter, as reported by GetNameOfClass(). */
+    std::string FilterName;
+
+    /** Wall clock duration of GenerateData(), in seconds. */
+    double WallTime{ 0.0 };
+
+    /** CPU time consumed by the process during GenerateData(), summed over
+     * all threads, in seconds. */
+    double CPUTime{ 0.0 };
+
+    /** Bytes of bulk pixel buffers allocated through ImportImageContainer
+     * while the filter executed. */
+    SizeValueType BytesAllocated{ 0 };
+
+    /** Number of work units the filter was configured to split its
+     * requested region into. */
+    ThreadIdType NumberOfWorkUnits{ 1 };
+  };
+
+  /** Turn profiling on or off for the whole process. */
+  static void SetEnabled(bool enabled);
+
+  static bool GetEnabled();
+
+  /** Discard all accumulated records and reset the allocation counter. */
+  static void Clear();
+
+  /** Return a copy of the records accumulated so far, in execution order. */
+  static std::vector< FilterRecord > GetRecords();
+
+  /** Print the accumulated records as a human readable table. */
+  static void Report(std::ostream & os = std::cout);
+
+  /** Print the accumulated records as a JSON array. */
+  static void JSONReport(std::ostream & os = std::cout);
+
+  /** Count bytes of bulk data allocated while a filter executes. Called by
+   * ImportImageContainer; not intended for application code. */
+  static void RecordAllocation(SizeValueType bytes);
+
+  /** The running total of bytes counted by RecordAllocation(). Differences
+   * of this counter attribute allocations to a filter execution. */
+  static SizeValueType GetAllocatedBytes();
+
+  /** Append a record. Called by ProcessObject::UpdateOutputData(); not
+   * intended for application code. */
+  static void RecordFilterExecution(const FilterRecord & record);
+
+  /** Live and peak bulk buffer bytes attributed to one filter class. */
+  struct MemoryAccount
+  {
+    /** Bytes of buffers allocated by the filter and not yet released. */
+    SizeValueType LiveBytes{ 0 };
+
+    /** The highest value LiveBytes has reached. */
+    SizeValueType PeakBytes{ 0 };
+
+    /** Number of buffer allocations charged to the filter. */
+    SizeValueType AllocationCount{ 0 };
+  };
+
+  /** Charge a buffer to the filter currently updating on this thread.
+   * Called by ImportImageContainer; not intended for application code. */
+  static void RegisterAllocation(const void * buffer, SizeValueType bytes);
+
+  /** Release a buffer previously charged by RegisterAllocation(). Unknown
+   * buffers, e.g. allocated before profiling was enabled, are ignored. */
+  static void RegisterDeallocation(const void * buffer);
+
+  /** Return the accounts accumulated so far, keyed by filter class name.
+   * Buffers allocated outside any filter update appear under "(no filter)". */
+  static std::map< std::string, MemoryAccount > GetMemoryAccounts();
+
+  /** Bytes of tracked buffers currently alive across all filters, and the
+   * highest value that total has reached. */
+  static SizeValueType GetLiveBytes();
+
+  static SizeValueType GetPeakBytes();
+
+  /** Print the live and peak bytes per filter plus the process-wide
+   * high-water mark as a human readable table. */
+  static void MemoryReport(std::ostream & os = std::cout);
+
+  /** Maintain the per-thread stack of filters currently updating, used to
+   * attribute allocations. Called by ProcessObject::UpdateOutputData(); not
+   * intended for application code. */
+  static void PushCurrentFilter(const char * name);
+
+  static void PopCurrentFilter();
+
+private:
+  static std::atomic< bool >          m_Enabled;
+  static std::atomic< SizeValueType > m_AllocatedBytes;
+  static std::mutex                   m_Mutex;
+  static std::vector< FilterRecord >  m_Records;
+};
+} // end namespace itk
+
+#endif
@@ -0,0 +1,347 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkPlanarVectorImage_h
+#define itkPlanarVectorImage_h
+
+#include "itkImage.h"
+#include "itkImageRegion.h"
+#include "itkImportImageContainer.h"
+#include "itkPlanarVectorPixelAccessor.h"
+#include "itkDefaultVectorPixelAccessorFunctor.h"
+#include "itkPlanarVectorImageNeighborhoodAccessorFunctor.h"
+#include "itkWeakPointer.h"
+
+namespace itk
+{
+/** \class PlanarVectorImage
+ *  \brief Templated n-dimensional vector image class with planar storage.
+ *
+ * This class offers the same API as VectorImage but organizes the buffer
+ * as one contiguous plane per component instead of interleaving the
+ * components of each pixel:
+ *   ... P00 P10 P20 ... P01 P11 P21 ... P02 P12 P22 ...
+ * where Pic is component \e c of the pixel at offset \e i. Component
+ * \e c of pixel \e i is found at buffer element
+ * <tt>c * N + i</tt>, with \e N the number of buffered pixels.
+ *
+ * Per-component operations (channel-wise filtering, gradients of
+ * displacement fields) then run over unit-stride memory instead of
+ * striding by the vector length, and GetComponentImageView returns a
+ * scalar Image aliasing one plane without copying, replacing
+ * VectorIndexSelectionCastImageFilter round trips. The view shares
+ * ownership of the buffer.
+ *
+ * The pixel-wise API remains a VariableLengthVector< TPixel >, supported
+ * by the regular and neighborhood iterators. Note however that, unlike
+ * VectorImage, the vector returned by GetPixel (or by an iterator's
+ * Get()) owns a \e copy of the components, since the components of one
+ * pixel are not adjacent in memory; writes must go through SetPixel or
+ * the iterator's Set(). Pixel-wise access gathers and scatters the
+ * components and is therefore slower than on the interleaved layout;
+ * this class is intended for workloads dominated by per-component
+ * processing.
+ *
+ * Since the memory layouts differ, a PlanarVectorImage must not be
+ * aliased as a VectorImage or vice versa; conversion requires copying.
+ *
+ * \sa VectorImage
+ * \sa PlanarVectorPixelAccessor
+ * \sa PlanarVectorImageNeighborhoodAccessorFunctor
+ * \sa VectorIndexSelectionCastImageFilter
+ * \sa ImportImageContainer
+ *
+ * \ingroup ImageObjects
+ * \ingroup ITKCommon
+ */
+template< typename TPixel, unsigned int VImageDimension = 3 >
+class ITK_TEMPLATE_EXPORT PlanarVectorImage:
+  public ImageBase< VImageDimension >
+{
+public:
+  ITK_DISALLOW_COPY_AND_ASSIGN(PlanarVectorImage);
+
+  /** Standard class type aliases */
+  using Self = PlanarVectorImage;
+  using Superclass = ImageBase< VImageDimension >;
+  using Pointer = SmartPointer< Self >;
+  using ConstPointer = SmartPointer< const Self >;
+  using ConstWeakPointer = WeakPointer< const Self >;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(PlanarVectorImage, ImageBase);
+
+  /** Pixel type alias support Used to declare pixel type in filters
+   * or other operations. This is not the actual pixel type contained in
+   * the buffer, ie m_Buffer. The image exhibits an external API of an
+   * VariableLengthVector< T > and internally stores its data as type T. */
+  using PixelType = VariableLengthVector< TPixel >;
+
+  /** This is the actual pixel type contained in the buffer. The
+   * components of a vector pixel sit one plane stride apart. */
+  using InternalPixelType = TPixel;
+
+  /** Typedef alias for PixelType */
+  using ValueType = PixelType;
+
+  using IOPixelType = InternalPixelType;
+
+  /** Accessor type that convert data between internal and external
+   *  representations.  */
+  using AccessorType = PlanarVectorPixelAccessor< InternalPixelType >;
+
+  /** Functor to provide a common API between DefaultPixelAccessor and
+   * PlanarVectorPixelAccessor */
+  using AccessorFunctorType = DefaultVectorPixelAccessorFunctor< Self >;
+
+  /** Typedef for the functor used to access a neighborhood of pixel
+   * pointers. */
+  using NeighborhoodAccessorFunctorType = PlanarVectorImageNeighborhoodAccessorFunctor<Self>;
+
+  /** Dimension of the image.  This constant is used by functions that are
+   * templated over image type (as opposed to being templated over pixel type
+   * and dimension) when they need compile time access to the dimension of
+   * the image. */
+  static constexpr unsigned int ImageDimension = VImageDimension;
+
+  /** Index type alias support An index is used to access pixel values. */
+  using IndexType = typename Superclass::IndexType;
+  using IndexValueType = typename Superclass::IndexValueType;
+
+  /** Offset type alias support An offset is used to access pixel values. */
+  using OffsetType = typename Superclass::OffsetType;
+
+  /** Size type alias support A size is used to define region bounds. */
+  using SizeType = typename Superclass::SizeType;
+
+  /** Container used to store pixels in the image. */
+  using PixelContainer = ImportImageContainer< SizeValueType, InternalPixelType >;
+
+  /** Direction type alias support A matrix of direction cosines. */
+  using DirectionType = typename Superclass::DirectionType;
+
+  /** Region type alias support A region is used to specify a subset of an image.
+    */
+  using RegionType = typename Superclass::RegionType;
+
+  /** Spacing type alias support  Spacing holds the size of a pixel.  The
+   * spacing is the geometric distance between image samples. */
+  using SpacingType = typename Superclass::SpacingType;
+
+  /** Origin type alias support  The origin is the geometric coordinates
+   * of the index (0,0). */
+  using PointType = typename Superclass::PointType;
+
+  /** A pointer to the pixel container. */
+  using PixelContainerPointer = typename PixelContainer::Pointer;
+  using PixelContainerConstPointer = typename PixelContainer::ConstPointer;
+
+  /** Offset type alias (relative position between indices) */
+  using OffsetValueType = typename Superclass::OffsetValueType;
+
+  using VectorLengthType = unsigned int;
+
+  /** Scalar image type aliasing a single component plane. */
+  using ComponentImageType = Image< TPixel, VImageDimension >;
+  using ComponentImagePointer = typename ComponentImageType::Pointer;
+
+  /**
+   * \brief A structure which enable changing any image class' pixel
+   * type to another.
+   *
+   * \sa Image::Rebind
+   * \deprecated Use template alias RebindImageType instead
+   */
+  template <typename UPixelType, unsigned int NUImageDimension = VImageDimension>
+  struct Rebind
+  {
+    using Type = itk::PlanarVectorImage<UPixelType, NUImageDimension>;
+  };
+
+  /// \cond HIDE_SPECIALIZATION_DOCUMENTATION
+  template <typename UElementType, unsigned int NUImageDimension>
+  struct Rebind< VariableLengthVector< UElementType >, NUImageDimension>
+  {
+    using Type = itk::PlanarVectorImage<UElementType, NUImageDimension>;
+  };
+  /// \endcond
+
+  template <typename UPixelType, unsigned int NUImageDimension = VImageDimension>
+    using RebindImageType = typename Rebind<UPixelType, NUImageDimension>::Type;
+
+  /** Allocate the image memory. The size of the image must
+   * already be set, e.g. by calling SetRegions(). */
+  void Allocate(bool UseDefaultConstructor = false) override;
+
+  /** Restore the data object to its initial state. This means releasing
+   * memory. */
+  void Initialize() override;
+
+  /** Fill the image buffer with a value.  Be sure to call Allocate()
+   * first. */
+  void FillBuffer(const PixelType & value);
+
+  /** \brief Set a pixel value, scattering the components into the planes.
+   *
+   * Allocate() needs to have been called first -- for efficiency,
+   * this function does not check that the image has actually been
+   * allocated yet. */
+  void SetPixel(const IndexType & index, const PixelType & value)
+  {
+    const OffsetValueType offset = this->FastComputeOffset(index);
+    const OffsetValueType stride = this->GetPlaneStride();
+
+    for ( VectorLengthType i = 0; i < m_VectorLength; i++ )
+      {
+      ( *m_Buffer )[static_cast< OffsetValueType >( i ) * stride + offset] = value[i];
+      }
+  }
+
+  /** \brief Get a pixel (read only version).
+   *
+   * For efficiency, this function does not check that the
+   * image has actually been allocated yet. Note that, the components
+   * being one plane stride apart, the returned vector holds a copy of
+   * them; modifying it does not modify the image. */
+  const PixelType GetPixel(const IndexType & index) const
+  {
+    const OffsetValueType offset = this->FastComputeOffset(index);
+    const OffsetValueType stride = this->GetPlaneStride();
+
+    PixelType v( m_VectorLength );
+    for ( VectorLengthType i = 0; i < m_VectorLength; i++ )
+      {
+      v[i] = ( *m_Buffer )[static_cast< OffsetValueType >( i ) * stride + offset];
+      }
+    return v;
+  }
+
+  /** \brief Get a copy of a pixel. Unlike VectorImage, the result never
+   * references the buffer; use SetPixel to modify the image.
+   *
+   * For efficiency, this function does not check that the
+   * image has actually been allocated yet. */
+  PixelType GetPixel(const IndexType & index)
+  {
+    return const_cast< const Self * >( this )->GetPixel(index);
+  }
+
+  /** \brief Access a pixel. The result is a copy of the components and
+   * cannot be used as an lvalue. */
+  PixelType operator[](const IndexType & index) { return this->GetPixel(index); }
+
+  /** \brief Access a pixel.
+   *
+   * For efficiency, this function does not check that the
+   * image has actually been allocated yet. */
+  const PixelType operator[](const IndexType & index) const { return this->GetPixel(index); }
+
+  /** Return a pointer to the beginning of the buffer.  This is used by
+   * the image iterator class. */
+  InternalPixelType * GetBufferPointer()
+  {
+    return m_Buffer ? m_Buffer->GetBufferPointer() : nullptr;
+  }
+  const InternalPixelType * GetBufferPointer() const
+  {
+    return m_Buffer ? m_Buffer->GetBufferPointer() : nullptr;
+  }
+
+  /** Return a pointer to the container. */
+  PixelContainer * GetPixelContainer() { return m_Buffer.GetPointer(); }
+
+  /** Return a pointer to the container. */
+  const PixelContainer * GetPixelContainer() const { return m_Buffer.GetPointer(); }
+
+  /** Set the container to use. Note that this does not cause the
+   * DataObject to be modified. */
+  void SetPixelContainer(PixelContainer *container);
+
+  /** Graft the data and information from one image to another. This
+   * is a convenience method to setup a second image with all the meta
+   * information of another image and use the same pixel
+   * container. */
+  virtual void Graft(const Self *data);
+
+  /** The number of buffer elements between the start of two consecutive
+   * component planes. This is the number of buffered pixels. */
+  OffsetValueType GetPlaneStride() const
+  {
+    return this->GetOffsetTable()[VImageDimension];
+  }
+
+  /** Return a scalar image aliasing the plane of the given component.
+   * No pixel data is copied: the view's pixel container points into
+   * this image's buffer and shares ownership of it, so writes through
+   * the view are visible here and the plane outlives a released
+   * image. The view covers the buffered region. Allocate() must have
+   * been called. */
+  ComponentImagePointer GetComponentImageView(VectorLengthType component);
+
+  /** Return the Pixel Accessor object */
+  AccessorType GetPixelAccessor()
+  { return AccessorType( m_VectorLength, this->GetPlaneStride() ); }
+
+  /** Return the Pixel Accesor object */
+  const AccessorType GetPixelAccessor() const
+  { return AccessorType( m_VectorLength, this->GetPlaneStride() ); }
+
+  /** Return the NeighborhoodAccessor functor */
+  NeighborhoodAccessorFunctorType GetNeighborhoodAccessor()
+  {
+    return NeighborhoodAccessorFunctorType( m_VectorLength, this->GetPlaneStride() );
+  }
+
+  /** Return the NeighborhoodAccessor functor */
+  const NeighborhoodAccessorFunctorType GetNeighborhoodAccessor() const
+  {
+    return NeighborhoodAccessorFunctorType( m_VectorLength, this->GetPlaneStride() );
+  }
+
+  /** Set/Get macros for the length of each vector in the vector image */
+  itkSetMacro(VectorLength, VectorLengthType);
+  itkGetConstReferenceMacro(VectorLength, VectorLengthType);
+
+  /** Get/Set the number of components each pixel has, ie the VectorLength */
+  unsigned int GetNumberOfComponentsPerPixel() const override;
+
+  void SetNumberOfComponentsPerPixel(unsigned int n) override;
+
+protected:
+  PlanarVectorImage();
+  void PrintSelf(std::ostream & os, Indent indent) const override;
+
+  ~PlanarVectorImage() override = default;
+  void Graft(const DataObject *data) override;
+  using Superclass::Graft;
+private:
+  /** Length of the "vector pixel" */
+  VectorLengthType m_VectorLength{0};
+
+  /** Memory for the current buffer. */
+  PixelContainerPointer m_Buffer;
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#include "itkPlanarVectorImage.hxx"
+#endif
+
+#endif
@@ -0,0 +1,226 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkPlanarVectorImage_hxx
+#define itkPlanarVectorImage_hxx
+#include "itkPlanarVectorImage.h"
+#include "itkProcessObject.h"
+
+namespace itk
+{
+/**
+ *
+ */
+template< typename TPixel, unsigned int VImageDimension >
+PlanarVectorImage< TPixel, VImageDimension >
+::PlanarVectorImage()
+
+{
+  m_Buffer = PixelContainer::New();
+}
+
+//----------------------------------------------------------------------------
+template< typename TPixel, unsigned int VImageDimension >
+void
+PlanarVectorImage< TPixel, VImageDimension >
+::Allocate(const bool UseDefaultConstructor)
+{
+  if ( m_VectorLength == 0 )
+    {
+    itkExceptionMacro(<< "Cannot allocate PlanarVectorImage with VectorLength = 0");
+    }
+
+  SizeValueType num;
+  this->ComputeOffsetTable();
+  num = this->GetOffsetTable()[VImageDimension];
+
+  m_Buffer->Reserve(num * m_VectorLength,UseDefaultConstructor);
+}
+
+template< typename TPixel, unsigned int VImageDimension >
+void
+PlanarVectorImage< TPixel, VImageDimension >
+::Initialize()
+{
+  //
+  // We don't modify ourselves because the "ReleaseData" methods depend upon
+  // no modification when initialized.
+  //
+
+  // Call the superclass which should initialize the BufferedRegion ivar.
+  Superclass::Initialize();
+
+  // Replace the handle to the buffer. This is the safest thing to do,
+  // since the same container can be shared by multiple images (e.g.
+  // Grafted outputs and in place filters).
+  m_Buffer = PixelContainer::New();
+}
+
+template< typename TPixel, unsigned int VImageDimension >
+void
+PlanarVectorImage< TPixel, VImageDimension >
+::FillBuffer(const PixelType & value)
+{
+  const SizeValueType numberOfPixels =
+    this->GetBufferedRegion().GetNumberOfPixels();
+
+  // fill plane by plane, each with its component of the value
+  SizeValueType ctr = 0;
+
+  for ( VectorLengthType j = 0; j < m_VectorLength; j++ )
+    {
+    for ( SizeValueType i = 0; i < numberOfPixels; i++ )
+      {
+      ( *m_Buffer )[ctr++] = value[j];
+      }
+    }
+}
+
+template< typename TPixel, unsigned int VImageDimension >
+void
+PlanarVectorImage< TPixel, VImageDimension >
+::SetPixelContainer(PixelContainer *container)
+{
+  if ( m_Buffer != container )
+    {
+    m_Buffer = container;
+    this->Modified();
+    }
+}
+
+//----------------------------------------------------------------------------
+template< typename TPixel, unsigned int VImageDimension >
+typename PlanarVectorImage< TPixel, VImageDimension >::ComponentImagePointer
+PlanarVectorImage< TPixel, VImageDimension >
+::GetComponentImageView(VectorLengthType component)
+{
+  if ( component >= m_VectorLength )
+    {
+    itkExceptionMacro(<< "Requested component " << component
+                      << " of an image with VectorLength " << m_VectorLength);
+    }
+
+  const SizeValueType numberOfPixels =
+    this->GetBufferedRegion().GetNumberOfPixels();
+
+  if ( this->GetBufferPointer() == nullptr
+       || m_Buffer->Size() < ( component + 1 ) * numberOfPixels )
+    {
+    itkExceptionMacro(<< "The image buffer must be allocated before "
+                      << "requesting a component view.");
+    }
+
+  ComponentImagePointer view = ComponentImageType::New();
+
+  // The view covers the buffered plane; spacing, origin and direction
+  // carry over unchanged.
+  view->CopyInformation(this);
+  view->SetRequestedRegion( this->GetRequestedRegion() );
+  view->SetBufferedRegion( this->GetBufferedRegion() );
+
+  using ComponentContainerType = typename ComponentImageType::PixelContainer;
+  typename ComponentContainerType::Pointer container = ComponentContainerType::New();
+  container->SetImportPointer(
+    this->GetBufferPointer() + static_cast< SizeValueType >( component ) * numberOfPixels,
+    numberOfPixels, false );
+  // the plane stays valid as long as the view is alive
+  container->SetBufferOwner( m_Buffer );
+  view->SetPixelContainer(container);
+
+  return view;
+}
+
+//----------------------------------------------------------------------------
+template< typename TPixel, unsigned int VImageDimension >
+void
+PlanarVectorImage< TPixel, VImageDimension >
+::Graft(const Self *image)
+{
+  if(image == nullptr)
+    {
+    return;
+    }
+  // call the superclass' implementation
+  Superclass::Graft(image);
+
+  // Now copy anything remaining that is needed
+  this->SetPixelContainer( const_cast< PixelContainer * >
+                           ( image->GetPixelContainer() ) );
+}
+
+//----------------------------------------------------------------------------
+template< typename TPixel, unsigned int VImageDimension >
+void
+PlanarVectorImage< TPixel, VImageDimension >
+::Graft(const DataObject *data)
+{
+  if(data == nullptr)
+    {
+    return;
+    }
+  // Attempt to cast data to a PlanarVectorImage
+  const auto * imgData = dynamic_cast< const Self * >( data );
+
+  if( imgData == nullptr )
+    {
+    // pointer could not be cast back down
+    itkExceptionMacro( << "itk::PlanarVectorImage::Graft() cannot cast "
+                       << typeid( data ).name() << " to "
+                       << typeid( const Self * ).name() );
+    }
+  // Now copy anything remaining that is needed
+  this->Graft(imgData);
+}
+
+//----------------------------------------------------------------------------
+template< typename TPixel, unsigned int VImageDimension >
+unsigned int
+PlanarVectorImage< TPixel, VImageDimension >
+::GetNumberOfComponentsPerPixel() const
+{
+  return this->m_VectorLength;
+}
+
+//----------------------------------------------------------------------------
+template< typename TPixel, unsigned int VImageDimension >
+void
+PlanarVectorImage< TPixel, VImageDimension >
+::SetNumberOfComponentsPerPixel(unsigned int n)
+{
+  this->SetVectorLength( static_cast< VectorLengthType >( n ) );
+}
+
+/**
+ *
+ */
+template< typename TPixel, unsigned int VImageDimension >
+void
+PlanarVectorImage< TPixel, VImageDimension >
+::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  os << indent << "VectorLength: " << m_VectorLength << std::endl;
+  os << indent << "PlaneStride: " << this->GetPlaneStride() << std::endl;
+  os << indent << "PixelContainer: " << std::endl;
+  m_Buffer->Print( os, indent.GetNextIndent() );
+
+  // m_Origin and m_Spacing are printed in the Superclass
+}
+} // end namespace itk
+
+#endif
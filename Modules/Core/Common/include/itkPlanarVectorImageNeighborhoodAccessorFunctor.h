@@ -0,0 +1,139 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkPlanarVectorImageNeighborhoodAccessorFunctor_h
+#define itkPlanarVectorImageNeighborhoodAccessorFunctor_h
+
+#include "itkVariableLengthVector.h"
+#include "itkImageBoundaryCondition.h"
+#include "itkImageBase.h"
+
+namespace itk
+{
+/** \class PlanarVectorImageNeighborhoodAccessorFunctor
+ * \brief Provides accessor interfaces to access pixels through pointers
+ * held by the Neighborhood class, for images with planar component
+ * storage.
+ *
+ * This is the PlanarVectorImage counterpart of
+ * VectorImageNeighborhoodAccessorFunctor. The pixel pointers managed by
+ * the neighborhood address the first plane; the remaining components of
+ * a pixel are found one plane stride apart, so Get gathers them into a
+ * VariableLengthVector that owns its data and Set scatters them back.
+ *
+ * A typical user should not need to use this class; it is internally
+ * used by the neighborhood iterators.
+ *
+ * \sa VectorImageNeighborhoodAccessorFunctor
+ * \sa PlanarVectorImage
+ * \ingroup ITKCommon
+ */
+template< typename TImage >
+class PlanarVectorImageNeighborhoodAccessorFunctor
+{
+public:
+  using ImageType = TImage;
+  using PixelType = typename ImageType::PixelType;
+  using InternalPixelType = typename ImageType::InternalPixelType;
+  using VectorLengthType = unsigned int;
+  using OffsetType = typename ImageType::OffsetType;
+
+  using NeighborhoodType = Neighborhood< InternalPixelType *,
+                         TImage ::ImageDimension >;
+
+  template<typename TOutput=ImageType>
+  using ImageBoundaryConditionType = ImageBoundaryCondition<ImageType, TOutput>;
+
+  PlanarVectorImageNeighborhoodAccessorFunctor(VectorLengthType length, SizeValueType stride):
+    m_VectorLength(length), m_PlaneStride(stride), m_Begin(nullptr) {}
+  PlanarVectorImageNeighborhoodAccessorFunctor():
+     m_Begin(nullptr) {}
+
+  /** Set the pointer index to the start of the buffer.
+   * This must be set by the iterators to the starting location of the buffer. */
+  inline void SetBegin(const InternalPixelType *begin)
+  { this->m_Begin = const_cast< InternalPixelType * >( begin ); }
+
+  /** Method to dereference a pixel pointer. This is used from the
+   * ConstNeighborhoodIterator as the equivalent operation to (*it).
+   * The components of the pixel are gathered from the per-component
+   * planes into a PixelType created on the stack. */
+  inline PixelType Get(const InternalPixelType *pixelPointer) const
+  {
+    const SizeValueType offset = static_cast< SizeValueType >( pixelPointer - m_Begin );
+
+    PixelType v( m_VectorLength );
+    for ( VectorLengthType i = 0; i < m_VectorLength; i++ )
+      {
+      v[i] = m_Begin[i * m_PlaneStride + offset];
+      }
+    return v;
+  }
+
+  /** Method to set the pixel value at a certain pixel pointer */
+  inline void Set(InternalPixelType * const pixelPointer, const PixelType & p) const
+  {
+    const SizeValueType offset = static_cast< SizeValueType >( pixelPointer - m_Begin );
+
+    for ( VectorLengthType i = 0; i < m_VectorLength; i++ )
+      {
+      m_Begin[i * m_PlaneStride + offset] = p[i];
+      }
+  }
+
+  template <typename TOutput>
+  inline typename ImageBoundaryConditionType<TOutput>::OutputPixelType
+  BoundaryCondition(
+    const OffsetType & point_index,
+    const OffsetType & boundary_offset,
+    const NeighborhoodType *data,
+    const ImageBoundaryConditionType<TOutput> * boundaryCondition) const
+  {
+    return boundaryCondition->operator()(point_index, boundary_offset, data, *this);
+  }
+
+  /** Methods to Set/Get vector length. This should be the number of
+   * components of a pixel in the image. */
+  void SetVectorLength(VectorLengthType length)
+  {
+    m_VectorLength = length;
+  }
+
+  VectorLengthType GetVectorLength()
+  {
+    return m_VectorLength;
+  }
+
+  /** Set/Get the number of buffer elements between the start of two
+   * consecutive planes. This is the number of buffered pixels. */
+  void SetPlaneStride(SizeValueType stride)
+  {
+    m_PlaneStride = stride;
+  }
+
+  SizeValueType GetPlaneStride() const
+  {
+    return m_PlaneStride;
+  }
+
+private:
+  VectorLengthType   m_VectorLength{0};
+  SizeValueType      m_PlaneStride{0};
+  InternalPixelType *m_Begin;          // Begin of the buffer.
+};
+} // end namespace itk
+#endif
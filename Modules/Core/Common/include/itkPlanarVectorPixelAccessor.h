@@ -0,0 +1,129 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkPlanarVectorPixelAccessor_h
+#define itkPlanarVectorPixelAccessor_h
+
+#include "itkMacro.h"
+#include "itkVariableLengthVector.h"
+#include "itkIntTypes.h"
+
+namespace itk
+{
+/** \class PlanarVectorPixelAccessor
+ * \brief Pixel accessor for images storing their components in planes.
+ *
+ * PlanarVectorPixelAccessor provides PlanarVectorImage with the same
+ * interface that DefaultVectorPixelAccessor provides to VectorImage. The
+ * difference is the memory layout it translates: component \e c of the
+ * pixel at offset \e i lives at buffer element <tt>c * PlaneStride + i</tt>
+ * rather than at <tt>i * VectorLength + c</tt>, so the components of one
+ * pixel are gathered from (and scattered to) the per-component planes.
+ *
+ * Because the components of a pixel are not contiguous in memory, Get
+ * returns a VariableLengthVector that owns a copy of the components
+ * instead of referencing the buffer. Writes must therefore go through
+ * Set.
+ *
+ * Both the vector length and the plane stride (the number of buffered
+ * pixels) must be set before the accessor can be used.
+ *
+ * \sa DefaultVectorPixelAccessor
+ * \sa PlanarVectorImage
+ *
+ * \ingroup ImageAdaptors
+ * \ingroup ITKCommon
+ */
+template< typename TType >
+class ITK_TEMPLATE_EXPORT PlanarVectorPixelAccessor
+{
+public:
+
+  using VectorLengthType = unsigned int;
+
+  /** External type alias. It defines the external aspect
+   * that this class will exhibit. Unlike the interleaved accessor, the
+   * returned vector owns its data: it holds a copy of the components
+   * gathered from the planes. */
+  using ExternalType = VariableLengthVector< TType >;
+
+  /** Internal type alias. It defines the internal real representation of data. */
+  using InternalType = TType;
+
+  /** Set output using the value in input. \c output is the element of the
+   * first plane belonging to the pixel at \c offset. */
+  inline void Set(InternalType & output, const ExternalType & input,
+                  const unsigned long offset) const
+  {
+    InternalType *begin = ( &output ) - offset;
+
+    for ( VectorLengthType i = 0; i < m_VectorLength; i++ )
+      {
+      begin[i * m_PlaneStride + offset] = input[i];
+      }
+  }
+
+  /** Gather the components of the pixel at \c offset from the planes. */
+  inline ExternalType Get(const InternalType & input, const SizeValueType offset) const
+  {
+    const InternalType *begin = ( &input ) - offset;
+
+    ExternalType v( m_VectorLength );
+    for ( VectorLengthType i = 0; i < m_VectorLength; i++ )
+      {
+      v[i] = begin[i * m_PlaneStride + offset];
+      }
+    return v;
+  }
+
+  /** Set the length of each vector in the image */
+  void SetVectorLength(VectorLengthType l)
+  {
+    m_VectorLength = l;
+  }
+
+  /** Get Vector lengths */
+  VectorLengthType GetVectorLength() const { return m_VectorLength; }
+
+  /** Set/Get the number of buffer elements between the start of two
+   * consecutive planes. This is the number of buffered pixels. */
+  void SetPlaneStride(SizeValueType s)
+  {
+    m_PlaneStride = s;
+  }
+
+  SizeValueType GetPlaneStride() const { return m_PlaneStride; }
+
+  PlanarVectorPixelAccessor() {}
+
+  /** Constructor to initialize the vector length and the plane stride at
+   * construction time */
+  PlanarVectorPixelAccessor(VectorLengthType l, SizeValueType s)
+  {
+    m_VectorLength = l;
+    m_PlaneStride = s;
+  }
+
+  ~PlanarVectorPixelAccessor() = default;
+
+private:
+  VectorLengthType m_VectorLength{0};
+  SizeValueType    m_PlaneStride{0};
+};
+} // end namespace itk
+
+#endif
@@ -0,0 +1,130 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkPoolImageAllocator_h
+#define itkPoolImageAllocator_h
+
+#include "itkImageAllocatorBase.h"
+#include "itkNumericTraits.h"
+
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace itk
+{
+/** \class PoolImageAllocator
+ * \brief Image buffer allocator that recycles large blocks.
+ *
+ * Freed blocks above the pooling threshold are kept in per-size free
+ * lists and handed back to subsequent allocations of the same size.
+ * Pipelines that repeatedly allocate and release volumes of identical
+ * geometry thus avoid both allocator churn and the page faults of
+ * re-touching fresh memory. Blocks below the threshold, and requests
+ * that miss the free lists, fall through to ::operator new.
+ *
+ * By default only blocks of the exact requested size are reused.
+ * Setting ReuseSlackFactor above 1 also serves a request from the
+ * smallest cached block that is large enough, as long as it is no
+ * larger than the request times the factor. Chains whose stages use
+ * different pixel sizes (e.g. float and short volumes of the same
+ * geometry) can then share one set of blocks instead of keeping a
+ * separate free list per size, at the cost of the unused slack.
+ *
+ * On Linux, blocks large enough to span huge pages are advised to the
+ * kernel with MADV_HUGEPAGE, reducing TLB misses when iterating over
+ * large volumes.
+ *
+ * The total amount of cached memory is capped by MaximumPoolSize;
+ * ReleaseCachedMemory returns all cached blocks to the system.
+ * Install with ImageAllocatorBase::SetGlobalDefaultAllocator.
+ *
+ * \sa ImageAllocatorBase
+ *
+ * \ingroup ImageObjects
+ * \ingroup ITKSystemObjects
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT PoolImageAllocator : public ImageAllocatorBase
+{
+public:
+  ITK_DISALLOW_COPY_AND_ASSIGN(PoolImageAllocator);
+
+  /** Standard class type aliases. */
+  using Self = PoolImageAllocator;
+  using Superclass = ImageAllocatorBase;
+  using Pointer = SmartPointer< Self >;
+  using ConstPointer = SmartPointer< const Self >;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(PoolImageAllocator, ImageAllocatorBase);
+
+  /** Reuse a cached block of matching size if available, otherwise
+   * allocate a new one. */
+  void * Allocate(SizeValueType numberOfBytes) override;
+
+  /** Cache the block for reuse if it is above the pooling threshold and
+   * the pool cap permits, otherwise return it to the system. */
+  void Deallocate(void * buffer, SizeValueType numberOfBytes) override;
+
+  /** Set/Get the smallest block size in bytes that is pooled. Smaller
+   * blocks go directly to the system allocator. Default is 1 MiB. */
+  itkSetMacro(PoolingThreshold, SizeValueType);
+  itkGetConstMacro(PoolingThreshold, SizeValueType);
+
+  /** Set/Get the cap on the total bytes held in the free lists.
+   * Default is 4 GiB. */
+  itkSetMacro(MaximumPoolSize, SizeValueType);
+  itkGetConstMacro(MaximumPoolSize, SizeValueType);
+
+  /** Set/Get the factor by which a cached block may exceed the
+   * requested size and still be reused. Must be at least 1; the
+   * default of 1 reuses only blocks of the exact requested size. */
+  itkSetClampMacro(ReuseSlackFactor, double, 1.0, NumericTraits< double >::max());
+  itkGetConstMacro(ReuseSlackFactor, double);
+
+  /** The total bytes currently held in the free lists. */
+  SizeValueType GetCachedMemorySize() const;
+
+  /** Return all cached blocks to the system. */
+  void ReleaseCachedMemory();
+
+protected:
+  PoolImageAllocator();
+  ~PoolImageAllocator() override;
+  void PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  using FreeListType = std::map< SizeValueType, std::vector< void * > >;
+
+  mutable std::mutex m_Mutex;
+  FreeListType       m_FreeLists;
+  SizeValueType      m_PoolingThreshold;
+  SizeValueType      m_MaximumPoolSize;
+  SizeValueType      m_CachedMemorySize;
+  double             m_ReuseSlackFactor;
+
+  /** Actual sizes of pooled blocks handed out with slack, keyed by
+   * address, so they are re-pooled and accounted under their real size. */
+  std::map< void *, SizeValueType > m_BlockSizes;
+};
+} // end namespace itk
+
+#endif
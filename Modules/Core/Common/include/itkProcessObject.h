@@ -37,6 +37,8 @@
 #include <map>
 #include <set>
 #include <algorithm>
+#include <atomic>
+#include <mutex>
 
 namespace itk
 {
@@ -318,6 +320,23 @@ public:
     */
   void UpdateProgress(float progress);
 
+  /** \brief Add to the progress of the process object, concurrent thread safe.
+   *
+   * The increment is accumulated into an atomic counter, so many threads
+   * may report progress concurrently without locking. The ProgressEvent
+   * is only invoked when the coalesced progress crosses a multiple of
+   * ProgressEventGranularity, and never from more than one thread at a
+   * time; threads that lose the race simply defer publication to a later
+   * crossing. The parameter amount should be in [0,1] and is the
+   * incremental (not cumulative) progress. */
+  void IncrementProgress(float increment);
+
+  /** Set/Get the minimum progress change that triggers a ProgressEvent
+   * from IncrementProgress. The value is in [0,1]; the default of 0.01
+   * results in at most 100 events per filter execution. */
+  itkSetClampMacro(ProgressEventGranularity, float, 0.0001f, 1.0f);
+  itkGetConstMacro(ProgressEventGranularity, float);
+
   /** \brief Bring this filter up-to-date.
    *
    * Update() checks modified times against
@@ -439,6 +458,35 @@ public:
   itkGetConstReferenceMacro(ReleaseDataBeforeUpdateFlag, bool);
   itkBooleanMacro(ReleaseDataBeforeUpdateFlag);
 
+  /** Turn on/off concurrent updates of independent input branches. When
+   * enabled and the upstream subgraphs producing the inputs of this
+   * process object are pairwise disjoint, UpdateOutputData runs the
+   * branch updates as concurrent tasks instead of updating the inputs
+   * serially, so e.g. the fixed- and moving-image preprocessing arms
+   * feeding a registration can execute at the same time. Branches that
+   * share upstream objects are updated serially as before. Note that
+   * progress and other events of the upstream filters may be invoked
+   * concurrently while the branches execute. Default value is off. */
+  itkSetMacro(ConcurrentBranchUpdate, bool);
+  itkGetConstReferenceMacro(ConcurrentBranchUpdate, bool);
+  itkBooleanMacro(ConcurrentBranchUpdate);
+
+  /** Turn on/off short-circuiting of repeated UpdateOutputInformation
+   * traversals. When enabled, UpdateOutputInformation returns
+   * immediately if neither this filter nor its direct inputs have been
+   * modified since the output information was last generated, instead
+   * of re-propagating the call up the pipeline. This makes re-updates
+   * that only change the requested region (e.g. scrolling through
+   * slices in a viewer) nearly free on long pipelines. Only the MTimes
+   * visible at this filter are examined, so a modification further
+   * upstream is not detected by a filter that short-circuits; after
+   * changing a parameter of an upstream filter, call Modified() on the
+   * downstream filters carrying this flag (or turn the flag off) so one
+   * full traversal refreshes the cached information. Default is off. */
+  itkSetMacro(CacheOutputInformation, bool);
+  itkGetConstReferenceMacro(CacheOutputInformation, bool);
+  itkBooleanMacro(CacheOutputInformation);
+
   /** Get/Set the number of work units to create when executing. */
   itkSetClampMacro(NumberOfWorkUnits, ThreadIdType, 1, ITK_MAX_THREADS);
   itkGetConstReferenceMacro(NumberOfWorkUnits, ThreadIdType);
@@ -764,6 +812,12 @@ protected:
    */
   virtual void RestoreInputReleaseDataFlags();
 
+  /** Determine whether the upstream subgraphs producing the inputs of
+   * this process object are pairwise disjoint, i.e. whether the input
+   * branches can be updated concurrently without visiting any process
+   * object from more than one task. */
+  bool InputBranchesAreIndependent();
+
   /** These ivars are made protected so filters like itkStreamingImageFilter
    * can access them directly. */
 
@@ -805,6 +859,13 @@ private:
   bool  m_AbortGenerateData;
   float m_Progress;
 
+  /** Progress accumulated by IncrementProgress, in fixed point with
+   * 2^24 representing complete (1.0) progress, and the machinery to
+   * publish it from at most one thread at a time. */
+  std::atomic< uint32_t > m_IncrementalProgressFixedPoint;
+  std::mutex              m_ProgressPublicationMutex;
+  float                   m_ProgressEventGranularity;
+
   /** Support processing data in multiple threads. Used by subclasses
    * (e.g., ImageSource). */
   MultiThreaderType::Pointer m_MultiThreader;
@@ -813,6 +874,12 @@ private:
   /** Memory management ivars */
   bool m_ReleaseDataBeforeUpdateFlag;
 
+  /** Flag controlling concurrent updates of independent input branches */
+  bool m_ConcurrentBranchUpdate;
+
+  /** Flag controlling short-circuiting of repeated information updates */
+  bool m_CacheOutputInformation;
+
   /** Friends of ProcessObject */
   friend class DataObject;
 
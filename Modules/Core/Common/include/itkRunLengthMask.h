@@ -0,0 +1,229 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkRunLengthMask_h
+#define itkRunLengthMask_h
+
+#include "itkLightObject.h"
+#include "itkObjectFactory.h"
+#include "itkImageRegion.h"
+#include "itkImageScanlineConstIterator.h"
+#include "itkMultiThreaderBase.h"
+
+#include <vector>
+
+namespace itk
+{
+/** \class RunLengthMask
+ * \brief Run-length representation of a binary mask for masked execution.
+ *
+ * RunLengthMask stores the nonzero pixels of a mask image as runs of
+ * consecutive pixels along the fastest varying axis. Filters that
+ * support masked execution accept such a mask and schedule their work
+ * over the runs only, writing a constant to the pixels outside, so the
+ * excluded background costs a fill instead of the full per-pixel
+ * computation.
+ *
+ * The mask is built once with SetMaskImage(), typically from the same
+ * binary image handed to MaskImageFilter, from an image rasterized
+ * from an ImageMaskSpatialObject, or from a LabelMap converted with
+ * LabelMapToBinaryImageFilter. A built mask is immutable and can be
+ * shared by any number of filters and threads.
+ *
+ * \sa MaskImageFilter
+ * \sa ImageMaskSpatialObject
+ * \ingroup ITKCommon
+ */
+template< unsigned int VImageDimension = 2 >
+class ITK_TEMPLATE_EXPORT RunLengthMask : public LightObject
+{
+public:
+  ITK_DISALLOW_COPY_AND_ASSIGN(RunLengthMask);
+
+  /** Standard class type aliases. */
+  using Self = RunLengthMask;
+  using Superclass = LightObject;
+  using Pointer = SmartPointer< Self >;
+  using ConstPointer = SmartPointer< const Self >;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(RunLengthMask, LightObject);
+
+  /** Dimension of the indexed space. */
+  static constexpr unsigned int ImageDimension = VImageDimension;
+
+  /** Index and region type aliases. */
+  using IndexType = Index< VImageDimension >;
+  using RegionType = ImageRegion< VImageDimension >;
+
+  /** One run of consecutive inside pixels along the fastest axis. */
+  struct RunType
+  {
+    IndexType Location;
+    SizeValueType Length;
+  };
+
+  using RunContainerType = std::vector< RunType >;
+
+  /** Collect the runs of nonzero pixels of the mask image over its
+   * buffered region. Replaces any previously collected runs. */
+  template< typename TMaskImage >
+  void SetMaskImage(const TMaskImage *maskImage)
+  {
+    using MaskPixelType = typename TMaskImage::PixelType;
+
+    const MaskPixelType zero = NumericTraits< MaskPixelType >::ZeroValue();
+
+    m_Runs.clear();
+    m_NumberOfInsidePixels = 0;
+    m_Region = maskImage->GetBufferedRegion();
+
+    ImageScanlineConstIterator< TMaskImage > it( maskImage, m_Region );
+
+    while ( !it.IsAtEnd() )
+      {
+      IndexType index = it.GetIndex();
+
+      RunType run;
+      run.Length = 0;
+
+      while ( !it.IsAtEndOfLine() )
+        {
+        if ( it.Get() != zero )
+          {
+          if ( run.Length == 0 )
+            {
+            run.Location = index;
+            }
+          ++run.Length;
+          }
+        else if ( run.Length > 0 )
+          {
+          m_NumberOfInsidePixels += run.Length;
+          m_Runs.push_back(run);
+          run.Length = 0;
+          }
+        ++index[0];
+        ++it;
+        }
+      if ( run.Length > 0 )
+        {
+        m_NumberOfInsidePixels += run.Length;
+        m_Runs.push_back(run);
+        }
+      it.NextLine();
+      }
+  }
+
+  /** Access the collected runs. */
+  const RunContainerType & GetRuns() const
+  {
+    return m_Runs;
+  }
+
+  /** The region the runs were collected over. */
+  const RegionType & GetRegion() const
+  {
+    return m_Region;
+  }
+
+  /** Total number of pixels covered by the runs. */
+  SizeValueType GetNumberOfInsidePixels() const
+  {
+    return m_NumberOfInsidePixels;
+  }
+
+  /** Clip a run to a region. On return location holds the first index
+   * of the clipped run; the returned length is zero when the run does
+   * not intersect the region. */
+  static SizeValueType ClipRunToRegion(const RegionType & region,
+                                       IndexType & location,
+                                       SizeValueType length)
+  {
+    for ( unsigned int j = 1; j < VImageDimension; j++ )
+      {
+      const IndexValueType first = region.GetIndex(j);
+      const IndexValueType last = first + static_cast< IndexValueType >( region.GetSize(j) ) - 1;
+      if ( location[j] < first || location[j] > last )
+        {
+        return 0;
+        }
+      }
+
+    const IndexValueType first = region.GetIndex(0);
+    const IndexValueType last = first + static_cast< IndexValueType >( region.GetSize(0) ) - 1;
+
+    IndexValueType runFirst = location[0];
+    IndexValueType runLast = runFirst + static_cast< IndexValueType >( length ) - 1;
+
+    if ( runFirst < first )
+      {
+      runFirst = first;
+      }
+    if ( runLast > last )
+      {
+      runLast = last;
+      }
+    if ( runLast < runFirst )
+      {
+      return 0;
+      }
+
+    location[0] = runFirst;
+    return static_cast< SizeValueType >( runLast - runFirst + 1 );
+  }
+
+  /** Counterpart of MultiThreaderBase::ParallelizeImageRegion that
+   * schedules work over the mask runs only: invokes func( location,
+   * length ) on every run intersecting the region, distributing the
+   * runs across the threads of the given threader. If filter is not
+   * nullptr its progress is updated as runs complete. */
+  void ParallelizeRuns(MultiThreaderBase *threader,
+                       const RegionType & region,
+                       std::function< void(const IndexType &, SizeValueType) > func,
+                       ProcessObject *filter) const
+  {
+    threader->ParallelizeArray( 0, m_Runs.size(),
+      [this, &region, &func](SizeValueType i) {
+        IndexType location = m_Runs[i].Location;
+        const SizeValueType length =
+          Self::ClipRunToRegion( region, location, m_Runs[i].Length );
+        if ( length > 0 )
+          {
+          func( location, length );
+          }
+      },
+      filter );
+  }
+
+protected:
+  RunLengthMask() = default;
+  ~RunLengthMask() override = default;
+
+private:
+  RunContainerType m_Runs;
+
+  RegionType m_Region;
+
+  SizeValueType m_NumberOfInsidePixels{ 0 };
+};
+} // end namespace itk
+
+#endif
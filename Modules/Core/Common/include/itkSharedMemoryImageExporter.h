@@ -0,0 +1,69 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkSharedMemoryImageExporter_h
+#define itkSharedMemoryImageExporter_h
+
+#include "itkSharedMemorySegment.h"
+
+#include <cstring>
+#include <string>
+
+namespace itk
+{
+/** \class SharedMemoryImageExporter
+ * \brief Publishes an image's pixel buffer in a named shared memory segment.
+ *
+ * Export() creates a SharedMemorySegment sized to the image's buffered
+ * region and copies the pixel data into it. The segment name is the handle
+ * to pass to the consuming process, which maps the same pages with
+ * SharedMemorySegment::Open() and wraps them into an image with
+ * ImportImageFilter::SetSharedMemorySegment() — no file ever touches disk.
+ * The returned segment unlinks its name when the last reference to it goes
+ * away, so the exporting process should keep the pointer until the
+ * consumer has opened the segment.
+ *
+ * \sa SharedMemorySegment
+ * \sa ImportImageFilter
+ * \ingroup ITKSystemObjects
+ * \ingroup ITKCommon
+ */
+template< typename TImage >
+class ITK_TEMPLATE_EXPORT SharedMemoryImageExporter
+{
+public:
+  using ImageType = TImage;
+  using PixelType = typename TImage::PixelType;
+
+  /** Create a segment under the given name, sized to the image's buffered
+   * region, and copy the pixel buffer into it. */
+  static typename SharedMemorySegment::Pointer
+  Export(const ImageType * image, const std::string & name)
+  {
+    const SizeValueType numberOfBytes =
+      static_cast< SizeValueType >( image->GetBufferedRegion().GetNumberOfPixels() )
+      * sizeof( PixelType );
+
+    typename SharedMemorySegment::Pointer segment = SharedMemorySegment::New();
+    segment->Create( name, numberOfBytes );
+    std::memcpy( segment->GetBufferPointer(), image->GetBufferPointer(), numberOfBytes );
+    return segment;
+  }
+};
+} // end namespace itk
+
+#endif
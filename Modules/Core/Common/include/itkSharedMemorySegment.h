@@ -0,0 +1,116 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkSharedMemorySegment_h
+#define itkSharedMemorySegment_h
+
+#include "itkObject.h"
+#include "itkObjectFactory.h"
+#include "itkIntTypes.h"
+
+#include <string>
+
+namespace itk
+{
+/** \class SharedMemorySegment
+ * \brief A named POSIX shared memory segment with reference-counted lifetime.
+ *
+ * The segment wraps a shm_open() mapping. One process creates it under a
+ * name of the form "/myvolume" and fills it with pixel data; any other
+ * process opens the same name and maps the identical physical pages, so
+ * volumes cross process boundaries without serialization or copying.
+ *
+ * The object is reference counted like any other itk::Object. An image
+ * built over the segment keeps a reference through the pixel container's
+ * buffer owner, so the mapping stays valid for as long as any image uses
+ * it; the mapping is removed when the last reference goes away. By default
+ * the creating process also unlinks the name on destruction, while a
+ * process that merely opened the segment leaves the name alone.
+ *
+ * On platforms without POSIX shared memory the Create() and Open() methods
+ * throw an ExceptionObject.
+ *
+ * \sa ImportImageFilter
+ * \sa SharedMemoryImageExporter
+ * \ingroup OSSystemObjects
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT SharedMemorySegment : public Object
+{
+public:
+  ITK_DISALLOW_COPY_AND_ASSIGN(SharedMemorySegment);
+
+  /** Standard class type aliases. */
+  using Self = SharedMemorySegment;
+  using Superclass = Object;
+  using Pointer = SmartPointer< Self >;
+  using ConstPointer = SmartPointer< const Self >;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(SharedMemorySegment, Object);
+
+  /** Create a new segment of the given size. The name must start with a
+   * slash and is the handle another process passes to Open(). Throws if a
+   * segment of that name already exists. The creating process unlinks the
+   * name on destruction unless UnlinkOnDestruction is turned off. */
+  void Create(const std::string & name, SizeValueType numberOfBytes);
+
+  /** Map a segment created by another process under the given name. */
+  void Open(const std::string & name);
+
+  /** The mapped memory, valid between Create()/Open() and Release(). */
+  void * GetBufferPointer() const
+  { return m_Buffer; }
+
+  /** Size of the mapping in bytes. */
+  SizeValueType GetNumberOfBytes() const
+  { return m_NumberOfBytes; }
+
+  /** The name the segment was created or opened under. */
+  const std::string & GetName() const
+  { return m_Name; }
+
+  /** Whether destruction removes the name from the system. Creating a
+   * segment turns this on, opening one leaves it off. */
+  itkSetMacro(UnlinkOnDestruction, bool);
+  itkGetConstMacro(UnlinkOnDestruction, bool);
+  itkBooleanMacro(UnlinkOnDestruction);
+
+  /** Unmap the segment and, when UnlinkOnDestruction is on, remove its
+   * name. Called by the destructor. */
+  void Release();
+
+protected:
+  SharedMemorySegment();
+  ~SharedMemorySegment() override;
+  void PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  /** Map numberOfBytes of the named object, creating it when asked to. */
+  void Map(const std::string & name, SizeValueType numberOfBytes, bool create);
+
+  std::string   m_Name;
+  void *        m_Buffer{ nullptr };
+  SizeValueType m_NumberOfBytes{ 0 };
+  bool          m_UnlinkOnDestruction{ false };
+};
+} // end namespace itk
+
+#endif
@@ -90,6 +90,17 @@ public:
   itkSetObjectMacro(RegionSplitter, SplitterType);
   itkGetModifiableObjectMacro(RegionSplitter, SplitterType);
 
+  /** Set/Get whether upstream updates overlap with assembling the
+   * output. When enabled, the bulk data of each completed stream
+   * division is detached from the input and copied into the output on
+   * a background thread while the upstream pipeline already computes
+   * the next division, hiding the copy cost behind upstream I/O or
+   * computation. This buffers one extra division worth of input
+   * memory. Off by default. */
+  itkSetMacro(UseDoubleBuffering, bool);
+  itkGetConstMacro(UseDoubleBuffering, bool);
+  itkBooleanMacro(UseDoubleBuffering);
+
   /** Override UpdateOutputData() from ProcessObject to divide upstream
    * updates into pieces. This filter does not have a GenerateData()
    * or ThreadedGenerateData() method.  Instead, all the work is done
@@ -120,6 +131,7 @@ protected:
 private:
   unsigned int          m_NumberOfStreamDivisions;
   RegionSplitterPointer m_RegionSplitter;
+  bool                  m_UseDoubleBuffering{ false };
 };
 } // end namespace itk
 
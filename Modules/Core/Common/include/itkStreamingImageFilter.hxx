@@ -21,6 +21,9 @@
 #include "itkCommand.h"
 #include "itkImageAlgorithm.h"
 #include "itkImageRegionSplitterSlowDimension.h"
+#include "itkThreadPool.h"
+
+#include <future>
 
 namespace itk
 {
@@ -57,6 +60,8 @@ StreamingImageFilter< TInputImage, TOutputImage >
 
   os << indent << "Number of stream divisions: " << m_NumberOfStreamDivisions
      << std::endl;
+  os << indent << "UseDoubleBuffering: "
+     << ( m_UseDoubleBuffering ? "On" : "Off" ) << std::endl;
 
   itkPrintSelfObjectMacro( RegionSplitter );
 }
@@ -181,27 +186,82 @@ StreamingImageFilter< TInputImage, TOutputImage >
   /**
    * Loop over the number of pieces, execute the upstream pipeline on each
    * piece, and copy the results into the output image.
+   *
+   * With double buffering, the copy of a completed division runs on a
+   * background thread while the upstream update for the next division
+   * already executes here. The two never touch the same buffer: the
+   * completed division's bulk data is detached from the input first, so
+   * the next update fills a fresh pixel container. This is only safe
+   * when the upstream pipeline buffered exactly the requested stream
+   * region -- if it enlarged the buffer, a later division could be
+   * satisfied from it without re-execution, so the buffer must stay
+   * attached and the copy is done in place.
    */
+  std::future< void > pendingCopy;
+
   unsigned int         piece=0;
-  for (;
-       piece < numDivisions && !this->GetAbortGenerateData();
-       piece++ )
+  try
     {
-    InputImageRegionType streamRegion = outputRegion;
-    m_RegionSplitter->GetSplit(piece, numDivisions, streamRegion);
-
-    inputPtr->SetRequestedRegion(streamRegion);
-    inputPtr->PropagateRequestedRegion();
-    inputPtr->UpdateOutputData();
-
-    // copy the result to the proper place in the output. the input
-    // requested region determined by the RegionSplitter (as opposed
-    // to what the pipeline might have enlarged it to) is used to
-    // copy the regions from the input to output
-    ImageAlgorithm::Copy( inputPtr, outputPtr, streamRegion, streamRegion );
-
+    for (;
+         piece < numDivisions && !this->GetAbortGenerateData();
+         piece++ )
+      {
+      InputImageRegionType streamRegion = outputRegion;
+      m_RegionSplitter->GetSplit(piece, numDivisions, streamRegion);
+
+      inputPtr->SetRequestedRegion(streamRegion);
+      inputPtr->PropagateRequestedRegion();
+      inputPtr->UpdateOutputData();
+
+      if ( m_UseDoubleBuffering && numDivisions > 1
+           && inputPtr->GetBufferedRegion() == streamRegion )
+        {
+        // detach the division's bulk data from the input and hand it,
+        // together with the target region, to a background copy
+        typename InputImageType::Pointer divisionData = InputImageType::New();
+        divisionData->Graft(inputPtr);
+        typename InputImageType::PixelContainer::Pointer freshContainer =
+          InputImageType::PixelContainer::New();
+        inputPtr->SetPixelContainer(freshContainer);
+
+        if ( pendingCopy.valid() )
+          {
+          pendingCopy.get();
+          }
+
+        typename OutputImageType::Pointer outputHold = outputPtr;
+        pendingCopy = ThreadPool::GetInstance()->AddWork(
+          [divisionData, outputHold, streamRegion]()
+            {
+            ImageAlgorithm::Copy( divisionData.GetPointer(), outputHold.GetPointer(),
+                                  streamRegion, streamRegion );
+            } );
+        }
+      else
+        {
+        // copy the result to the proper place in the output. the input
+        // requested region determined by the RegionSplitter (as opposed
+        // to what the pipeline might have enlarged it to) is used to
+        // copy the regions from the input to output
+        ImageAlgorithm::Copy( inputPtr, outputPtr, streamRegion, streamRegion );
+        }
+
+      this->UpdateProgress( static_cast<float>(piece) / static_cast<float>(numDivisions) );
+      }
 
-    this->UpdateProgress( static_cast<float>(piece) / static_cast<float>(numDivisions) );
+    if ( pendingCopy.valid() )
+      {
+      pendingCopy.get();
+      }
+    }
+  catch ( ... )
+    {
+    // a background copy must not outlive this call frame
+    if ( pendingCopy.valid() )
+      {
+      pendingCopy.wait();
+      }
+    throw;
     }
 
   /**
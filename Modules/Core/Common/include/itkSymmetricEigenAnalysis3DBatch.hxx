@@ -0,0 +1,87 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkSymmetricEigenAnalysis3DBatch_hxx
+#define itkSymmetricEigenAnalysis3DBatch_hxx
+
+#include "itkSymmetricEigenAnalysis3DBatch.h"
+#include "itkMath.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace itk
+{
+
+template< typename TReal >
+void
+SymmetricEigenAnalysis3DBatch< TReal >
+::ComputeEigenValues(SizeValueType count,
+                     const RealType *sxx, const RealType *sxy,
+                     const RealType *sxz, const RealType *syy,
+                     const RealType *syz, const RealType *szz,
+                     RealType *eigenValue0,
+                     RealType *eigenValue1,
+                     RealType *eigenValue2)
+{
+  constexpr RealType zero = static_cast< RealType >( 0 );
+  constexpr RealType one = static_cast< RealType >( 1 );
+  const RealType twoThirdsPi =
+    static_cast< RealType >( 2.0 * Math::pi / 3.0 );
+
+  for ( SizeValueType i = 0; i < count; ++i )
+    {
+    // Shift the matrix by its mean eigenvalue q so that the remainder
+    // is traceless; p is the scale of the remainder.
+    const RealType q = ( sxx[i] + syy[i] + szz[i] ) / 3;
+
+    const RealType a = sxx[i] - q;
+    const RealType b = syy[i] - q;
+    const RealType c = szz[i] - q;
+
+    const RealType offDiagonalNorm =
+      sxy[i] * sxy[i] + sxz[i] * sxz[i] + syz[i] * syz[i];
+    const RealType p2 = ( a * a + b * b + c * c + 2 * offDiagonalNorm ) / 6;
+    const RealType p = std::sqrt(p2);
+    const RealType pInverse = ( p2 > zero ) ? one / p : zero;
+
+    // Cardano: the eigenvalues of the scaled traceless matrix are
+    // 2*cos(phi + k*2*pi/3) where cos(3*phi) = det/(2*p^3). Roundoff
+    // can push the determinant ratio slightly outside [-1, 1].
+    const RealType determinant = a * ( b * c - syz[i] * syz[i] )
+                                 - sxy[i] * ( sxy[i] * c - syz[i] * sxz[i] )
+                                 + sxz[i] * ( sxy[i] * syz[i] - b * sxz[i] );
+    const RealType halfDeterminantScaled = std::max( -one,
+      std::min( one,
+        determinant * pInverse * pInverse * pInverse / 2 ) );
+
+    const RealType phi = std::acos(halfDeterminantScaled) / 3;
+
+    // cos is decreasing on [0, pi]; phi lies in [0, pi/3], so the
+    // first root is the largest and the phi + 2*pi/3 root the smallest.
+    const RealType largest = q + 2 * p * std::cos(phi);
+    const RealType smallest = q + 2 * p * std::cos(phi + twoThirdsPi);
+
+    eigenValue0[i] = smallest;
+    eigenValue1[i] = 3 * q - largest - smallest;
+    eigenValue2[i] = largest;
+    }
+}
+
+} // end namespace itk
+
+#endif
@@ -0,0 +1,105 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkTotalProgressReporter_h
+#define itkTotalProgressReporter_h
+
+#include "itkIntTypes.h"
+#include "itkProcessObject.h"
+
+namespace itk
+{
+/** \class TotalProgressReporter
+ * \brief Per-thread progress reporter aggregating through atomic counters.
+ *
+ * Unlike ProgressReporter, which only publishes progress from work unit
+ * zero, any number of TotalProgressReporter instances may count pixels
+ * concurrently: completed pixels are batched per thread and folded into
+ * the filter's progress with ProcessObject::IncrementProgress, which is
+ * lock-free on the fast path and only invokes the ProgressEvent when the
+ * coalesced progress crosses the filter's ProgressEventGranularity.
+ * This keeps progress accounting off the critical path of fine-grained
+ * parallel filters.
+ *
+ * The constructor takes the number of pixels of the complete output
+ * (all work units together); each instance counts the pixels its thread
+ * actually processes.
+ *
+ * Example usage:
+ *
+   \code
+     TotalProgressReporter progress( this,
+                               outputRegion.GetNumberOfPixels() );
+     for( each pixel of this work unit )
+       {
+       ...
+       progress.CompletedPixel();
+       }
+   \endcode
+ *
+ * \sa ProgressReporter
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT TotalProgressReporter
+{
+public:
+  ITK_DISALLOW_COPY_AND_ASSIGN( TotalProgressReporter );
+
+  /** Constructor batches updates so that roughly numberOfUpdates
+   * increments are folded into the filter per complete execution. */
+  TotalProgressReporter(ProcessObject *filter,
+                        SizeValueType totalNumberOfPixels,
+                        SizeValueType numberOfUpdates = 100,
+                        float progressWeight  = 1.0f);
+
+  /** Destructor folds any remaining counted pixels into the filter.  */
+  ~TotalProgressReporter();
+
+  /** Called by a filter once per pixel.  */
+  void CompletedPixel()
+  {
+    // Inline implementation for efficiency.
+    if ( --m_PixelsBeforeUpdate == 0 )
+      {
+      m_PixelsBeforeUpdate = m_PixelsPerUpdate;
+      if ( m_Filter )
+        {
+        m_Filter->IncrementProgress(
+          static_cast<float>(m_PixelsPerUpdate) * m_InverseNumberOfPixels * m_ProgressWeight);
+        // all threads need to check the abort flag
+        if ( m_Filter->GetAbortGenerateData() )
+          {
+          std::string    msg;
+          ProcessAborted e(__FILE__, __LINE__);
+          msg += "Object " + std::string( m_Filter->GetNameOfClass() ) + ": AbortGenerateDataOn";
+          e.SetDescription(msg);
+          throw e;
+          }
+        }
+      }
+  }
+
+protected:
+  ProcessObject *m_Filter;
+  float          m_InverseNumberOfPixels;
+  SizeValueType  m_PixelsPerUpdate;
+  SizeValueType  m_PixelsBeforeUpdate;
+  float          m_ProgressWeight;
+};
+} // end namespace itk
+
+#endif
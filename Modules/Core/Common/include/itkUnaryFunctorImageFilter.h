@@ -21,6 +21,7 @@
 #include "itkMath.h"
 #include "itkInPlaceImageFilter.h"
 #include "itkImageRegionIteratorWithIndex.h"
+#include "itkRunLengthMask.h"
 
 namespace itk
 {
@@ -99,6 +100,23 @@ public:
       }
   }
 
+  /** RunLengthMask type alias support */
+  using RunLengthMaskType = RunLengthMask< TOutputImage::ImageDimension >;
+
+  /** Set/Get an optional run-length mask. When set, the functor is
+   * applied to the pixels inside the mask runs only and the pixels
+   * outside are set to the MaskedOutsideValue, so heavily masked
+   * images are processed in time proportional to the mask. The runs
+   * are indexed in the output image space.
+   * \sa RunLengthMask */
+  itkSetConstObjectMacro(RunLengthMask, RunLengthMaskType);
+  itkGetConstObjectMacro(RunLengthMask, RunLengthMaskType);
+
+  /** Set/Get the value written outside the mask runs when a
+   * run-length mask is set. Defaults to zero. */
+  itkSetMacro(MaskedOutsideValue, OutputImagePixelType);
+  itkGetConstMacro(MaskedOutsideValue, OutputImagePixelType);
+
 protected:
   UnaryFunctorImageFilter();
   ~UnaryFunctorImageFilter() override = default;
@@ -126,7 +144,16 @@ protected:
   void DynamicThreadedGenerateData(const OutputImageRegionType & outputRegionForThread) override;
 
 private:
+  /** Masked variant of DynamicThreadedGenerateData: writes the
+   * MaskedOutsideValue over the thread region and then applies the
+   * functor over the mask runs intersecting it. */
+  void MaskedDynamicThreadedGenerateData(const OutputImageRegionType & outputRegionForThread);
+
   FunctorType m_Functor;
+
+  typename RunLengthMaskType::ConstPointer m_RunLengthMask;
+
+  OutputImagePixelType m_MaskedOutsideValue;
 };
 } // end namespace itk
 
@@ -31,6 +31,7 @@ UnaryFunctorImageFilter< TInputImage, TOutputImage, TFunction >
   this->SetNumberOfRequiredInputs(1);
   this->InPlaceOff();
   this->DynamicMultiThreadingOn();
+  this->m_MaskedOutsideValue = NumericTraits< OutputImagePixelType >::ZeroValue();
 }
 
 /**
@@ -84,6 +85,13 @@ UnaryFunctorImageFilter< TInputImage, TOutputImage, TFunction >
     {
     return;
     }
+
+  if ( m_RunLengthMask )
+    {
+    this->MaskedDynamicThreadedGenerateData(outputRegionForThread);
+    return;
+    }
+
   const TInputImage *inputPtr = this->GetInput();
   TOutputImage *outputPtr = this->GetOutput(0);
 
@@ -111,6 +119,62 @@ UnaryFunctorImageFilter< TInputImage, TOutputImage, TFunction >
     outputIt.NextLine();
     }
 }
+
+template< typename TInputImage, typename TOutputImage, typename TFunction  >
+void
+UnaryFunctorImageFilter< TInputImage, TOutputImage, TFunction >
+::MaskedDynamicThreadedGenerateData(const OutputImageRegionType & outputRegionForThread)
+{
+  const TInputImage *inputPtr = this->GetInput();
+  TOutputImage *outputPtr = this->GetOutput(0);
+
+  // Write the outside value everywhere first; the runs overwrite the
+  // inside pixels below.
+  ImageScanlineIterator< TOutputImage > fillIt(outputPtr, outputRegionForThread);
+  while ( !fillIt.IsAtEnd() )
+    {
+    while ( !fillIt.IsAtEndOfLine() )
+      {
+      fillIt.Set(m_MaskedOutsideValue);
+      ++fillIt;
+      }
+    fillIt.NextLine();
+    }
+
+  // Apply the functor over the portion of each run falling inside
+  // this thread's region.
+  for ( const auto & run : m_RunLengthMask->GetRuns() )
+    {
+    typename OutputImageRegionType::IndexType location = run.Location;
+    const SizeValueType length =
+      RunLengthMaskType::ClipRunToRegion(outputRegionForThread, location, run.Length);
+    if ( length == 0 )
+      {
+      continue;
+      }
+
+    OutputImageRegionType runRegion;
+    runRegion.SetIndex(location);
+    typename OutputImageRegionType::SizeType runSize;
+    runSize.Fill(1);
+    runSize[0] = length;
+    runRegion.SetSize(runSize);
+
+    // The input and output images may be of different dimensions.
+    InputImageRegionType inputRunRegion;
+    this->CallCopyOutputRegionToInputRegion(inputRunRegion, runRegion);
+
+    ImageScanlineConstIterator< TInputImage > inputIt(inputPtr, inputRunRegion);
+    ImageScanlineIterator< TOutputImage > outputIt(outputPtr, runRegion);
+
+    while ( !inputIt.IsAtEndOfLine() )
+      {
+      outputIt.Set( m_Functor( inputIt.Get() ) );
+      ++inputIt;
+      ++outputIt;
+      }
+    }
+}
 } // end namespace itk
 
 #endif
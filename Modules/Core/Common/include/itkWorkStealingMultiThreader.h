@@ -0,0 +1,92 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkWorkStealingMultiThreader_h
+#define itkWorkStealingMultiThreader_h
+
+#include "itkPoolMultiThreader.h"
+
+namespace itk
+{
+/** \class WorkStealingMultiThreader
+ * \brief A thread pool multi-threader with dynamic work-stealing scheduling.
+ *
+ * ParallelizeImageRegion splits the requested region into many more tiles
+ * than there are worker threads, distributes the tiles round-robin into
+ * per-worker deques, and lets idle workers steal tiles from the back of
+ * their neighbors' deques. Compared to the static splitting done by
+ * PoolMultiThreader, this keeps all cores busy when per-tile cost varies
+ * strongly across the image (e.g. body versus air in a CT volume) or when
+ * cores run at different speeds.
+ *
+ * The tile granularity is controlled by the oversubscription factor: the
+ * region is split into approximately GetNumberOfWorkUnits() times
+ * GetTileOversubscription() tiles.
+ *
+ * This threader can be selected globally via
+ * MultiThreaderBase::SetGlobalDefaultThreader( ThreaderType::WorkStealing )
+ * or the ITK_GLOBAL_DEFAULT_THREADER=WorkStealing environment variable.
+ *
+ * \ingroup OSSystemObjects
+ *
+ * \ingroup ITKCommon
+ */
+
+class ITKCommon_EXPORT WorkStealingMultiThreader : public PoolMultiThreader
+{
+public:
+  ITK_DISALLOW_COPY_AND_ASSIGN(WorkStealingMultiThreader);
+
+  /** Standard class type aliases. */
+  using Self = WorkStealingMultiThreader;
+  using Superclass = PoolMultiThreader;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(WorkStealingMultiThreader, PoolMultiThreader);
+
+  /** Set/Get the number of tiles to create per work unit. Larger values
+   * give better load balance at the cost of more scheduling overhead.
+   * The value is clamped to the range [ 1, 64 ]. */
+  virtual void SetTileOversubscription( ThreadIdType factor );
+  itkGetConstMacro( TileOversubscription, ThreadIdType );
+
+  /** Break up region into fine-grained tiles, and process the tiles with
+   * work-stealing among the pool threads. */
+  void
+  ParallelizeImageRegion(
+    unsigned int dimension,
+    const IndexValueType index[],
+    const SizeValueType size[],
+    ThreadingFunctorType funcP,
+    ProcessObject* filter) override;
+
+protected:
+  WorkStealingMultiThreader();
+  ~WorkStealingMultiThreader() override;
+  void PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  ThreadIdType m_TileOversubscription;
+};
+
+}  // end namespace itk
+#endif
@@ -0,0 +1,75 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkImageAllocatorBase.h"
+
+#include <new>
+
+namespace itk
+{
+
+ImageAllocatorBase::Pointer ImageAllocatorBase::m_GlobalDefaultAllocator;
+
+bool ImageAllocatorBase::m_GlobalParallelFirstTouch = false;
+
+ImageAllocatorBase::ImageAllocatorBase() = default;
+
+ImageAllocatorBase::~ImageAllocatorBase() = default;
+
+void *
+ImageAllocatorBase
+::Allocate(SizeValueType numberOfBytes)
+{
+  return ::operator new( numberOfBytes );
+}
+
+void
+ImageAllocatorBase
+::Deallocate(void * buffer, SizeValueType itkNotUsed( numberOfBytes ) )
+{
+  ::operator delete( buffer );
+}
+
+void
+ImageAllocatorBase
+::SetGlobalDefaultAllocator( ImageAllocatorBase * allocator )
+{
+  m_GlobalDefaultAllocator = allocator;
+}
+
+ImageAllocatorBase *
+ImageAllocatorBase
+::GetGlobalDefaultAllocator()
+{
+  return m_GlobalDefaultAllocator;
+}
+
+void
+ImageAllocatorBase
+::SetGlobalParallelFirstTouch( bool enabled )
+{
+  m_GlobalParallelFirstTouch = enabled;
+}
+
+bool
+ImageAllocatorBase
+::GetGlobalParallelFirstTouch()
+{
+  return m_GlobalParallelFirstTouch;
+}
+
+} // end namespace itk
@@ -0,0 +1,256 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkImageRegionSplitterCacheAwareTile.h"
+#include "itkMath.h"
+
+#include "itksys/SystemInformation.hxx"
+
+#include <vector>
+
+namespace itk
+{
+
+namespace
+{
+SizeValueType DetectDataCacheSize()
+{
+  itksys::SystemInformation info;
+  info.RunCPUCheck();
+
+  int cacheKiB = info.GetProcessorCacheXSize(
+    itksys::SystemInformation::CPU_FEATURE_L2CACHE);
+  if ( cacheKiB <= 0 )
+    {
+    cacheKiB = info.GetProcessorCacheSize();
+    }
+  if ( cacheKiB <= 0 )
+    {
+    // conservative guess when the platform reports nothing
+    cacheKiB = 256;
+    }
+  return static_cast< SizeValueType >( cacheKiB ) * 1024;
+}
+}
+
+ImageRegionSplitterCacheAwareTile
+::ImageRegionSplitterCacheAwareTile()
+{
+  m_BytesPerPixel = sizeof( float );
+  m_KernelRadius = 0;
+  m_CacheSize = 0;
+}
+
+SizeValueType
+ImageRegionSplitterCacheAwareTile
+::GetEffectiveCacheSize() const
+{
+  if ( m_CacheSize != 0 )
+    {
+    return m_CacheSize;
+    }
+
+  // the detection probes /proc or cpuid; do it once per process
+  static const SizeValueType detectedCacheSize = DetectDataCacheSize();
+  return detectedCacheSize;
+}
+
+unsigned int
+ImageRegionSplitterCacheAwareTile
+::GetNumberOfSplitsInternal(unsigned int dim,
+                            const IndexValueType itkNotUsed(regionIndex)[],
+                            const SizeValueType regionSize[],
+                            unsigned int requestedNumber) const
+{
+  std::vector< unsigned int > splits(dim);
+
+  return this->ComputeSplits(dim, requestedNumber, regionSize, &splits[0]);
+}
+
+unsigned int
+ImageRegionSplitterCacheAwareTile
+::GetSplitInternal(unsigned int dim,
+                   unsigned int splitI,
+                   unsigned int numberOfPieces,
+                   IndexValueType regionIndex[],
+                   SizeValueType regionSize[]) const
+{
+  // number of splits in each dimension
+  std::vector< unsigned int > splits(dim);
+
+  // index into splitted regions
+  std::vector< unsigned int > splittedRegionIndex(dim);
+
+  numberOfPieces = this->ComputeSplits(dim, numberOfPieces, regionSize, &splits[0]);
+
+  // determine which splitted region we are in
+  unsigned int offset = splitI;
+  for ( unsigned int i = dim - 1; i > 0; --i )
+    {
+    unsigned int dimensionOffset = 1;
+    for ( unsigned int j = 0; j < i; ++j )
+      {
+      dimensionOffset *= splits[j];
+      }
+
+    splittedRegionIndex[i] = offset / dimensionOffset;
+    offset -= ( splittedRegionIndex[i] * dimensionOffset );
+    }
+  splittedRegionIndex[0] = offset;
+
+  // Assign the output split region to the input region in-place
+  for ( unsigned int i = 0; i < dim; i++ )
+    {
+    const SizeValueType inputRegionSize = regionSize[i];
+    const auto indexOffset = Math::Floor< IndexValueType >(
+      ( splittedRegionIndex[i] ) * ( inputRegionSize / double(splits[i]) ) );
+
+    regionIndex[i] += indexOffset;
+    if ( splittedRegionIndex[i] < splits[i] - 1 )
+      {
+      regionSize[i] = Math::Floor< SizeValueType >(
+        ( splittedRegionIndex[i] + 1 ) * ( inputRegionSize / double(splits[i]) ) ) - indexOffset;
+      }
+    else
+      {
+      // this dimension is falling off the edge of the image
+      regionSize[i] = regionSize[i] - indexOffset;
+      }
+    }
+
+  return numberOfPieces;
+}
+
+double
+ImageRegionSplitterCacheAwareTile
+::ComputeTileWorkingSet(unsigned int dim,
+                        const SizeValueType regionSize[],
+                        const unsigned int splits[]) const
+{
+  double workingSet = m_BytesPerPixel;
+
+  for ( unsigned int i = 0; i < dim; ++i )
+    {
+    workingSet *= regionSize[i] / double(splits[i])
+                  + 2.0 * static_cast< double >( m_KernelRadius );
+    }
+  return workingSet;
+}
+
+/**
+ * given the requestedNumber of regions to split the "region" argument
+ * into, it returns the number of splitted regions in each dimension
+ * as "splits" and returns the total number of splitted regions
+ */
+unsigned int
+ImageRegionSplitterCacheAwareTile
+::ComputeSplits(unsigned int dim,
+                unsigned int requestedNumber,
+                const SizeValueType regionSize[],
+                unsigned int splits[]) const
+{
+  const double cacheSize = static_cast< double >( this->GetEffectiveCacheSize() );
+
+  unsigned int numberOfPieces = 1;
+
+  for ( unsigned int i = 0; i < dim; ++i )
+    {
+    splits[i] = 1;
+    }
+
+  while ( true )
+    {
+    unsigned int splitDim = 0;
+
+    if ( this->ComputeTileWorkingSet(dim, regionSize, splits) > cacheSize )
+      {
+      // The tile does not fit in the cache yet: split the dimension
+      // with the largest padded extent, shrinking toward square-ish
+      // tiles.
+      double maxExtent = 0.0;
+      for ( unsigned int i = 0; i < dim; ++i )
+        {
+        const double extent = regionSize[i] / double(splits[i])
+                              + 2.0 * static_cast< double >( m_KernelRadius );
+        if ( splits[i] < regionSize[i] && extent > maxExtent )
+          {
+          maxExtent = extent;
+          splitDim = i;
+          }
+        }
+      if ( maxExtent == 0.0 )
+        {
+        // every dimension is down to single pixels
+        return numberOfPieces;
+        }
+      }
+    else
+      {
+      // The tile already fits in the cache: take further splits from
+      // the slowest splittable dimension, which keeps scanlines intact
+      // and costs no cache reuse.
+      unsigned int i = dim;
+      while ( i > 0 )
+        {
+        --i;
+        if ( splits[i] < regionSize[i] )
+          {
+          splitDim = i;
+          break;
+          }
+        }
+      if ( splits[splitDim] >= regionSize[splitDim] )
+        {
+        return numberOfPieces;
+        }
+      }
+
+    // calculate the number of additional pieces this split would add
+    unsigned int additionalNumPieces = 1;
+    for ( unsigned int i = 0; i < dim; ++i )
+      {
+      if ( i != splitDim )
+        {
+        additionalNumPieces *= splits[i];
+        }
+      }
+
+    // check if this would give us too many pieces
+    if ( numberOfPieces + additionalNumPieces > requestedNumber )
+      {
+      return numberOfPieces;
+      }
+
+    // update the variables with the new split
+    numberOfPieces += additionalNumPieces;
+    ++splits[splitDim];
+    }
+}
+
+void
+ImageRegionSplitterCacheAwareTile
+::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  os << indent << "BytesPerPixel: " << m_BytesPerPixel << std::endl;
+  os << indent << "KernelRadius: " << m_KernelRadius << std::endl;
+  os << indent << "CacheSize: " << m_CacheSize << std::endl;
+}
+
+} // end namespace itk
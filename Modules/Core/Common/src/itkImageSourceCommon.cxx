@@ -45,5 +45,12 @@ const ImageRegionSplitterBase*  ImageSourceCommon::GetGlobalDefaultSplitter()
   return globalDefaultSplitter;
 }
 
+void ImageSourceCommon::SetGlobalDefaultSplitter(ImageRegionSplitterBase *splitter)
+{
+  std::lock_guard< std::mutex > lock(globalDefaultSplitterLock);
+  // a null argument restores the lazily created default
+  globalDefaultSplitter = splitter;
+}
+
 
 }
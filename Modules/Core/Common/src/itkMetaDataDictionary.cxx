@@ -22,21 +22,18 @@ namespace itk
 MetaDataDictionary
 ::MetaDataDictionary()
 {
-  m_Dictionary = new MetaDataDictionaryMapType;
+  m_Dictionary = std::make_shared< MetaDataDictionaryMapType >();
 }
 
 MetaDataDictionary
-::~MetaDataDictionary()
-{
-  delete m_Dictionary;
-  m_Dictionary = nullptr;
-}
+::~MetaDataDictionary() = default;
 
 MetaDataDictionary
 ::MetaDataDictionary(const MetaDataDictionary & old)
 {
-  m_Dictionary = new MetaDataDictionaryMapType;
-  *m_Dictionary = *( old.m_Dictionary );
+  // Copies share the map; it is only cloned when one of the copies is
+  // about to be modified (see MakeUnique).
+  m_Dictionary = old.m_Dictionary;
 }
 
 MetaDataDictionary & MetaDataDictionary
@@ -44,11 +41,21 @@ MetaDataDictionary & MetaDataDictionary
 {
   if(this != &old)
     {
-    *m_Dictionary = *( old.m_Dictionary );
+    m_Dictionary = old.m_Dictionary;
     }
   return *this;
 }
 
+void
+MetaDataDictionary
+::MakeUnique()
+{
+  if( m_Dictionary.use_count() > 1 )
+    {
+    m_Dictionary = std::make_shared< MetaDataDictionaryMapType >( *m_Dictionary );
+    }
+}
+
 void
 MetaDataDictionary
 ::Print(std::ostream & os) const
@@ -66,6 +73,7 @@ MetaDataObjectBase::Pointer &
 MetaDataDictionary
 ::operator[](const std::string & key)
 {
+  this->MakeUnique();
   return ( *m_Dictionary )[key];
 }
 
@@ -73,10 +81,13 @@ const MetaDataObjectBase *
 MetaDataDictionary
 ::operator[](const std::string & key) const
 {
-  MetaDataObjectBase::Pointer entry = ( *m_Dictionary )[key];
-  const MetaDataObjectBase *  constentry = entry.GetPointer();
-
-  return constentry;
+  // must not insert a default entry: the map may be shared with copies
+  MetaDataDictionaryMapType::const_iterator it = m_Dictionary->find( key );
+  if( it == m_Dictionary->end() )
+    {
+    return nullptr;
+    }
+  return it->second.GetPointer();
 }
 
 const MetaDataObjectBase *
@@ -87,15 +98,14 @@ MetaDataDictionary
     {
         itkGenericExceptionMacro(<< "Key '"<<key<<"' does not exist ");
     }
-    MetaDataObjectBase::Pointer entry = ( *m_Dictionary )[key];
-    const MetaDataObjectBase *  constentry = entry.GetPointer();
-    return constentry;
+    return m_Dictionary->find( key )->second.GetPointer();
 }
 
 void
 MetaDataDictionary
 ::Set(const std::string & key, MetaDataObjectBase * object)
 {
+  this->MakeUnique();
   (*m_Dictionary)[key] = object;
 }
 
@@ -126,6 +136,7 @@ MetaDataDictionary::Iterator
 MetaDataDictionary
 ::Begin()
 {
+  this->MakeUnique();
   return m_Dictionary->begin();
 }
 
@@ -140,6 +151,7 @@ MetaDataDictionary::Iterator
 MetaDataDictionary
 ::End()
 {
+  this->MakeUnique();
   return m_Dictionary->end();
 }
 
@@ -154,6 +166,7 @@ MetaDataDictionary::Iterator
 MetaDataDictionary
 ::Find(const std::string & key)
 {
+  this->MakeUnique();
   return m_Dictionary->find(key);
 }
 
@@ -168,13 +181,22 @@ void
 MetaDataDictionary
 ::Clear()
 {
-  this->m_Dictionary->clear();
+  if( m_Dictionary.use_count() > 1 )
+    {
+    // no need to clone the contents just to discard them
+    m_Dictionary = std::make_shared< MetaDataDictionaryMapType >();
+    }
+  else
+    {
+    this->m_Dictionary->clear();
+    }
 }
 
 bool
 MetaDataDictionary
 ::Erase( const std::string& key )
 {
+  this->MakeUnique();
   auto it = m_Dictionary->find( key );
   const MetaDataDictionaryMapType::iterator end = m_Dictionary->end();
 
@@ -28,13 +28,17 @@
 #include "itkMultiThreaderBase.h"
 #include "itkPlatformMultiThreader.h"
 #include "itkPoolMultiThreader.h"
+#include "itkWorkStealingMultiThreader.h"
 #include "itkNumericTraits.h"
 #include <mutex>
 #include <mutex>
 #include "itksys/SystemTools.hxx"
 #include "itkImageSourceCommon.h"
 #include "itkProcessObject.h"
+#include <atomic>
+#include <iomanip>
 #include <iostream>
+#include <map>
 #include <string>
 #include <algorithm>
 #include <cctype>
@@ -285,6 +289,10 @@ MultiThreaderBase
     {
     return ThreaderType::TBB;
     }
+  else if (threaderString == "WORKSTEALING")
+    {
+    return ThreaderType::WorkStealing;
+    }
   else
     {
     return ThreaderType::Unknown;
@@ -407,6 +415,8 @@ MultiThreaderBase::Pointer MultiThreaderBase::New()
 #else
         itkGenericExceptionMacro("ITK has been built without TBB support!");
 #endif
+      case ThreaderType::WorkStealing:
+        return WorkStealingMultiThreader::New();
       default:
         itkGenericExceptionMacro("MultiThreaderBase::GetGlobalDefaultThreader returned Unknown!");
       }
@@ -460,6 +470,188 @@ MultiThreaderBase
 }
 
 
+namespace
+{
+// Process-wide storage for the per-dispatch threading statistics.
+std::atomic< bool > threadingStatisticsEnabled( false );
+std::mutex          threadingStatisticsMutex;
+std::vector< MultiThreaderBase::ThreadingStatisticsRecord > threadingStatisticsRecords;
+}
+
+void
+MultiThreaderBase
+::SetCollectThreadingStatistics(bool collect)
+{
+  threadingStatisticsEnabled.store( collect, std::memory_order_relaxed );
+}
+
+bool
+MultiThreaderBase
+::GetCollectThreadingStatistics()
+{
+  return threadingStatisticsEnabled.load( std::memory_order_relaxed );
+}
+
+void
+MultiThreaderBase
+::ClearThreadingStatistics()
+{
+  std::lock_guard< std::mutex > lock( threadingStatisticsMutex );
+  threadingStatisticsRecords.clear();
+}
+
+std::vector< MultiThreaderBase::ThreadingStatisticsRecord >
+MultiThreaderBase
+::GetThreadingStatistics()
+{
+  std::lock_guard< std::mutex > lock( threadingStatisticsMutex );
+  return threadingStatisticsRecords;
+}
+
+void
+MultiThreaderBase
+::ReportThreadingStatistics(std::ostream & os)
+{
+  struct FilterAggregate
+  {
+    SizeValueType Dispatches{ 0 };
+    SizeValueType WorkUnits{ 0 };
+    double        WallTime{ 0.0 };
+    double        BusyTime{ 0.0 };
+    double        WorstImbalance{ 0.0 };
+    SizeValueType Stolen{ 0 };
+  };
+
+  std::map< std::string, FilterAggregate > aggregates;
+  for ( const ThreadingStatisticsRecord & record : MultiThreaderBase::GetThreadingStatistics() )
+    {
+    FilterAggregate & aggregate = aggregates[record.FilterName];
+    ++aggregate.Dispatches;
+    aggregate.WorkUnits += record.NumberOfWorkUnits;
+    aggregate.WallTime += record.CallWallTime;
+    aggregate.BusyTime += record.TotalWorkUnitTime;
+    if ( record.NumberOfWorkUnits > 0 && record.TotalWorkUnitTime > 0.0 )
+      {
+      // Longest work unit against the mean: 1.0 is a perfectly even split.
+      const double mean = record.TotalWorkUnitTime / record.NumberOfWorkUnits;
+      aggregate.WorstImbalance = std::max( aggregate.WorstImbalance,
+                                           record.MaxWorkUnitTime / mean );
+      }
+    aggregate.Stolen += record.StolenWorkUnits;
+    }
+
+  const std::ios_base::fmtflags previousFlags = os.flags();
+  const std::streamsize previousPrecision = os.precision();
+
+  os << std::left << std::setw( 45 ) << "Filter"
+     << std::right
+     << std::setw( 11 ) << "Dispatches"
+     << std::setw( 11 ) << "WorkUnits"
+     << std::setw( 12 ) << "Wall (s)"
+     << std::setw( 12 ) << "Busy (s)"
+     << std::setw( 9 )  << "EffPar"
+     << std::setw( 11 ) << "Imbalance"
+     << std::setw( 9 )  << "Stolen" << std::endl;
+
+  os << std::fixed;
+  for ( const auto & aggregate : aggregates )
+    {
+    const FilterAggregate & a = aggregate.second;
+    os << std::left << std::setw( 45 ) << aggregate.first
+       << std::right
+       << std::setw( 11 ) << a.Dispatches
+       << std::setw( 11 ) << a.WorkUnits
+       << std::setprecision( 6 )
+       << std::setw( 12 ) << a.WallTime
+       << std::setw( 12 ) << a.BusyTime
+       << std::setprecision( 2 )
+       << std::setw( 9 )  << ( a.WallTime > 0.0 ? a.BusyTime / a.WallTime : 0.0 )
+       << std::setw( 11 ) << a.WorstImbalance
+       << std::setw( 9 )  << a.Stolen << std::endl;
+    }
+
+  os.flags( previousFlags );
+  os.precision( previousPrecision );
+}
+
+MultiThreaderBase::ThreadingStatisticsAccumulator
+::ThreadingStatisticsAccumulator() :
+  m_Start( std::chrono::steady_clock::now() )
+{
+}
+
+MultiThreaderBase::ThreadingFunctorType
+MultiThreaderBase::ThreadingStatisticsAccumulator
+::WrapRegionFunctor(ThreadingFunctorType funcP)
+{
+  return [this, funcP](const IndexValueType index[], const SizeValueType size[])
+    {
+    const auto start = std::chrono::steady_clock::now();
+    funcP( index, size );
+    this->AddSample( std::chrono::duration< double >(
+      std::chrono::steady_clock::now() - start ).count() );
+    };
+}
+
+MultiThreaderBase::ArrayThreadingFunctorType
+MultiThreaderBase::ThreadingStatisticsAccumulator
+::WrapArrayFunctor(ArrayThreadingFunctorType aFunc)
+{
+  return [this, aFunc](SizeValueType i)
+    {
+    const auto start = std::chrono::steady_clock::now();
+    aFunc( i );
+    this->AddSample( std::chrono::duration< double >(
+      std::chrono::steady_clock::now() - start ).count() );
+    };
+}
+
+void
+MultiThreaderBase::ThreadingStatisticsAccumulator
+::AddStolenWorkUnits(SizeValueType count)
+{
+  std::lock_guard< std::mutex > lock( m_Mutex );
+  m_Stolen += count;
+}
+
+void
+MultiThreaderBase::ThreadingStatisticsAccumulator
+::AddSample(double seconds)
+{
+  std::lock_guard< std::mutex > lock( m_Mutex );
+  if ( m_Count == 0 || seconds < m_Min )
+    {
+    m_Min = seconds;
+    }
+  if ( m_Count == 0 || seconds > m_Max )
+    {
+    m_Max = seconds;
+    }
+  m_Total += seconds;
+  ++m_Count;
+}
+
+void
+MultiThreaderBase::ThreadingStatisticsAccumulator
+::Record(ProcessObject * filter)
+{
+  ThreadingStatisticsRecord record;
+  record.FilterName = filter ? filter->GetNameOfClass() : "(no filter)";
+  record.CallWallTime = std::chrono::duration< double >(
+    std::chrono::steady_clock::now() - m_Start ).count();
+    {
+    std::lock_guard< std::mutex > lock( m_Mutex );
+    record.NumberOfWorkUnits = m_Count;
+    record.TotalWorkUnitTime = m_Total;
+    record.MinWorkUnitTime = m_Min;
+    record.MaxWorkUnitTime = m_Max;
+    record.StolenWorkUnits = m_Stolen;
+    }
+  std::lock_guard< std::mutex > lock( threadingStatisticsMutex );
+  threadingStatisticsRecords.push_back( record );
+}
+
+
 void
 MultiThreaderBase
 ::HandleFilterProgress(ProcessObject *filter, float progress)
@@ -494,6 +686,13 @@ MultiThreaderBase
   // SetSingleMethod+SingleMethodExecute. This method is meant to be overloaded!
   MultiThreaderBase::HandleFilterProgress(filter, 0.0f);
 
+  const bool collectStatistics = MultiThreaderBase::GetCollectThreadingStatistics();
+  ThreadingStatisticsAccumulator statistics;
+  if ( collectStatistics )
+    {
+    aFunc = statistics.WrapArrayFunctor( aFunc );
+    }
+
   if ( firstIndex + 1 < lastIndexPlus1 )
     {
     struct ArrayCallback acParams {
@@ -512,6 +711,11 @@ MultiThreaderBase
     }
   // else nothing needs to be executed
 
+  if ( collectStatistics )
+    {
+    statistics.Record( filter );
+    }
+
   MultiThreaderBase::HandleFilterProgress(filter, 1.0f);
 }
 
@@ -568,6 +772,13 @@ MultiThreaderBase
   // SetSingleMethod+SingleMethodExecute. This method is meant to be overloaded!
   MultiThreaderBase::HandleFilterProgress(filter, 0.0f);
 
+  const bool collectStatistics = MultiThreaderBase::GetCollectThreadingStatistics();
+  ThreadingStatisticsAccumulator statistics;
+  if ( collectStatistics )
+    {
+    funcP = statistics.WrapRegionFunctor( funcP );
+    }
+
   SizeValueType pixelCount = 1;
   for (unsigned d = 0; d < dimension; d++)
     {
@@ -585,6 +796,11 @@ MultiThreaderBase
   this->SetSingleMethod(&MultiThreaderBase::ParallelizeImageRegionHelper, &rnc);
   this->SingleMethodExecute();
 
+  if ( collectStatistics )
+    {
+    statistics.Record( filter );
+    }
+
   MultiThreaderBase::HandleFilterProgress(filter, 1.0f);
 }
 
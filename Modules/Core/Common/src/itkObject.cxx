@@ -27,6 +27,9 @@
  *=========================================================================*/
 #include "itkCommand.h"
 #include <algorithm>
+#include <map>
+#include <typeindex>
+#include <vector>
 
 namespace itk
 {
@@ -48,6 +51,11 @@ public:
   Command::Pointer   m_Command;
   const EventObject *m_Event;
   unsigned long      m_Tag;
+  // Execute the command only on every m_DispatchInterval-th matching
+  // event; used to coalesce high-frequency events such as per-iteration
+  // optimizer events.
+  unsigned int       m_DispatchInterval{1};
+  unsigned int       m_PendingEventCount{0};
 };
 /* Create Out-of-line Definition */
 Observer::~Observer() { delete m_Event; }
@@ -66,6 +74,8 @@ public:
 
   void RemoveAllObservers();
 
+  void SetDispatchInterval(unsigned long tag, unsigned int interval);
+
   void InvokeEvent(const EventObject & event, Object *self);
 
   void InvokeEvent(const EventObject & event, const Object *self);
@@ -101,12 +111,18 @@ protected:
   };
 
   template<typename TObject>
-    void InvokeEventRecursion(const EventObject & event,
-                              TObject *self,
-                              std::list< Observer * >::reverse_iterator &i);
+    void InvokeEventDispatch(const EventObject & event, TObject *self);
 
 private:
+  /** Return the observers matching the concrete type of the event,
+   * in the order they were added. The list is computed with CheckEvent
+   * on the first invocation of an event type and cached afterwards, so
+   * repeated invocations in inner loops avoid the virtual matching
+   * scan. Any change to the observer list discards the cache. */
+  const std::vector< Observer * > & GetDispatchList(const EventObject & event);
+
   std::list< Observer * > m_Observers;
+  std::map< std::type_index, std::vector< Observer * > > m_DispatchCache;
   unsigned long           m_Count;
 };
 
@@ -126,6 +142,7 @@ SubjectImplementation::AddObserver(const EventObject & event,
   auto * ptr = new Observer(cmd, event.MakeObject(), m_Count);
 
   m_Observers.push_back(ptr);
+  m_DispatchCache.clear();
   m_Count++;
   return ptr->m_Tag;
 }
@@ -138,6 +155,7 @@ SubjectImplementation::AddObserver(const EventObject & event,
   auto * me = const_cast< SubjectImplementation * >( this );
 
   me->m_Observers.push_back(ptr);
+  me->m_DispatchCache.clear();
   me->m_Count++;
   return ptr->m_Tag;
 }
@@ -152,6 +170,7 @@ SubjectImplementation::RemoveObserver(unsigned long tag)
       {
       delete ( *i );
       m_Observers.erase(i);
+      m_DispatchCache.clear();
       m_ListModified = true;
       return;
       }
@@ -166,73 +185,96 @@ SubjectImplementation::RemoveAllObservers()
     delete observer;
     }
   m_Observers.clear();
+  m_DispatchCache.clear();
   m_ListModified = true;
 }
 
+void
+SubjectImplementation::SetDispatchInterval(unsigned long tag, unsigned int interval)
+{
+  for (auto & observer : m_Observers)
+    {
+    if ( observer->m_Tag == tag )
+      {
+      observer->m_DispatchInterval = std::max( 1u, interval );
+      observer->m_PendingEventCount = 0;
+      return;
+      }
+    }
+}
+
 void
 SubjectImplementation::InvokeEvent(const EventObject & event,
                                    Object *self)
 {
-  // While an event is being invoked, it's possible to remove
-  // observers, or another event to be invoked. All methods which
-  // remove observers mark the list as modified with the
-  // m_ListModified flag. The modified flag is save to the stack and
-  // marked false before recursively saving the current list.
-
-  SaveRestoreListModified save(this);
-
-  auto i = m_Observers.rbegin();
-  InvokeEventRecursion( event, self, i );
+  this->InvokeEventDispatch( event, self );
 }
 
 void
 SubjectImplementation::InvokeEvent(const EventObject & event,
                                    const Object *self)
 {
-  SaveRestoreListModified save(this);
-
-  auto i = m_Observers.rbegin();
-  InvokeEventRecursion( event, self, i );
+  this->InvokeEventDispatch( event, self );
 }
 
 template<typename TObject>
 void
-SubjectImplementation::InvokeEventRecursion( const EventObject & event,
-                                             TObject *self,
-                                             std::list< Observer * >::reverse_iterator &i)
-{
-  // This method recursively visits the list of observers in reverse
-  // order so that on the last recursion the first observer can be
-  // executed. Each iteration saves the list element on the
-  // stack. Each observer's execution could potentially modify the
-  // observer list, by placing the entire list on the stack we save the
-  // list when the event is first invoked. If observers are removed
-  // during execution, then the current list is search for the current
-  // observer save on the stack.
-
-  while (i != m_Observers.rend())
-    {
+SubjectImplementation::InvokeEventDispatch( const EventObject & event, TObject *self)
+{
+  // While an event is being invoked, it's possible to remove
+  // observers, or another event to be invoked. All methods which
+  // remove observers mark the list as modified with the
+  // m_ListModified flag. The modified flag is saved to the stack and
+  // marked false for the duration of this dispatch.
 
-    // save observer
-    const Observer *o = *i;
+  SaveRestoreListModified save(this);
 
-    if ( o->m_Event->CheckEvent(&event) )
-      {
-      InvokeEventRecursion( event, self, ++i );
+  // Copy the matching observers so that removals during execution
+  // cannot invalidate the iteration; a removed observer is still
+  // skipped by the existence check below.
+  const std::vector< Observer * > dispatchList = this->GetDispatchList(event);
 
-      if ( !m_ListModified ||
-           std::find(m_Observers.begin(), m_Observers.end(), o) != m_Observers.end() )
-        {
-        o->m_Command->Execute(self, event);
-        }
+  for ( Observer *o : dispatchList )
+    {
+    if ( m_ListModified &&
+         std::find(m_Observers.begin(), m_Observers.end(), o) == m_Observers.end() )
+      {
+      continue;
+      }
 
-      return;
+    // Coalesce high-frequency events: only execute the command on
+    // every m_DispatchInterval-th matching event.
+    if ( ++o->m_PendingEventCount < o->m_DispatchInterval )
+      {
+      continue;
       }
+    o->m_PendingEventCount = 0;
 
-    ++i;
+    o->m_Command->Execute(self, event);
     }
+}
 
-  return;
+const std::vector< Observer * > &
+SubjectImplementation::GetDispatchList(const EventObject & event)
+{
+  // The set of observers matched by CheckEvent depends only on the
+  // dynamic type of the invoked event, so the result can be keyed by
+  // that type.
+  auto it = m_DispatchCache.find( std::type_index( typeid( event ) ) );
+  if ( it == m_DispatchCache.end() )
+    {
+    std::vector< Observer * > matches;
+    for (auto & observer : m_Observers)
+      {
+      if ( observer->m_Event->CheckEvent(&event) )
+        {
+        matches.push_back(observer);
+        }
+      }
+    it = m_DispatchCache.emplace( std::type_index( typeid( event ) ),
+                                  std::move(matches) ).first;
+    }
+  return it->second;
 }
 
 Command *
@@ -544,6 +586,16 @@ Object
     }
 }
 
+void
+Object
+::SetObserverDispatchInterval(unsigned long tag, unsigned int interval)
+{
+  if ( this->m_SubjectImplementation )
+    {
+    this->m_SubjectImplementation->SetDispatchInterval(tag, interval);
+    }
+}
+
 void
 Object
 ::InvokeEvent(const EventObject & event)
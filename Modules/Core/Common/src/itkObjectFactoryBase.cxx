@@ -34,6 +34,8 @@
 #include "itkVersion.h"
 #include <cstring>
 #include <algorithm>
+#include <map>
+#include <mutex>
 
 
 namespace itk
@@ -224,6 +226,64 @@ ObjectFactoryBase::GetStrictVersionChecking()
 }
 
 
+namespace
+{
+// Deferred factory registration lists, keyed by the category base class
+// name they provide (e.g. "itkImageIOBase"). Filled during static
+// initialization by the factory register managers, drained on first use
+// of the category.
+using DeferredRegistrationMapType = std::map< std::string, std::list< void (*)() > >;
+
+DeferredRegistrationMapType &
+GetDeferredRegistrationMap()
+{
+  static DeferredRegistrationMapType deferredRegistrations;
+  return deferredRegistrations;
+}
+
+std::mutex &
+GetDeferredRegistrationMutex()
+{
+  static std::mutex deferredRegistrationMutex;
+  return deferredRegistrationMutex;
+}
+}
+
+void
+ObjectFactoryBase
+::RegisterDeferredFactories(const char *categoryClassName, void (**registrationList)())
+{
+  std::lock_guard< std::mutex > lock( GetDeferredRegistrationMutex() );
+  std::list< void (*)() > & queued = GetDeferredRegistrationMap()[categoryClassName];
+  for ( ; *registrationList; ++registrationList )
+    {
+    queued.push_back( *registrationList );
+    }
+}
+
+void
+ObjectFactoryBase
+::ExecuteDeferredRegistration(const char *categoryClassName)
+{
+  std::list< void (*)() > pending;
+    {
+    std::lock_guard< std::mutex > lock( GetDeferredRegistrationMutex() );
+    auto it = GetDeferredRegistrationMap().find( categoryClassName );
+    if ( it == GetDeferredRegistrationMap().end() )
+      {
+      return;
+      }
+    pending.swap( it->second );
+    GetDeferredRegistrationMap().erase( it );
+    }
+  // The registration functions are idempotent, so running a list queued
+  // by several translation units is harmless.
+  for ( void (*registrationFunction)() : pending )
+    {
+    ( *registrationFunction )();
+    }
+}
+
 /**
  * Create an instance of a named ITK object using the loaded
  * factories
@@ -233,6 +293,7 @@ ObjectFactoryBase
 ::CreateInstance(const char *itkclassname)
 {
   ObjectFactoryBase::Initialize();
+  ObjectFactoryBase::ExecuteDeferredRegistration(itkclassname);
   ObjectFactoryBasePrivate * factoryBase = GetObjectFactoryBase();
 
   for (auto & registeredFactory : *factoryBase->m_RegisteredFactories)
@@ -252,6 +313,7 @@ ObjectFactoryBase
 ::CreateAllInstance(const char *itkclassname)
 {
   ObjectFactoryBase::Initialize();
+  ObjectFactoryBase::ExecuteDeferredRegistration(itkclassname);
   ObjectFactoryBasePrivate * factoryBase = GetObjectFactoryBase();
 
   std::list< LightObject::Pointer > created;
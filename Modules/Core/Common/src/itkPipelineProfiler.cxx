@@ -0,0 +1,299 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkPipelineProfiler.h"
+
+#include <algorithm>
+#include <iomanip>
+
+namespace itk
+{
+std::atomic< bool >          PipelineProfiler::m_Enabled( false );
+std::atomic< SizeValueType > PipelineProfiler::m_AllocatedBytes( 0 );
+std::mutex                   PipelineProfiler::m_Mutex;
+std::vector< PipelineProfiler::FilterRecord > PipelineProfiler::m_Records;
+
+namespace
+{
+// Memory accounting registry: live buffers keyed by address, accounts keyed
+// by the filter class name the buffer was charged to.
+struct LiveBuffer
+{
+  std::string   Owner;
+  SizeValueType Bytes;
+};
+
+std::mutex memoryMutex;
+std::map< const void *, LiveBuffer > liveBuffers;
+std::map< std::string, PipelineProfiler::MemoryAccount > memoryAccounts;
+SizeValueType liveBytesTotal = 0;
+SizeValueType peakBytesTotal = 0;
+
+// Stack of filters updating on this thread; mini-pipelines nest.
+thread_local std::vector< std::string > currentFilterStack;
+
+std::string GetCurrentFilterName()
+{
+  if ( currentFilterStack.empty() )
+    {
+    return "(no filter)";
+    }
+  return currentFilterStack.back();
+}
+}
+
+void
+PipelineProfiler
+::SetEnabled(bool enabled)
+{
+  m_Enabled.store( enabled, std::memory_order_relaxed );
+}
+
+bool
+PipelineProfiler
+::GetEnabled()
+{
+  return m_Enabled.load( std::memory_order_relaxed );
+}
+
+void
+PipelineProfiler
+::Clear()
+{
+    {
+    std::lock_guard< std::mutex > lock( m_Mutex );
+    m_Records.clear();
+    m_AllocatedBytes.store( 0, std::memory_order_relaxed );
+    }
+  std::lock_guard< std::mutex > lock( memoryMutex );
+  liveBuffers.clear();
+  memoryAccounts.clear();
+  liveBytesTotal = 0;
+  peakBytesTotal = 0;
+}
+
+std::vector< PipelineProfiler::FilterRecord >
+PipelineProfiler
+::GetRecords()
+{
+  std::lock_guard< std::mutex > lock( m_Mutex );
+  return m_Records;
+}
+
+void
+PipelineProfiler
+::RecordAllocation(SizeValueType bytes)
+{
+  m_AllocatedBytes.fetch_add( bytes, std::memory_order_relaxed );
+}
+
+SizeValueType
+PipelineProfiler
+::GetAllocatedBytes()
+{
+  return m_AllocatedBytes.load( std::memory_order_relaxed );
+}
+
+void
+PipelineProfiler
+::RecordFilterExecution(const FilterRecord & record)
+{
+  std::lock_guard< std::mutex > lock( m_Mutex );
+  m_Records.push_back( record );
+}
+
+void
+PipelineProfiler
+::Report(std::ostream & os)
+{
+  const std::vector< FilterRecord > records = PipelineProfiler::GetRecords();
+
+  const std::ios_base::fmtflags previousFlags = os.flags();
+  const std::streamsize previousPrecision = os.precision();
+
+  os << std::left << std::setw( 45 ) << "Filter"
+     << std::right
+     << std::setw( 12 ) << "Wall (s)"
+     << std::setw( 12 ) << "CPU (s)"
+     << std::setw( 12 ) << "CPU/Wall"
+     << std::setw( 14 ) << "Alloc (MiB)"
+     << std::setw( 11 ) << "WorkUnits" << std::endl;
+
+  os << std::fixed;
+  for ( const FilterRecord & record : records )
+    {
+    const double parallelism = ( record.WallTime > 0.0 ) ?
+      record.CPUTime / record.WallTime : 0.0;
+    os << std::left << std::setw( 45 ) << record.FilterName
+       << std::right << std::setprecision( 6 )
+       << std::setw( 12 ) << record.WallTime
+       << std::setw( 12 ) << record.CPUTime
+       << std::setprecision( 2 )
+       << std::setw( 12 ) << parallelism
+       << std::setw( 14 )
+       << static_cast< double >( record.BytesAllocated ) / ( 1024.0 * 1024.0 )
+       << std::setw( 11 ) << record.NumberOfWorkUnits << std::endl;
+    }
+
+  os.flags( previousFlags );
+  os.precision( previousPrecision );
+}
+
+void
+PipelineProfiler
+::JSONReport(std::ostream & os)
+{
+  const std::vector< FilterRecord > records = PipelineProfiler::GetRecords();
+
+  os << "[\n";
+  for ( size_t i = 0; i < records.size(); ++i )
+    {
+    const FilterRecord & record = records[i];
+    os << "  {\n";
+    os << "    \"FilterName\": \"" << record.FilterName << "\",\n";
+    os << "    \"WallTime\": " << record.WallTime << ",\n";
+    os << "    \"CPUTime\": " << record.CPUTime << ",\n";
+    os << "    \"BytesAllocated\": " << record.BytesAllocated << ",\n";
+    os << "    \"NumberOfWorkUnits\": " << record.NumberOfWorkUnits << "\n";
+    os << "  }" << ( i + 1 < records.size() ? "," : "" ) << "\n";
+    }
+  os << "]" << std::endl;
+}
+
+void
+PipelineProfiler
+::RegisterAllocation(const void * buffer, SizeValueType bytes)
+{
+  m_AllocatedBytes.fetch_add( bytes, std::memory_order_relaxed );
+
+  std::lock_guard< std::mutex > lock( memoryMutex );
+  LiveBuffer & live = liveBuffers[buffer];
+  live.Owner = GetCurrentFilterName();
+  live.Bytes = bytes;
+
+  MemoryAccount & account = memoryAccounts[live.Owner];
+  account.LiveBytes += bytes;
+  account.PeakBytes = std::max( account.PeakBytes, account.LiveBytes );
+  ++account.AllocationCount;
+
+  liveBytesTotal += bytes;
+  peakBytesTotal = std::max( peakBytesTotal, liveBytesTotal );
+}
+
+void
+PipelineProfiler
+::RegisterDeallocation(const void * buffer)
+{
+  std::lock_guard< std::mutex > lock( memoryMutex );
+  auto it = liveBuffers.find( buffer );
+  if ( it == liveBuffers.end() )
+    {
+    return; // allocated before profiling was enabled
+    }
+
+  MemoryAccount & account = memoryAccounts[it->second.Owner];
+  if ( account.LiveBytes >= it->second.Bytes )
+    {
+    account.LiveBytes -= it->second.Bytes;
+    }
+  if ( liveBytesTotal >= it->second.Bytes )
+    {
+    liveBytesTotal -= it->second.Bytes;
+    }
+  liveBuffers.erase( it );
+}
+
+std::map< std::string, PipelineProfiler::MemoryAccount >
+PipelineProfiler
+::GetMemoryAccounts()
+{
+  std::lock_guard< std::mutex > lock( memoryMutex );
+  return memoryAccounts;
+}
+
+SizeValueType
+PipelineProfiler
+::GetLiveBytes()
+{
+  std::lock_guard< std::mutex > lock( memoryMutex );
+  return liveBytesTotal;
+}
+
+SizeValueType
+PipelineProfiler
+::GetPeakBytes()
+{
+  std::lock_guard< std::mutex > lock( memoryMutex );
+  return peakBytesTotal;
+}
+
+void
+PipelineProfiler
+::MemoryReport(std::ostream & os)
+{
+  const std::map< std::string, MemoryAccount > accounts =
+    PipelineProfiler::GetMemoryAccounts();
+
+  const std::ios_base::fmtflags previousFlags = os.flags();
+  const std::streamsize previousPrecision = os.precision();
+
+  constexpr double mebibyte = 1024.0 * 1024.0;
+
+  os << std::left << std::setw( 45 ) << "Filter"
+     << std::right
+     << std::setw( 14 ) << "Live (MiB)"
+     << std::setw( 14 ) << "Peak (MiB)"
+     << std::setw( 13 ) << "Allocations" << std::endl;
+
+  os << std::fixed << std::setprecision( 2 );
+  for ( const auto & account : accounts )
+    {
+    os << std::left << std::setw( 45 ) << account.first
+       << std::right
+       << std::setw( 14 ) << static_cast< double >( account.second.LiveBytes ) / mebibyte
+       << std::setw( 14 ) << static_cast< double >( account.second.PeakBytes ) / mebibyte
+       << std::setw( 13 ) << account.second.AllocationCount << std::endl;
+    }
+
+  os << "High-water mark: "
+     << static_cast< double >( PipelineProfiler::GetPeakBytes() ) / mebibyte
+     << " MiB, currently live: "
+     << static_cast< double >( PipelineProfiler::GetLiveBytes() ) / mebibyte
+     << " MiB" << std::endl;
+
+  os.flags( previousFlags );
+  os.precision( previousPrecision );
+}
+
+void
+PipelineProfiler
+::PushCurrentFilter(const char * name)
+{
+  currentFilterStack.push_back( name ? name : "(no filter)" );
+}
+
+void
+PipelineProfiler
+::PopCurrentFilter()
+{
+  if ( !currentFilterStack.empty() )
+    {
+    currentFilterStack.pop_back();
+    }
+}
+} // end namespace itk
@@ -0,0 +1,166 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkPoolImageAllocator.h"
+
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace
+{
+// Advise the kernel to back a large block with transparent huge pages.
+void
+AdviseHugePages(void * buffer, itk::SizeValueType numberOfBytes)
+{
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  constexpr itk::SizeValueType hugePageSize = 2 * 1024 * 1024;
+  if ( numberOfBytes >= hugePageSize )
+    {
+    madvise( buffer, numberOfBytes, MADV_HUGEPAGE );
+    }
+#else
+  (void)buffer;
+  (void)numberOfBytes;
+#endif
+}
+}
+
+namespace itk
+{
+
+PoolImageAllocator
+::PoolImageAllocator() :
+  m_PoolingThreshold( 1024 * 1024 ),
+  m_MaximumPoolSize( SizeValueType( 4 ) * 1024 * 1024 * 1024 ),
+  m_CachedMemorySize( 0 ),
+  m_ReuseSlackFactor( 1.0 )
+{
+}
+
+PoolImageAllocator
+::~PoolImageAllocator()
+{
+  this->ReleaseCachedMemory();
+}
+
+void *
+PoolImageAllocator
+::Allocate(SizeValueType numberOfBytes)
+{
+  if ( numberOfBytes >= m_PoolingThreshold )
+    {
+    std::lock_guard< std::mutex > lock( m_Mutex );
+
+    // The largest size we are willing to hand out for this request. With
+    // the default slack factor of 1 this only matches exact-size blocks.
+    const auto maximumUsableSize =
+      static_cast< SizeValueType >( static_cast< double >( numberOfBytes ) * m_ReuseSlackFactor );
+
+    FreeListType::iterator it = m_FreeLists.lower_bound( numberOfBytes );
+    while ( it != m_FreeLists.end() && it->first <= maximumUsableSize )
+      {
+      if ( !it->second.empty() )
+        {
+        void * buffer = it->second.back();
+        it->second.pop_back();
+        m_CachedMemorySize -= it->first;
+        if ( it->first != numberOfBytes )
+          {
+          // Remember the real size so Deallocate re-pools it correctly.
+          m_BlockSizes[buffer] = it->first;
+          }
+        if ( it->second.empty() )
+          {
+          m_FreeLists.erase( it );
+          }
+        return buffer;
+        }
+      it = m_FreeLists.erase( it );
+      }
+    }
+
+  void * buffer = ::operator new( numberOfBytes );
+  AdviseHugePages( buffer, numberOfBytes );
+  return buffer;
+}
+
+void
+PoolImageAllocator
+::Deallocate(void * buffer, SizeValueType numberOfBytes)
+{
+  if ( numberOfBytes >= m_PoolingThreshold )
+    {
+    std::lock_guard< std::mutex > lock( m_Mutex );
+
+    // A block handed out with slack is re-pooled under its real size.
+    SizeValueType blockSize = numberOfBytes;
+    const auto sizeIt = m_BlockSizes.find( buffer );
+    if ( sizeIt != m_BlockSizes.end() )
+      {
+      blockSize = sizeIt->second;
+      m_BlockSizes.erase( sizeIt );
+      }
+
+    if ( m_CachedMemorySize + blockSize <= m_MaximumPoolSize )
+      {
+      m_FreeLists[blockSize].push_back( buffer );
+      m_CachedMemorySize += blockSize;
+      return;
+      }
+    }
+  ::operator delete( buffer );
+}
+
+SizeValueType
+PoolImageAllocator
+::GetCachedMemorySize() const
+{
+  std::lock_guard< std::mutex > lock( m_Mutex );
+  return m_CachedMemorySize;
+}
+
+void
+PoolImageAllocator
+::ReleaseCachedMemory()
+{
+  std::lock_guard< std::mutex > lock( m_Mutex );
+  for ( FreeListType::value_type & freeList : m_FreeLists )
+    {
+    for ( void * buffer : freeList.second )
+      {
+      ::operator delete( buffer );
+      }
+    }
+  m_FreeLists.clear();
+  m_CachedMemorySize = 0;
+}
+
+void
+PoolImageAllocator
+::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+  os << indent << "PoolingThreshold: " << m_PoolingThreshold << std::endl;
+  os << indent << "MaximumPoolSize: " << m_MaximumPoolSize << std::endl;
+  os << indent << "ReuseSlackFactor: " << m_ReuseSlackFactor << std::endl;
+  os << indent << "CachedMemorySize: " << this->GetCachedMemorySize() << std::endl;
+}
+
+} // end namespace itk
@@ -166,6 +166,13 @@ PoolMultiThreader
 {
   MultiThreaderBase::HandleFilterProgress(filter, 0.0f);
 
+  const bool collectStatistics = MultiThreaderBase::GetCollectThreadingStatistics();
+  ThreadingStatisticsAccumulator statistics;
+  if ( collectStatistics )
+    {
+    aFunc = statistics.WrapArrayFunctor( aFunc );
+    }
+
   if ( firstIndex + 1 < lastIndexPlus1 )
     {
     SizeValueType chunkSize = ( lastIndexPlus1 - firstIndex ) / m_NumberOfWorkUnits;
@@ -208,6 +215,11 @@ PoolMultiThreader
     }
   // else nothing needs to be executed
 
+  if ( collectStatistics )
+    {
+    statistics.Record( filter );
+    }
+
   MultiThreaderBase::HandleFilterProgress(filter, 1.0f);
 }
 
@@ -222,6 +234,13 @@ PoolMultiThreader
 {
   MultiThreaderBase::HandleFilterProgress(filter, 0.0f);
 
+  const bool collectStatistics = MultiThreaderBase::GetCollectThreadingStatistics();
+  ThreadingStatisticsAccumulator statistics;
+  if ( collectStatistics )
+    {
+    funcP = statistics.WrapRegionFunctor( funcP );
+    }
+
   if ( m_NumberOfWorkUnits == 1 ) // no multi-threading wanted
     {
     funcP( index, size ); //process whole region
@@ -277,6 +296,12 @@ PoolMultiThreader
         }
       }
     }
+
+  if ( collectStatistics )
+    {
+    statistics.Record( filter );
+    }
+
   MultiThreaderBase::HandleFilterProgress(filter, 1.0f);
 }
 
@@ -26,9 +26,14 @@
  *
  *=========================================================================*/
 #include "itkProcessObject.h"
+#include "itkPipelineProfiler.h"
 #include <mutex>
+#include <set>
+#include <thread>
 
+#include <chrono>
 #include <cstdio>
+#include <ctime>
 #include <sstream>
 #include <algorithm>
 
@@ -72,6 +77,8 @@ ProcessObject
 
   m_AbortGenerateData = false;
   m_Progress = 0.0f;
+  m_IncrementalProgressFixedPoint = 0u;
+  m_ProgressEventGranularity = 0.01f;
   m_Updating = false;
 
   DataObjectPointerMap::value_type p("Primary", DataObjectPointer() );
@@ -81,6 +88,8 @@ ProcessObject
   this->Self::SetMultiThreader(MultiThreaderType::New());
 
   m_ReleaseDataBeforeUpdateFlag = true;
+  m_ConcurrentBranchUpdate = false;
+  m_CacheOutputInformation = false;
 }
 
 
@@ -1229,9 +1238,48 @@ ProcessObject
   m_Progress = std::max(progress, 0.0f);
   m_Progress = std::min(m_Progress, 1.0f);
 
+  // Keep the incremental counter in sync so IncrementProgress continues
+  // from the prescribed value.
+  m_IncrementalProgressFixedPoint = static_cast< uint32_t >( m_Progress * 0x1000000 );
+
   this->InvokeEvent( ProgressEvent() );
 }
 
+void
+ProcessObject
+::IncrementProgress(float increment)
+{
+  // 2^24 in fixed point represents complete (1.0) progress.
+  const auto incrementFixedPoint = static_cast< uint32_t >( std::max( increment, 0.0f ) * 0x1000000 );
+  const uint32_t before = m_IncrementalProgressFixedPoint.fetch_add( incrementFixedPoint );
+  const uint32_t after = before + incrementFixedPoint;
+
+  const auto granularityFixedPoint =
+    std::max( static_cast< uint32_t >( m_ProgressEventGranularity * 0x1000000 ), 1u );
+  if ( before / granularityFixedPoint == after / granularityFixedPoint )
+    {
+    // coalesce: no granularity boundary crossed, skip event invocation
+    return;
+    }
+
+  // Publish from one thread at a time; a thread that loses the race
+  // returns immediately and the progress is published at a later crossing.
+  if ( m_ProgressPublicationMutex.try_lock() )
+    {
+    m_Progress = std::min( after / float( 0x1000000 ), 1.0f );
+    try
+      {
+      this->InvokeEvent( ProgressEvent() );
+      }
+    catch ( ... )
+      {
+      m_ProgressPublicationMutex.unlock();
+      throw;
+      }
+    m_ProgressPublicationMutex.unlock();
+    }
+}
+
 
 bool
 ProcessObject
@@ -1341,6 +1389,10 @@ ProcessObject
      << ( this->GetReleaseDataFlag() ? "On" : "Off" ) << std::endl;
   os << indent << "ReleaseDataBeforeUpdateFlag: "
      << ( m_ReleaseDataBeforeUpdateFlag ? "On" : "Off" ) << std::endl;
+  os << indent << "ConcurrentBranchUpdate: "
+     << ( m_ConcurrentBranchUpdate ? "On" : "Off" ) << std::endl;
+  os << indent << "CacheOutputInformation: "
+     << ( m_CacheOutputInformation ? "On" : "Off" ) << std::endl;
   os << indent << "AbortGenerateData: " << ( m_AbortGenerateData ? "On" : "Off" ) << std::endl;
   os << indent << "Progress: " << m_Progress << std::endl;
   os << indent << "Multithreader: " << std::endl;
@@ -1470,6 +1522,31 @@ ProcessObject
     return;
     }
 
+  /**
+   * When caching is enabled, key the current output information on the
+   * modified times visible at this filter: our own MTime plus the
+   * pipeline and object MTimes of the direct inputs. If none of them
+   * is more recent than the last time the information was generated,
+   * another traversal cannot change anything and the walk up the
+   * pipeline is skipped entirely.
+   */
+  if ( m_CacheOutputInformation )
+    {
+    ModifiedTimeType key = this->GetMTime();
+    for (auto & input : m_Inputs)
+      {
+      if ( input.second )
+        {
+        key = std::max( key, input.second->GetPipelineMTime() );
+        key = std::max( key, input.second->GetMTime() );
+        }
+      }
+    if ( key <= m_OutputInformationMTime.GetMTime() )
+      {
+      return;
+      }
+    }
+
   /**
    * Verify that the process object has been configured correctly,
    * that all required inputs are set, and needed parameters are set
@@ -1720,6 +1797,56 @@ ProcessObject
 }
 
 
+namespace
+{
+// Gather the process objects of the upstream subgraph producing the given
+// data object
+void
+CollectUpstreamProcessObjects( DataObject * dataObject, std::set< ProcessObject * > & upstream )
+{
+  if ( dataObject == nullptr )
+    {
+    return;
+    }
+  ProcessObject * source = dataObject->GetSource().GetPointer();
+  if ( source == nullptr || upstream.count(source) )
+    {
+    return;
+    }
+  upstream.insert(source);
+  for ( auto & input : source->GetInputs() )
+    {
+    CollectUpstreamProcessObjects(input.GetPointer(), upstream);
+    }
+}
+} // end anonymous namespace
+
+
+bool
+ProcessObject
+::InputBranchesAreIndependent()
+{
+  std::set< ProcessObject * > visited;
+  for (auto & input : m_Inputs)
+    {
+    if ( !input.second )
+      {
+      continue;
+      }
+    std::set< ProcessObject * > branch;
+    CollectUpstreamProcessObjects(input.second, branch);
+    for ( ProcessObject * upstreamObject : branch )
+      {
+      if ( !visited.insert(upstreamObject).second )
+        {
+        return false;
+        }
+      }
+    }
+  return true;
+}
+
+
 void
 ProcessObject
 ::UpdateOutputData( DataObject * itkNotUsed(output) )
@@ -1751,6 +1878,49 @@ ProcessObject
       this->GetPrimaryInput()->UpdateOutputData();
       }
     }
+  else if ( m_ConcurrentBranchUpdate && this->InputBranchesAreIndependent() )
+    {
+    // The inputs are produced by disjoint upstream subgraphs, so their
+    // updates can run as concurrent tasks. Requests are propagated
+    // serially first since propagation is cheap and order sensitive.
+    std::vector< DataObject * > branchInputs;
+    for (auto & input : m_Inputs)
+      {
+      if ( input.second )
+        {
+        input.second->PropagateRequestedRegion();
+        branchInputs.push_back(input.second);
+        }
+      }
+
+    std::vector< std::exception_ptr > branchExceptions( branchInputs.size(), nullptr );
+    std::vector< std::thread >        branchThreads;
+    for ( size_t branch = 0; branch < branchInputs.size(); ++branch )
+      {
+      branchThreads.emplace_back( [&branchInputs, &branchExceptions, branch]
+        {
+        try
+          {
+          branchInputs[branch]->UpdateOutputData();
+          }
+        catch (...)
+          {
+          branchExceptions[branch] = std::current_exception();
+          }
+        } );
+      }
+    for ( auto & branchThread : branchThreads )
+      {
+      branchThread.join();
+      }
+    for ( auto & branchException : branchExceptions )
+      {
+      if ( branchException )
+        {
+        std::rethrow_exception(branchException);
+        }
+      }
+    }
   else
     {
     for (auto & input : m_Inputs)
@@ -1784,6 +1954,25 @@ ProcessObject
    */
   m_AbortGenerateData = false;
   m_Progress = 0.0f;
+  m_IncrementalProgressFixedPoint = 0u;
+
+  /**
+   * When pipeline profiling is enabled, bracket GenerateData() with
+   * measurements. The flag check is a single relaxed atomic load, so the
+   * disabled path costs nearly nothing.
+   */
+  const bool profiling = PipelineProfiler::GetEnabled();
+  std::chrono::steady_clock::time_point profileStartWall;
+  std::clock_t  profileStartCPU = 0;
+  SizeValueType profileStartBytes = 0;
+  if ( profiling )
+    {
+    // Makes buffer allocations on this thread attributable to this filter
+    PipelineProfiler::PushCurrentFilter( this->GetNameOfClass() );
+    profileStartBytes = PipelineProfiler::GetAllocatedBytes();
+    profileStartCPU = std::clock();
+    profileStartWall = std::chrono::steady_clock::now();
+    }
 
   try
     {
@@ -1791,6 +1980,10 @@ ProcessObject
     }
   catch ( ProcessAborted & )
     {
+    if ( profiling )
+      {
+      PipelineProfiler::PopCurrentFilter();
+      }
     this->InvokeEvent( AbortEvent() );
     this->ResetPipeline();
     this->RestoreInputReleaseDataFlags();
@@ -1798,11 +1991,29 @@ ProcessObject
     }
   catch (...)
     {
+    if ( profiling )
+      {
+      PipelineProfiler::PopCurrentFilter();
+      }
     this->ResetPipeline();
     this->RestoreInputReleaseDataFlags();
     throw;
     }
 
+  if ( profiling )
+    {
+    PipelineProfiler::PopCurrentFilter();
+    PipelineProfiler::FilterRecord record;
+    record.FilterName = this->GetNameOfClass();
+    record.WallTime = std::chrono::duration< double >(
+      std::chrono::steady_clock::now() - profileStartWall ).count();
+    record.CPUTime =
+      static_cast< double >( std::clock() - profileStartCPU ) / CLOCKS_PER_SEC;
+    record.BytesAllocated = PipelineProfiler::GetAllocatedBytes() - profileStartBytes;
+    record.NumberOfWorkUnits = this->GetNumberOfWorkUnits();
+    PipelineProfiler::RecordFilterExecution( record );
+    }
+
   /**
    * If we ended due to aborting, push the progress up to 1.0 (since
    * it probably didn't end there)
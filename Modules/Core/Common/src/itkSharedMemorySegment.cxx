@@ -0,0 +1,156 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkSharedMemorySegment.h"
+
+#if !defined( _WIN32 ) || defined( __CYGWIN__ )
+#define ITK_HAS_POSIX_SHARED_MEMORY
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace itk
+{
+SharedMemorySegment::SharedMemorySegment() = default;
+
+SharedMemorySegment::~SharedMemorySegment()
+{
+  this->Release();
+}
+
+void
+SharedMemorySegment
+::Create(const std::string & name, SizeValueType numberOfBytes)
+{
+  this->Map( name, numberOfBytes, true );
+  m_UnlinkOnDestruction = true;
+}
+
+void
+SharedMemorySegment
+::Open(const std::string & name)
+{
+  this->Map( name, 0, false );
+}
+
+void
+SharedMemorySegment
+::Map(const std::string & name, SizeValueType numberOfBytes, bool create)
+{
+#if defined( ITK_HAS_POSIX_SHARED_MEMORY )
+  this->Release();
+
+  const int flags = create ? ( O_RDWR | O_CREAT | O_EXCL ) : O_RDWR;
+  const int fd = shm_open( name.c_str(), flags, S_IRUSR | S_IWUSR );
+  if ( fd < 0 )
+    {
+    itkExceptionMacro( "Could not " << ( create ? "create" : "open" )
+                       << " shared memory segment \"" << name << "\": "
+                       << std::strerror( errno ) );
+    }
+
+  if ( create )
+    {
+    if ( ftruncate( fd, static_cast< off_t >( numberOfBytes ) ) != 0 )
+      {
+      const int ftruncateError = errno;
+      close( fd );
+      shm_unlink( name.c_str() );
+      itkExceptionMacro( "Could not size shared memory segment \"" << name
+                         << "\" to " << numberOfBytes << " bytes: "
+                         << std::strerror( ftruncateError ) );
+      }
+    }
+  else
+    {
+    struct stat status;
+    if ( fstat( fd, &status ) != 0 )
+      {
+      const int fstatError = errno;
+      close( fd );
+      itkExceptionMacro( "Could not determine the size of shared memory segment \""
+                         << name << "\": " << std::strerror( fstatError ) );
+      }
+    numberOfBytes = static_cast< SizeValueType >( status.st_size );
+    }
+
+  void * buffer = mmap( nullptr, numberOfBytes, PROT_READ | PROT_WRITE,
+                        MAP_SHARED, fd, 0 );
+  // The mapping keeps the segment referenced; the descriptor is not needed.
+  close( fd );
+  if ( buffer == MAP_FAILED )
+    {
+    const int mmapError = errno;
+    if ( create )
+      {
+      shm_unlink( name.c_str() );
+      }
+    itkExceptionMacro( "Could not map shared memory segment \"" << name
+                       << "\": " << std::strerror( mmapError ) );
+    }
+
+  m_Name = name;
+  m_Buffer = buffer;
+  m_NumberOfBytes = numberOfBytes;
+  this->Modified();
+#else
+  (void)numberOfBytes;
+  (void)create;
+  itkExceptionMacro( "Shared memory segment \"" << name
+                     << "\" cannot be mapped: POSIX shared memory is not"
+                     << " available on this platform." );
+#endif
+}
+
+void
+SharedMemorySegment
+::Release()
+{
+#if defined( ITK_HAS_POSIX_SHARED_MEMORY )
+  if ( m_Buffer != nullptr )
+    {
+    munmap( m_Buffer, m_NumberOfBytes );
+    m_Buffer = nullptr;
+    m_NumberOfBytes = 0;
+    }
+  if ( m_UnlinkOnDestruction && !m_Name.empty() )
+    {
+    shm_unlink( m_Name.c_str() );
+    m_UnlinkOnDestruction = false;
+    }
+  m_Name.clear();
+#endif
+}
+
+void
+SharedMemorySegment
+::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf( os, indent );
+
+  os << indent << "Name: " << m_Name << std::endl;
+  os << indent << "Buffer: " << m_Buffer << std::endl;
+  os << indent << "NumberOfBytes: " << m_NumberOfBytes << std::endl;
+  os << indent << "UnlinkOnDestruction: "
+     << ( m_UnlinkOnDestruction ? "On" : "Off" ) << std::endl;
+}
+} // end namespace itk
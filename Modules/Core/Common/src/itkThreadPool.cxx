@@ -33,6 +33,8 @@ namespace itk
     std::mutex          m_Mutex;
     ThreadPool::Pointer m_ThreadPoolInstance;
     bool                m_DoNotWaitForThreads{false};
+    bool                m_ThreadAffinityEnabled{false};
+    bool                m_ThreadAffinityInitialized{false};
   };
 }//end of itk namespace
 
@@ -171,6 +173,57 @@ ThreadPool
   m_ThreadPoolGlobals->m_DoNotWaitForThreads = doNotWaitForThreads;
 }
 
+bool
+ThreadPool
+::GetThreadAffinityEnabled()
+{
+  static ThreadPoolGlobals * threadPoolGlobals = GetThreadPoolGlobals();
+  Unused(threadPoolGlobals);
+  if( !m_ThreadPoolGlobals->m_ThreadAffinityInitialized )
+    {
+    std::string affinityEnv = "";
+    if( itksys::SystemTools::GetEnv( "ITK_THREAD_AFFINITY", affinityEnv ) )
+      {
+      m_ThreadPoolGlobals->m_ThreadAffinityEnabled = ( affinityEnv != "0" && affinityEnv != "" );
+      }
+    m_ThreadPoolGlobals->m_ThreadAffinityInitialized = true;
+    }
+  return m_ThreadPoolGlobals->m_ThreadAffinityEnabled;
+}
+
+void
+ThreadPool
+::SetThreadAffinityEnabled(bool pinThreads)
+{
+  static ThreadPoolGlobals * threadPoolGlobals = GetThreadPoolGlobals();
+  Unused(threadPoolGlobals);
+  m_ThreadPoolGlobals->m_ThreadAffinityEnabled = pinThreads;
+  m_ThreadPoolGlobals->m_ThreadAffinityInitialized = true;
+}
+
+void
+ThreadPool
+::PinThread(std::thread & thread, ThreadIdType threadIndex)
+{
+  const unsigned int processorCount = std::thread::hardware_concurrency();
+  if( processorCount == 0 )
+    {
+    return;
+    }
+  const unsigned int processor = threadIndex % processorCount;
+#if defined(ITK_USE_PTHREADS) && defined(__linux__)
+  cpu_set_t cpuSet;
+  CPU_ZERO( &cpuSet );
+  CPU_SET( processor, &cpuSet );
+  pthread_setaffinity_np( thread.native_handle(), sizeof( cpu_set_t ), &cpuSet );
+#elif defined(ITK_USE_WIN32_THREADS)
+  SetThreadAffinityMask( thread.native_handle(), DWORD_PTR( 1 ) << processor );
+#else
+  Unused( thread );
+  Unused( processor );
+#endif
+}
+
 ThreadPool
 ::ThreadPool()
 
@@ -179,9 +232,14 @@ ThreadPool
   m_ThreadPoolGlobals->m_ThreadPoolInstance->UnRegister(); // Remove extra reference
   ThreadIdType threadCount = ThreadPool::GetGlobalDefaultNumberOfThreads();
   m_Threads.reserve( threadCount );
+  const bool pinThreads = ThreadPool::GetThreadAffinityEnabled();
   for ( unsigned int i = 0; i < threadCount; ++i )
     {
       m_Threads.emplace_back( &ThreadPool::ThreadExecute );
+      if( pinThreads )
+        {
+        PinThread( m_Threads.back(), i );
+        }
     }
 }
 
@@ -269,11 +327,16 @@ void
 ThreadPool
 ::AddThreads(ThreadIdType count)
 {
+  const bool pinThreads = ThreadPool::GetThreadAffinityEnabled();
   std::unique_lock<std::mutex> mutexHolder( m_ThreadPoolGlobals->m_Mutex );
   m_Threads.reserve( m_Threads.size() + count );
   for( unsigned int i = 0; i < count; ++i )
     {
     m_Threads.emplace_back( &ThreadPool::ThreadExecute );
+    if( pinThreads )
+      {
+      PinThread( m_Threads.back(), static_cast< ThreadIdType >( m_Threads.size() - 1 ) );
+      }
     }
 }
 
@@ -330,10 +393,25 @@ ThreadPool
 }
 
 
+namespace
+{
+// Set once in each worker thread, read by IsPoolWorker.
+thread_local bool threadIsPoolWorker = false;
+}
+
+bool
+ThreadPool
+::IsPoolWorker()
+{
+  return threadIsPoolWorker;
+}
+
 void
 ThreadPool
 ::ThreadExecute()
 {
+  threadIsPoolWorker = true;
+
   //plain pointer does not increase reference count
   ThreadPool* threadPool = m_ThreadPoolGlobals->m_ThreadPoolInstance.GetPointer();
 
@@ -0,0 +1,54 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkTotalProgressReporter.h"
+
+namespace itk
+{
+//----------------------------------------------------------------------------
+TotalProgressReporter::TotalProgressReporter(ProcessObject *filter,
+                                             SizeValueType totalNumberOfPixels,
+                                             SizeValueType numberOfUpdates,
+                                             float progressWeight):
+  m_Filter(filter),
+  m_ProgressWeight(progressWeight)
+{
+  // Make sure we have at least one pixel.
+  const float numPixels = (totalNumberOfPixels > 0) ? static_cast<float>(totalNumberOfPixels) : 1.0F;
+  // We cannot update more times than there are pixels.
+  const float numUpdates = (numberOfUpdates > totalNumberOfPixels) ? numPixels : static_cast<float>(numberOfUpdates);
+
+  // Calculate the interval for updates.
+  m_PixelsPerUpdate = static_cast< SizeValueType >( numPixels / numUpdates );
+  m_InverseNumberOfPixels = 1.0f / numPixels;
+
+  m_PixelsBeforeUpdate = m_PixelsPerUpdate;
+}
+
+//----------------------------------------------------------------------------
+TotalProgressReporter::~TotalProgressReporter()
+{
+  // Fold the pixels counted since the last batched update into the
+  // filter, so the aggregate reaches 1.0 once all threads finish.
+  const SizeValueType remainder = m_PixelsPerUpdate - m_PixelsBeforeUpdate;
+  if ( m_Filter && remainder > 0 )
+    {
+    m_Filter->IncrementProgress(
+      static_cast<float>(remainder) * m_InverseNumberOfPixels * m_ProgressWeight);
+    }
+}
+} // end namespace itk
@@ -0,0 +1,190 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkWorkStealingMultiThreader.h"
+#include "itkImageSourceCommon.h"
+#include "itkProcessObject.h"
+#include "itkThreadPool.h"
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace itk
+{
+
+namespace
+{
+/** Per-worker tile deque. The owner pops from the front, thieves steal
+ * from the back, so an owner working through contiguous tiles keeps good
+ * cache locality while thieves take the tiles furthest from it. */
+struct TileDeque
+{
+  std::mutex               Mutex;
+  std::deque<ThreadIdType> Tiles;
+};
+} // end anonymous namespace
+
+WorkStealingMultiThreader::WorkStealingMultiThreader() :
+  m_TileOversubscription( 8 )
+{
+}
+
+WorkStealingMultiThreader::~WorkStealingMultiThreader() = default;
+
+void WorkStealingMultiThreader::SetTileOversubscription( ThreadIdType factor )
+{
+  m_TileOversubscription = std::max< ThreadIdType >( 1, std::min< ThreadIdType >( factor, 64 ) );
+}
+
+void
+WorkStealingMultiThreader
+::ParallelizeImageRegion(
+  unsigned int dimension,
+  const IndexValueType index[],
+  const SizeValueType size[],
+  ThreadingFunctorType funcP,
+  ProcessObject * filter)
+{
+  if ( m_NumberOfWorkUnits == 1 ) // no multi-threading wanted
+    {
+    MultiThreaderBase::HandleFilterProgress( filter, 0.0f );
+    funcP( index, size );
+    MultiThreaderBase::HandleFilterProgress( filter, 1.0f );
+    return;
+    }
+
+  ImageIORegion region( dimension );
+  for ( unsigned int d = 0; d < dimension; d++ )
+    {
+    region.SetIndex( d, index[d] );
+    region.SetSize( d, size[d] );
+    }
+  if ( region.GetNumberOfPixels() <= 1 )
+    {
+    MultiThreaderBase::HandleFilterProgress( filter, 0.0f );
+    funcP( index, size );
+    MultiThreaderBase::HandleFilterProgress( filter, 1.0f );
+    return;
+    }
+
+  MultiThreaderBase::HandleFilterProgress( filter, 0.0f );
+
+  const bool collectStatistics = MultiThreaderBase::GetCollectThreadingStatistics();
+  ThreadingStatisticsAccumulator statistics;
+  if ( collectStatistics )
+    {
+    funcP = statistics.WrapRegionFunctor( funcP );
+    }
+
+  const ImageRegionSplitterBase * splitter = ImageSourceCommon::GetGlobalDefaultSplitter();
+  const ThreadIdType requestedTiles = m_NumberOfWorkUnits * m_TileOversubscription;
+  const ThreadIdType tileCount = splitter->GetNumberOfSplits( region, requestedTiles );
+  const ThreadIdType workerCount = std::min< ThreadIdType >( m_NumberOfWorkUnits, tileCount );
+
+  // Distribute contiguous runs of tiles to the workers' deques up front;
+  // imbalance is corrected by stealing rather than re-splitting.
+  std::vector< TileDeque > deques( workerCount );
+  for ( ThreadIdType tile = 0; tile < tileCount; tile++ )
+    {
+    deques[tile * workerCount / tileCount].Tiles.push_back( tile );
+    }
+
+  std::atomic< SizeValueType > tilesCompleted( 0 );
+  std::atomic< SizeValueType > tilesStolen( 0 );
+
+  auto workerFunction = [&, funcP, tileCount, workerCount]( ThreadIdType workerId )
+    {
+    for (;;)
+      {
+      ThreadIdType tile = 0;
+      bool haveTile = false;
+        {
+        std::lock_guard< std::mutex > lock( deques[workerId].Mutex );
+        if ( !deques[workerId].Tiles.empty() )
+          {
+          tile = deques[workerId].Tiles.front();
+          deques[workerId].Tiles.pop_front();
+          haveTile = true;
+          }
+        }
+      if ( !haveTile ) // own deque exhausted, try to steal from the others
+        {
+        for ( ThreadIdType victim = ( workerId + 1 ) % workerCount;
+              victim != workerId;
+              victim = ( victim + 1 ) % workerCount )
+          {
+          std::lock_guard< std::mutex > lock( deques[victim].Mutex );
+          if ( !deques[victim].Tiles.empty() )
+            {
+            tile = deques[victim].Tiles.back();
+            deques[victim].Tiles.pop_back();
+            haveTile = true;
+            ++tilesStolen;
+            break;
+            }
+          }
+        }
+      if ( !haveTile )
+        {
+        return ITK_THREAD_RETURN_DEFAULT_VALUE; // all deques are empty
+        }
+
+      ImageIORegion tileRegion = region;
+      splitter->GetSplit( tile, tileCount, tileRegion );
+      funcP( &tileRegion.GetIndex()[0], &tileRegion.GetSize()[0] );
+      ++tilesCompleted;
+      }
+    };
+
+  ThreadPool::Pointer threadPool = ThreadPool::GetInstance();
+  std::vector< std::future< ITK_THREAD_RETURN_TYPE > > futures;
+  futures.reserve( workerCount - 1 );
+  for ( ThreadIdType workerId = 1; workerId < workerCount; workerId++ )
+    {
+    futures.push_back( threadPool->AddWork( workerFunction, workerId ) );
+    }
+
+  // The calling thread participates as worker 0
+  workerFunction( 0 );
+
+  for ( ThreadIdType workerId = 1; workerId < workerCount; workerId++ )
+    {
+    futures[workerId - 1].get();
+    if ( filter )
+      {
+      filter->UpdateProgress( tilesCompleted / float( tileCount ) );
+      }
+    }
+
+  if ( collectStatistics )
+    {
+    statistics.AddStolenWorkUnits( tilesStolen );
+    statistics.Record( filter );
+    }
+
+  MultiThreaderBase::HandleFilterProgress( filter, 1.0f );
+}
+
+void WorkStealingMultiThreader::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+  os << indent << "TileOversubscription: " << m_TileOversubscription << std::endl;
+}
+
+}
@@ -0,0 +1,296 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkCachingImageFilter.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkImageRegionConstIteratorWithIndex.h"
+#include "itkImageRegionIterator.h"
+#include "itkImageRegionIteratorWithIndex.h"
+
+#include <iostream>
+
+namespace
+{
+
+using PixelType = unsigned char;
+using ImageType = itk::Image< PixelType, 2 >;
+
+PixelType InputValue( const ImageType::IndexType & index )
+{
+  return static_cast< PixelType >( ( index[0] + 2 * index[1] ) % 200 );
+}
+
+/** An upstream filter that adds a constant and counts how often it is
+ * asked to compute, so cache hits and misses can be observed from the
+ * outside. */
+class ShiftFilter : public itk::ImageToImageFilter< ImageType, ImageType >
+{
+public:
+  ITK_DISALLOW_COPY_AND_ASSIGN(ShiftFilter);
+
+  using Self = ShiftFilter;
+  using Superclass = itk::ImageToImageFilter< ImageType, ImageType >;
+  using Pointer = itk::SmartPointer< Self >;
+
+  itkNewMacro(Self);
+  itkTypeMacro(ShiftFilter, ImageToImageFilter);
+
+  void SetShift(PixelType shift)
+  {
+    if ( shift != m_Shift )
+      {
+      m_Shift = shift;
+      this->Modified();
+      }
+  }
+  PixelType GetShift() const
+  {
+    return m_Shift;
+  }
+
+  unsigned int GetNumberOfGenerateDataCalls() const
+  {
+    return m_NumberOfGenerateDataCalls;
+  }
+
+protected:
+  ShiftFilter() = default;
+
+  void GenerateData() override
+  {
+    m_NumberOfGenerateDataCalls++;
+    this->AllocateOutputs();
+    const ImageType::RegionType region = this->GetOutput()->GetRequestedRegion();
+    itk::ImageRegionConstIterator< ImageType > inIt( this->GetInput(), region );
+    itk::ImageRegionIterator< ImageType > outIt( this->GetOutput(), region );
+    for ( ; !outIt.IsAtEnd(); ++inIt, ++outIt )
+      {
+      outIt.Set( static_cast< PixelType >( inIt.Get() + m_Shift ) );
+      }
+  }
+
+private:
+  PixelType m_Shift{ 0 };
+  unsigned int m_NumberOfGenerateDataCalls{ 0 };
+};
+
+using CachingFilterType = itk::CachingImageFilter< ImageType >;
+
+/** Pull a region through the caching filter and verify its pixels. */
+bool RequestAndCheck( CachingFilterType *cache, const ImageType::RegionType & region,
+                      PixelType shift )
+{
+  ImageType * output = cache->GetOutput();
+
+  output->UpdateOutputInformation();
+  output->SetRequestedRegion( region );
+  output->PropagateRequestedRegion();
+  output->UpdateOutputData();
+
+  itk::ImageRegionConstIteratorWithIndex< ImageType > it( output, region );
+  for ( it.GoToBegin(); !it.IsAtEnd(); ++it )
+    {
+    const auto expected =
+      static_cast< PixelType >( InputValue( it.GetIndex() ) + shift );
+    if ( it.Get() != expected )
+      {
+      std::cerr << "Wrong pixel at " << it.GetIndex() << ": "
+                << static_cast< int >( it.Get() ) << " != "
+                << static_cast< int >( expected ) << std::endl;
+      return false;
+      }
+    }
+  return true;
+}
+
+ImageType::RegionType TileRegion( unsigned int tileX, unsigned int tileY,
+                                  itk::SizeValueType tileLength )
+{
+  ImageType::RegionType region;
+  region.SetIndex( 0, tileX * tileLength );
+  region.SetIndex( 1, tileY * tileLength );
+  region.SetSize( 0, tileLength );
+  region.SetSize( 1, tileLength );
+  return region;
+}
+
+} // end anonymous namespace
+
+int itkCachingImageFilterTest(int, char* [])
+{
+  constexpr itk::SizeValueType tileLength = 32;
+  constexpr itk::SizeValueType tileBytes = tileLength * tileLength * sizeof( PixelType );
+
+  // 4 x 3 whole tiles
+  ImageType::SizeType size = {{128, 96}};
+  ImageType::RegionType largestRegion;
+  largestRegion.SetSize( size );
+
+  ImageType::Pointer input = ImageType::New();
+  input->SetRegions( largestRegion );
+  input->Allocate();
+  itk::ImageRegionIteratorWithIndex< ImageType > inputIt( input, largestRegion );
+  for ( inputIt.GoToBegin(); !inputIt.IsAtEnd(); ++inputIt )
+    {
+    inputIt.Set( InputValue( inputIt.GetIndex() ) );
+    }
+
+  ShiftFilter::Pointer shiftFilter = ShiftFilter::New();
+  shiftFilter->SetInput( input );
+  shiftFilter->SetShift( 7 );
+
+  CachingFilterType::Pointer cache = CachingFilterType::New();
+  cache->SetInput( shiftFilter->GetOutput() );
+  cache->SetTileLength( tileLength );
+
+  // First request covers tiles (0,0), (1,0), (0,1) and (1,1): four misses
+  ImageType::RegionType regionA;
+  regionA.SetIndex( 0, 10 );
+  regionA.SetIndex( 1, 10 );
+  regionA.SetSize( 0, 40 );
+  regionA.SetSize( 1, 30 );
+  if ( !RequestAndCheck( cache, regionA, 7 ) )
+    {
+    return EXIT_FAILURE;
+    }
+  if ( cache->GetCacheMisses() != 4 || cache->GetCacheHits() != 0 )
+    {
+    std::cerr << "Expected 4 misses and 0 hits, got " << cache->GetCacheMisses()
+              << " and " << cache->GetCacheHits() << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // The same request again is served from the cache alone
+  if ( !RequestAndCheck( cache, regionA, 7 ) )
+    {
+    return EXIT_FAILURE;
+    }
+  if ( cache->GetCacheMisses() != 4 || cache->GetCacheHits() != 4 )
+    {
+    std::cerr << "Expected 4 misses and 4 hits, got " << cache->GetCacheMisses()
+              << " and " << cache->GetCacheHits() << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // An overlapping request reuses the cached tiles and computes the rest:
+  // tiles (0..2, 0..1), of which two columns are cached
+  ImageType::RegionType regionB;
+  regionB.SetIndex( 0, 20 );
+  regionB.SetIndex( 1, 20 );
+  regionB.SetSize( 0, 70 );
+  regionB.SetSize( 1, 30 );
+  if ( !RequestAndCheck( cache, regionB, 7 ) )
+    {
+    return EXIT_FAILURE;
+    }
+  if ( cache->GetCacheMisses() != 6 || cache->GetCacheHits() != 8 )
+    {
+    std::cerr << "Expected 6 misses and 8 hits, got " << cache->GetCacheMisses()
+              << " and " << cache->GetCacheHits() << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // every miss is exactly one upstream computation
+  if ( shiftFilter->GetNumberOfGenerateDataCalls() != cache->GetCacheMisses() )
+    {
+    std::cerr << "Upstream pipeline ran " << shiftFilter->GetNumberOfGenerateDataCalls()
+              << " times for " << cache->GetCacheMisses() << " misses." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // Byte budget and eviction order: room for three tiles only
+  cache->FlushCache();
+  if ( cache->GetCacheSizeInBytes() != 0 )
+    {
+    std::cerr << "FlushCache left " << cache->GetCacheSizeInBytes()
+              << " bytes behind." << std::endl;
+    return EXIT_FAILURE;
+    }
+  cache->SetMaximumCacheSizeInBytes( 3 * tileBytes );
+
+  itk::SizeValueType hits = cache->GetCacheHits();
+  itk::SizeValueType misses = cache->GetCacheMisses();
+
+  // load T0, T1, T2, then touch T1 so T0 is the least recently used
+  const ImageType::RegionType tile0 = TileRegion( 0, 0, tileLength );
+  const ImageType::RegionType tile1 = TileRegion( 1, 0, tileLength );
+  const ImageType::RegionType tile2 = TileRegion( 2, 0, tileLength );
+  const ImageType::RegionType tile3 = TileRegion( 3, 0, tileLength );
+  if ( !RequestAndCheck( cache, tile0, 7 )
+       || !RequestAndCheck( cache, tile1, 7 )
+       || !RequestAndCheck( cache, tile2, 7 )
+       || !RequestAndCheck( cache, tile1, 7 ) )
+    {
+    return EXIT_FAILURE;
+    }
+  if ( cache->GetCacheMisses() != misses + 3 || cache->GetCacheHits() != hits + 1 )
+    {
+    std::cerr << "Unexpected counters while filling the budget." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // inserting T3 must evict T0, the least recently used tile, and keep
+  // the cache within the budget
+  if ( !RequestAndCheck( cache, tile3, 7 ) )
+    {
+    return EXIT_FAILURE;
+    }
+  if ( cache->GetCacheSizeInBytes() > cache->GetMaximumCacheSizeInBytes() )
+    {
+    std::cerr << "Cache exceeds its budget: " << cache->GetCacheSizeInBytes()
+              << " bytes." << std::endl;
+    return EXIT_FAILURE;
+    }
+  if ( !RequestAndCheck( cache, tile2, 7 ) || !RequestAndCheck( cache, tile1, 7 ) )
+    {
+    return EXIT_FAILURE;
+    }
+  if ( cache->GetCacheHits() != hits + 3 )
+    {
+    std::cerr << "T1 or T2 were evicted instead of the least recently used tile."
+              << std::endl;
+    return EXIT_FAILURE;
+    }
+  if ( !RequestAndCheck( cache, tile0, 7 ) )
+    {
+    return EXIT_FAILURE;
+    }
+  if ( cache->GetCacheMisses() != misses + 5 )
+    {
+    std::cerr << "T0 was expected to be evicted and recomputed." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // Modifying the upstream pipeline invalidates the cache and the new
+  // values flow through
+  hits = cache->GetCacheHits();
+  misses = cache->GetCacheMisses();
+  shiftFilter->SetShift( 9 );
+  if ( !RequestAndCheck( cache, tile0, 9 ) )
+    {
+    return EXIT_FAILURE;
+    }
+  if ( cache->GetCacheMisses() != misses + 1 || cache->GetCacheHits() != hits )
+    {
+    std::cerr << "Modifying the input did not invalidate the cache." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  std::cout << "Test PASSED." << std::endl;
+  return EXIT_SUCCESS;
+}
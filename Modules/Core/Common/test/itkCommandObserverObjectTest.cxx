@@ -262,6 +262,38 @@ int testCommandRecursiveObject()
 }
 
 
+int testObserverDispatchInterval()
+{
+  // an observer with a dispatch interval only executes on every Nth
+  // matching event
+  itk::Object::Pointer o = itk::Object::New();
+
+  itk::CStyleCommand::Pointer cmd = itk::CStyleCommand::New();
+  cmd->SetCallback(onAny);
+  cmd->SetObjectName("Any Command 1");
+
+  unsigned long id = o->AddObserver(itk::AnyEvent(), cmd);
+  o->SetObserverDispatchInterval(id, 3);
+
+  onAnyCount = 0;
+  for ( unsigned int i = 0; i < 10; ++i )
+    {
+    o->InvokeEvent( itk::AnyEvent() );
+    }
+  TEST_EXPECT_TRUE( onAnyCount == 3 );
+
+  // an interval of 0 is treated as every event
+  o->SetObserverDispatchInterval(id, 0);
+  onAnyCount = 0;
+  o->InvokeEvent( itk::AnyEvent() );
+  TEST_EXPECT_TRUE( onAnyCount == 1 );
+
+  o->RemoveAllObservers();
+
+  return EXIT_SUCCESS;
+}
+
+
 bool testDeleteEventThrow()
 {
   // check the case where an exception in thrown in the DeleteEvent
@@ -284,6 +316,7 @@ int itkCommandObserverObjectTest(int, char* [] )
   ret &= ( testDeleteObserverDuringEvent() == EXIT_SUCCESS );
   ret &= ( testCommandConstObject() == EXIT_SUCCESS );
   ret &= ( testCommandRecursiveObject() == EXIT_SUCCESS );
+  ret &= ( testObserverDispatchInterval() == EXIT_SUCCESS );
   ret &= ( testDeleteEventThrow() == EXIT_SUCCESS );
 
   return ret ? EXIT_SUCCESS : EXIT_FAILURE;
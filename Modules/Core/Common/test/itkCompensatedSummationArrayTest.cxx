@@ -0,0 +1,113 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkCompensatedSummation.h"
+#include "itkCompensatedSummationArray.h"
+
+#include "itkMath.h"
+#include "itkMersenneTwisterRandomVariateGenerator.h"
+
+#include <vector>
+
+int itkCompensatedSummationArrayTest( int, char * [] )
+{
+  using FloatType = float;
+  long int seedValue = 29;
+
+  constexpr itk::SizeValueType arrayLength = 7;
+  constexpr itk::SizeValueType accumSize = 1000000;
+
+  using GeneratorType = itk::Statistics::MersenneTwisterRandomVariateGenerator;
+  GeneratorType::Pointer generator = GeneratorType::New();
+  generator->Initialize( seedValue );
+
+  using ArrayAccumulatorType = itk::CompensatedSummationArray< FloatType >;
+  using ScalarAccumulatorType = itk::CompensatedSummation< FloatType >;
+
+  ArrayAccumulatorType arrayAccumulator( arrayLength );
+  if( arrayAccumulator.GetLength() != arrayLength )
+    {
+    std::cerr << "Unexpected length: " << arrayAccumulator.GetLength() << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // Accumulate the same random sequence with an array of scalar
+  // compensated summations and entrywise with the array version.
+  std::vector< ScalarAccumulatorType > scalarAccumulators( arrayLength );
+  std::vector< FloatType > vanillaSums( arrayLength, 0.0f );
+  FloatType elements[arrayLength];
+  for( itk::SizeValueType ii = 0; ii < accumSize; ++ii )
+    {
+    for( itk::SizeValueType jj = 0; jj < arrayLength; ++jj )
+      {
+      elements[jj] = generator->GetVariate();
+      scalarAccumulators[jj].AddElement( elements[jj] );
+      vanillaSums[jj] += elements[jj];
+      }
+    arrayAccumulator.AddElements( elements );
+    }
+
+  constexpr FloatType expectedMean = 0.5;
+  for( itk::SizeValueType jj = 0; jj < arrayLength; ++jj )
+    {
+    // The array version must reproduce the scalar compensated sums.
+    if( itk::Math::NotExactlyEquals( arrayAccumulator.GetSum( jj ),
+          scalarAccumulators[jj].GetSum() ) )
+      {
+      std::cerr << "Entry " << jj << " differs from the scalar compensated "
+                << "summation: " << arrayAccumulator.GetSum( jj ) << " vs "
+                << scalarAccumulators[jj].GetSum() << std::endl;
+      return EXIT_FAILURE;
+      }
+
+    const FloatType accumulatorMean = arrayAccumulator.GetSum( jj ) /
+      static_cast< FloatType >( accumSize );
+    const FloatType accumulatorError = itk::Math::abs( accumulatorMean - expectedMean );
+    const FloatType vanillaMean = vanillaSums[jj] /
+      static_cast< FloatType >( accumSize );
+    const FloatType vanillaError = itk::Math::abs( vanillaMean - expectedMean );
+    std::cout << "Entry " << jj << ": compensated error " << accumulatorError
+              << ", vanilla error " << vanillaError << std::endl;
+    if( accumulatorError > 1.0e-4 )
+      {
+      std::cerr << "The compensated summation did not compensate well "
+                << "(crazy compiler flags?)." << std::endl;
+      return EXIT_FAILURE;
+      }
+    }
+
+  // Exercise the remaining methods.
+  arrayAccumulator.ResetToZero();
+  for( itk::SizeValueType jj = 0; jj < arrayLength; ++jj )
+    {
+    if( itk::Math::NotExactlyEquals( arrayAccumulator.GetSum( jj ), 0.0f ) )
+      {
+      std::cerr << "ResetToZero failed." << std::endl;
+      return EXIT_FAILURE;
+      }
+    }
+
+  arrayAccumulator.SetLength( 2 );
+  if( arrayAccumulator.GetLength() != 2 )
+    {
+    std::cerr << "SetLength failed." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  std::cout << "Test passed." << std::endl;
+  return EXIT_SUCCESS;
+}
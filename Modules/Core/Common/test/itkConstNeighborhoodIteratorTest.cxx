@@ -412,6 +412,34 @@ int itkConstNeighborhoodIteratorTest(int, char* [] )
 
   } // end "Change Region" test
 
+  //
+  // Test GatherNeighborhood against GetPixel over the whole region,
+  // covering both the contiguous interior path and the boundary path
+  //
+  println("Testing GatherNeighborhood");
+  {
+    radius[0] = 2;
+    radius[1] = 1;
+    radius[2] = 1;
+    radius[3] = 1;
+    IteratorType gather_it(radius, iib_img, iib_img->GetRequestedRegion());
+
+    std::vector<IteratorType::PixelType> gathered( gather_it.Size() );
+    for ( gather_it.GoToBegin(); !gather_it.IsAtEnd(); ++gather_it )
+      {
+      gather_it.GatherNeighborhood( &gathered[0] );
+      for ( unsigned int n = 0; n < gather_it.Size(); ++n )
+        {
+        if ( gathered[n] != gather_it.GetPixel(n) )
+          {
+          std::cerr << "GatherNeighborhood disagrees with GetPixel at index "
+                    << gather_it.GetIndex() << ", element " << n << std::endl;
+          return EXIT_FAILURE;
+          }
+        }
+      }
+  }
+
   return result;
 
 }
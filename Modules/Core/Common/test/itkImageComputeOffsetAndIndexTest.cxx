@@ -107,6 +107,36 @@ void ComputeFastOffset(TImage *image, unsigned int count, unsigned int repeat)
   std::cout << "Last offset: " << offset << ": " << accum << std::endl;
 }
 
+template <typename TImage>
+bool CheckComputeOffsets(TImage *image, unsigned int count)
+{
+  // batched offsets must agree with per-index ComputeOffset
+  std::vector< typename TImage::IndexType >       indices( count );
+  std::vector< typename TImage::OffsetValueType > offsets( count );
+  typename TImage::IndexType index;
+  typename TImage::OffsetType indexIncr;
+  indexIncr.Fill(1);
+  index.Fill(0);
+  for (unsigned int i = 0; i < count; i++)
+    {
+    indices[i] = index;
+    index += indexIncr;
+    }
+
+  image->ComputeOffsets( &indices[0], &offsets[0], count );
+
+  for (unsigned int i = 0; i < count; i++)
+    {
+    if ( offsets[i] != image->ComputeOffset( indices[i] ) )
+      {
+      std::cerr << "ComputeOffsets mismatch at batch element " << i
+                << ": " << offsets[i] << " != " << image->ComputeOffset( indices[i] ) << std::endl;
+      return false;
+      }
+    }
+  return true;
+}
+
 int itkImageComputeOffsetAndIndexTest(int, char* [] )
 {
 
@@ -212,6 +242,7 @@ int itkImageComputeOffsetAndIndexTest(int, char* [] )
   for (unsigned int i = 0; i < dim; i++) totalSize *= size[i]; \
   ComputeOffset<ImageType>(myImage, size[0], totalSize*repeat); \
   collector.Stop("ComputeOffset " #dim"D"); \
+  if (!CheckComputeOffsets<ImageType>(myImage, size[0])) return EXIT_FAILURE; \
   }
 
   TRY_INDEX(1);
@@ -0,0 +1,175 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkPlanarVectorImage.h"
+#include "itkVectorImage.h"
+#include "itkConstNeighborhoodIterator.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkImageRegionConstIteratorWithIndex.h"
+
+#include <iostream>
+
+namespace
+{
+
+using PlanarImageType = itk::PlanarVectorImage< float, 2 >;
+using VectorImageType = itk::VectorImage< float, 2 >;
+using VariableVectorType = itk::VariableLengthVector< float >;
+
+constexpr unsigned int vectorLength = 3;
+
+// deterministic component value for every voxel
+float ComponentValue( const PlanarImageType::IndexType & index, unsigned int component )
+{
+  return static_cast< float >( index[0] + 10 * index[1] + 100 * component );
+}
+
+} // end anonymous namespace
+
+int itkPlanarVectorImageTest(int, char* [])
+{
+  PlanarImageType::SizeType size = {{12, 9}};
+  PlanarImageType::RegionType region;
+  region.SetSize( size );
+
+  // the planar image and an interleaved VectorImage with the same content
+  PlanarImageType::Pointer planarImage = PlanarImageType::New();
+  planarImage->SetRegions( region );
+  planarImage->SetVectorLength( vectorLength );
+  planarImage->Allocate();
+
+  VectorImageType::Pointer vectorImage = VectorImageType::New();
+  vectorImage->SetRegions( region );
+  vectorImage->SetVectorLength( vectorLength );
+  vectorImage->Allocate();
+
+  VariableVectorType fillValue( vectorLength );
+  fillValue.Fill( -1.0f );
+  planarImage->FillBuffer( fillValue );
+
+  itk::ImageRegionConstIteratorWithIndex< PlanarImageType > indexIt( planarImage, region );
+  for ( indexIt.GoToBegin(); !indexIt.IsAtEnd(); ++indexIt )
+    {
+    const PlanarImageType::IndexType index = indexIt.GetIndex();
+    VariableVectorType value( vectorLength );
+    for ( unsigned int i = 0; i < vectorLength; i++ )
+      {
+      value[i] = ComponentValue( index, i );
+      }
+    planarImage->SetPixel( index, value );
+    vectorImage->SetPixel( index, value );
+    }
+
+  // SetPixel / GetPixel round trip, against the VectorImage and the formula
+  for ( indexIt.GoToBegin(); !indexIt.IsAtEnd(); ++indexIt )
+    {
+    const PlanarImageType::IndexType index = indexIt.GetIndex();
+    const VariableVectorType planarValue = planarImage->GetPixel( index );
+    const VariableVectorType vectorValue = vectorImage->GetPixel( index );
+    if ( planarValue.GetSize() != vectorLength )
+      {
+      std::cerr << "Wrong vector length at " << index << std::endl;
+      return EXIT_FAILURE;
+      }
+    for ( unsigned int i = 0; i < vectorLength; i++ )
+      {
+      if ( planarValue[i] != ComponentValue( index, i )
+           || planarValue[i] != vectorValue[i] )
+        {
+        std::cerr << "GetPixel mismatch at " << index << " component " << i
+                  << ": " << planarValue[i] << std::endl;
+        return EXIT_FAILURE;
+        }
+      }
+    // operator[] returns a copy of the same components
+    if ( ( *planarImage )[index] != planarValue )
+      {
+      std::cerr << "operator[] mismatch at " << index << std::endl;
+      return EXIT_FAILURE;
+      }
+    }
+
+  // iterator traversal visits the same pixels in the same order as on
+  // the equivalent VectorImage
+  itk::ImageRegionConstIterator< PlanarImageType > planarIt( planarImage, region );
+  itk::ImageRegionConstIterator< VectorImageType > vectorIt( vectorImage, region );
+  for ( planarIt.GoToBegin(), vectorIt.GoToBegin(); !planarIt.IsAtEnd();
+        ++planarIt, ++vectorIt )
+    {
+    const VariableVectorType planarValue = planarIt.Get();
+    const VariableVectorType vectorValue = vectorIt.Get();
+    if ( planarValue != vectorValue )
+      {
+      std::cerr << "Iterator mismatch: " << planarValue << " != "
+                << vectorValue << std::endl;
+      return EXIT_FAILURE;
+      }
+    }
+  if ( !vectorIt.IsAtEnd() )
+    {
+    std::cerr << "The iterators cover different numbers of pixels." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // the neighborhood accessor gathers the same vectors as on the
+  // equivalent VectorImage, including at the image boundary
+  using PlanarNeighborhoodIteratorType = itk::ConstNeighborhoodIterator< PlanarImageType >;
+  using VectorNeighborhoodIteratorType = itk::ConstNeighborhoodIterator< VectorImageType >;
+  PlanarNeighborhoodIteratorType::RadiusType radius;
+  radius.Fill( 1 );
+  PlanarNeighborhoodIteratorType planarNeighborhoodIt( radius, planarImage, region );
+  VectorNeighborhoodIteratorType vectorNeighborhoodIt( radius, vectorImage, region );
+  const unsigned int neighborhoodSize =
+    static_cast< unsigned int >( planarNeighborhoodIt.Size() );
+  for ( planarNeighborhoodIt.GoToBegin(), vectorNeighborhoodIt.GoToBegin();
+        !planarNeighborhoodIt.IsAtEnd(); ++planarNeighborhoodIt, ++vectorNeighborhoodIt )
+    {
+    if ( planarNeighborhoodIt.GetCenterPixel() != vectorNeighborhoodIt.GetCenterPixel() )
+      {
+      std::cerr << "Neighborhood center mismatch at "
+                << planarNeighborhoodIt.GetIndex() << std::endl;
+      return EXIT_FAILURE;
+      }
+    for ( unsigned int i = 0; i < neighborhoodSize; i++ )
+      {
+      if ( planarNeighborhoodIt.GetPixel(i) != vectorNeighborhoodIt.GetPixel(i) )
+        {
+        std::cerr << "Neighborhood mismatch at " << planarNeighborhoodIt.GetIndex()
+                  << " neighbor " << i << std::endl;
+        return EXIT_FAILURE;
+        }
+      }
+    }
+
+  // a component image view aliases one plane of the buffer
+  PlanarImageType::ComponentImagePointer plane =
+    planarImage->GetComponentImageView( 1 );
+  itk::ImageRegionConstIteratorWithIndex< PlanarImageType::ComponentImageType >
+    planeIt( plane, region );
+  for ( planeIt.GoToBegin(); !planeIt.IsAtEnd(); ++planeIt )
+    {
+    if ( planeIt.Get() != ComponentValue( planeIt.GetIndex(), 1 ) )
+      {
+      std::cerr << "Component view mismatch at " << planeIt.GetIndex() << std::endl;
+      return EXIT_FAILURE;
+      }
+    }
+
+  std::cout << "Test PASSED." << std::endl;
+  return EXIT_SUCCESS;
+}
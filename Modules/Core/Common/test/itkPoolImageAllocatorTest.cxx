@@ -0,0 +1,76 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkPoolImageAllocator.h"
+#include "itkImage.h"
+#include "itkTestingMacros.h"
+
+int itkPoolImageAllocatorTest(int, char* [] )
+{
+  itk::PoolImageAllocator::Pointer allocator = itk::PoolImageAllocator::New();
+  EXERCISE_BASIC_OBJECT_METHODS( allocator, PoolImageAllocator, ImageAllocatorBase );
+
+  allocator->SetPoolingThreshold( 1024 );
+  TEST_SET_GET_VALUE( 1024, allocator->GetPoolingThreshold() );
+
+  // A released block above the threshold must be cached and reused
+  constexpr itk::SizeValueType blockSize = 1024 * 1024;
+  void * block = allocator->Allocate( blockSize );
+  TEST_EXPECT_TRUE( block != nullptr );
+  allocator->Deallocate( block, blockSize );
+  TEST_EXPECT_EQUAL( allocator->GetCachedMemorySize(), blockSize );
+  void * reusedBlock = allocator->Allocate( blockSize );
+  TEST_EXPECT_EQUAL( reusedBlock, block );
+  TEST_EXPECT_EQUAL( allocator->GetCachedMemorySize(), itk::SizeValueType( 0 ) );
+  allocator->Deallocate( reusedBlock, blockSize );
+
+  // Blocks below the threshold are not cached
+  void * smallBlock = allocator->Allocate( 128 );
+  allocator->Deallocate( smallBlock, 128 );
+  TEST_EXPECT_EQUAL( allocator->GetCachedMemorySize(), blockSize );
+
+  allocator->ReleaseCachedMemory();
+  TEST_EXPECT_EQUAL( allocator->GetCachedMemorySize(), itk::SizeValueType( 0 ) );
+
+  // Install as the global allocator and allocate images through it
+  itk::ImageAllocatorBase::SetGlobalDefaultAllocator( allocator );
+
+  using ImageType = itk::Image< float, 3 >;
+  ImageType::SizeType size = { { 64, 64, 64 } };
+  const itk::SizeValueType imageBytes = 64 * 64 * 64 * sizeof( float );
+
+  ImageType::Pointer image = ImageType::New();
+  image->SetRegions( size );
+  image->Allocate( true );
+  const float * firstBuffer = image->GetBufferPointer();
+  TEST_EXPECT_EQUAL( *firstBuffer, 0.0f );
+  image = nullptr; // release; the buffer must land in the pool
+  TEST_EXPECT_EQUAL( allocator->GetCachedMemorySize(), imageBytes );
+
+  ImageType::Pointer reusingImage = ImageType::New();
+  reusingImage->SetRegions( size );
+  reusingImage->Allocate();
+  TEST_EXPECT_EQUAL( reusingImage->GetBufferPointer(), firstBuffer );
+  reusingImage = nullptr;
+
+  itk::ImageAllocatorBase::SetGlobalDefaultAllocator( nullptr );
+  allocator->ReleaseCachedMemory();
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
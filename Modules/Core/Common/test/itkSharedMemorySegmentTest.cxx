@@ -0,0 +1,159 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkSharedMemoryImageExporter.h"
+#include "itkImportImageFilter.h"
+#include "itkImageRegionIteratorWithIndex.h"
+
+#include <iostream>
+
+namespace
+{
+
+using PixelType = unsigned char;
+using ImageType = itk::Image< PixelType, 2 >;
+
+PixelType PixelValue( const ImageType::IndexType & index )
+{
+  return static_cast< PixelType >( ( index[0] + 5 * index[1] ) % 251 );
+}
+
+} // end anonymous namespace
+
+// Single process round trip: create a segment from an image, open it
+// under its name, import it back and compare, then exercise the
+// unlink-on-destruction lifecycle.
+int itkSharedMemorySegmentTest(int, char* [])
+{
+#if defined( _WIN32 ) && !defined( __CYGWIN__ )
+  std::cout << "POSIX shared memory is not available, skipping." << std::endl;
+  return EXIT_SUCCESS;
+#else
+  const std::string segmentName = "/itkSharedMemorySegmentTest";
+
+  ImageType::SizeType size = {{32, 20}};
+  ImageType::RegionType region;
+  region.SetSize( size );
+
+  ImageType::Pointer image = ImageType::New();
+  image->SetRegions( region );
+  image->Allocate();
+  itk::ImageRegionIteratorWithIndex< ImageType > it( image, region );
+  for ( it.GoToBegin(); !it.IsAtEnd(); ++it )
+    {
+    it.Set( PixelValue( it.GetIndex() ) );
+    }
+
+  // export: create the named segment and copy the pixel buffer into it
+  itk::SharedMemorySegment::Pointer exported =
+    itk::SharedMemoryImageExporter< ImageType >::Export( image, segmentName );
+  if ( exported->GetName() != segmentName
+       || exported->GetNumberOfBytes() != size[0] * size[1] * sizeof( PixelType )
+       || exported->GetBufferPointer() == nullptr )
+    {
+    std::cerr << "The exported segment does not describe the image buffer."
+              << std::endl;
+    return EXIT_FAILURE;
+    }
+  if ( !exported->GetUnlinkOnDestruction() )
+    {
+    std::cerr << "The creating process must unlink the name on destruction."
+              << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // open the same name as a consumer would and wrap it into an image
+  itk::SharedMemorySegment::Pointer opened = itk::SharedMemorySegment::New();
+  opened->Open( segmentName );
+  if ( opened->GetNumberOfBytes() != exported->GetNumberOfBytes() )
+    {
+    std::cerr << "The opened segment has " << opened->GetNumberOfBytes()
+              << " bytes instead of " << exported->GetNumberOfBytes() << std::endl;
+    return EXIT_FAILURE;
+    }
+  if ( opened->GetUnlinkOnDestruction() )
+    {
+    std::cerr << "An opening process must leave the name alone." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  using ImportFilterType = itk::ImportImageFilter< PixelType, 2 >;
+  ImportFilterType::Pointer importFilter = ImportFilterType::New();
+  importFilter->SetRegion( region );
+  importFilter->SetSharedMemorySegment( opened );
+  importFilter->Update();
+
+  ImageType::Pointer imported = importFilter->GetOutput();
+  itk::ImageRegionIteratorWithIndex< ImageType > importedIt( imported, region );
+  for ( importedIt.GoToBegin(); !importedIt.IsAtEnd(); ++importedIt )
+    {
+    if ( importedIt.Get() != PixelValue( importedIt.GetIndex() ) )
+      {
+      std::cerr << "Round trip mismatch at " << importedIt.GetIndex() << ": "
+                << static_cast< int >( importedIt.Get() ) << std::endl;
+      return EXIT_FAILURE;
+      }
+    }
+
+  // both mappings alias the same physical pages
+  static_cast< PixelType * >( opened->GetBufferPointer() )[0] = 123;
+  if ( static_cast< PixelType * >( exported->GetBufferPointer() )[0] != 123 )
+    {
+    std::cerr << "A write through the opened mapping is not visible through "
+              << "the exporting one." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // destroying the creator unlinks the name: a new Open() must fail ...
+  exported = nullptr;
+  bool openFailed = false;
+  try
+    {
+    itk::SharedMemorySegment::Pointer lateOpen = itk::SharedMemorySegment::New();
+    lateOpen->Open( segmentName );
+    }
+  catch ( itk::ExceptionObject & )
+    {
+    openFailed = true;
+    }
+  if ( !openFailed )
+    {
+    std::cerr << "Opening an unlinked name did not throw." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // ... while the existing mapping stays valid through the image that
+  // references the segment
+  if ( imported->GetPixel( {{0, 0}} ) != 123 )
+    {
+    std::cerr << "The mapping did not survive the unlink." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // explicit release detaches the mapping
+  opened->Release();
+  if ( opened->GetBufferPointer() != nullptr || opened->GetNumberOfBytes() != 0 )
+    {
+    std::cerr << "Release() did not unmap the segment." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  std::cout << "Test PASSED." << std::endl;
+  return EXIT_SUCCESS;
+#endif
+}
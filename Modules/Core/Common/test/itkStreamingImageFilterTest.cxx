@@ -98,6 +98,31 @@ int itkStreamingImageFilterTest(int, char* [] )
     }
 
 
+  // stream the same pipeline again with double buffering, where the
+  // copy into the output overlaps the next upstream update, and check
+  // that the result is identical
+  itk::StreamingImageFilter<ShortImage, ShortImage>::Pointer bufferedStreamer;
+  bufferedStreamer = itk::StreamingImageFilter<ShortImage, ShortImage>::New();
+  bufferedStreamer->SetInput( monitor->GetOutput() );
+  bufferedStreamer->SetNumberOfStreamDivisions( numberOfStreamDivisions );
+  bufferedStreamer->UseDoubleBufferingOn();
+  bufferedStreamer->Update();
+
+  itk::ImageRegionIterator<ShortImage>
+    serialIt( streamer->GetOutput(), streamer->GetOutput()->GetRequestedRegion() );
+  itk::ImageRegionIterator<ShortImage>
+    bufferedIt( bufferedStreamer->GetOutput(), bufferedStreamer->GetOutput()->GetRequestedRegion() );
+  for (; !serialIt.IsAtEnd() && !bufferedIt.IsAtEnd(); ++serialIt, ++bufferedIt)
+    {
+    if ( serialIt.Get() != bufferedIt.Get() )
+      {
+      std::cout << "Pixel " << bufferedIt.GetIndex()
+                << " differs between serial and double-buffered streaming."
+                << std::endl;
+      return EXIT_FAILURE;
+      }
+    }
+
   //
   // The rest of this code determines whether the shrink code produced
   // the image we expected.
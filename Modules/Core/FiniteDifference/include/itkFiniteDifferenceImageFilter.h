@@ -337,12 +337,13 @@ protected:
   double m_RMSChange;
   double m_MaximumRMSError;
 
-private:
   /** Initialize the values of the Function coefficients. This function will
    * also take care of checking whether the image spacing should be taken into
-   * account or not. */
+   * account or not.  Made available to subclasses that drive the
+   * iterations themselves. */
   void InitializeFunctionCoefficients();
 
+private:
   /** Control whether derivatives use spacing of the input image in
       its calculation. */
   bool m_UseImageSpacing;
@@ -95,6 +95,23 @@ public:
   /** actual CPU->GPU memory copy takes place here */
   virtual void UpdateGPUBuffer();
 
+  /** Route transfers through a pinned (CL_MEM_ALLOC_HOST_PTR) staging
+   * buffer and enqueue them asynchronously. Pinned memory reaches full
+   * PCIe bandwidth, and a CPU->GPU copy returns as soon as the data has
+   * been staged, so the host can enqueue the kernels that consume the
+   * buffer while the transfer is still in flight; the in-order command
+   * queue keeps transfers and kernels correctly ordered on the device. */
+  void SetUsePinnedTransferBuffers( bool flag );
+
+  bool GetUsePinnedTransferBuffers() {
+    return m_UsePinnedTransferBuffers;
+  }
+
+  /** Wait until the last asynchronous transfer of this buffer has
+   * completed. Called automatically before the staging buffer is reused
+   * or released. */
+  void WaitForTransfer();
+
   void Allocate();
 
   void SetCurrentCommandQueue( int queueid );
@@ -122,6 +139,12 @@ protected:
   ~GPUDataManager() override;
   void PrintSelf(std::ostream & os, Indent indent) const override;
 
+  /** allocate and persistently map the pinned host staging buffer */
+  void AllocatePinnedBuffer();
+
+  /** release the staging buffer and any pending transfer event */
+  void ReleasePinnedBuffer();
+
 protected:
   /* NOTE: ivars are protected instead of private to improve performance access in child classes*/
 
@@ -138,6 +161,13 @@ protected:
   cl_mem m_GPUBuffer;
   void*  m_CPUBuffer;
 
+  /** pinned host staging buffer for asynchronous transfers */
+  bool     m_UsePinnedTransferBuffers;
+  cl_mem   m_PinnedBuffer;
+  void*    m_PinnedHostPointer;
+  unsigned int m_PinnedBufferSize;
+  cl_event m_TransferEvent;
+
   /** checks if buffer needs to be updated */
   bool m_IsGPUBufferDirty;
   bool m_IsCPUBufferDirty;
@@ -18,6 +18,8 @@
 #ifndef itkGPUFunctorBase_h
 #define itkGPUFunctorBase_h
 
+#include <string>
+
 #include "itkGPUKernelManager.h"
 
 namespace itk
@@ -46,6 +48,34 @@ public:
    * \return Current argument index to set additional arguments in the GPU kernel. */
   virtual int SetGPUKernelArguments(GPUKernelManager::Pointer KernelManager, int KernelHandle) = 0;
 
+  /** OpenCL declarations of the scalar parameters of this functor for a
+   * fused kernel, each of the form "float <prefix><name>, " with a
+   * trailing separator. The prefix keeps the names of the chained
+   * functors from colliding. Returns an empty string when the functor
+   * does not support kernel fusion. */
+  virtual std::string GetOpenCLParameterDeclarations( const std::string & itkNotUsed(prefix) ) const
+  {
+    return std::string();
+  }
+
+  /** OpenCL expression evaluating this functor for one pixel inside a
+   * fused kernel. The expression reads the float variable 'value' and
+   * the parameters declared by GetOpenCLParameterDeclarations. Returns
+   * an empty string when the functor does not support kernel fusion. */
+  virtual std::string GetOpenCLFunction( const std::string & itkNotUsed(prefix) ) const
+  {
+    return std::string();
+  }
+
+  /** Set the arguments declared by GetOpenCLParameterDeclarations in a
+   * fused kernel, starting at the given argument index.
+   * \return Next free argument index. */
+  virtual int SetFusedGPUKernelArguments( GPUKernelManager::Pointer itkNotUsed(KernelManager),
+                                          int itkNotUsed(KernelHandle), int argumentIndex )
+  {
+    return argumentIndex;
+  }
+
 };
 
 } // end of namespace Functor
@@ -0,0 +1,231 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkGPUFusedFunctorImageFilter_hxx
+#define itkGPUFusedFunctorImageFilter_hxx
+
+#include "itkGPUFusedFunctorImageFilter.h"
+
+namespace itk
+{
+
+template< typename TInputImage, typename TOutputImage >
+GPUFusedFunctorImageFilter< TInputImage, TOutputImage >
+::GPUFusedFunctorImageFilter()
+{
+  if(TInputImage::ImageDimension > 3)
+    {
+    itkExceptionMacro("GPUFusedFunctorImageFilter supports 1/2/3D image.");
+    }
+}
+
+template< typename TInputImage, typename TOutputImage >
+void
+GPUFusedFunctorImageFilter< TInputImage, TOutputImage >
+::AddFunctor(Functor::GPUFunctorBase* functor)
+{
+  if( functor == nullptr )
+    {
+    itkExceptionMacro("Cannot add a null functor to the fused chain.");
+    }
+  if( functor->GetOpenCLFunction("s_").empty() )
+    {
+    itkExceptionMacro("The functor does not support kernel fusion: "
+                      "GetOpenCLFunction() returned an empty snippet.");
+    }
+  m_Functors.push_back(functor);
+  m_FusedKernelOutOfDate = true;
+  this->Modified();
+}
+
+template< typename TInputImage, typename TOutputImage >
+void
+GPUFusedFunctorImageFilter< TInputImage, TOutputImage >
+::ClearFunctors()
+{
+  if( !m_Functors.empty() )
+    {
+    m_Functors.clear();
+    m_FusedKernelOutOfDate = true;
+    this->Modified();
+    }
+}
+
+template< typename TInputImage, typename TOutputImage >
+void
+GPUFusedFunctorImageFilter< TInputImage, TOutputImage >
+::BuildFusedKernel()
+{
+  std::ostringstream defines;
+
+  std::vector<std::string> validTypes;
+  validTypes.push_back( "unsigned char" );
+  validTypes.push_back( "unsigned short" );
+  validTypes.push_back( "char" );
+  validTypes.push_back( "int" );
+  validTypes.push_back( "unsigned int" );
+  validTypes.push_back( "float" );
+  validTypes.push_back( "double" );
+
+  std::string inTypeName;
+  std::string outTypeName;
+  if( !GetValidTypename(typeid( typename TInputImage::PixelType ), validTypes, inTypeName)
+      || !GetValidTypename(typeid( typename TOutputImage::PixelType ), validTypes, outTypeName) )
+    {
+    itkExceptionMacro("GPUFusedFunctorImageFilter does not support the image pixel type.");
+    }
+
+  defines << "#define InPixelType " << inTypeName << "\n";
+  defines << "#define OutPixelType " << outTypeName << "\n";
+
+  const unsigned int dimension = TInputImage::ImageDimension;
+
+  // Generate one kernel reading each pixel once, applying the functor
+  // expressions in order on a float carrier value
+  std::ostringstream source;
+  source << "__kernel void FusedFunctorFilter(";
+  for( size_t i = 0; i < m_Functors.size(); i++ )
+    {
+    std::ostringstream prefix;
+    prefix << "s" << i << "_";
+    source << m_Functors[i]->GetOpenCLParameterDeclarations( prefix.str() );
+    }
+  source << "__global const InPixelType* in, __global OutPixelType* out";
+  for( unsigned int d = 0; d < dimension; d++ )
+    {
+    source << ", int size" << d;
+    }
+  source << ")\n{\n";
+  for( unsigned int d = 0; d < dimension; d++ )
+    {
+    source << "  int gi" << d << " = get_global_id(" << d << ");\n";
+    }
+  // flattened bound checks, deeply nested conditionals are known to
+  // break some OpenCL compilers
+  source << "  bool isValid = true;\n";
+  for( unsigned int d = 0; d < dimension; d++ )
+    {
+    source << "  if(gi" << d << " < 0 || gi" << d << " >= size" << d << ") isValid = false;\n";
+    }
+  source << "  if( isValid )\n  {\n";
+  if( dimension == 1 )
+    {
+    source << "    unsigned int gidx = gi0;\n";
+    }
+  else if( dimension == 2 )
+    {
+    source << "    unsigned int gidx = size0*gi1 + gi0;\n";
+    }
+  else
+    {
+    source << "    unsigned int gidx = size0*(gi2*size1 + gi1) + gi0;\n";
+    }
+  source << "    float value = (float)in[gidx];\n";
+  for( size_t i = 0; i < m_Functors.size(); i++ )
+    {
+    std::ostringstream prefix;
+    prefix << "s" << i << "_";
+    source << "    value = " << m_Functors[i]->GetOpenCLFunction( prefix.str() ) << ";\n";
+    }
+  source << "    out[gidx] = (OutPixelType)value;\n  }\n}\n";
+
+  // load and build program
+  if( !this->m_GPUKernelManager->LoadProgramFromString( source.str().c_str(), defines.str().c_str() ) )
+    {
+    itkExceptionMacro("Failed to build the fused GPU kernel.");
+    }
+
+  // create kernel
+  m_FusedFunctorImageFilterGPUKernelHandle = this->m_GPUKernelManager->CreateKernel("FusedFunctorFilter");
+
+  m_FusedKernelOutOfDate = false;
+}
+
+template< typename TInputImage, typename TOutputImage >
+void
+GPUFusedFunctorImageFilter< TInputImage, TOutputImage >
+::GPUGenerateData()
+{
+  if( m_Functors.empty() )
+    {
+    itkExceptionMacro("No functor was added to the fused chain.");
+    }
+
+  if( m_FusedKernelOutOfDate )
+    {
+    this->BuildFusedKernel();
+    }
+
+  using GPUInputImage = typename itk::GPUTraits< TInputImage >::Type;
+  using GPUOutputImage = typename itk::GPUTraits< TOutputImage >::Type;
+
+  typename GPUInputImage::Pointer  inPtr = dynamic_cast< GPUInputImage * >( this->ProcessObject::GetInput(0) );
+  typename GPUOutputImage::Pointer otPtr = dynamic_cast< GPUOutputImage * >( this->ProcessObject::GetOutput(0) );
+
+  typename GPUOutputImage::SizeType outSize = otPtr->GetLargestPossibleRegion().GetSize();
+
+  int imgSize[3];
+  imgSize[0] = imgSize[1] = imgSize[2] = 1;
+
+  int ImageDim = (int)TInputImage::ImageDimension;
+
+  for(int i=0; i<ImageDim; i++)
+    {
+    imgSize[i] = outSize[i];
+    }
+
+  size_t localSize[3], globalSize[3];
+  localSize[0] = localSize[1] = localSize[2] = OpenCLGetLocalBlockSize(ImageDim);
+  for(int i=0; i<ImageDim; i++)
+    {
+    globalSize[i] = localSize[i]*(unsigned int)ceil( (float)outSize[i]/(float)localSize[i]); // total # of threads
+    }
+
+  // arguments set up using the chained functors
+  int argidx = 0;
+  for( size_t i = 0; i < m_Functors.size(); i++ )
+    {
+    argidx = m_Functors[i]->SetFusedGPUKernelArguments(this->m_GPUKernelManager,
+                                                       m_FusedFunctorImageFilterGPUKernelHandle, argidx);
+    }
+  // arguments set up
+  this->m_GPUKernelManager->SetKernelArgWithImage(m_FusedFunctorImageFilterGPUKernelHandle, argidx++,
+                                                  inPtr->GetGPUDataManager() );
+  this->m_GPUKernelManager->SetKernelArgWithImage(m_FusedFunctorImageFilterGPUKernelHandle, argidx++,
+                                                  otPtr->GetGPUDataManager() );
+  for(int i=0; i<(int)TInputImage::ImageDimension; i++)
+    {
+    this->m_GPUKernelManager->SetKernelArg(m_FusedFunctorImageFilterGPUKernelHandle, argidx++, sizeof(int),
+                                           &(imgSize[i]) );
+    }
+
+  // launch kernel
+  this->m_GPUKernelManager->LaunchKernel(m_FusedFunctorImageFilterGPUKernelHandle, ImageDim, globalSize, localSize );
+}
+
+template< typename TInputImage, typename TOutputImage >
+void
+GPUFusedFunctorImageFilter< TInputImage, TOutputImage >
+::PrintSelf(std::ostream & os, Indent indent) const
+{
+  GPUSuperclass::PrintSelf(os, indent);
+  os << indent << "Number of fused functors: " << m_Functors.size() << std::endl;
+}
+
+} // end of namespace itk
+
+#endif
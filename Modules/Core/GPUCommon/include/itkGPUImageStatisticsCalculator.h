@@ -0,0 +1,128 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkGPUImageStatisticsCalculator_h
+#define itkGPUImageStatisticsCalculator_h
+
+#include "itkObject.h"
+#include "itkGPUImage.h"
+#include "itkGPUReduction.h"
+#include "itkGPUKernelManager.h"
+#include "itkOpenCLUtil.h"
+
+namespace itk
+{
+/**
+ * \class GPUImageStatisticsCalculator
+ *
+ * \brief Computes minimum, maximum, mean, sigma and variance of a GPU
+ * image without copying the image back to the CPU.
+ *
+ * The statistics are computed in a single workgroup-tree reduction pass
+ * over the image buffer resident on the device (the reduceStats6 kernel
+ * in GPUReduction.cl); only one small array of per-workgroup partial
+ * results is read back and folded on the host. This avoids the full
+ * device-to-host image transfer that running StatisticsImageFilter or
+ * MinimumMaximumImageCalculator on a GPU pipeline would trigger.
+ *
+ * The per-workgroup accumulation is carried out in single precision, so
+ * the sum-derived results can differ slightly from the double precision
+ * CPU filters for large images or wide dynamic ranges.
+ *
+ * \ingroup ITKGPUCommon
+ */
+template< typename TImage >
+class ITK_TEMPLATE_EXPORT GPUImageStatisticsCalculator :
+  public Object
+{
+public:
+  ITK_DISALLOW_COPY_AND_ASSIGN(GPUImageStatisticsCalculator);
+
+  /** Standard class type aliases. */
+  using Self = GPUImageStatisticsCalculator;
+  using Superclass = Object;
+  using Pointer = SmartPointer< Self >;
+  using ConstPointer = SmartPointer< const Self >;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(GPUImageStatisticsCalculator, Object);
+
+  /** Image type aliases. */
+  using ImageType = TImage;
+  using ImagePointer = typename ImageType::Pointer;
+  using PixelType = typename ImageType::PixelType;
+  using GPUImageType = typename GPUTraits< TImage >::Type;
+
+  /** Set the input image. The image buffer stays on the device; only
+   * the per-workgroup partial results are transferred back. */
+  itkSetObjectMacro(Image, ImageType);
+
+  /** Compute all of the statistics over the buffered region. */
+  virtual void Compute();
+
+  /** Return the computed statistics. Valid after Compute(). */
+  itkGetConstMacro(Minimum, PixelType);
+  itkGetConstMacro(Maximum, PixelType);
+  itkGetConstMacro(Sum, double);
+  itkGetConstMacro(Mean, double);
+  itkGetConstMacro(Sigma, double);
+  itkGetConstMacro(Variance, double);
+
+  /** Get OpenCL Kernel source as a string, creates a GetOpenCLSource method */
+  itkGetOpenCLSourceFromKernelMacro(GPUReductionKernel);
+
+protected:
+  GPUImageStatisticsCalculator();
+  ~GPUImageStatisticsCalculator() override = default;
+  void PrintSelf(std::ostream & os, Indent indent) const override;
+
+  /** Compile the statistics reduction kernel for the current image
+   * size, reusing the block size selection of GPUReduction. */
+  void BuildStatisticsKernel(unsigned int size);
+
+  GPUKernelManager::Pointer m_GPUKernelManager;
+
+  int m_StatisticsGPUKernelHandle;
+
+  /** Workgroup geometry of the compiled kernel. */
+  int m_NumberOfBlocks;
+  int m_NumberOfThreads;
+
+  /** Number of pixels the kernel was compiled for; the blockSize and
+   * nIsPow2 defines depend on it. */
+  unsigned int m_KernelCompiledForSize;
+
+private:
+  ImagePointer m_Image;
+
+  PixelType m_Minimum;
+  PixelType m_Maximum;
+  double    m_Sum{ 0.0 };
+  double    m_Mean{ 0.0 };
+  double    m_Sigma{ 0.0 };
+  double    m_Variance{ 0.0 };
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#include "itkGPUImageStatisticsCalculator.hxx"
+#endif
+
+#endif
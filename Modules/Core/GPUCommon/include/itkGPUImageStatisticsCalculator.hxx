@@ -0,0 +1,214 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkGPUImageStatisticsCalculator_hxx
+#define itkGPUImageStatisticsCalculator_hxx
+
+#include "itkGPUImageStatisticsCalculator.h"
+
+#include <cmath>
+#include <vector>
+
+namespace itk
+{
+template< typename TImage >
+GPUImageStatisticsCalculator< TImage >
+::GPUImageStatisticsCalculator()
+{
+  /*** Prepare GPU opencl program ***/
+  m_GPUKernelManager = GPUKernelManager::New();
+
+  m_StatisticsGPUKernelHandle = 0;
+  m_NumberOfBlocks = 0;
+  m_NumberOfThreads = 0;
+  m_KernelCompiledForSize = 0;
+
+  m_Image = nullptr;
+
+  m_Minimum = NumericTraits< PixelType >::ZeroValue();
+  m_Maximum = NumericTraits< PixelType >::ZeroValue();
+}
+
+template< typename TImage >
+void
+GPUImageStatisticsCalculator< TImage >
+::BuildStatisticsKernel(unsigned int size)
+{
+  // block size selection as in GPUReduction for the multi-element
+  // kernels: two elements per thread in the first level
+  const int maxThreads = 128;
+  const int maxBlocks = 64;
+
+  unsigned int x = ( size + 1 ) / 2;
+  --x;
+  x |= x >> 1;
+  x |= x >> 2;
+  x |= x >> 4;
+  x |= x >> 8;
+  x |= x >> 16;
+  ++x;
+
+  m_NumberOfThreads = ( size < (unsigned int)( maxThreads * 2 ) ) ? (int)x : maxThreads;
+  m_NumberOfBlocks = ( size + ( m_NumberOfThreads * 2 - 1 ) ) / ( m_NumberOfThreads * 2 );
+  if ( maxBlocks < m_NumberOfBlocks )
+    {
+    m_NumberOfBlocks = maxBlocks;
+    }
+
+  const int isPowOf2 = ( ( size & ( size - 1 ) ) == 0 ) ? 1 : 0;
+
+  std::ostringstream defines;
+
+  defines << "#define blockSize " << m_NumberOfThreads << std::endl;
+  defines << "#define nIsPow2 " << isPowOf2 << std::endl;
+
+  defines << "#define T ";
+  GetTypenameInString( typeid ( PixelType ), defines );
+
+  const char* GPUSource = GPUImageStatisticsCalculator::GetOpenCLSource();
+
+  // load and build program
+  if ( !this->m_GPUKernelManager->LoadProgramFromString( GPUSource, defines.str().c_str() ) )
+    {
+    itkExceptionMacro(<< "Failed to build the statistics reduction kernel.");
+    }
+
+  m_StatisticsGPUKernelHandle = this->m_GPUKernelManager->CreateKernel("reduceStats6");
+
+  m_KernelCompiledForSize = size;
+}
+
+template< typename TImage >
+void
+GPUImageStatisticsCalculator< TImage >
+::Compute()
+{
+  if ( !m_Image )
+    {
+    itkExceptionMacro(<< "No image was set.");
+    }
+
+  auto * gpuImage = dynamic_cast< GPUImageType * >( m_Image.GetPointer() );
+  if ( gpuImage == nullptr )
+    {
+    itkExceptionMacro(<< "The input image is not a GPU image.");
+    }
+
+  const unsigned int size = gpuImage->GetBufferedRegion().GetNumberOfPixels();
+  if ( size == 0 )
+    {
+    itkExceptionMacro(<< "The input image buffer is empty.");
+    }
+
+  // the blockSize and nIsPow2 defines depend on the image size
+  if ( m_KernelCompiledForSize != size )
+    {
+    this->BuildStatisticsKernel(size);
+    }
+
+  // four partial results (min, max, sum, sum of squares) per workgroup
+  std::vector< float > h_odata(4 * m_NumberOfBlocks);
+
+  GPUDataManager::Pointer odata = GPUDataManager::New();
+  odata->SetBufferSize( 4 * m_NumberOfBlocks * sizeof(float) );
+  odata->SetCPUBufferPointer( &h_odata[0] );
+  odata->Allocate();
+  odata->SetCPUDirtyFlag(true);
+
+  cl_int n = size;
+
+  // arguments set up
+  int argidx = 0;
+
+  this->m_GPUKernelManager->SetKernelArgWithImage(m_StatisticsGPUKernelHandle, argidx++,
+                                                  gpuImage->GetGPUDataManager() );
+  this->m_GPUKernelManager->SetKernelArgWithImage(m_StatisticsGPUKernelHandle, argidx++, odata);
+
+  this->m_GPUKernelManager->SetKernelArg(m_StatisticsGPUKernelHandle, argidx++, sizeof(cl_int), &n);
+  //shared memory below
+  this->m_GPUKernelManager->SetKernelArg(m_StatisticsGPUKernelHandle, argidx++,
+                                         4 * sizeof(float) * m_NumberOfThreads, nullptr);
+
+  size_t globalSize[1];
+  size_t localSize[1];
+
+  globalSize[0] = m_NumberOfBlocks * m_NumberOfThreads;
+  localSize[0] = m_NumberOfThreads;
+
+  this->m_GPUKernelManager->LaunchKernel(m_StatisticsGPUKernelHandle, 1, globalSize, localSize );
+
+  odata->SetCPUDirtyFlag(true);
+  const auto * partial = (const float *)odata->GetCPUBufferPointer();
+
+  // fold the per-workgroup partial results on the host in double
+  double minimum = partial[0];
+  double maximum = partial[1];
+  double sum = partial[2];
+  double sumOfSquares = partial[3];
+  for ( int i = 1; i < m_NumberOfBlocks; i++ )
+    {
+    if ( partial[4 * i] < minimum )
+      {
+      minimum = partial[4 * i];
+      }
+    if ( partial[4 * i + 1] > maximum )
+      {
+      maximum = partial[4 * i + 1];
+      }
+    sum += partial[4 * i + 2];
+    sumOfSquares += partial[4 * i + 3];
+    }
+
+  m_Minimum = static_cast< PixelType >( minimum );
+  m_Maximum = static_cast< PixelType >( maximum );
+  m_Sum = sum;
+  m_Mean = sum / (double)size;
+  if ( size > 1 )
+    {
+    m_Variance = ( sumOfSquares - sum * sum / (double)size ) / ( (double)size - 1.0 );
+    if ( m_Variance < 0.0 )
+      {
+      // guard against small negative values from rounding
+      m_Variance = 0.0;
+      }
+    }
+  else
+    {
+    m_Variance = 0.0;
+    }
+  m_Sigma = std::sqrt(m_Variance);
+}
+
+template< typename TImage >
+void
+GPUImageStatisticsCalculator< TImage >
+::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  os << indent << "Minimum: "
+     << static_cast< typename NumericTraits< PixelType >::PrintType >( m_Minimum ) << std::endl;
+  os << indent << "Maximum: "
+     << static_cast< typename NumericTraits< PixelType >::PrintType >( m_Maximum ) << std::endl;
+  os << indent << "Sum: " << m_Sum << std::endl;
+  os << indent << "Mean: " << m_Mean << std::endl;
+  os << indent << "Sigma: " << m_Sigma << std::endl;
+  os << indent << "Variance: " << m_Variance << std::endl;
+}
+} // end namespace itk
+
+#endif
@@ -74,6 +74,14 @@ public:
   itkGetConstMacro(GPUEnabled, bool);
   itkBooleanMacro(GPUEnabled);
 
+  /** When enabled, kernels launched through LaunchKernelAcrossDevices
+   * are partitioned along the slowest-varying axis over all devices of
+   * the OpenCL context instead of running on a single device. Off by
+   * default. */
+  itkSetMacro(MultiDeviceEnabled, bool);
+  itkGetConstMacro(MultiDeviceEnabled, bool);
+  itkBooleanMacro(MultiDeviceEnabled);
+
   void GenerateData() override;
   virtual void GraftOutput(typename itk::GPUTraits< TOutputImage >::Type *output);
   virtual void GraftOutput(const DataObjectIdentifierType & key, typename itk::GPUTraits< TOutputImage >::Type *output);
@@ -89,6 +97,15 @@ protected:
   virtual void GPUGenerateData() {
   }
 
+  /** Launch a kernel split along the slowest-varying axis across the
+   * devices of the context, one chunk per command queue, and wait for
+   * every queue. All devices share the buffers of the context, so
+   * neighborhood kernels read their halo from the input buffer while
+   * each chunk writes a disjoint region of the output. Falls back to a
+   * single launch when multi-device execution is disabled or only one
+   * device is available. */
+  bool LaunchKernelAcrossDevices(int kernelIdx, int dim, size_t *globalWorkSize, size_t *localWorkSize);
+
   // GPU kernel manager
   typename GPUKernelManager::Pointer m_GPUKernelManager;
 
@@ -98,6 +115,7 @@ protected:
 
 private:
   bool m_GPUEnabled;
+  bool m_MultiDeviceEnabled;
 };
 
 } // end namespace itk
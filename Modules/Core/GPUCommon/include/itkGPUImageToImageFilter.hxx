@@ -24,7 +24,8 @@ namespace itk
 {
 
 template< typename TInputImage, typename TOutputImage, typename TParentImageFilter >
-GPUImageToImageFilter< TInputImage, TOutputImage, TParentImageFilter >::GPUImageToImageFilter() : m_GPUEnabled(true)
+GPUImageToImageFilter< TInputImage, TOutputImage, TParentImageFilter >::GPUImageToImageFilter() : m_GPUEnabled(true),
+  m_MultiDeviceEnabled(false)
 {
   m_GPUKernelManager = GPUKernelManager::New();
 }
@@ -41,6 +42,69 @@ GPUImageToImageFilter< TInputImage, TOutputImage, TParentImageFilter >::PrintSel
 {
   Superclass::PrintSelf(os, indent);
   os << indent << "GPU: " << ( m_GPUEnabled ? "Enabled" : "Disabled" ) << std::endl;
+  os << indent << "Multi device: " << ( m_MultiDeviceEnabled ? "Enabled" : "Disabled" ) << std::endl;
+}
+
+template< typename TInputImage, typename TOutputImage, typename TParentImageFilter >
+bool
+GPUImageToImageFilter< TInputImage, TOutputImage, TParentImageFilter >::LaunchKernelAcrossDevices(int kernelIdx,
+                                                                                                  int dim,
+                                                                                                  size_t *globalWorkSize,
+                                                                                                  size_t *localWorkSize)
+{
+  unsigned int numberOfDevices = GPUContextManager::GetInstance()->GetNumberOfCommandQueues();
+
+  // partition the slowest-varying axis in multiples of the local block
+  // size; the kernels guard against indices beyond the image
+  const int    splitAxis = dim - 1;
+  const size_t blockSize = localWorkSize[splitAxis];
+  const size_t numberOfBlocks = globalWorkSize[splitAxis] / blockSize;
+
+  if( numberOfBlocks < (size_t)numberOfDevices )
+    {
+    numberOfDevices = (unsigned int)numberOfBlocks;
+    }
+
+  if( !m_MultiDeviceEnabled || numberOfDevices <= 1 )
+    {
+    return m_GPUKernelManager->LaunchKernel(kernelIdx, dim, globalWorkSize, localWorkSize);
+    }
+
+  const int previousQueue = m_GPUKernelManager->GetCurrentCommandQueueID();
+
+  bool succeeded = true;
+
+  size_t chunkSize[3], chunkOffset[3];
+  for( int i = 0; i < dim; i++ )
+    {
+    chunkSize[i] = globalWorkSize[i];
+    chunkOffset[i] = 0;
+    }
+
+  for( unsigned int device = 0; device < numberOfDevices; device++ )
+    {
+    size_t chunkBlocks = numberOfBlocks / numberOfDevices;
+    if( device < numberOfBlocks % numberOfDevices )
+      {
+      ++chunkBlocks;
+      }
+    chunkSize[splitAxis] = chunkBlocks * blockSize;
+
+    m_GPUKernelManager->SetCurrentCommandQueue( (int)device );
+    succeeded &= m_GPUKernelManager->LaunchKernelWithOffset(kernelIdx, dim, chunkSize, localWorkSize, chunkOffset);
+
+    chunkOffset[splitAxis] += chunkSize[splitAxis];
+    }
+
+  // wait for every device before anything downstream touches the output
+  for( unsigned int device = 0; device < numberOfDevices; device++ )
+    {
+    succeeded &= m_GPUKernelManager->SynchronizeCommandQueue( (int)device );
+    }
+
+  m_GPUKernelManager->SetCurrentCommandQueue(previousQueue);
+
+  return succeeded;
 }
 
 template< typename TInputImage, typename TOutputImage, typename TParentImageFilter >
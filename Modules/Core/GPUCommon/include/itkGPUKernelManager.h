@@ -64,6 +64,16 @@ public:
 
   bool LoadProgramFromString(const char* cSource, const char* cPreamble="");
 
+  /** Directory where compiled OpenCL program binaries are cached on disk,
+   * keyed by device, driver version and source hash. A warm start then
+   * loads programs with clCreateProgramWithBinary instead of paying
+   * clBuildProgram on every process start. Defaults to the
+   * ITK_GPU_PROGRAM_BINARY_CACHE environment variable; an empty string
+   * disables the cache. */
+  static void SetProgramBinaryCacheDirectory(const std::string & directory);
+
+  static std::string GetProgramBinaryCacheDirectory();
+
   int  CreateKernel(const char* kernelName);
 
   cl_int GetKernelWorkGroupInfo(int kernelIdx,
@@ -132,6 +142,18 @@ public:
                       size_t globalWorkSizeX, size_t globalWorkSizeY, size_t globalWorkSizeZ,
                       size_t localWorkSizeX,  size_t localWorkSizeY, size_t localWorkSizeZ );
 
+  /** Enqueue a kernel with a global work offset on the current command
+   * queue without waiting for completion. Used to partition one
+   * logical launch across several devices; the caller synchronizes the
+   * involved queues with SynchronizeCommandQueue once every partial
+   * launch is enqueued. */
+  bool LaunchKernelWithOffset(int kernelIdx, int dim, size_t *globalWorkSize, size_t *localWorkSize,
+                              size_t *globalWorkOffset);
+
+  /** Block until all commands in the given command queue have
+   * completed. */
+  bool SynchronizeCommandQueue(int queueid);
+
   void SetCurrentCommandQueue( int queueid );
 
   int  GetCurrentCommandQueueID();
@@ -144,10 +166,27 @@ protected:
 
   void ResetArguments(int kernelIdx);
 
+  /** Create and build the program from combined preamble + source,
+   * consulting the on-disk binary cache first. */
+  bool BuildProgramFromSource(const char* cSourceString, size_t szFinalLength);
+
+  /** Cache file for the given source on the current device, or an empty
+   * string when the cache is disabled. */
+  std::string GetProgramBinaryCacheFileName(const char* cSourceString, size_t szFinalLength);
+
+  /** Try to create the program from a cached binary. */
+  bool LoadProgramFromBinary(const std::string & cacheFileName);
+
+  /** Store the binary of the built program for later runs. */
+  void SaveProgramBinary(const std::string & cacheFileName);
+
 private:
   cl_program m_Program;
 
   GPUContextManager * m_Manager;
+
+  static std::string m_ProgramBinaryCacheDirectory;
+  static bool        m_ProgramBinaryCacheDirectoryInitialized;
   int                 m_CommandQueueId;
 
   std::vector< cl_kernel >                         m_KernelContainer;
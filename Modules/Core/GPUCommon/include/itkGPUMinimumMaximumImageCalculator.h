@@ -0,0 +1,76 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkGPUMinimumMaximumImageCalculator_h
+#define itkGPUMinimumMaximumImageCalculator_h
+
+#include "itkGPUImageStatisticsCalculator.h"
+
+namespace itk
+{
+/**
+ * \class GPUMinimumMaximumImageCalculator
+ *
+ * \brief GPU replacement for MinimumMaximumImageCalculator keeping the
+ * image resident on the device.
+ *
+ * Provides the familiar ComputeMinimum / ComputeMaximum / Compute calls
+ * on top of GPUImageStatisticsCalculator. The single reduction pass
+ * already produces both extrema, so all three methods are equivalent.
+ * Unlike the CPU calculator, the indices of the extrema are not
+ * reported.
+ *
+ * \ingroup ITKGPUCommon
+ */
+template< typename TInputImage >
+class ITK_TEMPLATE_EXPORT GPUMinimumMaximumImageCalculator :
+  public GPUImageStatisticsCalculator< TInputImage >
+{
+public:
+  ITK_DISALLOW_COPY_AND_ASSIGN(GPUMinimumMaximumImageCalculator);
+
+  /** Standard class type aliases. */
+  using Self = GPUMinimumMaximumImageCalculator;
+  using Superclass = GPUImageStatisticsCalculator< TInputImage >;
+  using Pointer = SmartPointer< Self >;
+  using ConstPointer = SmartPointer< const Self >;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(GPUMinimumMaximumImageCalculator, GPUImageStatisticsCalculator);
+
+  /** Compute the minimum value of the image. */
+  void ComputeMinimum()
+  {
+    this->Compute();
+  }
+
+  /** Compute the maximum value of the image. */
+  void ComputeMaximum()
+  {
+    this->Compute();
+  }
+
+protected:
+  GPUMinimumMaximumImageCalculator() = default;
+  ~GPUMinimumMaximumImageCalculator() override = default;
+};
+} // end namespace itk
+
+#endif
@@ -107,3 +107,72 @@ __kernel void reduce6(__global T *g_idata, __global T *g_odata, unsigned int n,
     // write result for this block to global mem
     if (tid == 0) g_odata[get_group_id(0)] = sdata[0];
 }
+
+/*
+    Workgroup-tree reduction computing minimum, maximum, sum and sum of
+    squares in one pass. Each workgroup writes its four partial results
+    to g_odata[4*group .. 4*group+3]; the small partial array is reduced
+    on the host. The local buffer sdata must hold 4*blockSize floats.
+*/
+__kernel void reduceStats6(__global T *g_idata, __global float *g_odata, unsigned int n, __local volatile float* sdata)
+{
+    unsigned int tid = get_local_id(0);
+    unsigned int i = get_group_id(0)*(get_local_size(0)*2) + get_local_id(0);
+    unsigned int gridSize = blockSize*2*get_num_groups(0);
+
+    __local volatile float* smin = sdata;
+    __local volatile float* smax = sdata + blockSize;
+    __local volatile float* ssum = sdata + 2*blockSize;
+    __local volatile float* ssqr = sdata + 3*blockSize;
+
+    float vmin = INFINITY;
+    float vmax = -INFINITY;
+    float vsum = 0;
+    float vsqr = 0;
+
+    while (i < n)
+    {
+        float v = (float)g_idata[i];
+        vmin = fmin(vmin, v);
+        vmax = fmax(vmax, v);
+        vsum += v;
+        vsqr += v*v;
+        // ensure we don't read out of bounds -- this is optimized away for powerOf2 sized arrays
+        if (nIsPow2 || i + blockSize < n)
+        {
+            v = (float)g_idata[i+blockSize];
+            vmin = fmin(vmin, v);
+            vmax = fmax(vmax, v);
+            vsum += v;
+            vsqr += v*v;
+        }
+        i += gridSize;
+    }
+    smin[tid] = vmin;
+    smax[tid] = vmax;
+    ssum[tid] = vsum;
+    ssqr[tid] = vsqr;
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    // do reduction in shared mem
+    for (unsigned int s = blockSize / 2; s > 0; s >>= 1)
+    {
+        if (tid < s)
+        {
+            smin[tid] = fmin(smin[tid], smin[tid + s]);
+            smax[tid] = fmax(smax[tid], smax[tid + s]);
+            ssum[tid] += ssum[tid + s];
+            ssqr[tid] += ssqr[tid + s];
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+
+    // write the partial results for this block to global mem
+    if (tid == 0)
+    {
+        g_odata[4*get_group_id(0)]     = smin[0];
+        g_odata[4*get_group_id(0) + 1] = smax[0];
+        g_odata[4*get_group_id(0) + 2] = ssum[0];
+        g_odata[4*get_group_id(0) + 3] = ssqr[0];
+    }
+}
@@ -27,12 +27,16 @@ GPUDataManager::GPUDataManager()
   m_ContextManager = GPUContextManager::GetInstance();
   m_GPUBuffer = nullptr;
   m_CPUBuffer = nullptr;
+  m_PinnedBuffer = nullptr;
+  m_PinnedHostPointer = nullptr;
+  m_TransferEvent = nullptr;
 
   this->Initialize();
 }
 
 GPUDataManager::~GPUDataManager()
 {
+  this->ReleasePinnedBuffer();
   if( m_GPUBuffer )
     {
     clReleaseMemObject(m_GPUBuffer);
@@ -49,6 +53,70 @@ void GPUDataManager::SetBufferFlag( cl_mem_flags flags )
   m_MemFlags = flags;
 }
 
+void GPUDataManager::SetUsePinnedTransferBuffers( bool flag )
+{
+  if( m_UsePinnedTransferBuffers != flag )
+    {
+    m_UsePinnedTransferBuffers = flag;
+    if( !flag )
+      {
+      this->ReleasePinnedBuffer();
+      }
+    }
+}
+
+void GPUDataManager::WaitForTransfer()
+{
+  if( m_TransferEvent )
+    {
+    clWaitForEvents(1, &m_TransferEvent);
+    clReleaseEvent(m_TransferEvent);
+    m_TransferEvent = nullptr;
+    }
+}
+
+void GPUDataManager::AllocatePinnedBuffer()
+{
+  if( m_PinnedBuffer && m_PinnedBufferSize == m_BufferSize )
+    {
+    return;
+    }
+
+  this->ReleasePinnedBuffer();
+
+  cl_int errid;
+  m_PinnedBuffer = clCreateBuffer(m_ContextManager->GetCurrentContext(),
+                                  CL_MEM_ALLOC_HOST_PTR, m_BufferSize, nullptr, &errid);
+  OpenCLCheckError(errid, __FILE__, __LINE__, ITK_LOCATION);
+
+  // The mapping is kept for the lifetime of the staging buffer; the
+  // buffer is only ever accessed by the host, transfers use m_GPUBuffer
+  m_PinnedHostPointer = clEnqueueMapBuffer(m_ContextManager->GetCommandQueue(
+                                             m_CommandQueueId), m_PinnedBuffer, CL_TRUE,
+                                           CL_MAP_READ | CL_MAP_WRITE, 0, m_BufferSize, 0, nullptr, nullptr, &errid);
+  OpenCLCheckError(errid, __FILE__, __LINE__, ITK_LOCATION);
+
+  m_PinnedBufferSize = m_BufferSize;
+}
+
+void GPUDataManager::ReleasePinnedBuffer()
+{
+  this->WaitForTransfer();
+
+  if( m_PinnedBuffer )
+    {
+    if( m_PinnedHostPointer )
+      {
+      clEnqueueUnmapMemObject(m_ContextManager->GetCommandQueue(
+                                m_CommandQueueId), m_PinnedBuffer, m_PinnedHostPointer, 0, nullptr, nullptr);
+      m_PinnedHostPointer = nullptr;
+      }
+    clReleaseMemObject(m_PinnedBuffer);
+    m_PinnedBuffer = nullptr;
+    }
+  m_PinnedBufferSize = 0;
+}
+
 void GPUDataManager::Allocate()
 {
   cl_int errid;
@@ -104,9 +172,24 @@ void GPUDataManager::UpdateCPUBuffer()
 #ifdef VERBOSE
     std::cout << this << "::UpdateCPUBuffer GPU->CPU data copy " << m_GPUBuffer << "->" << m_CPUBuffer << std::endl;
 #endif
-    errid = clEnqueueReadBuffer(m_ContextManager->GetCommandQueue(
-                                  m_CommandQueueId), m_GPUBuffer, CL_TRUE, 0, m_BufferSize, m_CPUBuffer, 0, nullptr, nullptr);
-    OpenCLCheckError(errid, __FILE__, __LINE__, ITK_LOCATION);
+    if( m_UsePinnedTransferBuffers )
+      {
+      // Read into the pinned staging buffer at full PCIe bandwidth, then
+      // copy to the pageable CPU buffer. Waiting on the transfer event
+      // also orders this read after any still pending staged write.
+      this->AllocatePinnedBuffer();
+      errid = clEnqueueReadBuffer(m_ContextManager->GetCommandQueue(
+                                    m_CommandQueueId), m_GPUBuffer, CL_FALSE, 0, m_BufferSize, m_PinnedHostPointer, 0, nullptr, &m_TransferEvent);
+      OpenCLCheckError(errid, __FILE__, __LINE__, ITK_LOCATION);
+      this->WaitForTransfer();
+      memcpy(m_CPUBuffer, m_PinnedHostPointer, m_BufferSize);
+      }
+    else
+      {
+      errid = clEnqueueReadBuffer(m_ContextManager->GetCommandQueue(
+                                    m_CommandQueueId), m_GPUBuffer, CL_TRUE, 0, m_BufferSize, m_CPUBuffer, 0, nullptr, nullptr);
+      OpenCLCheckError(errid, __FILE__, __LINE__, ITK_LOCATION);
+      }
 
     m_IsCPUBufferDirty = false;
     }
@@ -122,9 +205,25 @@ void GPUDataManager::UpdateGPUBuffer()
 #ifdef VERBOSE
     std::cout << this << "::UpdateGPUBuffer CPU->GPU data copy " << m_CPUBuffer << "->" << m_GPUBuffer << std::endl;
 #endif
-    errid = clEnqueueWriteBuffer(m_ContextManager->GetCommandQueue(
-                                   m_CommandQueueId), m_GPUBuffer, CL_TRUE, 0, m_BufferSize, m_CPUBuffer, 0, nullptr, nullptr);
-    OpenCLCheckError(errid, __FILE__, __LINE__, ITK_LOCATION);
+    if( m_UsePinnedTransferBuffers )
+      {
+      // Stage the data in pinned memory and return without waiting for
+      // the transfer; kernels enqueued afterwards on the same in-order
+      // command queue are ordered behind the write by the runtime, so
+      // they overlap with the host-side work that launches them
+      this->AllocatePinnedBuffer();
+      this->WaitForTransfer();
+      memcpy(m_PinnedHostPointer, m_CPUBuffer, m_BufferSize);
+      errid = clEnqueueWriteBuffer(m_ContextManager->GetCommandQueue(
+                                     m_CommandQueueId), m_GPUBuffer, CL_FALSE, 0, m_BufferSize, m_PinnedHostPointer, 0, nullptr, &m_TransferEvent);
+      OpenCLCheckError(errid, __FILE__, __LINE__, ITK_LOCATION);
+      }
+    else
+      {
+      errid = clEnqueueWriteBuffer(m_ContextManager->GetCommandQueue(
+                                     m_CommandQueueId), m_GPUBuffer, CL_TRUE, 0, m_BufferSize, m_CPUBuffer, 0, nullptr, nullptr);
+      OpenCLCheckError(errid, __FILE__, __LINE__, ITK_LOCATION);
+      }
 
     m_IsGPUBufferDirty = false;
     }
@@ -222,12 +321,15 @@ void GPUDataManager::Initialize()
     clReleaseMemObject(m_GPUBuffer);
     }
 
+  this->ReleasePinnedBuffer();
+
   m_BufferSize = 0;
   m_GPUBuffer = nullptr;
   m_CPUBuffer = nullptr;
   m_MemFlags  = CL_MEM_READ_WRITE; // default flag
   m_IsGPUBufferDirty = false;
   m_IsCPUBufferDirty = false;
+  m_UsePinnedTransferBuffers = false;
 }
 
   void GPUDataManager::PrintSelf(std::ostream & os, Indent indent) const
@@ -238,6 +340,8 @@ void GPUDataManager::Initialize()
   os << indent << "m_GPUBuffer: " << m_GPUBuffer << std::endl;
   os << indent << "m_IsCPUBufferDirty: " << m_IsCPUBufferDirty << std::endl;
   os << indent << "m_CPUBuffer: " << m_CPUBuffer << std::endl;
+  os << indent << "m_UsePinnedTransferBuffers: " << m_UsePinnedTransferBuffers << std::endl;
+  os << indent << "m_PinnedBuffer: " << m_PinnedBuffer << std::endl;
 }
 
 } // namespace itk
@@ -18,8 +18,20 @@
 
 #include "itkGPUKernelManager.h"
 
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <vector>
+
+#include "itksys/SystemTools.hxx"
+
 namespace itk
 {
+std::string GPUKernelManager::m_ProgramBinaryCacheDirectory;
+bool        GPUKernelManager::m_ProgramBinaryCacheDirectoryInitialized = false;
+
 GPUKernelManager::GPUKernelManager()
 {
   m_Program = nullptr;
@@ -98,78 +110,199 @@ bool GPUKernelManager::LoadProgramFromFile(const char* filename, const char* cPr
 
   cSourceString[szSourceLength + szPreambleLength] = '\0';
 
-  //
-  // Create OpenCL program from source strings
-  //
-  cl_int errid;
-  m_Program = clCreateProgramWithSource(
-      m_Manager->GetCurrentContext(), 1, const_cast<const char **>(&cSourceString), &szFinalLength, &errid);
-  OpenCLCheckError(errid, __FILE__, __LINE__, ITK_LOCATION);
+  const bool built = this->BuildProgramFromSource(cSourceString, szFinalLength);
   free(cSourceString);
 
-  if(errid != CL_SUCCESS)
+  return built;
+}
+
+bool GPUKernelManager::LoadProgramFromString(const char* cSource, const char* cPreamble)
+{
+  size_t szSourceLength;
+  size_t szPreambleLength;
+  size_t szFinalLength;
+
+  szSourceLength = strlen(cSource);
+  szPreambleLength = strlen(cPreamble);
+  szFinalLength = szSourceLength + szPreambleLength;
+
+  // allocate a buffer for the source code string and read it in
+  char* cSourceString = (char *)malloc(szFinalLength + 1);
+  if(szPreambleLength > 0) memcpy(cSourceString, cPreamble, szPreambleLength);
+
+  memcpy(cSourceString + szPreambleLength, cSource, szSourceLength);
+
+
+  cSourceString[szFinalLength] = '\0';
+
+  const bool built = this->BuildProgramFromSource(cSourceString, szFinalLength);
+  free(cSourceString);
+
+  return built;
+}
+
+void GPUKernelManager::SetProgramBinaryCacheDirectory(const std::string & directory)
+{
+  m_ProgramBinaryCacheDirectory = directory;
+  m_ProgramBinaryCacheDirectoryInitialized = true;
+}
+
+std::string GPUKernelManager::GetProgramBinaryCacheDirectory()
+{
+  if( !m_ProgramBinaryCacheDirectoryInitialized )
     {
-    itkWarningMacro("Cannot create GPU program");
-    return false;
+    std::string directory;
+    if( itksys::SystemTools::GetEnv("ITK_GPU_PROGRAM_BINARY_CACHE", directory) )
+      {
+      m_ProgramBinaryCacheDirectory = directory;
+      }
+    m_ProgramBinaryCacheDirectoryInitialized = true;
     }
+  return m_ProgramBinaryCacheDirectory;
+}
 
-  // build program
-  errid = clBuildProgram(m_Program, 0, nullptr, nullptr, nullptr, nullptr);
-  if(errid != CL_SUCCESS)
-    {
-    //itkWarningMacro("OpenCL program build error");
+std::string GPUKernelManager::GetProgramBinaryCacheFileName(const char* cSourceString, size_t szFinalLength)
+{
+  const std::string directory = GetProgramBinaryCacheDirectory();
 
-    // print out build error
-    size_t paramValueSize = 0;
+  if( directory.empty() )
+    {
+    return std::string();
+    }
 
-    // get error message size
-    clGetProgramBuildInfo(m_Program, m_Manager->GetDeviceId(0), CL_PROGRAM_BUILD_LOG, 0, nullptr, &paramValueSize);
+  char deviceName[256] = "";
+  char driverVersion[256] = "";
+  clGetDeviceInfo(m_Manager->GetDeviceId(0), CL_DEVICE_NAME, sizeof(deviceName), deviceName, nullptr);
+  clGetDeviceInfo(m_Manager->GetDeviceId(0), CL_DRIVER_VERSION, sizeof(driverVersion), driverVersion, nullptr);
+
+  // FNV-1a over device name, driver version and the preprocessed source.
+  // Programs are always built without options here, so the options do not
+  // need to enter the key.
+  uint64_t hash = 0xcbf29ce484222325ull;
+  auto hashBytes = [&hash](const char* data, size_t length) {
+      for( size_t i = 0; i < length; i++ )
+        {
+        hash ^= static_cast<unsigned char>( data[i] );
+        hash *= 0x100000001b3ull;
+        }
+    };
+  hashBytes( deviceName, strlen(deviceName) );
+  hashBytes( driverVersion, strlen(driverVersion) );
+  hashBytes( cSourceString, szFinalLength );
+
+  std::ostringstream fileName;
+  fileName << directory << "/itkOpenCLProgram-" << std::hex << hash << ".clbin";
+  return fileName.str();
+}
 
-    char *paramValue;
-    paramValue = (char*)malloc(paramValueSize);
+bool GPUKernelManager::LoadProgramFromBinary(const std::string & cacheFileName)
+{
+  std::ifstream binaryFile(cacheFileName.c_str(), std::ios::in | std::ios::binary);
 
-    // get error message
-    clGetProgramBuildInfo(m_Program, m_Manager->GetDeviceId(0), CL_PROGRAM_BUILD_LOG, paramValueSize, paramValue, nullptr);
+  if( !binaryFile )
+    {
+    return false;
+    }
 
-    /*
-    std::ostringstream itkmsg;
-    itkmsg << "ERROR: In " __FILE__ ", line " << __LINE__ << "\n"
-           << this->GetNameOfClass() << " (" << this << "): "
-           << "OpenCL program build error:" << paramValue
-           << "\n\n";
-    ::itk::OutputWindowDisplayErrorText( itkmsg.str().c_str() );
-    */
+  std::string binary( ( std::istreambuf_iterator<char>( binaryFile ) ),
+                      std::istreambuf_iterator<char>() );
+  if( binary.empty() )
+    {
+    return false;
+    }
 
-    std::cerr << paramValue << std::endl;
+  cl_device_id device = m_Manager->GetDeviceId(0);
+  const size_t binarySize = binary.size();
+  const auto * binaryData = reinterpret_cast<const unsigned char *>( binary.data() );
+  cl_int       binaryStatus = CL_SUCCESS;
+  cl_int       errid;
 
-    free( paramValue );
+  cl_program program = clCreateProgramWithBinary(
+      m_Manager->GetCurrentContext(), 1, &device, &binarySize, &binaryData, &binaryStatus, &errid);
 
-    OpenCLCheckError(errid, __FILE__, __LINE__, ITK_LOCATION);
+  if( errid != CL_SUCCESS || binaryStatus != CL_SUCCESS || program == nullptr )
+    {
+    // stale cache entry, e.g. after a driver update; rebuild from source
+    return false;
+    }
 
+  errid = clBuildProgram(program, 0, nullptr, nullptr, nullptr, nullptr);
+  if( errid != CL_SUCCESS )
+    {
+    clReleaseProgram(program);
     return false;
     }
 
+  m_Program = program;
   return true;
 }
 
-bool GPUKernelManager::LoadProgramFromString(const char* cSource, const char* cPreamble)
+void GPUKernelManager::SaveProgramBinary(const std::string & cacheFileName)
 {
-  size_t szSourceLength;
-  size_t szPreambleLength;
-  size_t szFinalLength;
+  cl_uint numberOfDevices = 0;
+  cl_int  errid = clGetProgramInfo(m_Program, CL_PROGRAM_NUM_DEVICES,
+                                   sizeof(numberOfDevices), &numberOfDevices, nullptr);
 
-  szSourceLength = strlen(cSource);
-  szPreambleLength = strlen(cPreamble);
-  szFinalLength = szSourceLength + szPreambleLength;
+  if( errid != CL_SUCCESS || numberOfDevices == 0 )
+    {
+    return;
+    }
 
-  // allocate a buffer for the source code string and read it in
-  char* cSourceString = (char *)malloc(szFinalLength + 1);
-  if(szPreambleLength > 0) memcpy(cSourceString, cPreamble, szPreambleLength);
+  std::vector<size_t> binarySizes(numberOfDevices, 0);
+  errid = clGetProgramInfo(m_Program, CL_PROGRAM_BINARY_SIZES,
+                           numberOfDevices * sizeof(size_t), &binarySizes[0], nullptr);
+  if( errid != CL_SUCCESS || binarySizes[0] == 0 )
+    {
+    return;
+    }
 
-  memcpy(cSourceString + szPreambleLength, cSource, szSourceLength);
+  // only the binary of the first device is cached, matching the device
+  // the cache key is derived from
+  std::vector< std::vector<unsigned char> > binaries(numberOfDevices);
+  std::vector<unsigned char *>              binaryPointers(numberOfDevices);
+  for( cl_uint i = 0; i < numberOfDevices; i++ )
+    {
+    binaries[i].resize(binarySizes[i] + 1);
+    binaryPointers[i] = &binaries[i][0];
+    }
+  errid = clGetProgramInfo(m_Program, CL_PROGRAM_BINARIES,
+                           numberOfDevices * sizeof(unsigned char *), &binaryPointers[0], nullptr);
+  if( errid != CL_SUCCESS )
+    {
+    return;
+    }
 
+  itksys::SystemTools::MakeDirectory( GetProgramBinaryCacheDirectory() );
 
-  cSourceString[szFinalLength] = '\0';
+  // write to a temporary name first so a concurrent process never reads
+  // a partially written binary
+  const std::string temporaryFileName = cacheFileName + ".tmp";
+  std::ofstream     binaryFile(temporaryFileName.c_str(),
+                               std::ios::out | std::ios::binary | std::ios::trunc);
+  if( !binaryFile )
+    {
+    return;
+    }
+  binaryFile.write( reinterpret_cast<const char *>( binaryPointers[0] ),
+                    static_cast<std::streamsize>( binarySizes[0] ) );
+  binaryFile.close();
+  if( binaryFile.fail() )
+    {
+    itksys::SystemTools::RemoveFile( temporaryFileName );
+    return;
+    }
+  std::rename( temporaryFileName.c_str(), cacheFileName.c_str() );
+}
+
+bool GPUKernelManager::BuildProgramFromSource(const char* cSourceString, size_t szFinalLength)
+{
+  const std::string cacheFileName =
+    this->GetProgramBinaryCacheFileName(cSourceString, szFinalLength);
+
+  if( !cacheFileName.empty() && this->LoadProgramFromBinary(cacheFileName) )
+    {
+    return true;
+    }
 
   //
   // Create OpenCL program from source strings
@@ -178,7 +311,6 @@ bool GPUKernelManager::LoadProgramFromString(const char* cSource, const char* cP
   m_Program = clCreateProgramWithSource(
       m_Manager->GetCurrentContext(), 1, const_cast<const char **>(&cSourceString), &szFinalLength, &errid);
   OpenCLCheckError(errid, __FILE__, __LINE__, ITK_LOCATION);
-  free(cSourceString);
 
   if(errid != CL_SUCCESS)
     {
@@ -222,6 +354,11 @@ bool GPUKernelManager::LoadProgramFromString(const char* cSource, const char* cP
     return false;
     }
 
+  if( !cacheFileName.empty() )
+    {
+    this->SaveProgramBinary(cacheFileName);
+    }
+
   return true;
 }
 
@@ -513,6 +650,46 @@ std::cout << "Wait for kernel execution ends" << std::endl;
   return true;
 }
 
+bool GPUKernelManager::LaunchKernelWithOffset(int kernelIdx, int dim, size_t *globalWorkSize,
+                                              size_t *localWorkSize, size_t *globalWorkOffset)
+{
+  if(kernelIdx < 0 || kernelIdx >= (int)m_KernelContainer.size() ) return false;
+
+  if(!CheckArgumentReady(kernelIdx) )
+    {
+    itkWarningMacro("GPU kernel arguments are not completely assigned");
+    return false;
+    }
+
+  cl_int errid;
+  errid = clEnqueueNDRangeKernel(m_Manager->GetCommandQueue(
+                                   m_CommandQueueId), m_KernelContainer[kernelIdx], (cl_uint)dim, globalWorkOffset,
+                                 globalWorkSize, localWorkSize, 0, nullptr, nullptr);
+  OpenCLCheckError(errid, __FILE__, __LINE__, ITK_LOCATION);
+
+  if(errid != CL_SUCCESS)
+    {
+    itkWarningMacro("GPU kernel launch failed");
+    return false;
+    }
+
+  // only flush so launches on other queues can overlap; the caller
+  // synchronizes the queues when all partial launches are enqueued
+  errid = clFlush(m_Manager->GetCommandQueue(m_CommandQueueId) );
+  OpenCLCheckError(errid, __FILE__, __LINE__, ITK_LOCATION);
+
+  return errid == CL_SUCCESS;
+}
+
+bool GPUKernelManager::SynchronizeCommandQueue(int queueid)
+{
+  cl_int errid = clFinish(m_Manager->GetCommandQueue(queueid) );
+
+  OpenCLCheckError(errid, __FILE__, __LINE__, ITK_LOCATION);
+
+  return errid == CL_SUCCESS;
+}
+
 void GPUKernelManager::SetCurrentCommandQueue( int queueid )
 {
   if( queueid >= 0 && queueid < (int)m_Manager->GetNumberOfCommandQueues() )
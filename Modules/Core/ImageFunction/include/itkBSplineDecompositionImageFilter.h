@@ -28,6 +28,7 @@
 #ifndef itkBSplineDecompositionImageFilter_h
 #define itkBSplineDecompositionImageFilter_h
 
+#include <type_traits>
 #include <vector>
 
 #include "itkImageLinearIteratorWithIndex.h"
@@ -156,6 +157,25 @@ private:
    *    of spline coefficients. */
   void DataToCoefficientsND();
 
+  /** Whether the coefficients image can be processed through raw
+   * buffer pointers, which is not the case for VectorImage and the
+   * image adaptors, whose internal pixel type differs from their
+   * PixelType. */
+  using RawBufferAccessIsPossibleType =
+    std::integral_constant< bool,
+      std::is_same< typename TOutputImage::InternalPixelType,
+                    typename TOutputImage::PixelType >::value >;
+
+  /** Filters bundles of adjacent lines together.  The recursive
+   * filtering is independent per line, so keeping the bundle
+   * interleaved in scratch lets the recursions run vectorized across
+   * the bundle, and gathering a bundle reads every fetched cache line
+   * in full even along strided axes.  The false_type overload keeps
+   * the one line at a time processing for images without raw buffer
+   * access. */
+  void BundledDataToCoefficientsND(std::true_type rawBufferAccessIsPossible);
+  void BundledDataToCoefficientsND(std::false_type rawBufferAccessIsPossible);
+
   /** Determines the first coefficient for the causal filtering of the data. */
   virtual void SetInitialCausalCoefficient(double z);
 
@@ -33,6 +33,9 @@
 #include "itkProgressReporter.h"
 #include "itkVector.h"
 
+#include <algorithm>  // For min.
+#include <cmath>      // For ceil, fabs, log and pow.
+
 namespace itk
 {
 
@@ -250,6 +253,288 @@ template< typename TInputImage, typename TOutputImage >
 void
 BSplineDecompositionImageFilter< TInputImage, TOutputImage >
 ::DataToCoefficientsND()
+{
+  this->BundledDataToCoefficientsND( RawBufferAccessIsPossibleType() );
+}
+
+template< typename TInputImage, typename TOutputImage >
+void
+BSplineDecompositionImageFilter< TInputImage, TOutputImage >
+::BundledDataToCoefficientsND(std::true_type itkNotUsed(rawBufferAccessIsPossible))
+{
+  using OutputPixelType = typename TOutputImage::PixelType;
+
+  OutputImagePointer output = this->GetOutput();
+
+  const typename TOutputImage::RegionType region = output->GetBufferedRegion();
+  const typename TOutputImage::IndexType  regionIndex = region.GetIndex();
+
+  Size< ImageDimension > size = region.GetSize();
+
+  const SizeValueType numberOfPixels = region.GetNumberOfPixels();
+
+  const OffsetValueType *offsetTable = output->GetOffsetTable();
+  OutputPixelType *      buffer = output->GetBufferPointer();
+
+  // Number of adjacent lines filtered together.
+  const unsigned int bundleWidth = 8;
+
+  // Initialize coeffient array
+  this->CopyImageToImage();   // Coefficients are initialized to the input data
+
+  // Count the bundles for progress reporting
+  SizeValueType count = 0;
+  for ( unsigned int n = 0; n < ImageDimension; n++ )
+    {
+    if ( size[n] == 1 )
+      {
+      continue;
+      }
+    const unsigned int bundleAxis = ( n == 0 && ImageDimension > 1 ) ? 1 : 0;
+    if ( bundleAxis == n )
+      {
+      count += 1;
+      }
+    else
+      {
+      count += numberOfPixels / size[n] / size[bundleAxis]
+               * ( ( size[bundleAxis] + bundleWidth - 1 ) / bundleWidth );
+      }
+    }
+  if ( count == 0 )
+    {
+    count = 1;
+    }
+
+  ProgressReporter progress(this, 0, count, 10);
+
+  std::vector< CoeffType > bundle;
+
+  // Loop through each dimension
+  for ( unsigned int n = 0; n < ImageDimension; n++ )
+    {
+    if ( size[n] == 1 ) // Required by mirror boundaries
+      {
+      continue;
+      }
+
+    const SizeValueType   lineLength = size[n];
+    const OffsetValueType lineStride = offsetTable[n];
+
+    // Bundle along the lowest remaining axis, where adjacent lines
+    // are closest together in memory.
+    const unsigned int    bundleAxis = ( n == 0 && ImageDimension > 1 ) ? 1 : 0;
+    const SizeValueType   bundleAxisSize = ( bundleAxis == n ) ? 1 : size[bundleAxis];
+    const OffsetValueType bundleStride = ( bundleAxis == n ) ? 0 : offsetTable[bundleAxis];
+
+    bundle.resize(lineLength * bundleWidth);
+
+    // Compute over all gain
+    double c0 = 1.0;
+    for ( int k = 0; k < m_NumberOfPoles; k++ )
+      {
+      // Note for cubic splines lambda = 6
+      c0 = c0 * ( 1.0 - m_SplinePoles[k] ) * ( 1.0 - 1.0 / m_SplinePoles[k] );
+      }
+
+    typename TOutputImage::IndexType index = regionIndex;
+
+    bool done = false;
+    while ( !done )
+      {
+      const auto lanes = static_cast< unsigned int >(
+        std::min( static_cast< SizeValueType >( bundleWidth ),
+          bundleAxisSize
+          - static_cast< SizeValueType >( index[bundleAxis] - regionIndex[bundleAxis] ) ) );
+
+      const OffsetValueType base = output->ComputeOffset(index);
+
+      // Gather the bundle, interleaved so sample p of lane l sits at
+      // bundle[ p * bundleWidth + l ].
+      if ( n == 0 )
+        {
+        for ( unsigned int l = 0; l < lanes; l++ )
+          {
+          const OutputPixelType *line = buffer + base + l * bundleStride;
+          for ( SizeValueType p = 0; p < lineLength; p++ )
+            {
+            bundle[p * bundleWidth + l] = static_cast< CoeffType >( line[p] );
+            }
+          }
+        }
+      else
+        {
+        for ( SizeValueType p = 0; p < lineLength; p++ )
+          {
+          const OutputPixelType *row = buffer + base + p * lineStride;
+          CoeffType *            bundleRow = &bundle[p * bundleWidth];
+          for ( unsigned int l = 0; l < lanes; l++ )
+            {
+            bundleRow[l] = static_cast< CoeffType >( row[l * bundleStride] );
+            }
+          }
+        }
+
+      // Apply the gain
+      for ( SizeValueType p = 0; p < lineLength; p++ )
+        {
+        for ( unsigned int l = 0; l < lanes; l++ )
+          {
+          bundle[p * bundleWidth + l] *= c0;
+          }
+        }
+
+      // Loop over all poles
+      for ( int k = 0; k < m_NumberOfPoles; k++ )
+        {
+        const double z = m_SplinePoles[k];
+
+        CoeffType sum[bundleWidth];
+
+        // Causal initialization, mirror boundaries; see
+        // SetInitialCausalCoefficient().
+        auto horizon = static_cast< SizeValueType >( lineLength );
+        if ( m_Tolerance > 0.0 )
+          {
+          horizon = (typename TInputImage::SizeValueType)
+            std::ceil( std::log(m_Tolerance) / std::log( std::fabs(z) ) );
+          }
+        double zn = z;
+        if ( horizon < lineLength )
+          {
+          // Accelerated loop
+          for ( unsigned int l = 0; l < lanes; l++ )
+            {
+            sum[l] = bundle[l];
+            }
+          for ( SizeValueType p = 1; p < horizon; p++ )
+            {
+            const CoeffType *bundleRow = &bundle[p * bundleWidth];
+            for ( unsigned int l = 0; l < lanes; l++ )
+              {
+              sum[l] += zn * bundleRow[l];
+              }
+            zn *= z;
+            }
+          }
+        else
+          {
+          // Full loop
+          const double iz = 1.0 / z;
+          double       z2n = std::pow( z, (double)( lineLength - 1L ) );
+          for ( unsigned int l = 0; l < lanes; l++ )
+            {
+            sum[l] = bundle[l] + z2n * bundle[( lineLength - 1 ) * bundleWidth + l];
+            }
+          z2n *= z2n * iz;
+          for ( SizeValueType p = 1; p <= ( lineLength - 2 ); p++ )
+            {
+            const CoeffType *bundleRow = &bundle[p * bundleWidth];
+            for ( unsigned int l = 0; l < lanes; l++ )
+              {
+              sum[l] += ( zn + z2n ) * bundleRow[l];
+              }
+            zn *= z;
+            z2n *= iz;
+            }
+          for ( unsigned int l = 0; l < lanes; l++ )
+            {
+            sum[l] = sum[l] / ( 1.0 - zn * zn );
+            }
+          }
+        for ( unsigned int l = 0; l < lanes; l++ )
+          {
+          bundle[l] = sum[l];
+          }
+
+        // Causal recursion; every lane is an independent line, so the
+        // inner loop runs vectorized across the bundle.
+        for ( SizeValueType p = 1; p < lineLength; p++ )
+          {
+          CoeffType *      bundleRow = &bundle[p * bundleWidth];
+          const CoeffType *previousRow = bundleRow - bundleWidth;
+          for ( unsigned int l = 0; l < lanes; l++ )
+            {
+            bundleRow[l] += z * previousRow[l];
+            }
+          }
+
+        // Anticausal initialization; see
+        // SetInitialAntiCausalCoefficient().
+        CoeffType *      lastRow = &bundle[( lineLength - 1 ) * bundleWidth];
+        const CoeffType *secondLastRow = lastRow - bundleWidth;
+        for ( unsigned int l = 0; l < lanes; l++ )
+          {
+          lastRow[l] = ( z / ( z * z - 1.0 ) )
+                       * ( z * secondLastRow[l] + lastRow[l] );
+          }
+
+        // Anticausal recursion
+        for ( auto p = static_cast< IndexValueType >( lineLength ) - 2; 0 <= p; p-- )
+          {
+          CoeffType *      bundleRow = &bundle[p * bundleWidth];
+          const CoeffType *nextRow = bundleRow + bundleWidth;
+          for ( unsigned int l = 0; l < lanes; l++ )
+            {
+            bundleRow[l] = z * ( nextRow[l] - bundleRow[l] );
+            }
+          }
+        }
+
+      // Scatter the bundle back
+      if ( n == 0 )
+        {
+        for ( unsigned int l = 0; l < lanes; l++ )
+          {
+          OutputPixelType *line = buffer + base + l * bundleStride;
+          for ( SizeValueType p = 0; p < lineLength; p++ )
+            {
+            line[p] = static_cast< OutputPixelType >( bundle[p * bundleWidth + l] );
+            }
+          }
+        }
+      else
+        {
+        for ( SizeValueType p = 0; p < lineLength; p++ )
+          {
+          OutputPixelType *row = buffer + base + p * lineStride;
+          const CoeffType *bundleRow = &bundle[p * bundleWidth];
+          for ( unsigned int l = 0; l < lanes; l++ )
+            {
+            row[l * bundleStride] = static_cast< OutputPixelType >( bundleRow[l] );
+            }
+          }
+        }
+
+      progress.CompletedPixel();
+
+      // Advance to the next bundle of lines
+      unsigned int j = 0;
+      for ( ; j < ImageDimension; j++ )
+        {
+        if ( j == n )
+          {
+          continue;
+          }
+        index[j] += ( j == bundleAxis ) ? bundleWidth : 1;
+        if ( index[j] - regionIndex[j] < static_cast< IndexValueType >( size[j] ) )
+          {
+          break;
+          }
+        index[j] = regionIndex[j];
+        }
+      if ( j == ImageDimension )
+        {
+        done = true;
+        }
+      }
+    }
+}
+
+template< typename TInputImage, typename TOutputImage >
+void
+BSplineDecompositionImageFilter< TInputImage, TOutputImage >
+::BundledDataToCoefficientsND(std::false_type itkNotUsed(rawBufferAccessIsPossible))
 {
   OutputImagePointer output = this->GetOutput();
 
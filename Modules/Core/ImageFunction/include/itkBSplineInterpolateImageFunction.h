@@ -147,7 +147,6 @@ public:
 
     this->GetInputImage()->TransformPhysicalPointToContinuousIndex(point,
                                                                    index);
-    // No thread info passed in, so call method that doesn't need thread ID.
     return ( this->EvaluateAtContinuousIndex(index) );
   }
 
@@ -162,20 +161,12 @@ public:
   }
 
   OutputType EvaluateAtContinuousIndex(const ContinuousIndexType &
-                                               index) const override
-  {
-    // Don't know thread information, make evaluateIndex, weights on the stack.
-    // Slower, but safer.
-    vnl_matrix< long >   evaluateIndex( ImageDimension, ( m_SplineOrder + 1 ) );
-    vnl_matrix< double > weights( ImageDimension, ( m_SplineOrder + 1 ) );
-
-    // Pass evaluateIndex, weights by reference. They're only good as long
-    // as this method is in scope.
-    return this->EvaluateAtContinuousIndexInternal(index,
-                                                   evaluateIndex,
-                                                   weights);
-  }
+                                               index) const override;
 
+  /** Evaluate the function at a ContinuousIndex position. The threadId
+   * argument is ignored and only kept for backward compatibility;
+   * evaluation uses thread-local working space and is safe from any
+   * thread without prior coordination. */
   virtual OutputType EvaluateAtContinuousIndex(const ContinuousIndexType &
                                                index,
                                                ThreadIdType threadId) const;
@@ -186,7 +177,6 @@ public:
 
     this->GetInputImage()->TransformPhysicalPointToContinuousIndex(point,
                                                                    index);
-    // No thread info passed in, so call method that doesn't need thread ID.
     return ( this->EvaluateDerivativeAtContinuousIndex(index) );
   }
 
@@ -201,25 +191,10 @@ public:
   }
 
   CovariantVectorType EvaluateDerivativeAtContinuousIndex(
-    const ContinuousIndexType & x) const
-  {
-    // Don't know thread information, make evaluateIndex, weights,
-    // weightsDerivative
-    // on the stack.
-    // Slower, but safer.
-    vnl_matrix< long >   evaluateIndex( ImageDimension, ( m_SplineOrder + 1 ) );
-    vnl_matrix< double > weights( ImageDimension, ( m_SplineOrder + 1 ) );
-    vnl_matrix< double > weightsDerivative( ImageDimension, ( m_SplineOrder + 1 ) );
-
-    // Pass evaluateIndex, weights, weightsDerivative by reference. They're only
-    // good
-    // as long as this method is in scope.
-    return this->EvaluateDerivativeAtContinuousIndexInternal(x,
-                                                             evaluateIndex,
-                                                             weights,
-                                                             weightsDerivative);
-  }
+    const ContinuousIndexType & x) const;
 
+  /** Evaluate the derivative at a ContinuousIndex position. The threadId
+   * argument is ignored; see EvaluateAtContinuousIndex. */
   CovariantVectorType EvaluateDerivativeAtContinuousIndex(
     const ContinuousIndexType & x,
     ThreadIdType threadId) const;
@@ -232,8 +207,6 @@ public:
 
     this->GetInputImage()->TransformPhysicalPointToContinuousIndex(point,
                                                                    index);
-
-    // No thread info passed in, so call method that doesn't need thread ID.
     this->EvaluateValueAndDerivativeAtContinuousIndex(index,
                                                       value,
                                                       deriv);
@@ -258,27 +231,10 @@ public:
     const ContinuousIndexType & x,
     OutputType & value,
     CovariantVectorType & deriv
-    ) const
-  {
-    // Don't know thread information, make evaluateIndex, weights,
-    // weightsDerivative
-    // on the stack.
-    // Slower, but safer.
-    vnl_matrix< long >   evaluateIndex( ImageDimension, ( m_SplineOrder + 1 ) );
-    vnl_matrix< double > weights( ImageDimension, ( m_SplineOrder + 1 ) );
-    vnl_matrix< double > weightsDerivative( ImageDimension, ( m_SplineOrder + 1 ) );
-
-    // Pass evaluateIndex, weights, weightsDerivative by reference. They're only
-    // good
-    // as long as this method is in scope.
-    this->EvaluateValueAndDerivativeAtContinuousIndexInternal(x,
-                                                              value,
-                                                              deriv,
-                                                              evaluateIndex,
-                                                              weights,
-                                                              weightsDerivative);
-  }
+    ) const;
 
+  /** Evaluate the value and derivative at a ContinuousIndex position. The
+   * threadId argument is ignored; see EvaluateAtContinuousIndex. */
   void EvaluateValueAndDerivativeAtContinuousIndex(
     const ContinuousIndexType & x,
     OutputType & value,
@@ -291,6 +247,10 @@ public:
 
   itkGetConstMacro(SplineOrder, int);
 
+  /** This class no longer keeps per-thread working space, so callers do
+   * not need to announce how many threads will evaluate concurrently.
+   * The method is retained for backward compatibility and only records
+   * the value reported by GetNumberOfWorkUnits(). */
   void SetNumberOfWorkUnits(ThreadIdType numThreads);
 
   itkGetConstMacro(NumberOfWorkUnits, ThreadIdType);
@@ -314,23 +274,12 @@ public:
 
 protected:
 
-  /** The following methods take working space (evaluateIndex, weights, weightsDerivative)
-   *  that is managed by the caller. If threadId is known, the working variables are looked
-   *  up in the thread indexed arrays. If threadId is not known, working variables are made
-   *  on the stack and passed to these methods. The stack allocation should be ok since
-   *  these methods do not store the working variables, i.e. they are not expected to
-   *  be available beyond the scope of the function call.
-   *
-   *  This was done to allow for two types of re-entrancy. The first is when a threaded
-   *  filter, e.g. InterpolateImagePointsFilter calls EvaluateAtContinuousIndex from multiple
-   *  threads without passing a threadId. So, EvaluateAtContinuousIndex must be thread safe.
-   *  This is handled with the stack-based allocation of the working space.
-   *
-   *  The second form of re-entrancy involves methods that call EvaluateAtContinuousIndex
-   *  from multiple threads, but pass a threadId. In this case, we can gain a little efficiency
-   *  (hopefully) by looking up pre-allocated working space in arrays that are indexed by thread.
-   *  The efficiency gain is likely dependent on the size of the working variables, which are
-   *  in-turn dependent on the dimensionality of the image and the order of the spline.
+  /** The following methods take working space (evaluateIndex, weights,
+   *  weightsDerivative) that is managed by the caller. The public Evaluate
+   *  methods hand in thread-local matrices, so every thread works on its
+   *  own copy without any coordination and without repeated allocation;
+   *  the matrices are only valid for the duration of the call and must
+   *  not be stored by these methods.
    */
   virtual OutputType EvaluateAtContinuousIndexInternal(const ContinuousIndexType & index,
                                                        vnl_matrix< long > & evaluateIndex,
@@ -351,7 +300,7 @@ protected:
                                                                           ) const;
 
   BSplineInterpolateImageFunction();
-  ~BSplineInterpolateImageFunction() override;
+  ~BSplineInterpolateImageFunction() override = default;
   void PrintSelf(std::ostream & os, Indent indent) const override;
 
   // These are needed by the smoothing spline routine.
@@ -410,10 +359,7 @@ private:
   // derivatives.
   bool m_UseImageDirection;
 
-  ThreadIdType          m_NumberOfWorkUnits;
-  vnl_matrix< long > *  m_ThreadedEvaluateIndex;
-  vnl_matrix< double > *m_ThreadedWeights;
-  vnl_matrix< double > *m_ThreadedWeightsDerivative;
+  ThreadIdType m_NumberOfWorkUnits;
 };
 } // namespace itk
 
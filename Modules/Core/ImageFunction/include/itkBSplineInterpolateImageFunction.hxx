@@ -47,9 +47,6 @@ BSplineInterpolateImageFunction< TImageType, TCoordRep, TCoefficientType >
 ::BSplineInterpolateImageFunction()
 {
   m_NumberOfWorkUnits = 1;
-  m_ThreadedEvaluateIndex = nullptr;
-  m_ThreadedWeights = nullptr;
-  m_ThreadedWeightsDerivative = nullptr;
 
   m_CoefficientFilter = CoefficientFilter::New();
   m_Coefficients = CoefficientImageType::New();
@@ -60,20 +57,6 @@ BSplineInterpolateImageFunction< TImageType, TCoordRep, TCoefficientType >
   this->m_UseImageDirection = true;
 }
 
-template< typename TImageType, typename TCoordRep, typename TCoefficientType >
-BSplineInterpolateImageFunction< TImageType, TCoordRep, TCoefficientType >
-::~BSplineInterpolateImageFunction()
-{
-  delete[] m_ThreadedEvaluateIndex;
-  m_ThreadedEvaluateIndex = nullptr;
-
-  delete[] m_ThreadedWeights;
-  m_ThreadedWeights = nullptr;
-
-  delete[] m_ThreadedWeightsDerivative;
-  m_ThreadedWeightsDerivative = nullptr;
-}
-
 /**
  * Standard "PrintSelf" method
  */
@@ -141,8 +124,9 @@ void
 BSplineInterpolateImageFunction< TImageType, TCoordRep, TCoefficientType >
 ::SetNumberOfWorkUnits(ThreadIdType numThreads)
 {
+  // Evaluation uses thread-local working space, so there is nothing to
+  // pre-allocate; the value is only recorded for reporting purposes.
   m_NumberOfWorkUnits = numThreads;
-  this->GeneratePointsToIndex();
 }
 
 template< typename TImageType, typename TCoordRep, typename TCoefficientType >
@@ -150,56 +134,30 @@ typename
 BSplineInterpolateImageFunction< TImageType, TCoordRep, TCoefficientType >
 ::OutputType
 BSplineInterpolateImageFunction< TImageType, TCoordRep, TCoefficientType >
-::EvaluateAtContinuousIndex(const ContinuousIndexType & x,
-                            ThreadIdType threadId) const
+::EvaluateAtContinuousIndex(const ContinuousIndexType & x) const
 {
-// FIXME -- Review this "fix" and ensure it works.
-#if 1
-  vnl_matrix< long > *  evaluateIndex = &( m_ThreadedEvaluateIndex[threadId] );
-  vnl_matrix< double > *weights = &( m_ThreadedWeights[threadId] );
-  // Pass evaluateIndex, weights by reference. Different threadIDs get
-  // different instances.
-  return this->EvaluateAtContinuousIndexInternal(x, *evaluateIndex, *weights);
-#else
-  // FIXME - Should copy matrices to the stack for thread safety.
-  // This method is being called by multiple threads through
-  // EvaluateAtContinuousIndex( const ContinuousIndexType & x).
-  // When that method delegates here, it passes threadId = 0.
-  // This causes problems because multiple threads end up writing
-  // on the same matrices.
-  // Other methods will probably be affected by the same issue. For
-  // example EvaluateDerivativeAtContinuousIndex and
-  // EvaluateValueAndDerivativeAtContinuousIndex.
-  vnl_matrix< long >   evaluateIndex = ( m_ThreadedEvaluateIndex[threadId] );
-  vnl_matrix< double > weights = ( m_ThreadedWeights[threadId] );
+  // Each thread keeps its own working space, so evaluation is safe from
+  // any thread without coordination through SetNumberOfWorkUnits. The
+  // set_size() calls only reallocate when the spline order changed since
+  // the thread last evaluated.
+  thread_local vnl_matrix< long >   evaluateIndex;
+  thread_local vnl_matrix< double > weights;
 
-  // compute the interpolation indexes
-  this->DetermineRegionOfSupport( ( evaluateIndex ), x, m_SplineOrder );
+  evaluateIndex.set_size(ImageDimension, m_SplineOrder + 1);
+  weights.set_size(ImageDimension, m_SplineOrder + 1);
 
-  // Determine weights
-  SetInterpolationWeights(x, ( evaluateIndex ), ( weights ), m_SplineOrder);
-
-  // Modify evaluateIndex at the boundaries using mirror boundary conditions
-  this->ApplyMirrorBoundaryConditions( ( evaluateIndex ), m_SplineOrder );
-
-  // perform interpolation
-  double    interpolated = 0.0;
-  IndexType coefficientIndex;
-  // Step through eachpoint in the N-dimensional interpolation cube.
-  for ( unsigned int p = 0; p < m_MaxNumberInterpolationPoints; p++ )
-    {
-    double w = 1.0;
-    for ( unsigned int n = 0; n < ImageDimension; n++ )
-      {
-      unsigned int indx = m_PointsToIndex[p][n];
-      w *= ( weights )[n][indx];
-      coefficientIndex[n] = ( evaluateIndex )[n][indx];
-      }
-    interpolated += w * m_Coefficients->GetPixel(coefficientIndex);
-    }
+  return this->EvaluateAtContinuousIndexInternal(x, evaluateIndex, weights);
+}
 
-  return ( interpolated );
-#endif
+template< typename TImageType, typename TCoordRep, typename TCoefficientType >
+typename
+BSplineInterpolateImageFunction< TImageType, TCoordRep, TCoefficientType >
+::OutputType
+BSplineInterpolateImageFunction< TImageType, TCoordRep, TCoefficientType >
+::EvaluateAtContinuousIndex(const ContinuousIndexType & x,
+                            ThreadIdType itkNotUsed(threadId)) const
+{
+  return this->EvaluateAtContinuousIndex(x);
 }
 
 template< typename TImageType, typename TCoordRep, typename TCoefficientType >
@@ -207,81 +165,32 @@ typename
 BSplineInterpolateImageFunction< TImageType, TCoordRep, TCoefficientType >
 ::CovariantVectorType
 BSplineInterpolateImageFunction< TImageType, TCoordRep, TCoefficientType >
-::EvaluateDerivativeAtContinuousIndex(const ContinuousIndexType & x,
-                                      ThreadIdType threadId) const
+::EvaluateDerivativeAtContinuousIndex(const ContinuousIndexType & x) const
 {
-// FIXME -- Review this "fix" and ensure it works.
-#if 1
-  vnl_matrix< long > *  evaluateIndex =   &( m_ThreadedEvaluateIndex[threadId] );
-  vnl_matrix< double > *weights =       &( m_ThreadedWeights[threadId] );
-  vnl_matrix< double > *weightsDerivative =
-    &( m_ThreadedWeightsDerivative[threadId] );
-
-  return this->EvaluateDerivativeAtContinuousIndexInternal(x,
-                                                           *evaluateIndex,
-                                                           *weights,
-                                                           *weightsDerivative);
-
-#else
-  vnl_matrix< long > *  evaluateIndex =   &( m_ThreadedEvaluateIndex[threadId] );
-  vnl_matrix< double > *weights =       &( m_ThreadedWeights[threadId] );
-  vnl_matrix< double > *weightsDerivative =
-    &( m_ThreadedWeightsDerivative[threadId] );
-
-  this->DetermineRegionOfSupport( ( *evaluateIndex ), x, m_SplineOrder );
+  // Thread-local working space; see EvaluateAtContinuousIndex.
+  thread_local vnl_matrix< long >   evaluateIndex;
+  thread_local vnl_matrix< double > weights;
+  thread_local vnl_matrix< double > weightsDerivative;
 
-  SetInterpolationWeights(x, ( *evaluateIndex ), ( *weights ), m_SplineOrder);
-
-  SetDerivativeWeights(x,
-                       ( *evaluateIndex ),
-                       ( *weightsDerivative ),
-                       m_SplineOrder);
-
-  // Modify EvaluateIndex at the boundaries using mirror boundary conditions
-  this->ApplyMirrorBoundaryConditions( ( *evaluateIndex ), m_SplineOrder );
-
-  const InputImageType *inputImage = this->GetInputImage();
-  const typename InputImageType::SpacingType & spacing = inputImage->GetSpacing();
-
-  // Calculate derivative
-  CovariantVectorType derivativeValue;
-  double              tempValue;
-  IndexType           coefficientIndex;
-  for ( unsigned int n = 0; n < ImageDimension; n++ )
-    {
-    derivativeValue[n] = 0.0;
-    for ( unsigned int p = 0; p < m_MaxNumberInterpolationPoints; p++ )
-      {
-      tempValue = 1.0;
-      for ( unsigned int n1 = 0; n1 < ImageDimension; n1++ )
-        {
-        unsigned int indx;
-        indx = m_PointsToIndex[p][n1];
-        coefficientIndex[n1] = ( *evaluateIndex )[n1][indx];
-
-        if ( n1 == n )
-          {
-          tempValue *= ( *weightsDerivative )[n1][indx];
-          }
-        else
-          {
-          tempValue *= ( *weights )[n1][indx];
-          }
-        }
-      derivativeValue[n] += m_Coefficients->GetPixel(coefficientIndex) * tempValue;
-      }
-    derivativeValue[n] /= spacing[n];
-    }
+  evaluateIndex.set_size(ImageDimension, m_SplineOrder + 1);
+  weights.set_size(ImageDimension, m_SplineOrder + 1);
+  weightsDerivative.set_size(ImageDimension, m_SplineOrder + 1);
 
-  if ( this->m_UseImageDirection )
-    {
-    CovariantVectorType orientedDerivative;
-    inputImage->TransformLocalVectorToPhysicalVector(derivativeValue, orientedDerivative);
-    return orientedDerivative;
-    }
+  return this->EvaluateDerivativeAtContinuousIndexInternal(x,
+                                                           evaluateIndex,
+                                                           weights,
+                                                           weightsDerivative);
+}
 
-  return ( derivativeValue );
-#endif
+template< typename TImageType, typename TCoordRep, typename TCoefficientType >
+typename
+BSplineInterpolateImageFunction< TImageType, TCoordRep, TCoefficientType >
+::CovariantVectorType
+BSplineInterpolateImageFunction< TImageType, TCoordRep, TCoefficientType >
+::EvaluateDerivativeAtContinuousIndex(const ContinuousIndexType & x,
+                                      ThreadIdType itkNotUsed(threadId)) const
+{
+  return this->EvaluateDerivativeAtContinuousIndex(x);
 }
 
 template< typename TImageType, typename TCoordRep, typename TCoefficientType >
@@ -289,93 +198,34 @@ void
 BSplineInterpolateImageFunction< TImageType, TCoordRep, TCoefficientType >
 ::EvaluateValueAndDerivativeAtContinuousIndex(const ContinuousIndexType & x,
                                               OutputType & value,
-                                              CovariantVectorType & derivativeValue,
-                                              ThreadIdType threadId) const
+                                              CovariantVectorType & derivativeValue) const
 {
-// FIXME -- Review this "fix" and ensure it works.
-#if 1
-  vnl_matrix< long > *  evaluateIndex =   &( m_ThreadedEvaluateIndex[threadId] );
-  vnl_matrix< double > *weights =       &( m_ThreadedWeights[threadId] );
-  vnl_matrix< double > *weightsDerivative =
-    &( m_ThreadedWeightsDerivative[threadId] );
+  // Thread-local working space; see EvaluateAtContinuousIndex.
+  thread_local vnl_matrix< long >   evaluateIndex;
+  thread_local vnl_matrix< double > weights;
+  thread_local vnl_matrix< double > weightsDerivative;
+
+  evaluateIndex.set_size(ImageDimension, m_SplineOrder + 1);
+  weights.set_size(ImageDimension, m_SplineOrder + 1);
+  weightsDerivative.set_size(ImageDimension, m_SplineOrder + 1);
 
   this->EvaluateValueAndDerivativeAtContinuousIndexInternal(x,
                                                             value,
                                                             derivativeValue,
-                                                            *evaluateIndex,
-                                                            *weights,
-                                                            *weightsDerivative);
-#else
-  vnl_matrix< long > *  evaluateIndex =   &( m_ThreadedEvaluateIndex[threadId] );
-  vnl_matrix< double > *weights =       &( m_ThreadedWeights[threadId] );
-  vnl_matrix< double > *weightsDerivative =
-    &( m_ThreadedWeightsDerivative[threadId] );
-
-  this->DetermineRegionOfSupport( ( *evaluateIndex ), x, m_SplineOrder );
-
-  SetInterpolationWeights(x, ( *evaluateIndex ), ( *weights ), m_SplineOrder);
-
-  SetDerivativeWeights(x,
-                       ( *evaluateIndex ),
-                       ( *weightsDerivative ),
-                       m_SplineOrder);
-
-  // Modify EvaluateIndex at the boundaries using mirror boundary conditions
-  this->ApplyMirrorBoundaryConditions( ( *evaluateIndex ), m_SplineOrder );
-
-  unsigned int indx;
-  double       tmpV;
-  double       w, w1, tmpW;
-  IndexType    coefficientIndex;
-  value = 0.0;
-  unsigned int p, n, n1;
-  derivativeValue[0] = 0.0;
-  for ( p = 0; p < m_MaxNumberInterpolationPoints; p++ )
-    {
-    indx = m_PointsToIndex[p][0];
-    coefficientIndex[0] = ( *evaluateIndex )[0][indx];
-    w = ( *weights )[0][indx];
-    w1 = ( *weightsDerivative )[0][indx];
-    for ( n = 1; n < ImageDimension; n++ )
-      {
-      indx = m_PointsToIndex[p][n];
-      coefficientIndex[n] = ( *evaluateIndex )[n][indx];
-      tmpW = ( *weights )[n][indx];
-      w *= tmpW;
-      w1 *= tmpW;
-      }
-    tmpV = m_Coefficients->GetPixel(coefficientIndex);
-    value += w * tmpV;
-    derivativeValue[0] += w1 * tmpV;
-    }
-  derivativeValue[0] /= this->GetInputImage()->GetSpacing()[0];
-  for ( n = 1; n < ImageDimension; n++ )
-    {
-    derivativeValue[n] = 0.0;
-    for ( p = 0; p < m_MaxNumberInterpolationPoints; p++ )
-      {
-      w1 = 1.0;
-      for ( n1 = 0; n1 < ImageDimension; n1++ )
-        {
-        indx = m_PointsToIndex[p][n1];
-        coefficientIndex[n1] = ( *evaluateIndex )[n1][indx];
+                                                            evaluateIndex,
+                                                            weights,
+                                                            weightsDerivative);
+}
 
-        if ( n1 == n )
-          {
-          w1 *= ( *weightsDerivative )[n1][indx];
-          }
-        else
-          {
-          w1 *= ( *weights )[n1][indx];
-          }
-        }
-      derivativeValue[n] += m_Coefficients->GetPixel(coefficientIndex)
-                            * w1;
-      }
-    // take spacing into account
-    derivativeValue[n] /= this->GetInputImage()->GetSpacing()[n];
-    }
-#endif
+template< typename TImageType, typename TCoordRep, typename TCoefficientType >
+void
+BSplineInterpolateImageFunction< TImageType, TCoordRep, TCoefficientType >
+::EvaluateValueAndDerivativeAtContinuousIndex(const ContinuousIndexType & x,
+                                              OutputType & value,
+                                              CovariantVectorType & derivativeValue,
+                                              ThreadIdType itkNotUsed(threadId)) const
+{
+  this->EvaluateValueAndDerivativeAtContinuousIndex(x, value, derivativeValue);
 }
 
 template< typename TImageType, typename TCoordRep, typename TCoefficientType >
@@ -389,7 +239,10 @@ BSplineInterpolateImageFunction< TImageType, TCoordRep, TCoefficientType >
   // For speed improvements we could make each case a separate function and use
   // function pointers to reference the correct weight order.
   // Left as is for now for readability.
-  double w, w2, w4, t, t0, t1;
+  // The weights for each dimension are computed in local scalars and the
+  // row pointer is hoisted out of the expressions, which keeps the loop
+  // bodies straight-line arithmetic the optimizer can schedule freely.
+  double w, w0, w1, w2, w3, w4, t, t0, t1;
 
   switch ( splineOrder )
     {
@@ -397,11 +250,15 @@ BSplineInterpolateImageFunction< TImageType, TCoordRep, TCoefficientType >
       {
       for ( unsigned int n = 0; n < ImageDimension; n++ )
         {
+        double *const row = weights[n];
         w = x[n] - (double)EvaluateIndex[n][1];
-        weights[n][3] = ( 1.0 / 6.0 ) * w * w * w;
-        weights[n][0] = ( 1.0 / 6.0 ) + 0.5 * w * ( w - 1.0 ) - weights[n][3];
-        weights[n][2] = w + weights[n][0] - 2.0 * weights[n][3];
-        weights[n][1] = 1.0 - weights[n][0] - weights[n][2] - weights[n][3];
+        w3 = ( 1.0 / 6.0 ) * w * w * w;
+        w0 = ( 1.0 / 6.0 ) + 0.5 * w * ( w - 1.0 ) - w3;
+        w2 = w + w0 - 2.0 * w3;
+        row[0] = w0;
+        row[1] = 1.0 - w0 - w2 - w3;
+        row[2] = w2;
+        row[3] = w3;
         }
       break;
       }
@@ -417,9 +274,10 @@ BSplineInterpolateImageFunction< TImageType, TCoordRep, TCoefficientType >
       {
       for ( unsigned int n = 0; n < ImageDimension; n++ )
         {
+        double *const row = weights[n];
         w = x[n] - (double)EvaluateIndex[n][0];
-        weights[n][1] = w;
-        weights[n][0] = 1.0 - w;
+        row[0] = 1.0 - w;
+        row[1] = w;
         }
       break;
       }
@@ -427,11 +285,14 @@ BSplineInterpolateImageFunction< TImageType, TCoordRep, TCoefficientType >
       {
       for ( unsigned int n = 0; n < ImageDimension; n++ )
         {
+        double *const row = weights[n];
         /* x */
         w = x[n] - (double)EvaluateIndex[n][1];
-        weights[n][1] = 0.75 - w * w;
-        weights[n][2] = 0.5 * ( w - weights[n][1] + 1.0 );
-        weights[n][0] = 1.0 - weights[n][1] - weights[n][2];
+        w1 = 0.75 - w * w;
+        w2 = 0.5 * ( w - w1 + 1.0 );
+        row[0] = 1.0 - w1 - w2;
+        row[1] = w1;
+        row[2] = w2;
         }
       break;
       }
@@ -439,19 +300,24 @@ BSplineInterpolateImageFunction< TImageType, TCoordRep, TCoefficientType >
       {
       for ( unsigned int n = 0; n < ImageDimension; n++ )
         {
+        double *const row = weights[n];
         /* x */
         w = x[n] - (double)EvaluateIndex[n][2];
         w2 = w * w;
         t = ( 1.0 / 6.0 ) * w2;
-        weights[n][0] = 0.5 - w;
-        weights[n][0] *= weights[n][0];
-        weights[n][0] *= ( 1.0 / 24.0 ) * weights[n][0];
+        w0 = 0.5 - w;
+        w0 *= w0;
+        w0 *= ( 1.0 / 24.0 ) * w0;
         t0 = w * ( t - 11.0 / 24.0 );
         t1 = 19.0 / 96.0 + w2 * ( 0.25 - t );
-        weights[n][1] = t1 + t0;
-        weights[n][3] = t1 - t0;
-        weights[n][4] = weights[n][0] + t0 + 0.5 * w;
-        weights[n][2] = 1.0 - weights[n][0] - weights[n][1] - weights[n][3] - weights[n][4];
+        w1 = t1 + t0;
+        w3 = t1 - t0;
+        w4 = w0 + t0 + 0.5 * w;
+        row[0] = w0;
+        row[1] = w1;
+        row[2] = 1.0 - w0 - w1 - w3 - w4;
+        row[3] = w3;
+        row[4] = w4;
         }
       break;
       }
@@ -459,23 +325,24 @@ BSplineInterpolateImageFunction< TImageType, TCoordRep, TCoefficientType >
       {
       for ( unsigned int n = 0; n < ImageDimension; n++ )
         {
+        double *const row = weights[n];
         /* x */
         w = x[n] - (double)EvaluateIndex[n][2];
         w2 = w * w;
-        weights[n][5] = ( 1.0 / 120.0 ) * w * w2 * w2;
+        row[5] = ( 1.0 / 120.0 ) * w * w2 * w2;
         w2 -= w;
         w4 = w2 * w2;
         w -= 0.5;
         t = w2 * ( w2 - 3.0 );
-        weights[n][0] = ( 1.0 / 24.0 ) * ( 1.0 / 5.0 + w2 + w4 ) - weights[n][5];
+        row[0] = ( 1.0 / 24.0 ) * ( 1.0 / 5.0 + w2 + w4 ) - row[5];
         t0 = ( 1.0 / 24.0 ) * ( w2 * ( w2 - 5.0 ) + 46.0 / 5.0 );
         t1 = ( -1.0 / 12.0 ) * w * ( t + 4.0 );
-        weights[n][2] = t0 + t1;
-        weights[n][3] = t0 - t1;
+        row[2] = t0 + t1;
+        row[3] = t0 - t1;
         t0 = ( 1.0 / 16.0 ) * ( 9.0 / 5.0 - t );
         t1 = ( 1.0 / 24.0 ) * w * ( w4 - w2 - 5.0 );
-        weights[n][1] = t0 + t1;
-        weights[n][4] = t0 - t1;
+        row[1] = t0 + t1;
+        row[4] = t0 - t1;
         }
       break;
       }
@@ -626,19 +493,6 @@ BSplineInterpolateImageFunction< TImageType, TCoordRep, TCoefficientType >
   // m_PointsToIndex is used to convert a sequential location to an N-dimension
   // index vector.  This is precomputed to save time during the interpolation
   // routine.
-  delete[] m_ThreadedEvaluateIndex;
-  m_ThreadedEvaluateIndex = new vnl_matrix< long >[m_NumberOfWorkUnits];
-  delete[] m_ThreadedWeights;
-  m_ThreadedWeights = new vnl_matrix< double >[m_NumberOfWorkUnits];
-  delete[] m_ThreadedWeightsDerivative;
-  m_ThreadedWeightsDerivative = new vnl_matrix< double >[m_NumberOfWorkUnits];
-  for ( unsigned int i = 0; i < m_NumberOfWorkUnits; i++ )
-    {
-    m_ThreadedEvaluateIndex[i].set_size(ImageDimension, m_SplineOrder + 1);
-    m_ThreadedWeights[i].set_size(ImageDimension, m_SplineOrder + 1);
-    m_ThreadedWeightsDerivative[i].set_size(ImageDimension, m_SplineOrder + 1);
-    }
-
   m_PointsToIndex.resize(m_MaxNumberInterpolationPoints);
   for ( unsigned int p = 0; p < m_MaxNumberInterpolationPoints; p++ )
     {
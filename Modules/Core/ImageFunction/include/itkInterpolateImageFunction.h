@@ -111,6 +111,28 @@ public:
   OutputType EvaluateAtContinuousIndex(
     const ContinuousIndexType & index) const override = 0;
 
+  /** Interpolate the image at a batch of continuous index positions
+   *
+   * Fills outputs[0] .. outputs[numberOfSamples - 1] with the
+   * interpolated image intensities at the corresponding entries of
+   * indices. All positions are assumed to lie within the image
+   * buffer; no bounds checking is done.
+   *
+   * The default implementation simply loops over
+   * EvaluateAtContinuousIndex. Subclasses can override it to amortize
+   * the per sample virtual dispatch and keep their evaluation state
+   * live across the batch, which is what the callers processing whole
+   * scan lines, such as ResampleImageFilter, rely on. */
+  virtual void EvaluateBatchAtContinuousIndex(const ContinuousIndexType *indices,
+                                              SizeValueType numberOfSamples,
+                                              OutputType *outputs) const
+  {
+    for ( SizeValueType i = 0; i < numberOfSamples; i++ )
+      {
+      outputs[i] = this->EvaluateAtContinuousIndex(indices[i]);
+      }
+  }
+
   /** Interpolate the image at an index position.
    *
    * Simply returns the image value at the
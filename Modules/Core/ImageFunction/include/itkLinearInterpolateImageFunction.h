@@ -101,6 +101,21 @@ public:
     return this->EvaluateOptimized(Dispatch< ImageDimension >(), index);
   }
 
+  /** Evaluate the function at a batch of ContinuousIndex positions
+   *
+   * Loops over the non virtual optimized evaluation, paying the
+   * virtual dispatch once per batch and letting the compiler overlap
+   * the neighbor gathers and weight blends of consecutive samples. */
+  void EvaluateBatchAtContinuousIndex(const ContinuousIndexType *indices,
+                                      SizeValueType numberOfSamples,
+                                      OutputType *outputs) const override
+  {
+    for ( SizeValueType i = 0; i < numberOfSamples; i++ )
+      {
+      outputs[i] = this->EvaluateOptimized(Dispatch< ImageDimension >(), indices[i]);
+      }
+  }
+
 protected:
   LinearInterpolateImageFunction();
   ~LinearInterpolateImageFunction() override;
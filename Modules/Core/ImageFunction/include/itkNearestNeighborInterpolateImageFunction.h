@@ -86,6 +86,24 @@ public:
     return static_cast< OutputType >( this->GetInputImage()->GetPixel(nindex) );
   }
 
+  /** Evaluate the function at a batch of ContinuousIndex positions
+   *
+   * Rounds and fetches every sample in one tight loop, paying the
+   * virtual dispatch once per batch instead of once per sample. */
+  void EvaluateBatchAtContinuousIndex(const ContinuousIndexType *indices,
+                                      SizeValueType numberOfSamples,
+                                      OutputType *outputs) const override
+  {
+    const TInputImage * const inputImagePtr = this->GetInputImage();
+    IndexType nindex;
+
+    for ( SizeValueType i = 0; i < numberOfSamples; i++ )
+      {
+      this->ConvertContinuousIndexToNearestIndex(indices[i], nindex);
+      outputs[i] = static_cast< OutputType >( inputImagePtr->GetPixel(nindex) );
+      }
+  }
+
 protected:
   NearestNeighborInterpolateImageFunction()= default;
   ~NearestNeighborInterpolateImageFunction() override = default;
@@ -22,6 +22,8 @@
 #include "itkZeroFluxNeumannBoundaryCondition.h"
 #include "itkInterpolateImageFunction.h"
 
+#include <vector>
+
 namespace itk
 {
 namespace Function
@@ -299,6 +301,17 @@ public:
 
   void SetInputImage(const ImageType *image) override;
 
+  /** Set/Get the number of kernel samples per unit offset in the
+   * precomputed kernel table.  The kernel weights are looked up in the
+   * table with linear interpolation between adjacent entries instead
+   * of evaluating the window and sinc functions per tap, so the table
+   * resolution bounds the weight approximation error.  The default of
+   * 1000 samples keeps the error below 1e-6 for the windows defined in
+   * this header. */
+  void SetKernelTableResolution(unsigned int resolution);
+
+  itkGetConstMacro(KernelTableResolution, unsigned int);
+
   /** Evaluate the function at a ContinuousIndex position
    *
    * Returns the interpolated image intensity at a
@@ -334,6 +347,16 @@ private:
   /** Index into the weights array for each offset */
   unsigned int **m_WeightOffsetTable;
 
+  /** Precompute the kernel table.  Row q holds the m_WindowSize
+   * weights for the fractional offset q / m_KernelTableResolution. */
+  void BuildKernelTable();
+
+  /** Kernel weights sampled densely over the fractional offset. */
+  std::vector< double > m_KernelTable;
+
+  /** Number of kernel table rows per unit offset. */
+  unsigned int m_KernelTableResolution{ 1000 };
+
   /** The sinc function */
   inline double Sinc(double x) const
   {
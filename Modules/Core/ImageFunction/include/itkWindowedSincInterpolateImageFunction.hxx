@@ -91,6 +91,63 @@ WindowedSincInterpolateImageFunction< TInputImage, VRadius,
     {
     m_WeightOffsetTable[i] = new unsigned int[ImageDimension];
     }
+
+  // Precompute the kernel weights
+  this->BuildKernelTable();
+}
+
+template< typename TInputImage, unsigned int VRadius,
+          typename TWindowFunction, typename TBoundaryCondition, typename TCoordRep >
+void
+WindowedSincInterpolateImageFunction< TInputImage, VRadius,
+                                      TWindowFunction, TBoundaryCondition, TCoordRep >
+::SetKernelTableResolution(unsigned int resolution)
+{
+  if ( resolution < 1 )
+    {
+    resolution = 1;
+    }
+  if ( resolution == m_KernelTableResolution )
+    {
+    return;
+    }
+  m_KernelTableResolution = resolution;
+  this->BuildKernelTable();
+  this->Modified();
+}
+
+template< typename TInputImage, unsigned int VRadius,
+          typename TWindowFunction, typename TBoundaryCondition, typename TCoordRep >
+void
+WindowedSincInterpolateImageFunction< TInputImage, VRadius,
+                                      TWindowFunction, TBoundaryCondition, TCoordRep >
+::BuildKernelTable()
+{
+  // Row q holds the weights for the fractional offset
+  // q / m_KernelTableResolution; an extra row at offset one lets the
+  // lookup interpolate between adjacent rows without wrapping.
+  const unsigned int numberOfRows = m_KernelTableResolution + 1;
+
+  m_KernelTable.resize(numberOfRows * m_WindowSize);
+
+  for ( unsigned int q = 0; q < numberOfRows; q++ )
+    {
+    const double distance =
+      static_cast< double >( q ) / static_cast< double >( m_KernelTableResolution );
+
+    // x is the offset, hence the parameter of the kernel
+    double x = distance + VRadius;
+
+    // i is the relative offset of the tap
+    for ( unsigned int i = 0; i < m_WindowSize; i++ )
+      {
+      // Take x through the range (dist + rad - 1, ..., dist - rad),
+      // i.e. all x such that std::abs(x) <= rad
+      x -= 1.0;
+
+      m_KernelTable[q * m_WindowSize + i] = m_WindowFunction(x) * Sinc(x);
+      }
+    }
 }
 
 /** Destructor */
@@ -182,6 +239,8 @@ WindowedSincInterpolateImageFunction< TInputImage, VRadius,
 ::PrintSelf(std::ostream & os, Indent indent) const
 {
   this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "KernelTableResolution: " << m_KernelTableResolution << std::endl;
 }
 
 /** Evaluate at image index position */
@@ -216,13 +275,10 @@ WindowedSincInterpolateImageFunction< TInputImage, VRadius,
                                    this->GetInputImage()->GetBufferedRegion() );
   nit.SetLocation(baseIndex);
 
-  // Compute the sinc function for each dimension
+  // Look up the kernel weights for each dimension
   double xWeight[ImageDimension][2 * VRadius];
   for ( dim = 0; dim < ImageDimension; dim++ )
     {
-    // x is the offset, hence the parameter of the kernel
-    double x = distance[dim] + VRadius;
-
     // If distance is zero, i.e. the index falls precisely on the
     // pixel boundary, the weights form a delta function.
     if ( distance[dim] == 0.0 )
@@ -234,16 +290,18 @@ WindowedSincInterpolateImageFunction< TInputImage, VRadius,
       }
     else
       {
-      // i is the relative offset in dimension dim.
+      // Interpolate the weights linearly between the two kernel table
+      // rows bracketing this fractional offset.
+      const double scaled = distance[dim] * m_KernelTableResolution;
+      const auto   row = static_cast< unsigned int >( scaled );
+      const double remainder = scaled - row;
+
+      const double *lowerRow = &m_KernelTable[row * m_WindowSize];
+      const double *upperRow = lowerRow + m_WindowSize;
+
       for ( unsigned int i = 0; i < m_WindowSize; i++ )
         {
-        // Increment the offset, taking it through the range
-        // (dist + rad - 1, ..., dist - rad), i.e. all x
-        // such that std::abs(x) <= rad
-        x -= 1.0;
-
-        // Compute the weight for this m
-        xWeight[dim][i] = m_WindowFunction(x) * Sinc(x);
+        xWeight[dim][i] = lowerRow[i] + remainder * ( upperRow[i] - lowerRow[i] );
         }
       }
     }
@@ -265,6 +265,13 @@ protected:
    *  container which holds the cell identifiers */
   mutable CellLinksContainerPointer m_CellLinksContainer;
 
+  /** The packed flavor of the cell links built by BuildPackedCellLinks():
+   *  row offsets indexed by point identifier, followed by the
+   *  concatenated rows of cell identifiers. */
+  mutable std::vector< SizeValueType > m_PackedCellLinksOffsets;
+
+  mutable std::vector< CellIdentifier > m_PackedCellLinks;
+
   /** A vector of objects containing explicit cell boundary assignments.
    *  The vector is indexed by the topological dimension of the cell
    *  boundary.  The container for each topological dimension holds
@@ -420,6 +427,30 @@ public:
    * information is stored in the cell links container, not in the points. */
   void BuildCellLinks() const;
 
+  /** Build the links from points back to their using cells in a packed
+   * layout: the identifiers of the cells using point p occupy the range
+   * [ GetPackedCellLinksOffsets()[p], GetPackedCellLinksOffsets()[p+1] )
+   * of GetPackedCellLinks(), ordered by increasing cell identifier.
+   * Traversing the adjacency of consecutive points then reads contiguous
+   * memory instead of walking one std::set per point. The offsets are
+   * indexed by point identifier, so the layout is meant for meshes with
+   * reasonably dense point numbering. BuildCellLinks() builds the packed
+   * links first and fills the per-point sets from them, keeping both
+   * representations consistent. */
+  void BuildPackedCellLinks() const;
+
+  /** Row offsets of the packed cell links, indexed by point identifier. */
+  const std::vector< SizeValueType > & GetPackedCellLinksOffsets() const
+  {
+    return m_PackedCellLinksOffsets;
+  }
+
+  /** Concatenated rows of the packed cell links. */
+  const std::vector< CellIdentifier > & GetPackedCellLinks() const
+  {
+    return m_PackedCellLinks;
+  }
+
   /** This method iterates over all the cells in the mesh and has
    *  each cell Accept the MultiVisitor. See MultiVisitor for more
    *  information.  (Note, this follows the Visitor Design Pattern.) */
@@ -29,6 +29,7 @@
 #define itkMesh_hxx
 
 #include "itkMesh.h"
+#include "itkMultiThreaderBase.h"
 #include "itkProcessObject.h"
 #include <algorithm>
 #include <iterator>
@@ -984,23 +985,179 @@ Mesh< TPixelType, VDimension, TMeshTraits >
     }
 
   /**
-   * Loop through each cell, and add its identifier to the CellLinks of each
-   * of its points.
+   * Build the packed adjacency first: two counting passes that stream
+   * over the cells without allocating anything per element. The per-point
+   * sets are then filled from the packed rows, which parallelizes over
+   * points because every set is touched by exactly one thread.
    */
+  this->BuildPackedCellLinks();
+
+  const SizeValueType numberOfOffsets = static_cast< SizeValueType >( m_PackedCellLinksOffsets.size() );
+  if ( numberOfOffsets < 2 )
+    {
+    return;
+    }
+  const SizeValueType numberOfRows = numberOfOffsets - 1;
+
+  /**
+   * Creating container elements is not thread safe: create the non empty
+   * rows serially, then collect plain pointers for the parallel fill.
+   * The pointers are collected after all elements exist, since creating
+   * an element may relocate the others.
+   */
+  for ( SizeValueType row = 0; row < numberOfRows; ++row )
+    {
+    if ( m_PackedCellLinksOffsets[row + 1] > m_PackedCellLinksOffsets[row] )
+      {
+      m_CellLinksContainer->CreateElementAt( static_cast< PointIdentifier >( row ) );
+      }
+    }
+
+  std::vector< PointCellLinksContainer * > links(numberOfRows, nullptr);
+  for ( SizeValueType row = 0; row < numberOfRows; ++row )
+    {
+    if ( m_PackedCellLinksOffsets[row + 1] > m_PackedCellLinksOffsets[row] )
+      {
+      links[row] = &( m_CellLinksContainer->ElementAt( static_cast< PointIdentifier >( row ) ) );
+      }
+    }
+
+  MultiThreaderBase::Pointer threader = MultiThreaderBase::New();
+  threader->ParallelizeArray( 0, numberOfRows,
+    [this, &links]( SizeValueType row )
+      {
+      PointCellLinksContainer *const rowLinks = links[row];
+      if ( rowLinks )
+        {
+        rowLinks->insert(m_PackedCellLinks.begin() + m_PackedCellLinksOffsets[row],
+                         m_PackedCellLinks.begin() + m_PackedCellLinksOffsets[row + 1]);
+        }
+      },
+    nullptr );
+}
+
+/**
+ * Build the packed flavor of the cell links with two counting passes over
+ * the cells: count the cells incident to every point, turn the counts into
+ * row offsets with a running sum, then fill the rows.
+ */
+template< typename TPixelType, unsigned int VDimension, typename TMeshTraits >
+void
+Mesh< TPixelType, VDimension, TMeshTraits >
+::BuildPackedCellLinks() const
+{
+  if ( !this->m_PointsContainer || !m_CellsContainer )
+    {
+    return;
+    }
+
+  /**
+   * The rows are indexed by point identifier, so the offsets cover the
+   * largest identifier in the points container. Identifiers only
+   * referenced by cells extend the offsets on the fly below.
+   */
+  PointIdentifier numberOfRows = 0;
+
+  for ( PointsContainerConstIterator pointItr = this->m_PointsContainer->Begin();
+        pointItr != this->m_PointsContainer->End(); ++pointItr )
+    {
+    if ( pointItr->Index() + 1 > numberOfRows )
+      {
+      numberOfRows = pointItr->Index() + 1;
+      }
+    }
+
+  /**
+   * Counting pass: slot p + 1 accumulates the number of cells incident
+   * to point p, so that the running sum turns the vector into offsets.
+   */
+  m_PackedCellLinksOffsets.assign(numberOfRows + 1, 0);
+
+  for ( CellsContainerIterator cellItr = m_CellsContainer->Begin();
+        cellItr != m_CellsContainer->End(); ++cellItr )
+    {
+    CellType *cellptr = cellItr->Value();
+    if ( !cellptr )
+      {
+      continue;
+      }
+
+    typename CellType::PointIdConstIterator first = cellptr->PointIdsBegin();
+    for ( typename CellType::PointIdConstIterator pointId = first;
+          pointId != cellptr->PointIdsEnd(); ++pointId )
+      {
+      /**
+       * A degenerate cell may list a point several times, but the links
+       * hold every incident cell once, just like the per-point sets.
+       */
+      bool listedBefore = false;
+      for ( typename CellType::PointIdConstIterator before = first;
+            before != pointId; ++before )
+        {
+        if ( *before == *pointId )
+          {
+          listedBefore = true;
+          break;
+          }
+        }
+      if ( listedBefore )
+        {
+        continue;
+        }
+
+      if ( static_cast< size_t >( *pointId ) + 1 >= m_PackedCellLinksOffsets.size() )
+        {
+        m_PackedCellLinksOffsets.resize(static_cast< size_t >( *pointId ) + 2, 0);
+        }
+      ++m_PackedCellLinksOffsets[*pointId + 1];
+      }
+    }
+
+  const size_t numberOfOffsets = m_PackedCellLinksOffsets.size();
+  for ( size_t i = 1; i < numberOfOffsets; ++i )
+    {
+    m_PackedCellLinksOffsets[i] += m_PackedCellLinksOffsets[i - 1];
+    }
+
+  m_PackedCellLinks.resize(m_PackedCellLinksOffsets[numberOfOffsets - 1]);
+
+  /**
+   * Filling pass: every row is filled in the order the cells container
+   * is traversed, i.e. by increasing cell identifier.
+   */
+  std::vector< SizeValueType > cursor( m_PackedCellLinksOffsets.begin(),
+                                       m_PackedCellLinksOffsets.end() - 1 );
+
   for ( CellsContainerIterator cellItr = m_CellsContainer->Begin();
         cellItr != m_CellsContainer->End(); ++cellItr )
     {
     CellIdentifier cellId  = cellItr->Index();
     CellType *     cellptr = cellItr->Value();
+    if ( !cellptr )
+      {
+      continue;
+      }
 
-    /**
-     * For each point, make sure the cell links container has its index,
-     * and then insert the cell ID into the point's set.
-     */
-    for ( typename CellType::PointIdConstIterator pointId = cellptr->PointIdsBegin();
+    typename CellType::PointIdConstIterator first = cellptr->PointIdsBegin();
+    for ( typename CellType::PointIdConstIterator pointId = first;
           pointId != cellptr->PointIdsEnd(); ++pointId )
       {
-      ( m_CellLinksContainer->CreateElementAt(*pointId) ).insert(cellId);
+      bool listedBefore = false;
+      for ( typename CellType::PointIdConstIterator before = first;
+            before != pointId; ++before )
+        {
+        if ( *before == *pointId )
+          {
+          listedBefore = true;
+          break;
+          }
+        }
+      if ( listedBefore )
+        {
+        continue;
+        }
+
+      m_PackedCellLinks[cursor[*pointId]++] = cellId;
       }
     }
 }
@@ -213,6 +213,12 @@ protected:
 
   static int PolygonToImageRaster(PointVector coords, Point1DArray & zymatrix, int extent[6]);
 
+  /** Rasterize a single polygon into the slices zFirst through zLast only.
+   * Restricting a call to a slab lets several threads rasterize disjoint
+   * slabs of the same zymatrix concurrently. */
+  static int PolygonToImageRaster(const PointVector & coords, Point1DArray & zymatrix, int extent[6],
+                                  int zFirst, int zLast);
+
   OutputImageType *m_InfoImage;
 
   IndexType m_Index;
@@ -20,6 +20,7 @@
 
 #include "itkTriangleMeshToBinaryImageFilter.h"
 #include "itkImageRegionIteratorWithIndex.h"
+#include "itkMultiThreaderBase.h"
 #include "itkNumericTraits.h"
 #include <cstdlib>
 
@@ -252,11 +253,23 @@ template< typename TInputMesh, typename TOutputImage >
 int
 TriangleMeshToBinaryImageFilter< TInputMesh, TOutputImage >
 ::PolygonToImageRaster(PointVector coords, Point1DArray & zymatrix, int extent[6])
+{
+  return PolygonToImageRaster(coords, zymatrix, extent, extent[4], extent[5]);
+}
+
+//----------------------------------------------------------------------------
+/** convert a single polygon/triangle to raster format, restricted to the
+ *  slices zFirst through zLast */
+template< typename TInputMesh, typename TOutputImage >
+int
+TriangleMeshToBinaryImageFilter< TInputMesh, TOutputImage >
+::PolygonToImageRaster(const PointVector & coords, Point1DArray & zymatrix, int extent[6],
+                       int zFirst, int zLast)
 {
   // convert the polgon into a rasterizable form by finding its
   // intersection with each z plane, and store the (x,y) coords
   // of each intersection in a vector called "matrix"
-  int          zSize = extent[5] - extent[4] + 1;
+  int          zSize = zLast - zFirst + 1;
   int          zInc = extent[3] - extent[2] + 1;
   Point2DArray matrix(zSize);
 
@@ -309,6 +322,16 @@ TriangleMeshToBinaryImageFilter< TInputMesh, TOutputImage >
       {
       zmax = extent[5] + 1;
       }
+
+    // restrict to the slab being rasterized
+    if ( zmin < zFirst )
+      {
+      zmin = zFirst;
+      }
+    if ( zmax > zLast + 1 )
+      {
+      zmax = zLast + 1;
+      }
     double temp = 1.0 / ( p2[2] - p1[2] );
     for ( int z = zmin; z < zmax; z++ )
       {
@@ -317,7 +340,7 @@ TriangleMeshToBinaryImageFilter< TInputMesh, TOutputImage >
       Point2DType XY;
       XY[0] = r * p1[0] + f * p2[0];
       XY[1] = r * p1[1] + f * p2[1];
-      matrix[z - extent[4]].push_back(XY);
+      matrix[z - zFirst].push_back(XY);
       }
 
     p1 = coords[i];
@@ -343,9 +366,9 @@ TriangleMeshToBinaryImageFilter< TInputMesh, TOutputImage >
   // except that 'x' is our depth value and we can store multiple
   // 'x' values per (y,z) value.
 
-  for ( int z = extent[4]; z <= extent[5]; z++ )
+  for ( int z = zFirst; z <= zLast; z++ )
     {
-    Point2DVector & xylist = matrix[z - extent[4]];
+    Point2DVector & xylist = matrix[z - zFirst];
 
     if ( xylist.empty() )
       {
@@ -439,6 +462,9 @@ TriangleMeshToBinaryImageFilter< TInputMesh, TOutputImage >
   Point1DArray zymatrix(zInc * zSize);
   PointVector  coords;
 
+  // gather the polygons up front so they can be rasterized in parallel
+  PointArray polygons;
+
   CellsContainerPointer  cells = input->GetCells();
   CellsContainerIterator cellIt = cells->Begin();
 
@@ -469,7 +495,7 @@ TriangleMeshToBinaryImageFilter< TInputMesh, TOutputImage >
           p[2] = newpoint[2];
           coords.push_back(p);
           }
-        this->PolygonToImageRaster(coords, zymatrix, extent);
+        polygons.push_back(coords);
         }
         break;
       default:
@@ -478,85 +504,152 @@ TriangleMeshToBinaryImageFilter< TInputMesh, TOutputImage >
     ++cellIt;
     }
 
-  //create the equivalent of vtkStencilData from our zymatrix
-  m_StencilIndex.clear(); //prevent corruption of the filter in later updates
-  for ( int z = extent[4]; z <= extent[5]; z++ )
+  // bucket the polygons by the z slices they can intersect, so that every
+  // slice knows its polygons without a scan over the whole surface
+  std::vector< std::vector< SizeValueType > > slicePolygons(zSize);
+  for ( SizeValueType polygonId = 0; polygonId < polygons.size(); polygonId++ )
     {
-    for ( int y = extent[2]; y <= extent[3]; y++ )
+    const PointVector & polygon = polygons[polygonId];
+
+    double zCoordinateMin = polygon[0][2];
+    double zCoordinateMax = polygon[0][2];
+    for ( size_t j = 1; j < polygon.size(); j++ )
       {
-      int           zyidx = ( z - extent[4] ) * zInc + ( y - extent[2] );
-      Point1DVector xlist = zymatrix[zyidx];
+      zCoordinateMin = ( polygon[j][2] < zCoordinateMin ) ? polygon[j][2] : zCoordinateMin;
+      zCoordinateMax = ( polygon[j][2] > zCoordinateMax ) ? polygon[j][2] : zCoordinateMax;
+      }
 
-      if ( xlist.size() <= 1 )
-        {
-        continue; //this is a peripheral point in the zy projection plane
-        }
-      else
+    // the edges intersect the integer z planes in [ceil(zmin), ceil(zmax)),
+    // with the same boundary treatment as PolygonToImageRaster
+    auto zLow = (int)( std::ceil(zCoordinateMin) );
+    auto zHigh = (int)( std::ceil(zCoordinateMax) );
+    if ( zLow < extent[4] )
+      {
+      zLow = extent[4];
+      }
+    if ( zHigh >= extent[5] )
+      {
+      zHigh = extent[5] + 1;
+      }
+    for ( int z = zLow; z < zHigh; z++ )
+      {
+      slicePolygons[z - extent[4]].push_back(polygonId);
+      }
+    }
+
+  // rasterize slice by slice; the slices write to disjoint rows of the
+  // zymatrix, so they can be processed concurrently
+  MultiThreaderBase * threader = this->GetMultiThreader();
+  threader->ParallelizeArray( 0, (SizeValueType)zSize,
+    [&](SizeValueType slice)
+      {
+      const int z = extent[4] + (int)slice;
+      for ( const SizeValueType polygonId : slicePolygons[slice] )
         {
-        std::sort(xlist.begin(), xlist.end(), ComparePoints1D);
+        Self::PolygonToImageRaster(polygons[polygonId], zymatrix, extent, z, z);
         }
-      //get the first entry
-      double lastx = xlist[0].m_X;
-      int lastSign = xlist[0].m_Sign;
-      int    signproduct = 1;
-
-      // if adjacent x values are within tolerance of each
-      // other, check whether the number of 'exits' and
-      // 'entrances' are equal (via signproduct) and if so,
-      // ignore all x values, but if not, then count
-      // them as a single intersection of the ray with the
-      // surface
-
-      std::vector< double > nlist;
-      size_t               m = xlist.size();
-      for ( size_t j = 1; j < m; j++ )
+      },
+    nullptr );
+
+  //create the equivalent of vtkStencilData from our zymatrix
+  m_StencilIndex.clear(); //prevent corruption of the filter in later updates
+
+  // each slice contributes a contiguous, ascending run of stencil indices,
+  // so the slices can be scan converted concurrently and concatenated
+  std::vector< StencilIndexVector > sliceStencil(zSize);
+  threader->ParallelizeArray( 0, (SizeValueType)zSize,
+    [&](SizeValueType slice)
+      {
+      const int z = extent[4] + (int)slice;
+      StencilIndexVector & stencilIndex = sliceStencil[slice];
+      for ( int y = extent[2]; y <= extent[3]; y++ )
         {
-        Point1D p1D = xlist[j];
-        double  x = p1D.m_X;
-        int     sign = p1D.m_Sign;
+        int           zyidx = ( z - extent[4] ) * zInc + ( y - extent[2] );
+        Point1DVector xlist = zymatrix[zyidx];
 
-        //check absolute distance from lastx to x
-        if ( std::abs(x - lastx) > m_Tolerance )
+        if ( xlist.size() <= 1 )
+          {
+          continue; //this is a peripheral point in the zy projection plane
+          }
+        else
           {
-          signproduct = sign * lastSign;
-          if ( signproduct < 0 )
+          std::sort(xlist.begin(), xlist.end(), ComparePoints1D);
+          }
+        //get the first entry
+        double lastx = xlist[0].m_X;
+        int lastSign = xlist[0].m_Sign;
+        int    signproduct = 1;
+
+        // if adjacent x values are within tolerance of each
+        // other, check whether the number of 'exits' and
+        // 'entrances' are equal (via signproduct) and if so,
+        // ignore all x values, but if not, then count
+        // them as a single intersection of the ray with the
+        // surface
+
+        std::vector< double > nlist;
+        size_t               m = xlist.size();
+        for ( size_t j = 1; j < m; j++ )
+          {
+          Point1D p1D = xlist[j];
+          double  x = p1D.m_X;
+          int     sign = p1D.m_Sign;
+
+          //check absolute distance from lastx to x
+          if ( std::abs(x - lastx) > m_Tolerance )
             {
-            nlist.push_back(lastx);
+            signproduct = sign * lastSign;
+            if ( signproduct < 0 )
+              {
+              nlist.push_back(lastx);
+              }
             }
+          lastx = x;
+          lastSign = sign;
           }
-        lastx = x;
-        lastSign = sign;
-        }
-
-        nlist.push_back(lastx);
 
-      // create the stencil extents
-      int minx1 = extent[0]; // minimum allowable x1 value
-      int n = (int)( nlist.size() ) / 2;
+          nlist.push_back(lastx);
 
-      for ( int i = 0; i < n; i++ )
-        {
-        auto x1 = (int)( std::ceil(nlist[2 * i]) );
-        auto x2 = (int)( std::floor(nlist[2 * i + 1]) );
+        // create the stencil extents
+        int minx1 = extent[0]; // minimum allowable x1 value
+        int n = (int)( nlist.size() ) / 2;
 
-        if ( x2 < extent[0] || x1 > ( extent[1] ) )
+        for ( int i = 0; i < n; i++ )
           {
-          continue;
-          }
-        x1 = ( x1 > minx1 ) ? ( x1 ) : ( minx1 );         // max(x1,minx1)
-        x2 = ( x2 < extent[1] ) ? ( x2 ) : ( extent[1] ); //min(x2,extent[1])
+          auto x1 = (int)( std::ceil(nlist[2 * i]) );
+          auto x2 = (int)( std::floor(nlist[2 * i + 1]) );
 
-        if ( x2 >= x1 )
-          {
-          for ( int idX = x1; idX <= x2; idX++ )
+          if ( x2 < extent[0] || x1 > ( extent[1] ) )
             {
-            m_StencilIndex.push_back(idX + y * m_Size[0] + z * m_Size[0] * m_Size[1]);
+            continue;
             }
+          x1 = ( x1 > minx1 ) ? ( x1 ) : ( minx1 );         // max(x1,minx1)
+          x2 = ( x2 < extent[1] ) ? ( x2 ) : ( extent[1] ); //min(x2,extent[1])
+
+          if ( x2 >= x1 )
+            {
+            for ( int idX = x1; idX <= x2; idX++ )
+              {
+              stencilIndex.push_back(idX + y * m_Size[0] + z * m_Size[0] * m_Size[1]);
+              }
+            }
+          // next x1 value must be at least x2+1
+          minx1 = x2 + 1;
           }
-        // next x1 value must be at least x2+1
-        minx1 = x2 + 1;
         }
-      }
+      },
+    nullptr );
+
+  // concatenating the slices in order keeps m_StencilIndex sorted
+  size_t totalNumberOfIndices = 0;
+  for ( int slice = 0; slice < zSize; slice++ )
+    {
+    totalNumberOfIndices += sliceStencil[slice].size();
+    }
+  m_StencilIndex.reserve(totalNumberOfIndices);
+  for ( int slice = 0; slice < zSize; slice++ )
+    {
+    m_StencilIndex.insert( m_StencilIndex.end(), sliceStencil[slice].begin(), sliceStencil[slice].end() );
     }
 }
 
@@ -651,5 +651,42 @@ int itkMeshTest(int, char* [] )
 
   std::cout << newMesh << std::endl;
 
+  /**
+   * Check that the packed cell links agree with the per-point sets.
+   */
+  mesh->BuildCellLinks();
+
+  const std::vector< itk::SizeValueType > & linkOffsets =
+    mesh->GetPackedCellLinksOffsets();
+  const std::vector< MeshType::CellIdentifier > & packedLinks =
+    mesh->GetPackedCellLinks();
+
+  if( linkOffsets.size() < mesh->GetNumberOfPoints() + 1 )
+    {
+    std::cerr << "Packed cell links offsets do not cover all points" << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  for( itk::SizeValueType pointId = 0;
+       pointId + 1 < linkOffsets.size(); ++pointId )
+    {
+    std::set< MeshType::CellIdentifier > packedRow(
+      packedLinks.begin() + linkOffsets[pointId],
+      packedLinks.begin() + linkOffsets[pointId + 1] );
+
+    MeshType::PointCellLinksContainer linkSet;
+    if( mesh->GetCellLinks()->IndexExists( pointId ) )
+      {
+      linkSet = mesh->GetCellLinks()->ElementAt( pointId );
+      }
+
+    if( packedRow != linkSet )
+      {
+      std::cerr << "Packed cell links disagree with the cell links set "
+                << "of point " << pointId << std::endl;
+      return EXIT_FAILURE;
+      }
+    }
+
   return EXIT_SUCCESS;
 }
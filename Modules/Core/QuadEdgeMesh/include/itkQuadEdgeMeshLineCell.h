@@ -207,6 +207,17 @@ private:
   CellIdentifier          m_Identifier;
   QEType *                m_QuadEdgeGeom;
   mutable PointIdentifier m_PointIds[2];
+
+  /** The four edges of the quad are stored by value inside the cell, in
+   * rotation order, instead of being allocated individually on the heap.
+   * Walking the Rot() ring of an edge then stays within a single
+   * allocation block, and creating an edge costs one allocation instead
+   * of five. m_QuadEdgeGeom points at m_QuadEdgeStorage and the links
+   * are wired once by the constructor. */
+  QEType m_QuadEdgeStorage;
+  QEDual m_DualEdgeStorageA;
+  QEType m_SymEdgeStorage;
+  QEDual m_DualEdgeStorageB;
 };
 } // end namespace itk
 
@@ -29,11 +29,14 @@ QuadEdgeMeshLineCell< TCellInterface >
 ::QuadEdgeMeshLineCell()
 {
   m_Identifier = 0;
-  m_QuadEdgeGeom = new QEType;
 
-  auto * e2 = new QEType;
-  auto * e1 = new QEDual;
-  auto * e3 = new QEDual;
+  // The quad lives inside this cell (see the member declarations): wire
+  // the rotation ring through the embedded edges.
+  m_QuadEdgeGeom = &m_QuadEdgeStorage;
+
+  QEType *e2 = &m_SymEdgeStorage;
+  QEDual *e1 = &m_DualEdgeStorageA;
+  QEDual *e3 = &m_DualEdgeStorageB;
   this->m_QuadEdgeGeom->SetRot(e1);
   e1->SetRot(e2);
   e2->SetRot(e3);
@@ -57,51 +60,8 @@ QuadEdgeMeshLineCell< TCellInterface >
   //  m_QuadEdgeGeom->Disconnect( );
   //  }
 
-  bool FoundNullPointer = false;
-
-  if ( m_QuadEdgeGeom )
-    {
-    if ( m_QuadEdgeGeom->GetRot() )
-      {
-      if ( m_QuadEdgeGeom->GetRot()->GetRot() )
-        {
-        if ( m_QuadEdgeGeom->GetRot()->GetRot()->GetRot() )
-          {
-          delete m_QuadEdgeGeom->GetRot()->GetRot()->GetRot();    //e3
-          delete m_QuadEdgeGeom->GetRot()->GetRot();              //e2
-          delete m_QuadEdgeGeom->GetRot();                        //e1
-          delete m_QuadEdgeGeom;
-          }
-        else
-          {
-          FoundNullPointer = true;
-          delete m_QuadEdgeGeom->GetRot()->GetRot();              //e2
-          delete m_QuadEdgeGeom->GetRot();                        //e1
-          delete m_QuadEdgeGeom;
-          }
-        }
-      else
-        {
-        FoundNullPointer = true;
-        delete m_QuadEdgeGeom->GetRot();                        //e1
-        delete m_QuadEdgeGeom;
-        }
-      }
-    else
-      {
-      FoundNullPointer = true;
-      delete m_QuadEdgeGeom;
-      }
-    }
-  else
-    {
-    FoundNullPointer = true;
-    }
-
-  if ( FoundNullPointer )
-    {
-    //Throw exception here
-    }
+  // The four edges of the quad are stored by value inside the cell and
+  // are released together with it.
 }
 
 // ---------------------------------------------------------------------
@@ -430,29 +430,25 @@ int itkQuadEdgeMeshCellInterfaceTest(int, char* [] )
 
   mesh->Accept(   multiVisitor );
 
-  // test 4 very specific QELineCell destructor cases
+  // the four edges of the quad are laid out inside the cell: check that
+  // the rotation ring of a freshly built cell is complete and closed
   auto * test = new QELineCellType();
   QEType* m_QuadEdgeGeom = test->GetQEGeom( );
-  delete m_QuadEdgeGeom->GetRot( )->GetRot( )->GetRot( );
-  m_QuadEdgeGeom->GetRot( )->GetRot( )->SetRot( nullptr );
-  delete test;
-
-  test = new QELineCellType();
-  m_QuadEdgeGeom = test->GetQEGeom( );
-  delete m_QuadEdgeGeom->GetRot( )->GetRot( )->GetRot( );
-  m_QuadEdgeGeom->GetRot( )->GetRot( )->SetRot( nullptr );
-  delete m_QuadEdgeGeom->GetRot( )->GetRot( );
-  m_QuadEdgeGeom->GetRot( )->SetRot( nullptr );
-  delete test;
-
-  test = new QELineCellType();
-  m_QuadEdgeGeom = test->GetQEGeom( );
-  delete m_QuadEdgeGeom->GetRot( )->GetRot( )->GetRot( );
-  m_QuadEdgeGeom->GetRot( )->GetRot( )->SetRot( nullptr );
-  delete m_QuadEdgeGeom->GetRot( )->GetRot( );
-  m_QuadEdgeGeom->GetRot( )->SetRot( nullptr );
-  delete m_QuadEdgeGeom->GetRot( );
-  m_QuadEdgeGeom->SetRot( nullptr );
+  if( !m_QuadEdgeGeom->GetRot( )
+      || !m_QuadEdgeGeom->GetRot( )->GetRot( )
+      || !m_QuadEdgeGeom->GetRot( )->GetRot( )->GetRot( ) )
+    {
+    std::cerr << "The quad of a new line cell is incomplete." << std::endl;
+    delete test;
+    return EXIT_FAILURE;
+    }
+  if( m_QuadEdgeGeom->GetRot( )->GetRot( )->GetRot( )->GetRot( )
+      != m_QuadEdgeGeom )
+    {
+    std::cerr << "The rotation ring of a new line cell is not closed." << std::endl;
+    delete test;
+    return EXIT_FAILURE;
+    }
   delete test;
 
   return status;
@@ -19,6 +19,7 @@
 #define itkGroupSpatialObject_h
 
 #include <list>
+#include <vector>
 
 #include "itkSpatialObject.h"
 
@@ -49,6 +50,11 @@ public:
   using ScalarType = double;
   using TreeNodeType = typename Superclass::TreeNodeType;
   using TreeNodeChildrenListType = typename TreeNodeType::ChildrenListType;
+  using PointType = typename Superclass::PointType;
+  using BoundingBoxType = typename Superclass::BoundingBoxType;
+  using SpatialObjectType = SpatialObject< TDimension >;
+  using SpatialObjectPointer = typename SpatialObjectType::Pointer;
+  using ChildrenListType = typename Superclass::ChildrenListType;
 
   /** Method for creation through the object factory. */
   itkNewMacro(Self);
@@ -59,12 +65,61 @@ public:
   /**  */
   bool ComputeLocalBoundingBox() const override { return false; }
 
+  /** Accelerate point queries with a bounding volume hierarchy built over
+   * the bounding boxes of the children of this group. The hierarchy is
+   * rebuilt lazily whenever a child was added, removed or modified since
+   * the last query, so moving objects around between queries remains
+   * cheap. Off by default; when off, queries visit every child in turn
+   * as any other spatial object does. */
+  itkSetMacro(UseBoundingVolumeHierarchy, bool);
+  itkGetConstMacro(UseBoundingVolumeHierarchy, bool);
+  itkBooleanMacro(UseBoundingVolumeHierarchy);
+
+  /** Returns true if a point is inside one of the children of the group.
+   * When the bounding volume hierarchy is enabled and no name filter is
+   * given, only the children whose bounding boxes contain the point are
+   * visited. */
+  bool IsInside(const PointType & point, unsigned int depth = 0,
+                char *name = nullptr) const override;
+
+  /** Returns the child whose axis-aligned bounding box is the closest to
+   * the given point, or the child that contains it. The distance is
+   * measured to the bounding boxes, not to the objects themselves.
+   * Returns nullptr if the group has no child with defined bounds. */
+  SpatialObjectType * GetNearestChildObject(const PointType & point) const;
+
 protected:
   GroupSpatialObject();
   ~GroupSpatialObject() override;
 
   /** Method to print the object.*/
   void PrintSelf(std::ostream & os, Indent indent) const override;
+
+  /** A node of the bounding volume hierarchy. Leaves reference a child
+   * of the group, interior nodes reference two subtrees. */
+  struct BVHNodeType
+    {
+    PointType m_Minimum;
+    PointType m_Maximum;
+    int m_Subtrees[2];             // indices into m_BVHNodes, -1 on leaves
+    SpatialObjectPointer m_Object; // only set on leaves
+    };
+
+  /** Rebuild the hierarchy if the group or one of its children was
+   * modified since the last build. */
+  void UpdateBoundingVolumeHierarchy() const;
+
+  /** Recursively build the subtree covering leaves [first,last] and
+   * return its node index. */
+  int BuildBVHSubtree(std::vector< BVHNodeType > & leaves, int first,
+                      int last) const;
+
+private:
+  bool m_UseBoundingVolumeHierarchy{ false };
+
+  mutable std::vector< BVHNodeType > m_BVHNodes;
+  mutable ChildrenListType           m_BVHUnboundedChildren;
+  mutable ModifiedTimeType           m_BVHTimeStamp{ 0 };
 };
 } // end namespace itk
 
@@ -21,6 +21,8 @@
 
 #include "itkGroupSpatialObject.h"
 
+#include <algorithm>
+
 namespace itk
 {
 /** Constructor */
@@ -42,6 +44,267 @@ template< unsigned int TDimension >
 GroupSpatialObject< TDimension >
 ::~GroupSpatialObject() = default;
 
+/** Recursively build the subtree covering leaves [first,last] */
+template< unsigned int TDimension >
+int
+GroupSpatialObject< TDimension >
+::BuildBVHSubtree(std::vector< BVHNodeType > & leaves, int first, int last) const
+{
+  if ( first == last )
+    {
+    m_BVHNodes.push_back(leaves[first]);
+    return static_cast< int >( m_BVHNodes.size() ) - 1;
+    }
+
+  BVHNodeType node;
+  node.m_Minimum = leaves[first].m_Minimum;
+  node.m_Maximum = leaves[first].m_Maximum;
+  for ( int i = first + 1; i <= last; i++ )
+    {
+    for ( unsigned int d = 0; d < TDimension; d++ )
+      {
+      node.m_Minimum[d] = std::min(node.m_Minimum[d], leaves[i].m_Minimum[d]);
+      node.m_Maximum[d] = std::max(node.m_Maximum[d], leaves[i].m_Maximum[d]);
+      }
+    }
+
+  // Split at the median of the box centers along the widest axis
+  unsigned int axis = 0;
+  ScalarType   width = node.m_Maximum[0] - node.m_Minimum[0];
+  for ( unsigned int d = 1; d < TDimension; d++ )
+    {
+    if ( node.m_Maximum[d] - node.m_Minimum[d] > width )
+      {
+      width = node.m_Maximum[d] - node.m_Minimum[d];
+      axis = d;
+      }
+    }
+
+  const int middle = first + ( last - first ) / 2;
+  std::nth_element( leaves.begin() + first, leaves.begin() + middle,
+                    leaves.begin() + last + 1,
+                    [axis](const BVHNodeType & a, const BVHNodeType & b) {
+                      return a.m_Minimum[axis] + a.m_Maximum[axis]
+                             < b.m_Minimum[axis] + b.m_Maximum[axis];
+                    } );
+
+  node.m_Subtrees[0] = this->BuildBVHSubtree(leaves, first, middle);
+  node.m_Subtrees[1] = this->BuildBVHSubtree(leaves, middle + 1, last);
+  m_BVHNodes.push_back(node);
+  return static_cast< int >( m_BVHNodes.size() ) - 1;
+}
+
+/** Rebuild the hierarchy if a child was added, removed or modified */
+template< unsigned int TDimension >
+void
+GroupSpatialObject< TDimension >
+::UpdateBoundingVolumeHierarchy() const
+{
+  if ( m_BVHTimeStamp >= this->GetMTime() )
+    {
+    return;
+    }
+
+  m_BVHNodes.clear();
+  m_BVHUnboundedChildren.clear();
+
+  ChildrenListType *children = this->GetChildren(0);
+  std::vector< BVHNodeType > leaves;
+  leaves.reserve( children->size() );
+
+  auto it = children->begin();
+  auto itEnd = children->end();
+  while ( it != itEnd )
+    {
+    ( *it )->ComputeBoundingBox();
+    const typename BoundingBoxType::BoundsArrayType & bounds =
+      ( *it )->GetBoundingBox()->GetBounds();
+
+    // A box collapsed onto the origin is the convention for undefined
+    // bounds: such children cannot be culled and are always visited
+    bool bbDefined = false;
+    for ( unsigned int d = 0; d < TDimension; d++ )
+      {
+      if ( Math::NotExactlyEquals(bounds[2 * d], 0)
+           || Math::NotExactlyEquals(bounds[2 * d + 1], 0) )
+        {
+        bbDefined = true;
+        break;
+        }
+      }
+
+    if ( bbDefined )
+      {
+      BVHNodeType leaf;
+      leaf.m_Minimum = ( *it )->GetBoundingBox()->GetMinimum();
+      leaf.m_Maximum = ( *it )->GetBoundingBox()->GetMaximum();
+      leaf.m_Subtrees[0] = -1;
+      leaf.m_Subtrees[1] = -1;
+      leaf.m_Object = *it;
+      leaves.push_back(leaf);
+      }
+    else
+      {
+      m_BVHUnboundedChildren.push_back(*it);
+      }
+    it++;
+    }
+  delete children;
+
+  if ( !leaves.empty() )
+    {
+    m_BVHNodes.reserve(2 * leaves.size() - 1);
+    this->BuildBVHSubtree( leaves, 0, static_cast< int >( leaves.size() ) - 1 );
+    }
+
+  // Computing the child bounding boxes above modifies the children, so
+  // the time stamp has to be taken after the build
+  m_BVHTimeStamp = this->GetMTime();
+}
+
+/** Return if a point is inside one of the children of the group */
+template< unsigned int TDimension >
+bool
+GroupSpatialObject< TDimension >
+::IsInside(const PointType & point, unsigned int depth, char *name) const
+{
+  if ( !m_UseBoundingVolumeHierarchy || name != nullptr )
+    {
+    return Superclass::IsInside(point, depth, name);
+    }
+
+  if ( depth == 0 )
+    {
+    return false;
+    }
+
+  this->UpdateBoundingVolumeHierarchy();
+
+  for ( auto it = m_BVHUnboundedChildren.begin();
+        it != m_BVHUnboundedChildren.end(); ++it )
+    {
+    if ( ( *it )->IsInside(point, depth - 1, name) )
+      {
+      return true;
+      }
+    }
+
+  if ( m_BVHNodes.empty() )
+    {
+    return false;
+    }
+
+  std::vector< int > stack;
+  stack.push_back( static_cast< int >( m_BVHNodes.size() ) - 1 );
+  while ( !stack.empty() )
+    {
+    const BVHNodeType & node = m_BVHNodes[stack.back()];
+    stack.pop_back();
+
+    bool insideBox = true;
+    for ( unsigned int d = 0; d < TDimension; d++ )
+      {
+      if ( point[d] < node.m_Minimum[d] || point[d] > node.m_Maximum[d] )
+        {
+        insideBox = false;
+        break;
+        }
+      }
+    if ( !insideBox )
+      {
+      continue;
+      }
+
+    if ( node.m_Subtrees[0] < 0 )
+      {
+      if ( node.m_Object->IsInside(point, depth - 1, name) )
+        {
+        return true;
+        }
+      }
+    else
+      {
+      stack.push_back(node.m_Subtrees[0]);
+      stack.push_back(node.m_Subtrees[1]);
+      }
+    }
+
+  return false;
+}
+
+/** Return the child whose bounding box is the closest to the point */
+template< unsigned int TDimension >
+typename GroupSpatialObject< TDimension >::SpatialObjectType *
+GroupSpatialObject< TDimension >
+::GetNearestChildObject(const PointType & point) const
+{
+  this->UpdateBoundingVolumeHierarchy();
+
+  if ( m_BVHNodes.empty() )
+    {
+    return nullptr;
+    }
+
+  auto boxDistance2 = [&point](const BVHNodeType & node) {
+    ScalarType distance2 = 0.;
+    for ( unsigned int d = 0; d < TDimension; d++ )
+      {
+      if ( point[d] < node.m_Minimum[d] )
+        {
+        distance2 += ( node.m_Minimum[d] - point[d] )
+                     * ( node.m_Minimum[d] - point[d] );
+        }
+      else if ( point[d] > node.m_Maximum[d] )
+        {
+        distance2 += ( point[d] - node.m_Maximum[d] )
+                     * ( point[d] - node.m_Maximum[d] );
+        }
+      }
+    return distance2;
+  };
+
+  SpatialObjectType *nearest = nullptr;
+  ScalarType         bestDistance2 = NumericTraits< ScalarType >::max();
+
+  std::vector< int > stack;
+  stack.push_back( static_cast< int >( m_BVHNodes.size() ) - 1 );
+  while ( !stack.empty() )
+    {
+    const BVHNodeType & node = m_BVHNodes[stack.back()];
+    stack.pop_back();
+
+    const ScalarType distance2 = boxDistance2(node);
+    if ( distance2 >= bestDistance2 )
+      {
+      continue;
+      }
+
+    if ( node.m_Subtrees[0] < 0 )
+      {
+      nearest = node.m_Object;
+      bestDistance2 = distance2;
+      }
+    else
+      {
+      // Descend into the closer subtree first to tighten the bound early
+      const int left = node.m_Subtrees[0];
+      const int right = node.m_Subtrees[1];
+      if ( boxDistance2(m_BVHNodes[left]) < boxDistance2(m_BVHNodes[right]) )
+        {
+        stack.push_back(right);
+        stack.push_back(left);
+        }
+      else
+        {
+        stack.push_back(left);
+        stack.push_back(right);
+        }
+      }
+    }
+
+  return nearest;
+}
+
 /** Print the object */
 template< unsigned int TDimension >
 void
@@ -49,6 +312,8 @@ GroupSpatialObject< TDimension >
 ::PrintSelf(std::ostream & os, Indent indent) const
 {
   os << indent << "GroupSpatialObject(" << this << ")" << std::endl;
+  os << indent << "Use bounding volume hierarchy: "
+     << m_UseBoundingVolumeHierarchy << std::endl;
   Superclass::PrintSelf(os, indent);
 }
 } // end namespace itk
@@ -18,6 +18,8 @@
 #ifndef itkImageMaskSpatialObject_h
 #define itkImageMaskSpatialObject_h
 
+#include <vector>
+
 #include "itkImageSpatialObject.h"
 #include "itkImageSliceConstIteratorWithIndex.h"
 
@@ -89,11 +91,41 @@ public:
    *  changed. */
   bool ComputeLocalBoundingBox() const override;
 
+  /** Returns the number of non-zero pixels of the mask image. The
+   * run-length encoding of the mask is built lazily on the first call
+   * and refreshed whenever the mask image is modified. */
+  SizeValueType GetNumberOfOnPixels() const;
+
+  /** Draw sample points uniformly among the non-zero pixels of the mask,
+   * in world space. The points are generated directly from the run-length
+   * encoding of the mask, so no candidate point is ever rejected; this is
+   * much faster than rejection sampling against IsInside() when the mask
+   * covers a small fraction of its image. The container is cleared first
+   * and stays empty if the mask has no non-zero pixel. */
+  void DrawSamples(SizeValueType numberOfSamples,
+                   std::vector< PointType > & samples) const;
+
 protected:
   ImageMaskSpatialObject();
   ~ImageMaskSpatialObject() override;
 
   void PrintSelf(std::ostream & os, Indent indent) const override;
+
+  /** A run of consecutive non-zero mask pixels along the fastest axis. */
+  struct RunLengthSegmentType
+    {
+    IndexType     m_Index;           // first pixel of the run
+    SizeValueType m_Length;          // number of pixels in the run
+    SizeValueType m_CumulativeCount; // non-zero pixels before this run
+    };
+
+  /** Rebuild the run-length encoding if the mask image was modified. */
+  void UpdateRunLengthEncoding() const;
+
+private:
+  mutable std::vector< RunLengthSegmentType > m_RunLengthSegments;
+  mutable SizeValueType                       m_NumberOfOnPixels{ 0 };
+  mutable ModifiedTimeType                    m_RunLengthTimeStamp{ 0 };
 };
 } // end of namespace itk
 
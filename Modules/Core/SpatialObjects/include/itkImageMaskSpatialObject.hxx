@@ -18,9 +18,12 @@
 #ifndef itkImageMaskSpatialObject_hxx
 #define itkImageMaskSpatialObject_hxx
 
+#include <algorithm>
+
 #include "itkMath.h"
 #include "itkImageMaskSpatialObject.h"
 #include "itkImageRegionConstIteratorWithIndex.h"
+#include "itkMersenneTwisterRandomVariateGenerator.h"
 
 namespace itk
 {
@@ -312,6 +315,130 @@ ImageMaskSpatialObject< TDimension >
 }
 
 
+/** Rebuild the run-length encoding if the mask image was modified */
+template< unsigned int TDimension >
+void
+ImageMaskSpatialObject< TDimension >
+::UpdateRunLengthEncoding() const
+{
+  const ImageType *image = this->GetImage();
+  if ( !image )
+    {
+    m_RunLengthSegments.clear();
+    m_NumberOfOnPixels = 0;
+    return;
+    }
+
+  const ModifiedTimeType latestTime =
+    std::max( this->GetMTime(), image->GetMTime() );
+  if ( m_RunLengthTimeStamp >= latestTime )
+    {
+    return;
+    }
+
+  m_RunLengthSegments.clear();
+  m_NumberOfOnPixels = 0;
+
+  const RegionType region = image->GetBufferedRegion();
+  const IndexValueType firstColumn = region.GetIndex(0);
+  const PixelType outsideValue = NumericTraits< PixelType >::ZeroValue();
+
+  ImageRegionConstIteratorWithIndex< ImageType > it(image, region);
+  RunLengthSegmentType run;
+  bool                 inRun = false;
+
+  for ( it.GoToBegin(); !it.IsAtEnd(); ++it )
+    {
+    const bool on = ( it.Get() != outsideValue );
+    if ( on )
+      {
+      // A run ends at the end of a scanline even if the mask continues
+      // on the next one
+      if ( inRun && it.GetIndex()[0] != firstColumn )
+        {
+        ++run.m_Length;
+        continue;
+        }
+      if ( inRun )
+        {
+        m_RunLengthSegments.push_back(run);
+        m_NumberOfOnPixels += run.m_Length;
+        }
+      run.m_Index = it.GetIndex();
+      run.m_Length = 1;
+      run.m_CumulativeCount = m_NumberOfOnPixels;
+      inRun = true;
+      }
+    else if ( inRun )
+      {
+      m_RunLengthSegments.push_back(run);
+      m_NumberOfOnPixels += run.m_Length;
+      inRun = false;
+      }
+    }
+  if ( inRun )
+    {
+    m_RunLengthSegments.push_back(run);
+    m_NumberOfOnPixels += run.m_Length;
+    }
+
+  m_RunLengthTimeStamp = latestTime;
+}
+
+/** Return the number of non-zero pixels of the mask */
+template< unsigned int TDimension >
+SizeValueType
+ImageMaskSpatialObject< TDimension >
+::GetNumberOfOnPixels() const
+{
+  this->UpdateRunLengthEncoding();
+  return m_NumberOfOnPixels;
+}
+
+/** Draw sample points uniformly among the non-zero pixels of the mask */
+template< unsigned int TDimension >
+void
+ImageMaskSpatialObject< TDimension >
+::DrawSamples(SizeValueType numberOfSamples,
+              std::vector< PointType > & samples) const
+{
+  this->UpdateRunLengthEncoding();
+
+  samples.clear();
+  if ( m_NumberOfOnPixels == 0 )
+    {
+    return;
+    }
+  samples.reserve(numberOfSamples);
+
+  typename Statistics::MersenneTwisterRandomVariateGenerator::Pointer
+    generator = Statistics::MersenneTwisterRandomVariateGenerator::GetInstance();
+
+  for ( SizeValueType i = 0; i < numberOfSamples; i++ )
+    {
+    const SizeValueType draw =
+      generator->GetIntegerVariate(m_NumberOfOnPixels - 1);
+
+    // Find the run holding the drawn pixel
+    auto segment = std::upper_bound(
+        m_RunLengthSegments.begin(), m_RunLengthSegments.end(), draw,
+        [](SizeValueType value, const RunLengthSegmentType & s) {
+          return value < s.m_CumulativeCount;
+        } );
+    --segment;
+
+    IndexType index = segment->m_Index;
+    index[0] += static_cast< IndexValueType >( draw - segment->m_CumulativeCount );
+
+    PointType point;
+    for ( unsigned int d = 0; d < TDimension; d++ )
+      {
+      point[d] = static_cast< typename PointType::CoordRepType >( index[d] );
+      }
+    samples.push_back( this->GetIndexToWorldTransform()->TransformPoint(point) );
+    }
+}
+
 /** Print the object */
 template< unsigned int TDimension >
 void
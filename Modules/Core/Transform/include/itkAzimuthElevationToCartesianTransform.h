@@ -142,6 +142,11 @@ public:
   /** Transform from azimuth-elevation to cartesian. */
   OutputPointType     TransformPoint(const InputPointType  & point) const override;
 
+  /** Transform a batch of points. The mapping is not the superclass
+   * affine transform, so each point goes through TransformPoint(). */
+  void TransformPoints(const std::vector< InputPointType > & inputPoints,
+                       std::vector< OutputPointType > & outputPoints) const override;
+
   /** Back transform from cartesian to azimuth-elevation.  */
   inline InputPointType  BackTransform(const OutputPointType  & point) const
   {
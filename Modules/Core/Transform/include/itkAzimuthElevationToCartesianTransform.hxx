@@ -90,6 +90,22 @@ AzimuthElevationToCartesianTransform<TParametersValueType, NDimensions>::Transfo
   return result;
 }
 
+/** Transform a batch of points one by one */
+template<typename TParametersValueType, unsigned int NDimensions>
+void
+AzimuthElevationToCartesianTransform<TParametersValueType, NDimensions>
+::TransformPoints(const std::vector< InputPointType > & inputPoints,
+                  std::vector< OutputPointType > & outputPoints) const
+{
+  const SizeValueType numberOfPoints = inputPoints.size();
+
+  outputPoints.resize(numberOfPoints);
+  for( SizeValueType n = 0; n < numberOfPoints; ++n )
+    {
+    outputPoints[n] = this->TransformPoint( inputPoints[n] );
+    }
+}
+
 /** Transform a point, from azimuth-elevation to cartesian */
 template<typename TParametersValueType, unsigned int NDimensions>
 typename AzimuthElevationToCartesianTransform<TParametersValueType, NDimensions>
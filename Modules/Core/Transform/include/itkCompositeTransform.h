@@ -247,6 +247,12 @@ public:
   */
   OutputPointType TransformPoint( const InputPointType & inputPoint ) const override;
 
+  /** Transform a batch of points. The whole batch is handed to each
+   * sub-transform in reverse queue order, so the sub-transforms can
+   * use their own batched implementations. */
+  void TransformPoints(const std::vector< InputPointType > & inputPoints,
+                       std::vector< OutputPointType > & outputPoints) const override;
+
   /**  Method to transform a vector. */
   using Superclass::TransformVector;
   OutputVectorType TransformVector(const InputVectorType &) const override;
@@ -359,6 +365,28 @@ public:
    */
   virtual void FlattenTransformQueue();
 
+  /**
+   * Replace every run of two or more adjacent linear sub-transforms
+   * with a single AffineTransform equal to their composition, so that
+   * mapping a point through the queue pays for one matrix apply
+   * instead of one per member. Nested composite transforms are not
+   * fused; call FlattenTransformQueue() first to expose their members.
+   * The fused members are replaced by a transform with different
+   * parameters, so this is meant for transforms that are applied
+   * (e.g. resampling), not optimized; the fused member is marked as
+   * not to be optimized.
+   */
+  virtual void FuseLinearTransforms();
+
+  /**
+   * Return an equivalent composite transform whose adjacent linear
+   * sub-transforms have been fused as by FuseLinearTransforms(). The
+   * result is cached and rebuilt only when this transform or one of
+   * its sub-transforms has been modified, so repeated resampling
+   * passes reuse the fused form while this transform stays untouched.
+   */
+  typename Self::Pointer GetFusedCompositeTransform() const;
+
   /**
    * Compute the Jacobian with respect to the parameters for the compositie
    * transform using Jacobian rule. See comments in the implementation.
@@ -418,8 +446,20 @@ protected:
   mutable TransformsToOptimizeFlagsType m_TransformsToOptimizeFlags;
 
 private:
+  /** Build the fused version of the current queue and the matching
+   * optimize flags. Returns true when at least one run was fused. */
+  bool BuildFusedTransformQueue( TransformQueueType & fusedQueue,
+                                 TransformsToOptimizeFlagsType & fusedFlags ) const;
+
+  /** Latest modification time of this transform and its members, used
+   * to decide whether the cached fused transform is stale. */
+  ModifiedTimeType GetLatestMemberModifiedTime() const;
+
   mutable ModifiedTimeType m_PreviousTransformsToOptimizeUpdateTime;
 
+  mutable Pointer          m_FusedCompositeTransform;
+  mutable ModifiedTimeType m_PreviousFusedCompositeUpdateTime{ 0 };
+
 };
 
 } // end namespace itk
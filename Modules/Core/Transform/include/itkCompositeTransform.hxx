@@ -20,6 +20,15 @@
 
 #include "itkCompositeTransform.h"
 
+#include "itkAffineTransform.h"
+#include "itkAzimuthElevationToCartesianTransform.h"
+#include "itkIdentityTransform.h"
+#include "itkMatrixOffsetTransformBase.h"
+#include "itkScaleTransform.h"
+#include "itkTranslationTransform.h"
+
+#include <deque>
+
 namespace itk
 {
 
@@ -97,6 +106,29 @@ CompositeTransform<TParametersValueType, NDimensions>
   return outputPoint;
 }
 
+template<typename TParametersValueType, unsigned int NDimensions>
+void
+CompositeTransform<TParametersValueType, NDimensions>
+::TransformPoints( const std::vector< InputPointType > & inputPoints,
+                   std::vector< OutputPointType > & outputPoints ) const
+{
+  /* Apply in reverse queue order, forwarding the whole batch to every
+   * sub-transform so their own batched implementations are used. */
+  outputPoints.assign( inputPoints.begin(), inputPoints.end() );
+
+  std::vector< InputPointType > intermediatePoints;
+
+  typename TransformQueueType::const_iterator it( this->m_TransformQueue.end() );
+  const typename TransformQueueType::const_iterator beginit( this->m_TransformQueue.begin() );
+  do
+    {
+    it--;
+    intermediatePoints.swap( outputPoints );
+    (*it)->TransformPoints( intermediatePoints, outputPoints );
+    }
+  while( it != beginit );
+}
+
 
 template<typename TParametersValueType, unsigned int NDimensions>
 typename CompositeTransform<TParametersValueType, NDimensions>
@@ -1110,6 +1142,166 @@ CompositeTransform<TParametersValueType, NDimensions>
 }
 
 
+template<typename TParametersValueType, unsigned int NDimensions>
+bool
+CompositeTransform<TParametersValueType, NDimensions>
+::BuildFusedTransformQueue( TransformQueueType & fusedQueue,
+                            TransformsToOptimizeFlagsType & fusedFlags ) const
+{
+  using MatrixOffsetTransformType =
+    MatrixOffsetTransformBase<TParametersValueType, NDimensions, NDimensions>;
+  using TranslationTransformType =
+    TranslationTransform<TParametersValueType, NDimensions>;
+  using IdentityTransformType =
+    IdentityTransform<TParametersValueType, NDimensions>;
+  using FusedTransformType = AffineTransform<TParametersValueType, NDimensions>;
+
+  fusedQueue.clear();
+  fusedFlags.clear();
+
+  bool anyFused = false;
+
+  const SizeValueType numberOfTransforms = this->GetNumberOfTransforms();
+
+  std::deque<SizeValueType> run; // adjacent fusible members, in queue order
+
+  /* An extra iteration flushes the trailing run. */
+  for( SizeValueType m = 0; m <= numberOfTransforms; m++ )
+    {
+    bool fusible = false;
+    if( m < numberOfTransforms )
+      {
+      const TransformType * member = this->GetNthTransformConstPointer( m );
+      /* The matrix and offset of a MatrixOffsetTransformBase describe
+       * the mapping exactly, except for ScaleTransform and
+       * AzimuthElevationToCartesianTransform which redefine
+       * TransformPoint without keeping the matrix in sync. */
+      fusible =
+        ( dynamic_cast<const MatrixOffsetTransformType *>( member ) != nullptr
+          || dynamic_cast<const TranslationTransformType *>( member ) != nullptr
+          || dynamic_cast<const IdentityTransformType *>( member ) != nullptr )
+        && dynamic_cast<const ScaleTransform<TParametersValueType, NDimensions> *>( member ) == nullptr
+        && dynamic_cast<const AzimuthElevationToCartesianTransform<TParametersValueType, NDimensions> *>( member ) == nullptr;
+      }
+
+    if( fusible )
+      {
+      run.push_back( m );
+      continue;
+      }
+
+    if( run.size() >= 2 )
+      {
+      /* Members are applied from the back of the queue to the front,
+       * so the run is composed in reverse queue order; each member is
+       * post-composed onto the transforms already accumulated. */
+      typename FusedTransformType::Pointer fusedTransform = FusedTransformType::New();
+      for( auto r = run.rbegin(); r != run.rend(); ++r )
+        {
+        const TransformType *member = this->GetNthTransformConstPointer( *r );
+        const auto *matrixMember = dynamic_cast<const MatrixOffsetTransformType *>( member );
+        if( matrixMember )
+          {
+          fusedTransform->Compose( matrixMember );
+          continue;
+          }
+        const auto *translationMember = dynamic_cast<const TranslationTransformType *>( member );
+        if( translationMember )
+          {
+          fusedTransform->Translate( translationMember->GetOffset() );
+          }
+        /* IdentityTransform contributes nothing. */
+        }
+      fusedQueue.push_back( fusedTransform );
+      fusedFlags.push_back( false );
+      anyFused = true;
+      }
+    else
+      {
+      for( const SizeValueType r : run )
+        {
+        fusedQueue.push_back( this->m_TransformQueue[r] );
+        fusedFlags.push_back( this->m_TransformsToOptimizeFlags[r] );
+        }
+      }
+    run.clear();
+
+    if( m < numberOfTransforms )
+      {
+      fusedQueue.push_back( this->m_TransformQueue[m] );
+      fusedFlags.push_back( this->m_TransformsToOptimizeFlags[m] );
+      }
+    }
+
+  return anyFused;
+}
+
+
+template<typename TParametersValueType, unsigned int NDimensions>
+void
+CompositeTransform<TParametersValueType, NDimensions>
+::FuseLinearTransforms()
+{
+  TransformQueueType            fusedQueue;
+  TransformsToOptimizeFlagsType fusedFlags;
+
+  if( !this->BuildFusedTransformQueue( fusedQueue, fusedFlags ) )
+    {
+    return;
+    }
+
+  this->m_TransformQueue = fusedQueue;
+  this->m_TransformsToOptimizeFlags = fusedFlags;
+  this->Modified();
+}
+
+
+template<typename TParametersValueType, unsigned int NDimensions>
+typename CompositeTransform<TParametersValueType, NDimensions>::Pointer
+CompositeTransform<TParametersValueType, NDimensions>
+::GetFusedCompositeTransform() const
+{
+  const ModifiedTimeType latestTime = this->GetLatestMemberModifiedTime();
+
+  if( this->m_FusedCompositeTransform.IsNull()
+      || latestTime > this->m_PreviousFusedCompositeUpdateTime )
+    {
+    TransformQueueType            fusedQueue;
+    TransformsToOptimizeFlagsType fusedFlags;
+    this->BuildFusedTransformQueue( fusedQueue, fusedFlags );
+
+    typename Self::Pointer fused = Self::New();
+    fused->m_TransformQueue = fusedQueue;
+    fused->m_TransformsToOptimizeFlags = fusedFlags;
+
+    this->m_FusedCompositeTransform = fused;
+    this->m_PreviousFusedCompositeUpdateTime = latestTime;
+    }
+
+  return this->m_FusedCompositeTransform;
+}
+
+
+template<typename TParametersValueType, unsigned int NDimensions>
+ModifiedTimeType
+CompositeTransform<TParametersValueType, NDimensions>
+::GetLatestMemberModifiedTime() const
+{
+  ModifiedTimeType latestTime = this->GetMTime();
+
+  for( SizeValueType m = 0; m < this->GetNumberOfTransforms(); m++ )
+    {
+    const ModifiedTimeType memberTime =
+      this->GetNthTransformConstPointer( m )->GetMTime();
+    if( memberTime > latestTime )
+      {
+      latestTime = memberTime;
+      }
+    }
+  return latestTime;
+}
+
+
 template<typename TParametersValueType, unsigned int NDimensions>
 void
 CompositeTransform<TParametersValueType, NDimensions>
@@ -368,6 +368,13 @@ public:
 
   OutputPointType       TransformPoint(const InputPointType & point) const override;
 
+  /** Transform a batch of points with a single virtual call. The
+   * matrix and offset are applied directly in the loop, so the cost of
+   * the dispatch is amortized over the batch. Derived transforms that
+   * change TransformPoint() must also override this method. */
+  void TransformPoints(const std::vector< InputPointType > & inputPoints,
+                       std::vector< OutputPointType > & outputPoints) const override;
+
   using Superclass::TransformVector;
 
   OutputVectorType      TransformVector(const InputVectorType & vector) const override;
@@ -183,6 +183,23 @@ MatrixOffsetTransformBase<TParametersValueType, NInputDimensions, NOutputDimensi
 }
 
 
+template<typename TParametersValueType, unsigned int NInputDimensions,
+          unsigned int NOutputDimensions>
+void
+MatrixOffsetTransformBase<TParametersValueType, NInputDimensions, NOutputDimensions>
+::TransformPoints(const std::vector< InputPointType > & inputPoints,
+                  std::vector< OutputPointType > & outputPoints) const
+{
+  const SizeValueType numberOfPoints = inputPoints.size();
+
+  outputPoints.resize(numberOfPoints);
+  for( SizeValueType n = 0; n < numberOfPoints; ++n )
+    {
+    outputPoints[n] = m_Matrix * inputPoints[n] + m_Offset;
+    }
+}
+
+
 template<typename TParametersValueType, unsigned int NInputDimensions,
           unsigned int NOutputDimensions>
 typename MatrixOffsetTransformBase<TParametersValueType,
@@ -148,6 +148,13 @@ public:
    * vector. */
   OutputPointType     TransformPoint(const InputPointType  & point) const override;
 
+  /** Transform a batch of points. This transform scales about its
+   * center instead of applying the superclass matrix, so the batched
+   * method has to be overridden as well to stay consistent with
+   * TransformPoint(). */
+  void TransformPoints(const std::vector< InputPointType > & inputPoints,
+                       std::vector< OutputPointType > & outputPoints) const override;
+
   using Superclass::TransformVector;
   OutputVectorType    TransformVector(const InputVectorType & vector) const override;
 
@@ -130,6 +130,26 @@ ScaleTransform<TParametersValueType, NDimensions>
 }
 
 
+template<typename TParametersValueType, unsigned int NDimensions>
+void
+ScaleTransform<TParametersValueType, NDimensions>
+::TransformPoints(const std::vector< InputPointType > & inputPoints,
+                  std::vector< OutputPointType > & outputPoints) const
+{
+  const SizeValueType    numberOfPoints = inputPoints.size();
+  const InputPointType & center = this->GetCenter();
+
+  outputPoints.resize(numberOfPoints);
+  for( SizeValueType n = 0; n < numberOfPoints; ++n )
+    {
+    for( unsigned int i = 0; i < SpaceDimension; i++ )
+      {
+      outputPoints[n][i] = ( inputPoints[n][i] - center[i] ) * m_Scale[i] + center[i];
+      }
+    }
+}
+
+
 template<typename TParametersValueType, unsigned int NDimensions>
 typename ScaleTransform<TParametersValueType, NDimensions>::OutputVectorType
 ScaleTransform<TParametersValueType, NDimensions>
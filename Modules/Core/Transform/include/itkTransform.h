@@ -27,6 +27,8 @@
 #include "vnl/vnl_matrix_fixed.h"
 #include "itkMatrix.h"
 
+#include <vector>
+
 namespace itk
 {
 /** \class Transform
@@ -190,6 +192,17 @@ public:
    */
   virtual OutputPointType TransformPoint(const InputPointType  &) const = 0;
 
+  /** Method to transform a batch of points with one virtual call.
+   * The output container is resized to the size of the input. The
+   * default implementation calls TransformPoint() once per point;
+   * derived transforms with inexpensive per-point math override it so
+   * the dispatch cost is amortized over the whole batch and the inner
+   * loop can be vectorized. The input and output containers may refer
+   * to the same object when the dimensions agree.
+   * \warning This method must be thread-safe. */
+  virtual void TransformPoints(const std::vector< InputPointType > & inputPoints,
+                               std::vector< OutputPointType > & outputPoints) const;
+
   /**  Method to transform a vector. */
   virtual OutputVectorType  TransformVector(const InputVectorType &) const
   {
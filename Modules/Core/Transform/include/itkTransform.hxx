@@ -49,6 +49,24 @@ Transform<TParametersValueType, NInputDimensions, NOutputDimensions>
 }
 
 
+template<typename TParametersValueType,
+          unsigned int NInputDimensions,
+          unsigned int NOutputDimensions>
+void
+Transform<TParametersValueType, NInputDimensions, NOutputDimensions>
+::TransformPoints(const std::vector< InputPointType > & inputPoints,
+                  std::vector< OutputPointType > & outputPoints) const
+{
+  const SizeValueType numberOfPoints = inputPoints.size();
+
+  outputPoints.resize(numberOfPoints);
+  for( SizeValueType n = 0; n < numberOfPoints; ++n )
+    {
+    outputPoints[n] = this->TransformPoint( inputPoints[n] );
+    }
+}
+
+
 template<typename TParametersValueType,
           unsigned int NInputDimensions,
           unsigned int NOutputDimensions>
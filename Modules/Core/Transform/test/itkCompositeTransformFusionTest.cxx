@@ -0,0 +1,170 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include <iostream>
+
+#include "itkAffineTransform.h"
+#include "itkCompositeTransform.h"
+#include "itkEuler3DTransform.h"
+#include "itkScaleTransform.h"
+#include "itkTranslationTransform.h"
+
+/* Test the linear transform fusion pass of CompositeTransform: the
+ * fused queue must map points exactly like the original queue, runs
+ * are only fused across members whose matrix form is trustworthy, and
+ * the cached fused transform is rebuilt when a member changes. */
+
+namespace
+{
+
+constexpr unsigned int Dimension = 3;
+using CompositeTransformType = itk::CompositeTransform< double, Dimension >;
+using PointType = CompositeTransformType::InputPointType;
+
+bool SamePointMapping( const CompositeTransformType * original,
+                       const CompositeTransformType * fused )
+{
+  for ( unsigned int n = 0; n < 50; ++n )
+    {
+    PointType point;
+    point[0] = 0.41 * n - 9.0;
+    point[1] = -0.17 * n + 3.0;
+    point[2] = 0.29 * n - 4.0;
+    const PointType expected = original->TransformPoint( point );
+    const PointType actual = fused->TransformPoint( point );
+    if ( expected.EuclideanDistanceTo( actual ) > 1e-9 )
+      {
+      std::cerr << "Mapping mismatch: " << actual << " versus "
+                << expected << " at input " << point << std::endl;
+      return false;
+      }
+    }
+  return true;
+}
+
+} // namespace
+
+int itkCompositeTransformFusionTest( int, char *[] )
+{
+  using AffineTransformType = itk::AffineTransform< double, Dimension >;
+  AffineTransformType::Pointer affine = AffineTransformType::New();
+  AffineTransformType::OutputVectorType axis;
+  axis[0] = 1.0;
+  axis[1] = 0.0;
+  axis[2] = 0.0;
+  affine->Rotate3D( axis, 0.4 );
+  AffineTransformType::OutputVectorType translation;
+  translation[0] = 2.0;
+  translation[1] = -1.0;
+  translation[2] = 0.5;
+  affine->Translate( translation );
+
+  using EulerTransformType = itk::Euler3DTransform< double >;
+  EulerTransformType::Pointer euler = EulerTransformType::New();
+  euler->SetRotation( 0.2, -0.1, 0.3 );
+
+  using TranslationTransformType = itk::TranslationTransform< double, Dimension >;
+  TranslationTransformType::Pointer translationTransform =
+    TranslationTransformType::New();
+  TranslationTransformType::OutputVectorType offset;
+  offset[0] = -0.5;
+  offset[1] = 1.5;
+  offset[2] = 2.5;
+  translationTransform->Translate( offset );
+
+  // An all-linear queue must collapse to a single member.
+  CompositeTransformType::Pointer linearStack = CompositeTransformType::New();
+  linearStack->AddTransform( affine );
+  linearStack->AddTransform( euler );
+  linearStack->AddTransform( translationTransform );
+
+  CompositeTransformType::Pointer reference = CompositeTransformType::New();
+  reference->AddTransform( affine );
+  reference->AddTransform( euler );
+  reference->AddTransform( translationTransform );
+
+  linearStack->FuseLinearTransforms();
+  if ( linearStack->GetNumberOfTransforms() != 1 )
+    {
+    std::cerr << "Expected a single fused transform, found "
+              << linearStack->GetNumberOfTransforms() << std::endl;
+    return EXIT_FAILURE;
+    }
+  if ( !SamePointMapping( reference, linearStack ) )
+    {
+    std::cerr << "Fused all-linear queue maps points differently." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // ScaleTransform redefines TransformPoint, so it must survive the
+  // pass unfused and split the queue into two runs.
+  using ScaleTransformType = itk::ScaleTransform< double, Dimension >;
+  ScaleTransformType::Pointer scale = ScaleTransformType::New();
+  ScaleTransformType::ScaleType scaleFactors;
+  scaleFactors.Fill( 1.5 );
+  scale->SetScale( scaleFactors );
+  ScaleTransformType::InputPointType scaleCenter;
+  scaleCenter.Fill( 2.0 );
+  scale->SetCenter( scaleCenter );
+
+  CompositeTransformType::Pointer mixedStack = CompositeTransformType::New();
+  mixedStack->AddTransform( affine );
+  mixedStack->AddTransform( scale );
+  mixedStack->AddTransform( euler );
+  mixedStack->AddTransform( translationTransform );
+
+  CompositeTransformType::Pointer fusedMixed =
+    mixedStack->GetFusedCompositeTransform();
+  if ( fusedMixed->GetNumberOfTransforms() != 3 )
+    {
+    std::cerr << "Expected three members after fusing the mixed queue, found "
+              << fusedMixed->GetNumberOfTransforms() << std::endl;
+    return EXIT_FAILURE;
+    }
+  if ( !SamePointMapping( mixedStack, fusedMixed ) )
+    {
+    std::cerr << "Fused mixed queue maps points differently." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // The fused form is cached until a member is modified.
+  if ( mixedStack->GetFusedCompositeTransform() != fusedMixed.GetPointer() )
+    {
+    std::cerr << "Unmodified transform did not reuse the cached fused form."
+              << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  euler->SetRotation( -0.3, 0.2, 0.1 );
+  CompositeTransformType::Pointer rebuiltMixed =
+    mixedStack->GetFusedCompositeTransform();
+  if ( rebuiltMixed == fusedMixed.GetPointer() )
+    {
+    std::cerr << "Modified member did not invalidate the cached fused form."
+              << std::endl;
+    return EXIT_FAILURE;
+    }
+  if ( !SamePointMapping( mixedStack, rebuiltMixed ) )
+    {
+    std::cerr << "Rebuilt fused queue maps points differently." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
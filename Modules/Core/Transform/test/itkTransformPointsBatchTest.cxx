@@ -0,0 +1,157 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include <iostream>
+
+#include "itkAffineTransform.h"
+#include "itkAzimuthElevationToCartesianTransform.h"
+#include "itkCompositeTransform.h"
+#include "itkEuler3DTransform.h"
+#include "itkScaleTransform.h"
+#include "itkTranslationTransform.h"
+
+/* The batched TransformPoints() method must agree with point-by-point
+ * TransformPoint() calls for every transform, in particular for the
+ * transforms that provide an optimized batched implementation. */
+
+namespace
+{
+
+constexpr unsigned int Dimension = 3;
+using TransformType = itk::Transform< double, Dimension, Dimension >;
+using PointType = TransformType::InputPointType;
+
+bool BatchMatchesPointwise( const TransformType * transform,
+                            const std::vector< PointType > & points )
+{
+  std::vector< PointType > batchResults;
+  transform->TransformPoints( points, batchResults );
+
+  if ( batchResults.size() != points.size() )
+    {
+    std::cerr << transform->GetNameOfClass()
+              << ": batch output has wrong size." << std::endl;
+    return false;
+    }
+  for ( std::size_t n = 0; n < points.size(); ++n )
+    {
+    const PointType expected = transform->TransformPoint( points[n] );
+    if ( expected.EuclideanDistanceTo( batchResults[n] ) > 1e-10 )
+      {
+      std::cerr << transform->GetNameOfClass() << ": mismatch at point "
+                << n << ": " << batchResults[n] << " versus "
+                << expected << std::endl;
+      return false;
+      }
+    }
+  return true;
+}
+
+} // namespace
+
+int itkTransformPointsBatchTest( int, char *[] )
+{
+  std::vector< PointType > points;
+  for ( unsigned int n = 0; n < 100; ++n )
+    {
+    PointType point;
+    point[0] = 0.37 * n - 11.0;
+    point[1] = -0.21 * n + 5.0;
+    point[2] = 0.11 * n;
+    points.push_back( point );
+    }
+
+  bool passed = true;
+
+  using AffineTransformType = itk::AffineTransform< double, Dimension >;
+  AffineTransformType::Pointer affine = AffineTransformType::New();
+  AffineTransformType::OutputVectorType axis;
+  axis[0] = 0.0;
+  axis[1] = 0.0;
+  axis[2] = 1.0;
+  affine->Rotate3D( axis, 0.5 );
+  AffineTransformType::OutputVectorType translation;
+  translation[0] = 3.0;
+  translation[1] = -2.0;
+  translation[2] = 0.5;
+  affine->Translate( translation );
+  passed &= BatchMatchesPointwise( affine, points );
+
+  using EulerTransformType = itk::Euler3DTransform< double >;
+  EulerTransformType::Pointer euler = EulerTransformType::New();
+  euler->SetRotation( 0.1, -0.2, 0.3 );
+  passed &= BatchMatchesPointwise( euler, points );
+
+  // ScaleTransform overrides TransformPoint, so it must not inherit
+  // the matrix-based batched implementation.
+  using ScaleTransformType = itk::ScaleTransform< double, Dimension >;
+  ScaleTransformType::Pointer scale = ScaleTransformType::New();
+  ScaleTransformType::ScaleType scaleFactors;
+  scaleFactors.Fill( 2.0 );
+  scaleFactors[1] = 0.5;
+  scale->SetScale( scaleFactors );
+  ScaleTransformType::InputPointType center;
+  center.Fill( 1.0 );
+  scale->SetCenter( center );
+  passed &= BatchMatchesPointwise( scale, points );
+
+  using AzElTransformType =
+    itk::AzimuthElevationToCartesianTransform< double, Dimension >;
+  AzElTransformType::Pointer azimuthElevation = AzElTransformType::New();
+  passed &= BatchMatchesPointwise( azimuthElevation, points );
+
+  using TranslationTransformType = itk::TranslationTransform< double, Dimension >;
+  TranslationTransformType::Pointer translationTransform =
+    TranslationTransformType::New();
+  TranslationTransformType::OutputVectorType offset;
+  offset[0] = -1.0;
+  offset[1] = 2.5;
+  offset[2] = 0.25;
+  translationTransform->Translate( offset );
+  passed &= BatchMatchesPointwise( translationTransform, points );
+
+  using CompositeTransformType = itk::CompositeTransform< double, Dimension >;
+  CompositeTransformType::Pointer composite = CompositeTransformType::New();
+  composite->AddTransform( affine );
+  composite->AddTransform( scale );
+  composite->AddTransform( translationTransform );
+  passed &= BatchMatchesPointwise( composite, points );
+
+  // The input and output containers may be the same object.
+  std::vector< PointType > inPlace( points );
+  affine->TransformPoints( inPlace, inPlace );
+  for ( std::size_t n = 0; n < points.size(); ++n )
+    {
+    const PointType expected = affine->TransformPoint( points[n] );
+    if ( expected.EuclideanDistanceTo( inPlace[n] ) > 1e-10 )
+      {
+      std::cerr << "In-place batch mismatch at point " << n << std::endl;
+      passed = false;
+      break;
+      }
+    }
+
+  if ( !passed )
+    {
+    std::cerr << "Test failed." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -205,6 +205,18 @@ public:
     m_AverageGradientMagnitudeSquared = c;
   }
 
+  /** Retrieve the average gradient magnitude squared that the function
+      accumulated while sweeping the image during the previous iteration,
+      for functions that fuse the conductance statistics into
+      ComputeUpdate().  Returns false when no fused statistics are
+      available (the first iteration, or a function that performs no
+      fusion), in which case the caller should fall back to
+      CalculateAverageGradientMagnitudeSquared(). */
+  virtual bool RetrieveFusedAverageGradientMagnitudeSquared( double & itkNotUsed(average) )
+  {
+    return false;
+  }
+
   /** Returns the time step supplied by the user.  We don't need to use the
    * global data supplied since we are returning a fixed value.  */
   TimeStepType ComputeGlobalTimeStep( void *itkNotUsed(GlobalData) ) const override
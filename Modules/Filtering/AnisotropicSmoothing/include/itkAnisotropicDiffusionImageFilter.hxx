@@ -85,7 +85,19 @@ AnisotropicDiffusionImageFilter< TInputImage, TOutputImage >
     {
     if ( ( this->GetElapsedIterations() % m_ConductanceScalingUpdateInterval ) == 0 )
       {
-      f->CalculateAverageGradientMagnitudeSquared( this->GetOutput() );
+      // Prefer the statistics the function accumulated while sweeping
+      // the image during the previous iteration, which saves a dedicated
+      // full-image pass.  Functions that do not fuse the statistics, and
+      // the first iteration, take the dedicated pass.
+      double fusedAverage = 0.0;
+      if ( f->RetrieveFusedAverageGradientMagnitudeSquared(fusedAverage) )
+        {
+        f->SetAverageGradientMagnitudeSquared(fusedAverage);
+        }
+      else
+        {
+        f->CalculateAverageGradientMagnitudeSquared( this->GetOutput() );
+        }
       }
     }
   else
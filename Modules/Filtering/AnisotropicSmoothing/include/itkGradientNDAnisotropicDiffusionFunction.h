@@ -23,6 +23,8 @@
 #include "itkNeighborhoodInnerProduct.h"
 #include "itkDerivativeOperator.h"
 
+#include <mutex>
+
 namespace itk
 {
 /** \class GradientNDAnisotropicDiffusionFunction
@@ -102,6 +104,54 @@ public:
   {
     m_K = static_cast< PixelType >( this->GetAverageGradientMagnitudeSquared()
                                     * this->GetConductanceParameter() * this->GetConductanceParameter() * -2.0f );
+
+    // Start a fresh conductance statistics accumulation for the sweep
+    // this iteration is about to perform.
+    m_FusedGradientMagnitudeSquaredSum = 0.0;
+    m_FusedPixelCount = 0;
+  }
+
+  /** The centralized derivatives computed in ComputeUpdate() are the
+   * same terms the dedicated CalculateAverageGradientMagnitudeSquared()
+   * pass recomputes, so the statistics for the next iteration are
+   * accumulated during the update sweep and retrieved here.  The
+   * average is one iteration stale since it describes the image before
+   * the last update was applied, which is an acceptable approximation
+   * for the conductance calibration and saves a full-image pass per
+   * iteration. */
+  bool RetrieveFusedAverageGradientMagnitudeSquared(double & average) override
+  {
+    if ( m_FusedPixelCount == 0 )
+      {
+      return false;
+      }
+    average = m_FusedGradientMagnitudeSquaredSum / static_cast< double >( m_FusedPixelCount );
+    return true;
+  }
+
+  /** Per-thread structure for the fused conductance statistics. */
+  struct GlobalDataStruct
+  {
+    double GradientMagnitudeSquaredSum{ 0.0 };
+    SizeValueType PixelCount{ 0 };
+  };
+
+  /** Allocate the per-thread statistics accumulator. */
+  void * GetGlobalDataPointer() const override
+  {
+    return new GlobalDataStruct;
+  }
+
+  /** Merge a thread's statistics into the iteration totals. */
+  void ReleaseGlobalDataPointer(void *globalData) const override
+  {
+    auto *gd = static_cast< GlobalDataStruct * >( globalData );
+      {
+      std::lock_guard< std::mutex > mutexHolder(m_FusedStatisticsMutex);
+      m_FusedGradientMagnitudeSquaredSum += gd->GradientMagnitudeSquaredSum;
+      m_FusedPixelCount += gd->PixelCount;
+      }
+    delete gd;
   }
 
 protected:
@@ -126,6 +176,14 @@ protected:
   NeighborhoodSizeValueType m_Stride[ImageDimension];
 
   static double m_MIN_NORM;
+
+private:
+  /** Conductance statistics accumulated during the update sweep.  The
+   * accessors on FiniteDifferenceFunction for the per-thread data are
+   * const, hence the mutable accumulators. */
+  mutable double        m_FusedGradientMagnitudeSquaredSum{ 0.0 };
+  mutable SizeValueType m_FusedPixelCount{ 0 };
+  mutable std::mutex    m_FusedStatisticsMutex;
 };
 } // end namespace itk
 
@@ -329,6 +329,20 @@ public:
    */
   itkGetConstMacro( ConvergenceThreshold, RealType );
 
+  /**
+   * Set/Get the factor by which the input (and, if supplied, the mask and
+   * confidence images) are shrunk before the bias field is estimated.  The
+   * bias field is smooth relative to the voxel size, so the iterative
+   * estimation can run on a reduced version of the input with little loss of
+   * accuracy; the final log bias field is then reconstructed from the
+   * control point lattice at the full input resolution before the correction
+   * is applied.  The convergence criteria retain their usual meaning since
+   * they are evaluated over the (shrunk) mask region at every iteration.
+   * Default = 1, i.e. estimation at the input resolution.
+   */
+  itkSetClampMacro( ShrinkFactor, unsigned int, 1, NumericTraits<unsigned int>::max() );
+  itkGetConstMacro( ShrinkFactor, unsigned int );
+
   /**
    * Typically, a reduced size image is used as input to the N4 filter using
    * something like itkShrinkImageFilter.  Since the output is a corrected
@@ -336,7 +350,9 @@ public:
    * field correction to the full resolution image.  This can be done by
    * using the LogBiasFieldControlPointLattice to reconstruct the bias field
    * at the full image resolution (using the class
-   * BSplineControlPointImageFilter).
+   * BSplineControlPointImageFilter).  Alternatively, setting ShrinkFactor
+   * performs the same reduced-resolution estimation and full-resolution
+   * correction within this filter.
    */
   itkGetConstObjectMacro( LogBiasFieldControlPointLattice, BiasFieldControlPointLatticeType );
 
@@ -389,9 +405,11 @@ private:
   RealImagePointer UpdateBiasFieldEstimate( RealImageType * );
 
   /**
-   * Reconstruct bias field given the control point lattice.
+   * Reconstruct bias field given the control point lattice on the grid of
+   * the supplied reference image.
    */
-  RealImagePointer ReconstructBiasField( BiasFieldControlPointLatticeType * );
+  RealImagePointer ReconstructBiasField( BiasFieldControlPointLatticeType *,
+    const ImageBase<ImageDimension> * );
 
   /**
    * Convergence is determined by the coefficient of variation of the difference
@@ -425,6 +443,15 @@ private:
   ArrayType    m_NumberOfControlPoints;
   ArrayType    m_NumberOfFittingLevels;
 
+  // Downsampled estimation
+
+  unsigned int m_ShrinkFactor{ 1 };
+
+  // The mask and confidence images used during estimation.  These point
+  // either to the corresponding inputs or, when ShrinkFactor > 1, to shrunk
+  // versions of them.
+  typename MaskImageType::ConstPointer m_EstimationMaskImage;
+  typename RealImageType::ConstPointer m_EstimationConfidenceImage;
 };
 
 } // end namespace itk
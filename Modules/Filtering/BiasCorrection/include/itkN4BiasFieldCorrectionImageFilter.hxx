@@ -29,6 +29,7 @@
 #include "itkImageRegionIteratorWithIndex.h"
 #include "itkImportImageFilter.h"
 #include "itkIterationReporter.h"
+#include "itkShrinkImageFilter.h"
 #include "itkSubtractImageFilter.h"
 #include "itkVectorIndexSelectionCastImageFilter.h"
 
@@ -78,18 +79,54 @@ N4BiasFieldCorrectionImageFilter<TInputImage, TMaskImage, TOutputImage>
 
   const InputImageType * inputImage = this->GetInput();
   using RegionType = typename InputImageType::RegionType;
-  const RegionType inputRegion = inputImage->GetBufferedRegion();
+
+  // When a shrink factor is specified, the field is estimated on a reduced
+  // version of the input (the bias field is smooth relative to the voxel
+  // size) and only the final reconstruction and correction are performed at
+  // the input resolution.
+  typename InputImageType::ConstPointer estimationImage = inputImage;
+  this->m_EstimationMaskImage = this->GetMaskImage();
+  this->m_EstimationConfidenceImage = this->GetConfidenceImage();
+  if( this->m_ShrinkFactor > 1 )
+    {
+    using ShrinkerType = ShrinkImageFilter<InputImageType, InputImageType>;
+    typename ShrinkerType::Pointer shrinker = ShrinkerType::New();
+    shrinker->SetInput( inputImage );
+    shrinker->SetShrinkFactors( this->m_ShrinkFactor );
+    shrinker->Update();
+    estimationImage = shrinker->GetOutput();
+
+    if( this->m_EstimationMaskImage )
+      {
+      using MaskShrinkerType = ShrinkImageFilter<MaskImageType, MaskImageType>;
+      typename MaskShrinkerType::Pointer maskShrinker = MaskShrinkerType::New();
+      maskShrinker->SetInput( this->m_EstimationMaskImage );
+      maskShrinker->SetShrinkFactors( this->m_ShrinkFactor );
+      maskShrinker->Update();
+      this->m_EstimationMaskImage = maskShrinker->GetOutput();
+      }
+    if( this->m_EstimationConfidenceImage )
+      {
+      using RealShrinkerType = ShrinkImageFilter<RealImageType, RealImageType>;
+      typename RealShrinkerType::Pointer confidenceShrinker = RealShrinkerType::New();
+      confidenceShrinker->SetInput( this->m_EstimationConfidenceImage );
+      confidenceShrinker->SetShrinkFactors( this->m_ShrinkFactor );
+      confidenceShrinker->Update();
+      this->m_EstimationConfidenceImage = confidenceShrinker->GetOutput();
+      }
+    }
+  const RegionType inputRegion = estimationImage->GetBufferedRegion();
 
   // Calculate the log of the input image.
   RealImagePointer logInputImage = RealImageType::New();
-  logInputImage->CopyInformation( inputImage );
+  logInputImage->CopyInformation( estimationImage );
   logInputImage->SetRegions( inputRegion );
   logInputImage->Allocate( false );
 
-  ImageAlgorithm::Copy( inputImage, logInputImage.GetPointer(), inputRegion, inputRegion);
+  ImageAlgorithm::Copy( estimationImage.GetPointer(), logInputImage.GetPointer(), inputRegion, inputRegion);
 
-  const MaskImageType * maskImage = this->GetMaskImage();
-  const RealImageType * confidenceImage = this->GetConfidenceImage();
+  const MaskImageType * maskImage = this->m_EstimationMaskImage;
+  const RealImageType * confidenceImage = this->m_EstimationConfidenceImage;
   const MaskPixelType maskLabel = this->GetMaskLabel();
   const bool useMaskLabel = this->GetUseMaskLabel();
 
@@ -123,8 +160,8 @@ N4BiasFieldCorrectionImageFilter<TInputImage, TMaskImage, TOutputImage>
   // Provide an initial log bias field of zeros
 
   RealImagePointer logBiasField = RealImageType::New();
-  logBiasField->CopyInformation( inputImage );
-  logBiasField->SetRegions( inputImage->GetLargestPossibleRegion() );
+  logBiasField->CopyInformation( estimationImage );
+  logBiasField->SetRegions( estimationImage->GetLargestPossibleRegion() );
   logBiasField->Allocate( true ); // initialize buffer to zero
 
   // Iterate until convergence or iterative exhaustion.
@@ -211,6 +248,14 @@ N4BiasFieldCorrectionImageFilter<TInputImage, TMaskImage, TOutputImage>
       RefineControlPointLattice( numberOfLevels );
     }
 
+  if( this->m_ShrinkFactor > 1 )
+    {
+    // The shrunk field estimate is discarded and the final log bias field is
+    // reconstructed from the control point lattice at the input resolution.
+    logBiasField = this->ReconstructBiasField(
+      this->m_LogBiasFieldControlPointLattice, inputImage );
+    }
+
   using CustomBinaryFilter = itk::BinaryGeneratorImageFilter<InputImageType, RealImageType, OutputImageType>;
   typename CustomBinaryFilter::Pointer expAndDivFilter = CustomBinaryFilter::New();
   auto expAndDivLambda = [](const typename InputImageType::PixelType &input,
@@ -233,8 +278,8 @@ N4BiasFieldCorrectionImageFilter<TInputImage, TMaskImage, TOutputImage>::RealIma
 N4BiasFieldCorrectionImageFilter<TInputImage, TMaskImage, TOutputImage>
 ::SharpenImage( const RealImageType *unsharpenedImage ) const
 {
-  const MaskImageType * maskImage = this->GetMaskImage();
-  const RealImageType * confidenceImage = this->GetConfidenceImage();
+  const MaskImageType * maskImage = this->m_EstimationMaskImage;
+  const RealImageType * confidenceImage = this->m_EstimationConfidenceImage;
   const MaskPixelType maskLabel = this->GetMaskLabel();
   const bool useMaskLabel = this->GetUseMaskLabel();
 
@@ -435,12 +480,10 @@ N4BiasFieldCorrectionImageFilter<TInputImage, TMaskImage, TOutputImage>
 
   E = E.extract( this->m_NumberOfHistogramBins, histogramOffset );
 
-  const InputImageType * inputImage = this->GetInput();
-
   // Sharpen the image with the new mapping, E(u|v)
   RealImagePointer sharpenedImage = RealImageType::New();
-  sharpenedImage->CopyInformation( inputImage );
-  sharpenedImage->SetRegions( inputImage->GetLargestPossibleRegion() );
+  sharpenedImage->CopyInformation( unsharpenedImage );
+  sharpenedImage->SetRegions( unsharpenedImage->GetLargestPossibleRegion() );
   sharpenedImage->Allocate( true ); // initialize buffer to zero
 
   ImageRegionIterator<RealImageType> ItC(
@@ -509,8 +552,8 @@ N4BiasFieldCorrectionImageFilter<TInputImage, TMaskImage, TOutputImage>
     BSplineFilterType::WeightsContainerType::New();
   weights->Initialize();
 
-  const MaskImageType * maskImage = this->GetMaskImage();
-  const RealImageType * confidenceImage = this->GetConfidenceImage();
+  const MaskImageType * maskImage = this->m_EstimationMaskImage;
+  const RealImageType * confidenceImage = this->m_EstimationConfidenceImage;
   const MaskPixelType maskLabel = this->GetMaskLabel();
   const bool useMaskLabel = this->GetUseMaskLabel();
 
@@ -610,7 +653,8 @@ N4BiasFieldCorrectionImageFilter<TInputImage, TMaskImage, TOutputImage>
     this->m_LogBiasFieldControlPointLattice = adder->GetOutput();
     }
 
-  RealImagePointer smoothField = this->ReconstructBiasField( this->m_LogBiasFieldControlPointLattice );
+  RealImagePointer smoothField = this->ReconstructBiasField(
+    this->m_LogBiasFieldControlPointLattice, fieldEstimate );
 
   return smoothField;
 }
@@ -619,20 +663,19 @@ template<typename TInputImage, typename TMaskImage, typename TOutputImage>
 typename
 N4BiasFieldCorrectionImageFilter<TInputImage, TMaskImage, TOutputImage>::RealImagePointer
 N4BiasFieldCorrectionImageFilter<TInputImage, TMaskImage, TOutputImage>
-::ReconstructBiasField( BiasFieldControlPointLatticeType* controlPointLattice )
+::ReconstructBiasField( BiasFieldControlPointLatticeType* controlPointLattice,
+  const ImageBase<ImageDimension> * referenceImage )
 {
-  const InputImageType * inputImage = this->GetInput();
-
   using BSplineReconstructerType = BSplineControlPointImageFilter
     <BiasFieldControlPointLatticeType, ScalarImageType>;
   typename BSplineReconstructerType::Pointer reconstructer =
     BSplineReconstructerType::New();
   reconstructer->SetInput( controlPointLattice );
-  reconstructer->SetOrigin( inputImage->GetOrigin() );
-  reconstructer->SetSpacing( inputImage->GetSpacing() );
-  reconstructer->SetDirection( inputImage->GetDirection() );
+  reconstructer->SetOrigin( referenceImage->GetOrigin() );
+  reconstructer->SetSpacing( referenceImage->GetSpacing() );
+  reconstructer->SetDirection( referenceImage->GetDirection() );
   reconstructer->SetSplineOrder( this->m_SplineOrder );
-  reconstructer->SetSize( inputImage->GetLargestPossibleRegion().GetSize() );
+  reconstructer->SetSize( referenceImage->GetLargestPossibleRegion().GetSize() );
 
   typename ScalarImageType::Pointer biasFieldBsplineImage = reconstructer->GetOutput();
   biasFieldBsplineImage->Update();
@@ -647,7 +690,7 @@ N4BiasFieldCorrectionImageFilter<TInputImage, TMaskImage, TOutputImage>
   biasField->Update();
 
   biasField->DisconnectPipeline();
-  biasField->SetRegions( inputImage->GetRequestedRegion() );
+  biasField->SetRegions( referenceImage->GetRequestedRegion() );
 
   return biasField;
 }
@@ -672,8 +715,8 @@ N4BiasFieldCorrectionImageFilter<TInputImage, TMaskImage, TOutputImage>
   RealType sigma = 0.0;
   RealType N = 0.0;
 
-  const MaskImageType * maskImage = this->GetMaskImage();
-  const RealImageType * confidenceImage = this->GetConfidenceImage();
+  const MaskImageType * maskImage = this->m_EstimationMaskImage;
+  const RealImageType * confidenceImage = this->m_EstimationConfidenceImage;
   const MaskPixelType maskLabel = this->GetMaskLabel();
   const bool useMaskLabel = this->GetUseMaskLabel();
 
@@ -725,6 +768,7 @@ N4BiasFieldCorrectionImageFilter<TInputImage, TMaskImage, TOutputImage>
   os << indent << "Convergence threshold: "
      << this->m_ConvergenceThreshold << std::endl;
   os << indent << "Spline order: " << this->m_SplineOrder << std::endl;
+  os << indent << "Shrink factor: " << this->m_ShrinkFactor << std::endl;
   os << indent << "Number of fitting levels: "
      << this->m_NumberOfFittingLevels << std::endl;
   os << indent << "Number of control points: "
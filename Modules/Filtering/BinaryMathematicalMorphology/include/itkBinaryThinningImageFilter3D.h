@@ -0,0 +1,157 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkBinaryThinningImageFilter3D_h
+#define itkBinaryThinningImageFilter3D_h
+
+#include "itkNeighborhoodIterator.h"
+#include "itkImageToImageFilter.h"
+
+namespace itk
+{
+/** \class BinaryThinningImageFilter3D
+ *
+ * \brief This filter computes a one-voxel-wide skeleton of a 3D binary image.
+ *
+ * This class is parametrized over the type of the input image
+ * and the type of the output image.  Both must be three-dimensional.
+ *
+ * The input is assumed to be a binary image.  If the foreground voxels
+ * of the input image do not have a value of 1, they are rescaled to 1
+ * internally to simplify the computation.  The output background values
+ * are 0, and the foreground values are 1.
+ *
+ * The object is eroded by directional sub-iterations.  Each iteration
+ * visits the six face directions in turn and removes border voxels of
+ * the current direction that are simple points and not curve end
+ * points.  A voxel is a simple point when its removal does not change
+ * the topology of the object, which is decided from the topological
+ * numbers of its 26-neighborhood following
+ *
+ * G. Malandain and G. Bertrand.
+ * Fast characterization of 3D simple points.
+ * IEEE Conference on Computer Vision and Pattern Recognition, 232-237, (1992).
+ *
+ * The candidate border voxels of each sub-iteration are classified in
+ * parallel.  Candidates are then rechecked and removed sequentially so
+ * that every individual removal preserves the topology, which makes the
+ * result independent of the number of work units.
+ *
+ * \sa BinaryThinningImageFilter
+ * \sa MorphologyImageFilter
+ * \ingroup ImageEnhancement MathematicalMorphologyImageFilters
+ * \ingroup ITKBinaryMathematicalMorphology
+ */
+
+template< typename TInputImage, typename TOutputImage >
+class ITK_TEMPLATE_EXPORT BinaryThinningImageFilter3D:
+  public ImageToImageFilter< TInputImage, TOutputImage >
+{
+public:
+  ITK_DISALLOW_COPY_AND_ASSIGN(BinaryThinningImageFilter3D);
+
+  /** Standard class type aliases. */
+  using Self = BinaryThinningImageFilter3D;
+  using Superclass = ImageToImageFilter< TInputImage, TOutputImage >;
+  using Pointer = SmartPointer< Self >;
+  using ConstPointer = SmartPointer< const Self >;
+
+  /** Method for creation through the object factory */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(BinaryThinningImageFilter3D, ImageToImageFilter);
+
+  /** Type for input image. */
+  using InputImageType = TInputImage;
+
+  /** Type for output image: Skeleton of the object.  */
+  using OutputImageType = TOutputImage;
+
+  /** Type for the region of the input image. */
+  using RegionType = typename InputImageType::RegionType;
+
+  /** Type for the index of the input image. */
+  using IndexType = typename RegionType::IndexType;
+
+  /** Type for the pixel of the input image. */
+  using PixelType = typename InputImageType::PixelType;
+
+  /** Type for the size of the input image. */
+  using SizeType = typename RegionType::SizeType;
+
+  /** Pointer Type for input image. */
+  using InputImagePointer = typename InputImageType::ConstPointer;
+
+  /** Pointer Type for the output image. */
+  using OutputImagePointer = typename OutputImageType::Pointer;
+
+  /** Superclass type alias. */
+  using OutputImagePixelType = typename Superclass::OutputImagePixelType;
+
+  /** Neighborhood iterator type */
+  using NeighborhoodIteratorType = NeighborhoodIterator< TOutputImage >;
+
+  /** Get Skeleton by thinning image. */
+  OutputImageType * GetThinning();
+
+  /** ImageDimension enumeration   */
+  static constexpr unsigned int InputImageDimension = TInputImage::ImageDimension;
+  static constexpr unsigned int OutputImageDimension = TOutputImage::ImageDimension;
+
+#ifdef ITK_USE_CONCEPT_CHECKING
+  // Begin concept checking
+  itkConceptMacro( InputIsThreeDimensionalCheck,
+                   ( Concept::SameDimension< InputImageDimension, 3 > ) );
+  itkConceptMacro( SameDimensionCheck,
+                   ( Concept::SameDimension< InputImageDimension, OutputImageDimension > ) );
+  itkConceptMacro( InputConvertibleToIntCheck,
+                   ( Concept::Convertible< PixelType, int > ) );
+  itkConceptMacro( IntConvertibleToInputCheck,
+                   ( Concept::Convertible< int, PixelType > ) );
+  itkConceptMacro( SameTypeCheck,
+                   ( Concept::SameType< PixelType, typename TOutputImage::PixelType > ) );
+  // End concept checking
+#endif
+
+protected:
+  BinaryThinningImageFilter3D();
+  ~BinaryThinningImageFilter3D() override = default;
+
+  /** Compute thinning Image. */
+  void GenerateData() override;
+
+  /** Prepare data. */
+  void PrepareData();
+
+  /**  Compute thinning Image. */
+  void ComputeThinImage();
+
+  /** Decide whether the center of a 3x3x3 neighborhood is a simple point,
+   * i.e. whether its removal preserves the topology of the object.  The
+   * neighborhood is given as 27 foreground flags in the usual linear
+   * neighborhood order (the center is entry 13 and is ignored). */
+  static bool IsSimplePoint(const bool neighbors[27]);
+};                                         // end of BinaryThinningImageFilter3D
+                                           // class
+} //end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#include "itkBinaryThinningImageFilter3D.hxx"
+#endif
+
+#endif
@@ -0,0 +1,393 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkBinaryThinningImageFilter3D_hxx
+#define itkBinaryThinningImageFilter3D_hxx
+
+#include "itkBinaryThinningImageFilter3D.h"
+#include "itkConstNeighborhoodIterator.h"
+#include "itkConstantBoundaryCondition.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkImageRegionIterator.h"
+#include "itkMultiThreaderBase.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <mutex>
+#include <vector>
+
+namespace itk
+{
+/**
+ *    Constructor
+ */
+template< typename TInputImage, typename TOutputImage >
+BinaryThinningImageFilter3D< TInputImage, TOutputImage >
+::BinaryThinningImageFilter3D()
+{
+  this->SetNumberOfRequiredOutputs(1);
+
+  OutputImagePointer thinImage = OutputImageType::New();
+  this->SetNthOutput( 0, thinImage.GetPointer() );
+}
+
+/**
+ *  Return the thinning Image pointer
+ */
+template< typename TInputImage, typename TOutputImage >
+typename BinaryThinningImageFilter3D<
+  TInputImage, TOutputImage >::OutputImageType *
+BinaryThinningImageFilter3D< TInputImage, TOutputImage >
+::GetThinning()
+{
+  return dynamic_cast< OutputImageType * >(
+           this->ProcessObject::GetOutput(0) );
+}
+
+/**
+ *  Prepare data for computation
+ *  Copy the input image to the output image, changing from the input
+ *  type to the output type.
+ */
+template< typename TInputImage, typename TOutputImage >
+void
+BinaryThinningImageFilter3D< TInputImage, TOutputImage >
+::PrepareData()
+{
+  itkDebugMacro(<< "PrepareData Start");
+  OutputImagePointer thinImage = GetThinning();
+
+  InputImagePointer inputImage  =
+    dynamic_cast< const TInputImage  * >( ProcessObject::GetInput(0) );
+
+  thinImage->SetBufferedRegion( thinImage->GetRequestedRegion() );
+  thinImage->Allocate();
+
+  typename OutputImageType::RegionType region  = thinImage->GetRequestedRegion();
+
+  ImageRegionConstIterator< TInputImage > it(inputImage,  region);
+  ImageRegionIterator< TOutputImage >     ot(thinImage,  region);
+
+  it.GoToBegin();
+  ot.GoToBegin();
+
+  itkDebugMacro(<< "PrepareData: Copy input to output");
+
+  // Copy the input to the output, changing all foreground voxels to
+  // have value 1 in the process.
+  while ( !ot.IsAtEnd() )
+    {
+    if ( it.Get() )
+      {
+      ot.Set(NumericTraits< OutputImagePixelType >::OneValue());
+      }
+    else
+      {
+      ot.Set(NumericTraits< OutputImagePixelType >::ZeroValue());
+      }
+    ++it;
+    ++ot;
+    }
+  itkDebugMacro(<< "PrepareData End");
+}
+
+/**
+ *  Decide whether the center of a 3x3x3 neighborhood is a simple point.
+ */
+template< typename TInputImage, typename TOutputImage >
+bool
+BinaryThinningImageFilter3D< TInputImage, TOutputImage >
+::IsSimplePoint(const bool neighbors[27])
+{
+  // Entry i of the neighborhood decodes to the offset
+  // ( i % 3 - 1, ( i / 3 ) % 3 - 1, i / 9 - 1 ) from the center entry 13.
+
+  bool visited[27];
+
+  // The foreground of the 26-neighborhood must form exactly one
+  // 26-connected component.  Every entry is 26-adjacent to the center,
+  // so the component count is the topological number of the object.
+  for ( unsigned int i = 0; i < 27; i++ )
+    {
+    visited[i] = false;
+    }
+  unsigned int numberOfForegroundComponents = 0;
+  for ( unsigned int i = 0; i < 27; i++ )
+    {
+    if ( i == 13 || !neighbors[i] || visited[i] )
+      {
+      continue;
+      }
+    numberOfForegroundComponents++;
+    if ( numberOfForegroundComponents > 1 )
+      {
+      return false;
+      }
+    unsigned int stack[26];
+    unsigned int stackSize = 0;
+    visited[i] = true;
+    stack[stackSize++] = i;
+    while ( stackSize > 0 )
+      {
+      const unsigned int current = stack[--stackSize];
+      const int x = static_cast< int >( current % 3 );
+      const int y = static_cast< int >( ( current / 3 ) % 3 );
+      const int z = static_cast< int >( current / 9 );
+      for ( unsigned int j = 0; j < 27; j++ )
+        {
+        if ( j == 13 || !neighbors[j] || visited[j] )
+          {
+          continue;
+          }
+        const int dx = std::abs( static_cast< int >( j % 3 ) - x );
+        const int dy = std::abs( static_cast< int >( ( j / 3 ) % 3 ) - y );
+        const int dz = std::abs( static_cast< int >( j / 9 ) - z );
+        if ( dx <= 1 && dy <= 1 && dz <= 1 )
+          {
+          visited[j] = true;
+          stack[stackSize++] = j;
+          }
+        }
+      }
+    }
+  if ( numberOfForegroundComponents != 1 )
+    {
+    return false;
+    }
+
+  // The background of the 18-neighborhood must form exactly one
+  // 6-connected component that touches a face of the center.  The
+  // corner entries do not belong to the 18-neighborhood and cannot
+  // serve as stepping stones between components.
+  for ( unsigned int i = 0; i < 27; i++ )
+    {
+    visited[i] = false;
+    }
+  static const unsigned int faceNeighbors[6] = { 4, 10, 12, 14, 16, 22 };
+  unsigned int numberOfBackgroundComponents = 0;
+  for ( unsigned int f = 0; f < 6; f++ )
+    {
+    const unsigned int seed = faceNeighbors[f];
+    if ( neighbors[seed] || visited[seed] )
+      {
+      continue;
+      }
+    numberOfBackgroundComponents++;
+    if ( numberOfBackgroundComponents > 1 )
+      {
+      return false;
+      }
+    unsigned int stack[18];
+    unsigned int stackSize = 0;
+    visited[seed] = true;
+    stack[stackSize++] = seed;
+    while ( stackSize > 0 )
+      {
+      const unsigned int current = stack[--stackSize];
+      const int x = static_cast< int >( current % 3 );
+      const int y = static_cast< int >( ( current / 3 ) % 3 );
+      const int z = static_cast< int >( current / 9 );
+      for ( unsigned int j = 0; j < 27; j++ )
+        {
+        if ( j == 13 || neighbors[j] || visited[j] )
+          {
+          continue;
+          }
+        const int jx = static_cast< int >( j % 3 );
+        const int jy = static_cast< int >( ( j / 3 ) % 3 );
+        const int jz = static_cast< int >( j / 9 );
+        if ( jx != 1 && jy != 1 && jz != 1 )
+          {
+          // A corner entry, outside of the 18-neighborhood.
+          continue;
+          }
+        const int distance = std::abs( jx - x ) + std::abs( jy - y )
+          + std::abs( jz - z );
+        if ( distance == 1 )
+          {
+          visited[j] = true;
+          stack[stackSize++] = j;
+          }
+        }
+      }
+    }
+  return ( numberOfBackgroundComponents == 1 );
+}
+
+/**
+ *  Post processing for computing thinning
+ */
+template< typename TInputImage, typename TOutputImage >
+void
+BinaryThinningImageFilter3D< TInputImage, TOutputImage >
+::ComputeThinImage()
+{
+  itkDebugMacro(<< "ComputeThinImage Start");
+  OutputImagePointer thinImage          =  GetThinning();
+
+  typename OutputImageType::RegionType region  = thinImage->GetRequestedRegion();
+
+  typename NeighborhoodIteratorType::RadiusType radius;
+  radius.Fill(1);
+
+  // The six face directions visited by the sub-iterations:
+  // up, down, north, south, west and east.
+  using OffsetType = typename NeighborhoodIteratorType::OffsetType;
+  const OffsetType borderOffsets[6] =
+    { { { 0, 0, -1 } }, { { 0, 0, 1 } }, { { 0, -1, 0 } },
+      { { 0, 1, 0 } }, { { -1, 0, 0 } }, { { 1, 0, 0 } } };
+
+  ConstantBoundaryCondition< OutputImageType > boundaryCondition;
+  boundaryCondition.SetConstant( NumericTraits< OutputImagePixelType >::ZeroValue() );
+
+  NeighborhoodIteratorType ot(radius, thinImage, region);
+  ot.OverrideBoundaryCondition(&boundaryCondition);
+
+  MultiThreaderBase::Pointer multiThreader = MultiThreaderBase::New();
+
+  std::vector< IndexType > candidates;
+  std::mutex               candidatesMutex;
+
+  // Loop through the image several times until there is no change.
+  bool noChange = false;
+  while ( !noChange )
+    {
+    noChange = true;
+    // Loop through the sub-iterations, one per face direction.
+    for ( unsigned int direction = 0; direction < 6; direction++ )
+      {
+      const OffsetType borderOffset = borderOffsets[direction];
+
+      // Classify the border voxels of the current direction in
+      // parallel.  A voxel is a removal candidate when it lies on the
+      // border, is not a curve end point and is a simple point.
+      candidates.clear();
+      multiThreader->ParallelizeImageRegion< OutputImageDimension >( region,
+        [thinImage, &radius, &boundaryCondition, borderOffset,
+         &candidates, &candidatesMutex]( const RegionType & subRegion )
+          {
+          ConstNeighborhoodIterator< OutputImageType > it(radius, thinImage, subRegion);
+          it.OverrideBoundaryCondition(&boundaryCondition);
+
+          std::vector< IndexType > localCandidates;
+          bool neighbors[27];
+          for ( it.GoToBegin(); !it.IsAtEnd(); ++it )
+            {
+            if ( !it.GetCenterPixel() )
+              {
+              continue;
+              }
+            if ( it.GetPixel(borderOffset) )
+              {
+              // Not a border point of this direction.
+              continue;
+              }
+            unsigned int numberOfForegroundNeighbors = 0;
+            for ( unsigned int i = 0; i < 27; i++ )
+              {
+              neighbors[i] = ( it.GetPixel(i) != NumericTraits< OutputImagePixelType >::ZeroValue() );
+              if ( neighbors[i] && i != 13 )
+                {
+                numberOfForegroundNeighbors++;
+                }
+              }
+            if ( numberOfForegroundNeighbors <= 1 )
+              {
+              // A curve end point that must survive the thinning.
+              continue;
+              }
+            if ( !Self::IsSimplePoint(neighbors) )
+              {
+              continue;
+              }
+            localCandidates.push_back( it.GetIndex() );
+            }
+          if ( !localCandidates.empty() )
+            {
+            std::lock_guard< std::mutex > lockGuard(candidatesMutex);
+            candidates.insert( candidates.end(),
+                               localCandidates.begin(), localCandidates.end() );
+            }
+          }, nullptr );
+
+      if ( candidates.empty() )
+        {
+        continue;
+        }
+
+      // Sort the candidates so that the sequential sweep below visits
+      // them in a fixed order regardless of how the region was split
+      // across the work units.
+      std::sort( candidates.begin(), candidates.end(),
+                 [&thinImage]( const IndexType & a, const IndexType & b )
+                   { return thinImage->ComputeOffset(a) < thinImage->ComputeOffset(b); } );
+
+      // Recheck and remove the candidates sequentially.  Earlier
+      // removals may have changed the neighborhood of a candidate, so
+      // each one is tested again against the current image before it is
+      // removed.  This keeps every individual removal topology
+      // preserving.
+      typename std::vector< IndexType >::const_iterator candidateIt;
+      for ( candidateIt = candidates.begin();
+            candidateIt != candidates.end();
+            ++candidateIt )
+        {
+        ot.SetLocation(*candidateIt);
+
+        bool neighbors[27];
+        unsigned int numberOfForegroundNeighbors = 0;
+        for ( unsigned int i = 0; i < 27; i++ )
+          {
+          neighbors[i] = ( ot.GetPixel(i) != NumericTraits< OutputImagePixelType >::ZeroValue() );
+          if ( neighbors[i] && i != 13 )
+            {
+            numberOfForegroundNeighbors++;
+            }
+          }
+        if ( numberOfForegroundNeighbors <= 1 )
+          {
+          continue;
+          }
+        if ( !Self::IsSimplePoint(neighbors) )
+          {
+          continue;
+          }
+        ot.SetCenterPixel( NumericTraits< OutputImagePixelType >::ZeroValue() );
+        noChange = false;
+        }
+      } // end sub-iteration loop
+    }   // end noChange while loop
+
+  itkDebugMacro(<< "ComputeThinImage End");
+}
+
+/**
+ *  Generate ThinImage
+ */
+template< typename TInputImage, typename TOutputImage >
+void
+BinaryThinningImageFilter3D< TInputImage, TOutputImage >
+::GenerateData()
+{
+  this->PrepareData();
+
+  itkDebugMacro(<< "GenerateData: Computing Thinning Image");
+  this->ComputeThinImage();
+} // end GenerateData()
+} // end namespace itk
+
+#endif
@@ -0,0 +1,246 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkBinaryThinningImageFilter3D.h"
+#include "itkImageRegionConstIteratorWithIndex.h"
+
+#include <iostream>
+#include <vector>
+
+namespace
+{
+
+using ImageType = itk::Image< unsigned char, 3 >;
+
+// 26-connected foreground neighbors of a voxel
+std::vector< ImageType::IndexType > ForegroundNeighbors( const ImageType * image,
+                                                         const ImageType::IndexType & index )
+{
+  std::vector< ImageType::IndexType > neighbors;
+  const ImageType::RegionType region = image->GetLargestPossibleRegion();
+  for ( int dz = -1; dz <= 1; dz++ )
+    {
+    for ( int dy = -1; dy <= 1; dy++ )
+      {
+      for ( int dx = -1; dx <= 1; dx++ )
+        {
+        if ( dx == 0 && dy == 0 && dz == 0 )
+          {
+          continue;
+          }
+        ImageType::IndexType neighbor = index;
+        neighbor[0] += dx;
+        neighbor[1] += dy;
+        neighbor[2] += dz;
+        if ( region.IsInside( neighbor ) && image->GetPixel( neighbor ) != 0 )
+          {
+          neighbors.push_back( neighbor );
+          }
+        }
+      }
+    }
+  return neighbors;
+}
+
+// number of 26-connected foreground components
+unsigned int CountComponents( const ImageType * image )
+{
+  ImageType::Pointer visited = ImageType::New();
+  visited->SetRegions( image->GetLargestPossibleRegion() );
+  visited->Allocate(true);
+
+  unsigned int components = 0;
+  itk::ImageRegionConstIteratorWithIndex< ImageType > it( image,
+    image->GetLargestPossibleRegion() );
+  for ( it.GoToBegin(); !it.IsAtEnd(); ++it )
+    {
+    if ( it.Get() == 0 || visited->GetPixel( it.GetIndex() ) != 0 )
+      {
+      continue;
+      }
+    components++;
+    std::vector< ImageType::IndexType > stack( 1, it.GetIndex() );
+    visited->SetPixel( it.GetIndex(), 1 );
+    while ( !stack.empty() )
+      {
+      const ImageType::IndexType current = stack.back();
+      stack.pop_back();
+      for ( const ImageType::IndexType & neighbor :
+            ForegroundNeighbors( image, current ) )
+        {
+        if ( visited->GetPixel( neighbor ) == 0 )
+          {
+          visited->SetPixel( neighbor, 1 );
+          stack.push_back( neighbor );
+          }
+        }
+      }
+    }
+  return components;
+}
+
+} // end anonymous namespace
+
+int itkBinaryThinningImageFilter3DTest(int, char* [])
+{
+  // Two well separated objects: a solid rod along x with a 5 x 5 cross
+  // section, and a square ring with a hole
+  ImageType::SizeType size = {{32, 24, 24}};
+  ImageType::RegionType region;
+  region.SetSize( size );
+
+  ImageType::Pointer input = ImageType::New();
+  input->SetRegions( region );
+  input->Allocate(true);
+
+  itk::ImageRegionConstIteratorWithIndex< ImageType > inputIt( input, region );
+  for ( inputIt.GoToBegin(); !inputIt.IsAtEnd(); ++inputIt )
+    {
+    const ImageType::IndexType index = inputIt.GetIndex();
+    // the rod: x in [4,27], y and z in [8,12]
+    if ( index[0] >= 4 && index[0] <= 27
+         && index[1] >= 8 && index[1] <= 12
+         && index[2] >= 8 && index[2] <= 12 )
+      {
+      input->SetPixel( index, 200 ); // foreground need not be 1
+      }
+    // the ring: a [8,19] x [8,19] square with a [12,15] x [12,15] hole,
+    // z in [16,18]
+    if ( index[0] >= 8 && index[0] <= 19
+         && index[1] >= 8 && index[1] <= 19
+         && index[2] >= 16 && index[2] <= 18
+         && !( index[0] >= 12 && index[0] <= 15
+               && index[1] >= 12 && index[1] <= 15 ) )
+      {
+      input->SetPixel( index, 200 );
+      }
+    }
+
+  using FilterType = itk::BinaryThinningImageFilter3D< ImageType, ImageType >;
+  FilterType::Pointer filter = FilterType::New();
+  filter->SetInput( input );
+  filter->Update();
+
+  ImageType::Pointer skeleton = filter->GetThinning();
+
+  // the skeleton is a nonempty subset of the object with values 0 and 1
+  unsigned int skeletonVoxels = 0;
+  itk::ImageRegionConstIteratorWithIndex< ImageType > it( skeleton, region );
+  for ( it.GoToBegin(); !it.IsAtEnd(); ++it )
+    {
+    if ( it.Get() == 0 )
+      {
+      continue;
+      }
+    if ( it.Get() != 1 )
+      {
+      std::cerr << "Unexpected output value " << static_cast< int >( it.Get() )
+                << " at " << it.GetIndex() << std::endl;
+      return EXIT_FAILURE;
+      }
+    if ( input->GetPixel( it.GetIndex() ) == 0 )
+      {
+      std::cerr << "Skeleton voxel " << it.GetIndex()
+                << " outside of the object." << std::endl;
+      return EXIT_FAILURE;
+      }
+    skeletonVoxels++;
+    }
+  if ( skeletonVoxels == 0 )
+    {
+    std::cerr << "The skeleton is empty." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // topology preservation: still exactly two components
+  if ( CountComponents( input ) != 2 )
+    {
+    std::cerr << "The input does not have two components." << std::endl;
+    return EXIT_FAILURE;
+    }
+  if ( CountComponents( skeleton ) != 2 )
+    {
+    std::cerr << "The skeleton does not have two components." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // per-voxel checks of the known skeleton shape
+  int rodMinX = static_cast< int >( size[0] );
+  int rodMaxX = -1;
+  unsigned int rodEndPoints = 0;
+  for ( it.GoToBegin(); !it.IsAtEnd(); ++it )
+    {
+    if ( it.Get() == 0 )
+      {
+      continue;
+      }
+    const ImageType::IndexType index = it.GetIndex();
+    const std::vector< ImageType::IndexType > neighbors =
+      ForegroundNeighbors( skeleton, index );
+
+    if ( index[2] <= 12 )
+      {
+      // The rod thins to its center line: an open curve hugging the
+      // axis of the 5 x 5 cross section, each voxel with at most two
+      // neighbors and exactly two curve end points.
+      if ( index[1] < 9 || index[1] > 11 || index[2] < 9 || index[2] > 11 )
+        {
+        std::cerr << "Rod skeleton voxel " << index
+                  << " is away from the center line." << std::endl;
+        return EXIT_FAILURE;
+        }
+      if ( neighbors.size() > 2 )
+        {
+        std::cerr << "Rod skeleton voxel " << index << " has "
+                  << neighbors.size() << " neighbors." << std::endl;
+        return EXIT_FAILURE;
+        }
+      if ( neighbors.size() == 1 )
+        {
+        rodEndPoints++;
+        }
+      rodMinX = std::min( rodMinX, static_cast< int >( index[0] ) );
+      rodMaxX = std::max( rodMaxX, static_cast< int >( index[0] ) );
+      }
+    else
+      {
+      // the ring thins to a closed curve: two neighbors everywhere
+      if ( neighbors.size() != 2 )
+        {
+        std::cerr << "Ring skeleton voxel " << index << " has "
+                  << neighbors.size() << " neighbors." << std::endl;
+        return EXIT_FAILURE;
+        }
+      }
+    }
+  if ( rodEndPoints != 2 )
+    {
+    std::cerr << "The rod skeleton has " << rodEndPoints
+              << " end points instead of 2." << std::endl;
+    return EXIT_FAILURE;
+    }
+  if ( rodMaxX - rodMinX < 12 )
+    {
+    std::cerr << "The rod skeleton spans only [" << rodMinX << ","
+              << rodMaxX << "] along x." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  std::cout << "Test PASSED." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,200 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkAdaptiveConvolutionImageFilter_h
+#define itkAdaptiveConvolutionImageFilter_h
+
+#include "itkConvolutionImageFilterBase.h"
+#include "itkImage.h"
+#include "itkProgressAccumulator.h"
+
+#include <vector>
+
+namespace itk
+{
+/** \class AdaptiveConvolutionImageFilter
+ * \brief Convolve an image with a kernel, automatically selecting the
+ * faster of the spatial-domain and Fourier-domain implementations.
+ *
+ * Spatial-domain convolution is proportional to the number of output
+ * pixels times the number of kernel elements, while Fourier-domain
+ * convolution grows only logarithmically with the padded image size, so
+ * each approach wins for a different range of kernel sizes. This filter
+ * estimates the cost of both backends and delegates to either
+ * ConvolutionImageFilter or FFTConvolutionImageFilter, whichever the
+ * estimate favors. GetConvolutionMethodUsed() reports the backend that
+ * produced the current output, and SetConvolutionMethod() can be used to
+ * force a particular backend.
+ *
+ * The crossover point depends on the relative speed of the two backends
+ * on the host machine. This is captured by a single scale factor shared
+ * by all instances of the filter, accessible through
+ * SetRelativeFFTCost()/GetRelativeFFTCost(). MeasureRelativeFFTCost()
+ * times both backends on a small synthetic problem and updates the
+ * factor; an application may call it once at startup, or persist the
+ * measured value and restore it with SetRelativeFFTCost().
+ *
+ * When the kernel is an outer product of one-dimensional kernels (a
+ * Gaussian, a box, ...), the spatial backend convolves with the
+ * one-dimensional factors in sequence instead of with the full kernel,
+ * reducing the work per output pixel from the product of the kernel
+ * sizes to their sum. The decomposition is detected from the kernel
+ * pixel values and verified before use. It is only applied when the
+ * result is equivalent to convolution with the full kernel, which
+ * requires a zero flux Neumann, periodic, or zero constant boundary
+ * condition; for other boundary conditions the full kernel is used.
+ * DecomposeSeparableKernelOff() disables the decomposition entirely.
+ *
+ * \ingroup ITKConvolution
+ * \sa ConvolutionImageFilter FFTConvolutionImageFilter
+ */
+template< typename TInputImage,
+          typename TKernelImage = TInputImage,
+          typename TOutputImage = TInputImage,
+          typename TInternalPrecision = double >
+class ITK_TEMPLATE_EXPORT AdaptiveConvolutionImageFilter :
+  public ConvolutionImageFilterBase< TInputImage, TKernelImage, TOutputImage >
+{
+public:
+  ITK_DISALLOW_COPY_AND_ASSIGN(AdaptiveConvolutionImageFilter);
+
+  using Self = AdaptiveConvolutionImageFilter;
+  using Superclass = ConvolutionImageFilterBase< TInputImage, TKernelImage, TOutputImage >;
+  using Pointer = SmartPointer< Self >;
+  using ConstPointer = SmartPointer< const Self >;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information ( and related methods ) */
+  itkTypeMacro(AdaptiveConvolutionImageFilter, ConvolutionImageFilterBase);
+
+  /** Dimensionality of input and output data is assumed to be the same. */
+  static constexpr unsigned int ImageDimension = TInputImage::ImageDimension;
+
+  using InputImageType = TInputImage;
+  using OutputImageType = TOutputImage;
+  using KernelImageType = TKernelImage;
+  using InputPixelType = typename Superclass::InputPixelType;
+  using OutputPixelType = typename Superclass::OutputPixelType;
+  using KernelPixelType = typename Superclass::KernelPixelType;
+  using KernelSizeType = typename Superclass::KernelSizeType;
+  using SizeValueType = typename Superclass::SizeValueType;
+  using OutputRegionType = typename Superclass::OutputRegionType;
+
+  /** Internal types used by the separable decomposition and the FFT
+   * backend. */
+  using InternalImageType = Image< TInternalPrecision, ImageDimension >;
+  using InternalImagePointerType = typename InternalImageType::Pointer;
+
+  typedef enum
+  {
+    AUTOMATIC = 0,
+    SPATIAL,
+    FFT
+  } ConvolutionMethodType;
+
+  /** Set/get the convolution backend. AUTOMATIC (the default) picks the
+   * backend with the smaller estimated cost, SPATIAL and FFT force
+   * ConvolutionImageFilter and FFTConvolutionImageFilter
+   * respectively. */
+  itkSetEnumMacro(ConvolutionMethod, ConvolutionMethodType);
+  itkGetEnumMacro(ConvolutionMethod, ConvolutionMethodType);
+  virtual void SetConvolutionMethodToAutomatic();
+  virtual void SetConvolutionMethodToSpatial();
+  virtual void SetConvolutionMethodToFFT();
+
+  /** Get the backend that produced the current output. Only meaningful
+   * after the filter has run. */
+  itkGetEnumMacro(ConvolutionMethodUsed, ConvolutionMethodType);
+
+  /** Enable/disable the separable kernel decomposition in the spatial
+   * backend. Defaults to on. */
+  itkSetMacro(DecomposeSeparableKernel, bool);
+  itkGetConstMacro(DecomposeSeparableKernel, bool);
+  itkBooleanMacro(DecomposeSeparableKernel);
+
+  /** Set/get the machine profile used by the AUTOMATIC backend
+   * selection: the cost of one Fourier-domain operation expressed in
+   * spatial-domain multiply-accumulates. The factor is shared by all
+   * instances of this filter in the process. */
+  static void SetRelativeFFTCost( double cost ) { m_RelativeFFTCost = cost; }
+  static double GetRelativeFFTCost() { return m_RelativeFFTCost; }
+
+  /** Time both backends on a small synthetic problem, update the
+   * relative FFT cost accordingly and return the new value. */
+  static double MeasureRelativeFFTCost();
+
+protected:
+  AdaptiveConvolutionImageFilter();
+  ~AdaptiveConvolutionImageFilter() override = default;
+
+  /** Whichever backend runs needs the entire kernel image and, in
+   * general, more of the input than the output requested region. As the
+   * backend is not known until the filter runs, request the largest
+   * possible region of both inputs.
+   *
+   * \sa ProcessObject::GenerateInputRequestedRegion()  */
+  void GenerateInputRequestedRegion() override;
+
+  /** This filter delegates to a minipipeline around one of the two
+   * backends. */
+  void GenerateData() override;
+
+  void PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  /** Estimate the cost of both backends for the current inputs and
+   * return the cheaper one. */
+  ConvolutionMethodType ChooseMethod( double kernelWork ) const;
+
+  /** Try to factor the kernel into an outer product of one-dimensional
+   * kernels, one per image dimension. On success the factors are stored
+   * in kernelLines (with the overall scale folded into the first one)
+   * and true is returned; a non-separable kernel returns false. */
+  bool DecomposeKernel( std::vector< InternalImagePointerType > & kernelLines ) const;
+
+  /** Whether the current boundary condition keeps sequential
+   * one-dimensional convolution equivalent to convolution with the full
+   * kernel. */
+  bool BoundaryConditionSupportsDecomposition() const;
+
+  /** Run ConvolutionImageFilter with the full kernel. */
+  void ComputeSpatialConvolution( ProgressAccumulator * progress );
+
+  /** Run one ConvolutionImageFilter per dimension with the
+   * one-dimensional kernel factors. */
+  void ComputeSeparableConvolution( const std::vector< InternalImagePointerType > & kernelLines,
+                                    ProgressAccumulator * progress );
+
+  /** Run FFTConvolutionImageFilter. */
+  void ComputeFFTConvolution( ProgressAccumulator * progress );
+
+  ConvolutionMethodType m_ConvolutionMethod{ AUTOMATIC };
+  ConvolutionMethodType m_ConvolutionMethodUsed{ AUTOMATIC };
+
+  bool m_DecomposeSeparableKernel{ true };
+
+  static double m_RelativeFFTCost;
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#include "itkAdaptiveConvolutionImageFilter.hxx"
+#endif
+
+#endif
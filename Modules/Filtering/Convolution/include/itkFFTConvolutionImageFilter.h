@@ -36,6 +36,14 @@ namespace itk
  * convolution theorem to accelerate the convolution computation when
  * the kernel is large.
  *
+ * The Fourier transform of the kernel is cached between updates, so
+ * repeatedly convolving different images with the same kernel - the
+ * inner loop of iterative deconvolution with a fixed point spread
+ * function - transforms the kernel only once. The pointwise multiply
+ * in the Fourier domain runs in place on the transformed input, so
+ * the filter never holds more than two full-size complex images at a
+ * time.
+ *
  * \warning This filter ignores the spacing, origin, and orientation
  * of the kernel image and treats them as identical to those in the
  * input image.
@@ -156,7 +164,10 @@ protected:
 
   /** Prepare the kernel. This includes resizing the input and kernel
    * images, normalizing the kernel if requested, shifting the kernel,
-   * and taking the Fourier transform of the padded kernel. */
+   * and taking the Fourier transform of the padded kernel. The
+   * transformed kernel is cached, and reused by subsequent updates as
+   * long as the kernel image has not been modified and the padded
+   * size and kernel offset derived from the input are unchanged. */
   void PrepareKernel(const KernelImageType * kernel,
                      InternalComplexImagePointerType & preparedKernel,
                      ProgressAccumulator * progress, float progressWeight);
@@ -189,6 +200,14 @@ protected:
 
 private:
   SizeValueType m_SizeGreatestPrimeFactor;
+
+  /** Cache of the Fourier transform of the kernel, together with the
+   * parameters it was computed for. */
+  InternalComplexImagePointerType m_CachedPreparedKernel;
+  ModifiedTimeType                m_CachedKernelMTime;
+  InputSizeType                   m_CachedPadSize;
+  typename InternalComplexImageType::OffsetType m_CachedKernelOffset;
+  bool                            m_CachedNormalize;
 };
 }
 
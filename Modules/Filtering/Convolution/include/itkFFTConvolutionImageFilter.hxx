@@ -39,6 +39,11 @@ FFTConvolutionImageFilter< TInputImage, TKernelImage, TOutputImage, TInternalPre
 ::FFTConvolutionImageFilter()
 {
   m_SizeGreatestPrimeFactor = FFTFilterType::New()->GetSizeGreatestPrimeFactor();
+  m_CachedPreparedKernel = nullptr;
+  m_CachedKernelMTime = 0;
+  m_CachedPadSize.Fill(0);
+  m_CachedKernelOffset.Fill(0);
+  m_CachedNormalize = false;
 }
 
 template< typename TInputImage, typename TKernelImage, typename TOutputImage, typename TInternalPrecision >
@@ -88,6 +93,11 @@ FFTConvolutionImageFilter< TInputImage, TKernelImage, TOutputImage, TInternalPre
   typename MultiplyFilterType::Pointer multiplyFilter = MultiplyFilterType::New();
   multiplyFilter->SetInput1( input );
   multiplyFilter->SetInput2( kernel );
+  // Run the multiply in place on the transformed input: the product
+  // overwrites the input transform instead of allocating a third
+  // full-size complex image, and the transformed kernel is left
+  // untouched so it can be reused by the next update.
+  multiplyFilter->InPlaceOn();
   multiplyFilter->ReleaseDataFlagOn();
   progress->RegisterInternalFilter( multiplyFilter, 0.1 );
 
@@ -209,6 +219,32 @@ FFTConvolutionImageFilter< TInputImage, TKernelImage, TOutputImage, TInternalPre
   KernelSizeType kernelSize = kernelRegion.GetSize();
 
   InputSizeType padSize = this->GetPadSize();
+
+  const InputSizeType & inputLowerBound = this->GetPadLowerBound();
+  const InputIndexType & inputIndex = this->GetInput()->GetLargestPossibleRegion().GetIndex();
+  const KernelIndexType & kernelIndex = kernelRegion.GetIndex();
+  typename InternalComplexImageType::OffsetType kernelOffset;
+  for (unsigned int i = 0; i < ImageDimension; ++i)
+    {
+    kernelOffset[i] = static_cast< OffsetValueType >( inputIndex[i] - inputLowerBound[i] - kernelIndex[i] );
+    }
+
+  // The transform of the kernel does not depend on the pixel values
+  // of the input, only on the padded size and offset derived from
+  // it. When the same kernel is convolved repeatedly, as in iterative
+  // deconvolution with a fixed point spread function, reuse the
+  // transform computed by the previous update instead of padding,
+  // shifting and transforming the kernel again.
+  if ( m_CachedPreparedKernel.IsNotNull()
+       && m_CachedKernelMTime == kernel->GetMTime()
+       && m_CachedPadSize == padSize
+       && m_CachedKernelOffset == kernelOffset
+       && m_CachedNormalize == this->GetNormalize() )
+    {
+    preparedKernel = m_CachedPreparedKernel;
+    return;
+    }
+
   typename KernelImageType::SizeType kernelUpperBound;
   for (unsigned int i = 0; i < ImageDimension; ++i)
     {
@@ -284,21 +320,25 @@ FFTConvolutionImageFilter< TInputImage, TKernelImage, TOutputImage, TInternalPre
   kernelInfoFilter->ChangeRegionOn();
 
   using InfoOffsetValueType = typename InfoFilterType::OutputImageOffsetValueType;
-  const InputSizeType & inputLowerBound = this->GetPadLowerBound();
-  const InputIndexType & inputIndex = this->GetInput()->GetLargestPossibleRegion().GetIndex();
-  const KernelIndexType & kernelIndex = kernel->GetLargestPossibleRegion().GetIndex();
-  InfoOffsetValueType kernelOffset[ImageDimension];
+  InfoOffsetValueType infoOffset[ImageDimension];
   for (unsigned int i = 0; i < ImageDimension; ++i)
     {
-    kernelOffset[i] = static_cast< InfoOffsetValueType >( inputIndex[i] - inputLowerBound[i] - kernelIndex[i] );
+    infoOffset[i] = static_cast< InfoOffsetValueType >( kernelOffset[i] );
     }
-  kernelInfoFilter->SetOutputOffset( kernelOffset );
+  kernelInfoFilter->SetOutputOffset( infoOffset );
   kernelInfoFilter->SetNumberOfWorkUnits( this->GetNumberOfWorkUnits() );
   kernelInfoFilter->SetInput( kernelFFTFilter->GetOutput() );
   progress->RegisterInternalFilter( kernelInfoFilter, 0.001f * progressWeight );
   kernelInfoFilter->Update();
 
   preparedKernel = kernelInfoFilter->GetOutput();
+  preparedKernel->DisconnectPipeline();
+
+  m_CachedPreparedKernel = preparedKernel;
+  m_CachedKernelMTime = kernel->GetMTime();
+  m_CachedPadSize = padSize;
+  m_CachedKernelOffset = kernelOffset;
+  m_CachedNormalize = this->GetNormalize();
 }
 
 template< typename TInputImage, typename TKernelImage, typename TOutputImage, typename TInternalPrecision >
@@ -0,0 +1,231 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkAdaptiveConvolutionImageFilter.h"
+#include "itkConvolutionImageFilter.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkImageRegionIterator.h"
+
+namespace
+{
+
+using ImageType = itk::Image< float, 2 >;
+using AdaptiveFilterType = itk::AdaptiveConvolutionImageFilter< ImageType >;
+
+// Compare two images pixel by pixel within a tolerance.
+bool ImagesMatch( const ImageType * baseline, const ImageType * test, float tolerance )
+{
+  if ( baseline->GetLargestPossibleRegion() != test->GetLargestPossibleRegion() )
+    {
+    std::cerr << "Region mismatch: " << baseline->GetLargestPossibleRegion()
+              << " versus " << test->GetLargestPossibleRegion() << std::endl;
+    return false;
+    }
+  itk::ImageRegionConstIterator< ImageType >
+    baselineIt( baseline, baseline->GetLargestPossibleRegion() );
+  itk::ImageRegionConstIterator< ImageType >
+    testIt( test, test->GetLargestPossibleRegion() );
+  for ( ; !baselineIt.IsAtEnd(); ++baselineIt, ++testIt )
+    {
+    if ( itk::Math::abs( baselineIt.Get() - testIt.Get() ) > tolerance )
+      {
+      std::cerr << "Pixel mismatch at " << baselineIt.GetIndex() << ": "
+                << baselineIt.Get() << " versus " << testIt.Get() << std::endl;
+      return false;
+      }
+    }
+  return true;
+}
+
+ImageType::Pointer MakeInputImage()
+{
+  ImageType::SizeType size;
+  size.Fill( 64 );
+  ImageType::Pointer image = ImageType::New();
+  image->SetRegions( size );
+  image->Allocate();
+  itk::SizeValueType counter = 0;
+  itk::ImageRegionIterator< ImageType > it( image, image->GetLargestPossibleRegion() );
+  for ( it.GoToBegin(); !it.IsAtEnd(); ++it, ++counter )
+    {
+    it.Set( static_cast< float >( ( counter * 13 ) % 97 ) );
+    }
+  return image;
+}
+
+// Separable kernel: outer product of a 5-tap and a 3-tap triangle.
+ImageType::Pointer MakeSeparableKernel()
+{
+  const float xTaps[5] = { 1.0f, 2.0f, 3.0f, 2.0f, 1.0f };
+  const float yTaps[3] = { 1.0f, 2.0f, 1.0f };
+
+  ImageType::SizeType size;
+  size[0] = 5;
+  size[1] = 3;
+  ImageType::Pointer kernel = ImageType::New();
+  kernel->SetRegions( size );
+  kernel->Allocate();
+  for ( unsigned int y = 0; y < 3; ++y )
+    {
+    for ( unsigned int x = 0; x < 5; ++x )
+      {
+      ImageType::IndexType index = {{ x, y }};
+      kernel->SetPixel( index, xTaps[x] * yTaps[y] );
+      }
+    }
+  return kernel;
+}
+
+ImageType::Pointer MakeNonSeparableKernel()
+{
+  ImageType::SizeType size;
+  size.Fill( 3 );
+  ImageType::Pointer kernel = ImageType::New();
+  kernel->SetRegions( size );
+  kernel->Allocate();
+  kernel->FillBuffer( 1.0f );
+  ImageType::IndexType corner = {{ 0, 0 }};
+  kernel->SetPixel( corner, 5.0f );
+  return kernel;
+}
+
+ImageType::Pointer RunAdaptiveFilter( const ImageType * input,
+                                      const ImageType * kernel,
+                                      AdaptiveFilterType::ConvolutionMethodType method,
+                                      bool decompose,
+                                      bool normalize )
+{
+  AdaptiveFilterType::Pointer filter = AdaptiveFilterType::New();
+  filter->SetInput( input );
+  filter->SetKernelImage( kernel );
+  filter->SetConvolutionMethod( method );
+  filter->SetDecomposeSeparableKernel( decompose );
+  filter->SetNormalize( normalize );
+  filter->Update();
+  if ( method != AdaptiveFilterType::AUTOMATIC
+       && filter->GetConvolutionMethodUsed() != method )
+    {
+    std::cerr << "Filter did not run the requested backend." << std::endl;
+    return nullptr;
+    }
+  ImageType::Pointer output = filter->GetOutput();
+  output->DisconnectPipeline();
+  return output;
+}
+
+} // end anonymous namespace
+
+int itkAdaptiveConvolutionImageFilterTest( int, char *[] )
+{
+  ImageType::Pointer input = MakeInputImage();
+  ImageType::Pointer separableKernel = MakeSeparableKernel();
+  ImageType::Pointer nonSeparableKernel = MakeNonSeparableKernel();
+
+  // Reference output from the plain spatial convolution filter.
+  using ConvolutionFilterType = itk::ConvolutionImageFilter< ImageType >;
+  ConvolutionFilterType::Pointer referenceFilter = ConvolutionFilterType::New();
+  referenceFilter->SetInput( input );
+  referenceFilter->SetKernelImage( separableKernel );
+  referenceFilter->SetNormalize( true );
+  referenceFilter->Update();
+  ImageType::Pointer reference = referenceFilter->GetOutput();
+  reference->DisconnectPipeline();
+
+  // The decomposed spatial backend must match the full-kernel result.
+  ImageType::Pointer decomposedOutput =
+    RunAdaptiveFilter( input, separableKernel, AdaptiveFilterType::SPATIAL, true, true );
+  if ( decomposedOutput.IsNull()
+       || !ImagesMatch( reference, decomposedOutput, 1e-4f ) )
+    {
+    std::cerr << "Separable decomposition does not match the full kernel." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // With the decomposition disabled the wrapper just delegates.
+  ImageType::Pointer plainOutput =
+    RunAdaptiveFilter( input, separableKernel, AdaptiveFilterType::SPATIAL, false, true );
+  if ( plainOutput.IsNull() || !ImagesMatch( reference, plainOutput, 0.0f ) )
+    {
+    std::cerr << "Spatial backend does not match ConvolutionImageFilter." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // The FFT backend computes the same convolution up to round-off.
+  ImageType::Pointer fftOutput =
+    RunAdaptiveFilter( input, separableKernel, AdaptiveFilterType::FFT, true, true );
+  if ( fftOutput.IsNull() || !ImagesMatch( reference, fftOutput, 1e-3f ) )
+    {
+    std::cerr << "FFT backend does not match the spatial backend." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // A non-separable kernel must fall back to the full kernel.
+  ConvolutionFilterType::Pointer nonSeparableReferenceFilter = ConvolutionFilterType::New();
+  nonSeparableReferenceFilter->SetInput( input );
+  nonSeparableReferenceFilter->SetKernelImage( nonSeparableKernel );
+  nonSeparableReferenceFilter->Update();
+  ImageType::Pointer nonSeparableReference = nonSeparableReferenceFilter->GetOutput();
+  nonSeparableReference->DisconnectPipeline();
+  ImageType::Pointer nonSeparableOutput =
+    RunAdaptiveFilter( input, nonSeparableKernel, AdaptiveFilterType::SPATIAL, true, false );
+  if ( nonSeparableOutput.IsNull()
+       || !ImagesMatch( nonSeparableReference, nonSeparableOutput, 0.0f ) )
+    {
+    std::cerr << "Non-separable kernel is not handled by the full-kernel path." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // Automatic selection has to pick one of the two backends and still
+  // compute the right answer.
+  AdaptiveFilterType::Pointer automaticFilter = AdaptiveFilterType::New();
+  automaticFilter->SetInput( input );
+  automaticFilter->SetKernelImage( separableKernel );
+  automaticFilter->SetNormalize( true );
+  automaticFilter->Update();
+  if ( automaticFilter->GetConvolutionMethodUsed() != AdaptiveFilterType::SPATIAL
+       && automaticFilter->GetConvolutionMethodUsed() != AdaptiveFilterType::FFT )
+    {
+    std::cerr << "Automatic selection did not resolve to a backend." << std::endl;
+    return EXIT_FAILURE;
+    }
+  if ( !ImagesMatch( reference, automaticFilter->GetOutput(), 1e-3f ) )
+    {
+    std::cerr << "Automatic backend does not match the reference." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // Exercise the machine profile interface.
+  const double defaultCost = AdaptiveFilterType::GetRelativeFFTCost();
+  AdaptiveFilterType::SetRelativeFFTCost( 2.0 * defaultCost );
+  if ( AdaptiveFilterType::GetRelativeFFTCost() != 2.0 * defaultCost )
+    {
+    std::cerr << "SetRelativeFFTCost() did not update the profile." << std::endl;
+    return EXIT_FAILURE;
+    }
+  const double measuredCost = AdaptiveFilterType::MeasureRelativeFFTCost();
+  if ( measuredCost <= 0.0 || measuredCost != AdaptiveFilterType::GetRelativeFFTCost() )
+    {
+    std::cerr << "MeasureRelativeFFTCost() returned an invalid profile: "
+              << measuredCost << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  std::cout << "Measured relative FFT cost: " << measuredCost << std::endl;
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -183,6 +183,19 @@ public:
   itkBooleanMacro(UseFastTensorComputations);
   itkGetConstMacro(UseFastTensorComputations, bool);
 
+  /** Set/Get the Gaussian weight below which a candidate patch is
+   *  discarded during the entropy gradient computation.  The weighted
+   *  patch distance is accumulated pixel by pixel, and a candidate
+   *  whose partial distance already drives its weight below this
+   *  cutoff is skipped without computing the remaining terms.  The
+   *  default of 1e-16 only prunes patches whose contribution is below
+   *  double precision, leaving the result unchanged; larger values
+   *  (e.g. 1e-6) prune dissimilar patches earlier at a very small
+   *  accuracy cost.  A value of 0 disables the pruning.
+   */
+  itkSetClampMacro(MinimumPatchWeight, double, 0.0, 1.0);
+  itkGetConstReferenceMacro(MinimumPatchWeight, double);
+
   /** Maximum number of Newton-Raphson iterations for sigma update. */
   static constexpr unsigned int MaxSigmaUpdateIterations = 20;
 
@@ -521,6 +534,7 @@ private:
   double         m_SigmaUpdateConvergenceTolerance{ 0.01 };
   ShortArrayType m_SigmaConverged;
   double         m_KernelBandwidthMultiplicationFactor{ 1.0 };
+  double         m_MinimumPatchWeight{ 1.0e-16 };
 
   RealType m_NoiseSigma;
   RealType m_NoiseSigmaSquared;
@@ -2328,6 +2328,21 @@ PatchBasedDenoisingImageFilter<TInputImage, TOutputImage>
 
   bool useCachedComputations = false;
 
+  // Squared norm of the first component at which a candidate patch's
+  // Gaussian weight drops below the minimum patch weight.  Since the
+  // distance accumulates monotonically over the patch pixels, a
+  // candidate can be discarded as soon as its partial norm crosses
+  // this bound, without computing the remaining terms.  The distances
+  // of the later components only ever shrink the weight further, so
+  // the bound derived from the first component is conservative for
+  // multi-component pixels.
+  RealValueType earlyExitSquaredNorm = NumericTraits<RealValueType>::max();
+  if( m_MinimumPatchWeight > 0.0 )
+    {
+    earlyExitSquaredNorm = -2.0 * std::log(m_MinimumPatchWeight)
+      * itk::Math::sqr(m_KernelBandwidthSigma[0]);
+    }
+
   for( typename BaseSamplerType::SubsampleConstIterator selectedIt = selectedPatches->Begin();
        selectedIt != selectedPatches->End();
        ++selectedIt )
@@ -2338,6 +2353,11 @@ PatchBasedDenoisingImageFilter<TInputImage, TOutputImage>
 
     RealValueType distanceJointEntropy = 0.0;
 
+    // The first selected patch is always processed in full so that the
+    // eigen analysis caches for the current patch are fully populated
+    // before any candidate is pruned.
+    bool patchPruned = false;
+
     squaredNorm.Fill(0.0);
     // Compute difference between selectedPatches[ii] and currentPatch
     if( currentPatch.InBounds() )
@@ -2375,6 +2395,15 @@ PatchBasedDenoisingImageFilter<TInputImage, TOutputImage>
           squaredNorm[ic] += tmpNorm1[ic];
           squaredNorm[ic] += tmpNorm2[ic];
           }
+        if( useCachedComputations && squaredNorm[0] >= earlyExitSquaredNorm )
+          {
+          patchPruned = true;
+          break;
+          }
+        }
+      if( patchPruned )
+        {
+        continue;
         }
       // Now compute the center value
       this->ComputeDifferenceAndWeightedSquaredNorm( currentPatchVec[center],
@@ -2429,6 +2458,15 @@ PatchBasedDenoisingImageFilter<TInputImage, TOutputImage>
             squaredNorm[ic] += tmpNorm1[ic];
             }
           }
+        if( useCachedComputations && squaredNorm[0] >= earlyExitSquaredNorm )
+          {
+          patchPruned = true;
+          break;
+          }
+        }
+      if( patchPruned )
+        {
+        continue;
         }
 
       // Compute the center value (center is always in bounds)
@@ -2562,6 +2600,7 @@ PatchBasedDenoisingImageFilter<TInputImage, TOutputImage>
   os << indent << "SigmaConverged: " << m_SigmaConverged << std::endl;
   os << indent << "KernelBandwidthMultiplicationFactor: "
      << m_KernelBandwidthMultiplicationFactor << std::endl;
+  os << indent << "MinimumPatchWeight: " << m_MinimumPatchWeight << std::endl;
 
   os << indent << "NoiseSigma: " << m_NoiseSigma << std::endl;
   os << indent << "NoiseSigmaSquared: " << m_NoiseSigmaSquared << std::endl;
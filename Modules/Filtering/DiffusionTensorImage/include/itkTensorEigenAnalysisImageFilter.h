@@ -0,0 +1,130 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkTensorEigenAnalysisImageFilter_h
+#define itkTensorEigenAnalysisImageFilter_h
+
+#include "itkImageToImageFilter.h"
+#include "itkImage.h"
+#include "itkVector.h"
+
+namespace itk
+{
+/** \class TensorEigenAnalysisImageFilter
+ * \brief Computes eigenvalues, fractional anisotropy and mean
+ * diffusivity for every pixel of an input tensor image in one pass.
+ *
+ * The filter expects an image of 3D symmetric second rank tensors,
+ * e.g. DiffusionTensor3D pixels, and produces three outputs over the
+ * same image grid:
+ *
+ * - Output 0 holds the three eigenvalues of every tensor in ascending
+ *   order, as a Vector pixel. It is available through
+ *   GetEigenValueOutput().
+ * - Output 1 holds the fractional anisotropy and is available through
+ *   GetFractionalAnisotropyOutput().
+ * - Output 2 holds the mean diffusivity (one third of the tensor
+ *   trace) and is available through GetMeanDiffusivityOutput().
+ *
+ * The per-pixel eigenproblems are solved in batches with the analytic
+ * SymmetricEigenAnalysis3DBatch solver, which reads the tensor
+ * components in structure-of-arrays form so the inner loop can be
+ * vectorized. This replaces one SymmetricEigenAnalysis invocation per
+ * pixel, and computes the two scalar measures from the already
+ * available eigenvalues instead of revisiting the tensor image once
+ * per measure.
+ *
+ * \sa SymmetricEigenAnalysis3DBatch
+ * \sa TensorFractionalAnisotropyImageFilter
+ * \sa DiffusionTensor3D
+ *
+ * \ingroup IntensityImageFilters  MultiThreaded  TensorObjects
+ *
+ * \ingroup ITKDiffusionTensorImage
+ */
+template< typename TInputImage,
+  typename TRealType =
+    typename NumericTraits< typename TInputImage::PixelType::ValueType >::RealType >
+class ITK_TEMPLATE_EXPORT TensorEigenAnalysisImageFilter:
+  public ImageToImageFilter< TInputImage,
+    Image< Vector< TRealType, 3 >, TInputImage::ImageDimension > >
+{
+public:
+  ITK_DISALLOW_COPY_AND_ASSIGN(TensorEigenAnalysisImageFilter);
+
+  /** Dimension of the input and the output images. */
+  static constexpr unsigned int ImageDimension = TInputImage::ImageDimension;
+
+  /** Type of the computed eigenvalues and scalar measures. */
+  using RealType = TRealType;
+
+  /** Image types. */
+  using InputImageType = TInputImage;
+  using InputPixelType = typename InputImageType::PixelType;
+  using EigenValuePixelType = Vector< RealType, 3 >;
+  using EigenValueImageType = Image< EigenValuePixelType, ImageDimension >;
+  using ScalarImageType = Image< RealType, ImageDimension >;
+
+  /** Standard class type aliases. */
+  using Self = TensorEigenAnalysisImageFilter;
+  using Superclass = ImageToImageFilter< InputImageType, EigenValueImageType >;
+  using Pointer = SmartPointer< Self >;
+  using ConstPointer = SmartPointer< const Self >;
+
+  using OutputImageRegionType = typename Superclass::OutputImageRegionType;
+  using DataObjectPointer = typename Superclass::DataObjectPointer;
+  using DataObjectPointerArraySizeType = ProcessObject::DataObjectPointerArraySizeType;
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(TensorEigenAnalysisImageFilter, ImageToImageFilter);
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Returns the image of per-pixel eigenvalues in ascending order. */
+  EigenValueImageType * GetEigenValueOutput();
+
+  /** Returns the fractional anisotropy image. */
+  ScalarImageType * GetFractionalAnisotropyOutput();
+
+  /** Returns the mean diffusivity image. */
+  ScalarImageType * GetMeanDiffusivityOutput();
+
+  /** Standard itk::ProcessObject subclass method. */
+  using Superclass::MakeOutput;
+  DataObjectPointer MakeOutput(DataObjectPointerArraySizeType idx) override;
+
+#ifdef ITK_USE_CONCEPT_CHECKING
+  // Begin concept checking
+  itkConceptMacro( InputHasNumericTraitsCheck,
+                   ( Concept::HasNumericTraits< typename InputPixelType::ValueType > ) );
+  // End concept checking
+#endif
+
+protected:
+  TensorEigenAnalysisImageFilter();
+  ~TensorEigenAnalysisImageFilter() override = default;
+
+  void DynamicThreadedGenerateData(const OutputImageRegionType & outputRegionForThread) override;
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#include "itkTensorEigenAnalysisImageFilter.hxx"
+#endif
+
+#endif
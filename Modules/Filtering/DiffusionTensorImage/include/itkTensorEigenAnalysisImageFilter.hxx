@@ -0,0 +1,171 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkTensorEigenAnalysisImageFilter_hxx
+#define itkTensorEigenAnalysisImageFilter_hxx
+
+#include "itkTensorEigenAnalysisImageFilter.h"
+#include "itkSymmetricEigenAnalysis3DBatch.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkImageRegionIterator.h"
+
+namespace itk
+{
+template< typename TInputImage, typename TRealType >
+TensorEigenAnalysisImageFilter< TInputImage, TRealType >
+::TensorEigenAnalysisImageFilter()
+{
+  this->SetNumberOfRequiredOutputs(3);
+
+  // eigenvalues
+  this->SetNthOutput( 0, this->MakeOutput(0) );
+
+  // fractional anisotropy
+  this->SetNthOutput( 1, this->MakeOutput(1) );
+
+  // mean diffusivity
+  this->SetNthOutput( 2, this->MakeOutput(2) );
+}
+
+template< typename TInputImage, typename TRealType >
+typename TensorEigenAnalysisImageFilter< TInputImage, TRealType >::DataObjectPointer
+TensorEigenAnalysisImageFilter< TInputImage, TRealType >
+::MakeOutput(DataObjectPointerArraySizeType idx)
+{
+  if ( idx == 1 || idx == 2 )
+    {
+    return ScalarImageType::New().GetPointer();
+    }
+  return Superclass::MakeOutput(idx);
+}
+
+template< typename TInputImage, typename TRealType >
+typename TensorEigenAnalysisImageFilter< TInputImage, TRealType >::EigenValueImageType *
+TensorEigenAnalysisImageFilter< TInputImage, TRealType >
+::GetEigenValueOutput()
+{
+  return dynamic_cast< EigenValueImageType * >(
+           this->ProcessObject::GetOutput(0) );
+}
+
+template< typename TInputImage, typename TRealType >
+typename TensorEigenAnalysisImageFilter< TInputImage, TRealType >::ScalarImageType *
+TensorEigenAnalysisImageFilter< TInputImage, TRealType >
+::GetFractionalAnisotropyOutput()
+{
+  return dynamic_cast< ScalarImageType * >(
+           this->ProcessObject::GetOutput(1) );
+}
+
+template< typename TInputImage, typename TRealType >
+typename TensorEigenAnalysisImageFilter< TInputImage, TRealType >::ScalarImageType *
+TensorEigenAnalysisImageFilter< TInputImage, TRealType >
+::GetMeanDiffusivityOutput()
+{
+  return dynamic_cast< ScalarImageType * >(
+           this->ProcessObject::GetOutput(2) );
+}
+
+template< typename TInputImage, typename TRealType >
+void
+TensorEigenAnalysisImageFilter< TInputImage, TRealType >
+::DynamicThreadedGenerateData(const OutputImageRegionType & outputRegionForThread)
+{
+  const InputImageType *input = this->GetInput();
+  EigenValueImageType * eigenValueOutput = this->GetEigenValueOutput();
+  ScalarImageType *     fractionalAnisotropyOutput = this->GetFractionalAnisotropyOutput();
+  ScalarImageType *     meanDiffusivityOutput = this->GetMeanDiffusivityOutput();
+
+  using BatchSolverType = SymmetricEigenAnalysis3DBatch< RealType >;
+
+  // The tensor components are gathered into small structure-of-arrays
+  // blocks so that the batch solver runs over contiguous memory.
+  constexpr SizeValueType batchLength = 64;
+  RealType sxx[batchLength];
+  RealType sxy[batchLength];
+  RealType sxz[batchLength];
+  RealType syy[batchLength];
+  RealType syz[batchLength];
+  RealType szz[batchLength];
+  RealType eigenValue0[batchLength];
+  RealType eigenValue1[batchLength];
+  RealType eigenValue2[batchLength];
+
+  ImageRegionConstIterator< InputImageType > inputIt(input, outputRegionForThread);
+  ImageRegionIterator< EigenValueImageType > eigenValueIt(eigenValueOutput,
+                                                          outputRegionForThread);
+  ImageRegionIterator< ScalarImageType > fractionalAnisotropyIt(fractionalAnisotropyOutput,
+                                                                outputRegionForThread);
+  ImageRegionIterator< ScalarImageType > meanDiffusivityIt(meanDiffusivityOutput,
+                                                           outputRegionForThread);
+
+  while ( !inputIt.IsAtEnd() )
+    {
+    SizeValueType numberGathered = 0;
+    while ( numberGathered < batchLength && !inputIt.IsAtEnd() )
+      {
+      const InputPixelType & tensor = inputIt.Value();
+      sxx[numberGathered] = static_cast< RealType >( tensor[0] );
+      sxy[numberGathered] = static_cast< RealType >( tensor[1] );
+      sxz[numberGathered] = static_cast< RealType >( tensor[2] );
+      syy[numberGathered] = static_cast< RealType >( tensor[3] );
+      syz[numberGathered] = static_cast< RealType >( tensor[4] );
+      szz[numberGathered] = static_cast< RealType >( tensor[5] );
+      ++numberGathered;
+      ++inputIt;
+      }
+
+    BatchSolverType::ComputeEigenValues(numberGathered,
+                                        sxx, sxy, sxz, syy, syz, szz,
+                                        eigenValue0, eigenValue1, eigenValue2);
+
+    for ( SizeValueType j = 0; j < numberGathered; ++j )
+      {
+      EigenValuePixelType eigenValues;
+      eigenValues[0] = eigenValue0[j];
+      eigenValues[1] = eigenValue1[j];
+      eigenValues[2] = eigenValue2[j];
+      eigenValueIt.Set(eigenValues);
+      ++eigenValueIt;
+
+      const RealType trace = eigenValue0[j] + eigenValue1[j] + eigenValue2[j];
+      meanDiffusivityIt.Set(trace / 3);
+      ++meanDiffusivityIt;
+
+      // Same expression as DiffusionTensor3D::GetFractionalAnisotropy,
+      // with the inner scalar product written in the eigenbasis.
+      const RealType innerScalarProduct = eigenValue0[j] * eigenValue0[j]
+                                          + eigenValue1[j] * eigenValue1[j]
+                                          + eigenValue2[j] * eigenValue2[j];
+      RealType fractionalAnisotropy = NumericTraits< RealType >::ZeroValue();
+      if ( innerScalarProduct > 0 )
+        {
+        const RealType anisotropy = 3 * innerScalarProduct - trace * trace;
+        if ( anisotropy > 0 )
+          {
+          fractionalAnisotropy =
+            std::sqrt( anisotropy / ( 2 * innerScalarProduct ) );
+          }
+        }
+      fractionalAnisotropyIt.Set(fractionalAnisotropy);
+      ++fractionalAnisotropyIt;
+      }
+    }
+}
+} // end namespace itk
+
+#endif
@@ -0,0 +1,145 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkTensorEigenAnalysisImageFilter.h"
+#include "itkDiffusionTensor3D.h"
+#include "itkImageRegionIterator.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkMersenneTwisterRandomVariateGenerator.h"
+#include "itkMath.h"
+
+int itkTensorEigenAnalysisImageFilterTest(int, char* [] )
+{
+  constexpr unsigned int myDimension = 3;
+
+  using myTensorType = itk::DiffusionTensor3D< double >;
+  using myImageType = itk::Image< myTensorType, myDimension >;
+  using myRegionType = itk::ImageRegion< myDimension >;
+
+  // Create an image of random symmetric tensors
+  myImageType::Pointer inputImage = myImageType::New();
+
+  itk::Size< myDimension > size;
+  size.Fill(8);
+
+  myRegionType region;
+  region.SetSize( size );
+
+  inputImage->SetRegions( region );
+  inputImage->Allocate();
+
+  using GeneratorType = itk::Statistics::MersenneTwisterRandomVariateGenerator;
+  GeneratorType::Pointer generator = GeneratorType::New();
+  generator->Initialize( 71 );
+
+  itk::ImageRegionIterator< myImageType > it( inputImage, region );
+  while ( !it.IsAtEnd() )
+    {
+    myTensorType tensor;
+    for ( unsigned int c = 0; c < 6; ++c )
+      {
+      tensor[c] = generator->GetUniformVariate( -1.0, 1.0 );
+      }
+    it.Set( tensor );
+    ++it;
+    }
+
+  // Include one isotropic tensor to exercise the degenerate case
+  myTensorType isotropicTensor;
+  isotropicTensor.Fill( 0.0 );
+  isotropicTensor[0] = 2.0;
+  isotropicTensor[3] = 2.0;
+  isotropicTensor[5] = 2.0;
+  itk::Index< myDimension > firstIndex;
+  firstIndex.Fill(0);
+  inputImage->SetPixel( firstIndex, isotropicTensor );
+
+  using FilterType = itk::TensorEigenAnalysisImageFilter< myImageType >;
+  FilterType::Pointer filter = FilterType::New();
+  filter->SetInput( inputImage );
+  filter->Update();
+
+  FilterType::EigenValueImageType::Pointer eigenValueImage =
+    filter->GetEigenValueOutput();
+  FilterType::ScalarImageType::Pointer fractionalAnisotropyImage =
+    filter->GetFractionalAnisotropyOutput();
+  FilterType::ScalarImageType::Pointer meanDiffusivityImage =
+    filter->GetMeanDiffusivityOutput();
+
+  // Compare against the per-pixel eigenanalysis and scalar measures of
+  // DiffusionTensor3D. The analytic solver is accurate to roughly the
+  // square root of the machine precision in the worst case.
+  constexpr double tolerance = 1.0e-6;
+
+  itk::ImageRegionConstIterator< myImageType > inputIt( inputImage, region );
+  itk::ImageRegionConstIterator< FilterType::EigenValueImageType >
+    eigenValueIt( eigenValueImage, region );
+  itk::ImageRegionConstIterator< FilterType::ScalarImageType >
+    fractionalAnisotropyIt( fractionalAnisotropyImage, region );
+  itk::ImageRegionConstIterator< FilterType::ScalarImageType >
+    meanDiffusivityIt( meanDiffusivityImage, region );
+
+  while ( !inputIt.IsAtEnd() )
+    {
+    const myTensorType & tensor = inputIt.Value();
+
+    myTensorType::EigenValuesArrayType expectedEigenValues;
+    tensor.ComputeEigenValues( expectedEigenValues );
+
+    const FilterType::EigenValuePixelType & eigenValues = eigenValueIt.Value();
+    for ( unsigned int k = 0; k < 3; ++k )
+      {
+      if ( itk::Math::abs( eigenValues[k] - expectedEigenValues[k] ) > tolerance )
+        {
+        std::cerr << "Eigenvalue " << k << " at " << inputIt.GetIndex()
+                  << " is " << eigenValues[k] << ", expected "
+                  << expectedEigenValues[k] << std::endl;
+        return EXIT_FAILURE;
+        }
+      }
+
+    const double expectedFractionalAnisotropy =
+      tensor.GetFractionalAnisotropy();
+    if ( itk::Math::abs( fractionalAnisotropyIt.Value()
+           - expectedFractionalAnisotropy ) > tolerance )
+      {
+      std::cerr << "Fractional anisotropy at " << inputIt.GetIndex()
+                << " is " << fractionalAnisotropyIt.Value() << ", expected "
+                << expectedFractionalAnisotropy << std::endl;
+      return EXIT_FAILURE;
+      }
+
+    const double expectedMeanDiffusivity = tensor.GetTrace() / 3.0;
+    if ( itk::Math::abs( meanDiffusivityIt.Value()
+           - expectedMeanDiffusivity ) > tolerance )
+      {
+      std::cerr << "Mean diffusivity at " << inputIt.GetIndex()
+                << " is " << meanDiffusivityIt.Value() << ", expected "
+                << expectedMeanDiffusivity << std::endl;
+      return EXIT_FAILURE;
+      }
+
+    ++inputIt;
+    ++eigenValueIt;
+    ++fractionalAnisotropyIt;
+    ++meanDiffusivityIt;
+    }
+
+  std::cout << "Test passed." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -185,15 +185,24 @@ protected:
   typename LightObject::Pointer InternalClone() const override;
 
   /**
-   * Smooth the displacement field using B-splines.
+   * Smooth the displacement field using B-splines.  The supplied fitter
+   * performs the work and is retained by the transform between calls so
+   * that the basis function weights computed for the fixed field grid can
+   * be reused from one call to the next.
    */
-   DisplacementFieldPointer BSplineSmoothDisplacementField( const DisplacementFieldType *, const ArrayType & );
+   DisplacementFieldPointer BSplineSmoothDisplacementField( const DisplacementFieldType *, const ArrayType &,
+     BSplineFilterType * );
 
 private:
   SplineOrderType             m_SplineOrder{ 3 };
   bool                        m_EnforceStationaryBoundary{ true };
   ArrayType                   m_NumberOfControlPointsForTheUpdateField;
   ArrayType                   m_NumberOfControlPointsForTheTotalField;
+
+  /** The update field and the total field are fit on different control
+   * point grids so each keeps its own fitter (and weight cache). */
+  typename BSplineFilterType::Pointer m_UpdateFieldFitter;
+  typename BSplineFilterType::Pointer m_TotalFieldFitter;
 };
 
 } // end namespace itk
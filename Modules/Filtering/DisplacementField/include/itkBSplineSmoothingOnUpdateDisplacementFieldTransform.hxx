@@ -38,6 +38,11 @@ BSplineSmoothingOnUpdateDisplacementFieldTransform<TParametersValueType, NDimens
 {
   this->m_NumberOfControlPointsForTheUpdateField.Fill( 4 );
   this->m_NumberOfControlPointsForTheTotalField.Fill( 0 );
+
+  this->m_UpdateFieldFitter = BSplineFilterType::New();
+  this->m_UpdateFieldFitter->CacheBasisFunctionWeightsOn();
+  this->m_TotalFieldFitter = BSplineFilterType::New();
+  this->m_TotalFieldFitter->CacheBasisFunctionWeightsOn();
 }
 
 /**
@@ -123,7 +128,8 @@ BSplineSmoothingOnUpdateDisplacementFieldTransform<TParametersValueType, NDimens
     updateField->Update();
     updateField->DisconnectPipeline();
 
-    DisplacementFieldPointer updateSmoothField = this->BSplineSmoothDisplacementField( updateField, this->m_NumberOfControlPointsForTheUpdateField );
+    DisplacementFieldPointer updateSmoothField = this->BSplineSmoothDisplacementField( updateField,
+      this->m_NumberOfControlPointsForTheUpdateField, this->m_UpdateFieldFitter );
 
     auto * updatePointer = reinterpret_cast<DerivativeValueType *>( updateSmoothField->GetBufferPointer() );
 
@@ -167,7 +173,8 @@ BSplineSmoothingOnUpdateDisplacementFieldTransform<TParametersValueType, NDimens
     totalField->Update();
     totalField->DisconnectPipeline();
 
-    DisplacementFieldPointer totalSmoothField = this->BSplineSmoothDisplacementField( totalField, this->m_NumberOfControlPointsForTheTotalField );
+    DisplacementFieldPointer totalSmoothField = this->BSplineSmoothDisplacementField( totalField,
+      this->m_NumberOfControlPointsForTheTotalField, this->m_TotalFieldFitter );
 
     ImageAlgorithm::Copy<DisplacementFieldType, DisplacementFieldType>( totalSmoothField, totalField, totalSmoothField->GetBufferedRegion(), totalField->GetBufferedRegion() );
     }
@@ -179,9 +186,9 @@ BSplineSmoothingOnUpdateDisplacementFieldTransform<TParametersValueType, NDimens
 template<typename TParametersValueType, unsigned int NDimensions>
 typename BSplineSmoothingOnUpdateDisplacementFieldTransform<TParametersValueType, NDimensions>::DisplacementFieldPointer
 BSplineSmoothingOnUpdateDisplacementFieldTransform<TParametersValueType, NDimensions>
-::BSplineSmoothDisplacementField( const DisplacementFieldType * field, const ArrayType &numberOfControlPoints )
+::BSplineSmoothDisplacementField( const DisplacementFieldType * field, const ArrayType &numberOfControlPoints,
+  BSplineFilterType * bspliner )
 {
-  typename BSplineFilterType::Pointer bspliner = BSplineFilterType::New();
   bspliner->SetUseInputFieldToDefineTheBSplineDomain( true );
   bspliner->SetDisplacementField( field );
   bspliner->SetNumberOfControlPoints( numberOfControlPoints );
@@ -192,6 +199,7 @@ BSplineSmoothingOnUpdateDisplacementFieldTransform<TParametersValueType, NDimens
   bspliner->Update();
 
   DisplacementFieldPointer smoothField = bspliner->GetOutput();
+  smoothField->DisconnectPipeline();
 
   return smoothField;
 }
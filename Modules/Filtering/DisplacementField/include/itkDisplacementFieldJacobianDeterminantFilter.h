@@ -199,6 +199,20 @@ public:
   void SetDerivativeWeights(const WeightsType &);
   itkGetConstReferenceMacro(DerivativeWeights, WeightsType);
 
+  /** Set/Get whether a second output holding the pixelwise natural logarithm
+      of the Jacobian determinant is produced in the same pass over the
+      field.  Determinant values that are not positive (folded regions) are
+      clamped to the smallest positive value of the real type before the
+      logarithm is taken.  Default is off. */
+  void SetComputeLogJacobianDeterminant(bool);
+  itkGetConstMacro(ComputeLogJacobianDeterminant, bool);
+  itkBooleanMacro(ComputeLogJacobianDeterminant);
+
+  /** Get the log-Jacobian determinant image.  Only valid after an update
+      with ComputeLogJacobianDeterminant enabled. */
+  TOutputImage * GetLogJacobianDeterminantOutput()
+  { return this->GetOutput(1); }
+
 protected:
   DisplacementFieldJacobianDeterminantFilter();
   ~DisplacementFieldJacobianDeterminantFilter() override = default;
@@ -243,8 +257,18 @@ protected:
   WeightsType m_HalfDerivativeWeights;
 
 private:
+  /** Evaluate one scanline of the face whose neighborhoods lie entirely
+      inside the buffered region using central differences on raw pointers.
+      The log output pointer may be null when the log-Jacobian determinant
+      is not requested. */
+  void EvaluateScanline(const RealVectorType *centerPixel, SizeValueType lineLength,
+                        const OffsetValueType *strides,
+                        OutputPixelType *outputPixel, OutputPixelType *logOutputPixel) const;
+
   bool m_UseImageSpacing;
 
+  bool m_ComputeLogJacobianDeterminant;
+
   ThreadIdType m_RequestedNumberOfThreads;
 
   typename ImageBaseType::ConstPointer m_RealValuedInputImage;
@@ -22,6 +22,7 @@
 
 #include "itkNeighborhoodAlgorithm.h"
 #include "itkImageRegionIterator.h"
+#include "itkImageRegionConstIteratorWithIndex.h"
 #include "itkZeroFluxNeumannBoundaryCondition.h"
 #include "itkProgressReporter.h"
 #include "itkVectorCastImageFilter.h"
@@ -29,6 +30,9 @@
 #include "itkMath.h"
 #include "itkMath.h"
 
+#include <algorithm>  // For max.
+#include <cmath>      // For log.
+
 namespace itk
 {
 template< typename TInputImage, typename TRealType, typename TOutputImage >
@@ -36,6 +40,7 @@ DisplacementFieldJacobianDeterminantFilter< TInputImage, TRealType, TOutputImage
 ::DisplacementFieldJacobianDeterminantFilter()
 {
   m_UseImageSpacing = true;
+  m_ComputeLogJacobianDeterminant = false;
   m_RequestedNumberOfThreads = this->GetNumberOfWorkUnits();
   m_NeighborhoodRadius.Fill(1);
   m_DerivativeWeights.Fill(1.0);
@@ -90,6 +95,24 @@ DisplacementFieldJacobianDeterminantFilter< TInputImage, TRealType, TOutputImage
   this->Modified();
 }
 
+template< typename TInputImage, typename TRealType, typename TOutputImage >
+void
+DisplacementFieldJacobianDeterminantFilter< TInputImage, TRealType, TOutputImage >
+::SetComputeLogJacobianDeterminant(bool f)
+{
+  if ( m_ComputeLogJacobianDeterminant == f )
+    {
+    return;
+    }
+
+  m_ComputeLogJacobianDeterminant = f;
+  if ( f && this->GetNumberOfIndexedOutputs() < 2 )
+    {
+    this->SetNthOutput( 1, this->MakeOutput(1) );
+    }
+  this->Modified();
+}
+
 template< typename TInputImage, typename TRealType, typename TOutputImage >
 void
 DisplacementFieldJacobianDeterminantFilter< TInputImage, TRealType, TOutputImage >
@@ -182,38 +205,131 @@ DisplacementFieldJacobianDeterminantFilter< TInputImage, TRealType, TOutputImage
   ConstNeighborhoodIteratorType                           bit;
   ImageRegionIterator< TOutputImage >                     it;
 
+  const auto *realInput =
+    dynamic_cast< const RealVectorImageType * >( m_RealValuedInputImage.GetPointer() );
+  TOutputImage *output = this->GetOutput();
+  TOutputImage *logOutput = nullptr;
+  if ( m_ComputeLogJacobianDeterminant )
+    {
+    logOutput = this->GetOutput(1);
+    }
+
   // Find the data-set boundary "faces"
   typename NeighborhoodAlgorithm::ImageBoundaryFacesCalculator< RealVectorImageType >::
   FaceListType faceList;
   NeighborhoodAlgorithm::ImageBoundaryFacesCalculator< RealVectorImageType > bC;
-  faceList = bC(dynamic_cast< const RealVectorImageType * >( m_RealValuedInputImage.GetPointer() ),
-                outputRegionForThread, m_NeighborhoodRadius);
+  faceList = bC(realInput, outputRegionForThread, m_NeighborhoodRadius);
 
   typename NeighborhoodAlgorithm::ImageBoundaryFacesCalculator< RealVectorImageType >::
   FaceListType::iterator fit;
   fit = faceList.begin();
 
-  // Process each of the data set faces.  The iterator is reinitialized on each
-  // face so that it can determine whether or not to check for boundary
-  // conditions.
-  for ( fit = faceList.begin(); fit != faceList.end(); ++fit )
+  // The first face contains the pixels whose entire neighborhood lies inside
+  // the buffered region.  Process it scanline by scanline with central
+  // differences on raw pointers, which keeps the inner loop free of the
+  // neighborhood iterator bookkeeping.
+  if ( fit != faceList.end() )
     {
-    bit = ConstNeighborhoodIteratorType(m_NeighborhoodRadius,
-                                        dynamic_cast< const RealVectorImageType * >( m_RealValuedInputImage.GetPointer() ),
-                                        *fit);
-    it = ImageRegionIterator< TOutputImage >(this->GetOutput(), *fit);
+    OffsetValueType strides[ImageDimension];
+    const OffsetValueType *offsetTable = realInput->GetOffsetTable();
+    for ( unsigned int i = 0; i < ImageDimension; ++i )
+      {
+      strides[i] = offsetTable[i];
+      }
+
+    const RealVectorType *inputBuffer = realInput->GetBufferPointer();
+    OutputPixelType *outputBuffer = output->GetBufferPointer();
+    OutputPixelType *logOutputBuffer =
+      ( logOutput ? logOutput->GetBufferPointer() : nullptr );
+
+    const SizeValueType lineLength = fit->GetSize(0);
+
+    // Collapse the face along the scanline direction so the iterator only
+    // visits the start of each line.
+    OutputImageRegionType lineRegion = *fit;
+    lineRegion.SetSize(0, 1);
+
+    ImageRegionConstIteratorWithIndex< RealVectorImageType > lineIt(realInput, lineRegion);
+    for ( lineIt.GoToBegin(); !lineIt.IsAtEnd(); ++lineIt )
+      {
+      const typename RealVectorImageType::IndexType lineIndex = lineIt.GetIndex();
+
+      const RealVectorType *centerPixel = inputBuffer + realInput->ComputeOffset(lineIndex);
+      OutputPixelType *outputPixel = outputBuffer + output->ComputeOffset(lineIndex);
+      OutputPixelType *logOutputPixel =
+        ( logOutputBuffer ? logOutputBuffer + logOutput->ComputeOffset(lineIndex) : nullptr );
+
+      this->EvaluateScanline(centerPixel, lineLength, strides, outputPixel, logOutputPixel);
+      }
+    ++fit;
+    }
+
+  // Process the remaining (boundary) faces.  The iterator is reinitialized
+  // on each face so that it can determine whether or not to check for
+  // boundary conditions.
+  for (; fit != faceList.end(); ++fit )
+    {
+    bit = ConstNeighborhoodIteratorType(m_NeighborhoodRadius, realInput, *fit);
+    it = ImageRegionIterator< TOutputImage >(output, *fit);
     bit.OverrideBoundaryCondition(&nbc);
     bit.GoToBegin();
 
+    ImageRegionIterator< TOutputImage > logIt;
+    if ( logOutput )
+      {
+      logIt = ImageRegionIterator< TOutputImage >(logOutput, *fit);
+      logIt.GoToBegin();
+      }
+
     while ( !bit.IsAtEnd() )
       {
-      it.Set( static_cast< OutputPixelType >( this->EvaluateAtNeighborhood(bit) ) );
+      const TRealType determinant = this->EvaluateAtNeighborhood(bit);
+      it.Set( static_cast< OutputPixelType >( determinant ) );
+      if ( logOutput )
+        {
+        logIt.Set( static_cast< OutputPixelType >(
+                     std::log( std::max( determinant, NumericTraits< TRealType >::min() ) ) ) );
+        ++logIt;
+        }
       ++bit;
       ++it;
       }
     }
 }
 
+template< typename TInputImage, typename TRealType, typename TOutputImage >
+void
+DisplacementFieldJacobianDeterminantFilter< TInputImage, TRealType, TOutputImage >
+::EvaluateScanline(const RealVectorType *centerPixel, SizeValueType lineLength,
+                   const OffsetValueType *strides,
+                   OutputPixelType *outputPixel, OutputPixelType *logOutputPixel) const
+{
+  for ( SizeValueType x = 0; x < lineLength; ++x, ++centerPixel )
+    {
+    vnl_matrix_fixed< TRealType, ImageDimension, VectorDimension > J;
+    for ( unsigned int i = 0; i < ImageDimension; ++i )
+      {
+      const RealVectorType & next = centerPixel[strides[i]];
+      const RealVectorType & previous = centerPixel[-strides[i]];
+      for ( unsigned int j = 0; j < VectorDimension; ++j )
+        {
+        J[i][j] = m_HalfDerivativeWeights[i] * ( next[j] - previous[j] );
+        }
+      // add one on the diagonal to consider the warping and not only the
+      // deformation field
+      J[i][i] += 1.0;
+      }
+
+    const TRealType determinant = vnl_det(J);
+    outputPixel[x] = static_cast< OutputPixelType >( determinant );
+    if ( logOutputPixel )
+      {
+      logOutputPixel[x] = static_cast< OutputPixelType >(
+        std::log( std::max( determinant, NumericTraits< TRealType >::min() ) ) );
+      }
+    }
+}
+
 template< typename TInputImage, typename TRealType, typename TOutputImage >
 TRealType
 DisplacementFieldJacobianDeterminantFilter< TInputImage, TRealType, TOutputImage >
@@ -243,6 +359,8 @@ DisplacementFieldJacobianDeterminantFilter< TInputImage, TRealType, TOutputImage
   Superclass::PrintSelf(os, indent);
   os << indent << "m_UseImageSpacing = "          << m_UseImageSpacing
      << std::endl;
+  os << indent << "m_ComputeLogJacobianDeterminant = " << m_ComputeLogJacobianDeterminant
+     << std::endl;
   os << indent << "m_RequestedNumberOfThreads = " << m_RequestedNumberOfThreads
      << std::endl;
   os << indent << "m_DerivativeWeights = ";
@@ -250,6 +250,18 @@ public:
   itkSetMacro( EnforceStationaryBoundary, bool );
   itkGetConstMacro( EnforceStationaryBoundary, bool );
 
+  /**
+   * Reuse the B-spline basis function weights computed for the control point
+   * grid the next time the filter runs.  Only valid when the filter is run
+   * repeatedly with an unchanged B-spline domain, displacement field geometry,
+   * point set locations, and number of control points so that only the
+   * displacement values differ from run to run, e.g. when smoothing the field
+   * at each iteration of a deformable registration.  Default = false.
+   */
+  itkBooleanMacro( CacheBasisFunctionWeights );
+  itkSetMacro( CacheBasisFunctionWeights, bool );
+  itkGetConstMacro( CacheBasisFunctionWeights, bool );
+
 protected:
 
   /** Constructor */
@@ -267,6 +279,7 @@ protected:
 private:
   bool                                         m_EstimateInverse{ false };
   bool                                         m_EnforceStationaryBoundary{ true };
+  bool                                         m_CacheBasisFunctionWeights{ false };
   unsigned int                                 m_SplineOrder{ 3 };
   ArrayType                                    m_NumberOfControlPoints;
   ArrayType                                    m_NumberOfFittingLevels;
@@ -281,6 +294,10 @@ private:
 
   bool                                         m_BSplineDomainIsDefined{ true };
   bool                                         m_UseInputFieldToDefineTheBSplineDomain{ false };
+
+  // The internal fitter persists across runs of this filter so that its
+  // cached basis function weights remain available.
+  typename BSplineFilterType::Pointer          m_BSplineFitter;
 };
 
 } // end namespace itk
@@ -42,6 +42,8 @@ DisplacementFieldToBSplineImageFilter<TInputImage, TInputPointSet, TOutputImage>
 
   this->m_PointWeights = nullptr;
 
+  this->m_BSplineFitter = BSplineFilterType::New();
+
   this->m_BSplineDomainOrigin.Fill( 0.0 );
   this->m_BSplineDomainSpacing.Fill( 1.0 );
   this->m_BSplineDomainSize.Fill( 0 );
@@ -365,7 +367,8 @@ DisplacementFieldToBSplineImageFilter<TInputImage, TInputPointSet, TOutputImage>
   ArrayType close;
   close.Fill( false );
 
-  typename BSplineFilterType::Pointer bspliner = BSplineFilterType::New();
+  typename BSplineFilterType::Pointer bspliner = this->m_BSplineFitter;
+  bspliner->SetCacheBasisFunctionWeights( this->m_CacheBasisFunctionWeights );
   bspliner->SetOrigin( this->m_BSplineDomainOrigin );
   bspliner->SetSpacing( this->m_BSplineDomainSpacing );
   bspliner->SetSize( this->m_BSplineDomainSize );
@@ -379,8 +382,16 @@ DisplacementFieldToBSplineImageFilter<TInputImage, TInputPointSet, TOutputImage>
   bspliner->SetGenerateOutputImage( true );
   bspliner->Update();
 
-  this->SetNthOutput( 0, bspliner->GetOutput() );
-  this->SetNthOutput( 1, bspliner->GetPhiLattice() );
+  // The fitter is retained between runs so its outputs are disconnected
+  // before being handed off, leaving the fitter with fresh outputs for
+  // the next run.
+  typename OutputFieldType::Pointer smoothField = bspliner->GetOutput();
+  smoothField->DisconnectPipeline();
+
+  typename BSplineFilterType::PointDataImagePointer phiLattice = bspliner->GetPhiLattice();
+
+  this->SetNthOutput( 0, smoothField );
+  this->SetNthOutput( 1, phiLattice );
 }
 
 template<typename TInputImage, typename TInputPointSet, typename TOutputImage>
@@ -408,6 +419,15 @@ DisplacementFieldToBSplineImageFilter<TInputImage, TInputPointSet, TOutputImage>
     {
     os << "false" << std::endl;
     }
+  os << indent << "Cache basis function weights: ";
+  if( this->m_CacheBasisFunctionWeights )
+    {
+    os << "true" << std::endl;
+    }
+  else
+    {
+    os << "false" << std::endl;
+    }
   os << indent << "Spline order: " << this->m_SplineOrder << std::endl;
   os << indent << "Number of fitting levels: "
      << this->m_NumberOfFittingLevels << std::endl;
@@ -211,6 +211,12 @@ public:
    * be returned with zero displacemnt. */
   OutputPointType TransformPoint( const InputPointType& thisPoint ) const override;
 
+  /** Transform a batch of points. The displacement field and the
+   * interpolator are validated once for the whole batch instead of
+   * once per point. */
+  void TransformPoints(const std::vector< InputPointType > & inputPoints,
+                       std::vector< OutputPointType > & outputPoints) const override;
+
   /**  Method to transform a vector. */
   using Superclass::TransformVector;
   OutputVectorType TransformVector(const InputVectorType &) const override
@@ -385,11 +391,13 @@ public:
   void UpdateTransformParameters( const DerivativeType & update, ScalarType factor = 1.0 ) override;
 
   /** Return an inverse of this transform.
-   * Note that the inverse displacement field must be set by the user. */
+   * Note that the inverse displacement field must be set by the user
+   * unless on-demand inversion is enabled with ComputeInverseOnDemandOn(). */
   bool GetInverse( Self *inverse ) const;
 
   /** Return an inverse of this transform.
-   * Note that the inverse displacement field must be set by the user. */
+   * Note that the inverse displacement field must be set by the user
+   * unless on-demand inversion is enabled with ComputeInverseOnDemandOn(). */
   InverseTransformBasePointer GetInverseTransform() const override;
 
   virtual void SetIdentity();
@@ -425,6 +433,35 @@ public:
   itkSetMacro(DirectionTolerance, double);
   itkGetConstMacro(DirectionTolerance, double);
 
+  /** Set/Get the flag for on-demand inversion of the displacement field.
+   * When enabled, GetInverse() and GetInverseTransform() no longer require
+   * the inverse displacement field to be supplied by the user: if none is
+   * present, or if the forward field has been modified since the inverse
+   * was last obtained, the inverse is computed with the fixed-point
+   * iteration of InvertDisplacementFieldImageFilter and cached on the
+   * transform. When the field geometry is unchanged, the previous inverse
+   * seeds the next inversion so that small updates of the forward field
+   * refine the cached inverse instead of restarting from zero.
+   * Off by default. */
+  itkSetMacro( ComputeInverseOnDemand, bool );
+  itkGetConstMacro( ComputeInverseOnDemand, bool );
+  itkBooleanMacro( ComputeInverseOnDemand );
+
+  /** Set/Get the maximum number of fixed-point iterations used by
+   * on-demand inversion. */
+  itkSetMacro( InverseMaximumNumberOfIterations, unsigned int );
+  itkGetConstMacro( InverseMaximumNumberOfIterations, unsigned int );
+
+  /** Set/Get the mean error tolerance (in voxel units) at which the
+   * on-demand fixed-point iteration stops early. */
+  itkSetMacro( InverseMeanErrorToleranceThreshold, double );
+  itkGetConstMacro( InverseMeanErrorToleranceThreshold, double );
+
+  /** Set/Get the max error tolerance (in voxel units) at which the
+   * on-demand fixed-point iteration stops early. */
+  itkSetMacro( InverseMaxErrorToleranceThreshold, double );
+  itkGetConstMacro( InverseMaxErrorToleranceThreshold, double );
+
 protected:
 
   DisplacementFieldTransform();
@@ -472,9 +509,27 @@ private:
    */
   virtual void SetFixedParametersFromDisplacementField() const;
 
+  /** Compute, or refine, the cached inverse displacement field for the
+   * on-demand inversion mode. Does nothing when the cached inverse is
+   * up to date with the forward field. */
+  void ComputeInverseDisplacementFieldOnDemand() const;
+
   double m_CoordinateTolerance;
   double m_DirectionTolerance;
 
+  bool         m_ComputeInverseOnDemand{ false };
+  unsigned int m_InverseMaximumNumberOfIterations{ 20 };
+  double       m_InverseMeanErrorToleranceThreshold{ 0.001 };
+  double       m_InverseMaxErrorToleranceThreshold{ 0.1 };
+
+  /** Inverse field last produced (or adopted) by the on-demand mode,
+   * together with the modification time of the forward field it inverts.
+   * This is kept separately from m_InverseDisplacementField, which is
+   * reset whenever a new forward field is assigned, so that the previous
+   * inverse can seed the next inversion. */
+  mutable typename DisplacementFieldType::Pointer m_OnDemandInverseDisplacementField;
+  mutable ModifiedTimeType                        m_OnDemandInverseFieldTime{ 0 };
+
 };
 
 } // end namespace itk
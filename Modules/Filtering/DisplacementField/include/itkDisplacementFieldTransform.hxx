@@ -21,6 +21,7 @@
 #include "itkDisplacementFieldTransform.h"
 #include "itkVectorLinearInterpolateImageFunction.h"
 #include "itkImageToImageFilter.h"
+#include "itkInvertDisplacementFieldImageFilter.h"
 
 #include "itkImageRegionIteratorWithIndex.h"
 #include "vnl/algo/vnl_symmetric_eigensystem.h"
@@ -103,11 +104,119 @@ DisplacementFieldTransform<TParametersValueType, NDimensions>
   return outputPoint;
 }
 
+template<typename TParametersValueType, unsigned int NDimensions>
+void DisplacementFieldTransform<TParametersValueType, NDimensions>
+::TransformPoints( const std::vector< InputPointType > & inputPoints,
+                   std::vector< OutputPointType > & outputPoints ) const
+{
+  if( !this->m_DisplacementField )
+    {
+    itkExceptionMacro( "No displacement field is specified." );
+    }
+  if( !this->m_Interpolator )
+    {
+    itkExceptionMacro( "No interpolator is specified." );
+    }
+
+  const SizeValueType numberOfPoints = inputPoints.size();
+
+  typename InterpolatorType::ContinuousIndexType cidx;
+  typename InterpolatorType::PointType point;
+
+  outputPoints.resize(numberOfPoints);
+  for( SizeValueType n = 0; n < numberOfPoints; ++n )
+    {
+    point.CastFrom( inputPoints[n] );
+
+    OutputPointType outputPoint;
+    outputPoint.CastFrom( inputPoints[n] );
+
+    if( this->m_Interpolator->IsInsideBuffer( point ) )
+      {
+      this->m_DisplacementField->TransformPhysicalPointToContinuousIndex( point, cidx );
+      typename InterpolatorType::OutputType displacement = this->m_Interpolator->EvaluateAtContinuousIndex( cidx );
+      for( unsigned int ii = 0; ii < NDimensions; ++ii )
+        {
+        outputPoint[ii] += displacement[ii];
+        }
+      }
+    // else keep the input point with zero displacement
+
+    outputPoints[n] = outputPoint;
+    }
+}
+
+template<typename TParametersValueType, unsigned int NDimensions>
+void DisplacementFieldTransform<TParametersValueType, NDimensions>
+::ComputeInverseDisplacementFieldOnDemand() const
+{
+  if( this->m_DisplacementField.IsNull() )
+    {
+    return;
+    }
+  const ModifiedTimeType fieldTime = this->m_DisplacementField->GetMTime();
+
+  if( this->m_InverseDisplacementField.IsNotNull() &&
+      this->m_InverseDisplacementField != this->m_OnDemandInverseDisplacementField )
+    {
+    /* A user-supplied inverse takes precedence. Adopt it as the current
+     * cache; once the forward field changes it becomes the initial
+     * estimate for the next inversion. */
+    this->m_OnDemandInverseDisplacementField = this->m_InverseDisplacementField;
+    this->m_OnDemandInverseFieldTime = fieldTime;
+    return;
+    }
+
+  if( this->m_InverseDisplacementField.IsNotNull() &&
+      this->m_OnDemandInverseFieldTime == fieldTime )
+    {
+    /* The cached inverse is up to date. */
+    return;
+    }
+
+  using InverterType = InvertDisplacementFieldImageFilter<DisplacementFieldType>;
+  typename InverterType::Pointer inverter = InverterType::New();
+  inverter->SetInput( this->m_DisplacementField );
+  inverter->SetMaximumNumberOfIterations( this->m_InverseMaximumNumberOfIterations );
+  inverter->SetMeanErrorToleranceThreshold( this->m_InverseMeanErrorToleranceThreshold );
+  inverter->SetMaxErrorToleranceThreshold( this->m_InverseMaxErrorToleranceThreshold );
+
+  if( this->m_OnDemandInverseDisplacementField.IsNotNull() &&
+      this->m_OnDemandInverseDisplacementField->GetLargestPossibleRegion() ==
+        this->m_DisplacementField->GetLargestPossibleRegion() &&
+      this->m_OnDemandInverseDisplacementField->GetOrigin() == this->m_DisplacementField->GetOrigin() &&
+      this->m_OnDemandInverseDisplacementField->GetSpacing() == this->m_DisplacementField->GetSpacing() &&
+      this->m_OnDemandInverseDisplacementField->GetDirection() == this->m_DisplacementField->GetDirection() )
+    {
+    /* Warm-start the fixed-point iteration from the previous inverse so
+     * that a small update of the forward field only needs a few refining
+     * iterations. */
+    inverter->SetInverseFieldInitialEstimate( this->m_OnDemandInverseDisplacementField );
+    }
+  inverter->Update();
+
+  DisplacementFieldPointer inverseField = inverter->GetOutput();
+  inverseField->DisconnectPipeline();
+
+  auto * nonConstThis = const_cast< Self * >( this );
+  nonConstThis->SetInverseDisplacementField( inverseField );
+  this->m_OnDemandInverseDisplacementField = inverseField;
+  this->m_OnDemandInverseFieldTime = fieldTime;
+}
+
 template<typename TParametersValueType, unsigned int NDimensions>
 bool DisplacementFieldTransform<TParametersValueType, NDimensions>
 ::GetInverse( Self *inverse ) const
 {
-  if( !inverse || !this->m_InverseDisplacementField )
+  if( !inverse )
+    {
+    return false;
+    }
+  if( this->m_ComputeInverseOnDemand )
+    {
+    this->ComputeInverseDisplacementFieldOnDemand();
+    }
+  if( !this->m_InverseDisplacementField )
     {
     return false;
     }
@@ -652,6 +761,15 @@ DisplacementFieldTransform<TParametersValueType, NDimensions>
 
   os << indent << " CoordinateTolerance: " << m_CoordinateTolerance << std::endl;
   os << indent << " DirectionTolerance: " << m_DirectionTolerance << std::endl;
+
+  os << indent << "ComputeInverseOnDemand: "
+    << ( m_ComputeInverseOnDemand ? "On" : "Off" ) << std::endl;
+  os << indent << "InverseMaximumNumberOfIterations: "
+    << m_InverseMaximumNumberOfIterations << std::endl;
+  os << indent << "InverseMeanErrorToleranceThreshold: "
+    << m_InverseMeanErrorToleranceThreshold << std::endl;
+  os << indent << "InverseMaxErrorToleranceThreshold: "
+    << m_InverseMaxErrorToleranceThreshold << std::endl;
 }
 } // namespace itk
 
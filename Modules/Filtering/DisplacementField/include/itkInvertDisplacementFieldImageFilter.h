@@ -136,6 +136,16 @@ public:
   itkSetMacro( EnforceBoundaryCondition, bool );
   itkGetMacro( EnforceBoundaryCondition, bool );
 
+  /** Set/Get whether voxels whose scaled residual norm has dropped below
+   * MaxErrorToleranceThreshold are frozen and skipped in subsequent
+   * iterations.  When the iteration is seeded with a good initial estimate
+   * (see SetInverseFieldInitialEstimate) most of the domain converges within
+   * a few sweeps and only the remaining voxels keep being refined.  Frozen
+   * voxels retain their last residual in the error norms.  Default is false. */
+  itkSetMacro( UseConvergenceMasking, bool );
+  itkGetConstMacro( UseConvergenceMasking, bool );
+  itkBooleanMacro( UseConvergenceMasking );
+
 protected:
 
   /** Constructor */
@@ -164,8 +174,11 @@ private:
 
   // internal ivars necessary for multithreading basic operations
 
-  typename DisplacementFieldType::Pointer m_ComposedField;
-  typename RealImageType::Pointer         m_ScaledNormImage;
+  using ConvergenceMaskImageType = Image<unsigned char, ImageDimension>;
+
+  typename DisplacementFieldType::Pointer      m_ComposedField;
+  typename RealImageType::Pointer              m_ScaledNormImage;
+  typename ConvergenceMaskImageType::Pointer   m_ConvergenceMaskImage;
 
   RealType    m_MaxErrorNorm;
   RealType    m_MeanErrorNorm;
@@ -173,6 +186,7 @@ private:
   SpacingType m_DisplacementFieldSpacing;
   bool        m_DoThreadedEstimateInverse{false};
   bool        m_EnforceBoundaryCondition{true};
+  bool        m_UseConvergenceMasking{false};
   std::mutex  m_Mutex;
 
 };
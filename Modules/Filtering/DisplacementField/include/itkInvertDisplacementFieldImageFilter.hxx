@@ -42,6 +42,7 @@ InvertDisplacementFieldImageFilter<TInputImage, TOutputImage>
 
   m_ComposedField(DisplacementFieldType::New()),
   m_ScaledNormImage(RealImageType::New()),
+  m_ConvergenceMaskImage(ConvergenceMaskImageType::New()),
   m_MaxErrorNorm(0.0),
   m_MeanErrorNorm(0.0),
   m_Epsilon(0.0)
@@ -112,6 +113,13 @@ InvertDisplacementFieldImageFilter<TInputImage, TOutputImage>
   this->m_ScaledNormImage->SetRegions( displacementField->GetRequestedRegion() );
   this->m_ScaledNormImage->Allocate(true); // initialize buffer to zero
 
+  if( this->m_UseConvergenceMasking )
+    {
+    this->m_ConvergenceMaskImage->CopyInformation( displacementField );
+    this->m_ConvergenceMaskImage->SetRegions( displacementField->GetRequestedRegion() );
+    this->m_ConvergenceMaskImage->Allocate(true); // initialize buffer to zero
+    }
+
   SizeValueType numberOfPixelsInRegion = ( displacementField->GetRequestedRegion() ).GetNumberOfPixels();
   this->m_MaxErrorNorm = NumericTraits<RealType>::max();
   this->m_MeanErrorNorm = NumericTraits<RealType>::max();
@@ -186,12 +194,29 @@ InvertDisplacementFieldImageFilter<TInputImage, TOutputImage>
   ImageRegionIterator<DisplacementFieldType> ItE( this->m_ComposedField, region );
   ImageRegionIterator<RealImageType> ItS( this->m_ScaledNormImage, region );
 
+  const bool useMask = this->m_UseConvergenceMasking;
+  ImageRegionIterator<ConvergenceMaskImageType> ItM;
+  if( useMask )
+    {
+    ItM = ImageRegionIterator<ConvergenceMaskImageType>( this->m_ConvergenceMaskImage, region );
+    ItM.GoToBegin();
+    }
+
   if( this->m_DoThreadedEstimateInverse )
     {
     ImageRegionIterator<DisplacementFieldType> ItI( this->GetOutput(), region );
 
     for( ItI.GoToBegin(), ItE.GoToBegin(), ItS.GoToBegin(); !ItI.IsAtEnd(); ++ItI, ++ItE, ++ItS )
       {
+      if( useMask )
+        {
+        const bool converged = ( ItM.Get() != 0 );
+        ++ItM;
+        if( converged )
+          {
+          continue;
+          }
+        }
       VectorType update = ItE.Get();
       RealType scaledNorm = ItS.Get();
 
@@ -226,6 +251,19 @@ InvertDisplacementFieldImageFilter<TInputImage, TOutputImage>
       }
     for( ItE.GoToBegin(), ItS.GoToBegin(); !ItE.IsAtEnd(); ++ItE, ++ItS )
       {
+      if( useMask && ItM.Get() != 0 )
+        {
+        // This voxel converged in an earlier iteration and is frozen.  Its
+        // last residual still participates in the error norms.
+        const RealType storedNorm = ItS.Get();
+        localMean += storedNorm;
+        if( localMax < storedNorm )
+          {
+          localMax = storedNorm;
+          }
+        ++ItM;
+        continue;
+        }
       const VectorType & displacement = ItE.Get();
       RealType scaledNorm = 0.0;
       for( unsigned int d = 0; d < ImageDimension; ++d )
@@ -242,6 +280,14 @@ InvertDisplacementFieldImageFilter<TInputImage, TOutputImage>
 
       ItS.Set( scaledNorm );
       ItE.Set( -displacement );
+      if( useMask )
+        {
+        if( scaledNorm <= this->m_MaxErrorToleranceThreshold )
+          {
+          ItM.Set( 1 );
+          }
+        ++ItM;
+        }
       }
       {
       std::lock_guard<std::mutex> holder(m_Mutex);
@@ -266,6 +312,7 @@ InvertDisplacementFieldImageFilter<TInputImage, TOutputImage>
   os << "Maximum number of iterations: " << this->m_MaximumNumberOfIterations << std::endl;
   os << "Max error tolerance threshold: " << this->m_MaxErrorToleranceThreshold << std::endl;
   os << "Mean error tolerance threshold: " << this->m_MeanErrorToleranceThreshold << std::endl;
+  os << "Use convergence masking: " << this->m_UseConvergenceMasking << std::endl;
 }
 
 }  //end namespace itk
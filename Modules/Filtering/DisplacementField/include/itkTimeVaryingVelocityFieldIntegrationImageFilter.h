@@ -154,6 +154,13 @@ protected:
 
   void GenerateOutputInformation() override;
 
+  /** Restrict the requested region of the time-varying velocity field
+   * to the time slices spanned by the integration interval. Upstream
+   * sources that honor requested regions then only need to buffer the
+   * relevant time slab, so large sequences can be integrated slab by
+   * slab instead of keeping the entire field resident. */
+  void GenerateInputRequestedRegion() override;
+
   void BeforeThreadedGenerateData() override;
 
   void DynamicThreadedGenerateData( const OutputRegionType & ) override;
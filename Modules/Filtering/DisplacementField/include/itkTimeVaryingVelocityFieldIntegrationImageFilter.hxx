@@ -23,6 +23,8 @@
 #include "itkImageRegionIteratorWithIndex.h"
 #include "itkVectorLinearInterpolateImageFunction.h"
 
+#include <algorithm>
+
 namespace itk
 {
 
@@ -128,6 +130,78 @@ TimeVaryingVelocityFieldIntegrationImageFilter
   output->SetRegions( size );
 }
 
+template<typename TTimeVaryingVelocityField, typename TDisplacementField>
+void
+TimeVaryingVelocityFieldIntegrationImageFilter
+  <TTimeVaryingVelocityField, TDisplacementField>
+::GenerateInputRequestedRegion()
+{
+  Superclass::GenerateInputRequestedRegion();
+
+  auto * input = const_cast<TimeVaryingVelocityFieldType *>( this->GetInput() );
+  if( !input )
+    {
+    return;
+    }
+
+  using InputRegionType = typename TimeVaryingVelocityFieldType::RegionType;
+
+  const InputRegionType largestRegion = input->GetLargestPossibleRegion();
+
+  // The integration trajectories can wander over the whole spatial
+  // domain, so only the time extent can be restricted.
+  InputRegionType requestedRegion = largestRegion;
+
+  const SizeValueType numberOfTimePoints =
+    largestRegion.GetSize()[InputImageDimension - 1];
+
+  if( numberOfTimePoints > 1 && this->m_NumberOfIntegrationSteps > 0 &&
+      Math::NotExactlyEquals( this->m_LowerTimeBound, this->m_UpperTimeBound ) )
+    {
+    // Mirror the time mapping of IntegrateVelocityAtPoint() to find the
+    // interval of time points touched by the Runge-Kutta samples.
+    typename InputRegionType::IndexType lastIndex = largestRegion.GetIndex();
+    typename InputRegionType::SizeType largestSize = largestRegion.GetSize();
+    for( unsigned int d = 0; d < InputImageDimension; d++ )
+      {
+      lastIndex[d] += ( largestSize[d] - 1 );
+      }
+    typename TimeVaryingVelocityFieldType::PointType spaceTimeEnd;
+    input->TransformIndexToPhysicalPoint( lastIndex, spaceTimeEnd );
+
+    const RealType timeOrigin = input->GetOrigin()[InputImageDimension - 1];
+    const RealType timeSpan = spaceTimeEnd[InputImageDimension - 1] - timeOrigin;
+
+    const RealType deltaTime =
+      itk::Math::abs( this->m_UpperTimeBound - this->m_LowerTimeBound ) /
+      static_cast<RealType>( this->m_NumberOfIntegrationSteps );
+
+    const RealType intervalStart =
+      ( timeOrigin + this->m_LowerTimeBound * timeSpan + 1.0 ) /
+      static_cast<RealType>( numberOfTimePoints );
+    const RealType intervalEnd =
+      intervalStart + ( this->m_UpperTimeBound - this->m_LowerTimeBound );
+
+    RealType intervalLow = std::min( intervalStart, intervalEnd ) - deltaTime;
+    RealType intervalHigh = std::max( intervalStart, intervalEnd ) + deltaTime;
+    intervalLow = std::max( intervalLow, NumericTraits<RealType>::ZeroValue() );
+    intervalHigh = std::min( intervalHigh, NumericTraits<RealType>::OneValue() );
+
+    // Expand to the support of the linear interpolation of the samples.
+    const auto firstSlice = static_cast<IndexValueType>(
+      std::floor( intervalLow * static_cast<RealType>( numberOfTimePoints - 1 ) ) );
+    const auto lastSlice = static_cast<IndexValueType>(
+      std::floor( intervalHigh * static_cast<RealType>( numberOfTimePoints - 1 ) ) ) + 1;
+
+    requestedRegion.SetIndex( InputImageDimension - 1, firstSlice );
+    requestedRegion.SetSize( InputImageDimension - 1,
+      static_cast<SizeValueType>( lastSlice - firstSlice + 1 ) );
+    requestedRegion.Crop( largestRegion );
+    }
+
+  input->SetRequestedRegion( requestedRegion );
+}
+
 template<typename TTimeVaryingVelocityField, typename TDisplacementField>
 void
 TimeVaryingVelocityFieldIntegrationImageFilter
@@ -191,27 +191,55 @@ TransformToDisplacementFieldFilter< TOutputImage, TParametersValueType>
   using OutputIteratorType = ImageScanlineIterator< TOutputImage >;
   OutputIteratorType outIt( output, outputRegionForThread );
 
-  // Define a few variables that will be used to translate from an input pixel
-  // to an output pixel
-  PointType outputPoint;         // Coordinates of output pixel
-  PointType transformedPoint;    // Coordinates of transformed pixel
-  PixelType displacement;         // the difference
-
-  // Walk the output region
+  const SizeValueType lineLength = outputRegionForThread.GetSize(0);
+
+  // The physical step between adjacent voxels along the scanline is
+  // constant, so the points of a line are generated from the line start
+  // instead of calling TransformIndexToPhysicalPoint per voxel.
+  PointType startPoint;
+  PointType nextPoint;
+  IndexType stepIndex = outputRegionForThread.GetIndex();
+  output->TransformIndexToPhysicalPoint( stepIndex, startPoint );
+  stepIndex[0] += 1;
+  output->TransformIndexToPhysicalPoint( stepIndex, nextPoint );
+  const typename PointType::VectorType physicalStep = nextPoint - startPoint;
+
+  std::vector< typename TransformType::InputPointType >  inputPoints( lineLength );
+  std::vector< typename TransformType::OutputPointType > transformedPoints;
+
+  // Walk the output region one scanline at a time.  Each line is mapped
+  // with a single TransformPoints() call so the virtual dispatch -- and,
+  // for composite transforms, the walk over the transform queue -- is
+  // amortized over the whole line.
   outIt.GoToBegin();
   while ( !outIt.IsAtEnd() )
     {
-    while ( !outIt.IsAtEndOfLine() )
+    PointType lineStart;
+    output->TransformIndexToPhysicalPoint( outIt.GetIndex(), lineStart );
+
+    for ( SizeValueType i = 0; i < lineLength; ++i )
       {
-      // Determine the index of the current output pixel
-      output->TransformIndexToPhysicalPoint( outIt.GetIndex(), outputPoint );
+      for ( unsigned int d = 0; d < ImageDimension; ++d )
+        {
+        inputPoints[i][d] = static_cast< TParametersValueType >(
+          lineStart[d] + static_cast< double >( i ) * physicalStep[d] );
+        }
+      }
 
-      // Compute corresponding input pixel position
-      transformedPoint = transform->TransformPoint( outputPoint );
+    transform->TransformPoints( inputPoints, transformedPoints );
 
-      displacement = transformedPoint - outputPoint;
+    SizeValueType i = 0;
+    while ( !outIt.IsAtEndOfLine() )
+      {
+      PixelType displacement;
+      for ( unsigned int d = 0; d < ImageDimension; ++d )
+        {
+        displacement[d] = static_cast< PixelValueType >(
+          transformedPoints[i][d] - inputPoints[i][d] );
+        }
       outIt.Set( displacement );
       ++outIt;
+      ++i;
       }
     outIt.NextLine();
     }
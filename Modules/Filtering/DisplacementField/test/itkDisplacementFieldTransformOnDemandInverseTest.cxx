@@ -0,0 +1,119 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkDisplacementFieldTransform.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkMath.h"
+
+/* Test the on-demand inversion of DisplacementFieldTransform.
+ * With ComputeInverseOnDemand enabled, GetInverseTransform() must
+ * succeed without a user-supplied inverse field, the composition of
+ * forward and inverse must approximate the identity, and repeated
+ * requests must return the cached inverse until the forward field
+ * is modified. */
+
+int itkDisplacementFieldTransformOnDemandInverseTest(int, char ** const)
+{
+  constexpr unsigned int Dimension = 2;
+  using TransformType = itk::DisplacementFieldTransform<double, Dimension>;
+  using FieldType = TransformType::DisplacementFieldType;
+  using VectorType = FieldType::PixelType;
+
+  FieldType::SizeType size;
+  size.Fill( 32 );
+  FieldType::RegionType region;
+  region.SetSize( size );
+
+  FieldType::Pointer field = FieldType::New();
+  field->SetRegions( region );
+  field->Allocate();
+
+  /* A smooth, small displacement so the fixed-point inversion converges. */
+  itk::ImageRegionIteratorWithIndex<FieldType> it( field, region );
+  for( it.GoToBegin(); !it.IsAtEnd(); ++it )
+    {
+    VectorType displacement;
+    const double x = static_cast<double>( it.GetIndex()[0] ) / size[0];
+    const double y = static_cast<double>( it.GetIndex()[1] ) / size[1];
+    displacement[0] = 0.5 * std::sin( itk::Math::pi * x );
+    displacement[1] = 0.5 * std::sin( itk::Math::pi * y );
+    it.Set( displacement );
+    }
+
+  TransformType::Pointer transform = TransformType::New();
+  transform->SetDisplacementField( field );
+
+  /* Without the flag, no inverse is available. */
+  if( transform->GetInverseTransform().IsNotNull() )
+    {
+    std::cerr << "Expected no inverse without an inverse field." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  transform->ComputeInverseOnDemandOn();
+
+  TransformType::InverseTransformBasePointer inverseTransform = transform->GetInverseTransform();
+  if( inverseTransform.IsNull() )
+    {
+    std::cerr << "Expected an on-demand inverse transform." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  /* The composition of forward and inverse must approximate identity
+   * away from the field boundary. */
+  constexpr double tolerance = 0.05;
+  for( double px = 8.0; px < 24.0; px += 2.7 )
+    {
+    TransformType::InputPointType point;
+    point[0] = px;
+    point[1] = 30.7 - px;
+
+    TransformType::OutputPointType forwardPoint = transform->TransformPoint( point );
+    TransformType::OutputPointType roundTripPoint = inverseTransform->TransformPoint( forwardPoint );
+
+    for( unsigned int d = 0; d < Dimension; d++ )
+      {
+      if( itk::Math::abs( roundTripPoint[d] - point[d] ) > tolerance )
+        {
+        std::cerr << "Round trip of " << point << " gave " << roundTripPoint
+                  << ", expected agreement within " << tolerance << std::endl;
+        return EXIT_FAILURE;
+        }
+      }
+    }
+
+  /* A second request without modifying the field must reuse the cache. */
+  FieldType::Pointer inverseField = transform->GetModifiableInverseDisplacementField();
+  transform->GetInverseTransform();
+  if( transform->GetModifiableInverseDisplacementField() != inverseField.GetPointer() )
+    {
+    std::cerr << "Expected the cached inverse field to be reused." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  /* Modifying the forward field must trigger a new inversion. */
+  field->Modified();
+  transform->GetInverseTransform();
+  if( transform->GetModifiableInverseDisplacementField() == inverseField.GetPointer() )
+    {
+    std::cerr << "Expected a recomputed inverse field after modification." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  std::cout << "Test passed." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,128 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkTimeVaryingVelocityFieldIntegrationImageFilter.h"
+#include "itkCastImageFilter.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkMath.h"
+
+/* Verify that the integration filter only requests the time slices
+ * spanned by its integration interval. A pass-through filter upstream
+ * stands in for a streaming source: after integrating a sub-interval
+ * its buffered region must cover a proper subset of the time points,
+ * and the resulting displacement field must match an integration over
+ * the fully buffered velocity field. */
+
+int itkTimeVaryingVelocityFieldIntegrationSlabTest( int, char * [] )
+{
+  using VectorType = itk::Vector<double, 2>;
+  using TimeVaryingVelocityFieldType = itk::Image<VectorType, 3>;
+  using DisplacementFieldType = itk::Image<VectorType, 2>;
+
+  constexpr unsigned int numberOfTimePoints = 11;
+
+  TimeVaryingVelocityFieldType::SizeType size;
+  size[0] = 8;
+  size[1] = 8;
+  size[2] = numberOfTimePoints;
+  TimeVaryingVelocityFieldType::RegionType region;
+  region.SetSize( size );
+
+  TimeVaryingVelocityFieldType::Pointer velocityField = TimeVaryingVelocityFieldType::New();
+  velocityField->SetRegions( region );
+  velocityField->Allocate();
+
+  /* A time-varying velocity so that different time slabs integrate to
+   * different displacements. */
+  itk::ImageRegionIteratorWithIndex<TimeVaryingVelocityFieldType> It( velocityField, region );
+  for( It.GoToBegin(); !It.IsAtEnd(); ++It )
+    {
+    VectorType velocity;
+    const double time = static_cast<double>( It.GetIndex()[2] ) /
+      static_cast<double>( numberOfTimePoints - 1 );
+    velocity[0] = 0.1 * ( 1.0 + time );
+    velocity[1] = 0.05 * time;
+    It.Set( velocity );
+    }
+
+  using IntegratorType = itk::TimeVaryingVelocityFieldIntegrationImageFilter
+    <TimeVaryingVelocityFieldType, DisplacementFieldType>;
+
+  /* Reference: integrate over a sub-interval with the field fully buffered. */
+  IntegratorType::Pointer integrator = IntegratorType::New();
+  integrator->SetInput( velocityField );
+  integrator->SetLowerTimeBound( 0.6 );
+  integrator->SetUpperTimeBound( 1.0 );
+  integrator->SetNumberOfIntegrationSteps( 10 );
+  integrator->Update();
+
+  /* Streamed: the cast filter only generates what is requested of it. */
+  using CasterType = itk::CastImageFilter<TimeVaryingVelocityFieldType, TimeVaryingVelocityFieldType>;
+  CasterType::Pointer caster = CasterType::New();
+  caster->SetInput( velocityField );
+
+  IntegratorType::Pointer streamedIntegrator = IntegratorType::New();
+  streamedIntegrator->SetInput( caster->GetOutput() );
+  streamedIntegrator->SetLowerTimeBound( 0.6 );
+  streamedIntegrator->SetUpperTimeBound( 1.0 );
+  streamedIntegrator->SetNumberOfIntegrationSteps( 10 );
+  streamedIntegrator->Update();
+
+  const TimeVaryingVelocityFieldType::RegionType bufferedRegion =
+    caster->GetOutput()->GetBufferedRegion();
+  std::cout << "Buffered upstream region: " << bufferedRegion;
+
+  if( bufferedRegion.GetSize()[2] >= numberOfTimePoints )
+    {
+    std::cerr << "Expected a restricted time extent upstream, got "
+              << bufferedRegion.GetSize()[2] << " time points." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  itk::ImageRegionIteratorWithIndex<DisplacementFieldType> refIter(
+    integrator->GetOutput(), integrator->GetOutput()->GetBufferedRegion() );
+  itk::ImageRegionIteratorWithIndex<DisplacementFieldType> streamedIter(
+    streamedIntegrator->GetOutput(), integrator->GetOutput()->GetBufferedRegion() );
+
+  for( refIter.GoToBegin(); !refIter.IsAtEnd(); ++refIter, ++streamedIter )
+    {
+    for( unsigned int d = 0; d < 2; d++ )
+      {
+      if( itk::Math::NotExactlyEquals( refIter.Get()[d], streamedIter.Get()[d] ) )
+        {
+        std::cerr << "Displacements differ at " << refIter.GetIndex() << ": "
+                  << refIter.Get() << " vs " << streamedIter.Get() << std::endl;
+        return EXIT_FAILURE;
+        }
+      }
+    }
+
+  /* The displacement must be non-trivial for the comparison to mean
+   * anything. */
+  DisplacementFieldType::IndexType centerIndex;
+  centerIndex.Fill( 4 );
+  if( itk::Math::FloatAlmostEqual(
+        integrator->GetOutput()->GetPixel( centerIndex )[0], 0.0 ) )
+    {
+    std::cerr << "Expected a non-zero displacement." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  std::cout << "Test passed." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,606 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkMaurerVoronoiDistanceMapImageFilter_hxx
+#define itkMaurerVoronoiDistanceMapImageFilter_hxx
+
+#include "itkMaurerVoronoiDistanceMapImageFilter.h"
+#include "itkImageLinearIteratorWithIndex.h"
+#include "itkImageRegionConstIteratorWithIndex.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkMultiThreaderBase.h"
+#include "itkProgressReporter.h"
+
+#include <vector>
+
+namespace itk
+{
+/**
+ *    Constructor
+ */
+template< typename TInputImage, typename TOutputImage, typename TVoronoiImage >
+MaurerVoronoiDistanceMapImageFilter< TInputImage, TOutputImage, TVoronoiImage >
+::MaurerVoronoiDistanceMapImageFilter()
+{
+  this->SetNumberOfRequiredOutputs(3);
+
+  // distance map
+  this->SetNthOutput( 0, this->MakeOutput( 0 ) );
+
+  // voronoi map
+  this->SetNthOutput( 1, this->MakeOutput( 1 ) );
+
+  // distance vectors
+  this->SetNthOutput( 2, this->MakeOutput( 2 ) );
+
+  m_SquaredDistance     = false;
+  m_InputIsBinary       = false;
+  m_UseImageSpacing     = true;
+
+  this->DynamicMultiThreadingOff();
+}
+
+template< typename TInputImage, typename TOutputImage, typename TVoronoiImage >
+typename MaurerVoronoiDistanceMapImageFilter<
+  TInputImage, TOutputImage, TVoronoiImage >::DataObjectPointer
+MaurerVoronoiDistanceMapImageFilter< TInputImage, TOutputImage, TVoronoiImage >
+::MakeOutput(DataObjectPointerArraySizeType idx)
+{
+  if( idx == 1 )
+    {
+    return VoronoiImageType::New().GetPointer();
+    }
+  else
+    {
+    if( idx == 2 )
+      {
+      return VectorImageType::New().GetPointer();
+      }
+    }
+  return Superclass::MakeOutput( idx );
+}
+
+/**
+ *  Return the distance map Image pointer
+ */
+template< typename TInputImage, typename TOutputImage, typename TVoronoiImage >
+typename
+MaurerVoronoiDistanceMapImageFilter< TInputImage, TOutputImage, TVoronoiImage >::OutputImageType *
+MaurerVoronoiDistanceMapImageFilter< TInputImage, TOutputImage, TVoronoiImage >
+::GetDistanceMap()
+{
+  return dynamic_cast< OutputImageType * >(
+           this->ProcessObject::GetOutput(0) );
+}
+
+/**
+ *  Return Closest Points Map
+ */
+template< typename TInputImage, typename TOutputImage, typename TVoronoiImage >
+typename
+MaurerVoronoiDistanceMapImageFilter< TInputImage, TOutputImage, TVoronoiImage >::VoronoiImageType *
+MaurerVoronoiDistanceMapImageFilter< TInputImage, TOutputImage, TVoronoiImage >
+::GetVoronoiMap()
+{
+  return dynamic_cast< VoronoiImageType* >(
+           this->ProcessObject::GetOutput(1) );
+}
+
+/**
+ *  Return the distance vectors
+ */
+template< typename TInputImage, typename TOutputImage, typename TVoronoiImage >
+typename
+MaurerVoronoiDistanceMapImageFilter< TInputImage, TOutputImage, TVoronoiImage >::VectorImageType *
+MaurerVoronoiDistanceMapImageFilter< TInputImage, TOutputImage, TVoronoiImage >
+::GetVectorDistanceMap()
+{
+  return dynamic_cast< VectorImageType * >(
+           this->ProcessObject::GetOutput(2) );
+}
+
+/**
+ *  Prepare data for computation
+ */
+template< typename TInputImage, typename TOutputImage, typename TVoronoiImage >
+void
+MaurerVoronoiDistanceMapImageFilter< TInputImage, TOutputImage, TVoronoiImage >
+::PrepareData()
+{
+  itkDebugMacro(<< "PrepareData Start");
+  VoronoiImagePointer voronoiMap = this->GetVoronoiMap();
+
+  InputImagePointer inputImage  =
+    dynamic_cast< const InputImageType * >( ProcessObject::GetInput(0) );
+
+  voronoiMap->SetLargestPossibleRegion(
+    inputImage->GetLargestPossibleRegion() );
+
+  voronoiMap->SetBufferedRegion(
+    inputImage->GetBufferedRegion() );
+
+  voronoiMap->SetRequestedRegion(
+    inputImage->GetRequestedRegion() );
+
+  voronoiMap->Allocate();
+
+  OutputImagePointer distanceMap = this->GetDistanceMap();
+
+  distanceMap->SetLargestPossibleRegion(
+    inputImage->GetLargestPossibleRegion() );
+
+  distanceMap->SetBufferedRegion(
+    inputImage->GetBufferedRegion() );
+
+  distanceMap->SetRequestedRegion(
+    inputImage->GetRequestedRegion() );
+
+  distanceMap->Allocate();
+
+  typename OutputImageType::RegionType region  = voronoiMap->GetRequestedRegion();
+
+  // find the largest of the image dimensions
+  SizeType size = region.GetSize();
+  SizeValueType maxLength = 0;
+
+  for ( unsigned int dim = 0; dim < InputImageDimension; dim++ )
+    {
+    if ( maxLength < size[dim] )
+      {
+      maxLength = size[dim];
+      }
+    }
+
+  // No valid offset component can reach this value, so it marks pixels
+  // for which no object pixel has been found.
+  m_MarkerValue = static_cast< OffsetValueType >( 2 * maxLength );
+
+  ImageRegionConstIteratorWithIndex< InputImageType >  it(inputImage,  region);
+  ImageRegionIteratorWithIndex< VoronoiImageType >     ot(voronoiMap,  region);
+
+  it.GoToBegin();
+  ot.GoToBegin();
+
+  itkDebugMacro(<< "PrepareData: Copy input to output");
+  if ( m_InputIsBinary )
+    {
+    VoronoiPixelType npt = 1;
+    while ( !ot.IsAtEnd() )
+      {
+      if ( it.Get() )
+        {
+        ot.Set(npt);
+        }
+      else
+        {
+        ot.Set(0);
+        }
+      ++it;
+      ++ot;
+      }
+    }
+  else
+    {
+    while ( !ot.IsAtEnd() )
+      {
+      ot.Set( static_cast< VoronoiPixelType >( it.Get() ) );
+      ++it;
+      ++ot;
+      }
+    }
+
+  VectorImagePointer distanceComponents = GetVectorDistanceMap();
+
+  distanceComponents->SetLargestPossibleRegion(
+    inputImage->GetLargestPossibleRegion() );
+
+  distanceComponents->SetBufferedRegion(
+    inputImage->GetBufferedRegion() );
+
+  distanceComponents->SetRequestedRegion(
+    inputImage->GetRequestedRegion() );
+
+  distanceComponents->Allocate();
+
+  ImageRegionIteratorWithIndex< VectorImageType > ct(distanceComponents,  region);
+
+  OffsetType maxValue;
+  OffsetType minValue;
+
+  for ( unsigned int j = 0; j < InputImageDimension; j++ )
+    {
+    maxValue[j] = m_MarkerValue;
+    minValue[j] =             0;
+    }
+
+  itkDebugMacro(<< "PrepareData: Initialize the vector map");
+
+  // Iterate over the input image and distanceComponents image.
+  // Wherever the input image is non-zero, initialize the distanceComponents image to the minValue.
+  // Wherever the input image is zero, initialize the distanceComponents image to the maxValue.
+  it.GoToBegin();
+  ct.GoToBegin();
+  while ( !it.IsAtEnd() )
+    {
+    if ( it.Get() )
+      {
+      ct.Set(minValue);
+      }
+    else
+      {
+      ct.Set(maxValue);
+      }
+    ++it;
+    ++ct;
+    }
+  itkDebugMacro(<< "PrepareData End");
+}
+
+/**
+ *  Site removal criterion of the lower envelope computation.
+ */
+template< typename TInputImage, typename TOutputImage, typename TVoronoiImage >
+bool
+MaurerVoronoiDistanceMapImageFilter< TInputImage, TOutputImage, TVoronoiImage >
+::RemoveSite(double d1, double d2, double df,
+             double x1, double x2, double xf)
+{
+  const double a = x2 - x1;
+  const double b = xf - x2;
+  const double c = xf - x1;
+
+  return ( c * d2 - b * d1 - a * df - a * b * c > 0.0 );
+}
+
+/**
+ *  Split the region perpendicularly to the current dimension.
+ */
+template< typename TInputImage, typename TOutputImage, typename TVoronoiImage >
+unsigned int
+MaurerVoronoiDistanceMapImageFilter< TInputImage, TOutputImage, TVoronoiImage >
+::SplitRequestedRegion(unsigned int i, unsigned int num,
+  OutputImageRegionType & splitRegion)
+{
+  // Get the output pointer
+  OutputImageType *outputPtr = this->GetOutput();
+
+  // Initialize the splitRegion to the output requested region
+  splitRegion = outputPtr->GetRequestedRegion();
+
+  const SizeType & requestedRegionSize = splitRegion.GetSize();
+
+  IndexType splitIndex = splitRegion.GetIndex();
+  SizeType  splitSize  = splitRegion.GetSize();
+
+  // split on the outermost dimension available
+  // and avoid the current dimension
+  int splitAxis = static_cast< int >( outputPtr->GetImageDimension() ) - 1;
+  while ( ( requestedRegionSize[splitAxis] == 1 ) ||
+          ( splitAxis == static_cast< int >( m_CurrentDimension ) ) )
+    {
+    --splitAxis;
+    if ( splitAxis < 0 )
+      { // cannot split
+      itkDebugMacro("Cannot Split");
+      return 1;
+      }
+    }
+
+  // determine the actual number of pieces that will be generated
+  auto range = static_cast< double >( requestedRegionSize[splitAxis] );
+
+  auto valuesPerThread = static_cast< unsigned int >( std::ceil( range / static_cast< double >( num ) ) );
+  unsigned int maxThreadIdUsed =
+    static_cast< unsigned int >( std::ceil( range / static_cast< double >( valuesPerThread ) ) ) - 1;
+
+  // Split the region
+  if ( i < maxThreadIdUsed )
+    {
+    splitIndex[splitAxis] += i * valuesPerThread;
+    splitSize[splitAxis] = valuesPerThread;
+    }
+  if ( i == maxThreadIdUsed )
+    {
+    splitIndex[splitAxis] += i * valuesPerThread;
+    // last thread needs to process the "rest" dimension being split
+    splitSize[splitAxis] = splitSize[splitAxis] - i * valuesPerThread;
+    }
+
+  // set the split region ivars
+  splitRegion.SetIndex(splitIndex);
+  splitRegion.SetSize(splitSize);
+
+  itkDebugMacro("Split Piece: " << splitRegion);
+
+  return maxThreadIdUsed + 1;
+}
+
+/**
+ *  Propagate the feature identities along the lines of the current
+ *  dimension.
+ */
+template< typename TInputImage, typename TOutputImage, typename TVoronoiImage >
+void
+MaurerVoronoiDistanceMapImageFilter< TInputImage, TOutputImage, TVoronoiImage >
+::ThreadedGenerateData(const OutputImageRegionType & outputRegionForThread, ThreadIdType threadId)
+{
+  VectorImagePointer distanceComponents = this->GetVectorDistanceMap();
+
+  const unsigned int d = m_CurrentDimension;
+  const SizeValueType lineLength = outputRegionForThread.GetSize()[d];
+  if ( lineLength == 0 )
+    {
+    return;
+    }
+
+  double spacing = 1.0;
+  if ( m_UseImageSpacing )
+    {
+    spacing = static_cast< double >( m_InputSpacingCache[d] );
+    }
+
+  const SizeValueType numberOfLines =
+    outputRegionForThread.GetNumberOfPixels() / lineLength;
+  const float progressPerDimension = 1.0f / static_cast< float >( InputImageDimension );
+  ProgressReporter progress(this, threadId, numberOfLines, 30,
+                            static_cast< float >( d ) * progressPerDimension,
+                            progressPerDimension);
+
+  // Line buffer and lower envelope of candidate sites.  After the
+  // previous passes, the offset stored at line position i points to the
+  // closest object pixel among those sharing the remaining coordinates
+  // of position i, so the candidates of this line are complete.
+  std::vector< OffsetType > lineOffsets(lineLength);
+
+  std::vector< double >          envelopeDistance(lineLength);
+  std::vector< double >          envelopePosition(lineLength);
+  std::vector< OffsetValueType > envelopeLineIndex(lineLength);
+  std::vector< OffsetType >      envelopeOffset(lineLength);
+
+  ImageLinearIteratorWithIndex< VectorImageType >
+  it(distanceComponents, outputRegionForThread);
+  it.SetDirection(d);
+  it.GoToBegin();
+
+  while ( !it.IsAtEnd() )
+    {
+    SizeValueType i = 0;
+    while ( !it.IsAtEndOfLine() )
+      {
+      lineOffsets[i++] = it.Get();
+      ++it;
+      }
+
+    // Build the lower envelope of the candidate sites of this line.
+    int l = -1;
+    for ( i = 0; i < lineLength; i++ )
+      {
+      const OffsetType & candidate = lineOffsets[i];
+      if ( candidate[0] == m_MarkerValue )
+        {
+        // No object pixel has been found for this position yet.
+        continue;
+        }
+
+      double candidateDistance = 0.0;
+      for ( unsigned int k = 0; k < InputImageDimension; k++ )
+        {
+        double component = static_cast< double >( candidate[k] );
+        if ( m_UseImageSpacing )
+          {
+          component *= static_cast< double >( m_InputSpacingCache[k] );
+          }
+        candidateDistance += component * component;
+        }
+      const double candidatePosition = static_cast< double >( i ) * spacing;
+
+      while ( ( l >= 1 )
+              && Self::RemoveSite(envelopeDistance[l - 1], envelopeDistance[l],
+                                  candidateDistance,
+                                  envelopePosition[l - 1], envelopePosition[l],
+                                  candidatePosition) )
+        {
+        l--;
+        }
+      l++;
+      envelopeDistance[l] = candidateDistance;
+      envelopePosition[l] = candidatePosition;
+      envelopeLineIndex[l] = static_cast< OffsetValueType >( i );
+      envelopeOffset[l] = candidate;
+      }
+
+    if ( l >= 0 )
+      {
+      // Scan the line again and assign to each position the closest
+      // site of the envelope.
+      const int ns = l;
+      l = 0;
+      for ( i = 0; i < lineLength; i++ )
+        {
+        const double w = static_cast< double >( i ) * spacing;
+
+        double d1 = envelopeDistance[l]
+          + ( envelopePosition[l] - w ) * ( envelopePosition[l] - w );
+        while ( l < ns )
+          {
+          const double d2 = envelopeDistance[l + 1]
+            + ( envelopePosition[l + 1] - w ) * ( envelopePosition[l + 1] - w );
+          if ( d1 <= d2 )
+            {
+            break;
+            }
+          l++;
+          d1 = d2;
+          }
+
+        OffsetType closest = envelopeOffset[l];
+        closest[d] = envelopeLineIndex[l] - static_cast< OffsetValueType >( i );
+        lineOffsets[i] = closest;
+        }
+
+      it.GoToBeginOfLine();
+      i = 0;
+      while ( !it.IsAtEndOfLine() )
+        {
+        it.Set( lineOffsets[i++] );
+        ++it;
+        }
+      }
+
+    it.NextLine();
+    progress.CompletedPixel();
+    }
+}
+
+/**
+ *  Compute the Voronoi map and the distance map from the vector map
+ */
+template< typename TInputImage, typename TOutputImage, typename TVoronoiImage >
+void
+MaurerVoronoiDistanceMapImageFilter< TInputImage, TOutputImage, TVoronoiImage >
+::ComputeVoronoiMap()
+{
+  itkDebugMacro(<< "ComputeVoronoiMap Start");
+  VoronoiImagePointer voronoiMap          =  this->GetVoronoiMap();
+  OutputImagePointer  distanceMap         =  this->GetDistanceMap();
+  VectorImagePointer  distanceComponents  =  this->GetVectorDistanceMap();
+
+  typename OutputImageType::RegionType region  = voronoiMap->GetRequestedRegion();
+
+  itkDebugMacro(<< "ComputeVoronoiMap Region: " << region);
+
+  // The offsets of object pixels are zero and their Voronoi labels are
+  // left as initialized, so the lookups below only read pixels that no
+  // work unit modifies and the pass can run in parallel.
+  MultiThreaderBase::Pointer multiThreader = MultiThreaderBase::New();
+  multiThreader->ParallelizeImageRegion< InputImageDimension >( region,
+    [this, voronoiMap, distanceMap, distanceComponents, &region]
+    ( const typename OutputImageType::RegionType & subRegion )
+      {
+      ImageRegionIteratorWithIndex< VoronoiImageType > ot(voronoiMap,          subRegion);
+      ImageRegionIteratorWithIndex< VectorImageType >  ct(distanceComponents,  subRegion);
+      ImageRegionIteratorWithIndex< OutputImageType >  dt(distanceMap,         subRegion);
+
+      ot.GoToBegin();
+      ct.GoToBegin();
+      dt.GoToBegin();
+      while ( !ot.IsAtEnd() )
+        {
+        const OffsetType distanceVector = ct.Get();
+
+        bool isObject = true;
+        for ( unsigned int i = 0; i < InputImageDimension; i++ )
+          {
+          if ( distanceVector[i] != 0 )
+            {
+            isObject = false;
+            break;
+            }
+          }
+
+        if ( !isObject )
+          {
+          IndexType index = ct.GetIndex() + distanceVector;
+          if ( region.IsInside(index) )
+            {
+            ot.Set( voronoiMap->GetPixel(index) );
+            }
+          }
+
+        double distance = 0.0;
+        if ( this->m_UseImageSpacing )
+          {
+          for ( unsigned int i = 0; i < InputImageDimension; i++ )
+            {
+            double component = distanceVector[i] * static_cast< double >( this->m_InputSpacingCache[i] );
+            distance += component * component;
+            }
+          }
+        else
+          {
+          for ( unsigned int i = 0; i < InputImageDimension; i++ )
+            {
+            distance += distanceVector[i] * distanceVector[i];
+            }
+          }
+
+        if ( this->m_SquaredDistance )
+          {
+          dt.Set( static_cast< OutputPixelType >( distance ) );
+          }
+        else
+          {
+          dt.Set( static_cast< OutputPixelType >( std::sqrt(distance) ) );
+          }
+        ++ot;
+        ++ct;
+        ++dt;
+        }
+      }, nullptr );
+  itkDebugMacro(<< "ComputeVoronoiMap End");
+}
+
+/**
+ *  Compute Distance and Voronoi maps
+ */
+template< typename TInputImage, typename TOutputImage, typename TVoronoiImage >
+void
+MaurerVoronoiDistanceMapImageFilter< TInputImage, TOutputImage, TVoronoiImage >
+::GenerateData()
+{
+  this->PrepareData();
+
+  this->m_InputSpacingCache = this->GetInput()->GetSpacing();
+
+  // Sweep the image dimension by dimension.  The lines of each sweep
+  // are independent and are distributed over the work units by
+  // SplitRequestedRegion().
+  typename ImageSource< OutputImageType >::ThreadStruct str;
+  str.Filter = this;
+
+  this->GetMultiThreader()->SetNumberOfWorkUnits( this->GetNumberOfWorkUnits() );
+  this->GetMultiThreader()->SetSingleMethod(this->ThreaderCallback, &str);
+
+  for ( unsigned int d = 0; d < InputImageDimension; d++ )
+    {
+    m_CurrentDimension = d;
+    this->GetMultiThreader()->SingleMethodExecute();
+    }
+
+  itkDebugMacro(<< "GenerateData: ComputeVoronoiMap");
+
+  this->ComputeVoronoiMap();
+} // end GenerateData()
+
+/**
+ *  Print Self
+ */
+template< typename TInputImage, typename TOutputImage, typename TVoronoiImage >
+void
+MaurerVoronoiDistanceMapImageFilter< TInputImage, TOutputImage, TVoronoiImage >
+::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  os << indent << "Maurer Voronoi Distance: " << std::endl;
+  os << indent << "Input Is Binary   : " << m_InputIsBinary << std::endl;
+  os << indent << "Use Image Spacing : " << m_UseImageSpacing << std::endl;
+  os << indent << "Squared Distance  : " << m_SquaredDistance << std::endl;
+}
+} // end namespace itk
+
+#endif
@@ -152,6 +152,29 @@ public:
   itkSetMacro(BackgroundValue, InputPixelType);
   itkGetConstReferenceMacro(BackgroundValue, InputPixelType);
 
+  /** Restrict the exact distance computation to a narrow band around
+   *  the object boundary. Pixels farther than MaximumDistance from the
+   *  boundary receive the SaturationValue (with the sign given by the
+   *  inside/outside convention) instead of their exact distance, and
+   *  the per-line scans skip candidate boundary pixels outside the
+   *  band, which makes the filter considerably faster when only the
+   *  neighborhood of the interface is consumed. The distance is
+   *  interpreted in physical units when UseImageSpacing is on and in
+   *  pixel units otherwise. The default value 0 disables the narrow
+   *  band and computes the exact distance everywhere. */
+  itkSetMacro(MaximumDistance, double);
+  itkGetConstReferenceMacro(MaximumDistance, double);
+
+  /** Set the value assigned to pixels farther than MaximumDistance
+   *  from the object boundary. The value is written as is when
+   *  SquaredDistance is on, so it should then be chosen in squared
+   *  units. Defaults to the maximum of the output pixel type; a common
+   *  alternative is the MaximumDistance itself, which saturates the
+   *  map at the band limit. Only used when MaximumDistance is
+   *  non-zero. */
+  itkSetMacro(SaturationValue, OutputPixelType);
+  itkGetConstReferenceMacro(SaturationValue, OutputPixelType);
+
 protected:
   SignedMaurerDistanceMapImageFilter();
   ~SignedMaurerDistanceMapImageFilter() override;
@@ -178,6 +201,14 @@ private:
   InputPixelType   m_BackgroundValue;
   InputSpacingType m_Spacing;
 
+  double          m_MaximumDistance{0.0};
+  OutputPixelType m_SaturationValue;
+
+  /** Squared narrow band radius, cached by GenerateData() so the
+   * per-line scans do not recompute it. Zero when the narrow band is
+   * disabled. */
+  double m_NarrowBandSquared{0.0};
+
   unsigned int m_CurrentDimension{0};
 
   bool m_InsideIsPositive{false};
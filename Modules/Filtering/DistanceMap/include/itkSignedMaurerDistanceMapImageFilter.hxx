@@ -36,7 +36,7 @@ SignedMaurerDistanceMapImageFilter< TInputImage, TOutputImage >
 ::SignedMaurerDistanceMapImageFilter():
   m_BackgroundValue( NumericTraits< InputPixelType >::ZeroValue() ),
   m_Spacing(0.0),
-
+  m_SaturationValue( NumericTraits< OutputPixelType >::max() ),
   m_InputCache(nullptr)
 {
   this->DynamicMultiThreadingOff();
@@ -120,6 +120,8 @@ SignedMaurerDistanceMapImageFilter< TInputImage, TOutputImage >
   // prepare the data
   this->AllocateOutputs();
   this->m_Spacing = outputPtr->GetSpacing();
+  // the per-line scans compare against squared distances
+  this->m_NarrowBandSquared = this->m_MaximumDistance * this->m_MaximumDistance;
 
   // store the binary image in an image with a pixel type as small as possible
   // instead of keeping the native input pixel type to avoid using too much
@@ -205,8 +207,11 @@ SignedMaurerDistanceMapImageFilter< TInputImage, TOutputImage >
   // set the progress reporter. Use a pointer to be able to destroy it before
   // the creation of progress2
   // so it won't set wrong progress at the end of ThreadedGenerateData()
+  // the last pass over the output runs for non-squared distances and
+  // for narrow-band saturation
+  const bool finalPass = !this->m_SquaredDistance || this->m_MaximumDistance > 0.0;
   float progressPerDimension = 0.67f / static_cast< float >( ImageDimension );
-  if ( !this->m_SquaredDistance )
+  if ( finalPass )
     {
     progressPerDimension = 0.67f / ( static_cast< float >( ImageDimension ) + 1 );
     }
@@ -259,7 +264,7 @@ SignedMaurerDistanceMapImageFilter< TInputImage, TOutputImage >
     }
   delete progress;
 
-  if ( m_CurrentDimension == ImageDimension - 1 && !this->m_SquaredDistance )
+  if ( m_CurrentDimension == ImageDimension - 1 && finalPass )
     {
     using OutputIterator = ImageRegionIterator< OutputImageType >;
     using InputIterator = ImageRegionConstIterator< InputImageType  >;
@@ -282,8 +287,23 @@ SignedMaurerDistanceMapImageFilter< TInputImage, TOutputImage >
     while ( !Ot.IsAtEnd() )
       {
       // cast to a real type is required on some platforms
-      const auto outputValue = static_cast< OutputPixelType >(
-          std::sqrt( static_cast< OutputRealType >( itk::Math::abs( Ot.Get() ) ) ) );
+      const auto squaredValue =
+        static_cast< OutputRealType >( itk::Math::abs( Ot.Get() ) );
+
+      OutputPixelType outputValue;
+      if ( this->m_MaximumDistance > 0.0
+           && static_cast< double >( squaredValue ) > this->m_NarrowBandSquared )
+        {
+        outputValue = this->m_SaturationValue;
+        }
+      else if ( this->m_SquaredDistance )
+        {
+        outputValue = static_cast< OutputPixelType >( squaredValue );
+        }
+      else
+        {
+        outputValue = static_cast< OutputPixelType >( std::sqrt( squaredValue ) );
+        }
 
       if ( Math::NotExactlyEquals( It.Get(), this->m_BackgroundValue ) )
         {
@@ -332,6 +352,20 @@ SignedMaurerDistanceMapImageFilter< TInputImage, TOutputImage >
 
   OutputPixelType di;
 
+  const bool narrowBand = ( this->m_MaximumDistance > 0.0 );
+  // Value used to clamp distances beyond the band. Any value above the
+  // squared band radius keeps in-band results exact: a clamped pixel
+  // can never beat a true in-band candidate in a later scan, and
+  // out-of-band pixels are saturated in the final pass regardless.
+  // Keeping the clamp small also limits the magnitude of the
+  // intermediate arithmetic.
+  OutputPixelType bandCap = NumericTraits< OutputPixelType >::max();
+  if ( narrowBand
+       && this->m_NarrowBandSquared + 1.0 < static_cast< double >( bandCap ) )
+    {
+    bandCap = static_cast< OutputPixelType >( this->m_NarrowBandSquared + 1.0 );
+    }
+
   int l = -1;
 
   for ( unsigned int i = 0; i < nd; i++ )
@@ -352,7 +386,13 @@ SignedMaurerDistanceMapImageFilter< TInputImage, TOutputImage >
       iw  = static_cast< OutputPixelType >( i );
       }
 
-    if ( Math::NotExactlyEquals( di, NumericTraits< OutputPixelType >::max() ) )
+    // A candidate whose partial distance already exceeds the band can
+    // never yield an in-band distance for any pixel of this line, so it
+    // is left out of the lower envelope; this keeps the envelope short
+    // when only a narrow band is requested.
+    if ( Math::NotExactlyEquals( di, NumericTraits< OutputPixelType >::max() )
+         && ( !narrowBand
+              || static_cast< double >( itk::Math::abs( di ) ) <= this->m_NarrowBandSquared ) )
       {
       if ( l < 1 )
         {
@@ -410,6 +450,12 @@ SignedMaurerDistanceMapImageFilter< TInputImage, TOutputImage >
       l++;
       d1 = d2;
       }
+
+    if ( narrowBand && d1 > bandCap )
+      {
+      d1 = bandCap;
+      }
+
     idx[d] = i + startIndex[d];
 
     if ( Math::NotExactlyEquals( m_InputCache->GetPixel(idx), this->m_BackgroundValue ) )
@@ -473,6 +519,11 @@ SignedMaurerDistanceMapImageFilter< TInputImage, TOutputImage >
      << this->m_UseImageSpacing << std::endl;
   os << indent << "Squared distance: "
      << this->m_SquaredDistance << std::endl;
+  os << indent << "Maximum distance: "
+     << this->m_MaximumDistance << std::endl;
+  os << indent << "Saturation value: "
+     << static_cast< typename NumericTraits< OutputPixelType >::PrintType >( this->m_SaturationValue )
+     << std::endl;
 }
 } // end namespace itk
 
@@ -0,0 +1,164 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkMaurerVoronoiDistanceMapImageFilter.h"
+#include "itkSignedMaurerDistanceMapImageFilter.h"
+#include "itkImageRegionConstIteratorWithIndex.h"
+
+#include <cmath>
+#include <vector>
+
+int itkMaurerVoronoiDistanceMapImageFilterTest( int, char * [] )
+{
+  using InputImageType = itk::Image< unsigned char, 2 >;
+  using FloatImageType = itk::Image< float, 2 >;
+
+  // A few labeled point sites on a small image
+  InputImageType::Pointer input = InputImageType::New();
+  InputImageType::SizeType size = {{16, 12}};
+  InputImageType::RegionType region;
+  region.SetSize( size );
+  input->SetRegions( region );
+  input->Allocate(true);
+
+  std::vector< InputImageType::IndexType > sites;
+  std::vector< unsigned char > labels;
+  sites.push_back( {{2, 3}} );
+  labels.push_back( 1 );
+  sites.push_back( {{12, 4}} );
+  labels.push_back( 2 );
+  sites.push_back( {{6, 9}} );
+  labels.push_back( 3 );
+  for ( size_t i = 0; i < sites.size(); i++ )
+    {
+    input->SetPixel( sites[i], labels[i] );
+    }
+
+  using FilterType =
+    itk::MaurerVoronoiDistanceMapImageFilter< InputImageType, FloatImageType, InputImageType >;
+  FilterType::Pointer filter = FilterType::New();
+  filter->SetInput( input );
+  filter->SquaredDistanceOff();
+  filter->UseImageSpacingOff();
+  filter->Update();
+
+  const FloatImageType * distanceMap = filter->GetDistanceMap();
+  const InputImageType * voronoiMap = filter->GetVoronoiMap();
+  const FilterType::VectorImageType * vectorMap = filter->GetVectorDistanceMap();
+
+  // Reference distance map from the established Maurer filter: on the
+  // background its positive values are the distances to the closest
+  // object pixel.
+  using ReferenceFilterType =
+    itk::SignedMaurerDistanceMapImageFilter< InputImageType, FloatImageType >;
+  ReferenceFilterType::Pointer referenceFilter = ReferenceFilterType::New();
+  referenceFilter->SetInput( input );
+  referenceFilter->SquaredDistanceOff();
+  referenceFilter->UseImageSpacingOff();
+  referenceFilter->InsideIsPositiveOff();
+  referenceFilter->Update();
+
+  const FloatImageType * referenceMap = referenceFilter->GetOutput();
+
+  constexpr double tolerance = 1e-4;
+
+  itk::ImageRegionConstIteratorWithIndex< InputImageType > it( input, region );
+  for ( it.GoToBegin(); !it.IsAtEnd(); ++it )
+    {
+    const InputImageType::IndexType index = it.GetIndex();
+
+    // Brute force nearest site search
+    double minDistance2 = itk::NumericTraits< double >::max();
+    for ( size_t i = 0; i < sites.size(); i++ )
+      {
+      const double dx = static_cast< double >( index[0] - sites[i][0] );
+      const double dy = static_cast< double >( index[1] - sites[i][1] );
+      minDistance2 = std::min( minDistance2, dx * dx + dy * dy );
+      }
+
+    const double distance = distanceMap->GetPixel( index );
+    if ( std::abs( distance - std::sqrt( minDistance2 ) ) > tolerance )
+      {
+      std::cerr << "Wrong distance at " << index << ": " << distance
+                << " != " << std::sqrt( minDistance2 ) << std::endl;
+      return EXIT_FAILURE;
+      }
+
+    // On the background the distances must agree with the reference
+    // filter; the site pixels themselves are at distance zero while the
+    // signed reference is negative there.
+    if ( it.Get() == 0 )
+      {
+      if ( std::abs( distance - referenceMap->GetPixel( index ) ) > tolerance )
+        {
+        std::cerr << "Distance disagrees with SignedMaurerDistanceMapImageFilter at "
+                  << index << ": " << distance << " != "
+                  << referenceMap->GetPixel( index ) << std::endl;
+        return EXIT_FAILURE;
+        }
+      }
+    else if ( distance != 0.0 )
+      {
+      std::cerr << "Nonzero distance " << distance << " on the site at "
+                << index << std::endl;
+      return EXIT_FAILURE;
+      }
+
+    // The Voronoi label must belong to a site at the minimum distance;
+    // where two sites are equally close either label is a valid answer.
+    const unsigned char voronoiLabel = voronoiMap->GetPixel( index );
+    double labelDistance2 = itk::NumericTraits< double >::max();
+    for ( size_t i = 0; i < sites.size(); i++ )
+      {
+      if ( labels[i] != voronoiLabel )
+        {
+        continue;
+        }
+      const double dx = static_cast< double >( index[0] - sites[i][0] );
+      const double dy = static_cast< double >( index[1] - sites[i][1] );
+      labelDistance2 = std::min( labelDistance2, dx * dx + dy * dy );
+      }
+    if ( std::abs( labelDistance2 - minDistance2 ) > tolerance )
+      {
+      std::cerr << "Voronoi label " << static_cast< int >( voronoiLabel )
+                << " at " << index << " is not a closest site." << std::endl;
+      return EXIT_FAILURE;
+      }
+
+    // The vector map must point to an object pixel at the minimum distance
+    const FilterType::OffsetType offset = vectorMap->GetPixel( index );
+    const InputImageType::IndexType closest = index + offset;
+    if ( !region.IsInside( closest ) || input->GetPixel( closest ) == 0 )
+      {
+      std::cerr << "Vector map at " << index << " points to " << closest
+                << ", which is not an object pixel." << std::endl;
+      return EXIT_FAILURE;
+      }
+    const double offset2 = static_cast< double >( offset[0] * offset[0]
+                                                  + offset[1] * offset[1] );
+    if ( std::abs( offset2 - minDistance2 ) > tolerance )
+      {
+      std::cerr << "Vector map at " << index << " is not minimal: " << offset
+                << std::endl;
+      return EXIT_FAILURE;
+      }
+    }
+
+  std::cout << "Test PASSED." << std::endl;
+  return EXIT_SUCCESS;
+}
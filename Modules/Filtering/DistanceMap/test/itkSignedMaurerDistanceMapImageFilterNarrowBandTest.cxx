@@ -0,0 +1,123 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkSignedMaurerDistanceMapImageFilter.h"
+#include "itkImageRegionConstIterator.h"
+
+// Verify that the narrow-band mode produces distances identical to the
+// full map inside the band and the saturation value everywhere else.
+int itkSignedMaurerDistanceMapImageFilterNarrowBandTest( int, char *[] )
+{
+  constexpr unsigned int ImageDimension = 2;
+  using InputImageType = itk::Image< unsigned char, ImageDimension >;
+  using OutputImageType = itk::Image< float, ImageDimension >;
+  using FilterType = itk::SignedMaurerDistanceMapImageFilter<
+    InputImageType, OutputImageType >;
+
+  // Binary input: a 21 x 31 rectangle inside a 100 x 100 image.
+  InputImageType::SizeType size;
+  size.Fill( 100 );
+  InputImageType::Pointer input = InputImageType::New();
+  input->SetRegions( size );
+  input->Allocate( true );
+  for ( itk::IndexValueType y = 35; y < 66; ++y )
+    {
+    for ( itk::IndexValueType x = 40; x < 61; ++x )
+      {
+      InputImageType::IndexType index = {{ x, y }};
+      input->SetPixel( index, 255 );
+      }
+    }
+
+  constexpr double maximumDistance = 7.0;
+  constexpr float  saturationValue = 7.0f;
+
+  FilterType::Pointer fullFilter = FilterType::New();
+  fullFilter->SetInput( input );
+  fullFilter->SetUseImageSpacing( true );
+  fullFilter->Update();
+
+  FilterType::Pointer bandFilter = FilterType::New();
+  bandFilter->SetInput( input );
+  bandFilter->SetUseImageSpacing( true );
+  bandFilter->SetMaximumDistance( maximumDistance );
+  bandFilter->SetSaturationValue( saturationValue );
+  bandFilter->Update();
+
+  if ( bandFilter->GetMaximumDistance() != maximumDistance
+       || bandFilter->GetSaturationValue() != saturationValue )
+    {
+    std::cerr << "Narrow band parameters were not stored." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  itk::ImageRegionConstIterator< OutputImageType >
+    fullIt( fullFilter->GetOutput(),
+            fullFilter->GetOutput()->GetLargestPossibleRegion() );
+  itk::ImageRegionConstIterator< OutputImageType >
+    bandIt( bandFilter->GetOutput(),
+            bandFilter->GetOutput()->GetLargestPossibleRegion() );
+  for ( ; !fullIt.IsAtEnd(); ++fullIt, ++bandIt )
+    {
+    const float fullValue = fullIt.Get();
+    const float bandValue = bandIt.Get();
+    if ( itk::Math::abs( fullValue ) <= maximumDistance )
+      {
+      if ( bandValue != fullValue )
+        {
+        std::cerr << "In-band distance mismatch at " << fullIt.GetIndex()
+                  << ": " << bandValue << " versus " << fullValue << std::endl;
+        return EXIT_FAILURE;
+        }
+      }
+    else if ( itk::Math::abs( bandValue ) != saturationValue
+              || ( bandValue < 0.0f ) != ( fullValue < 0.0f ) )
+      {
+      std::cerr << "Out-of-band pixel at " << fullIt.GetIndex()
+                << " is not saturated: " << bandValue << std::endl;
+      return EXIT_FAILURE;
+      }
+    }
+
+  // In squared mode the saturation value is written as is.
+  FilterType::Pointer squaredBandFilter = FilterType::New();
+  squaredBandFilter->SetInput( input );
+  squaredBandFilter->SetUseImageSpacing( true );
+  squaredBandFilter->SquaredDistanceOn();
+  squaredBandFilter->SetMaximumDistance( maximumDistance );
+  squaredBandFilter->SetSaturationValue( saturationValue * saturationValue );
+  squaredBandFilter->Update();
+
+  itk::ImageRegionConstIterator< OutputImageType >
+    squaredIt( squaredBandFilter->GetOutput(),
+               squaredBandFilter->GetOutput()->GetLargestPossibleRegion() );
+  for ( bandIt.GoToBegin(); !bandIt.IsAtEnd(); ++bandIt, ++squaredIt )
+    {
+    const float expected = bandIt.Get() * itk::Math::abs( bandIt.Get() );
+    if ( itk::Math::abs( squaredIt.Get() - expected ) > 1e-3f )
+      {
+      std::cerr << "Squared narrow band mismatch at " << bandIt.GetIndex()
+                << ": " << squaredIt.Get() << " versus " << expected << std::endl;
+      return EXIT_FAILURE;
+      }
+    }
+
+  bandFilter->Print( std::cout );
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
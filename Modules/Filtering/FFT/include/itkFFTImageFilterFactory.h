@@ -0,0 +1,204 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkFFTImageFilterFactory_h
+#define itkFFTImageFilterFactory_h
+
+#include "itkImage.h"
+#include "itkObjectFactoryBase.h"
+#include "itkCreateObjectFunction.h"
+#include "itkVersion.h"
+
+#include "itkVnlComplexToComplexFFTImageFilter.h"
+#include "itkVnlForwardFFTImageFilter.h"
+#include "itkVnlHalfHermitianToRealInverseFFTImageFilter.h"
+#include "itkVnlInverseFFTImageFilter.h"
+#include "itkVnlRealToHalfHermitianForwardFFTImageFilter.h"
+
+#include <complex>
+
+namespace itk
+{
+/** \class FFTImageFilterTraits
+ * \brief Maps an FFT backend template onto its concrete instantiations.
+ *
+ * The abstract FFT filter bases are templated over their input and
+ * output images, and the relation between the two depends on the kind
+ * of transform: real to complex, complex to real or complex to
+ * complex. Each backend provides a specialization of this struct,
+ * usually next to the filter template itself, with a single member
+ * template alias
+ *
+ * \code
+ * template< typename TUnderlying, unsigned int VDimension >
+ * using FilterType = ...;
+ * \endcode
+ *
+ * mapping an underlying real pixel type and a dimension to the
+ * concrete backend filter type. This is all FFTImageFilterFactory
+ * needs to register the backend for every supported combination.
+ *
+ * \ingroup FourierTransform
+ * \ingroup ITKFFT
+ */
+template< template< typename... > class TFFTImageFilter >
+struct FFTImageFilterTraits;
+
+/** Traits for the in-tree Vnl backends. Vendor backend modules are
+ * expected to provide the equivalent specializations for their own
+ * filter templates. */
+template<>
+struct FFTImageFilterTraits< VnlForwardFFTImageFilter >
+{
+  template< typename TUnderlying, unsigned int VDimension >
+  using FilterType = VnlForwardFFTImageFilter< Image< TUnderlying, VDimension >,
+                                               Image< std::complex< TUnderlying >, VDimension > >;
+};
+
+template<>
+struct FFTImageFilterTraits< VnlInverseFFTImageFilter >
+{
+  template< typename TUnderlying, unsigned int VDimension >
+  using FilterType = VnlInverseFFTImageFilter< Image< std::complex< TUnderlying >, VDimension >,
+                                               Image< TUnderlying, VDimension > >;
+};
+
+template<>
+struct FFTImageFilterTraits< VnlRealToHalfHermitianForwardFFTImageFilter >
+{
+  template< typename TUnderlying, unsigned int VDimension >
+  using FilterType = VnlRealToHalfHermitianForwardFFTImageFilter< Image< TUnderlying, VDimension >,
+                                                                  Image< std::complex< TUnderlying >, VDimension > >;
+};
+
+template<>
+struct FFTImageFilterTraits< VnlHalfHermitianToRealInverseFFTImageFilter >
+{
+  template< typename TUnderlying, unsigned int VDimension >
+  using FilterType = VnlHalfHermitianToRealInverseFFTImageFilter< Image< std::complex< TUnderlying >, VDimension >,
+                                                                  Image< TUnderlying, VDimension > >;
+};
+
+template<>
+struct FFTImageFilterTraits< VnlComplexToComplexFFTImageFilter >
+{
+  template< typename TUnderlying, unsigned int VDimension >
+  using FilterType = VnlComplexToComplexFFTImageFilter< Image< std::complex< TUnderlying >, VDimension > >;
+};
+
+/** \class FFTImageFilterFactory
+ * \brief Registers an FFT backend as a runtime override for its
+ * abstract FFT filter base class.
+ *
+ * The New() methods of the abstract FFT bases (ForwardFFTImageFilter,
+ * RealToHalfHermitianForwardFFTImageFilter, ...) consult the object
+ * factory machinery before falling back to the compile time Vnl/FFTW
+ * dispatch. A backend registered through this factory - a vendor FFT
+ * such as MKL or cuFFT, or one of the in-tree backends - therefore
+ * takes precedence at runtime, without any change to the code that
+ * instantiates the filters.
+ *
+ * The backend is registered for float and double underlying pixel
+ * types in one, two and three dimensions, the combinations the FFT
+ * bases support. Factories are inserted at the front of the factory
+ * list, so when several providers are registered the most recently
+ * registered one is preferred; a performance policy that has measured
+ * the available providers can simply register the fastest one last,
+ * or use ObjectFactoryBase::SetEnableFlag() to disable individual
+ * overrides.
+ *
+ * A typical backend module registers itself with
+ *
+ * \code
+ * FFTImageFilterFactory< MKLRealToHalfHermitianForwardFFTImageFilter >
+ *   ::RegisterOneFactory();
+ * \endcode
+ *
+ * after providing the matching FFTImageFilterTraits specialization.
+ *
+ * \ingroup FourierTransform
+ * \ingroup ITKFFT
+ */
+template< template< typename... > class TFFTImageFilter >
+class FFTImageFilterFactory : public ObjectFactoryBase
+{
+public:
+  ITK_DISALLOW_COPY_AND_ASSIGN(FFTImageFilterFactory);
+
+  /** Standard class type aliases. */
+  using Self = FFTImageFilterFactory;
+  using Superclass = ObjectFactoryBase;
+  using Pointer = SmartPointer< Self >;
+  using ConstPointer = SmartPointer< const Self >;
+
+  /** Class methods used to interface with the registered factories. */
+  const char * GetITKSourceVersion() const override
+  {
+    return ITK_SOURCE_VERSION;
+  }
+
+  const char * GetDescription() const override
+  {
+    return "An FFT filter backend factory";
+  }
+
+  /** Method for class instantiation. */
+  itkFactorylessNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(FFTImageFilterFactory, ObjectFactoryBase);
+
+  /** Register one factory of this type. The factory is inserted at
+   * the front of the list, so the backend registered last wins when
+   * several providers override the same FFT base. */
+  static void RegisterOneFactory()
+  {
+    Pointer factory = Self::New();
+
+    ObjectFactoryBase::RegisterFactory(factory, ObjectFactoryBase::INSERT_AT_FRONT);
+  }
+
+protected:
+  FFTImageFilterFactory()
+  {
+    this->OverrideFFTImageFilterType< float, 1 >();
+    this->OverrideFFTImageFilterType< float, 2 >();
+    this->OverrideFFTImageFilterType< float, 3 >();
+    this->OverrideFFTImageFilterType< double, 1 >();
+    this->OverrideFFTImageFilterType< double, 2 >();
+    this->OverrideFFTImageFilterType< double, 3 >();
+  }
+
+  ~FFTImageFilterFactory() override = default;
+
+private:
+  template< typename TUnderlying, unsigned int VDimension >
+  void OverrideFFTImageFilterType()
+  {
+    using FilterType =
+      typename FFTImageFilterTraits< TFFTImageFilter >::template FilterType< TUnderlying, VDimension >;
+
+    this->RegisterOverride( typeid( typename FilterType::Superclass ).name(),
+                            typeid( FilterType ).name(),
+                            "FFT filter backend override",
+                            true,
+                            CreateObjectFunction< FilterType >::New() );
+  }
+};
+} // end namespace itk
+
+#endif
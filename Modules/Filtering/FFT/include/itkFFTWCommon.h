@@ -378,6 +378,35 @@ public:
   {
     fftwf_execute(p);
   }
+
+#ifndef ITK_USE_CUFFTW
+  /** Execute a plan on new arrays. The arrays must have the same size
+   * and alignment as the ones the plan was created with. */
+  static void Execute_dft_r2c(PlanType p, PixelType *in, ComplexType *out)
+  {
+    fftwf_execute_dft_r2c(p, in, out);
+  }
+  static void Execute_dft_c2r(PlanType p, ComplexType *in, PixelType *out)
+  {
+    fftwf_execute_dft_c2r(p, in, out);
+  }
+  static void Execute_dft(PlanType p, ComplexType *in, ComplexType *out)
+  {
+    fftwf_execute_dft(p, in, out);
+  }
+
+  /** Query the alignment class FFTW assigns to a buffer, so plans can
+   * be matched to buffers they may legally be executed on. */
+  static int AlignmentOf(PixelType *buffer)
+  {
+    return fftwf_alignment_of(buffer);
+  }
+  static int AlignmentOf(ComplexType *buffer)
+  {
+    return fftwf_alignment_of( reinterpret_cast< PixelType * >( buffer ) );
+  }
+#endif
+
   static void DestroyPlan(PlanType p)
   {
 #ifndef ITK_USE_CUFFTW
@@ -705,6 +734,35 @@ public:
   {
     fftw_execute(p);
   }
+
+#ifndef ITK_USE_CUFFTW
+  /** Execute a plan on new arrays. The arrays must have the same size
+   * and alignment as the ones the plan was created with. */
+  static void Execute_dft_r2c(PlanType p, PixelType *in, ComplexType *out)
+  {
+    fftw_execute_dft_r2c(p, in, out);
+  }
+  static void Execute_dft_c2r(PlanType p, ComplexType *in, PixelType *out)
+  {
+    fftw_execute_dft_c2r(p, in, out);
+  }
+  static void Execute_dft(PlanType p, ComplexType *in, ComplexType *out)
+  {
+    fftw_execute_dft(p, in, out);
+  }
+
+  /** Query the alignment class FFTW assigns to a buffer, so plans can
+   * be matched to buffers they may legally be executed on. */
+  static int AlignmentOf(PixelType *buffer)
+  {
+    return fftw_alignment_of(buffer);
+  }
+  static int AlignmentOf(ComplexType *buffer)
+  {
+    return fftw_alignment_of( reinterpret_cast< PixelType * >( buffer ) );
+  }
+#endif
+
   static void DestroyPlan(PlanType p)
   {
 #ifndef ITK_USE_CUFFTW
@@ -19,6 +19,7 @@
 #define itkFFTWComplexToComplexFFTImageFilter_hxx
 
 #include "itkFFTWComplexToComplexFFTImageFilter.h"
+#include "itkFFTWPlanCache.h"
 #include "itkIndent.h"
 #include "itkMetaDataObject.h"
 #include "itkImageRegionIterator.h"
@@ -97,6 +98,18 @@ FFTWComplexToComplexFFTImageFilter< TImage >
     sizes[(ImageDimension - 1) - i] = inputSize[i];
     }
 
+#ifndef ITK_USE_CUFFTW
+  // reuse the plan cached for this transform shape, if any, and keep
+  // the plan for the next Update
+  plan = fftw::PlanCache< typename PixelType::value_type >::Plan_dft(ImageDimension,sizes,
+                                    in,
+                                    out,
+                                    transformDirection,
+                                    flags,
+                                    this->GetNumberOfWorkUnits());
+
+  FFTWProxyType::Execute_dft(plan, in, out);
+#else
   plan = FFTWProxyType::Plan_dft(ImageDimension,sizes,
                                     in,
                                     out,
@@ -106,6 +119,7 @@ FFTWComplexToComplexFFTImageFilter< TImage >
 
   FFTWProxyType::Execute(plan);
   FFTWProxyType::DestroyPlan(plan);
+#endif
 }
 
 
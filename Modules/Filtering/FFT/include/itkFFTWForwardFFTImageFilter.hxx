@@ -20,6 +20,7 @@
 
 #include "itkHalfToFullHermitianImageFilter.h"
 #include "itkFFTWForwardFFTImageFilter.h"
+#include "itkFFTWPlanCache.h"
 #include "itkIndent.h"
 #include "itkMetaDataObject.h"
 #include "itkProgressReporter.h"
@@ -112,12 +113,21 @@ FFTWForwardFFTImageFilter< TInputImage, TOutputImage >
     sizes[(ImageDimension - 1) - i] = inputSize[i];
     }
 
+  auto * out = (typename FFTWProxyType::ComplexType*)fftwOutput->GetBufferPointer();
+#ifndef ITK_USE_CUFFTW
+  // reuse the plan cached for this transform shape, if any, and keep
+  // the plan for the next Update
+  plan = fftw::PlanCache< InputPixelType >::Plan_dft_r2c(ImageDimension, sizes, in,
+                                     out, flags,
+                                     MultiThreaderBase::GetGlobalDefaultNumberOfThreads());
+  FFTWProxyType::Execute_dft_r2c(plan, in, out);
+#else
   plan = FFTWProxyType::Plan_dft_r2c(ImageDimension, sizes, in,
-                                     (typename FFTWProxyType::ComplexType*)
-                                     fftwOutput->GetBufferPointer(), flags,
+                                     out, flags,
                                      MultiThreaderBase::GetGlobalDefaultNumberOfThreads());
   FFTWProxyType::Execute(plan);
   FFTWProxyType::DestroyPlan(plan);
+#endif
 
   // Expand the half image to the full image size
   using HalfToFullFilterType = HalfToFullHermitianImageFilter< OutputImageType >;
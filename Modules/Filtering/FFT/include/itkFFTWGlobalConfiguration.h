@@ -290,6 +290,14 @@ public:
   static bool ImportDefaultWisdomFile();
   static bool ExportDefaultWisdomFile();
 
+  /** Write any newly generated wisdom to the default wisdom cache
+   * file right away instead of waiting for the process to exit, so
+   * tuned plans are not lost when a worker is killed. Does nothing
+   * unless WriteWisdomCache is enabled and new wisdom has been
+   * generated since the last flush. Returns true when the cache file
+   * was rewritten. */
+  static bool FlushWisdomCache();
+
 private:
   FFTWGlobalConfiguration(); //This will process env variables
   ~FFTWGlobalConfiguration() override; //This will write cache file if requested.
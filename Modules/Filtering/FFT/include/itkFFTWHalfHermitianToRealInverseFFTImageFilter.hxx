@@ -19,6 +19,7 @@
 #define itkFFTWHalfHermitianToRealInverseFFTImageFilter_hxx
 
 #include "itkFFTWHalfHermitianToRealInverseFFTImageFilter.h"
+#include "itkFFTWPlanCache.h"
 #include "itkImageRegionIterator.h"
 #include "itkProgressReporter.h"
 #include "itkMultiThreaderBase.h"
@@ -97,9 +98,17 @@ FFTWHalfHermitianToRealInverseFFTImageFilter< TInputImage, TOutputImage >
     {
     sizes[(ImageDimension - 1) - i] = outputSize[i];
     }
+#ifndef ITK_USE_CUFFTW
+  // reuse the plan cached for this transform shape, if any, and keep
+  // the plan for the next Update
+  plan = fftw::PlanCache< OutputPixelType >::Plan_dft_c2r( ImageDimension, sizes, in, out, m_PlanRigor,
+                                      MultiThreaderBase::GetGlobalDefaultNumberOfThreads(),
+                                      !m_CanUseDestructiveAlgorithm );
+#else
   plan = FFTWProxyType::Plan_dft_c2r( ImageDimension, sizes, in, out, m_PlanRigor,
                                       MultiThreaderBase::GetGlobalDefaultNumberOfThreads(),
                                       !m_CanUseDestructiveAlgorithm );
+#endif
   if( !m_CanUseDestructiveAlgorithm )
     {
     // complex<double> and double[2] types are compatible memory layouts.
@@ -109,10 +118,14 @@ FFTWHalfHermitianToRealInverseFFTImageFilter< TInputImage, TOutputImage >
                inputPtr->GetBufferPointer()+totalInputSize,
                reinterpret_cast< typename InputImageType::PixelType * > (in) );
     }
+#ifndef ITK_USE_CUFFTW
+  FFTWProxyType::Execute_dft_c2r( plan, in, out );
+#else
   FFTWProxyType::Execute( plan );
 
   // Some cleanup.
   FFTWProxyType::DestroyPlan( plan );
+#endif
   if( !m_CanUseDestructiveAlgorithm )
     {
     delete[] in;
@@ -20,6 +20,7 @@
 
 #include "itkFullToHalfHermitianImageFilter.h"
 #include "itkFFTWInverseFFTImageFilter.h"
+#include "itkFFTWPlanCache.h"
 
 #include "itkImageRegionIterator.h"
 #include "itkProgressReporter.h"
@@ -94,6 +95,14 @@ FFTWInverseFFTImageFilter< TInputImage, TOutputImage >
     sizes[(ImageDimension - 1) - i] = outputSize[i];
     }
 
+#ifndef ITK_USE_CUFFTW
+  // reuse the plan cached for this transform shape, if any, and keep
+  // the plan for the next Update
+  plan = fftw::PlanCache< OutputPixelType >::Plan_dft_c2r( ImageDimension, sizes, in, out, m_PlanRigor,
+                                      MultiThreaderBase::GetGlobalDefaultNumberOfThreads(),
+                                      false );
+  FFTWProxyType::Execute_dft_c2r( plan, in, out );
+#else
   plan = FFTWProxyType::Plan_dft_c2r( ImageDimension, sizes, in, out, m_PlanRigor,
                                       MultiThreaderBase::GetGlobalDefaultNumberOfThreads(),
                                       false );
@@ -101,6 +110,7 @@ FFTWInverseFFTImageFilter< TInputImage, TOutputImage >
 
   // Some cleanup.
   FFTWProxyType::DestroyPlan( plan );
+#endif
 }
 
 template <typename TInputImage, typename TOutputImage>
@@ -0,0 +1,192 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkFFTWPlanCache_h
+#define itkFFTWPlanCache_h
+
+#include "itkFFTWCommon.h"
+
+#if ( defined( ITK_USE_FFTWF ) || defined( ITK_USE_FFTWD ) ) && !defined( ITK_USE_CUFFTW )
+
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace itk
+{
+namespace fftw
+{
+/**
+ * \class PlanCache
+ * \brief Process wide cache of FFTW plans.
+ *
+ * Planning with a rigor above FFTW_ESTIMATE is expensive, and the
+ * FFTW filters create a new plan on every GenerateData call. This
+ * cache keys plans by transform kind, size, sign, flags, number of
+ * threads and buffer alignment class, so the plan created by the
+ * first Update is reused by every later transform of the same shape
+ * within the process. Cached plans are executed through the new array
+ * interface of the Proxy (Execute_dft_r2c and friends), which is
+ * valid because the alignment of the buffers is part of the key.
+ *
+ * Whenever plan creation produces new wisdom, the wisdom cache file
+ * is flushed immediately through
+ * FFTWGlobalConfiguration::FlushWisdomCache(), so tuned plans also
+ * survive worker processes that never exit cleanly.
+ *
+ * Cached plans are only destroyed by Clear(). The plans left at
+ * process exit are reclaimed by the FFTW cleanup performed by
+ * FFTWGlobalConfiguration, so the cache deliberately does not destroy
+ * them from a static destructor of its own.
+ *
+ * \sa FFTWGlobalConfiguration
+ * \ingroup ITKFFT
+ */
+template< typename TPixel >
+class PlanCache
+{
+public:
+  using ProxyType = Proxy< TPixel >;
+  using PixelType = typename ProxyType::PixelType;
+  using ComplexType = typename ProxyType::ComplexType;
+  using PlanType = typename ProxyType::PlanType;
+
+  static PlanType Plan_dft_r2c(int rank,
+                               const int *n,
+                               PixelType *in,
+                               ComplexType *out,
+                               unsigned flags,
+                               int threads=1,
+                               bool canDestroyInput=false)
+  {
+    const KeyType key = MakeKey( 0, 0, rank, n, flags, threads,
+                                 ProxyType::AlignmentOf(in),
+                                 ProxyType::AlignmentOf(out) );
+    std::lock_guard< std::mutex > lock( GetMutex() );
+    auto it = GetCache().find(key);
+    if ( it != GetCache().end() )
+      {
+      return it->second;
+      }
+    PlanType plan = ProxyType::Plan_dft_r2c(rank, n, in, out, flags, threads, canDestroyInput);
+    GetCache()[key] = plan;
+    FFTWGlobalConfiguration::FlushWisdomCache();
+    return plan;
+  }
+
+  static PlanType Plan_dft_c2r(int rank,
+                               const int *n,
+                               ComplexType *in,
+                               PixelType *out,
+                               unsigned flags,
+                               int threads=1,
+                               bool canDestroyInput=false)
+  {
+    const KeyType key = MakeKey( 1, 0, rank, n, flags, threads,
+                                 ProxyType::AlignmentOf(in),
+                                 ProxyType::AlignmentOf(out) );
+    std::lock_guard< std::mutex > lock( GetMutex() );
+    auto it = GetCache().find(key);
+    if ( it != GetCache().end() )
+      {
+      return it->second;
+      }
+    PlanType plan = ProxyType::Plan_dft_c2r(rank, n, in, out, flags, threads, canDestroyInput);
+    GetCache()[key] = plan;
+    FFTWGlobalConfiguration::FlushWisdomCache();
+    return plan;
+  }
+
+  static PlanType Plan_dft(int rank,
+                           const int *n,
+                           ComplexType *in,
+                           ComplexType *out,
+                           int sign,
+                           unsigned flags,
+                           int threads=1,
+                           bool canDestroyInput=false)
+  {
+    const KeyType key = MakeKey( 2, sign, rank, n, flags, threads,
+                                 ProxyType::AlignmentOf(in),
+                                 ProxyType::AlignmentOf(out) );
+    std::lock_guard< std::mutex > lock( GetMutex() );
+    auto it = GetCache().find(key);
+    if ( it != GetCache().end() )
+      {
+      return it->second;
+      }
+    PlanType plan = ProxyType::Plan_dft(rank, n, in, out, sign, flags, threads, canDestroyInput);
+    GetCache()[key] = plan;
+    FFTWGlobalConfiguration::FlushWisdomCache();
+    return plan;
+  }
+
+  /** Destroy every cached plan. After this, buffers previously
+   * planned for must be planned for again before executing. */
+  static void Clear()
+  {
+    std::lock_guard< std::mutex > lock( GetMutex() );
+    for ( auto & entry : GetCache() )
+      {
+      ProxyType::DestroyPlan(entry.second);
+      }
+    GetCache().clear();
+  }
+
+private:
+  using KeyType = std::vector< int >;
+  using CacheType = std::map< KeyType, PlanType >;
+
+  static KeyType MakeKey(int kind, int sign, int rank, const int *n,
+                         unsigned flags, int threads,
+                         int inAlignment, int outAlignment)
+  {
+    KeyType key;
+    key.reserve(7 + rank);
+    key.push_back(kind);
+    key.push_back(sign);
+    key.push_back(static_cast< int >( flags ));
+    key.push_back(threads);
+    key.push_back(inAlignment);
+    key.push_back(outAlignment);
+    key.push_back(rank);
+    for ( int i = 0; i < rank; ++i )
+      {
+      key.push_back(n[i]);
+      }
+    return key;
+  }
+
+  static CacheType & GetCache()
+  {
+    // never deleted, so the plans stay valid until the FFTW cleanup
+    // at process exit regardless of static destruction order
+    static auto *cache = new CacheType;
+    return *cache;
+  }
+
+  static std::mutex & GetMutex()
+  {
+    static std::mutex mutex;
+    return mutex;
+  }
+};
+} // end namespace fftw
+} // end namespace itk
+
+#endif // ITK_USE_FFTWF || ITK_USE_FFTWD, !ITK_USE_CUFFTW
+#endif // itkFFTWPlanCache_h
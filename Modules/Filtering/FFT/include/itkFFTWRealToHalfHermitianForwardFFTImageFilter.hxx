@@ -19,6 +19,7 @@
 #define itkFFTWRealToHalfHermitianForwardFFTImageFilter_hxx
 
 #include "itkFFTWRealToHalfHermitianForwardFFTImageFilter.h"
+#include "itkFFTWPlanCache.h"
 #include "itkProgressReporter.h"
 #include "itkMultiThreaderBase.h"
 
@@ -95,10 +96,18 @@ FFTWRealToHalfHermitianForwardFFTImageFilter< TInputImage, TOutputImage >
     sizes[(ImageDimension - 1) - i] = inputSize[i];
     }
 
+#ifndef ITK_USE_CUFFTW
+  // reuse the plan cached for this transform shape, if any, and keep
+  // the plan for the next Update
+  plan = fftw::PlanCache< InputPixelType >::Plan_dft_r2c(ImageDimension, sizes, in, out, flags,
+                                     MultiThreaderBase::GetGlobalDefaultNumberOfThreads());
+  FFTWProxyType::Execute_dft_r2c(plan, in, out);
+#else
   plan = FFTWProxyType::Plan_dft_r2c(ImageDimension, sizes, in, out, flags,
                                      MultiThreaderBase::GetGlobalDefaultNumberOfThreads());
   FFTWProxyType::Execute(plan);
   FFTWProxyType::DestroyPlan(plan);
+#endif
 }
 
 template< typename TInputImage, typename TOutputImage >
@@ -613,6 +613,24 @@ FFTWGlobalConfiguration
   return all_succeed;
 }
 
+bool
+FFTWGlobalConfiguration
+::FlushWisdomCache()
+{
+  if ( !GetInstance()->m_WriteWisdomCache || !GetInstance()->m_NewWisdomAvailable )
+    {
+    return false;
+    }
+  // import the wisdom files again to be sure to not erase the wisdom saved in another process
+  ImportDefaultWisdomFile();
+  const bool succeeded = ExportDefaultWisdomFile();
+  if ( succeeded )
+    {
+    SetNewWisdomAvailable(false);
+    }
+  return succeeded;
+}
+
 bool
 FFTWGlobalConfiguration
 ::ImportDefaultWisdomFileFloat()
@@ -0,0 +1,140 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkFFTImageFilterFactory.h"
+#include "itkForwardFFTImageFilter.h"
+#include "itkVnlForwardFFTImageFilter.h"
+
+#include <iostream>
+
+
+// Test the object factory registration path for FFT backends using the
+// Vnl forward transform, which is always available. Registering
+// FFTImageFilterFactory< VnlForwardFFTImageFilter > must make
+// ForwardFFTImageFilter::New() resolve through the factory, and
+// unregistering it must restore the compile-time backend dispatch.
+int itkFFTImageFilterFactoryTest(int, char *[])
+{
+  using ImageF2 = itk::Image< float, 2 >;
+  using ImageCF2 = itk::Image< std::complex< float >, 2 >;
+  using ImageD3 = itk::Image< double, 3 >;
+  using ImageCD3 = itk::Image< std::complex< double >, 3 >;
+
+  using ForwardFFTFloatType = itk::ForwardFFTImageFilter< ImageF2, ImageCF2 >;
+  using ForwardFFTDoubleType = itk::ForwardFFTImageFilter< ImageD3, ImageCD3 >;
+  using VnlForwardFFTFloatType = itk::VnlForwardFFTImageFilter< ImageF2, ImageCF2 >;
+  using VnlForwardFFTDoubleType = itk::VnlForwardFFTImageFilter< ImageD3, ImageCD3 >;
+
+  using FactoryType = itk::FFTImageFilterFactory< itk::VnlForwardFFTImageFilter >;
+
+  // No FFT factory is registered at startup: the base class name must not
+  // be creatable through the factory mechanism, while New() still succeeds
+  // through the compile-time dispatch.
+  if ( !itk::ObjectFactoryBase::CreateAllInstance(
+          typeid( ForwardFFTFloatType ).name() ).empty() )
+    {
+    std::cerr << "An FFT backend factory is unexpectedly registered before "
+              << "the test registers one." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  ForwardFFTFloatType::Pointer compileTimeFilter = ForwardFFTFloatType::New();
+  if ( compileTimeFilter.IsNull() )
+    {
+    std::cerr << "Compile-time dispatch failed to create a forward FFT filter."
+              << std::endl;
+    return EXIT_FAILURE;
+    }
+  const std::string compileTimeName = compileTimeFilter->GetNameOfClass();
+
+  // Register the factory the way RegisterOneFactory() does, but keep the
+  // instance so it can be unregistered again below.
+  FactoryType::Pointer factory = FactoryType::New();
+  itk::ObjectFactoryBase::RegisterFactory( factory,
+                                           itk::ObjectFactoryBase::INSERT_AT_FRONT );
+
+  // The factory path must now produce the Vnl backend for the float and
+  // double base classes it registered overrides for.
+  std::list< itk::LightObject::Pointer > createdFloat =
+    itk::ObjectFactoryBase::CreateAllInstance( typeid( ForwardFFTFloatType ).name() );
+  if ( createdFloat.size() != 1 ||
+       dynamic_cast< VnlForwardFFTFloatType * >( createdFloat.front().GetPointer() )
+         == nullptr )
+    {
+    std::cerr << "The factory did not provide the Vnl backend for the float "
+              << "forward FFT base class." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  ForwardFFTDoubleType::Pointer doubleFilter = ForwardFFTDoubleType::New();
+  if ( dynamic_cast< VnlForwardFFTDoubleType * >( doubleFilter.GetPointer() )
+         == nullptr )
+    {
+    std::cerr << "New() did not return the Vnl backend through the factory "
+              << "for the double forward FFT base class." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // Disabling the override must make the factory path come up empty for
+  // that base class without disturbing New().
+  factory->SetEnableFlag( false,
+                          typeid( ForwardFFTFloatType ).name(),
+                          typeid( VnlForwardFFTFloatType ).name() );
+  if ( !itk::ObjectFactoryBase::CreateAllInstance(
+          typeid( ForwardFFTFloatType ).name() ).empty() )
+    {
+    std::cerr << "The factory still created an instance for an override "
+              << "whose enable flag is off." << std::endl;
+    return EXIT_FAILURE;
+    }
+  factory->SetEnableFlag( true,
+                          typeid( ForwardFFTFloatType ).name(),
+                          typeid( VnlForwardFFTFloatType ).name() );
+
+  ForwardFFTFloatType::Pointer factoryFilter = ForwardFFTFloatType::New();
+  if ( dynamic_cast< VnlForwardFFTFloatType * >( factoryFilter.GetPointer() )
+         == nullptr )
+    {
+    std::cerr << "New() did not return the Vnl backend while the factory was "
+              << "registered." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // Unregistering must restore the initial state: no factory-provided
+  // instance, and New() falling back to the compile-time backend.
+  itk::ObjectFactoryBase::UnRegisterFactory( factory );
+  if ( !itk::ObjectFactoryBase::CreateAllInstance(
+          typeid( ForwardFFTFloatType ).name() ).empty() )
+    {
+    std::cerr << "The factory path still creates instances after the factory "
+              << "was unregistered." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  ForwardFFTFloatType::Pointer fallbackFilter = ForwardFFTFloatType::New();
+  if ( fallbackFilter.IsNull() ||
+       compileTimeName != fallbackFilter->GetNameOfClass() )
+    {
+    std::cerr << "Compile-time dispatch was not restored after unregistering "
+              << "the factory." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  std::cout << "Test PASSED." << std::endl;
+  return EXIT_SUCCESS;
+}
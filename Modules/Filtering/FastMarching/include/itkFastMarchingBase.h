@@ -25,6 +25,7 @@
 
 #include <queue>
 #include <functional>
+#include <vector>
 
 namespace itk
 {
@@ -194,6 +195,25 @@ public:
   /** \brief Get the value reached by the front when it stops propagating */
   itkGetMacro( TargetReachedValue, OutputPixelType );
 
+  /** Set/Get whether trial nodes are ordered with an untidy bucket
+   * queue instead of a binary heap. Nodes are then binned into
+   * buckets of width BucketWidth and drained in bucket order, which
+   * costs constant time per operation instead of the logarithmic heap
+   * maintenance. Nodes falling into the same bucket are processed in
+   * arbitrary order, so the front values can deviate from the heap
+   * based ones by the order of the bucket width. Only meaningful for
+   * monotone (non-negative) speed functions. Default is off. */
+  itkSetMacro( UseBucketQueue, bool );
+  itkGetConstMacro( UseBucketQueue, bool );
+  itkBooleanMacro( UseBucketQueue );
+
+  /** Set/Get the width of the buckets of the untidy queue, in output
+   * value (arrival time) units. Smaller buckets reproduce the heap
+   * ordering more faithfully at the price of more buckets. Only used
+   * when UseBucketQueue is on. */
+  itkSetMacro( BucketWidth, double );
+  itkGetConstMacro( BucketWidth, double );
+
   /** Set the Collect Points flag. Instrument the algorithm to collect
   * a container of all nodes which it has visited. Useful for
   * creating Narrowbands for level set algorithms that supports
@@ -238,6 +258,29 @@ protected:
 
   PriorityQueueType m_Heap;
 
+  /** State of the untidy bucket queue, used instead of m_Heap when
+   * m_UseBucketQueue is on. Buckets are drained in increasing order;
+   * already drained buckets have their storage released. */
+  using BucketType = std::vector< NodePairType >;
+  std::vector< BucketType > m_Buckets;
+  size_t                    m_CurrentBucket;
+  IdentifierType            m_NumberOfBucketedNodes;
+
+  bool   m_UseBucketQueue;
+  double m_BucketWidth;
+
+  /** \brief Insert a trial node in the queue currently in use */
+  void PushNode( const NodePairType& iNodePair );
+
+  /** \brief Remove and return the next trial node to process */
+  NodePairType PopNode();
+
+  /** \brief Returns true if no trial node is left in the queue */
+  bool QueueIsEmpty() const;
+
+  /** \brief Release the memory held by the queue */
+  void ClearQueue();
+
   TopologyCheckType m_TopologyCheck;
 
   /** \brief Get the total number of nodes in the domain */
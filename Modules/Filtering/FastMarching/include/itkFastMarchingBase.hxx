@@ -48,6 +48,10 @@ FastMarchingBase()
   m_LargeValue = NumericTraits< OutputPixelType >::max();
   m_TopologyValue = m_LargeValue;
   m_CollectPoints = false;
+  m_CurrentBucket = 0;
+  m_NumberOfBucketedNodes = 0;
+  m_UseBucketQueue = false;
+  m_BucketWidth = 1.;
   }
 // -----------------------------------------------------------------------------
 
@@ -67,6 +71,99 @@ PrintSelf( std::ostream & os, Indent indent ) const
   os << indent << "Speed constant: " << m_SpeedConstant << std::endl;
   os << indent << "Topology check: " << m_TopologyCheck << std::endl;
   os << indent << "Normalization Factor: " << m_NormalizationFactor << std::endl;
+  os << indent << "Use Bucket Queue: "
+     << ( m_UseBucketQueue ? "On" : "Off" ) << std::endl;
+  os << indent << "Bucket Width: " << m_BucketWidth << std::endl;
+  }
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+template< typename TInput, typename TOutput >
+void
+FastMarchingBase< TInput, TOutput >::
+PushNode( const NodePairType& iNodePair )
+  {
+  if( !m_UseBucketQueue )
+    {
+    m_Heap.push( iNodePair );
+    return;
+    }
+
+  const double scaledValue =
+    static_cast< double >( iNodePair.GetValue() ) / m_BucketWidth;
+  auto bucket = ( scaledValue > 0. ) ?
+    static_cast< size_t >( scaledValue ) : 0;
+
+  // The front only moves forward; a node whose value falls into an
+  // already drained bucket is queued in the current one. This is the
+  // bounded reordering the untidy queue trades for constant time
+  // operations.
+  if( bucket < m_CurrentBucket )
+    {
+    bucket = m_CurrentBucket;
+    }
+  if( bucket >= m_Buckets.size() )
+    {
+    m_Buckets.resize( bucket + 1 );
+    }
+  m_Buckets[bucket].push_back( iNodePair );
+  ++m_NumberOfBucketedNodes;
+  }
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+template< typename TInput, typename TOutput >
+typename FastMarchingBase< TInput, TOutput >::NodePairType
+FastMarchingBase< TInput, TOutput >::
+PopNode()
+  {
+  if( !m_UseBucketQueue )
+    {
+    NodePairType nodePair = m_Heap.top();
+    m_Heap.pop();
+    return nodePair;
+    }
+
+  while( m_Buckets[m_CurrentBucket].empty() )
+    {
+    // release the storage of the drained bucket
+    BucketType().swap( m_Buckets[m_CurrentBucket] );
+    ++m_CurrentBucket;
+    }
+  NodePairType nodePair = m_Buckets[m_CurrentBucket].back();
+  m_Buckets[m_CurrentBucket].pop_back();
+  --m_NumberOfBucketedNodes;
+  return nodePair;
+  }
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+template< typename TInput, typename TOutput >
+bool
+FastMarchingBase< TInput, TOutput >::
+QueueIsEmpty() const
+  {
+  if( m_UseBucketQueue )
+    {
+    return ( m_NumberOfBucketedNodes == 0 );
+    }
+  return m_Heap.empty();
+  }
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+template< typename TInput, typename TOutput >
+void
+FastMarchingBase< TInput, TOutput >::
+ClearQueue()
+  {
+  while( !m_Heap.empty() )
+    {
+    m_Heap.pop();
+    }
+  std::vector< BucketType >().swap( m_Buckets );
+  m_CurrentBucket = 0;
+  m_NumberOfBucketedNodes = 0;
   }
 
 // -----------------------------------------------------------------------------
@@ -93,6 +190,10 @@ Initialize( OutputDomainType* oDomain )
     {
     itkExceptionMacro( <<"SpeedConstant is null or negative" );
     }
+  if( m_UseBucketQueue && m_BucketWidth < itk::Math::eps )
+    {
+    itkExceptionMacro( <<"Bucket Width is null or negative" );
+    }
   if( m_CollectPoints )
     {
     if( m_ProcessedPoints.IsNull() )
@@ -101,11 +202,8 @@ Initialize( OutputDomainType* oDomain )
       }
     }
 
-  // make sure the heap is empty
-  while ( !m_Heap.empty() )
-    {
-    m_Heap.pop();
-    }
+  // make sure the queue is empty
+  this->ClearQueue();
   /*
   while ( !m_Heap->Empty() )
     {
@@ -140,7 +238,7 @@ GenerateData()
   try
     {
     //while( !m_Heap->Empty() )
-    while( !m_Heap.empty() )
+    while( !this->QueueIsEmpty() )
       {
       //PriorityQueueElementType element = m_Heap->Peek();
       //m_Heap->Pop();
@@ -149,8 +247,7 @@ GenerateData()
       //OutputPixelType current_value = element.m_Priority;
 
 
-      NodePairType current_node_pair = m_Heap.top();
-      m_Heap.pop();
+      NodePairType current_node_pair = this->PopNode();
 
       NodeType current_node = current_node_pair.GetNode();
       current_value = this->GetOutputValue( output, current_node );
@@ -193,10 +290,7 @@ GenerateData()
     // it.
     //
     // RELEASE MEMORY!!!
-    while( !m_Heap.empty() )
-      {
-      m_Heap.pop();
-      }
+    this->ClearQueue();
     /*while( !m_Heap->Empty() )
       {
       m_Heap->Pop();
@@ -208,10 +302,7 @@ GenerateData()
   m_TargetReachedValue = current_value;
 
   // let's release some useless memory...
-  while( !m_Heap.empty() )
-    {
-    m_Heap.pop();
-    }
+  this->ClearQueue();
   /*while( !m_Heap->Empty() )
     {
     m_Heap->Pop();
@@ -218,7 +218,7 @@ UpdateValue( OutputImageType* oImage, const NodeType& iNode )
     this->SetLabelValueForGivenNode( iNode, Traits::Trial );
 
     // Insert point into trial heap
-    this->m_Heap.push( NodePairType( iNode, outputPixel ) );
+    this->PushNode( NodePairType( iNode, outputPixel ) );
     }
 }
 
@@ -602,7 +602,7 @@ InitializeOutput( OutputImageType* oImage )
         this->SetOutputValue( oImage, idx, outputPixel );
 
         //this->m_Heap->Push( PriorityQueueElementType( idx, pointsIter->second ) );
-        this->m_Heap.push( pointsIter->Value() );
+        this->PushNode( pointsIter->Value() );
         }
       ++pointsIter;
       }
@@ -0,0 +1,156 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkFastSweepingImageFilter_h
+#define itkFastSweepingImageFilter_h
+
+#include "itkFastMarchingImageFilterBase.h"
+
+#include <atomic>
+
+namespace itk
+{
+/** \class FastSweepingImageFilter
+ *
+ * \brief Solves the Eikonal equation with Gauss-Seidel sweeps instead of
+ * a priority queue.
+ *
+ * This filter computes the same arrival times as
+ * FastMarchingImageFilterBase, using the same Godunov upwind
+ * discretization, but it visits the image in a fixed set of sweep
+ * orderings instead of popping nodes from a heap in causal order. One
+ * sweep iteration traverses the image once for each of the
+ * \f$2^{Dimension}\f$ combinations of axis directions; characteristics
+ * aligned with a given ordering are resolved in that pass, so a few
+ * iterations suffice for smooth speed fields, and for a constant speed a
+ * single iteration is exact.
+ *
+ * Within each sweep the nodes of an anti-diagonal wavefront (constant
+ * sum of the traversal coordinates) depend only on the two adjacent
+ * wavefronts, because the upwind stencil reads axis neighbors only.
+ * Each wavefront is therefore updated in parallel on the global
+ * multi-threader, so the solver scales with cores where the fast
+ * marching heap is inherently serial.
+ *
+ * The filter shares the traits, the seed containers (alive, trial and
+ * forbidden points) and the output information interface of its base
+ * class. A stopping criterion must still be set and is handed the
+ * output domain, but criteria based on the order nodes become alive do
+ * not apply here: nodes are not processed causally, so the sweeps
+ * always run until the values are stable (see SetConvergenceThreshold)
+ * or MaximumNumberOfSweepIterations is reached.
+ *
+ * Topology constraints are likewise tied to the causal front of fast
+ * marching and are not supported; TopologyCheck must be left to
+ * Nothing.
+ *
+ * \sa FastMarchingImageFilterBase
+ *
+ * \ingroup ITKFastMarching
+ */
+template< typename TInput, typename TOutput >
+class ITK_TEMPLATE_EXPORT FastSweepingImageFilter:
+  public FastMarchingImageFilterBase< TInput, TOutput >
+{
+public:
+  ITK_DISALLOW_COPY_AND_ASSIGN(FastSweepingImageFilter);
+
+  /** Standard class typdedefs. */
+  using Self = FastSweepingImageFilter;
+  using Superclass = FastMarchingImageFilterBase< TInput, TOutput >;
+  using Pointer = SmartPointer< Self >;
+  using ConstPointer = SmartPointer< const Self >;
+  using Traits = typename Superclass::Traits;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(FastSweepingImageFilter,
+               FastMarchingImageFilterBase);
+
+  /** The dimension of the level set. */
+  static constexpr unsigned int ImageDimension = Superclass::ImageDimension;
+
+  using NodeType = typename Superclass::NodeType;
+  using OutputImageType = typename Superclass::OutputImageType;
+  using OutputPixelType = typename Superclass::OutputPixelType;
+  using OutputRegionType = typename Superclass::OutputRegionType;
+  using LabelImageType = typename Superclass::LabelImageType;
+
+  /** Set/Get the maximum number of sweep iterations, where one
+   * iteration performs all \f$2^{Dimension}\f$ directional sweeps.
+   * At least one iteration is always performed. */
+  itkSetClampMacro( MaximumNumberOfSweepIterations, unsigned int,
+                    1, NumericTraits< unsigned int >::max() );
+  itkGetConstMacro( MaximumNumberOfSweepIterations, unsigned int );
+
+  /** Set/Get the convergence threshold. The sweeps stop once the
+   * largest arrival time decrease over one full iteration drops to
+   * this value or below. The default of zero iterates until the
+   * values reach an exact fixed point. */
+  itkSetClampMacro( ConvergenceThreshold, double,
+                    0., NumericTraits< double >::max() );
+  itkGetConstMacro( ConvergenceThreshold, double );
+
+  /** Get the number of sweep iterations actually performed. */
+  itkGetConstMacro( ElapsedSweepIterations, unsigned int );
+
+protected:
+  FastSweepingImageFilter();
+  ~FastSweepingImageFilter() override = default;
+
+  void PrintSelf(std::ostream & os, Indent indent) const override;
+
+  void GenerateData() override;
+
+  using InternalNodeStructure = typename Superclass::InternalNodeStructure;
+  using InternalNodeStructureArray = typename Superclass::InternalNodeStructureArray;
+
+  /** Run one directional sweep given by iOrdering (one bit per
+   * dimension, set for ascending traversal), updating ioMaxChange with
+   * the largest value decrease encountered. */
+  virtual void SweepWithOrdering( OutputImageType* oImage,
+                                  unsigned int iOrdering,
+                                  std::atomic< double >& ioMaxChange );
+
+  /** Recompute the value of one node from its smallest axis neighbors
+   * and keep the minimum of the old and new values. */
+  virtual void UpdateNodeDuringSweep( OutputImageType* oImage,
+                                      const NodeType& iNode,
+                                      std::atomic< double >& ioMaxChange );
+
+  /** Find the smallest valued neighbor of iNode along each dimension,
+   * whatever its label, as long as it is not forbidden. Unvisited
+   * neighbors hold the large value and never win the minimum. */
+  void GetSweepingNodesUsed( OutputImageType* oImage,
+                             const NodeType& iNode,
+                             InternalNodeStructureArray& ioNodesUsed ) const;
+
+private:
+  unsigned int m_MaximumNumberOfSweepIterations;
+  double       m_ConvergenceThreshold;
+  unsigned int m_ElapsedSweepIterations;
+};
+
+}
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#include "itkFastSweepingImageFilter.hxx"
+#endif
+
+#endif // itkFastSweepingImageFilter_h
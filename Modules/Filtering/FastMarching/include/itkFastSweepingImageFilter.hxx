@@ -0,0 +1,280 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#ifndef itkFastSweepingImageFilter_hxx
+#define itkFastSweepingImageFilter_hxx
+
+#include "itkFastSweepingImageFilter.h"
+
+#include "itkImageRegionIterator.h"
+#include "itkMultiThreaderBase.h"
+
+namespace itk
+{
+template< typename TInput, typename TOutput >
+FastSweepingImageFilter< TInput, TOutput >::
+FastSweepingImageFilter() :
+  m_MaximumNumberOfSweepIterations( 10 ),
+  m_ConvergenceThreshold( 0. ),
+  m_ElapsedSweepIterations( 0 )
+{}
+
+template< typename TInput, typename TOutput >
+void
+FastSweepingImageFilter< TInput, TOutput >::
+PrintSelf( std::ostream & os, Indent indent ) const
+{
+  Superclass::PrintSelf( os, indent );
+  os << indent << "MaximumNumberOfSweepIterations: "
+     << m_MaximumNumberOfSweepIterations << std::endl;
+  os << indent << "ConvergenceThreshold: "
+     << m_ConvergenceThreshold << std::endl;
+  os << indent << "ElapsedSweepIterations: "
+     << m_ElapsedSweepIterations << std::endl;
+}
+
+template< typename TInput, typename TOutput >
+void
+FastSweepingImageFilter< TInput, TOutput >::
+GenerateData()
+{
+  if( this->m_TopologyCheck != Superclass::Nothing )
+    {
+    itkExceptionMacro(
+      <<"Topology checking requires the causal ordering of fast marching; "
+      <<"use FastMarchingImageFilterBase instead" );
+    }
+
+  OutputImageType* output = this->GetOutput();
+
+  // Validates the inputs, allocates the output and the label image, and
+  // places the alive, trial and forbidden seeds.
+  this->Initialize( output );
+
+  // The seeds were pushed onto the priority queue, which sweeping never
+  // consumes.
+  this->ClearQueue();
+
+  constexpr unsigned int numberOfOrderings = 1 << ImageDimension;
+
+  m_ElapsedSweepIterations = 0;
+
+  while( m_ElapsedSweepIterations < m_MaximumNumberOfSweepIterations )
+    {
+    std::atomic< double > maxChange( 0. );
+
+    for( unsigned int ordering = 0; ordering < numberOfOrderings; ++ordering )
+      {
+      this->SweepWithOrdering( output, ordering, maxChange );
+      }
+
+    ++m_ElapsedSweepIterations;
+
+    this->UpdateProgress( static_cast< float >( m_ElapsedSweepIterations ) /
+                          static_cast< float >( m_MaximumNumberOfSweepIterations ) );
+
+    if( maxChange.load() <= m_ConvergenceThreshold )
+      {
+      break;
+      }
+    }
+
+  // Nodes updated during the sweeps carry the Trial label; once the
+  // values are stable they are final, as are the initial trial seeds.
+  ImageRegionIterator< LabelImageType > labelIt( this->m_LabelImage,
+                                                 this->m_BufferedRegion );
+  labelIt.GoToBegin();
+  while( !labelIt.IsAtEnd() )
+    {
+    if( labelIt.Get() == Traits::Trial ||
+        labelIt.Get() == Traits::InitialTrial )
+      {
+      labelIt.Set( Traits::Alive );
+      }
+    ++labelIt;
+    }
+
+  this->UpdateProgress( 1.0 );
+}
+
+template< typename TInput, typename TOutput >
+void
+FastSweepingImageFilter< TInput, TOutput >::
+SweepWithOrdering( OutputImageType* oImage,
+                   unsigned int iOrdering,
+                   std::atomic< double >& ioMaxChange )
+{
+  const NodeType startIndex = this->m_StartIndex;
+  const NodeType lastIndex = this->m_LastIndex;
+
+  typename OutputRegionType::SizeType size = this->m_BufferedRegion.GetSize();
+
+  // Number of nodes in one hyperplane spanned by dimensions 1..N-1; the
+  // remaining coordinate is determined by the wavefront level.
+  SizeValueType slabSize = 1;
+  IndexValueType maximumLevel = 0;
+
+  for( unsigned int dim = 0; dim < ImageDimension; ++dim )
+    {
+    if( dim > 0 )
+      {
+      slabSize *= static_cast< SizeValueType >( size[dim] );
+      }
+    maximumLevel += static_cast< IndexValueType >( size[dim] ) - 1;
+    }
+
+  MultiThreaderBase* threader = this->GetMultiThreader();
+
+  for( IndexValueType level = 0; level <= maximumLevel; ++level )
+    {
+    threader->ParallelizeArray( 0, slabSize,
+      [this, oImage, &ioMaxChange, &startIndex, &lastIndex, &size,
+       iOrdering, level]( SizeValueType slabIndex )
+        {
+        // Decode the traversal coordinates of dimensions 1..N-1 and
+        // deduce the first one from the wavefront level.
+        NodeType node;
+
+        IndexValueType levelRemainder = level;
+        SizeValueType remainder = slabIndex;
+
+        for( unsigned int dim = 1; dim < ImageDimension; ++dim )
+          {
+          const auto coordinate =
+            static_cast< IndexValueType >( remainder % size[dim] );
+          remainder /= size[dim];
+
+          levelRemainder -= coordinate;
+
+          // Traversal coordinates count from the sweep entry corner.
+          node[dim] = ( iOrdering & ( 1 << dim ) ) ?
+            startIndex[dim] + coordinate : lastIndex[dim] - coordinate;
+          }
+
+        if( ( levelRemainder < 0 ) ||
+            ( levelRemainder >= static_cast< IndexValueType >( size[0] ) ) )
+          {
+          return;
+          }
+
+        node[0] = ( iOrdering & 1 ) ?
+          startIndex[0] + levelRemainder : lastIndex[0] - levelRemainder;
+
+        this->UpdateNodeDuringSweep( oImage, node, ioMaxChange );
+        },
+      nullptr );
+    }
+}
+
+template< typename TInput, typename TOutput >
+void
+FastSweepingImageFilter< TInput, TOutput >::
+UpdateNodeDuringSweep( OutputImageType* oImage,
+                       const NodeType& iNode,
+                       std::atomic< double >& ioMaxChange )
+{
+  const unsigned char label = this->GetLabelValueForGivenNode( iNode );
+
+  // Alive seeds keep their prescribed values; forbidden nodes are
+  // never visited.
+  if( ( label == Traits::Alive ) || ( label == Traits::Forbidden ) )
+    {
+    return;
+    }
+
+  InternalNodeStructureArray nodesUsed;
+  this->GetSweepingNodesUsed( oImage, iNode, nodesUsed );
+
+  auto outputPixel =
+    static_cast< OutputPixelType >( this->Solve( oImage, iNode, nodesUsed ) );
+
+  const OutputPixelType currentValue = this->GetOutputValue( oImage, iNode );
+
+  if( outputPixel < currentValue )
+    {
+    this->SetOutputValue( oImage, iNode, outputPixel );
+
+    if( label == Traits::Far )
+      {
+      this->SetLabelValueForGivenNode( iNode, Traits::Trial );
+      }
+
+    const double change =
+      static_cast< double >( currentValue ) - static_cast< double >( outputPixel );
+
+    // Keep the largest decrease seen so far; concurrent wavefront nodes
+    // race benignly through the compare-and-swap.
+    double observed = ioMaxChange.load();
+    while( change > observed &&
+           !ioMaxChange.compare_exchange_weak( observed, change ) )
+      {}
+    }
+}
+
+template< typename TInput, typename TOutput >
+void
+FastSweepingImageFilter< TInput, TOutput >::
+GetSweepingNodesUsed( OutputImageType* oImage,
+                      const NodeType& iNode,
+                      InternalNodeStructureArray& ioNodesUsed ) const
+{
+  NodeType neighborNode = iNode;
+
+  // Unlike GetInternalNodesUsed(), any non forbidden neighbor
+  // qualifies: unvisited nodes hold the large value, so they cannot
+  // become the minimum along their dimension.
+  for( unsigned int j = 0; j < ImageDimension; ++j )
+    {
+    InternalNodeStructure tempNode;
+    tempNode.m_Node = iNode;
+    tempNode.m_Value = this->m_LargeValue;
+
+    const typename NodeType::IndexValueType v = iNode[j];
+
+    for( int s = -1; s < 2; s = s + 2 )
+      {
+      const typename NodeType::IndexValueType temp = v + s;
+
+      if( ( temp <= this->m_LastIndex[j] ) && ( temp >= this->m_StartIndex[j] ) )
+        {
+        neighborNode[j] = temp;
+
+        if( this->GetLabelValueForGivenNode( neighborNode ) != Traits::Forbidden )
+          {
+          const OutputPixelType neighValue =
+            this->GetOutputValue( oImage, neighborNode );
+
+          if( tempNode.m_Value > neighValue )
+            {
+            tempNode.m_Value = neighValue;
+            tempNode.m_Node = neighborNode;
+            }
+          }
+        }
+      }
+
+    tempNode.m_Axis = j;
+    ioNodesUsed[j] = tempNode;
+
+    neighborNode[j] = v;
+    }
+}
+
+}
+
+#endif // itkFastSweepingImageFilter_hxx
@@ -0,0 +1,151 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkFastMarchingImageFilterBase.h"
+#include "itkFastMarchingThresholdStoppingCriterion.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkMath.h"
+
+int itkFastMarchingImageFilterBucketQueueTest(int, char* [] )
+{
+  using PixelType = float;
+  constexpr unsigned int Dimension = 2;
+
+  using FloatImageType = itk::Image< PixelType, Dimension >;
+
+  using CriterionType =
+      itk::FastMarchingThresholdStoppingCriterion< FloatImageType, FloatImageType >;
+
+  using FastMarchingType =
+      itk::FastMarchingImageFilterBase< FloatImageType, FloatImageType >;
+
+  using NodePairType = FastMarchingType::NodePairType;
+  using NodePairContainerType = FastMarchingType::NodePairContainerType;
+
+  // constant unit speed image
+  FloatImageType::SizeType size;
+  size.Fill( 64 );
+
+  FloatImageType::RegionType region;
+  region.SetSize( size );
+
+  FloatImageType::Pointer speedImage = FloatImageType::New();
+  speedImage->SetRegions( region );
+  speedImage->Allocate();
+  speedImage->FillBuffer( 1.0 );
+
+  // one seed in the middle of the image
+  itk::Index< Dimension > seedIndex;
+  seedIndex.Fill( 32 );
+
+  auto runFastMarching = [&] ( bool useBucketQueue )
+    -> FloatImageType::Pointer
+    {
+    CriterionType::Pointer criterion = CriterionType::New();
+    criterion->SetThreshold( 100. );
+
+    NodePairContainerType::Pointer trial = NodePairContainerType::New();
+    trial->push_back( NodePairType( seedIndex, 0. ) );
+
+    FastMarchingType::Pointer marcher = FastMarchingType::New();
+    marcher->SetInput( speedImage );
+    marcher->SetStoppingCriterion( criterion );
+    marcher->SetTrialPoints( trial );
+    if ( useBucketQueue )
+      {
+      marcher->UseBucketQueueOn();
+      marcher->SetBucketWidth( 0.05 );
+      }
+    marcher->Update();
+
+    FloatImageType::Pointer output = marcher->GetOutput();
+    output->DisconnectPipeline();
+    return output;
+    };
+
+  FloatImageType::Pointer heapOutput = runFastMarching( false );
+  FloatImageType::Pointer bucketOutput = runFastMarching( true );
+
+  // The bucket queue may process nodes binned in the same bucket in a
+  // different order than the heap, so the arrival times can deviate by
+  // the order of the bucket width.
+  constexpr double tolerance = 0.5;
+  double maximumDifference = 0.;
+
+  itk::ImageRegionConstIterator< FloatImageType > heapIt( heapOutput, region );
+  itk::ImageRegionConstIterator< FloatImageType > bucketIt( bucketOutput, region );
+  while ( !heapIt.IsAtEnd() )
+    {
+    const double difference =
+      itk::Math::abs( static_cast< double >( heapIt.Value() )
+                      - static_cast< double >( bucketIt.Value() ) );
+    maximumDifference = std::max( maximumDifference, difference );
+    ++heapIt;
+    ++bucketIt;
+    }
+
+  std::cout << "Maximum arrival time difference: " << maximumDifference
+            << std::endl;
+  if ( maximumDifference > tolerance )
+    {
+    std::cerr << "The bucket queue output deviates too much from the heap "
+              << "output." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // sanity check: the front did propagate
+  itk::Index< Dimension > probeIndex;
+  probeIndex.Fill( 2 );
+  if ( bucketOutput->GetPixel( probeIndex ) < 30. )
+    {
+    std::cerr << "Unexpected arrival time at " << probeIndex << ": "
+              << bucketOutput->GetPixel( probeIndex ) << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // an invalid bucket width must be rejected
+  bool exceptionCaught = false;
+  try
+    {
+    CriterionType::Pointer criterion = CriterionType::New();
+    criterion->SetThreshold( 100. );
+
+    NodePairContainerType::Pointer trial = NodePairContainerType::New();
+    trial->push_back( NodePairType( seedIndex, 0. ) );
+
+    FastMarchingType::Pointer marcher = FastMarchingType::New();
+    marcher->SetInput( speedImage );
+    marcher->SetStoppingCriterion( criterion );
+    marcher->SetTrialPoints( trial );
+    marcher->UseBucketQueueOn();
+    marcher->SetBucketWidth( 0. );
+    marcher->Update();
+    }
+  catch( itk::ExceptionObject & )
+    {
+    exceptionCaught = true;
+    }
+  if ( !exceptionCaught )
+    {
+    std::cerr << "A null bucket width was not rejected." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  std::cout << "Test passed." << std::endl;
+  return EXIT_SUCCESS;
+}
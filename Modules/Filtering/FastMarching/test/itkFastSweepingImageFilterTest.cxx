@@ -0,0 +1,149 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkFastSweepingImageFilter.h"
+#include "itkFastMarchingThresholdStoppingCriterion.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkMath.h"
+
+int itkFastSweepingImageFilterTest(int, char* [] )
+{
+  using PixelType = float;
+  constexpr unsigned int Dimension = 2;
+
+  using FloatImageType = itk::Image< PixelType, Dimension >;
+
+  using CriterionType =
+      itk::FastMarchingThresholdStoppingCriterion< FloatImageType, FloatImageType >;
+
+  using FastMarchingType =
+      itk::FastMarchingImageFilterBase< FloatImageType, FloatImageType >;
+  using FastSweepingType =
+      itk::FastSweepingImageFilter< FloatImageType, FloatImageType >;
+
+  using NodePairType = FastMarchingType::NodePairType;
+  using NodePairContainerType = FastMarchingType::NodePairContainerType;
+
+  // constant unit speed image
+  FloatImageType::SizeType size;
+  size.Fill( 64 );
+
+  FloatImageType::RegionType region;
+  region.SetSize( size );
+
+  FloatImageType::Pointer speedImage = FloatImageType::New();
+  speedImage->SetRegions( region );
+  speedImage->Allocate();
+  speedImage->FillBuffer( 1.0 );
+
+  // one seed in the middle of the image
+  itk::Index< Dimension > seedIndex;
+  seedIndex.Fill( 32 );
+
+  CriterionType::Pointer criterion = CriterionType::New();
+  criterion->SetThreshold( 100. );
+
+  NodePairContainerType::Pointer trial = NodePairContainerType::New();
+  trial->push_back( NodePairType( seedIndex, 0. ) );
+
+  FastMarchingType::Pointer marcher = FastMarchingType::New();
+  marcher->SetInput( speedImage );
+  marcher->SetStoppingCriterion( criterion );
+  marcher->SetTrialPoints( trial );
+  marcher->Update();
+
+  FastSweepingType::Pointer sweeper = FastSweepingType::New();
+  sweeper->SetInput( speedImage );
+  sweeper->SetStoppingCriterion( criterion );
+  sweeper->SetTrialPoints( trial );
+  sweeper->Update();
+
+  std::cout << "Elapsed sweep iterations: "
+            << sweeper->GetElapsedSweepIterations() << std::endl;
+  if ( sweeper->GetElapsedSweepIterations() < 1 ||
+       sweeper->GetElapsedSweepIterations()
+         > sweeper->GetMaximumNumberOfSweepIterations() )
+    {
+    std::cerr << "Unexpected number of sweep iterations." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // Both solvers converge to the fixed point of the same upwind
+  // discretization, so the arrival times should agree to rounding.
+  constexpr double tolerance = 1e-3;
+  double maximumDifference = 0.;
+
+  itk::ImageRegionConstIterator< FloatImageType >
+    marcherIt( marcher->GetOutput(), region );
+  itk::ImageRegionConstIterator< FloatImageType >
+    sweeperIt( sweeper->GetOutput(), region );
+  while ( !marcherIt.IsAtEnd() )
+    {
+    const double difference =
+      itk::Math::abs( static_cast< double >( marcherIt.Value() )
+                      - static_cast< double >( sweeperIt.Value() ) );
+    maximumDifference = std::max( maximumDifference, difference );
+    ++marcherIt;
+    ++sweeperIt;
+    }
+
+  std::cout << "Maximum arrival time difference: " << maximumDifference
+            << std::endl;
+  if ( maximumDifference > tolerance )
+    {
+    std::cerr << "The fast sweeping output deviates too much from the fast "
+              << "marching output." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // the seed must keep its prescribed value
+  if ( itk::Math::NotAlmostEquals( sweeper->GetOutput()->GetPixel( seedIndex ),
+                                   0.f ) )
+    {
+    std::cerr << "The seed value was modified: "
+              << sweeper->GetOutput()->GetPixel( seedIndex ) << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // forbidden points must not be swept over
+  itk::Index< Dimension > forbiddenIndex;
+  forbiddenIndex[0] = 10;
+  forbiddenIndex[1] = 32;
+
+  NodePairContainerType::Pointer forbidden = NodePairContainerType::New();
+  forbidden->push_back( NodePairType( forbiddenIndex, 0. ) );
+
+  FastSweepingType::Pointer blockedSweeper = FastSweepingType::New();
+  blockedSweeper->SetInput( speedImage );
+  blockedSweeper->SetStoppingCriterion( criterion );
+  blockedSweeper->SetTrialPoints( trial );
+  blockedSweeper->SetForbiddenPoints( forbidden );
+  blockedSweeper->Update();
+
+  if ( itk::Math::NotAlmostEquals(
+         blockedSweeper->GetOutput()->GetPixel( forbiddenIndex ), 0.f ) )
+    {
+    std::cerr << "The forbidden point was updated: "
+              << blockedSweeper->GetOutput()->GetPixel( forbiddenIndex )
+              << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  std::cout << "Test passed." << std::endl;
+  return EXIT_SUCCESS;
+}
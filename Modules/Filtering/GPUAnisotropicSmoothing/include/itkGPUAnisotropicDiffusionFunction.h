@@ -144,10 +144,12 @@ protected:
 
   // GPU buffer for Computing Average Squared Gradient Magnitude
   typename GPUDataManager::Pointer   m_AnisotropicDiffusionFunctionGPUBuffer;
+  typename GPUDataManager::Pointer   m_AnisotropicDiffusionFunctionResultGPUBuffer;
   typename GPUKernelManager::Pointer m_AnisotropicDiffusionFunctionGPUKernelManager;
 
   // GPU Kernel Handles
   int m_AverageGradientMagnitudeSquaredGPUKernelHandle;
+  int m_AverageGradientMagnitudeSquaredFinalSumGPUKernelHandle;
 
 private:
   double       m_AverageGradientMagnitudeSquared;
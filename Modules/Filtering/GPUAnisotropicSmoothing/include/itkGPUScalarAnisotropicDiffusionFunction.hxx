@@ -32,8 +32,15 @@ GPUScalarAnisotropicDiffusionFunction< TImage >
 ::GPUScalarAnisotropicDiffusionFunction()
 {
   this->m_AnisotropicDiffusionFunctionGPUBuffer = GPUDataManager::New();
+  this->m_AnisotropicDiffusionFunctionResultGPUBuffer = GPUDataManager::New();
   this->m_AnisotropicDiffusionFunctionGPUKernelManager = GPUKernelManager::New();
 
+  // Device-resident result of the final reduction stage; only this single
+  // float is read back to the host per conductance update
+  this->m_AnisotropicDiffusionFunctionResultGPUBuffer->Initialize();
+  this->m_AnisotropicDiffusionFunctionResultGPUBuffer->SetBufferSize( sizeof(float) );
+  this->m_AnisotropicDiffusionFunctionResultGPUBuffer->Allocate();
+
   // load GPU kernel
   std::ostringstream defines;
 
@@ -53,9 +60,11 @@ GPUScalarAnisotropicDiffusionFunction< TImage >
   // load and build program
   this->m_AnisotropicDiffusionFunctionGPUKernelManager->LoadProgramFromString( GPUSource, defines.str().c_str() );
 
-  // create kernel
+  // create kernels
   this->m_AverageGradientMagnitudeSquaredGPUKernelHandle =
     this->m_AnisotropicDiffusionFunctionGPUKernelManager->CreateKernel("AverageGradientMagnitudeSquared");
+  this->m_AverageGradientMagnitudeSquaredFinalSumGPUKernelHandle =
+    this->m_AnisotropicDiffusionFunctionGPUKernelManager->CreateKernel("AverageGradientMagnitudeSquaredFinalSum");
 }
 
 template< typename TImage >
@@ -150,28 +159,37 @@ GPUScalarAnisotropicDiffusionFunction< TImage >
   // launch kernel
   kernelManager->LaunchKernel(kernelHandle, ImageDim, globalSize, localSize );
 
-  // Read back intermediate sums from GPU and compute final value
-  double sum = 0;
-  float *intermSum = new float[bufferSize];
-
-  this->m_AnisotropicDiffusionFunctionGPUBuffer->SetCPUBufferPointer( intermSum );
-  this->m_AnisotropicDiffusionFunctionGPUBuffer->SetCPUDirtyFlag( true );   //
-                                                                            // CPU
-                                                                            // is
-                                                                            // dirty
-  this->m_AnisotropicDiffusionFunctionGPUBuffer->SetGPUDirtyFlag( false );
-  this->m_AnisotropicDiffusionFunctionGPUBuffer->UpdateCPUBuffer();   //
-                                                                            // Copy
-                                                                            // GPU->CPU
-
-  for(int i=0; i<(int)bufferSize; i++)
-    {
-    sum += (double)intermSum[i];
-    }
+  // Second reduction stage : collapse the per-workgroup partial sums into
+  // the average on the device, so the host reads back a single float
+  // instead of the whole partial sum buffer
+  int kernelHandleFinalSum = this->m_AverageGradientMagnitudeSquaredFinalSumGPUKernelHandle;
+
+  unsigned int finalSumBlockSize = OpenCLGetLocalBlockSize(1);
+  size_t       finalSumLocalSize[1], finalSumGlobalSize[1];
+  finalSumLocalSize[0] = finalSumBlockSize;
+  finalSumGlobalSize[0] = finalSumBlockSize;   // single workgroup
+
+  int signedBufferSize = (int)bufferSize;
+  int signedNumPixel = (int)numPixel;
+
+  argidx = 0;
+  kernelManager->SetKernelArgWithImage(kernelHandleFinalSum, argidx++, this->m_AnisotropicDiffusionFunctionGPUBuffer);
+  kernelManager->SetKernelArgWithImage(kernelHandleFinalSum, argidx++, this->m_AnisotropicDiffusionFunctionResultGPUBuffer);
+  kernelManager->SetKernelArg(kernelHandleFinalSum, argidx++, sizeof(float) * finalSumBlockSize, nullptr);
+  kernelManager->SetKernelArg(kernelHandleFinalSum, argidx++, sizeof(int), &signedBufferSize);
+  kernelManager->SetKernelArg(kernelHandleFinalSum, argidx++, sizeof(int), &signedNumPixel);
+
+  kernelManager->LaunchKernel(kernelHandleFinalSum, 1, finalSumGlobalSize, finalSumLocalSize );
+
+  // Read back the average from GPU
+  float average = 0;
 
-  this->SetAverageGradientMagnitudeSquared( (double)( sum / (double)numPixel ) );
+  this->m_AnisotropicDiffusionFunctionResultGPUBuffer->SetCPUBufferPointer( &average );
+  this->m_AnisotropicDiffusionFunctionResultGPUBuffer->SetCPUDirtyFlag( true );   // CPU is dirty
+  this->m_AnisotropicDiffusionFunctionResultGPUBuffer->SetGPUDirtyFlag( false );
+  this->m_AnisotropicDiffusionFunctionResultGPUBuffer->UpdateCPUBuffer();   // Copy GPU->CPU
 
-  delete[] intermSum;
+  this->SetAverageGradientMagnitudeSquared( (double)average );
 }
 
 } // end namespace itk
@@ -369,3 +369,43 @@ __kernel void AverageGradientMagnitudeSquared(__global const INPIXELTYPE *in, __
   }
 }
 #endif
+
+//
+// Second reduction stage: collapse the per-workgroup partial sums into the
+// average on the device so that the host only reads back a single float.
+// Launched as one workgroup; sm needs to be of size = sizeof(float) * get_local_size(0)
+//
+__kernel void AverageGradientMagnitudeSquaredFinalSum(__global const BUFPIXELTYPE *buf, __global BUFPIXELTYPE *avg,
+                                                      local float* sm, int bufferSize, int numPixel)
+{
+  int lix = get_local_id(0);
+  int lwidth = get_local_size(0);
+
+  // strided accumulation over the partial sum buffer
+  float sum = 0;
+  for(int i = lix; i < bufferSize; i += lwidth)
+  {
+    sum += buf[i];
+  }
+  sm[lix] = sum;
+
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  // tree reduction on shared memory
+  int interval = lwidth/2;
+  while(interval > 0)
+  {
+    if(lix < interval)
+    {
+      sm[lix] += sm[lix + interval];
+    }
+    interval = interval >> 1; // divide by 2
+
+    barrier(CLK_LOCAL_MEM_FENCE);
+  }
+
+  if(lix == 0)
+  {
+    avg[0] = sm[0] / (float)numPixel;
+  }
+}
@@ -0,0 +1,124 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkGPUResampleImageFilter_h
+#define itkGPUResampleImageFilter_h
+
+#include "itkResampleImageFilter.h"
+#include "itkGPUImage.h"
+#include "itkGPUImageToImageFilter.h"
+#include "itkGPUKernelManager.h"
+#include "itkOpenCLUtil.h"
+
+namespace itk
+{
+/** Create a helper GPU Kernel class for GPUResampleImageFilter */
+itkGPUKernelClassMacro(GPUResampleImageFilterKernel);
+
+/** \class GPUResampleImageFilter
+ * \brief GPU version of ResampleImageFilter.
+ *
+ * Resamples the image on the device with linear interpolation for the
+ * transform types a kernel can evaluate in closed form:
+ *
+ * - identity, translation and matrix-offset (affine family) transforms
+ *   are composed with the image index/physical mappings on the host
+ *   into a single affine map per output pixel;
+ * - displacement field transforms whose field is a GPUImage are
+ *   evaluated by sampling the field on the device, so registration
+ *   loops can keep the field resident on the GPU.
+ *
+ * Any other configuration (B-spline or other interpolators, an
+ * extrapolator, composite or nonlinear parametric transforms, CPU
+ * displacement fields, non-scalar pixels) transparently falls back to
+ * the CPU superclass. Interpolation uses buffer loads as in the other
+ * GPU modules since the GPU data managers do not expose OpenCL image
+ * objects or samplers.
+ *
+ * \ingroup ITKGPUImageGrid
+ */
+template< typename TInputImage, typename TOutputImage,
+          typename TInterpolatorPrecisionType = double,
+          typename TTransformPrecisionType = TInterpolatorPrecisionType >
+class ITK_TEMPLATE_EXPORT GPUResampleImageFilter :
+  public GPUImageToImageFilter< TInputImage, TOutputImage,
+                                ResampleImageFilter< TInputImage, TOutputImage,
+                                                     TInterpolatorPrecisionType,
+                                                     TTransformPrecisionType > >
+{
+public:
+  ITK_DISALLOW_COPY_AND_ASSIGN(GPUResampleImageFilter);
+
+  /** Standard class type aliases. */
+  using Self = GPUResampleImageFilter;
+  using CPUSuperclass = ResampleImageFilter< TInputImage, TOutputImage,
+                                             TInterpolatorPrecisionType,
+                                             TTransformPrecisionType >;
+  using GPUSuperclass = GPUImageToImageFilter< TInputImage, TOutputImage, CPUSuperclass >;
+  using Pointer = SmartPointer< Self >;
+  using ConstPointer = SmartPointer< const Self >;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(GPUResampleImageFilter, GPUImageToImageFilter);
+
+  /** Some convenient type alias. */
+  using InputImageType = TInputImage;
+  using OutputImageType = TOutputImage;
+  using InputPixelType = typename TInputImage::PixelType;
+  using OutputPixelType = typename TOutputImage::PixelType;
+  using TransformType = typename CPUSuperclass::TransformType;
+  using InterpolatorType = typename CPUSuperclass::InterpolatorType;
+
+  /** ImageDimension constants */
+  static constexpr unsigned int ImageDimension = TOutputImage::ImageDimension;
+  static constexpr unsigned int InputImageDimension = TInputImage::ImageDimension;
+
+  /** Get OpenCL Kernel source as a string, creates a GetOpenCLSource method */
+  itkGetOpenCLSourceFromKernelMacro(GPUResampleImageFilterKernel);
+
+protected:
+  GPUResampleImageFilter();
+  ~GPUResampleImageFilter() override {}
+
+  void PrintSelf(std::ostream & os, Indent indent) const override;
+
+  void GPUGenerateData() override;
+
+  /** Decide whether the current transform/interpolator configuration
+   * can run on the device. */
+  bool IsGPUResampleSupported() const;
+
+  /** Compile the resampling kernels for the pixel types of this
+   * instantiation. */
+  void BuildResampleKernels();
+
+private:
+  int  m_AffineKernelHandle{ 0 };
+  int  m_FieldKernelHandle{ 0 };
+  bool m_ResampleKernelsBuilt{ false };
+};
+
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#include "itkGPUResampleImageFilter.hxx"
+#endif
+
+#endif
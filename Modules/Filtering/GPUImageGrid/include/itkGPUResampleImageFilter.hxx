@@ -0,0 +1,433 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkGPUResampleImageFilter_hxx
+#define itkGPUResampleImageFilter_hxx
+
+#include "itkGPUResampleImageFilter.h"
+
+#include "itkDisplacementFieldTransform.h"
+#include "itkIdentityTransform.h"
+#include "itkLinearInterpolateImageFunction.h"
+#include "itkMatrixOffsetTransformBase.h"
+#include "itkTranslationTransform.h"
+
+#include <vector>
+
+namespace itk
+{
+
+template< typename TInputImage, typename TOutputImage,
+          typename TInterpolatorPrecisionType, typename TTransformPrecisionType >
+GPUResampleImageFilter< TInputImage, TOutputImage, TInterpolatorPrecisionType, TTransformPrecisionType >
+::GPUResampleImageFilter()
+{
+  if(TInputImage::ImageDimension > 3 || TInputImage::ImageDimension != TOutputImage::ImageDimension)
+    {
+    itkExceptionMacro("GPUResampleImageFilter supports 1/2/3D images of equal dimension.");
+    }
+}
+
+template< typename TInputImage, typename TOutputImage,
+          typename TInterpolatorPrecisionType, typename TTransformPrecisionType >
+bool
+GPUResampleImageFilter< TInputImage, TOutputImage, TInterpolatorPrecisionType, TTransformPrecisionType >
+::IsGPUResampleSupported() const
+{
+  const auto * linearInterpolator =
+    dynamic_cast< const LinearInterpolateImageFunction< TInputImage, TInterpolatorPrecisionType > * >(
+      this->GetInterpolator() );
+  if ( linearInterpolator == nullptr )
+    {
+    return false;
+    }
+
+  if ( this->GetExtrapolator() != nullptr )
+    {
+    return false;
+    }
+
+  std::vector<std::string> validTypes;
+  validTypes.push_back( "unsigned char" );
+  validTypes.push_back( "unsigned short" );
+  validTypes.push_back( "char" );
+  validTypes.push_back( "int" );
+  validTypes.push_back( "unsigned int" );
+  validTypes.push_back( "float" );
+  validTypes.push_back( "double" );
+
+  std::string typeName;
+  if( !GetValidTypename(typeid( InputPixelType ), validTypes, typeName)
+      || !GetValidTypename(typeid( OutputPixelType ), validTypes, typeName) )
+    {
+    return false;
+    }
+
+  return true;
+}
+
+template< typename TInputImage, typename TOutputImage,
+          typename TInterpolatorPrecisionType, typename TTransformPrecisionType >
+void
+GPUResampleImageFilter< TInputImage, TOutputImage, TInterpolatorPrecisionType, TTransformPrecisionType >
+::BuildResampleKernels()
+{
+  std::ostringstream defines;
+
+  defines << "#define DIM_" << int(ImageDimension) << "\n";
+
+  defines << "#define INPIXELTYPE ";
+  GetTypenameInString( typeid ( InputPixelType ), defines );
+  defines << "#define OUTPIXELTYPE ";
+  GetTypenameInString( typeid ( OutputPixelType ), defines );
+  defines << "#define FIELDPIXELTYPE ";
+  GetTypenameInString( typeid ( TTransformPrecisionType ), defines );
+
+  const char* GPUSource = GPUResampleImageFilter::GetOpenCLSource();
+
+  // load and build program
+  if( !this->m_GPUKernelManager->LoadProgramFromString( GPUSource, defines.str().c_str() ) )
+    {
+    itkExceptionMacro("Failed to build the GPU resampling kernels.");
+    }
+
+  // create kernels
+  m_AffineKernelHandle = this->m_GPUKernelManager->CreateKernel("ResampleAffineLinear");
+  m_FieldKernelHandle = this->m_GPUKernelManager->CreateKernel("ResampleDisplacementFieldLinear");
+
+  m_ResampleKernelsBuilt = true;
+}
+
+template< typename TInputImage, typename TOutputImage,
+          typename TInterpolatorPrecisionType, typename TTransformPrecisionType >
+void
+GPUResampleImageFilter< TInputImage, TOutputImage, TInterpolatorPrecisionType, TTransformPrecisionType >
+::GPUGenerateData()
+{
+  using GPUInputImage = typename itk::GPUTraits< TInputImage >::Type;
+  using GPUOutputImage = typename itk::GPUTraits< TOutputImage >::Type;
+
+  using IdentityTransformType = IdentityTransform< TTransformPrecisionType, ImageDimension >;
+  using TranslationTransformType = TranslationTransform< TTransformPrecisionType, ImageDimension >;
+  using MatrixTransformType = MatrixOffsetTransformBase< TTransformPrecisionType, ImageDimension, ImageDimension >;
+  using DisplacementFieldTransformType = DisplacementFieldTransform< TTransformPrecisionType, ImageDimension >;
+  using FieldType = typename DisplacementFieldTransformType::DisplacementFieldType;
+  using GPUFieldType = GPUImage< typename FieldType::PixelType, ImageDimension >;
+
+  typename GPUInputImage::Pointer  inPtr = dynamic_cast< GPUInputImage * >( this->ProcessObject::GetInput(0) );
+  typename GPUOutputImage::Pointer otPtr = dynamic_cast< GPUOutputImage * >( this->ProcessObject::GetOutput(0) );
+
+  const TransformType * transform = this->GetTransform();
+
+  const auto * matrixTransform = dynamic_cast< const MatrixTransformType * >( transform );
+  const auto * translationTransform = dynamic_cast< const TranslationTransformType * >( transform );
+  const auto * identityTransform = dynamic_cast< const IdentityTransformType * >( transform );
+  const auto * fieldTransform = dynamic_cast< const DisplacementFieldTransformType * >( transform );
+
+  GPUFieldType * gpuField = nullptr;
+  if( fieldTransform != nullptr )
+    {
+    // the field has to live in a GPU image to be sampled on the device
+    auto * mutableFieldTransform = const_cast< DisplacementFieldTransformType * >( fieldTransform );
+    gpuField = dynamic_cast< GPUFieldType * >( mutableFieldTransform->GetModifiableDisplacementField() );
+    }
+
+  const bool affinePath = ( matrixTransform != nullptr ) || ( translationTransform != nullptr )
+                          || ( identityTransform != nullptr );
+
+  if( !inPtr || !otPtr || ( !affinePath && gpuField == nullptr ) || !this->IsGPUResampleSupported() )
+    {
+    // delegate everything the kernels cannot evaluate to the CPU
+    CPUSuperclass::GenerateData();
+    return;
+    }
+
+  if( !m_ResampleKernelsBuilt )
+    {
+    this->BuildResampleKernels();
+    }
+
+  const unsigned int dim = ImageDimension;
+
+  // output buffer index -> physical point
+  double outMatrix[3][3];
+  double outOffset[3];
+  const typename GPUOutputImage::DirectionType & outDirection = otPtr->GetDirection();
+  const typename GPUOutputImage::SpacingType & outSpacing = otPtr->GetSpacing();
+  const typename GPUOutputImage::PointType & outOrigin = otPtr->GetOrigin();
+  const typename GPUOutputImage::IndexType outStart = otPtr->GetBufferedRegion().GetIndex();
+  for( unsigned int r = 0; r < dim; r++ )
+    {
+    for( unsigned int c = 0; c < dim; c++ )
+      {
+      outMatrix[r][c] = outDirection[r][c] * outSpacing[c];
+      }
+    }
+  for( unsigned int r = 0; r < dim; r++ )
+    {
+    outOffset[r] = outOrigin[r];
+    for( unsigned int c = 0; c < dim; c++ )
+      {
+      outOffset[r] += outMatrix[r][c] * outStart[c];
+      }
+    }
+
+  // physical point -> input buffer continuous index
+  double inMatrix[3][3];
+  double inOffset[3];
+  const typename GPUInputImage::DirectionType & inInverseDirection = inPtr->GetInverseDirection();
+  const typename GPUInputImage::SpacingType & inSpacing = inPtr->GetSpacing();
+  const typename GPUInputImage::PointType & inOrigin = inPtr->GetOrigin();
+  const typename GPUInputImage::IndexType inStart = inPtr->GetBufferedRegion().GetIndex();
+  for( unsigned int r = 0; r < dim; r++ )
+    {
+    for( unsigned int c = 0; c < dim; c++ )
+      {
+      inMatrix[r][c] = inInverseDirection[r][c] / inSpacing[r];
+      }
+    }
+  for( unsigned int r = 0; r < dim; r++ )
+    {
+    inOffset[r] = -(double)inStart[r];
+    for( unsigned int c = 0; c < dim; c++ )
+      {
+      inOffset[r] -= inMatrix[r][c] * inOrigin[c];
+      }
+    }
+
+  int inSize[3], outSize[3], fieldSize[3];
+  inSize[0] = inSize[1] = inSize[2] = 1;
+  outSize[0] = outSize[1] = outSize[2] = 1;
+  fieldSize[0] = fieldSize[1] = fieldSize[2] = 1;
+  for( unsigned int i = 0; i < dim; i++ )
+    {
+    inSize[i] = (int)inPtr->GetBufferedRegion().GetSize()[i];
+    outSize[i] = (int)otPtr->GetBufferedRegion().GetSize()[i];
+    }
+
+  std::vector<float> params;
+
+  if( affinePath )
+    {
+    // physical transform as matrix and offset
+    double tMatrix[3][3];
+    double tOffset[3];
+    for( unsigned int r = 0; r < dim; r++ )
+      {
+      for( unsigned int c = 0; c < dim; c++ )
+        {
+        tMatrix[r][c] = ( r == c ) ? 1.0 : 0.0;
+        }
+      tOffset[r] = 0.0;
+      }
+    if( matrixTransform != nullptr )
+      {
+      for( unsigned int r = 0; r < dim; r++ )
+        {
+        for( unsigned int c = 0; c < dim; c++ )
+          {
+          tMatrix[r][c] = matrixTransform->GetMatrix()[r][c];
+          }
+        tOffset[r] = matrixTransform->GetOffset()[r];
+        }
+      }
+    else if( translationTransform != nullptr )
+      {
+      for( unsigned int r = 0; r < dim; r++ )
+        {
+        tOffset[r] = translationTransform->GetOffset()[r];
+        }
+      }
+
+    // compose output index -> physical -> transformed physical ->
+    // input continuous index into a single affine map
+    double tmpMatrix[3][3];
+    double tmpOffset[3];
+    for( unsigned int r = 0; r < dim; r++ )
+      {
+      for( unsigned int c = 0; c < dim; c++ )
+        {
+        tmpMatrix[r][c] = 0.0;
+        for( unsigned int k = 0; k < dim; k++ )
+          {
+          tmpMatrix[r][c] += tMatrix[r][k] * outMatrix[k][c];
+          }
+        }
+      tmpOffset[r] = tOffset[r];
+      for( unsigned int k = 0; k < dim; k++ )
+        {
+        tmpOffset[r] += tMatrix[r][k] * outOffset[k];
+        }
+      }
+
+    double composedMatrix[3][3];
+    double composedOffset[3];
+    for( unsigned int r = 0; r < dim; r++ )
+      {
+      for( unsigned int c = 0; c < dim; c++ )
+        {
+        composedMatrix[r][c] = 0.0;
+        for( unsigned int k = 0; k < dim; k++ )
+          {
+          composedMatrix[r][c] += inMatrix[r][k] * tmpMatrix[k][c];
+          }
+        }
+      composedOffset[r] = inOffset[r];
+      for( unsigned int k = 0; k < dim; k++ )
+        {
+        composedOffset[r] += inMatrix[r][k] * tmpOffset[k];
+        }
+      }
+
+    for( unsigned int r = 0; r < dim; r++ )
+      {
+      for( unsigned int c = 0; c < dim; c++ )
+        {
+        params.push_back( (float)composedMatrix[r][c] );
+        }
+      }
+    for( unsigned int r = 0; r < dim; r++ )
+      {
+      params.push_back( (float)composedOffset[r] );
+      }
+    }
+  else
+    {
+    // physical point -> field buffer continuous index
+    double fieldMatrix[3][3];
+    double fieldOffset[3];
+    const typename GPUFieldType::DirectionType & fieldInverseDirection = gpuField->GetInverseDirection();
+    const typename GPUFieldType::SpacingType & fieldSpacing = gpuField->GetSpacing();
+    const typename GPUFieldType::PointType & fieldOrigin = gpuField->GetOrigin();
+    const typename GPUFieldType::IndexType fieldStart = gpuField->GetBufferedRegion().GetIndex();
+    for( unsigned int r = 0; r < dim; r++ )
+      {
+      for( unsigned int c = 0; c < dim; c++ )
+        {
+        fieldMatrix[r][c] = fieldInverseDirection[r][c] / fieldSpacing[r];
+        }
+      }
+    for( unsigned int r = 0; r < dim; r++ )
+      {
+      fieldOffset[r] = -(double)fieldStart[r];
+      for( unsigned int c = 0; c < dim; c++ )
+        {
+        fieldOffset[r] -= fieldMatrix[r][c] * fieldOrigin[c];
+        }
+      }
+    for( unsigned int i = 0; i < dim; i++ )
+      {
+      fieldSize[i] = (int)gpuField->GetBufferedRegion().GetSize()[i];
+      }
+
+    for( unsigned int r = 0; r < dim; r++ )
+      {
+      for( unsigned int c = 0; c < dim; c++ )
+        {
+        params.push_back( (float)outMatrix[r][c] );
+        }
+      }
+    for( unsigned int r = 0; r < dim; r++ )
+      {
+      params.push_back( (float)outOffset[r] );
+      }
+    for( unsigned int r = 0; r < dim; r++ )
+      {
+      for( unsigned int c = 0; c < dim; c++ )
+        {
+        params.push_back( (float)fieldMatrix[r][c] );
+        }
+      }
+    for( unsigned int r = 0; r < dim; r++ )
+      {
+      params.push_back( (float)fieldOffset[r] );
+      }
+    for( unsigned int r = 0; r < dim; r++ )
+      {
+      for( unsigned int c = 0; c < dim; c++ )
+        {
+        params.push_back( (float)inMatrix[r][c] );
+        }
+      }
+    for( unsigned int r = 0; r < dim; r++ )
+      {
+      params.push_back( (float)inOffset[r] );
+      }
+    }
+
+  GPUDataManager::Pointer paramsManager = GPUDataManager::New();
+  paramsManager->SetBufferSize( static_cast<unsigned int>( params.size() * sizeof(float) ) );
+  paramsManager->SetCPUBufferPointer( &params[0] );
+  paramsManager->Allocate();
+  paramsManager->SetGPUDirtyFlag(true);
+
+  float defaultValue = static_cast< float >( this->GetDefaultPixelValue() );
+
+  int ImageDim = (int)ImageDimension;
+
+  size_t localSize[3], globalSize[3];
+  localSize[0] = localSize[1] = localSize[2] = OpenCLGetLocalBlockSize(ImageDim);
+  for(int i=0; i<ImageDim; i++)
+    {
+    globalSize[i] = localSize[i]*(unsigned int)ceil( (float)outSize[i]/(float)localSize[i]); // total # of threads
+    }
+
+  const int kernelHandle = affinePath ? m_AffineKernelHandle : m_FieldKernelHandle;
+
+  // arguments set up
+  int argidx = 0;
+
+  this->m_GPUKernelManager->SetKernelArgWithImage(kernelHandle, argidx++, inPtr->GetGPUDataManager() );
+  if( !affinePath )
+    {
+    this->m_GPUKernelManager->SetKernelArgWithImage(kernelHandle, argidx++, gpuField->GetGPUDataManager() );
+    }
+  this->m_GPUKernelManager->SetKernelArgWithImage(kernelHandle, argidx++, otPtr->GetGPUDataManager() );
+  this->m_GPUKernelManager->SetKernelArgWithImage(kernelHandle, argidx++, paramsManager);
+  this->m_GPUKernelManager->SetKernelArg(kernelHandle, argidx++, sizeof(float), &defaultValue);
+  for(int i=0; i<ImageDim; i++)
+    {
+    this->m_GPUKernelManager->SetKernelArg(kernelHandle, argidx++, sizeof(int), &(inSize[i]) );
+    }
+  if( !affinePath )
+    {
+    for(int i=0; i<ImageDim; i++)
+      {
+      this->m_GPUKernelManager->SetKernelArg(kernelHandle, argidx++, sizeof(int), &(fieldSize[i]) );
+      }
+    }
+  for(int i=0; i<ImageDim; i++)
+    {
+    this->m_GPUKernelManager->SetKernelArg(kernelHandle, argidx++, sizeof(int), &(outSize[i]) );
+    }
+
+  // launch kernel
+  this->m_GPUKernelManager->LaunchKernel(kernelHandle, ImageDim, globalSize, localSize );
+}
+
+template< typename TInputImage, typename TOutputImage,
+          typename TInterpolatorPrecisionType, typename TTransformPrecisionType >
+void
+GPUResampleImageFilter< TInputImage, TOutputImage, TInterpolatorPrecisionType, TTransformPrecisionType >
+::PrintSelf(std::ostream & os, Indent indent) const
+{
+  GPUSuperclass::PrintSelf(os, indent);
+}
+
+} // end namespace itk
+
+#endif
@@ -0,0 +1,15 @@
+set(DOCUMENTATION "This module contains the GPU implementation of image grid
+manipulation filters such as the resample image filter.")
+
+itk_module(ITKGPUImageGrid
+  DEPENDS
+    ITKCommon
+    ITKGPUCommon
+  COMPILE_DEPENDS
+    ITKImageGrid
+    ITKDisplacementField
+  TEST_DEPENDS
+    ITKTestKernel
+  DESCRIPTION
+    "${DOCUMENTATION}"
+)
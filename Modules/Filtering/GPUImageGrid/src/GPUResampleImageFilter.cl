@@ -0,0 +1,403 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+//
+// GPU resampling with linear interpolation.
+//
+// The host composes the output-index -> input-continuous-index mapping
+// into the small params array, so the kernels only evaluate one affine
+// map (plus one displacement fetch for the field kernels) per output
+// pixel. Pixel type defines INPIXELTYPE / OUTPIXELTYPE / FIELDPIXELTYPE
+// and the dimension define DIM_1 / DIM_2 / DIM_3 are set during runtime
+// compilation.
+//
+
+#ifdef DIM_1
+float resample_interpolate_1D(__global const INPIXELTYPE *image, float PositionX, int xsize)
+{
+    int xBas0, xBas1;
+    float xCom;
+    float fPositionX;
+
+    fPositionX = floor(PositionX);
+    xBas0=(int) fPositionX;
+    xBas1=xBas0+1;
+
+    xCom=PositionX-fPositionX;
+
+    if(xBas0<0) { xBas0=0; if(xBas1<0) { xBas1=0; }}
+    if(xBas1>(xsize-1)) { xBas1=xsize-1; if(xBas0>(xsize-1)) { xBas0=xsize-1; }}
+
+    return (float)image[xBas0]*(1-xCom) + (float)image[xBas1]*xCom;
+}
+
+float field_interpolate_1D(__global const FIELDPIXELTYPE *field, float PositionX, int xsize)
+{
+    int xBas0, xBas1;
+    float xCom;
+    float fPositionX;
+
+    fPositionX = floor(PositionX);
+    xBas0=(int) fPositionX;
+    xBas1=xBas0+1;
+
+    xCom=PositionX-fPositionX;
+
+    if(xBas0<0) { xBas0=0; if(xBas1<0) { xBas1=0; }}
+    if(xBas1>(xsize-1)) { xBas1=xsize-1; if(xBas0>(xsize-1)) { xBas0=xsize-1; }}
+
+    return (float)field[xBas0]*(1-xCom) + (float)field[xBas1]*xCom;
+}
+
+// params: [0] matrix, [1] offset of the output-index to
+// input-continuous-index map
+__kernel void ResampleAffineLinear(__global const INPIXELTYPE* in, __global OUTPIXELTYPE* out,
+                                   __constant float* params, float defaultValue,
+                                   int in_xsize, int out_xsize)
+{
+  int gix = get_global_id(0);
+
+  if(gix < out_xsize)
+  {
+    float cix = params[0]*gix + params[1];
+    if(cix >= 0 && cix <= in_xsize-1)
+    {
+      out[gix] = (OUTPIXELTYPE)resample_interpolate_1D(in, cix, in_xsize);
+    }
+    else
+    {
+      out[gix] = (OUTPIXELTYPE)defaultValue;
+    }
+  }
+}
+
+// params: [0],[1] output index to physical point, [2],[3] physical
+// point to field continuous index, [4],[5] physical point to input
+// continuous index
+__kernel void ResampleDisplacementFieldLinear(__global const INPIXELTYPE* in,
+                                              __global const FIELDPIXELTYPE* field,
+                                              __global OUTPIXELTYPE* out,
+                                              __constant float* params, float defaultValue,
+                                              int in_xsize, int field_xsize, int out_xsize)
+{
+  int gix = get_global_id(0);
+
+  if(gix < out_xsize)
+  {
+    float px = params[0]*gix + params[1];
+    float fx = params[2]*px + params[3];
+
+    px += field_interpolate_1D(field, fx, field_xsize);
+
+    float cix = params[4]*px + params[5];
+    if(cix >= 0 && cix <= in_xsize-1)
+    {
+      out[gix] = (OUTPIXELTYPE)resample_interpolate_1D(in, cix, in_xsize);
+    }
+    else
+    {
+      out[gix] = (OUTPIXELTYPE)defaultValue;
+    }
+  }
+}
+#endif
+
+#ifdef DIM_2
+float resample_interpolate_2D(__global const INPIXELTYPE *image, float PositionX, float PositionY, int xsize, int ysize)
+{
+    int xBas0, xBas1, yBas0, yBas1;
+    float perc[4];
+    float xCom, yCom, xComi, yComi;
+    float fPositionX, fPositionY;
+
+    fPositionX = floor(PositionX); fPositionY = floor(PositionY);
+    xBas0=(int) fPositionX; yBas0=(int) fPositionY;
+    xBas1=xBas0+1; yBas1=yBas0+1;
+
+    xCom=PositionX-fPositionX; yCom=PositionY-fPositionY;
+    xComi=(1-xCom); yComi=(1-yCom);
+    perc[0]=xComi * yComi;
+    perc[1]=xComi * yCom;
+    perc[2]=xCom * yComi;
+    perc[3]=xCom * yCom;
+
+    if(xBas0<0) { xBas0=0; if(xBas1<0) { xBas1=0; }}
+    if(yBas0<0) { yBas0=0; if(yBas1<0) { yBas1=0; }}
+    if(xBas1>(xsize-1)) { xBas1=xsize-1; if(xBas0>(xsize-1)) { xBas0=xsize-1; }}
+    if(yBas1>(ysize-1)) { yBas1=ysize-1; if(yBas0>(ysize-1)) { yBas0=ysize-1; }}
+
+    return (float)image[xBas0+yBas0*xsize]*perc[0]
+          +(float)image[xBas0+yBas1*xsize]*perc[1]
+          +(float)image[xBas1+yBas0*xsize]*perc[2]
+          +(float)image[xBas1+yBas1*xsize]*perc[3];
+}
+
+// comp selects the displacement component; the field stores the vector
+// components interleaved
+float field_interpolate_2D(__global const FIELDPIXELTYPE *field, int comp, float PositionX, float PositionY, int xsize, int ysize)
+{
+    int xBas0, xBas1, yBas0, yBas1;
+    float perc[4];
+    float xCom, yCom, xComi, yComi;
+    float fPositionX, fPositionY;
+
+    fPositionX = floor(PositionX); fPositionY = floor(PositionY);
+    xBas0=(int) fPositionX; yBas0=(int) fPositionY;
+    xBas1=xBas0+1; yBas1=yBas0+1;
+
+    xCom=PositionX-fPositionX; yCom=PositionY-fPositionY;
+    xComi=(1-xCom); yComi=(1-yCom);
+    perc[0]=xComi * yComi;
+    perc[1]=xComi * yCom;
+    perc[2]=xCom * yComi;
+    perc[3]=xCom * yCom;
+
+    if(xBas0<0) { xBas0=0; if(xBas1<0) { xBas1=0; }}
+    if(yBas0<0) { yBas0=0; if(yBas1<0) { yBas1=0; }}
+    if(xBas1>(xsize-1)) { xBas1=xsize-1; if(xBas0>(xsize-1)) { xBas0=xsize-1; }}
+    if(yBas1>(ysize-1)) { yBas1=ysize-1; if(yBas0>(ysize-1)) { yBas0=ysize-1; }}
+
+    return (float)field[(xBas0+yBas0*xsize)*2+comp]*perc[0]
+          +(float)field[(xBas0+yBas1*xsize)*2+comp]*perc[1]
+          +(float)field[(xBas1+yBas0*xsize)*2+comp]*perc[2]
+          +(float)field[(xBas1+yBas1*xsize)*2+comp]*perc[3];
+}
+
+// params: [0..3] row-major matrix, [4],[5] offset of the output-index
+// to input-continuous-index map
+__kernel void ResampleAffineLinear(__global const INPIXELTYPE* in, __global OUTPIXELTYPE* out,
+                                   __constant float* params, float defaultValue,
+                                   int in_xsize, int in_ysize,
+                                   int out_xsize, int out_ysize)
+{
+  int gix = get_global_id(0);
+  int giy = get_global_id(1);
+
+  if(gix < out_xsize && giy < out_ysize)
+  {
+    float cix = params[0]*gix + params[1]*giy + params[4];
+    float ciy = params[2]*gix + params[3]*giy + params[5];
+    unsigned int gidx = out_xsize*giy + gix;
+    if(cix >= 0 && cix <= in_xsize-1 && ciy >= 0 && ciy <= in_ysize-1)
+    {
+      out[gidx] = (OUTPIXELTYPE)resample_interpolate_2D(in, cix, ciy, in_xsize, in_ysize);
+    }
+    else
+    {
+      out[gidx] = (OUTPIXELTYPE)defaultValue;
+    }
+  }
+}
+
+// params: [0..5] output index to physical point, [6..11] physical point
+// to field continuous index, [12..17] physical point to input
+// continuous index, each as row-major matrix followed by offset
+__kernel void ResampleDisplacementFieldLinear(__global const INPIXELTYPE* in,
+                                              __global const FIELDPIXELTYPE* field,
+                                              __global OUTPIXELTYPE* out,
+                                              __constant float* params, float defaultValue,
+                                              int in_xsize, int in_ysize,
+                                              int field_xsize, int field_ysize,
+                                              int out_xsize, int out_ysize)
+{
+  int gix = get_global_id(0);
+  int giy = get_global_id(1);
+
+  if(gix < out_xsize && giy < out_ysize)
+  {
+    float px = params[0]*gix + params[1]*giy + params[4];
+    float py = params[2]*gix + params[3]*giy + params[5];
+
+    float fx = params[6]*px + params[7]*py + params[10];
+    float fy = params[8]*px + params[9]*py + params[11];
+
+    px += field_interpolate_2D(field, 0, fx, fy, field_xsize, field_ysize);
+    py += field_interpolate_2D(field, 1, fx, fy, field_xsize, field_ysize);
+
+    float cix = params[12]*px + params[13]*py + params[16];
+    float ciy = params[14]*px + params[15]*py + params[17];
+
+    unsigned int gidx = out_xsize*giy + gix;
+    if(cix >= 0 && cix <= in_xsize-1 && ciy >= 0 && ciy <= in_ysize-1)
+    {
+      out[gidx] = (OUTPIXELTYPE)resample_interpolate_2D(in, cix, ciy, in_xsize, in_ysize);
+    }
+    else
+    {
+      out[gidx] = (OUTPIXELTYPE)defaultValue;
+    }
+  }
+}
+#endif
+
+#ifdef DIM_3
+float resample_interpolate_3D(__global const INPIXELTYPE *image, float PositionX, float PositionY, float PositionZ, int xsize, int ysize, int zsize)
+{
+    int xBas0, xBas1, yBas0, yBas1, zBas0, zBas1;
+    float perc[8];
+    float xCom, yCom, zCom;
+    float xComi, yComi, zComi;
+    float fPositionX, fPositionY, fPositionZ;
+
+    fPositionX=floor(PositionX); fPositionY=floor(PositionY); fPositionZ=floor(PositionZ);
+    xBas0=(int) fPositionX; yBas0=(int) fPositionY; zBas0=(int) fPositionZ;
+    xBas1=xBas0+1; yBas1=yBas0+1; zBas1=zBas0+1;
+
+    if(xBas0<0) {xBas0=0; if(xBas1<0) { xBas1=0; }}
+    if(yBas0<0) {yBas0=0; if(yBas1<0) { yBas1=0; }}
+    if(zBas0<0) {zBas0=0; if(zBas1<0) { zBas1=0; }}
+    if(xBas1>(xsize-1)) { xBas1=xsize-1; if(xBas0>(xsize-1)) { xBas0=xsize-1; }}
+    if(yBas1>(ysize-1)) { yBas1=ysize-1; if(yBas0>(ysize-1)) { yBas0=ysize-1; }}
+    if(zBas1>(zsize-1)) { zBas1=zsize-1; if(zBas0>(zsize-1)) { zBas0=zsize-1; }}
+
+    xCom=PositionX-fPositionX; yCom=PositionY-fPositionY; zCom=PositionZ-fPositionZ;
+    xComi=(1-xCom); yComi=(1-yCom); zComi=(1-zCom);
+    perc[0]=xComi * yComi * zComi;
+    perc[1]=xComi * yComi * zCom;
+    perc[2]=xComi * yCom * zComi;
+    perc[3]=xComi * yCom * zCom;
+    perc[4]=xCom * yComi * zComi;
+    perc[5]=xCom * yComi * zCom;
+    perc[6]=xCom * yCom * zComi;
+    perc[7]=xCom * yCom * zCom;
+
+    return (float)image[xBas0+yBas0*xsize+zBas0*xsize*ysize]*perc[0]
+          +(float)image[xBas0+yBas0*xsize+zBas1*xsize*ysize]*perc[1]
+          +(float)image[xBas0+yBas1*xsize+zBas0*xsize*ysize]*perc[2]
+          +(float)image[xBas0+yBas1*xsize+zBas1*xsize*ysize]*perc[3]
+          +(float)image[xBas1+yBas0*xsize+zBas0*xsize*ysize]*perc[4]
+          +(float)image[xBas1+yBas0*xsize+zBas1*xsize*ysize]*perc[5]
+          +(float)image[xBas1+yBas1*xsize+zBas0*xsize*ysize]*perc[6]
+          +(float)image[xBas1+yBas1*xsize+zBas1*xsize*ysize]*perc[7];
+}
+
+// comp selects the displacement component; the field stores the vector
+// components interleaved
+float field_interpolate_3D(__global const FIELDPIXELTYPE *field, int comp, float PositionX, float PositionY, float PositionZ, int xsize, int ysize, int zsize)
+{
+    int xBas0, xBas1, yBas0, yBas1, zBas0, zBas1;
+    float perc[8];
+    float xCom, yCom, zCom;
+    float xComi, yComi, zComi;
+    float fPositionX, fPositionY, fPositionZ;
+
+    fPositionX=floor(PositionX); fPositionY=floor(PositionY); fPositionZ=floor(PositionZ);
+    xBas0=(int) fPositionX; yBas0=(int) fPositionY; zBas0=(int) fPositionZ;
+    xBas1=xBas0+1; yBas1=yBas0+1; zBas1=zBas0+1;
+
+    if(xBas0<0) {xBas0=0; if(xBas1<0) { xBas1=0; }}
+    if(yBas0<0) {yBas0=0; if(yBas1<0) { yBas1=0; }}
+    if(zBas0<0) {zBas0=0; if(zBas1<0) { zBas1=0; }}
+    if(xBas1>(xsize-1)) { xBas1=xsize-1; if(xBas0>(xsize-1)) { xBas0=xsize-1; }}
+    if(yBas1>(ysize-1)) { yBas1=ysize-1; if(yBas0>(ysize-1)) { yBas0=ysize-1; }}
+    if(zBas1>(zsize-1)) { zBas1=zsize-1; if(zBas0>(zsize-1)) { zBas0=zsize-1; }}
+
+    xCom=PositionX-fPositionX; yCom=PositionY-fPositionY; zCom=PositionZ-fPositionZ;
+    xComi=(1-xCom); yComi=(1-yCom); zComi=(1-zCom);
+    perc[0]=xComi * yComi * zComi;
+    perc[1]=xComi * yComi * zCom;
+    perc[2]=xComi * yCom * zComi;
+    perc[3]=xComi * yCom * zCom;
+    perc[4]=xCom * yComi * zComi;
+    perc[5]=xCom * yComi * zCom;
+    perc[6]=xCom * yCom * zComi;
+    perc[7]=xCom * yCom * zCom;
+
+    return (float)field[(xBas0+yBas0*xsize+zBas0*xsize*ysize)*3+comp]*perc[0]
+          +(float)field[(xBas0+yBas0*xsize+zBas1*xsize*ysize)*3+comp]*perc[1]
+          +(float)field[(xBas0+yBas1*xsize+zBas0*xsize*ysize)*3+comp]*perc[2]
+          +(float)field[(xBas0+yBas1*xsize+zBas1*xsize*ysize)*3+comp]*perc[3]
+          +(float)field[(xBas1+yBas0*xsize+zBas0*xsize*ysize)*3+comp]*perc[4]
+          +(float)field[(xBas1+yBas0*xsize+zBas1*xsize*ysize)*3+comp]*perc[5]
+          +(float)field[(xBas1+yBas1*xsize+zBas0*xsize*ysize)*3+comp]*perc[6]
+          +(float)field[(xBas1+yBas1*xsize+zBas1*xsize*ysize)*3+comp]*perc[7];
+}
+
+// params: [0..8] row-major matrix, [9..11] offset of the output-index
+// to input-continuous-index map
+__kernel void ResampleAffineLinear(__global const INPIXELTYPE* in, __global OUTPIXELTYPE* out,
+                                   __constant float* params, float defaultValue,
+                                   int in_xsize, int in_ysize, int in_zsize,
+                                   int out_xsize, int out_ysize, int out_zsize)
+{
+  int gix = get_global_id(0);
+  int giy = get_global_id(1);
+  int giz = get_global_id(2);
+
+  if(gix < out_xsize && giy < out_ysize && giz < out_zsize)
+  {
+    float cix = params[0]*gix + params[1]*giy + params[2]*giz + params[9];
+    float ciy = params[3]*gix + params[4]*giy + params[5]*giz + params[10];
+    float ciz = params[6]*gix + params[7]*giy + params[8]*giz + params[11];
+    unsigned int gidx = out_xsize*(giz*out_ysize + giy) + gix;
+    if(cix >= 0 && cix <= in_xsize-1 && ciy >= 0 && ciy <= in_ysize-1 && ciz >= 0 && ciz <= in_zsize-1)
+    {
+      out[gidx] = (OUTPIXELTYPE)resample_interpolate_3D(in, cix, ciy, ciz, in_xsize, in_ysize, in_zsize);
+    }
+    else
+    {
+      out[gidx] = (OUTPIXELTYPE)defaultValue;
+    }
+  }
+}
+
+// params: [0..11] output index to physical point, [12..23] physical
+// point to field continuous index, [24..35] physical point to input
+// continuous index, each as row-major matrix followed by offset
+__kernel void ResampleDisplacementFieldLinear(__global const INPIXELTYPE* in,
+                                              __global const FIELDPIXELTYPE* field,
+                                              __global OUTPIXELTYPE* out,
+                                              __constant float* params, float defaultValue,
+                                              int in_xsize, int in_ysize, int in_zsize,
+                                              int field_xsize, int field_ysize, int field_zsize,
+                                              int out_xsize, int out_ysize, int out_zsize)
+{
+  int gix = get_global_id(0);
+  int giy = get_global_id(1);
+  int giz = get_global_id(2);
+
+  if(gix < out_xsize && giy < out_ysize && giz < out_zsize)
+  {
+    float px = params[0]*gix + params[1]*giy + params[2]*giz + params[9];
+    float py = params[3]*gix + params[4]*giy + params[5]*giz + params[10];
+    float pz = params[6]*gix + params[7]*giy + params[8]*giz + params[11];
+
+    float fx = params[12]*px + params[13]*py + params[14]*pz + params[21];
+    float fy = params[15]*px + params[16]*py + params[17]*pz + params[22];
+    float fz = params[18]*px + params[19]*py + params[20]*pz + params[23];
+
+    px += field_interpolate_3D(field, 0, fx, fy, fz, field_xsize, field_ysize, field_zsize);
+    py += field_interpolate_3D(field, 1, fx, fy, fz, field_xsize, field_ysize, field_zsize);
+    pz += field_interpolate_3D(field, 2, fx, fy, fz, field_xsize, field_ysize, field_zsize);
+
+    float cix = params[24]*px + params[25]*py + params[26]*pz + params[33];
+    float ciy = params[27]*px + params[28]*py + params[29]*pz + params[34];
+    float ciz = params[30]*px + params[31]*py + params[32]*pz + params[35];
+
+    unsigned int gidx = out_xsize*(giz*out_ysize + giy) + gix;
+    if(cix >= 0 && cix <= in_xsize-1 && ciy >= 0 && ciy <= in_ysize-1 && ciz >= 0 && ciz <= in_zsize-1)
+    {
+      out[gidx] = (OUTPIXELTYPE)resample_interpolate_3D(in, cix, ciy, ciz, in_xsize, in_ysize, in_zsize);
+    }
+    else
+    {
+      out[gidx] = (OUTPIXELTYPE)defaultValue;
+    }
+  }
+}
+#endif
@@ -0,0 +1,147 @@
+/*=========================================================================
+*
+*  Copyright Insight Software Consortium
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*         http://www.apache.org/licenses/LICENSE-2.0.txt
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+*=========================================================================*/
+
+/**
+ * Test program for GPUResampleImageFilter class
+ *
+ * A smooth synthetic image is resampled under an affine transform onto a
+ * different grid on the CPU and on the GPU, and the two outputs are
+ * compared within a small tolerance.
+ */
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkAffineTransform.h"
+#include "itkResampleImageFilter.h"
+
+#include "itkOpenCLUtil.h"
+#include "itkGPUImage.h"
+#include "itkGPUKernelManager.h"
+#include "itkGPUContextManager.h"
+#include "itkGPUResampleImageFilter.h"
+
+namespace
+{
+double SmoothValue( double x, double y )
+{
+  return 50.0 + 40.0 * std::sin( x / 9.0 ) * std::cos( y / 7.0 );
+}
+}
+
+int itkGPUResampleImageFilterTest( int, char* [] )
+{
+  if ( !itk::IsGPUAvailable() )
+    {
+    std::cerr << "OpenCL-enabled GPU is not present." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  constexpr unsigned int Dimension = 2;
+  using PixelType = float;
+  using CPUImageType = itk::Image< PixelType, Dimension >;
+  using GPUImageType = itk::GPUImage< PixelType, Dimension >;
+
+  CPUImageType::SizeType size;
+  size.Fill( 64 );
+  CPUImageType::RegionType region;
+  region.SetSize( size );
+
+  // the same smooth input on both paths
+  CPUImageType::Pointer cpuInput = CPUImageType::New();
+  cpuInput->SetRegions( region );
+  cpuInput->Allocate();
+
+  GPUImageType::Pointer gpuInput = GPUImageType::New();
+  gpuInput->SetRegions( region );
+  gpuInput->Allocate();
+
+  itk::ImageRegionIteratorWithIndex< CPUImageType > it( cpuInput, region );
+  for ( ; !it.IsAtEnd(); ++it )
+    {
+    const auto value = static_cast< PixelType >(
+      SmoothValue( it.GetIndex()[0], it.GetIndex()[1] ) );
+    it.Set( value );
+    gpuInput->SetPixel( it.GetIndex(), value );
+    }
+
+  // an affine map with rotation, scaling and translation
+  using TransformType = itk::AffineTransform< double, Dimension >;
+  TransformType::Pointer transform = TransformType::New();
+  transform->Rotate2D( 0.2 );
+  transform->Scale( 1.1 );
+  TransformType::OutputVectorType translation;
+  translation[0] = 3.5;
+  translation[1] = -2.25;
+  transform->Translate( translation );
+
+  // the output grid differs from the input grid
+  CPUImageType::SizeType outputSize;
+  outputSize[0] = 80;
+  outputSize[1] = 72;
+  CPUImageType::SpacingType outputSpacing;
+  outputSpacing.Fill( 0.8 );
+  CPUImageType::PointType outputOrigin;
+  outputOrigin[0] = 1.0;
+  outputOrigin[1] = -1.5;
+
+  using CPUFilterType = itk::ResampleImageFilter< CPUImageType, CPUImageType >;
+  CPUFilterType::Pointer cpuFilter = CPUFilterType::New();
+  cpuFilter->SetInput( cpuInput );
+  cpuFilter->SetTransform( transform );
+  cpuFilter->SetSize( outputSize );
+  cpuFilter->SetOutputSpacing( outputSpacing );
+  cpuFilter->SetOutputOrigin( outputOrigin );
+  cpuFilter->SetDefaultPixelValue( 0 );
+  cpuFilter->Update();
+
+  using GPUFilterType = itk::GPUResampleImageFilter< GPUImageType, GPUImageType >;
+  GPUFilterType::Pointer gpuFilter = GPUFilterType::New();
+  gpuFilter->SetInput( gpuInput );
+  gpuFilter->SetTransform( transform );
+  gpuFilter->SetSize( outputSize );
+  gpuFilter->SetOutputSpacing( outputSpacing );
+  gpuFilter->SetOutputOrigin( outputOrigin );
+  gpuFilter->SetDefaultPixelValue( 0 );
+  gpuFilter->Update();
+  gpuFilter->GetOutput()->UpdateBuffers();
+
+  // the device interpolates in single precision, so allow a small
+  // deviation from the double precision CPU result
+  constexpr double tolerance = 1e-2;
+  double maximumDifference = 0.0;
+
+  itk::ImageRegionIteratorWithIndex< CPUImageType > cpuIt(
+    cpuFilter->GetOutput(), cpuFilter->GetOutput()->GetBufferedRegion() );
+  for ( ; !cpuIt.IsAtEnd(); ++cpuIt )
+    {
+    const double difference = std::abs(
+      static_cast< double >( cpuIt.Get() )
+      - static_cast< double >( gpuFilter->GetOutput()->GetPixel( cpuIt.GetIndex() ) ) );
+    maximumDifference = std::max( maximumDifference, difference );
+    if ( difference > tolerance )
+      {
+      std::cerr << "CPU/GPU mismatch at " << cpuIt.GetIndex() << ": "
+                << cpuIt.Get() << " != "
+                << gpuFilter->GetOutput()->GetPixel( cpuIt.GetIndex() )
+                << std::endl;
+      return EXIT_FAILURE;
+      }
+    }
+
+  std::cout << "Maximum CPU/GPU difference: " << maximumDifference << std::endl;
+  std::cout << "Test PASSED." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -112,9 +112,10 @@ GPUMeanImageFilter< TInputImage, TOutputImage >::GPUGenerateData()
     this->m_GPUKernelManager->SetKernelArg(m_MeanFilterGPUKernelHandle, argidx++, sizeof(int), &(imgSize[i]) );
     }
 
-  // launch kernel
-  this->m_GPUKernelManager->LaunchKernel( m_MeanFilterGPUKernelHandle, (int)TInputImage::ImageDimension, globalSize,
-                                          localSize );
+  // launch kernel, split across the devices of the context when
+  // multi-device execution is enabled
+  this->LaunchKernelAcrossDevices( m_MeanFilterGPUKernelHandle, (int)TInputImage::ImageDimension, globalSize,
+                                   localSize );
 }
 
 } // end namespace itk
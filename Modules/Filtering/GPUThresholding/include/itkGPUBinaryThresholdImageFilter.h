@@ -72,6 +72,36 @@ public:
     return 4;
   }
 
+  /** OpenCL fragments used when this functor takes part in a fused
+   * kernel, see GPUFusedFunctorImageFilter. The thresholds and the two
+   * output values are passed as float parameters. */
+  std::string GetOpenCLParameterDeclarations(const std::string & prefix) const override
+  {
+    return "float " + prefix + "lowerThreshold, float " + prefix + "upperThreshold, float "
+           + prefix + "insideValue, float " + prefix + "outsideValue, ";
+  }
+
+  std::string GetOpenCLFunction(const std::string & prefix) const override
+  {
+    return "( ( " + prefix + "lowerThreshold <= value && value <= " + prefix
+           + "upperThreshold ) ? " + prefix + "insideValue : " + prefix + "outsideValue )";
+  }
+
+  int SetFusedGPUKernelArguments(GPUKernelManager::Pointer KernelManager, int KernelHandle,
+                                 int argumentIndex) override
+  {
+    // clSetKernelArg copies the value, so a temporary is fine here
+    float parameterValue = static_cast< float >( m_LowerThreshold );
+    KernelManager->SetKernelArg(KernelHandle, argumentIndex++, sizeof(float), &parameterValue);
+    parameterValue = static_cast< float >( m_UpperThreshold );
+    KernelManager->SetKernelArg(KernelHandle, argumentIndex++, sizeof(float), &parameterValue);
+    parameterValue = static_cast< float >( m_InsideValue );
+    KernelManager->SetKernelArg(KernelHandle, argumentIndex++, sizeof(float), &parameterValue);
+    parameterValue = static_cast< float >( m_OutsideValue );
+    KernelManager->SetKernelArg(KernelHandle, argumentIndex++, sizeof(float), &parameterValue);
+    return argumentIndex;
+  }
+
 private:
   TInput  m_LowerThreshold;
   TInput  m_UpperThreshold;
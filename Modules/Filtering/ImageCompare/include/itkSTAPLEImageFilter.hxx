@@ -20,6 +20,10 @@
 #include "itkSTAPLEImageFilter.h"
 
 #include "itkImageScanlineIterator.h"
+#include "itkMultiThreaderBase.h"
+
+#include <mutex>
+#include <vector>
 
 namespace itk
 {
@@ -61,8 +65,6 @@ STAPLEImageFilter< TInputImage, TOutputImage >
   // Record the number of input files.
   number_of_input_files = this->GetNumberOfIndexedInputs();
 
-  auto * D_it = new IteratorType[number_of_input_files];
-
   auto * p = new double[number_of_input_files];  // sensitivity
   auto * q = new double[number_of_input_files];  // specificity
 
@@ -123,89 +125,132 @@ STAPLEImageFilter< TInputImage, TOutputImage >
     }
   g_t = ( g_t / N ) * m_ConfidenceWeight;
 
-  double p_num, p_denom, q_num, q_denom;
+  std::mutex mutex;
 
   for ( iter = 0; iter < m_MaximumIterations; ++iter )
     {
-    // Now iterate on estimating specificity and sensitivity
-    for ( i = 0; i < number_of_input_files; ++i )
+    // Now iterate on estimating specificity and sensitivity. Each
+    // thread accumulates the per-rater partial sums over its piece of
+    // the region and the partials are merged under the lock. The
+    // denominators are the same sums of Wi (resp. 1 - Wi) for every
+    // rater, so they are only accumulated once per thread.
+    std::vector< double > p_num(number_of_input_files, 0.0);
+    std::vector< double > q_num(number_of_input_files, 0.0);
+    double p_denom = 0.0;
+    double q_denom = 0.0;
+
+    this->GetMultiThreader()->template ParallelizeImageRegion< TOutputImage::ImageDimension >(
+      W->GetRequestedRegion(),
+      [this, &W, number_of_input_files, epsilon, &mutex, &p_num, &q_num, &p_denom, &q_denom]
+      (const typename TOutputImage::RegionType & regionForThread)
       {
-      in = IteratorType( this->GetInput(i), W->GetRequestedRegion() );
-      out = FuzzyIteratorType( W, W->GetRequestedRegion() );
-
-      p_num = p_denom = q_num = q_denom = 0.0;
+        std::vector< double > local_p_num(number_of_input_files, 0.0);
+        std::vector< double > local_q_num(number_of_input_files, 0.0);
+        double local_p_denom = 0.0;
+        double local_q_denom = 0.0;
 
-      // Sensitivity and specificity of this user
-      while ( !in.IsAtEnd() )
-        {
-        while ( !in.IsAtEndOfLine() )
+        for ( unsigned int rater = 0; rater < number_of_input_files; ++rater )
           {
-          if ( in.Get() > m_ForegroundValue - epsilon
-               && in.Get() < m_ForegroundValue + epsilon ) // Dij == 1
-            {
-            p_num += out.Get(); // out.Get() := Wi
-            }
-          else //        if (in.Get() != m_ForegroundValue) // Dij == 0
+          IteratorType in( this->GetInput(rater), regionForThread );
+          ImageScanlineConstIterator< TOutputImage > w( W, regionForThread );
+
+          // Sensitivity and specificity of this user
+          while ( !in.IsAtEnd() )
             {
-            q_num += ( 1.0 - out.Get() ); // out.Get() := Wi
+            while ( !in.IsAtEndOfLine() )
+              {
+              if ( in.Get() > m_ForegroundValue - epsilon
+                   && in.Get() < m_ForegroundValue + epsilon ) // Dij == 1
+                {
+                local_p_num[rater] += w.Get(); // w.Get() := Wi
+                }
+              else //        if (in.Get() != m_ForegroundValue) // Dij == 0
+                {
+                local_q_num[rater] += ( 1.0 - w.Get() ); // w.Get() := Wi
+                }
+              if ( rater == 0 )
+                {
+                local_p_denom += w.Get();
+                local_q_denom += ( 1.0 - w.Get() );
+                }
+              ++in;
+              ++w;
+              } // end of scanline
+            in.NextLine();
+            w.NextLine();
             }
-          p_denom += out.Get();
-          q_denom += ( 1.0 - out.Get() );
-          ++in;
-          ++out;
-          } // end of scanline
-        in.NextLine();
-        out.NextLine();
-        }
+          }
+
+        std::lock_guard< std::mutex > mutexHolder(mutex);
+        for ( unsigned int rater = 0; rater < number_of_input_files; ++rater )
+          {
+          p_num[rater] += local_p_num[rater];
+          q_num[rater] += local_q_num[rater];
+          }
+        p_denom += local_p_denom;
+        q_denom += local_q_denom;
+      },
+      nullptr);
 
-      p[i] = p_num / p_denom;
-      q[i] = q_num / q_denom;
+    for ( i = 0; i < number_of_input_files; ++i )
+      {
+      p[i] = p_num[i] / p_denom;
+      q[i] = q_num[i] / q_denom;
       }
 
     // Now recreate W using the new p's and q's
     // Need an iterator on each D
     // const double g_t = 0.1;  // prior likelihood that a pixel is incl.in
     // segmentation
-    double alpha1, beta1;
-
-    for ( i = 0; i < number_of_input_files; ++i )
+    // Every voxel of W is independent here, so the region is simply
+    // split between the threads.
+    this->GetMultiThreader()->template ParallelizeImageRegion< TOutputImage::ImageDimension >(
+      W->GetRequestedRegion(),
+      [this, &W, number_of_input_files, epsilon, g_t, p, q]
+      (const typename TOutputImage::RegionType & regionForThread)
       {
-      D_it[i] = IteratorType( this->GetInput(i), W->GetRequestedRegion() );
-      }
+        std::vector< IteratorType > D_it(number_of_input_files);
+        for ( unsigned int rater = 0; rater < number_of_input_files; ++rater )
+          {
+          D_it[rater] = IteratorType( this->GetInput(rater), regionForThread );
+          }
 
-    out = FuzzyIteratorType( W, W->GetRequestedRegion() );
+        FuzzyIteratorType threadOut( W, regionForThread );
 
-    out.GoToBegin();
-    while ( !out.IsAtEnd())
-      {
-      while ( !out.IsAtEndOfLine() )
-        {
-        alpha1 = beta1 = 1.0;
-        for ( i = 0; i < number_of_input_files; ++i )
+        threadOut.GoToBegin();
+        while ( !threadOut.IsAtEnd())
           {
-          if ( D_it[i].Get() > m_ForegroundValue - epsilon && D_it[i].Get() < m_ForegroundValue + epsilon )
-            // Dij == 1
+          while ( !threadOut.IsAtEndOfLine() )
             {
-            alpha1 = alpha1 * p[i];
-            beta1  = beta1 * ( 1.0 - q[i] );
-            }
-          else //Dij == 0
+            double alpha1 = 1.0;
+            double beta1 = 1.0;
+            for ( unsigned int rater = 0; rater < number_of_input_files; ++rater )
+              {
+              if ( D_it[rater].Get() > m_ForegroundValue - epsilon && D_it[rater].Get() < m_ForegroundValue + epsilon )
+                // Dij == 1
+                {
+                alpha1 = alpha1 * p[rater];
+                beta1  = beta1 * ( 1.0 - q[rater] );
+                }
+              else //Dij == 0
+                {
+                alpha1 = alpha1 * ( 1.0 - p[rater] );
+                beta1  = beta1  * q[rater];
+                }
+              ++D_it[rater];
+              }
+            threadOut.Set( g_t * alpha1
+                           / ( g_t * alpha1  + ( 1.0 - g_t ) * beta1 ) );
+            ++threadOut;
+            } // end scanline
+          for ( unsigned int rater = 0; rater < number_of_input_files; ++rater )
             {
-            alpha1 = alpha1 * ( 1.0 - p[i] );
-            beta1  = beta1  * q[i];
+            D_it[rater].NextLine();
             }
-          ++D_it[i];
+          threadOut.NextLine();
           }
-        out.Set( g_t * alpha1
-                 / ( g_t * alpha1  + ( 1.0 - g_t ) * beta1 ) );
-        ++out;
-        } // end scanline
-      for ( i = 0; i < number_of_input_files; ++i )
-        {
-        D_it[i].NextLine();
-        }
-      out.NextLine();
-      }
+      },
+      nullptr);
 
     this->InvokeEvent( IterationEvent() );
 
@@ -261,7 +306,6 @@ STAPLEImageFilter< TInputImage, TOutputImage >
   delete[] p;
   delete[] last_q;
   delete[] last_p;
-  delete[] D_it;
 }
 } // end namespace itk
 
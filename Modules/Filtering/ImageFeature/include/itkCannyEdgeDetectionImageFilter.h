@@ -196,7 +196,7 @@ public:
 
   OutputImageType * GetNonMaximumSuppressionImage()
   {
-    return this->m_MultiplyImageFilter->GetOutput();
+    return this->m_UpdateBuffer1;
   }
 
 #ifdef ITK_USE_CONCEPT_CHECKING
@@ -252,6 +252,12 @@ private:
    *  it writes the result to m_UpdateBuffer1 */
   void ThreadedCompute2ndDerivativePos(const OutputImageRegionType& outputRegionForThread);
 
+  /** Fused non-maximum suppression: calculate the zero crossings of
+   *  the second directional derivative and mask the gradient
+   *  magnitude response with them, writing the result in place over
+   *  m_UpdateBuffer1 */
+  void ThreadedZeroCrossingAndMultiply(const OutputImageRegionType& outputRegionForThread);
+
   ArrayType m_Variance;
   ArrayType m_MaximumError;
 
@@ -263,10 +269,6 @@ private:
   /** Gaussian filter to smooth the input image. */
   typename GaussianImageFilterType::Pointer m_GaussianFilter;
 
-  /** Multiply image filter to multiply with the zero crossings of the second
-   *  derivative. */
-  typename MultiplyImageFilterType::Pointer m_MultiplyImageFilter;
-
   /** Function objects that are used in the inner loops of derivatiVex
    *  calculations. */
   DerivativeOperator< OutputImagePixelType, Self::ImageDimension >
@@ -19,7 +19,6 @@
 #define itkCannyEdgeDetectionImageFilter_hxx
 #include "itkCannyEdgeDetectionImageFilter.h"
 
-#include "itkZeroCrossingImageFilter.h"
 #include "itkNeighborhoodInnerProduct.h"
 #include "itkNumericTraits.h"
 #include "itkProgressReporter.h"
@@ -39,7 +38,6 @@ CannyEdgeDetectionImageFilter< TInputImage, TOutputImage >::CannyEdgeDetectionIm
   m_MaximumError.Fill(0.01);
 
   m_GaussianFilter      = GaussianImageFilterType::New();
-  m_MultiplyImageFilter = MultiplyImageFilterType::New();
   m_UpdateBuffer1  = OutputImageType::New();
 
   // Set up neighborhood slices for all the dimensions.
@@ -214,9 +212,6 @@ CannyEdgeDetectionImageFilter< TInputImage, TOutputImage >
   output->Graft( this->GetOutput() );
   this->m_OutputImage = output;
 
-  typename ZeroCrossingImageFilter< TOutputImage, TOutputImage >::Pointer
-  zeroCrossFilter = ZeroCrossingImageFilter< TOutputImage, TOutputImage >::New();
-
   this->AllocateUpdateBuffer();
 
   // 1.Apply the Gaussian Filter to the input image
@@ -247,27 +242,25 @@ CannyEdgeDetectionImageFilter< TInputImage, TOutputImage >
       { this->ThreadedCompute2ndDerivativePos(outputRegionForThread); },
       progress2.GetProcessObject() );
 
-  // 3. Non-maximum suppression
-
-  // Calculate the zero crossings of the 2nd directional derivative and write
-  // the result to output buffer.
-  zeroCrossFilter->SetInput( this->m_OutputImage );
-  zeroCrossFilter->Update();
-  this->UpdateProgress(0.92f);
-
-  // 4. Hysteresis Thresholding
+  // The smoothed image is no longer needed once both derivative
+  // passes are done, release it before non-maximum suppression.
+  m_GaussianFilter->GetOutput()->ReleaseData();
 
-  // First get all the edges corresponding to zerocrossings
-  m_MultiplyImageFilter->SetInput1(m_UpdateBuffer1);
-  m_MultiplyImageFilter->SetInput2( zeroCrossFilter->GetOutput() );
+  // 3. Non-maximum suppression
 
-  // To save memory, we will graft the output of the m_GaussianFilter,
-  // which is no longer needed, into the m_MultiplyImageFilter.
-  m_MultiplyImageFilter->GraftOutput( m_GaussianFilter->GetOutput() );
-  m_MultiplyImageFilter->Update();
-  this->UpdateProgress(0.95f);
+  // Calculate the zero crossings of the 2nd directional derivative
+  // and mask the gradient magnitude response with them, in a single
+  // fused pass writing in place over the response buffer. This avoids
+  // materializing the zero-crossing image and sweeping it back in a
+  // separate multiplication.
+  ProgressTransformer progress3( 0.9f, 0.95f, this );
+  this->GetMultiThreader()->template ParallelizeImageRegion<TOutputImage::ImageDimension>(
+      this->GetOutput()->GetRequestedRegion(),
+      [this](const OutputImageRegionType & outputRegionForThread)
+      { this->ThreadedZeroCrossingAndMultiply(outputRegionForThread); },
+      progress3.GetProcessObject() );
 
-  // Then do the double threshoulding upon the edge responses
+  // 4. Hysteresis Thresholding upon the edge responses
   this->HysteresisThresholding();
   this->UpdateProgress(0.99f);
 
@@ -284,7 +277,7 @@ CannyEdgeDetectionImageFilter< TInputImage, TOutputImage >
   // This is the Zero crossings of the Second derivative multiplied with the
   // gradients of the image. HysteresisThresholding of this image should give
   // the Canny output.
-  typename OutputImageType::Pointer input = m_MultiplyImageFilter->GetOutput();
+  typename OutputImageType::Pointer input = m_UpdateBuffer1;
   float value;
 
   ListNodeType *node;
@@ -294,17 +287,9 @@ CannyEdgeDetectionImageFilter< TInputImage, TOutputImage >
 
   oit.GoToBegin();
 
-  ImageRegionIterator< TOutputImage > uit( this->m_OutputImage,
-                                           this->m_OutputImage->GetRequestedRegion() );
-  uit.GoToBegin();
-  while ( !uit.IsAtEnd() )
-    {
-    uit.Value() = NumericTraits< OutputImagePixelType >::ZeroValue();
-    ++uit;
-    }
+  this->m_OutputImage->FillBuffer( NumericTraits< OutputImagePixelType >::ZeroValue() );
 
-  const OutputImageType *multiplyImageFilterOutput =
-    this->m_MultiplyImageFilter->GetOutput();
+  const OutputImageType *nonMaximumSuppressionImage = this->m_UpdateBuffer1;
   while ( !oit.IsAtEnd() )
     {
     value = oit.Value();
@@ -314,7 +299,7 @@ CannyEdgeDetectionImageFilter< TInputImage, TOutputImage >
       node = m_NodeStore->Borrow();
       node->m_Value = oit.GetIndex();
       m_NodeList->PushFront(node);
-      FollowEdge( oit.GetIndex(), multiplyImageFilterOutput );
+      FollowEdge( oit.GetIndex(), nonMaximumSuppressionImage );
       }
 
     ++oit;
@@ -485,6 +470,87 @@ CannyEdgeDetectionImageFilter< TInputImage, TOutputImage >
     }
 }
 
+template< typename TInputImage, typename TOutputImage >
+void
+CannyEdgeDetectionImageFilter< TInputImage, TOutputImage >
+::ThreadedZeroCrossingAndMultiply(const OutputImageRegionType & outputRegionForThread)
+{
+  ZeroFluxNeumannBoundaryCondition< TOutputImage > nbc;
+
+  // Here input is the 2nd derivative result, and the gradient
+  // magnitude responses in m_UpdateBuffer1 are masked in place with
+  // its zero crossings. The crossing criterion is the same as the one
+  // of the ZeroCrossingImageFilter: a sign change with a neighbor
+  // along any axis marks the pixel closest to zero, ties going to the
+  // positive side.
+  typename OutputImageType::Pointer input = this->m_OutputImage;
+
+  // Set iterator radius
+  Size< ImageDimension > radius; radius.Fill(1);
+
+  // Find the data-set boundary "faces"
+  typename NeighborhoodAlgorithm::ImageBoundaryFacesCalculator< TOutputImage >::
+  FaceListType faceList;
+  NeighborhoodAlgorithm::ImageBoundaryFacesCalculator< TOutputImage > bC;
+  faceList = bC(input, outputRegionForThread, radius);
+
+  typename NeighborhoodAlgorithm::ImageBoundaryFacesCalculator< TOutputImage >::
+  FaceListType::iterator fit;
+
+  OutputImagePixelType zero = NumericTraits< OutputImagePixelType >::ZeroValue();
+
+  FixedArray< OffsetValueType, 2 * ImageDimension > offset;
+  for ( unsigned int i = 0; i < ImageDimension; i++ )
+    {
+    offset[i] = -1 * static_cast< OffsetValueType >( m_Stride[i] );
+    offset[i + ImageDimension] = m_Stride[i];
+    }
+
+  for ( fit = faceList.begin(); fit != faceList.end(); ++fit )
+    {
+    ConstNeighborhoodIterator< TOutputImage > bit(radius, input, *fit);
+    ImageRegionIterator< TOutputImage > it(m_UpdateBuffer1, *fit);
+    bit.OverrideBoundaryCondition(&nbc);
+    bit.GoToBegin();
+    it.GoToBegin();
+
+    while ( !bit.IsAtEnd() )
+      {
+      const OutputImagePixelType this_one = bit.GetPixel(m_Center);
+      bool isEdge = false;
+      for ( unsigned int i = 0; i < ImageDimension * 2; i++ )
+        {
+        const OutputImagePixelType that = bit.GetPixel(m_Center + offset[i]);
+        if ( ( ( this_one < zero ) && ( that > zero ) )
+             || ( ( this_one > zero ) && ( that < zero ) )
+             || ( ( Math::ExactlyEquals(this_one, zero) ) && ( Math::NotExactlyEquals(that, zero) ) )
+             || ( ( Math::NotExactlyEquals(this_one, zero) ) && ( Math::ExactlyEquals(that, zero) ) ) )
+          {
+          const OutputImagePixelType abs_this_one = itk::Math::abs(this_one);
+          const OutputImagePixelType abs_that = itk::Math::abs(that);
+          if ( abs_this_one < abs_that )
+            {
+            isEdge = true;
+            break;
+            }
+          else if ( Math::ExactlyEquals(abs_this_one, abs_that) && i >= ImageDimension )
+            {
+            isEdge = true;
+            break;
+            }
+          }
+        }
+
+      if ( !isEdge )
+        {
+        it.Value() = zero;
+        }
+      ++bit;
+      ++it;
+      }
+    }
+}
+
 template< typename TInputImage, typename TOutputImage >
 void
 CannyEdgeDetectionImageFilter< TInputImage, TOutputImage >
@@ -505,7 +571,6 @@ CannyEdgeDetectionImageFilter< TInputImage, TOutputImage >
   os << "Stride: "
      << m_Stride << std::endl;
   itkPrintSelfObjectMacro( GaussianFilter );
-  itkPrintSelfObjectMacro( MultiplyImageFilter );
   itkPrintSelfObjectMacro( UpdateBuffer1 );
 }
 } //end of itk namespace
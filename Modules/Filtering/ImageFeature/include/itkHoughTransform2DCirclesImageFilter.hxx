@@ -23,8 +23,13 @@
 #include "itkDiscreteGaussianImageFilter.h"
 #include "itkGaussianDerivativeImageFunction.h"
 #include "itkMinimumMaximumImageCalculator.h"
+#include "itkMultiThreaderBase.h"
 #include "itkMath.h"
 
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
 namespace itk
 {
 template< typename TInputPixelType, typename TOutputPixelType, typename TRadiusPixelType >
@@ -100,12 +105,6 @@ HoughTransform2DCirclesImageFilter< TInputPixelType, TOutputPixelType, TRadiusPi
   outputImage->FillBuffer(0);
 
   using DoGFunctionType = GaussianDerivativeImageFunction< InputImageType >;
-  const auto DoGFunction = DoGFunctionType::New();
-  DoGFunction->SetSigma(m_SigmaGradient);
-  DoGFunction->SetUseImageSpacing(m_UseImageSpacing);
-  // Set input image _after_ setting the other GaussianDerivative properties,
-  // to avoid multiple kernel recomputation within GaussianDerivativeImageFunction.
-  DoGFunction->SetInputImage(inputImage);
 
   m_RadiusImage = RadiusImageType::New();
 
@@ -115,30 +114,110 @@ HoughTransform2DCirclesImageFilter< TInputPixelType, TOutputPixelType, TRadiusPi
   m_RadiusImage->SetDirection( inputImage->GetDirection() );
   m_RadiusImage->Allocate( true ); // initialize buffer to zero
 
-  ImageRegionConstIteratorWithIndex< InputImageType > image_it( inputImage,
-    inputImage->GetRequestedRegion() );
-  image_it.GoToBegin();
-
   const ImageRegion< 2 > & region = outputImage->GetRequestedRegion();
 
-  while ( !image_it.IsAtEnd() )
+  MultiThreaderBase::Pointer threader = MultiThreaderBase::New();
+
+  // Gather the voting candidates in parallel. Most pixels are rejected
+  // by the cheap intensity threshold or by the flatness test on the
+  // gradient norm, so the voting loop below only sees the short list
+  // of edge pixels with their normalized gradients.
+  struct CandidateType
     {
-    if ( image_it.Get() > m_Threshold )
+    Index< 2 > m_Index;
+    double m_Vx;
+    double m_Vy;
+    };
+
+  std::vector< CandidateType > candidates;
+  std::mutex                   candidatesLock;
+
+  threader->ParallelizeImageRegion< 2 >( inputImage->GetRequestedRegion(),
+    [this, &inputImage, &candidates, &candidatesLock](const ImageRegion< 2 > & chunk)
       {
-      const Index< 2 > inputIndex = image_it.GetIndex();
-      const typename DoGFunctionType::VectorType grad =
-        DoGFunction->DoGFunctionType::EvaluateAtIndex( inputIndex );
+      // each chunk needs its own function object - EvaluateAtIndex()
+      // is not reentrant
+      const auto chunkDoGFunction = DoGFunctionType::New();
+      chunkDoGFunction->SetSigma(m_SigmaGradient);
+      chunkDoGFunction->SetUseImageSpacing(m_UseImageSpacing);
+      chunkDoGFunction->SetInputImage(inputImage);
+
+      std::vector< CandidateType > chunkCandidates;
+
+      ImageRegionConstIteratorWithIndex< InputImageType > image_it( inputImage, chunk );
+      for ( image_it.GoToBegin(); !image_it.IsAtEnd(); ++image_it )
+        {
+        if ( image_it.Get() > m_Threshold )
+          {
+          const Index< 2 > inputIndex = image_it.GetIndex();
+          const typename DoGFunctionType::VectorType grad =
+            chunkDoGFunction->DoGFunctionType::EvaluateAtIndex( inputIndex );
+
+          const double Vx = grad[0];
+          const double Vy = grad[1];
+
+          const double norm = std::sqrt(Vx * Vx + Vy * Vy);
+
+          // if the gradient is not flat (using GradientNormThreshold to
+          // estimate flatness)
+          if ( norm > m_GradientNormThreshold )
+            {
+            chunkCandidates.push_back( { inputIndex, Vx / norm, Vy / norm } );
+            }
+          }
+        }
 
-      double Vx = grad[0];
-      double Vy = grad[1];
+      const std::lock_guard< std::mutex > lockGuard(candidatesLock);
+      candidates.insert( candidates.end(), chunkCandidates.begin(), chunkCandidates.end() );
+      },
+    nullptr );
 
-      const double norm = std::sqrt(Vx * Vx + Vy * Vy);
+  // restore the scan order, so the votes are accumulated in the same
+  // order whatever the region decomposition - the radius sums are
+  // floating point, and addition order matters for reproducibility
+  std::sort( candidates.begin(), candidates.end(),
+    [](const CandidateType & a, const CandidateType & b)
+      {
+      return ( a.m_Index[1] != b.m_Index[1] ) ? ( a.m_Index[1] < b.m_Index[1] )
+                                              : ( a.m_Index[0] < b.m_Index[0] );
+      } );
+
+  // Vote in parallel without locks by partitioning the accumulator in
+  // horizontal bands: every worker walks the candidates whose votes
+  // can reach its band, and only writes the votes that land inside it,
+  // so each accumulator pixel is written by exactly one worker. A vote
+  // can land slightly beyond the maximum radius because the sweep loop
+  // checks the distance after voting, hence the small safety margin.
+  const double         voteReach = m_MaximumRadius + 3.0;
+  const IndexValueType regionFirstRow = region.GetIndex(1);
+  const SizeValueType  regionRows = region.GetSize(1);
+  const SizeValueType  bandCount =
+    std::max< SizeValueType >( 1, std::min< SizeValueType >( this->GetNumberOfWorkUnits(), regionRows ) );
+
+  OutputImageType * rawOutputImage = outputImage.GetPointer();
+  RadiusImageType * rawRadiusImage = m_RadiusImage.GetPointer();
+
+  threader->ParallelizeArray( 0, bandCount,
+    [this, &candidates, &region, rawOutputImage, rawRadiusImage,
+     voteReach, regionFirstRow, regionRows, bandCount](SizeValueType band)
+      {
+      const IndexValueType bandFirstRow =
+        regionFirstRow + static_cast< IndexValueType >( ( regionRows * band ) / bandCount );
+      const IndexValueType bandLastRow =
+        regionFirstRow + static_cast< IndexValueType >( ( regionRows * ( band + 1 ) ) / bandCount ) - 1;
 
-      // if the gradient is not flat (using GradientNormThreshold to estimate flatness)
-      if ( norm > m_GradientNormThreshold )
+      for ( const CandidateType & candidate : candidates )
         {
-        Vx /= norm;
-        Vy /= norm;
+        // skip the candidates that cannot reach this band
+        if ( candidate.m_Index[1] + voteReach < bandFirstRow
+             || candidate.m_Index[1] - voteReach > bandLastRow )
+          {
+          continue;
+          }
+
+        const Index< 2 > inputIndex = candidate.m_Index;
+        const double     Vx = candidate.m_Vx;
+        const double     Vy = candidate.m_Vy;
 
         for ( double angle = -m_SweepAngle; angle <= m_SweepAngle; angle += 0.05 )
           {
@@ -158,8 +237,11 @@ HoughTransform2DCirclesImageFilter< TInputPixelType, TOutputPixelType, TRadiusPi
               distance = std::sqrt(static_cast<double>((outputIndex[0] - inputIndex[0]) * (outputIndex[0] - inputIndex[0])
                                  + (outputIndex[1] - inputIndex[1]) * (outputIndex[1] - inputIndex[1])));
 
-              ++outputImage->GetPixel(outputIndex);
-              m_RadiusImage->GetPixel(outputIndex) += distance;
+              if ( outputIndex[1] >= bandFirstRow && outputIndex[1] <= bandLastRow )
+                {
+                ++rawOutputImage->GetPixel(outputIndex);
+                rawRadiusImage->GetPixel(outputIndex) += distance;
+                }
               }
             else
               {
@@ -170,26 +252,28 @@ HoughTransform2DCirclesImageFilter< TInputPixelType, TOutputPixelType, TRadiusPi
           while ( distance < m_MaximumRadius );
           }
         }
-      }
-    ++image_it;
-    }
+      },
+    nullptr );
 
   // Compute the average radius
-  ImageRegionConstIterator< OutputImageType > output_it( outputImage,
-    outputImage->GetLargestPossibleRegion() );
-  ImageRegionIterator< RadiusImageType > radius_it( m_RadiusImage,
-    m_RadiusImage->GetLargestPossibleRegion() );
-  output_it.GoToBegin();
-  radius_it.GoToBegin();
-  while ( !output_it.IsAtEnd() )
-    {
-    if ( output_it.Get() > 1 )
+  threader->ParallelizeImageRegion< 2 >( outputImage->GetLargestPossibleRegion(),
+    [rawOutputImage, rawRadiusImage](const ImageRegion< 2 > & chunk)
       {
-      radius_it.Value() /= output_it.Get();
-      }
-    ++output_it;
-    ++radius_it;
-    }
+      ImageRegionConstIterator< OutputImageType > output_it( rawOutputImage, chunk );
+      ImageRegionIterator< RadiusImageType > radius_it( rawRadiusImage, chunk );
+      output_it.GoToBegin();
+      radius_it.GoToBegin();
+      while ( !output_it.IsAtEnd() )
+        {
+        if ( output_it.Get() > 1 )
+          {
+          radius_it.Value() /= output_it.Get();
+          }
+        ++output_it;
+        ++radius_it;
+        }
+      },
+    nullptr );
 }
 
 template< typename TInputPixelType, typename TOutputPixelType, typename TRadiusPixelType >
@@ -0,0 +1,154 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkComposedFunctor_h
+#define itkComposedFunctor_h
+
+#include "itkUnaryFunctorImageFilter.h"
+#include "itkBinaryFunctorImageFilter.h"
+
+#include <utility>
+
+namespace itk
+{
+namespace Functor
+{
+/** \class ComposedFunctor
+ * \brief Chains several pixel functors into a single per-pixel functor.
+ *
+ * A chain of functor filters makes one full sweep over the image per
+ * filter, so a chain like subtract, divide, clamp, cast is four
+ * bandwidth-bound passes. ComposedFunctor composes the per-pixel
+ * functions at compile time instead: the first functor is applied to
+ * the pixel (or pixel pair, for a binary first stage) and each
+ * remaining functor is applied to the previous result, all within one
+ * pass. Plugged into UnaryFunctorImageFilter or
+ * BinaryFunctorImageFilter - see the ComposedUnaryFunctorImageFilter
+ * and ComposedBinaryFunctorImageFilter aliases - the composition keeps
+ * the usual ProcessObject interface while the image is only traversed
+ * once.
+ *
+ * Functors that carry parameters can be reached through
+ * GetFirstFunctor() and GetRemainingFunctor() before updating the
+ * filter, e.g.
+ *
+   \code
+   using NormalizeFilterType = itk::ComposedBinaryFunctorImageFilter< ImageType, ImageType, OutputImageType,
+     itk::Functor::Sub2< PixelType, PixelType, double >,
+     itk::Functor::IntensityLinearTransform< double, OutputPixelType > >;
+
+   NormalizeFilterType::Pointer normalize = NormalizeFilterType::New();
+   normalize->GetFunctor().GetRemainingFunctor().GetFirstFunctor().SetFactor( scale );
+   \endcode
+ *
+ * Each functor must be default constructible and provide the usual
+ * const call operator and inequality comparison of the functor filter
+ * convention.
+ *
+ * \sa UnaryFunctorImageFilter
+ * \sa BinaryFunctorImageFilter
+ * \ingroup ITKImageFilterBase
+ */
+template< typename TFirstFunctor, typename... TRemainingFunctors >
+class ComposedFunctor
+{
+public:
+  using FirstFunctorType = TFirstFunctor;
+  using RemainingFunctorType = ComposedFunctor< TRemainingFunctors... >;
+
+  bool operator!=(const ComposedFunctor & other) const
+  {
+    return m_FirstFunctor != other.m_FirstFunctor
+           || m_RemainingFunctor != other.m_RemainingFunctor;
+  }
+
+  bool operator==(const ComposedFunctor & other) const
+  {
+    return !( *this != other );
+  }
+
+  template< typename... TInputs >
+  auto operator()(const TInputs &... inputs) const
+    -> decltype( std::declval< const RemainingFunctorType & >()(
+                   std::declval< const TFirstFunctor & >()( inputs... ) ) )
+  {
+    return m_RemainingFunctor( m_FirstFunctor(inputs...) );
+  }
+
+  /** Access the first functor of the chain, e.g. to set its
+   * parameters. */
+  FirstFunctorType &       GetFirstFunctor() { return m_FirstFunctor; }
+  const FirstFunctorType & GetFirstFunctor() const { return m_FirstFunctor; }
+
+  /** Access the composition of the remaining functors of the chain. */
+  RemainingFunctorType &       GetRemainingFunctor() { return m_RemainingFunctor; }
+  const RemainingFunctorType & GetRemainingFunctor() const { return m_RemainingFunctor; }
+
+private:
+  FirstFunctorType     m_FirstFunctor;
+  RemainingFunctorType m_RemainingFunctor;
+};
+
+/** Recursion tail: a composition of one functor simply forwards to
+ * it. */
+template< typename TFunctor >
+class ComposedFunctor< TFunctor >
+{
+public:
+  using FirstFunctorType = TFunctor;
+
+  bool operator!=(const ComposedFunctor & other) const
+  {
+    return m_FirstFunctor != other.m_FirstFunctor;
+  }
+
+  bool operator==(const ComposedFunctor & other) const
+  {
+    return !( *this != other );
+  }
+
+  template< typename... TInputs >
+  auto operator()(const TInputs &... inputs) const
+    -> decltype( std::declval< const TFunctor & >()( inputs... ) )
+  {
+    return m_FirstFunctor(inputs...);
+  }
+
+  FirstFunctorType &       GetFirstFunctor() { return m_FirstFunctor; }
+  const FirstFunctorType & GetFirstFunctor() const { return m_FirstFunctor; }
+
+private:
+  FirstFunctorType m_FirstFunctor;
+};
+} // end namespace Functor
+
+/** Single-pass filter applying a chain of unary functors, first one
+ * first. */
+template< typename TInputImage, typename TOutputImage, typename... TFunctors >
+using ComposedUnaryFunctorImageFilter =
+  UnaryFunctorImageFilter< TInputImage, TOutputImage,
+                           Functor::ComposedFunctor< TFunctors... > >;
+
+/** Single-pass filter whose first functor combines the two inputs and
+ * whose remaining functors transform the result. */
+template< typename TInputImage1, typename TInputImage2, typename TOutputImage, typename... TFunctors >
+using ComposedBinaryFunctorImageFilter =
+  BinaryFunctorImageFilter< TInputImage1, TInputImage2, TOutputImage,
+                            Functor::ComposedFunctor< TFunctors... > >;
+} // end namespace itk
+
+#endif
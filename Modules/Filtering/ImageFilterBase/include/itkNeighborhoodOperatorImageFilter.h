@@ -23,6 +23,8 @@
 #include "itkImage.h"
 #include "itkZeroFluxNeumannBoundaryCondition.h"
 
+#include <type_traits>
+
 namespace itk
 {
 /** \class NeighborhoodOperatorImageFilter
@@ -175,6 +177,21 @@ protected:
   {  Superclass::PrintSelf(os, indent); }
 
 private:
+  /** Filter a face free of boundary effects by sliding a one
+   * dimensional operator along contiguous scanlines with raw
+   * pointers. The pixel loads are contiguous along the fastest moving
+   * dimension for every operator axis, so the compiler can vectorize
+   * the inner loop; boundary faces stay on the neighborhood iterator.
+   * The arithmetic matches NeighborhoodInnerProduct cast for cast, so
+   * both paths produce identical values. Returns false when the
+   * operator is not one dimensional, leaving the face to the
+   * neighborhood iterator. The tag overloads keep the raw pointer
+   * code out of instantiations whose pixels are not stored directly
+   * in the buffer (e.g. VectorImage). */
+  bool FilterScanlines(const OutputImageRegionType & faceRegion);
+  bool FilterScanlines(const OutputImageRegionType & faceRegion, std::false_type);
+  bool FilterScanlines(const OutputImageRegionType & faceRegion, std::true_type);
+
   /** Internal operator used to filter the image. */
   OutputNeighborhoodType m_Operator;
 
@@ -77,6 +77,120 @@ NeighborhoodOperatorImageFilter< TInputImage, TOutputImage, TOperatorValueType >
     }
 }
 
+template< typename TInputImage, typename TOutputImage, typename TOperatorValueType >
+bool
+NeighborhoodOperatorImageFilter< TInputImage, TOutputImage, TOperatorValueType >
+::FilterScanlines(const OutputImageRegionType & faceRegion)
+{
+  return this->FilterScanlines( faceRegion,
+    std::integral_constant< bool,
+      std::is_same< InputPixelType, InputInternalPixelType >::value
+      && std::is_same< OutputPixelType, OutputInternalPixelType >::value >() );
+}
+
+template< typename TInputImage, typename TOutputImage, typename TOperatorValueType >
+bool
+NeighborhoodOperatorImageFilter< TInputImage, TOutputImage, TOperatorValueType >
+::FilterScanlines(const OutputImageRegionType & itkNotUsed(faceRegion), std::false_type)
+{
+  return false;
+}
+
+template< typename TInputImage, typename TOutputImage, typename TOperatorValueType >
+bool
+NeighborhoodOperatorImageFilter< TInputImage, TOutputImage, TOperatorValueType >
+::FilterScanlines(const OutputImageRegionType & faceRegion, std::true_type)
+{
+  // the scanline path handles one dimensional operators, the
+  // separable passes filters like DiscreteGaussianImageFilter run
+  const typename OutputNeighborhoodType::SizeType radius = m_Operator.GetRadius();
+  unsigned int axis = InputImageDimension;
+  for ( unsigned int d = 0; d < InputImageDimension; ++d )
+    {
+    if ( radius[d] > 0 )
+      {
+      if ( axis != InputImageDimension )
+        {
+        return false;
+        }
+      axis = d;
+      }
+    }
+  if ( axis == InputImageDimension )
+    {
+    return false;
+    }
+  if ( faceRegion.GetNumberOfPixels() == 0 )
+    {
+    return true;
+    }
+
+  const InputImageType *input = this->GetInput();
+  OutputImageType *output = this->GetOutput();
+  const InputPixelType *inputBuffer = input->GetBufferPointer();
+  OutputPixelType *outputBuffer = output->GetBufferPointer();
+
+  // the stride of the operator axis in the input buffer, in pixels
+  const typename InputImageType::RegionType inputBufferedRegion =
+    input->GetBufferedRegion();
+  OffsetValueType axisStride = 1;
+  for ( unsigned int d = 0; d < axis; ++d )
+    {
+    axisStride *= static_cast< OffsetValueType >( inputBufferedRegion.GetSize(d) );
+    }
+
+  const unsigned int numberOfTaps = m_Operator.Size();
+  const std::vector< OperatorValueType > taps( m_Operator.Begin(), m_Operator.End() );
+  std::vector< OffsetValueType > tapOffset(numberOfTaps);
+  for ( unsigned int t = 0; t < numberOfTaps; ++t )
+    {
+    tapOffset[t] = ( static_cast< OffsetValueType >( t )
+                     - static_cast< OffsetValueType >( radius[axis] ) ) * axisStride;
+    }
+
+  using InputPixelRealType = typename NumericTraits< InputPixelType >::RealType;
+  using AccumulateRealType = typename NumericTraits< InputPixelRealType >::AccumulateType;
+  using ComputingPixelValueType = typename NumericTraits< ComputingPixelType >::ValueType;
+
+  const auto lineLength = static_cast< OffsetValueType >( faceRegion.GetSize(0) );
+  typename OutputImageRegionType::IndexType index = faceRegion.GetIndex();
+  for ( ;; )
+    {
+    const InputPixelType *in = inputBuffer + input->ComputeOffset(index);
+    OutputPixelType *out = outputBuffer + output->ComputeOffset(index);
+    for ( OffsetValueType x = 0; x < lineLength; ++x )
+      {
+      // same casts and summation order as NeighborhoodInnerProduct,
+      // so both paths produce identical values
+      AccumulateRealType sum = NumericTraits< AccumulateRealType >::ZeroValue();
+      for ( unsigned int t = 0; t < numberOfTaps; ++t )
+        {
+        sum += static_cast< AccumulateRealType >(
+          static_cast< ComputingPixelValueType >( taps[t] )
+          * static_cast< InputPixelRealType >( in[x + tapOffset[t]] ) );
+        }
+      out[x] = static_cast< OutputPixelType >(
+        static_cast< ComputingPixelType >( sum ) );
+      }
+    // advance to the next scanline
+    unsigned int d = 1;
+    for ( ; d < InputImageDimension; ++d )
+      {
+      if ( ++index[d] < faceRegion.GetIndex(d)
+                        + static_cast< OffsetValueType >( faceRegion.GetSize(d) ) )
+        {
+        break;
+        }
+      index[d] = faceRegion.GetIndex(d);
+      }
+    if ( d >= InputImageDimension )
+      {
+      break;
+      }
+    }
+  return true;
+}
+
 template< typename TInputImage, typename TOutputImage, typename TOperatorValueType >
 void
 NeighborhoodOperatorImageFilter< TInputImage, TOutputImage, TOperatorValueType >
@@ -107,6 +221,12 @@ NeighborhoodOperatorImageFilter< TInputImage, TOutputImage, TOperatorValueType >
   ConstNeighborhoodIterator< InputImageType > bit;
   for ( fit = faceList.begin(); fit != faceList.end(); ++fit )
     {
+    // the first face is free of boundary effects, so a one dimensional
+    // operator can run over it with the vectorizable scanline path
+    if ( fit == faceList.begin() && this->FilterScanlines(*fit) )
+      {
+      continue;
+      }
     bit = ConstNeighborhoodIterator< InputImageType >(m_Operator.GetRadius(), input, *fit);
     bit.OverrideBoundaryCondition(m_BoundsCondition);
     it = ImageRegionIterator< OutputImageType >(output, *fit);
@@ -0,0 +1,150 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkNeighborhoodScanlineImageFilter_hxx
+#define itkNeighborhoodScanlineImageFilter_hxx
+#include "itkNeighborhoodScanlineImageFilter.h"
+
+#include "itkImageRegionIterator.h"
+#include "itkNeighborhoodAlgorithm.h"
+#include "itkZeroFluxNeumannBoundaryCondition.h"
+
+#include <vector>
+
+namespace itk
+{
+template< typename TInputImage, typename TOutputImage >
+NeighborhoodScanlineImageFilter< TInputImage, TOutputImage >
+::NeighborhoodScanlineImageFilter()
+{
+  this->DynamicMultiThreadingOn();
+}
+
+template< typename TInputImage, typename TOutputImage >
+void
+NeighborhoodScanlineImageFilter< TInputImage, TOutputImage >
+::DynamicThreadedGenerateData(const OutputImageRegionType & outputRegionForThread)
+{
+  typename OutputImageType::Pointer output = this->GetOutput();
+  typename  InputImageType::ConstPointer input  = this->GetInput();
+
+  const RadiusType radius = this->GetRadius();
+
+  // Find the data-set boundary "faces". The first face is the interior,
+  // i.e. the part of the region whose neighborhoods never leave the
+  // buffer.
+  typename NeighborhoodAlgorithm::ImageBoundaryFacesCalculator< InputImageType >::FaceListType faceList;
+  NeighborhoodAlgorithm::ImageBoundaryFacesCalculator< InputImageType > bC;
+  faceList = bC(input, outputRegionForThread, radius);
+
+  typename NeighborhoodAlgorithm::ImageBoundaryFacesCalculator< InputImageType >::FaceListType::iterator
+    fit = faceList.begin();
+
+  if ( fit != faceList.end() )
+    {
+    const InputImageRegionType interiorRegion = *fit;
+    ++fit;
+
+    if ( interiorRegion.GetNumberOfPixels() > 0 )
+      {
+      // Element strides of the buffered input region.
+      const typename InputImageRegionType::SizeType bufferedSize =
+        input->GetBufferedRegion().GetSize();
+      OffsetValueType strides[ImageDimension];
+      strides[0] = 1;
+      for ( unsigned int i = 1; i < ImageDimension; ++i )
+        {
+        strides[i] = strides[i - 1] * static_cast< OffsetValueType >( bufferedSize[i - 1] );
+        }
+
+      // Buffer offsets of the neighborhood positions relative to its
+      // center, in the raster order used by the neighborhood iterator.
+      SizeValueType neighborhoodSize = 1;
+      for ( unsigned int i = 0; i < ImageDimension; ++i )
+        {
+        neighborhoodSize *= 2 * radius[i] + 1;
+        }
+
+      std::vector< OffsetValueType > offsets(neighborhoodSize);
+      for ( SizeValueType k = 0; k < neighborhoodSize; ++k )
+        {
+        SizeValueType   rest = k;
+        OffsetValueType offset = 0;
+        for ( unsigned int i = 0; i < ImageDimension; ++i )
+          {
+          const SizeValueType span = 2 * radius[i] + 1;
+          offset += ( static_cast< OffsetValueType >( rest % span )
+                      - static_cast< OffsetValueType >( radius[i] ) ) * strides[i];
+          rest /= span;
+          }
+        offsets[k] = offset;
+        }
+
+      const InputPixelType *inputBuffer = input->GetBufferPointer();
+      OutputPixelType      *outputBuffer = output->GetBufferPointer();
+
+      // Walk the interior scanline by scanline with raw pointers.
+      const SizeValueType lineLength = interiorRegion.GetSize()[0];
+      const SizeValueType numberOfLines = interiorRegion.GetNumberOfPixels() / lineLength;
+
+      using IndexType = typename InputImageRegionType::IndexType;
+      IndexType lineIndex = interiorRegion.GetIndex();
+
+      for ( SizeValueType line = 0; line < numberOfLines; ++line )
+        {
+        const InputPixelType *inputLine = inputBuffer + input->ComputeOffset(lineIndex);
+        OutputPixelType      *outputLine = outputBuffer + output->ComputeOffset(lineIndex);
+
+        this->EvaluateInteriorScanline( inputLine, outputLine, lineLength,
+                                        offsets.data(), neighborhoodSize );
+
+        // advance to the next scanline of the region
+        for ( unsigned int i = 1; i < ImageDimension; ++i )
+          {
+          ++lineIndex[i];
+          if ( lineIndex[i] < interiorRegion.GetIndex()[i]
+                              + static_cast< OffsetValueType >( interiorRegion.GetSize()[i] ) )
+            {
+            break;
+            }
+          lineIndex[i] = interiorRegion.GetIndex()[i];
+          }
+        }
+      }
+    }
+
+  // Process the boundary faces with the boundary condition installed.
+  ZeroFluxNeumannBoundaryCondition< InputImageType > nbc;
+
+  for ( ; fit != faceList.end(); ++fit )
+    {
+    ConstNeighborhoodIteratorType bit(radius, input, *fit);
+    ImageRegionIterator< OutputImageType > it(output, *fit);
+    bit.OverrideBoundaryCondition(&nbc);
+    bit.GoToBegin();
+
+    while ( !bit.IsAtEnd() )
+      {
+      it.Set( this->EvaluateAtNeighborhood(bit) );
+      ++bit;
+      ++it;
+      }
+    }
+}
+} // end namespace itk
+
+#endif
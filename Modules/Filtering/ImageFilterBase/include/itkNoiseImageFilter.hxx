@@ -19,12 +19,14 @@
 #define itkNoiseImageFilter_hxx
 #include "itkNoiseImageFilter.h"
 
+#include "itkBoxUtilities.h"
 #include "itkConstNeighborhoodIterator.h"
 #include "itkNeighborhoodInnerProduct.h"
 #include "itkImageRegionIterator.h"
 #include "itkNeighborhoodAlgorithm.h"
 #include "itkOffset.h"
 #include "itkProgressReporter.h"
+#include "itkVector.h"
 
 namespace itk
 {
@@ -64,9 +66,63 @@ NoiseImageFilter< TInputImage, TOutputImage >
   InputRealType var;
   InputRealType num;
 
+  fit = faceList.begin();
+
+  // The first face is the interior. Compute it from a summed-area
+  // table holding the running sum of the pixel values and of their
+  // squares: one pass builds the table, then every output pixel costs
+  // a constant number of corner lookups, whatever the radius. The
+  // window of an interior pixel is always complete, so the result is
+  // the same as the direct neighborhood walk below.
+  if ( fit != faceList.end() )
+    {
+    if ( fit->GetNumberOfPixels() > 0 )
+      {
+      using AccPixType = Vector< InputRealType, 2 >;
+      using AccumImageType = Image< AccPixType, TInputImage::ImageDimension >;
+
+      typename TInputImage::SizeType internalRadius;
+      for ( i = 0; i < TInputImage::ImageDimension; i++ )
+        {
+        internalRadius[i] = this->GetRadius()[i] + 1;
+        }
+
+      InputImageRegionType accumRegion = *fit;
+      accumRegion.PadByRadius(internalRadius);
+      accumRegion.Crop( input->GetRequestedRegion() );
+
+      typename AccumImageType::Pointer accImage = AccumImageType::New();
+      accImage->SetRegions(accumRegion);
+      accImage->Allocate();
+
+#if defined(ITKV4_COMPATIBILITY)
+      ProgressReporter progress( this, 1, 2 * accumRegion.GetNumberOfPixels() );
+#endif
+
+      BoxSquareAccumulateFunction< TInputImage, AccumImageType >(input, accImage,
+                                                                 accumRegion,
+                                                                 accumRegion
+#if defined(ITKV4_COMPATIBILITY)
+                                                                 , progress);
+#else
+                                                                 );
+#endif
+      BoxSigmaCalculatorFunction< AccumImageType, TOutputImage >(accImage, output,
+                                                                 accumRegion,
+                                                                 *fit,
+                                                                 this->GetRadius()
+#if defined(ITKV4_COMPATIBILITY)
+                                                                , progress);
+#else
+                                                                );
+#endif
+      }
+    ++fit;
+    }
+
   // Process each of the boundary faces.  These are N-d regions which border
   // the edge of the buffer.
-  for ( fit = faceList.begin(); fit != faceList.end(); ++fit )
+  for ( ; fit != faceList.end(); ++fit )
     {
     bit = ConstNeighborhoodIterator< InputImageType >(this->GetRadius(),
                                                       input, *fit);
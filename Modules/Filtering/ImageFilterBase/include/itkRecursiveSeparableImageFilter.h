@@ -22,6 +22,8 @@
 #include "itkNumericTraits.h"
 #include "itkVariableLengthVector.h"
 
+#include <type_traits>
+
 namespace itk
 {
 /** \class RecursiveSeparableImageFilter
@@ -224,6 +226,21 @@ protected:
     }
 
 private:
+  /** Filter a region with cache blocking when the lines run along a
+   * strided direction. Bundles of adjacent lines are gathered together
+   * walking the image along the contiguous dimension, filtered one
+   * line at a time from the cache resident bundle, and scattered back
+   * the same way, so the strided passes touch every cache line only
+   * once per sweep instead of once per pixel. Lines along dimension
+   * zero are already contiguous and keep the line iterator path, as do
+   * images whose pixels are not stored directly in the buffer (e.g.
+   * VectorImage); the tag overloads keep the raw pointer code out of
+   * those instantiations. Returns false when the region was left to
+   * the caller. */
+  bool FilterBlockedLines(const OutputImageRegionType & region);
+  bool FilterBlockedLines(const OutputImageRegionType & region, std::false_type);
+  bool FilterBlockedLines(const OutputImageRegionType & region, std::true_type);
+
   /** Direction in which the filter is to be applied
    * this should be in the range [0,ImageDimension-1]. */
   unsigned int m_Direction{ 0 };
@@ -21,7 +21,9 @@
 #include "itkRecursiveSeparableImageFilter.h"
 #include "itkObjectFactory.h"
 #include "itkImageLinearIteratorWithIndex.h"
+#include <algorithm>
 #include <new>
+#include <vector>
 
 namespace itk
 {
@@ -254,6 +256,132 @@ RecursiveSeparableImageFilter< TInputImage, TOutputImage >
     this->m_Direction, region, [this](const RegionType & lambdaRegion) { this->DynamicThreadedGenerateData(lambdaRegion); }, this);
 }
 
+template< typename TInputImage, typename TOutputImage >
+bool
+RecursiveSeparableImageFilter< TInputImage, TOutputImage >
+::FilterBlockedLines(const OutputImageRegionType & region)
+{
+  return this->FilterBlockedLines( region,
+    std::integral_constant< bool,
+      std::is_same< InputPixelType, typename TInputImage::InternalPixelType >::value
+      && std::is_same< typename TOutputImage::PixelType,
+                       typename TOutputImage::InternalPixelType >::value >() );
+}
+
+template< typename TInputImage, typename TOutputImage >
+bool
+RecursiveSeparableImageFilter< TInputImage, TOutputImage >
+::FilterBlockedLines(const OutputImageRegionType & itkNotUsed(region), std::false_type)
+{
+  return false;
+}
+
+template< typename TInputImage, typename TOutputImage >
+bool
+RecursiveSeparableImageFilter< TInputImage, TOutputImage >
+::FilterBlockedLines(const OutputImageRegionType & region, std::true_type)
+{
+  using OutputPixelType = typename TOutputImage::PixelType;
+
+  // lines along dimension zero are contiguous already
+  if ( this->m_Direction == 0 )
+    {
+    return false;
+    }
+  if ( region.GetNumberOfPixels() == 0 )
+    {
+    return true;
+    }
+
+  typename TInputImage::ConstPointer inputImage( this->GetInputImage () );
+  typename TOutputImage::Pointer     outputImage( this->GetOutput() );
+
+  const InputPixelType *inputBuffer = inputImage->GetBufferPointer();
+  OutputPixelType *outputBuffer = outputImage->GetBufferPointer();
+
+  // the stride of the filtered direction in each buffer, in pixels
+  OffsetValueType inputStride = 1;
+  OffsetValueType outputStride = 1;
+  for ( unsigned int d = 0; d < this->m_Direction; ++d )
+    {
+    inputStride *= static_cast< OffsetValueType >( inputImage->GetBufferedRegion().GetSize(d) );
+    outputStride *= static_cast< OffsetValueType >( outputImage->GetBufferedRegion().GetSize(d) );
+    }
+
+  const SizeValueType ln = region.GetSize(this->m_Direction);
+
+  // enough adjacent lines that the strided sweeps consume whole cache
+  // lines, few enough that the work arrays stay cache resident
+  constexpr OffsetValueType bundleLines = 16;
+
+  std::vector< RealType > inps(bundleLines * ln);
+  std::vector< RealType > outs(bundleLines * ln);
+  std::vector< RealType > scratch(ln);
+
+  using IndexType = typename OutputImageRegionType::IndexType;
+  IndexType index = region.GetIndex();
+  const OffsetValueType bundleBegin = region.GetIndex(0);
+  const OffsetValueType bundleEnd = bundleBegin
+                                    + static_cast< OffsetValueType >( region.GetSize(0) );
+  for ( ;; )
+    {
+    const OffsetValueType lines = std::min(bundleLines, bundleEnd - index[0]);
+    const InputPixelType *in = inputBuffer + inputImage->ComputeOffset(index);
+    OutputPixelType *out = outputBuffer + outputImage->ComputeOffset(index);
+
+    // gather the whole bundle before filtering so running in place
+    // cannot clobber pixels that are still unread
+    for ( SizeValueType i = 0; i < ln; ++i )
+      {
+      for ( OffsetValueType b = 0; b < lines; ++b )
+        {
+        inps[b * ln + i] = in[static_cast< OffsetValueType >( i ) * inputStride + b];
+        }
+      }
+
+    for ( OffsetValueType b = 0; b < lines; ++b )
+      {
+      this->FilterDataArray(&outs[b * ln], &inps[b * ln], scratch.data(), ln);
+      }
+
+    for ( SizeValueType i = 0; i < ln; ++i )
+      {
+      for ( OffsetValueType b = 0; b < lines; ++b )
+        {
+        out[static_cast< OffsetValueType >( i ) * outputStride + b] =
+          static_cast< OutputPixelType >( outs[b * ln + i] );
+        }
+      }
+
+    // advance to the next bundle of lines
+    index[0] += lines;
+    if ( index[0] < bundleEnd )
+      {
+      continue;
+      }
+    index[0] = bundleBegin;
+    unsigned int d = 1;
+    for ( ; d < TInputImage::ImageDimension; ++d )
+      {
+      if ( d == this->m_Direction )
+        {
+        continue;
+        }
+      if ( ++index[d] < region.GetIndex(d)
+                        + static_cast< OffsetValueType >( region.GetSize(d) ) )
+        {
+        break;
+        }
+      index[d] = region.GetIndex(d);
+      }
+    if ( d >= TInputImage::ImageDimension )
+      {
+      break;
+      }
+    }
+  return true;
+}
+
 /**
  * Compute Recursive filter
  * line by line in one of the dimensions
@@ -263,6 +391,13 @@ void
 RecursiveSeparableImageFilter< TInputImage, TOutputImage >
 ::DynamicThreadedGenerateData(const OutputImageRegionType & outputRegionForThread)
 {
+  // the strided passes run much faster when adjacent lines are
+  // gathered and scattered together
+  if ( this->FilterBlockedLines(outputRegionForThread) )
+    {
+    return;
+    }
+
   using OutputPixelType = typename TOutputImage::PixelType;
 
   using InputConstIteratorType = ImageLinearConstIteratorWithIndex< TInputImage >;
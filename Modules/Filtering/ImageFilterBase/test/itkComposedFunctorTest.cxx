@@ -0,0 +1,178 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkComposedFunctor.h"
+#include "itkSubtractImageFilter.h"
+#include "itkRescaleIntensityImageFilter.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkImageRegionIteratorWithIndex.h"
+
+#include <iostream>
+
+namespace
+{
+
+using FloatImageType = itk::Image< float, 2 >;
+using DoubleImageType = itk::Image< double, 2 >;
+using OutputImageType = itk::Image< unsigned char, 2 >;
+
+using Sub2FunctorType = itk::Functor::Sub2< float, float, double >;
+using RescaleFunctorType =
+  itk::Functor::IntensityLinearTransform< double, unsigned char >;
+
+FloatImageType::Pointer CreateImage( const FloatImageType::RegionType & region,
+                                     float offset, float slope )
+{
+  FloatImageType::Pointer image = FloatImageType::New();
+  image->SetRegions( region );
+  image->Allocate();
+  itk::ImageRegionIteratorWithIndex< FloatImageType > it( image, region );
+  for ( it.GoToBegin(); !it.IsAtEnd(); ++it )
+    {
+    it.Set( offset + slope * it.GetIndex()[0] + 0.5f * it.GetIndex()[1] );
+    }
+  return image;
+}
+
+template< typename TImage >
+bool ImagesMatch( const TImage *image1, const TImage *image2 )
+{
+  itk::ImageRegionConstIterator< TImage > it1( image1, image1->GetBufferedRegion() );
+  itk::ImageRegionConstIterator< TImage > it2( image2, image2->GetBufferedRegion() );
+  for ( ; !it1.IsAtEnd(); ++it1, ++it2 )
+    {
+    if ( it1.Get() != it2.Get() )
+      {
+      return false;
+      }
+    }
+  return true;
+}
+
+} // end anonymous namespace
+
+int itkComposedFunctorTest(int, char* [])
+{
+  FloatImageType::SizeType size = {{16, 12}};
+  FloatImageType::RegionType region;
+  region.SetSize( size );
+
+  FloatImageType::Pointer input1 = CreateImage( region, 20.0f, 1.25f );
+  FloatImageType::Pointer input2 = CreateImage( region, 5.0f, 0.25f );
+
+  constexpr double factor = 3.0;
+  constexpr double offset = 7.0;
+
+  // single-pass composition: subtract the two inputs, then apply the
+  // linear intensity transform, reaching its parameters as documented
+  using ComposedFilterType = itk::ComposedBinaryFunctorImageFilter<
+      FloatImageType, FloatImageType, OutputImageType,
+      Sub2FunctorType, RescaleFunctorType >;
+  ComposedFilterType::Pointer composed = ComposedFilterType::New();
+  composed->SetInput1( input1 );
+  composed->SetInput2( input2 );
+  composed->GetFunctor().GetRemainingFunctor().GetFirstFunctor().SetFactor( factor );
+  composed->GetFunctor().GetRemainingFunctor().GetFirstFunctor().SetOffset( offset );
+  composed->Update();
+
+  // the equivalent two-filter pipeline: one full pass per stage
+  using SubtractFilterType =
+    itk::SubtractImageFilter< FloatImageType, FloatImageType, DoubleImageType >;
+  SubtractFilterType::Pointer subtract = SubtractFilterType::New();
+  subtract->SetInput1( input1 );
+  subtract->SetInput2( input2 );
+
+  using RescaleFilterType =
+    itk::UnaryFunctorImageFilter< DoubleImageType, OutputImageType, RescaleFunctorType >;
+  RescaleFilterType::Pointer rescale = RescaleFilterType::New();
+  rescale->SetInput( subtract->GetOutput() );
+  rescale->GetFunctor().SetFactor( factor );
+  rescale->GetFunctor().SetOffset( offset );
+  rescale->Update();
+
+  if ( !ImagesMatch( composed->GetOutput(), rescale->GetOutput() ) )
+    {
+    std::cerr << "The composed binary chain disagrees with the two-filter "
+              << "pipeline." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // a three-deep unary chain against the matching filter cascade
+  using MiddleFunctorType = itk::Functor::IntensityLinearTransform< double, double >;
+  using ComposedUnaryFilterType = itk::ComposedUnaryFunctorImageFilter<
+      FloatImageType, OutputImageType, MiddleFunctorType, RescaleFunctorType >;
+  ComposedUnaryFilterType::Pointer composedUnary = ComposedUnaryFilterType::New();
+  composedUnary->SetInput( input1 );
+  composedUnary->GetFunctor().GetFirstFunctor().SetFactor( 2.0 );
+  composedUnary->GetFunctor().GetFirstFunctor().SetOffset( -10.0 );
+  composedUnary->GetFunctor().GetRemainingFunctor().GetFirstFunctor().SetFactor( factor );
+  composedUnary->GetFunctor().GetRemainingFunctor().GetFirstFunctor().SetOffset( offset );
+  composedUnary->Update();
+
+  using MiddleFilterType =
+    itk::UnaryFunctorImageFilter< FloatImageType, DoubleImageType, MiddleFunctorType >;
+  MiddleFilterType::Pointer middle = MiddleFilterType::New();
+  middle->SetInput( input1 );
+  middle->GetFunctor().SetFactor( 2.0 );
+  middle->GetFunctor().SetOffset( -10.0 );
+
+  RescaleFilterType::Pointer last = RescaleFilterType::New();
+  last->SetInput( middle->GetOutput() );
+  last->GetFunctor().SetFactor( factor );
+  last->GetFunctor().SetOffset( offset );
+  last->Update();
+
+  if ( !ImagesMatch( composedUnary->GetOutput(), last->GetOutput() ) )
+    {
+    std::cerr << "The composed unary chain disagrees with the filter cascade."
+              << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // the comparison operators follow the functor filter convention
+  itk::Functor::ComposedFunctor< Sub2FunctorType, RescaleFunctorType > functorA;
+  itk::Functor::ComposedFunctor< Sub2FunctorType, RescaleFunctorType > functorB;
+  if ( functorA != functorB || !( functorA == functorB ) )
+    {
+    std::cerr << "Default constructed compositions must compare equal."
+              << std::endl;
+    return EXIT_FAILURE;
+    }
+  functorB.GetRemainingFunctor().GetFirstFunctor().SetFactor( factor );
+  if ( functorA == functorB || !( functorA != functorB ) )
+    {
+    std::cerr << "Compositions with different parameters must compare unequal."
+              << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // the composition evaluates like the hand-written nesting
+  const double composedValue = functorB( 8.0f, 3.0f );
+  RescaleFunctorType reference;
+  reference.SetFactor( factor );
+  const double referenceValue = reference( Sub2FunctorType()( 8.0f, 3.0f ) );
+  if ( composedValue != referenceValue )
+    {
+    std::cerr << "Direct evaluation mismatch: " << composedValue << " != "
+              << referenceValue << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  std::cout << "Test PASSED." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,117 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkFrequencyExpandImageFilter_h
+#define itkFrequencyExpandImageFilter_h
+
+#include "itkImageToImageFilter.h"
+
+namespace itk
+{
+/** \class FrequencyExpandImageFilter
+ * \brief Expand an image in the frequency domain by zero padding its spectrum.
+ *
+ * The input is an image in the frequency domain, stored in the layout
+ * produced by the forward FFT filters, where the zero frequency is at the
+ * first index and the Nyquist frequencies are in the middle. The filter
+ * copies every input bin to the bin with the same signed frequency in a
+ * larger image, fills the new high frequency band with zeros, and scales
+ * the spectrum so that the inverse FFT of the output has the intensity
+ * range of the input.
+ *
+ * Composed with a forward and an inverse FFT,
+ *
+ *   ForwardFFT -> FrequencyExpand -> InverseFFT
+ *
+ * this performs band-limited (sinc) upsampling in a single pass of each
+ * transform, as an alternative to ExpandImageFilter with an interpolator:
+ * the original samples are reproduced exactly when the input carries no
+ * energy at its own Nyquist frequency, and the new samples follow the
+ * band-limited interpolant instead of a polynomial approximation.
+ *
+ * The output size is the input size multiplied by the expand factors, and
+ * the output spacing is divided by them, so the result occupies the same
+ * physical extent as the input.
+ *
+ * \sa FrequencyShrinkImageFilter, ExpandImageFilter
+ * \ingroup ITKImageFrequency
+ */
+template< typename TImageType >
+class ITK_TEMPLATE_EXPORT FrequencyExpandImageFilter:
+  public ImageToImageFilter< TImageType, TImageType >
+{
+public:
+  ITK_DISALLOW_COPY_AND_ASSIGN(FrequencyExpandImageFilter);
+
+  /** Standard class type alias. */
+  using Self = FrequencyExpandImageFilter;
+  using Superclass = ImageToImageFilter< TImageType, TImageType >;
+  using Pointer = SmartPointer< Self >;
+  using ConstPointer = SmartPointer< const Self >;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(FrequencyExpandImageFilter, ImageToImageFilter);
+
+  /** Typedef to images */
+  using ImageType = TImageType;
+  using ImagePointer = typename ImageType::Pointer;
+  using ImageConstPointer = typename ImageType::ConstPointer;
+  using IndexType = typename ImageType::IndexType;
+  using PixelType = typename ImageType::PixelType;
+  using RegionType = typename ImageType::RegionType;
+  using SizeType = typename ImageType::SizeType;
+
+  /** ImageDimension enumeration. */
+  static constexpr unsigned int ImageDimension = TImageType::ImageDimension;
+
+  using ExpandFactorsType = FixedArray< unsigned int, ImageDimension >;
+
+  /** Set the expand factors. Values are clamped to
+   * a minimum value of 1. */
+  itkSetMacro(ExpandFactors, ExpandFactorsType);
+  void SetExpandFactors(unsigned int factor);
+  void SetExpandFactor(unsigned int i, unsigned int factor);
+
+  /** Get the expand factors. */
+  itkGetConstReferenceMacro(ExpandFactors, ExpandFactorsType);
+
+  void GenerateOutputInformation() override;
+
+  /** The filter needs the whole frequency content of the input. */
+  void GenerateInputRequestedRegion() override;
+
+protected:
+  FrequencyExpandImageFilter();
+  ~FrequencyExpandImageFilter() override = default;
+
+  void PrintSelf(std::ostream & os, Indent indent) const override;
+
+  void DynamicThreadedGenerateData(const RegionType & outputRegionForThread) override;
+
+private:
+  ExpandFactorsType m_ExpandFactors;
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#include "itkFrequencyExpandImageFilter.hxx"
+#endif
+
+#endif
@@ -0,0 +1,209 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkFrequencyExpandImageFilter_hxx
+#define itkFrequencyExpandImageFilter_hxx
+
+#include "itkFrequencyExpandImageFilter.h"
+#include "itkFrequencyFFTLayoutImageRegionIteratorWithIndex.h"
+
+namespace itk
+{
+template< typename TImageType >
+FrequencyExpandImageFilter< TImageType >
+::FrequencyExpandImageFilter()
+{
+  for ( unsigned int j = 0; j < ImageDimension; j++ )
+    {
+    m_ExpandFactors[j] = 1;
+    }
+  this->DynamicMultiThreadingOn();
+}
+
+template< typename TImageType >
+void
+FrequencyExpandImageFilter< TImageType >
+::SetExpandFactors(unsigned int factor)
+{
+  unsigned int j;
+
+  for ( j = 0; j < ImageDimension; j++ )
+    {
+    if ( factor != m_ExpandFactors[j] )
+      {
+      break;
+      }
+    }
+  if ( j < ImageDimension )
+    {
+    this->Modified();
+    for ( j = 0; j < ImageDimension; j++ )
+      {
+      m_ExpandFactors[j] = factor;
+      if ( m_ExpandFactors[j] < 1 )
+        {
+        m_ExpandFactors[j] = 1;
+        }
+      }
+    }
+}
+
+template< typename TImageType >
+void
+FrequencyExpandImageFilter< TImageType >
+::SetExpandFactor(unsigned int i, unsigned int factor)
+{
+  if ( m_ExpandFactors[i] == factor )
+    {
+    return;
+    }
+
+  this->Modified();
+  m_ExpandFactors[i] = factor;
+}
+
+template< typename TImageType >
+void
+FrequencyExpandImageFilter< TImageType >
+::GenerateOutputInformation()
+{
+  // Call the superclass' implementation of this method
+  Superclass::GenerateOutputInformation();
+
+  // Get pointers to the input and output
+  ImageConstPointer inputPtr = this->GetInput();
+  ImagePointer outputPtr = this->GetOutput();
+
+  const typename TImageType::SpacingType & inputSpacing = inputPtr->GetSpacing();
+  const typename TImageType::SizeType & inputSize =
+    inputPtr->GetLargestPossibleRegion().GetSize();
+  const typename TImageType::IndexType & inputStartIndex =
+    inputPtr->GetLargestPossibleRegion().GetIndex();
+
+  typename TImageType::SpacingType outputSpacing;
+  typename TImageType::SizeType outputSize;
+
+  for ( unsigned int i = 0; i < ImageDimension; i++ )
+    {
+    outputSize[i] = inputSize[i] * m_ExpandFactors[i];
+    outputSpacing[i] = inputSpacing[i] / m_ExpandFactors[i];
+    }
+
+  outputPtr->SetSpacing(outputSpacing);
+
+  typename TImageType::RegionType outputLargestPossibleRegion;
+  outputLargestPossibleRegion.SetSize(outputSize);
+  outputLargestPossibleRegion.SetIndex(inputStartIndex);
+
+  outputPtr->SetLargestPossibleRegion(outputLargestPossibleRegion);
+}
+
+template< typename TImageType >
+void
+FrequencyExpandImageFilter< TImageType >
+::GenerateInputRequestedRegion()
+{
+  Superclass::GenerateInputRequestedRegion();
+
+  auto * inputPtr = const_cast< TImageType * >( this->GetInput() );
+  if ( inputPtr != nullptr )
+    {
+    inputPtr->SetRequestedRegionToLargestPossibleRegion();
+    }
+}
+
+template< typename TImageType >
+void
+FrequencyExpandImageFilter< TImageType >
+::DynamicThreadedGenerateData(const RegionType & outputRegionForThread)
+{
+  ImageConstPointer inputPtr = this->GetInput();
+  ImagePointer outputPtr = this->GetOutput();
+
+  const typename TImageType::SizeType inputSize =
+    inputPtr->GetLargestPossibleRegion().GetSize();
+  const typename TImageType::IndexType inputStartIndex =
+    inputPtr->GetLargestPossibleRegion().GetIndex();
+  const typename TImageType::IndexType inputUpperIndex =
+    inputPtr->GetLargestPossibleRegion().GetUpperIndex();
+
+  // The inverse transform divides by the number of pixels, which has grown,
+  // so rescale the copied bins to keep the intensity range of the spatial
+  // domain image.
+  double scale = 1.0;
+  for ( unsigned int i = 0; i < ImageDimension; i++ )
+    {
+    scale *= m_ExpandFactors[i];
+    }
+  const auto scaleFactor = static_cast< typename NumericTraits< PixelType >::ValueType >( scale );
+
+  // The bins representable in the input run from -(N-1)/2 to N/2 along each
+  // axis; a non-negative bin k sits at offset k from the start of the image,
+  // a negative one at offset k from one past the end.
+  IndexType largestPositiveBin;
+  IndexType smallestNegativeBin;
+  for ( unsigned int i = 0; i < ImageDimension; i++ )
+    {
+    largestPositiveBin[i] = static_cast< IndexValueType >( inputSize[i] / 2 );
+    smallestNegativeBin[i] = -static_cast< IndexValueType >( ( inputSize[i] - 1 ) / 2 );
+    }
+
+  using FrequencyIteratorType = FrequencyFFTLayoutImageRegionIteratorWithIndex< ImageType >;
+  FrequencyIteratorType outIt(outputPtr, outputRegionForThread);
+  for ( outIt.GoToBegin(); !outIt.IsAtEnd(); ++outIt )
+    {
+    const IndexType bin = outIt.GetFrequencyBin();
+    IndexType inputIndex;
+    bool insideBand = true;
+    for ( unsigned int i = 0; i < ImageDimension; i++ )
+      {
+      if ( bin[i] > largestPositiveBin[i] || bin[i] < smallestNegativeBin[i] )
+        {
+        insideBand = false;
+        break;
+        }
+      if ( bin[i] >= 0 )
+        {
+        inputIndex[i] = inputStartIndex[i] + bin[i];
+        }
+      else
+        {
+        inputIndex[i] = inputUpperIndex[i] + 1 + bin[i];
+        }
+      }
+    if ( insideBand )
+      {
+      outIt.Set( inputPtr->GetPixel(inputIndex) * scaleFactor );
+      }
+    else
+      {
+      outIt.Set( NumericTraits< PixelType >::ZeroValue() );
+      }
+    }
+}
+
+template< typename TImageType >
+void
+FrequencyExpandImageFilter< TImageType >
+::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+  os << indent << "ExpandFactors: " << m_ExpandFactors << std::endl;
+}
+} // end namespace itk
+
+#endif
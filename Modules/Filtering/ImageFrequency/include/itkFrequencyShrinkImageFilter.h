@@ -0,0 +1,117 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkFrequencyShrinkImageFilter_h
+#define itkFrequencyShrinkImageFilter_h
+
+#include "itkImageToImageFilter.h"
+
+namespace itk
+{
+/** \class FrequencyShrinkImageFilter
+ * \brief Shrink an image in the frequency domain by cropping its spectrum.
+ *
+ * The input is an image in the frequency domain, stored in the layout
+ * produced by the forward FFT filters, where the zero frequency is at the
+ * first index and the Nyquist frequencies are in the middle. The filter
+ * keeps only the frequency bins representable at the reduced size -- the
+ * corners of the image array in this layout -- and scales them so that the
+ * inverse FFT of the output has the intensity range of the input.
+ *
+ * Composed with a forward and an inverse FFT,
+ *
+ *   ForwardFFT -> FrequencyShrink -> InverseFFT
+ *
+ * this is a band-limited alternative to the spatial ShrinkImageFilter: a
+ * single pass of each transform with no smoothing stage, and an exact
+ * resampling of the input as long as it carries no energy at or above the
+ * Nyquist frequency of the reduced size. For data with energy above that
+ * band, apply FrequencyBandImageFilter first or accept that the crop
+ * discards the excess instead of aliasing it.
+ *
+ * The shrink factors must divide the size of the largest possible region
+ * along each axis. The output spacing is scaled by the shrink factors, so
+ * the result occupies the same physical extent as the input.
+ *
+ * \sa FrequencyExpandImageFilter, ShrinkImageFilter, FrequencyBandImageFilter
+ * \ingroup ITKImageFrequency
+ */
+template< typename TImageType >
+class ITK_TEMPLATE_EXPORT FrequencyShrinkImageFilter:
+  public ImageToImageFilter< TImageType, TImageType >
+{
+public:
+  ITK_DISALLOW_COPY_AND_ASSIGN(FrequencyShrinkImageFilter);
+
+  /** Standard class type alias. */
+  using Self = FrequencyShrinkImageFilter;
+  using Superclass = ImageToImageFilter< TImageType, TImageType >;
+  using Pointer = SmartPointer< Self >;
+  using ConstPointer = SmartPointer< const Self >;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(FrequencyShrinkImageFilter, ImageToImageFilter);
+
+  /** Typedef to images */
+  using ImageType = TImageType;
+  using ImagePointer = typename ImageType::Pointer;
+  using ImageConstPointer = typename ImageType::ConstPointer;
+  using IndexType = typename ImageType::IndexType;
+  using PixelType = typename ImageType::PixelType;
+  using RegionType = typename ImageType::RegionType;
+  using SizeType = typename ImageType::SizeType;
+
+  /** ImageDimension enumeration. */
+  static constexpr unsigned int ImageDimension = TImageType::ImageDimension;
+
+  using ShrinkFactorsType = FixedArray< unsigned int, ImageDimension >;
+
+  /** Set the shrink factors. Values are clamped to
+   * a minimum value of 1. */
+  itkSetMacro(ShrinkFactors, ShrinkFactorsType);
+  void SetShrinkFactors(unsigned int factor);
+  void SetShrinkFactor(unsigned int i, unsigned int factor);
+
+  /** Get the shrink factors. */
+  itkGetConstReferenceMacro(ShrinkFactors, ShrinkFactorsType);
+
+  void GenerateOutputInformation() override;
+
+  /** The filter needs the whole frequency content of the input. */
+  void GenerateInputRequestedRegion() override;
+
+protected:
+  FrequencyShrinkImageFilter();
+  ~FrequencyShrinkImageFilter() override = default;
+
+  void PrintSelf(std::ostream & os, Indent indent) const override;
+
+  void DynamicThreadedGenerateData(const RegionType & outputRegionForThread) override;
+
+private:
+  ShrinkFactorsType m_ShrinkFactors;
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#include "itkFrequencyShrinkImageFilter.hxx"
+#endif
+
+#endif
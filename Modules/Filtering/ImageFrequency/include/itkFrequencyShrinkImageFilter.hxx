@@ -0,0 +1,193 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkFrequencyShrinkImageFilter_hxx
+#define itkFrequencyShrinkImageFilter_hxx
+
+#include "itkFrequencyShrinkImageFilter.h"
+#include "itkFrequencyFFTLayoutImageRegionIteratorWithIndex.h"
+
+namespace itk
+{
+template< typename TImageType >
+FrequencyShrinkImageFilter< TImageType >
+::FrequencyShrinkImageFilter()
+{
+  for ( unsigned int j = 0; j < ImageDimension; j++ )
+    {
+    m_ShrinkFactors[j] = 1;
+    }
+  this->DynamicMultiThreadingOn();
+}
+
+template< typename TImageType >
+void
+FrequencyShrinkImageFilter< TImageType >
+::SetShrinkFactors(unsigned int factor)
+{
+  unsigned int j;
+
+  for ( j = 0; j < ImageDimension; j++ )
+    {
+    if ( factor != m_ShrinkFactors[j] )
+      {
+      break;
+      }
+    }
+  if ( j < ImageDimension )
+    {
+    this->Modified();
+    for ( j = 0; j < ImageDimension; j++ )
+      {
+      m_ShrinkFactors[j] = factor;
+      if ( m_ShrinkFactors[j] < 1 )
+        {
+        m_ShrinkFactors[j] = 1;
+        }
+      }
+    }
+}
+
+template< typename TImageType >
+void
+FrequencyShrinkImageFilter< TImageType >
+::SetShrinkFactor(unsigned int i, unsigned int factor)
+{
+  if ( m_ShrinkFactors[i] == factor )
+    {
+    return;
+    }
+
+  this->Modified();
+  m_ShrinkFactors[i] = factor;
+}
+
+template< typename TImageType >
+void
+FrequencyShrinkImageFilter< TImageType >
+::GenerateOutputInformation()
+{
+  // Call the superclass' implementation of this method
+  Superclass::GenerateOutputInformation();
+
+  // Get pointers to the input and output
+  ImageConstPointer inputPtr = this->GetInput();
+  ImagePointer outputPtr = this->GetOutput();
+
+  const typename TImageType::SpacingType & inputSpacing = inputPtr->GetSpacing();
+  const typename TImageType::SizeType & inputSize =
+    inputPtr->GetLargestPossibleRegion().GetSize();
+  const typename TImageType::IndexType & inputStartIndex =
+    inputPtr->GetLargestPossibleRegion().GetIndex();
+
+  typename TImageType::SpacingType outputSpacing;
+  typename TImageType::SizeType outputSize;
+
+  for ( unsigned int i = 0; i < ImageDimension; i++ )
+    {
+    if ( inputSize[i] % m_ShrinkFactors[i] != 0 )
+      {
+      itkExceptionMacro(<< "The shrink factor " << m_ShrinkFactors[i]
+                        << " does not divide the input size " << inputSize[i]
+                        << " along dimension " << i);
+      }
+    outputSize[i] = inputSize[i] / m_ShrinkFactors[i];
+    outputSpacing[i] = inputSpacing[i] * m_ShrinkFactors[i];
+    }
+
+  outputPtr->SetSpacing(outputSpacing);
+
+  typename TImageType::RegionType outputLargestPossibleRegion;
+  outputLargestPossibleRegion.SetSize(outputSize);
+  outputLargestPossibleRegion.SetIndex(inputStartIndex);
+
+  outputPtr->SetLargestPossibleRegion(outputLargestPossibleRegion);
+}
+
+template< typename TImageType >
+void
+FrequencyShrinkImageFilter< TImageType >
+::GenerateInputRequestedRegion()
+{
+  Superclass::GenerateInputRequestedRegion();
+
+  auto * inputPtr = const_cast< TImageType * >( this->GetInput() );
+  if ( inputPtr != nullptr )
+    {
+    inputPtr->SetRequestedRegionToLargestPossibleRegion();
+    }
+}
+
+template< typename TImageType >
+void
+FrequencyShrinkImageFilter< TImageType >
+::DynamicThreadedGenerateData(const RegionType & outputRegionForThread)
+{
+  ImageConstPointer inputPtr = this->GetInput();
+  ImagePointer outputPtr = this->GetOutput();
+
+  const typename TImageType::IndexType inputStartIndex =
+    inputPtr->GetLargestPossibleRegion().GetIndex();
+  const typename TImageType::IndexType inputUpperIndex =
+    inputPtr->GetLargestPossibleRegion().GetUpperIndex();
+
+  // The discarded bins do not contribute to the inverse transform, which
+  // divides by the number of pixels, so rescale the retained ones to keep
+  // the intensity range of the spatial domain image.
+  double scale = 1.0;
+  for ( unsigned int i = 0; i < ImageDimension; i++ )
+    {
+    scale /= m_ShrinkFactors[i];
+    }
+  const auto scaleFactor = static_cast< typename NumericTraits< PixelType >::ValueType >( scale );
+
+  // Walk the output with a frequency iterator and fetch the input bin with
+  // the same signed frequency. A non-negative bin k sits at offset k from
+  // the start of the image, a negative one at offset k from one past the
+  // end, in both layouts.
+  using FrequencyIteratorType = FrequencyFFTLayoutImageRegionIteratorWithIndex< ImageType >;
+  FrequencyIteratorType outIt(outputPtr, outputRegionForThread);
+  for ( outIt.GoToBegin(); !outIt.IsAtEnd(); ++outIt )
+    {
+    const IndexType bin = outIt.GetFrequencyBin();
+    IndexType inputIndex;
+    for ( unsigned int i = 0; i < ImageDimension; i++ )
+      {
+      if ( bin[i] >= 0 )
+        {
+        inputIndex[i] = inputStartIndex[i] + bin[i];
+        }
+      else
+        {
+        inputIndex[i] = inputUpperIndex[i] + 1 + bin[i];
+        }
+      }
+    outIt.Set( inputPtr->GetPixel(inputIndex) * scaleFactor );
+    }
+}
+
+template< typename TImageType >
+void
+FrequencyShrinkImageFilter< TImageType >
+::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+  os << indent << "ShrinkFactors: " << m_ShrinkFactors << std::endl;
+}
+} // end namespace itk
+
+#endif
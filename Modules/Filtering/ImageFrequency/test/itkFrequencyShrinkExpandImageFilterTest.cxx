@@ -0,0 +1,178 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkFrequencyExpandImageFilter.h"
+#include "itkFrequencyShrinkImageFilter.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkMath.h"
+#include "itkVnlForwardFFTImageFilter.h"
+#include "itkVnlInverseFFTImageFilter.h"
+
+#include <cmath>
+
+namespace
+{
+
+using RealImageType = itk::Image< double, 2 >;
+
+// A band-limited trigonometric polynomial sampled on a sizeX x sizeY grid.
+// Its spectrum occupies the bins (+-2, 0) and (0, +-1) only, so both a
+// shrink by two and an expand by two are exact band-limited resamplings.
+double BandLimitedValue( double x, double y, unsigned int sizeX, unsigned int sizeY )
+{
+  return 3.0
+         + 2.0 * std::cos( 2.0 * itk::Math::pi * 2.0 * x / sizeX )
+         + std::cos( 2.0 * itk::Math::pi * y / sizeY + 0.7 );
+}
+
+RealImageType::Pointer CreateBandLimitedImage( unsigned int sizeX, unsigned int sizeY )
+{
+  RealImageType::Pointer image = RealImageType::New();
+  RealImageType::SizeType size = {{sizeX, sizeY}};
+  RealImageType::RegionType region;
+  region.SetSize( size );
+  image->SetRegions( region );
+  image->Allocate();
+
+  itk::ImageRegionIteratorWithIndex< RealImageType > it( image, region );
+  for ( it.GoToBegin(); !it.IsAtEnd(); ++it )
+    {
+    const RealImageType::IndexType index = it.GetIndex();
+    it.Set( BandLimitedValue( index[0], index[1], sizeX, sizeY ) );
+    }
+  return image;
+}
+
+} // end anonymous namespace
+
+int itkFrequencyShrinkExpandImageFilterTest( int, char * [] )
+{
+  constexpr unsigned int sizeX = 16;
+  constexpr unsigned int sizeY = 12;
+  constexpr double tolerance = 1e-10;
+
+  using ForwardFFTType = itk::VnlForwardFFTImageFilter< RealImageType >;
+  using ComplexImageType = ForwardFFTType::OutputImageType;
+  using InverseFFTType = itk::VnlInverseFFTImageFilter< ComplexImageType, RealImageType >;
+
+  // Shrink by 2: the output samples must be the input samples on the
+  // decimated grid.
+  {
+  RealImageType::Pointer input = CreateBandLimitedImage( sizeX, sizeY );
+
+  ForwardFFTType::Pointer forwardFFT = ForwardFFTType::New();
+  forwardFFT->SetInput( input );
+
+  using ShrinkType = itk::FrequencyShrinkImageFilter< ComplexImageType >;
+  ShrinkType::Pointer shrink = ShrinkType::New();
+  shrink->SetInput( forwardFFT->GetOutput() );
+  shrink->SetShrinkFactors( 2 );
+
+  InverseFFTType::Pointer inverseFFT = InverseFFTType::New();
+  inverseFFT->SetInput( shrink->GetOutput() );
+  inverseFFT->Update();
+
+  RealImageType::Pointer output = inverseFFT->GetOutput();
+
+  const RealImageType::SizeType outputSize =
+    output->GetLargestPossibleRegion().GetSize();
+  if ( outputSize[0] != sizeX / 2 || outputSize[1] != sizeY / 2 )
+    {
+    std::cerr << "Wrong shrink output size: " << outputSize << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  const RealImageType::SpacingType outputSpacing = shrink->GetOutput()->GetSpacing();
+  if ( itk::Math::NotAlmostEquals( outputSpacing[0], 2.0 )
+       || itk::Math::NotAlmostEquals( outputSpacing[1], 2.0 ) )
+    {
+    std::cerr << "Wrong shrink output spacing: " << outputSpacing << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  itk::ImageRegionIteratorWithIndex< RealImageType > it( output,
+    output->GetLargestPossibleRegion() );
+  for ( it.GoToBegin(); !it.IsAtEnd(); ++it )
+    {
+    const RealImageType::IndexType index = it.GetIndex();
+    const double expected =
+      BandLimitedValue( 2.0 * index[0], 2.0 * index[1], sizeX, sizeY );
+    if ( std::abs( it.Get() - expected ) > tolerance )
+      {
+      std::cerr << "Shrink mismatch at " << index << ": " << it.Get()
+                << " != " << expected << std::endl;
+      return EXIT_FAILURE;
+      }
+    }
+  }
+
+  // Expand by 2: the output must follow the band-limited interpolant, which
+  // on the doubled grid is the same trigonometric polynomial sampled at
+  // half-integer positions of the input grid.
+  {
+  RealImageType::Pointer input = CreateBandLimitedImage( sizeX / 2, sizeY / 2 );
+
+  ForwardFFTType::Pointer forwardFFT = ForwardFFTType::New();
+  forwardFFT->SetInput( input );
+
+  using ExpandType = itk::FrequencyExpandImageFilter< ComplexImageType >;
+  ExpandType::Pointer expand = ExpandType::New();
+  expand->SetInput( forwardFFT->GetOutput() );
+  expand->SetExpandFactors( 2 );
+
+  InverseFFTType::Pointer inverseFFT = InverseFFTType::New();
+  inverseFFT->SetInput( expand->GetOutput() );
+  inverseFFT->Update();
+
+  RealImageType::Pointer output = inverseFFT->GetOutput();
+
+  const RealImageType::SizeType outputSize =
+    output->GetLargestPossibleRegion().GetSize();
+  if ( outputSize[0] != sizeX || outputSize[1] != sizeY )
+    {
+    std::cerr << "Wrong expand output size: " << outputSize << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  const RealImageType::SpacingType outputSpacing = expand->GetOutput()->GetSpacing();
+  if ( itk::Math::NotAlmostEquals( outputSpacing[0], 0.5 )
+       || itk::Math::NotAlmostEquals( outputSpacing[1], 0.5 ) )
+    {
+    std::cerr << "Wrong expand output spacing: " << outputSpacing << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  itk::ImageRegionIteratorWithIndex< RealImageType > it( output,
+    output->GetLargestPossibleRegion() );
+  for ( it.GoToBegin(); !it.IsAtEnd(); ++it )
+    {
+    const RealImageType::IndexType index = it.GetIndex();
+    const double expected =
+      BandLimitedValue( 0.5 * index[0], 0.5 * index[1], sizeX / 2, sizeY / 2 );
+    if ( std::abs( it.Get() - expected ) > tolerance )
+      {
+      std::cerr << "Expand mismatch at " << index << ": " << it.Get()
+                << " != " << expected << std::endl;
+      return EXIT_FAILURE;
+      }
+    }
+  }
+
+  std::cout << "Test PASSED." << std::endl;
+  return EXIT_SUCCESS;
+}
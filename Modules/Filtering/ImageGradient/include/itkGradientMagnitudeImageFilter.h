@@ -18,7 +18,10 @@
 #ifndef itkGradientMagnitudeImageFilter_h
 #define itkGradientMagnitudeImageFilter_h
 
-#include "itkImageToImageFilter.h"
+#include "itkNeighborhoodScanlineImageFilter.h"
+#include "itkDerivativeOperator.h"
+
+#include <valarray>
 
 namespace itk
 {
@@ -39,14 +42,14 @@ namespace itk
  */
 template< typename TInputImage, typename TOutputImage >
 class ITK_TEMPLATE_EXPORT GradientMagnitudeImageFilter:
-  public ImageToImageFilter< TInputImage, TOutputImage >
+  public NeighborhoodScanlineImageFilter< TInputImage, TOutputImage >
 {
 public:
   ITK_DISALLOW_COPY_AND_ASSIGN(GradientMagnitudeImageFilter);
 
   /** Standard class type aliases. */
   using Self = GradientMagnitudeImageFilter;
-  using Superclass = ImageToImageFilter< TInputImage, TOutputImage >;
+  using Superclass = NeighborhoodScanlineImageFilter< TInputImage, TOutputImage >;
   using Pointer = SmartPointer< Self >;
   using ConstPointer = SmartPointer< const Self >;
 
@@ -54,7 +57,7 @@ public:
   itkNewMacro(Self);
 
   /** Run-time type information (and related methods) */
-  itkTypeMacro(GradientMagnitudeImageFilter, ImageToImageFilter);
+  itkTypeMacro(GradientMagnitudeImageFilter, NeighborhoodScanlineImageFilter);
 
   /** Extract some information from the image types.  Dimensionality
    * of the two images is assumed to be the same. */
@@ -75,15 +78,7 @@ public:
   /** Superclass type alias. */
   using OutputImageRegionType = typename Superclass::OutputImageRegionType;
 
-  /** GradientMagnitudeImageFilter needs a larger input requested
-   * region than the output requested region (larger by the kernel
-   * size to calculate derivatives).  As such,
-   * GradientMagnitudeImageFilter needs to provide an implementation
-   * for GenerateInputRequestedRegion() in order to inform the
-   * pipeline execution model.
-   *
-   * \sa ImageToImageFilter::GenerateInputRequestedRegion() */
-  void GenerateInputRequestedRegion() override;
+  using ConstNeighborhoodIteratorType = typename Superclass::ConstNeighborhoodIteratorType;
 
   /** Use the image spacing information in calculations. Use this option if you
    *  want derivatives in physical space. Default is UseImageSpacingOn. */
@@ -108,32 +103,41 @@ public:
 #endif
 
 protected:
-  GradientMagnitudeImageFilter()
-  {
-    m_UseImageSpacing = true;
-    this->DynamicMultiThreadingOn();
-  }
+  GradientMagnitudeImageFilter();
 
   ~GradientMagnitudeImageFilter() override = default;
 
-  /** GradientMagnitudeImageFilter can be implemented as a
-   * multithreaded filter.  Therefore, this implementation provides a
-   * DynamicThreadedGenerateData() routine which is called for each
-   * processing thread. The output image data is allocated
-   * automatically by the superclass prior to calling
-   * DynamicThreadedGenerateData().  DynamicThreadedGenerateData can only write to
-   * the portion of the output image specified by the parameter
-   * "outputRegionForThread"
+  /** Build the (possibly spacing-scaled) derivative operators along
+   * with the kernel slices and buffer strides consumed by the two
+   * evaluation hooks. */
+  void BeforeThreadedGenerateData() override;
+
+  /** Compute the gradient magnitude for one boundary pixel by inner
+   * products of the derivative operators with the neighborhood.
    *
-   * \sa ImageToImageFilter::ThreadedGenerateData(),
-   *     ImageToImageFilter::GenerateData() */
-  void DynamicThreadedGenerateData(const OutputImageRegionType & outputRegionForThread) override;
+   * \sa NeighborhoodScanlineImageFilter */
+  OutputPixelType EvaluateAtNeighborhood(const ConstNeighborhoodIteratorType & it) const override;
 
+  /** Compute the gradient magnitude along one interior scanline
+   * through raw buffer pointers.
+   *
+   * \sa NeighborhoodScanlineImageFilter */
+  void EvaluateInteriorScanline(const InputPixelType *input,
+                                OutputPixelType *output,
+                                SizeValueType length,
+                                const OffsetValueType *neighborhoodOffsets,
+                                SizeValueType neighborhoodSize) const override;
 
   void PrintSelf(std::ostream &, Indent) const override;
 
 private:
   bool m_UseImageSpacing;
+
+  /** Per-dimension derivative operators and the neighborhood slices
+   * selecting the corresponding axis, prepared before threading. */
+  DerivativeOperator< RealType, ImageDimension > m_Operators[ImageDimension];
+  std::slice                                     m_KernelSlices[ImageDimension];
+  OffsetValueType                                m_ImageStrides[ImageDimension];
 };
 } // end namespace itk
 
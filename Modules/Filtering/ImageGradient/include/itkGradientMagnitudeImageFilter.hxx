@@ -19,170 +19,135 @@
 #define itkGradientMagnitudeImageFilter_hxx
 #include "itkGradientMagnitudeImageFilter.h"
 
-#include "itkConstNeighborhoodIterator.h"
+#include "itkNeighborhood.h"
 #include "itkNeighborhoodInnerProduct.h"
-#include "itkImageRegionIterator.h"
-#include "itkDerivativeOperator.h"
-#include "itkNeighborhoodAlgorithm.h"
-#include "itkProgressReporter.h"
 
 namespace itk
 {
 template< typename TInputImage, typename TOutputImage >
-void
 GradientMagnitudeImageFilter< TInputImage, TOutputImage >
-::PrintSelf(std::ostream & os, Indent indent) const
+::GradientMagnitudeImageFilter()
 {
-  Superclass::PrintSelf(os, indent);
-  os << indent << "UseImageSpacing = " << m_UseImageSpacing << std::endl;
-}
-
-template< typename TInputImage, typename TOutputImage >
-void
-GradientMagnitudeImageFilter< TInputImage, TOutputImage >
-::GenerateInputRequestedRegion()
-{
-  // call the superclass' implementation of this method
-  Superclass::GenerateInputRequestedRegion();
-
-  // get pointers to the input and output
-  InputImagePointer inputPtr =
-    const_cast< InputImageType * >( this->GetInput() );
-  OutputImagePointer outputPtr = this->GetOutput();
-
-  if ( !inputPtr || !outputPtr )
-    {
-    return;
-    }
+  m_UseImageSpacing = true;
 
   // Build an operator so that we can determine the kernel size
   DerivativeOperator< RealType, ImageDimension > oper;
   oper.SetDirection(0);
   oper.SetOrder(1);
   oper.CreateDirectional();
-  SizeValueType radius = oper.GetRadius()[0];
-
-  // get a copy of the input requested region (should equal the output
-  // requested region)
-  typename TInputImage::RegionType inputRequestedRegion;
-  inputRequestedRegion = inputPtr->GetRequestedRegion();
-
-  // pad the input requested region by the operator radius
-  inputRequestedRegion.PadByRadius(radius);
-
-  // crop the input requested region at the input's largest possible region
-  if ( inputRequestedRegion.Crop( inputPtr->GetLargestPossibleRegion() ) )
-    {
-    inputPtr->SetRequestedRegion(inputRequestedRegion);
-    return;
-    }
-  else
-    {
-    // Couldn't crop the region (requested region is outside the largest
-    // possible region).  Throw an exception.
-
-    // store what we tried to request (prior to trying to crop)
-    inputPtr->SetRequestedRegion(inputRequestedRegion);
-
-    // build an exception
-    InvalidRequestedRegionError e(__FILE__, __LINE__);
-    e.SetLocation(ITK_LOCATION);
-    e.SetDescription("Requested region is (at least partially) outside the largest possible region.");
-    e.SetDataObject(inputPtr);
-    throw e;
-    }
+  this->SetRadius( oper.GetRadius()[0] );
 }
 
 template< typename TInputImage, typename TOutputImage >
 void
 GradientMagnitudeImageFilter< TInputImage, TOutputImage >
-::DynamicThreadedGenerateData(const OutputImageRegionType & outputRegionForThread)
+::PrintSelf(std::ostream & os, Indent indent) const
 {
-  unsigned int i;
-
-  ZeroFluxNeumannBoundaryCondition< TInputImage > nbc;
-
-  ConstNeighborhoodIterator< TInputImage > nit;
-  ConstNeighborhoodIterator< TInputImage > bit;
-  ImageRegionIterator< TOutputImage >      it;
+  Superclass::PrintSelf(os, indent);
+  os << indent << "UseImageSpacing = " << m_UseImageSpacing << std::endl;
+}
 
-  NeighborhoodInnerProduct< TInputImage, RealType > SIP;
+template< typename TInputImage, typename TOutputImage >
+void
+GradientMagnitudeImageFilter< TInputImage, TOutputImage >
+::BeforeThreadedGenerateData()
+{
+  Superclass::BeforeThreadedGenerateData();
 
-  typename OutputImageType::Pointer output = this->GetOutput();
-  typename  InputImageType::ConstPointer input  = this->GetInput();
+  typename InputImageType::ConstPointer input = this->GetInput();
 
   // Set up operators
-  DerivativeOperator< RealType, ImageDimension > op[ImageDimension];
-
-  for ( i = 0; i < ImageDimension; i++ )
+  for ( unsigned int i = 0; i < ImageDimension; i++ )
     {
-    op[i].SetDirection(0);
-    op[i].SetOrder(1);
-    op[i].CreateDirectional();
+    m_Operators[i].SetDirection(0);
+    m_Operators[i].SetOrder(1);
+    m_Operators[i].CreateDirectional();
 
     if ( m_UseImageSpacing == true )
       {
-      if ( this->GetInput()->GetSpacing()[i] == 0.0 )
+      if ( input->GetSpacing()[i] == 0.0 )
         {
         itkExceptionMacro(<< "Image spacing cannot be zero.");
         }
       else
         {
-        op[i].ScaleCoefficients(1.0 / this->GetInput()->GetSpacing()[i]);
+        m_Operators[i].ScaleCoefficients(1.0 / input->GetSpacing()[i]);
         }
       }
     }
 
-  // Calculate iterator radius
-  Size< ImageDimension > radius;
-  for ( i = 0; i < ImageDimension; ++i )
+  // Slices selecting each axis of the neighborhood handed to
+  // EvaluateAtNeighborhood. The neighborhood strides only depend on the
+  // radius, so a dummy neighborhood suffices to compute them.
+  Neighborhood< RealType, ImageDimension > dummy;
+  dummy.SetRadius( this->GetRadius() );
+
+  const SizeValueType center = dummy.Size() / 2;
+  for ( unsigned int i = 0; i < ImageDimension; ++i )
     {
-    radius[i]  = op[0].GetRadius()[0];
+    m_KernelSlices[i] = std::slice( center - dummy.GetStride(i) * this->GetRadius()[i],
+                                    m_Operators[i].GetSize()[0], dummy.GetStride(i) );
     }
 
-  // Find the data-set boundary "faces"
-  typename NeighborhoodAlgorithm::ImageBoundaryFacesCalculator< TInputImage >::
-  FaceListType faceList;
-  NeighborhoodAlgorithm::ImageBoundaryFacesCalculator< TInputImage > bC;
-  faceList = bC(input, outputRegionForThread, radius);
-
-  typename NeighborhoodAlgorithm::ImageBoundaryFacesCalculator< TInputImage >::
-  FaceListType::iterator fit;
-  fit = faceList.begin();
+  // Element strides of the buffered input region, for the raw-pointer
+  // interior path.
+  const typename InputImageType::SizeType bufferedSize =
+    input->GetBufferedRegion().GetSize();
+  m_ImageStrides[0] = 1;
+  for ( unsigned int i = 1; i < ImageDimension; ++i )
+    {
+    m_ImageStrides[i] = m_ImageStrides[i - 1]
+                        * static_cast< OffsetValueType >( bufferedSize[i - 1] );
+    }
+}
 
-  // Process non-boundary face
-  nit = ConstNeighborhoodIterator< TInputImage >(radius, input, *fit);
+template< typename TInputImage, typename TOutputImage >
+typename GradientMagnitudeImageFilter< TInputImage, TOutputImage >::OutputPixelType
+GradientMagnitudeImageFilter< TInputImage, TOutputImage >
+::EvaluateAtNeighborhood(const ConstNeighborhoodIteratorType & it) const
+{
+  NeighborhoodInnerProduct< TInputImage, RealType > SIP;
 
-  std::slice          x_slice[ImageDimension];
-  const SizeValueType center = nit.Size() / 2;
-  for ( i = 0; i < ImageDimension; ++i )
+  RealType a = NumericTraits< RealType >::ZeroValue();
+  for ( unsigned int i = 0; i < ImageDimension; ++i )
     {
-    x_slice[i] = std::slice( center - nit.GetStride(i) * radius[i],
-                             op[i].GetSize()[0], nit.GetStride(i) );
+    const RealType g = SIP(m_KernelSlices[i], it, m_Operators[i]);
+    a += g * g;
     }
+  return static_cast< OutputPixelType >( std::sqrt(a) );
+}
 
-  // Process each of the boundary faces.  These are N-d regions which border
-  // the edge of the buffer.
-  for ( fit = faceList.begin(); fit != faceList.end(); ++fit )
+template< typename TInputImage, typename TOutputImage >
+void
+GradientMagnitudeImageFilter< TInputImage, TOutputImage >
+::EvaluateInteriorScanline(const InputPixelType *input,
+                           OutputPixelType *output,
+                           SizeValueType length,
+                           const OffsetValueType *itkNotUsed(neighborhoodOffsets),
+                           SizeValueType itkNotUsed(neighborhoodSize)) const
+{
+  // The derivative operators are one-dimensional, so address the
+  // neighbors along each axis directly through the image strides
+  // instead of the full box of neighborhood offsets.
+  for ( SizeValueType p = 0; p < length; ++p )
     {
-    bit = ConstNeighborhoodIterator< InputImageType >(radius,
-                                                      input, *fit);
-    it = ImageRegionIterator< OutputImageType >(output, *fit);
-    bit.OverrideBoundaryCondition(&nbc);
-    bit.GoToBegin();
-
-    while ( !bit.IsAtEnd() )
+    RealType a = NumericTraits< RealType >::ZeroValue();
+    for ( unsigned int i = 0; i < ImageDimension; ++i )
       {
-      RealType a = NumericTraits< RealType >::ZeroValue();
-      for ( i = 0; i < ImageDimension; ++i )
+      const OffsetValueType r =
+        static_cast< OffsetValueType >( m_Operators[i].GetRadius()[0] );
+      const SizeValueType operatorSize = m_Operators[i].GetSize()[0];
+
+      RealType g = NumericTraits< RealType >::ZeroValue();
+      for ( SizeValueType k = 0; k < operatorSize; ++k )
         {
-        const RealType g = SIP(x_slice[i], bit, op[i]);
-        a += g * g;
+        g += m_Operators[i][k]
+             * static_cast< RealType >(
+               input[p + ( static_cast< OffsetValueType >( k ) - r ) * m_ImageStrides[i]] );
         }
-      it.Value() = static_cast< OutputPixelType >( std::sqrt(a) );
-      ++bit;
-      ++it;
+      a += g * g;
       }
+    output[p] = static_cast< OutputPixelType >( std::sqrt(a) );
     }
 }
 } // end namespace itk
@@ -160,10 +160,15 @@ private:
   using SqrSpacingFilterType = BinaryGeneratorImageFilter< RealImageType, RealImageType, RealImageType >;
   using SqrSpacingFilterPointer = typename SqrSpacingFilterType::Pointer;
 
-  GaussianFilterPointer   m_SmoothingFilters[ImageDimension - 1];
-  DerivativeFilterPointer m_DerivativeFilter;
-  SqrSpacingFilterPointer m_SqrSpacingFilter;
-  SqrtFilterPointer       m_SqrtFilter;
+  /** Fused filter for the last directional component: accumulates the
+   * squared component and takes the square root in a single pass. */
+  using SqrSpacingSqrtFilterType = BinaryGeneratorImageFilter< RealImageType, RealImageType, TOutputImage >;
+  using SqrSpacingSqrtFilterPointer = typename SqrSpacingSqrtFilterType::Pointer;
+
+  GaussianFilterPointer       m_SmoothingFilters[ImageDimension - 1];
+  DerivativeFilterPointer     m_DerivativeFilter;
+  SqrSpacingFilterPointer     m_SqrSpacingFilter;
+  SqrSpacingSqrtFilterPointer m_SqrSpacingSqrtFilter;
 
   /** Normalize the image across scale space */
   bool m_NormalizeAcrossScale;
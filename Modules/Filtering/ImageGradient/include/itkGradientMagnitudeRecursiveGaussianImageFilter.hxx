@@ -59,9 +59,11 @@ GradientMagnitudeRecursiveGaussianImageFilter< TInputImage, TOutputImage >
   // run that filter in place for much efficiency
   m_SqrSpacingFilter->InPlaceOn();
 
-  // input of SqrtFilter is the cumulative image - we can't set it now
-  m_SqrtFilter = SqrtFilterType::New();
-  m_SqrtFilter->InPlaceOn();
+  // the last directional component is accumulated and square rooted
+  // in a single fused pass, writing the final magnitude directly
+  m_SqrSpacingSqrtFilter = SqrSpacingSqrtFilterType::New();
+  m_SqrSpacingSqrtFilter->SetInput( 1, m_SmoothingFilters[ImageDimension - 2]->GetOutput() );
+  m_SqrSpacingSqrtFilter->InPlaceOn();
 
   this->SetSigma(1.0);
   this->InPlaceOff();
@@ -118,7 +120,7 @@ GradientMagnitudeRecursiveGaussianImageFilter< TInputImage, TOutputImage >
     }
   m_DerivativeFilter->SetNumberOfWorkUnits(nb);
   m_SqrSpacingFilter->SetNumberOfWorkUnits(nb);
-  m_SqrtFilter->SetNumberOfWorkUnits(nb);
+  m_SqrSpacingSqrtFilter->SetNumberOfWorkUnits(nb);
 }
 
 /**
@@ -201,18 +203,15 @@ GradientMagnitudeRecursiveGaussianImageFilter< TInputImage, TOutputImage >
 
   // If the last filter is running in-place then this bulk data is not
   // needed, release it to save memory
-  if ( m_SqrtFilter->CanRunInPlace() )
+  if ( m_SqrSpacingSqrtFilter->CanRunInPlace() )
     {
     outputImage->ReleaseData();
     }
 
-
-  typename CumulativeImageType::Pointer cumulativeImage = CumulativeImageType::New();
-  cumulativeImage->SetRegions( inputImage->GetBufferedRegion() );
-  cumulativeImage->Allocate();
-  cumulativeImage->FillBuffer(NumericTraits< InternalRealType >::ZeroValue());
-  // The output's information must match the input's information
-  cumulativeImage->CopyInformation( this->GetInput() );
+  // The cumulative image is seeded from the first squared component,
+  // so there is no need to allocate and zero fill a separate image
+  // and sweep over it a first time.
+  typename CumulativeImageType::Pointer cumulativeImage;
 
   m_DerivativeFilter->SetInput(inputImage);
 
@@ -241,9 +240,38 @@ GradientMagnitudeRecursiveGaussianImageFilter< TInputImage, TOutputImage >
     m_DerivativeFilter->SetDirection(dim);
 
     const double lambdaSpacing = inputImage->GetSpacing()[dim];
-    m_SqrSpacingFilter->SetFunctor([lambdaSpacing](const InternalRealType & a, const InternalRealType & b)
-                                   {return a + itk::Math::sqr(b / lambdaSpacing);});
-    m_SqrSpacingFilter->SetInput(cumulativeImage);
+
+    if ( dim == ImageDimension - 1 )
+      {
+      // The last component: fuse the accumulation of the squared
+      // component and the square root into a single pass that writes
+      // the final magnitude directly, instead of sweeping the
+      // cumulative image two more times.
+      m_SqrSpacingSqrtFilter->SetFunctor(
+        [lambdaSpacing](const InternalRealType & a, const InternalRealType & b)
+        {return static_cast< OutputPixelType >( std::sqrt( a + itk::Math::sqr(b / lambdaSpacing) ) );});
+      m_SqrSpacingSqrtFilter->SetInput(0, cumulativeImage);
+      m_SqrSpacingSqrtFilter->GraftOutput( this->GetOutput() );
+      m_SqrSpacingSqrtFilter->UpdateLargestPossibleRegion();
+      this->GraftOutput( m_SqrSpacingSqrtFilter->GetOutput() );
+      continue;
+      }
+
+    if ( dim == 0 )
+      {
+      // The first component is squared in place over the smoothed
+      // derivative, which seeds the cumulative image.
+      m_SqrSpacingFilter->SetFunctor(
+        [lambdaSpacing](const InternalRealType &, const InternalRealType & b)
+        {return itk::Math::sqr(b / lambdaSpacing);});
+      m_SqrSpacingFilter->SetInput( 0, m_SmoothingFilters[ImageDimension - 2]->GetOutput() );
+      }
+    else
+      {
+      m_SqrSpacingFilter->SetFunctor([lambdaSpacing](const InternalRealType & a, const InternalRealType & b)
+                                     {return a + itk::Math::sqr(b / lambdaSpacing);});
+      m_SqrSpacingFilter->SetInput(0, cumulativeImage);
+      }
 
     // run the mini pipeline for that dimension
     // Note: we must take care to update the requested region. Without that, a
@@ -259,10 +287,6 @@ GradientMagnitudeRecursiveGaussianImageFilter< TInputImage, TOutputImage >
     cumulativeImage = m_SqrSpacingFilter->GetOutput();
     cumulativeImage->DisconnectPipeline();
     }
-  m_SqrtFilter->SetInput(cumulativeImage);
-  m_SqrtFilter->GraftOutput( this->GetOutput() );
-  m_SqrtFilter->UpdateLargestPossibleRegion();
-  this->GraftOutput( m_SqrtFilter->GetOutput() );
 }
 } // end namespace itk
 
@@ -269,6 +269,21 @@ public:
   itkGetConstReferenceMacro( GenerateOutputImage, bool );
   itkBooleanMacro( GenerateOutputImage );
 
+  /** Set/Get whether the per-point B-spline basis function weights computed
+   * during fitting are retained and reused the next time the filter runs.
+   * The cached weights are only valid if the parametric point locations (and
+   * their ordering), the number of control points, the spline order, and the
+   * parametric domain are unchanged from one run to the next, i.e. only the
+   * point data and point weights may differ.  It is the responsibility of
+   * the caller to guarantee that the point locations are unchanged as this
+   * is not verified at run time.  The cache is bypassed for multi-level
+   * fitting.  This option is useful when the same fixed grid of points is
+   * refit repeatedly, e.g. when smoothing a displacement field at each
+   * iteration of a deformable registration.  Default = false. */
+  itkSetMacro( CacheBasisFunctionWeights, bool );
+  itkGetConstReferenceMacro( CacheBasisFunctionWeights, bool );
+  itkBooleanMacro( CacheBasisFunctionWeights );
+
   /** Get the control point lattice produced by the fitting process. */
   PointDataImagePointer GetPhiLattice()
     {
@@ -361,6 +376,18 @@ private:
 
   RealType                                     m_BSplineEpsilon{ 1e-3 };
   bool                                         m_IsFittingComplete{ false };
+
+  bool                                         m_CacheBasisFunctionWeights{ false };
+  bool                                         m_ReuseCachedBasisFunctionWeights{ false };
+  bool                                         m_CachedBasisFunctionWeightsAreValid{ false };
+  SizeValueType                                m_CachedWeightsNumberOfPoints{ 0 };
+  ArrayType                                    m_CachedWeightsNumberOfControlPoints;
+  SizeType                                     m_CachedWeightsParametricSize;
+  typename ImageType::PointType                m_CachedWeightsParametricOrigin;
+  typename ImageType::SpacingType              m_CachedWeightsParametricSpacing;
+  std::vector<RealType>                        m_CachedBasisFunctionWeights;
+  std::vector<RealType>                        m_CachedSumOfSquaredWeights;
+  std::vector<IndexType>                       m_CachedWeightFirstIndices;
 };
 } // end namespace itk
 
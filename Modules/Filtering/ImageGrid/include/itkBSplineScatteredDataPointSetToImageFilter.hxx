@@ -205,6 +205,11 @@ BSplineScatteredDataPointSetToImageFilter<TInputPointSet, TOutputImage>
   TOutputImage *output = this->GetOutput();
   const TInputPointSet *inputPointSet = this->GetInput();
 
+  // The filter instance may be run more than once, e.g. when the basis
+  // function weights are cached and reused.  Make sure each run starts
+  // with the fitting phase.
+  this->m_IsFittingComplete = false;
+
   // Create the output image
 
   itkDebugMacro( "Size: " << this->m_Size );
@@ -437,6 +442,50 @@ BSplineScatteredDataPointSetToImageFilter<TInputPointSet, TOutputImage>
       this->m_DeltaLatticePerThread[n]->Allocate();
       this->m_DeltaLatticePerThread[n]->FillBuffer( NumericTraits<PointDataType>::ZeroValue() );
       }
+
+    // Decide whether the basis function weights cached on a previous run
+    // can be reused for this run.  The cache is only engaged for
+    // single-level fitting since the control point grid changes with each
+    // fitting level.
+    if( this->m_CacheBasisFunctionWeights && this->m_MaximumNumberOfLevels == 1 )
+      {
+      const SizeValueType numberOfPoints = this->GetInput()->GetNumberOfPoints();
+
+      SizeValueType numberOfWeightsPerPoint = 1;
+      for( unsigned int i = 0; i < ImageDimension; i++ )
+        {
+        numberOfWeightsPerPoint *= ( this->m_SplineOrder[i] + 1 );
+        }
+
+      this->m_ReuseCachedBasisFunctionWeights =
+        this->m_CachedBasisFunctionWeightsAreValid &&
+        this->m_CachedWeightsNumberOfPoints == numberOfPoints &&
+        this->m_CachedWeightsNumberOfControlPoints ==
+          this->m_CurrentNumberOfControlPoints &&
+        this->m_CachedWeightsParametricSize == this->m_Size &&
+        this->m_CachedWeightsParametricOrigin == this->m_Origin &&
+        this->m_CachedWeightsParametricSpacing == this->m_Spacing;
+
+      if( !this->m_ReuseCachedBasisFunctionWeights )
+        {
+        this->m_CachedBasisFunctionWeightsAreValid = false;
+        this->m_CachedBasisFunctionWeights.resize(
+          numberOfPoints * numberOfWeightsPerPoint );
+        this->m_CachedSumOfSquaredWeights.resize( numberOfPoints );
+        this->m_CachedWeightFirstIndices.resize( numberOfPoints );
+        this->m_CachedWeightsNumberOfPoints = numberOfPoints;
+        this->m_CachedWeightsNumberOfControlPoints =
+          this->m_CurrentNumberOfControlPoints;
+        this->m_CachedWeightsParametricSize = this->m_Size;
+        this->m_CachedWeightsParametricOrigin = this->m_Origin;
+        this->m_CachedWeightsParametricSpacing = this->m_Spacing;
+        }
+      }
+    else
+      {
+      this->m_ReuseCachedBasisFunctionWeights = false;
+      this->m_CachedBasisFunctionWeightsAreValid = false;
+      }
     }
 }
 
@@ -522,79 +571,148 @@ BSplineScatteredDataPointSetToImageFilter<TInputPointSet, TOutputImage>
     end = input->GetNumberOfPoints();
     }
 
-  for( unsigned int n = start; n < end; n++ )
+  const bool reuseCachedWeights = this->m_ReuseCachedBasisFunctionWeights;
+  const bool storeCachedWeights = this->m_CacheBasisFunctionWeights &&
+    this->m_MaximumNumberOfLevels == 1 && !reuseCachedWeights;
+
+  SizeValueType numberOfWeightsPerPoint = 1;
+  unsigned int maximumSupportSize = 0;
+  for( unsigned int i = 0; i < ImageDimension; i++ )
     {
-    PointType point;
-    point.Fill( 0.0 );
+    numberOfWeightsPerPoint *= ( this->m_SplineOrder[i] + 1 );
+    if( this->m_SplineOrder[i] + 1 > maximumSupportSize )
+      {
+      maximumSupportSize = this->m_SplineOrder[i] + 1;
+      }
+    }
 
-    input->GetPoint( n, &point );
+  // Per-dimension 1-D basis function values for the current point.  The
+  // tensor product is separable, so the kernels are evaluated once per
+  // dimension and span offset instead of once per (node, dimension) pair
+  // of the support region.
+  vnl_matrix<RealType> basisFunctionValues( ImageDimension, maximumSupportSize );
 
-    for( unsigned int i = 0; i < ImageDimension; i++ )
+  for( unsigned int n = start; n < end; n++ )
+    {
+    typename RealImageType::IndexType firstIndex;
+    RealType w2Sum = 0.0;
+
+    if( reuseCachedWeights )
       {
-      unsigned int totalNumberOfSpans =
-        this->m_CurrentNumberOfControlPoints[i] - this->m_SplineOrder[i];
+      // The point locations are unchanged from the previous run so the
+      // tensor product basis function weights cached on that run can be
+      // restored without reparameterizing the point or evaluating the
+      // kernels.
+      const RealType *cachedWeights =
+        &this->m_CachedBasisFunctionWeights[n * numberOfWeightsPerPoint];
+
+      SizeValueType m = 0;
+      for( ItW.GoToBegin(); !ItW.IsAtEnd(); ++ItW )
+        {
+        ItW.Set( cachedWeights[m++] );
+        }
+      w2Sum = this->m_CachedSumOfSquaredWeights[n];
+      firstIndex = this->m_CachedWeightFirstIndices[n];
+      }
+    else
+      {
+      PointType point;
+      point.Fill( 0.0 );
 
-      p[i] = ( point[i] - this->m_Origin[i] ) * r[i];
-      if( std::abs( p[i] - static_cast<RealType>( totalNumberOfSpans ) ) <= epsilon[i] )
+      input->GetPoint( n, &point );
+
+      for( unsigned int i = 0; i < ImageDimension; i++ )
         {
-        p[i] = static_cast<RealType>( totalNumberOfSpans ) - epsilon[i];
+        unsigned int totalNumberOfSpans =
+          this->m_CurrentNumberOfControlPoints[i] - this->m_SplineOrder[i];
+
+        p[i] = ( point[i] - this->m_Origin[i] ) * r[i];
+        if( std::abs( p[i] - static_cast<RealType>( totalNumberOfSpans ) ) <= epsilon[i] )
+          {
+          p[i] = static_cast<RealType>( totalNumberOfSpans ) - epsilon[i];
+          }
+        if( p[i] < NumericTraits<RealType>::ZeroValue() && std::abs( p[i] ) <= epsilon[i] )
+          {
+          p[i] = NumericTraits<RealType>::ZeroValue();
+          }
+
+        if( p[i] < NumericTraits<RealType>::ZeroValue() ||
+            p[i] >= static_cast<RealType>( totalNumberOfSpans ) )
+          {
+          itkExceptionMacro( "The reparameterized point component " << p[i]
+            << " is outside the corresponding parametric domain of [0, "
+            << totalNumberOfSpans << ")." );
+          }
+
+        firstIndex[i] = static_cast<unsigned>( p[i] );
         }
-      if( p[i] < NumericTraits<RealType>::ZeroValue() && std::abs( p[i] ) <= epsilon[i] )
+
+      for( unsigned int i = 0; i < ImageDimension; i++ )
         {
-        p[i] = NumericTraits<RealType>::ZeroValue();
+        for( unsigned int k = 0; k < this->m_SplineOrder[i] + 1; k++ )
+          {
+          RealType u = static_cast<RealType>( p[i] -
+            static_cast<unsigned>( p[i] ) - k ) + 0.5 *
+            static_cast<RealType>( this->m_SplineOrder[i] - 1 );
+
+          switch( this->m_SplineOrder[i] )
+            {
+            case 0:
+              {
+              basisFunctionValues( i, k ) = this->m_KernelOrder0->Evaluate( u );
+              break;
+              }
+            case 1:
+              {
+              basisFunctionValues( i, k ) = this->m_KernelOrder1->Evaluate( u );
+              break;
+              }
+            case 2:
+              {
+              basisFunctionValues( i, k ) = this->m_KernelOrder2->Evaluate( u );
+              break;
+              }
+            case 3:
+              {
+              basisFunctionValues( i, k ) = this->m_KernelOrder3->Evaluate( u );
+              break;
+              }
+            default:
+              {
+              basisFunctionValues( i, k ) = this->m_Kernel[i]->Evaluate( u );
+              break;
+              }
+            }
+          }
         }
 
-      if( p[i] < NumericTraits<RealType>::ZeroValue() ||
-          p[i] >= static_cast<RealType>( totalNumberOfSpans ) )
+      for( ItW.GoToBegin(); !ItW.IsAtEnd(); ++ItW )
         {
-        itkExceptionMacro( "The reparameterized point component " << p[i]
-          << " is outside the corresponding parametric domain of [0, "
-          << totalNumberOfSpans << ")." );
+        RealType B = 1.0;
+        typename RealImageType::IndexType idx = ItW.GetIndex();
+        for( unsigned int i = 0; i < ImageDimension; i++ )
+          {
+          B *= basisFunctionValues( i, idx[i] );
+          }
+        ItW.Set( B );
+        w2Sum += B * B;
         }
-      }
 
-    RealType w2Sum = 0.0;
-    for( ItW.GoToBegin(); !ItW.IsAtEnd(); ++ItW )
-      {
-      RealType B = 1.0;
-      typename RealImageType::IndexType idx = ItW.GetIndex();
-      for( unsigned int i = 0; i < ImageDimension; i++ )
+      if( storeCachedWeights )
         {
-        RealType u = static_cast<RealType>( p[i] -
-          static_cast<unsigned>( p[i] ) - idx[i] ) + 0.5 *
-          static_cast<RealType>( this->m_SplineOrder[i] - 1 );
+        // Each thread handles a disjoint range of points so the cache can
+        // be filled without synchronization.
+        RealType *cachedWeights =
+          &this->m_CachedBasisFunctionWeights[n * numberOfWeightsPerPoint];
 
-        switch( this->m_SplineOrder[i] )
+        SizeValueType m = 0;
+        for( ItW.GoToBegin(); !ItW.IsAtEnd(); ++ItW )
           {
-          case 0:
-            {
-            B *= this->m_KernelOrder0->Evaluate( u );
-            break;
-            }
-          case 1:
-            {
-            B *= this->m_KernelOrder1->Evaluate( u );
-            break;
-            }
-          case 2:
-            {
-            B *= this->m_KernelOrder2->Evaluate( u );
-            break;
-            }
-          case 3:
-            {
-            B *= this->m_KernelOrder3->Evaluate( u );
-            break;
-            }
-          default:
-            {
-            B *= this->m_Kernel[i]->Evaluate( u );
-            break;
-            }
+          cachedWeights[m++] = ItW.Get();
           }
+        this->m_CachedSumOfSquaredWeights[n] = w2Sum;
+        this->m_CachedWeightFirstIndices[n] = firstIndex;
         }
-      ItW.Set( B );
-      w2Sum += B * B;
       }
 
     RealImageType * currentThreadOmegaLattice = this->m_OmegaLatticePerThread[threadId];
@@ -605,7 +723,7 @@ BSplineScatteredDataPointSetToImageFilter<TInputPointSet, TOutputImage>
       typename RealImageType::IndexType idx = ItW.GetIndex();
       for( unsigned int i = 0; i < ImageDimension; i++ )
         {
-        idx[i] += static_cast<unsigned>( p[i] );
+        idx[i] += firstIndex[i];
         if( this->m_CloseDimension[i] )
           {
           idx[i] %= size[i];
@@ -815,6 +933,11 @@ BSplineScatteredDataPointSetToImageFilter<TInputPointSet, TOutputImage>
         ItP.Set( P );
         }
       }
+
+    if( this->m_CacheBasisFunctionWeights && this->m_MaximumNumberOfLevels == 1 )
+      {
+      this->m_CachedBasisFunctionWeightsAreValid = true;
+      }
     }
 }
 
@@ -1220,6 +1343,7 @@ BSplineScatteredDataPointSetToImageFilter<TInputPointSet, TOutputImage>
 
   os << indent << "Do multi level: " << this->m_DoMultilevel << std::endl;
   os << indent << "Generate output image: " << this->m_GenerateOutputImage << std::endl;
+  os << indent << "Cache basis function weights: " << this->m_CacheBasisFunctionWeights << std::endl;
   os << indent << "Use point weights: " << this->m_UsePointWeights << std::endl;
   os << indent << "Maximum number of levels: " << this->m_MaximumNumberOfLevels << std::endl;
   os << indent << "Current level: " << this->m_CurrentLevel << std::endl;
@@ -129,6 +129,23 @@ protected:
 private:
   ShrinkFactorsType m_ShrinkFactors;
 
+  /** Whether input scanlines can be read through raw pointers, which
+   * is not the case for VectorImage and the image adaptors, whose
+   * internal pixel type differs from their PixelType. */
+  using RawInputAccessIsPossibleType =
+    std::integral_constant< bool,
+      std::is_same< typename TInputImage::InternalPixelType,
+                    typename TInputImage::PixelType >::value >;
+
+  /** Scanline implementation accumulating each bin from contiguous
+   * input segments through raw pointers, with the inner loops written
+   * so the compiler can vectorize them; the false_type overload keeps
+   * the iterator based accumulation for images without raw access. */
+  void AccumulateThreadedGenerateData(const OutputImageRegionType & outputRegionForThread,
+                                      std::true_type rawInputAccessIsPossible);
+  void AccumulateThreadedGenerateData(const OutputImageRegionType & outputRegionForThread,
+                                      std::false_type rawInputAccessIsPossible);
+
   /** Round different pixel types. */
   template< class TOutputType, class TInputType >
     typename std::enable_if<std::numeric_limits<TOutputType>::is_integer, TOutputType>::type
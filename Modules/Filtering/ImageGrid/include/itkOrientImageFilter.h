@@ -23,6 +23,7 @@
 #include "itkSpatialOrientationAdapter.h"
 #include <map>
 #include <string>
+#include <type_traits>  // For integral_constant and is_same.
 
 namespace itk
 {
@@ -295,6 +296,29 @@ protected:
 private:
   std::string GetMajorAxisFromPatientRelativeDirectionCosine(double x, double y, double z);
 
+  /** Whether pixels can be moved from the input to the output buffer
+   * through raw pointers, which requires a shared pixel layout and
+   * excludes changing pixel types, VectorImage and the image
+   * adaptors. */
+  using FusedCopyIsPossibleType =
+    std::integral_constant< bool,
+      std::is_same< InputImagePixelType, OutputImagePixelType >::value
+      && std::is_same< typename TInputImage::InternalPixelType, InputImagePixelType >::value
+      && std::is_same< typename TOutputImage::InternalPixelType, OutputImagePixelType >::value >;
+
+  /** Apply the permutation and the flips in a single threaded pass
+   * that copies source lines straight to their destination, without
+   * the intermediate volumes of the filter mini-pipeline. The
+   * false_type overload runs the mini-pipeline instead and keeps
+   * images without raw buffer access compiling. */
+  void FusedGenerateData(std::true_type fusedCopyIsPossible);
+  void FusedGenerateData(std::false_type fusedCopyIsPossible);
+
+  /** Previous implementation chaining PermuteAxesImageFilter,
+   * FlipImageFilter and CastImageFilter, used whenever the fused copy
+   * cannot be. */
+  void MiniPipelineGenerateData();
+
   CoordinateOrientationCode m_GivenCoordinateOrientation{SpatialOrientation::ITK_COORDINATE_ORIENTATION_RIP};
   CoordinateOrientationCode m_DesiredCoordinateOrientation{SpatialOrientation::ITK_COORDINATE_ORIENTATION_RIP};
   bool                      m_UseImageDirection{false};
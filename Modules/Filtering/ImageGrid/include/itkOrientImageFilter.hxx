@@ -23,8 +23,11 @@
 #include "itkCastImageFilter.h"
 #include "itkConstantPadImageFilter.h"
 #include "itkMetaDataObject.h"
+#include "itkMultiThreaderBase.h"
 #include "itkProgressAccumulator.h"
 
+#include <algorithm>  // For copy, min and reverse_copy.
+
 namespace itk
 {
 template< typename TInputImage, typename TOutputImage >
@@ -474,6 +477,208 @@ template< typename TInputImage, typename TOutputImage >
 void
 OrientImageFilter< TInputImage, TOutputImage >
 ::GenerateData()
+{
+  // Reorientation only rearranges pixels, so when the input and output
+  // buffers share a pixel layout the permutation and the flips are
+  // fused into a single pass over the volume; otherwise the filter
+  // mini-pipeline is run.
+  this->FusedGenerateData( FusedCopyIsPossibleType() );
+}
+
+template< typename TInputImage, typename TOutputImage >
+void
+OrientImageFilter< TInputImage, TOutputImage >
+::FusedGenerateData(std::false_type itkNotUsed(fusedCopyIsPossible))
+{
+  this->MiniPipelineGenerateData();
+}
+
+template< typename TInputImage, typename TOutputImage >
+void
+OrientImageFilter< TInputImage, TOutputImage >
+::FusedGenerateData(std::true_type itkNotUsed(fusedCopyIsPossible))
+{
+  this->AllocateOutputs();
+
+  InputImageConstPointer inputPtr = this->GetInput();
+  OutputImagePointer     outputPtr = this->GetOutput();
+
+  using PixelType = OutputImagePixelType;
+
+  const PixelType *inputBuffer = inputPtr->GetBufferPointer();
+  PixelType *outputBuffer = outputPtr->GetBufferPointer();
+
+  const InputImageRegionType & inputRegion = inputPtr->GetBufferedRegion();
+  const OffsetValueType *inputOffsetTable = inputPtr->GetOffsetTable();
+
+  // Output axis j follows input axis m_PermuteOrder[j], running
+  // backwards through it when the axis is flipped. Precompute per
+  // output axis the signed input stride of a unit output step and the
+  // constant that mirrors the index on the flipped axes.
+  OffsetValueType inputStride[InputImageDimension];
+  IndexValueType  mirrorOffset[InputImageDimension];
+  unsigned int j;
+  for ( j = 0; j < InputImageDimension; j++ )
+    {
+    const unsigned int inputAxis = m_PermuteOrder[j];
+    inputStride[j] = inputOffsetTable[inputAxis];
+    mirrorOffset[j] = 2 * inputRegion.GetIndex(inputAxis)
+                      + static_cast< IndexValueType >( inputRegion.GetSize(inputAxis) ) - 1;
+    if ( m_FlipAxes[j] )
+      {
+      inputStride[j] = -inputStride[j];
+      }
+    }
+
+  // The output axis that runs through the input buffer contiguously.
+  unsigned int inputContiguousAxis = 0;
+  for ( j = 0; j < InputImageDimension; j++ )
+    {
+    if ( m_PermuteOrder[j] == 0 )
+      {
+      inputContiguousAxis = j;
+      }
+    }
+
+  this->GetMultiThreader()->template ParallelizeImageRegion< OutputImageDimension >(
+    outputPtr->GetRequestedRegion(),
+    [this, inputPtr, outputPtr, inputBuffer, outputBuffer,
+     &inputStride, &mirrorOffset, inputContiguousAxis]
+    (const OutputImageRegionType & regionForThread)
+    {
+      if ( regionForThread.GetNumberOfPixels() == 0 )
+        {
+        return;
+        }
+
+      const typename TOutputImage::IndexType regionIndex = regionForThread.GetIndex();
+      const typename TOutputImage::SizeType regionSize = regionForThread.GetSize();
+
+      typename TOutputImage::IndexType outputIndex = regionIndex;
+      typename TInputImage::IndexType inputIndex;
+
+      if ( inputContiguousAxis == 0 )
+        {
+        // The fastest axis keeps its place: every output row is a
+        // contiguous input row, copied forward or reversed in one go.
+        const bool reversed = m_FlipAxes[0];
+        const SizeValueType lineLength = regionSize[0];
+        while ( true )
+          {
+          for ( unsigned int dim = 0; dim < InputImageDimension; dim++ )
+            {
+            inputIndex[m_PermuteOrder[dim]] =
+              m_FlipAxes[dim] ? mirrorOffset[dim] - outputIndex[dim] : outputIndex[dim];
+            }
+          const PixelType *inputRow = inputBuffer + inputPtr->ComputeOffset(inputIndex);
+          PixelType *outputRow = outputBuffer + outputPtr->ComputeOffset(outputIndex);
+          if ( !reversed )
+            {
+            std::copy(inputRow, inputRow + lineLength, outputRow);
+            }
+          else
+            {
+            // inputRow points at the source of the first output
+            // pixel, which is the last pixel of the source segment.
+            std::reverse_copy(inputRow - ( lineLength - 1 ), inputRow + 1, outputRow);
+            }
+
+          unsigned int dim = 1;
+          for ( ; dim < OutputImageDimension; dim++ )
+            {
+            outputIndex[dim]++;
+            if ( outputIndex[dim] < regionIndex[dim] + static_cast< IndexValueType >( regionSize[dim] ) )
+              {
+              break;
+              }
+            outputIndex[dim] = regionIndex[dim];
+            }
+          if ( dim == OutputImageDimension )
+            {
+            return;
+            }
+          }
+        }
+
+      // Transposing reorientation: visit the region in square tiles
+      // spanning the fastest output axis and the output axis that is
+      // contiguous in the input, exactly as PermuteAxesImageFilter
+      // does, with the flips folded into the signed strides.
+      const SizeValueType tileSize = 64;
+
+      unsigned int iterationAxes[OutputImageDimension];
+      IndexValueType iterationSteps[OutputImageDimension];
+      unsigned int numberOfIterationAxes = 0;
+      iterationAxes[numberOfIterationAxes] = 0;
+      iterationSteps[numberOfIterationAxes++] = static_cast< IndexValueType >( tileSize );
+      iterationAxes[numberOfIterationAxes] = inputContiguousAxis;
+      iterationSteps[numberOfIterationAxes++] = static_cast< IndexValueType >( tileSize );
+      for ( unsigned int dim = 1; dim < OutputImageDimension; dim++ )
+        {
+        if ( dim != inputContiguousAxis )
+          {
+          iterationAxes[numberOfIterationAxes] = dim;
+          iterationSteps[numberOfIterationAxes++] = 1;
+          }
+        }
+
+      const OffsetValueType outputTileStride = outputPtr->GetOffsetTable()[inputContiguousAxis];
+      const OffsetValueType inputPixelStride = inputStride[0];
+      const OffsetValueType inputLineStride = inputStride[inputContiguousAxis]; // +1 or -1
+
+      while ( true )
+        {
+        for ( unsigned int dim = 0; dim < InputImageDimension; dim++ )
+          {
+          inputIndex[m_PermuteOrder[dim]] =
+            m_FlipAxes[dim] ? mirrorOffset[dim] - outputIndex[dim] : outputIndex[dim];
+          }
+        const PixelType *inputTile = inputBuffer + inputPtr->ComputeOffset(inputIndex);
+        PixelType *outputTile = outputBuffer + outputPtr->ComputeOffset(outputIndex);
+
+        const SizeValueType tileExtentA = std::min( tileSize, static_cast< SizeValueType >(
+          regionIndex[0] + static_cast< IndexValueType >( regionSize[0] ) - outputIndex[0] ) );
+        const SizeValueType tileExtentB = std::min( tileSize, static_cast< SizeValueType >(
+          regionIndex[inputContiguousAxis]
+          + static_cast< IndexValueType >( regionSize[inputContiguousAxis] )
+          - outputIndex[inputContiguousAxis] ) );
+
+        for ( SizeValueType b = 0; b < tileExtentB; b++ )
+          {
+          PixelType *outputRow = outputTile + static_cast< OffsetValueType >( b ) * outputTileStride;
+          const PixelType *inputColumn = inputTile + static_cast< OffsetValueType >( b ) * inputLineStride;
+          for ( SizeValueType a = 0; a < tileExtentA; a++ )
+            {
+            outputRow[a] = inputColumn[static_cast< OffsetValueType >( a ) * inputPixelStride];
+            }
+          }
+
+        unsigned int k = 0;
+        for ( ; k < numberOfIterationAxes; k++ )
+          {
+          const unsigned int axis = iterationAxes[k];
+          outputIndex[axis] += iterationSteps[k];
+          if ( outputIndex[axis] < regionIndex[axis] + static_cast< IndexValueType >( regionSize[axis] ) )
+            {
+            break;
+            }
+          outputIndex[axis] = regionIndex[axis];
+          }
+        if ( k == numberOfIterationAxes )
+          {
+          break;
+          }
+        }
+    },
+    this);
+
+  this->GetOutput()->SetMetaDataDictionary( this->GetInput()->GetMetaDataDictionary() );
+}
+
+template< typename TInputImage, typename TOutputImage >
+void
+OrientImageFilter< TInputImage, TOutputImage >
+::MiniPipelineGenerateData()
 {
   // Create a process accumulator for tracking the progress of this minipipeline
   typename ProgressAccumulator::Pointer progress = ProgressAccumulator::New();
@@ -21,6 +21,8 @@
 #include "itkImageToImageFilter.h"
 #include "itkFixedArray.h"
 
+#include <type_traits>  // For integral_constant and is_same.
+
 namespace itk
 {
 /** \class PermuteAxesImageFilter
@@ -122,6 +124,27 @@ protected:
 
 
 private:
+  /** Whether pixels can be moved between the buffers of the input and
+   * the output image through raw pointers. VectorImage and the image
+   * adaptors, whose internal pixel type differs from their PixelType,
+   * are excluded and keep the index based implementation. */
+  using RawBufferAccessIsPossibleType =
+    std::integral_constant< bool,
+      std::is_same< typename TImage::InternalPixelType, typename TImage::PixelType >::value >;
+
+  /** Cache blocked implementation: the region is visited in square
+   * tiles spanning the fastest output axis and the output axis that is
+   * contiguous in the input, so both the strided reads and the
+   * sequential writes of a tile stay within the cache. Permutations
+   * that keep the fastest axis degenerate to contiguous row copies. */
+  void BlockedThreadedGenerateData(const OutputImageRegionType & outputRegionForThread,
+                                   std::true_type rawBufferAccessIsPossible);
+
+  /** Fallback for images without raw buffer access, sampling the input
+   * pixel by pixel through index computations. */
+  void BlockedThreadedGenerateData(const OutputImageRegionType & outputRegionForThread,
+                                   std::false_type rawBufferAccessIsPossible);
+
   PermuteOrderArrayType m_Order;
   PermuteOrderArrayType m_InverseOrder;
 };
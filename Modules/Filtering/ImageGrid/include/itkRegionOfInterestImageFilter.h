@@ -19,6 +19,7 @@
 #define itkRegionOfInterestImageFilter_h
 
 #include "itkImageToImageFilter.h"
+#include "itkIsSame.h"
 #include "itkSmartPointer.h"
 
 namespace itk
@@ -82,6 +83,20 @@ public:
   itkSetMacro(RegionOfInterest, RegionType);
   itkGetConstMacro(RegionOfInterest, RegionType);
 
+  /** Enable/Disable aliasing the input buffer instead of copying the
+   * pixel data. The output can only be a view when the input and
+   * output image types match and the region of interest occupies a
+   * single contiguous block of the input memory, i.e. it covers the
+   * full extent of the faster varying dimensions, at most a sub-range
+   * of one dimension, and has size one in the slower dimensions. When
+   * these conditions do not hold the region is copied as usual. The
+   * view holds a reference to the input pixel container, so the
+   * aliased memory stays valid even after the input image releases its
+   * data. Off by default. */
+  itkSetMacro(ViewOutput, bool);
+  itkGetConstMacro(ViewOutput, bool);
+  itkBooleanMacro(ViewOutput);
+
   /** ImageDimension enumeration */
   static constexpr unsigned int ImageDimension = TInputImage::ImageDimension;
   static constexpr unsigned int OutputImageDimension = TOutputImage::ImageDimension;
@@ -124,8 +139,25 @@ protected:
    *     ImageToImageFilter::GenerateData()  */
   void DynamicThreadedGenerateData(const RegionType & outputRegionForThread) override;
 
+  /** Overridden to produce a view of the input buffer when ViewOutput
+   * is enabled, before falling back to the threaded copy. */
+  void GenerateData() override;
+
 private:
+  /** Make the output alias the region of interest within the input
+   * buffer. Returns false when the region is not one contiguous block
+   * of input memory, in which case the pixel data is copied instead. */
+  bool GenerateViewOutput(const TrueType &);
+
+  // differing image types rule out aliasing the input
+  bool GenerateViewOutput(const FalseType &)
+  {
+    return false;
+  }
+
   RegionType m_RegionOfInterest;
+
+  bool m_ViewOutput;
 };
 } // end namespace itk
 
@@ -29,7 +29,8 @@ namespace itk
 
 template< typename TInputImage, typename TOutputImage >
 RegionOfInterestImageFilter< TInputImage, TOutputImage >
-::RegionOfInterestImageFilter()
+::RegionOfInterestImageFilter() :
+  m_ViewOutput( false )
 {
   this->DynamicMultiThreadingOn();
 }
@@ -103,6 +104,85 @@ RegionOfInterestImageFilter< TInputImage, TOutputImage >
   outputPtr->SetOrigin(outputOrigin);
 }
 
+template< typename TInputImage, typename TOutputImage >
+void
+RegionOfInterestImageFilter< TInputImage, TOutputImage >
+::GenerateData()
+{
+  // Alias the input buffer when possible instead of copying.
+  if ( m_ViewOutput
+       && this->GenerateViewOutput( IsSame< TInputImage, TOutputImage >() ) )
+    {
+    this->UpdateProgress(1.0);
+    return;
+    }
+
+  this->Superclass::GenerateData();
+}
+
+template< typename TInputImage, typename TOutputImage >
+bool
+RegionOfInterestImageFilter< TInputImage, TOutputImage >
+::GenerateViewOutput(const TrueType &)
+{
+  const TInputImage *inputPtr = this->GetInput();
+  TOutputImage      *outputPtr = this->GetOutput();
+
+  const RegionType & bufferedRegion = inputPtr->GetBufferedRegion();
+  const SizeValueType numberOfBufferedPixels = bufferedRegion.GetNumberOfPixels();
+
+  if ( inputPtr->GetBufferPointer() == nullptr
+       || numberOfBufferedPixels == 0
+       || !bufferedRegion.IsInside(m_RegionOfInterest) )
+    {
+    return false;
+    }
+
+  // A view requires the region of interest to be a single contiguous
+  // stretch of the buffer. Walking the dimensions from fastest to
+  // slowest, the region may stop covering the full buffered extent at
+  // one dimension; beyond that every dimension must have size one.
+  bool coversFullExtent = true;
+  for ( unsigned int i = 0; i < ImageDimension; ++i )
+    {
+    if ( !coversFullExtent && m_RegionOfInterest.GetSize()[i] > 1 )
+      {
+      return false;
+      }
+    if ( m_RegionOfInterest.GetSize()[i] != bufferedRegion.GetSize()[i]
+         || m_RegionOfInterest.GetIndex()[i] != bufferedRegion.GetIndex()[i] )
+      {
+      coversFullExtent = false;
+      }
+    }
+
+  // Buffer elements per pixel; more than one when the container stores
+  // pixel components individually (e.g. VectorImage).
+  const SizeValueType elementsPerPixel =
+    inputPtr->GetPixelContainer()->Size() / numberOfBufferedPixels;
+
+  const OffsetValueType pixelOffset =
+    inputPtr->ComputeOffset( m_RegionOfInterest.GetIndex() );
+
+  // The output largest possible region is the zero-based region of
+  // interest computed by GenerateOutputInformation
+  outputPtr->SetBufferedRegion( outputPtr->GetLargestPossibleRegion() );
+
+  using PixelContainerType = typename TOutputImage::PixelContainer;
+  using ElementType = typename PixelContainerType::Element;
+
+  typename PixelContainerType::Pointer view = PixelContainerType::New();
+  auto * buffer = const_cast< ElementType * >( inputPtr->GetBufferPointer() );
+  view->SetImportPointer( buffer + pixelOffset * static_cast< OffsetValueType >( elementsPerPixel ),
+                          m_RegionOfInterest.GetNumberOfPixels() * elementsPerPixel,
+                          false );
+  // keep the input pixel container alive for the lifetime of the view
+  view->SetBufferOwner( inputPtr->GetPixelContainer() );
+  outputPtr->SetPixelContainer(view);
+
+  return true;
+}
+
 template< typename TInputImage, typename TOutputImage >
 void
 RegionOfInterestImageFilter< TInputImage, TOutputImage >
@@ -137,6 +217,7 @@ RegionOfInterestImageFilter< TInputImage, TOutputImage >
   Superclass::PrintSelf(os, indent);
 
   os << indent << "RegionOfInterest: " << m_RegionOfInterest << std::endl;
+  os << indent << "ViewOutput: " << ( m_ViewOutput ? "On" : "Off" ) << std::endl;
 }
 } // end namespace itk
 
@@ -21,6 +21,7 @@
 #include "itkFixedArray.h"
 #include "itkTransform.h"
 #include "itkImageRegionIterator.h"
+#include "itkImageScanlineIterator.h"
 #include "itkImageToImageFilter.h"
 #include "itkExtrapolateImageFunction.h"
 #include "itkLinearInterpolateImageFunction.h"
@@ -28,6 +29,7 @@
 #include "itkDefaultConvertPixelTraits.h"
 #include "itkDataObjectDecorator.h"
 
+#include <type_traits>  // For integral_constant and is_same.
 
 namespace itk
 {
@@ -342,6 +344,57 @@ private:
   template <typename TPixel>
   static PixelType CastPixelWithBoundsChecking(const TPixel value);
 
+  /** Resample one output scan line whose mapped positions vary along a
+   * single input axis. The interpolation weights and neighbor offsets
+   * of all the other dimensions are then constant for the whole line,
+   * so they are computed once here and reused for every pixel, which
+   * avoids the per-pixel interpolator call. Only called when the plain
+   * linear interpolator is in use, whose evaluation it reproduces. */
+  void ResampleScanlineWithCachedWeights(ImageScanlineIterator< TOutputImage > & outIt,
+                                         const ContinuousInputIndexType & scanStartIndex,
+                                         const ContinuousInputIndexType & scanEndIndex,
+                                         unsigned int scanAxis);
+
+  /** Write one output scan line whose continuous input indices have
+   * already been computed. Maximal runs of samples inside the input
+   * buffer go through the interpolator's batched entry point, which
+   * costs one virtual call per run instead of one per pixel; the
+   * samples outside get the extrapolator or default pixel value. */
+  void EvaluateScanlineThroughInterpolator(
+    ImageScanlineIterator< TOutputImage > & outIt,
+    const ContinuousInputIndexType *sampleIndices,
+    const unsigned char *sampleIsInside,
+    typename InterpolatorType::OutputType *sampleValues,
+    SizeValueType numberOfSamples);
+
+  /** Whether rows of pixels can be moved as raw memory between the
+   * input and the output image. This excludes a changing pixel type as
+   * well as VectorImage and the image adaptors, whose internal pixel
+   * type differs from their PixelType. */
+  using RowCopyIsPossibleType =
+    std::integral_constant< bool,
+      std::is_same< InputPixelType, PixelType >::value
+      && std::is_same< typename TInputImage::InternalPixelType, InputPixelType >::value
+      && std::is_same< typename TOutputImage::InternalPixelType, PixelType >::value >;
+
+  /** Whether the current transform maps the output grid onto the input
+   * grid with a pure integer index shift, as the identity transform and
+   * whole-voxel translations do when the two grids match. Evaluated
+   * once in BeforeThreadedGenerateData(); when it holds, the shift is
+   * stored in m_GridShift and resampling degenerates to copying rows. */
+  bool CanCopyInputRows();
+
+  /** Resample by copying: each output row is the input row shifted by
+   * m_GridShift, so the overlap with the input buffer is moved with
+   * memcpy and the pixels falling outside of it are filled with the
+   * default pixel value. Only used when CanCopyInputRows() held; the
+   * false_type overload keeps images without row copy support, which
+   * never take the fast path, compiling. */
+  void GridShiftThreadedGenerateData(const OutputImageRegionType & outputRegionForThread,
+                                     std::true_type rowCopyIsPossible);
+  void GridShiftThreadedGenerateData(const OutputImageRegionType & outputRegionForThread,
+                                     std::false_type rowCopyIsPossible);
+
   SizeType                m_Size;         // Size of the output image
   InterpolatorPointerType m_Interpolator; // Image function for
                                           // interpolation
@@ -356,6 +409,11 @@ private:
   IndexType       m_OutputStartIndex;     // output image start index
   bool            m_UseReferenceImage{ false };
 
+  bool m_UseGridShiftFastPath{ false };   // copy rows instead of
+                                          // interpolating
+  typename TInputImage::OffsetType m_GridShift; // input index of an output
+                                                // index under the transform
+
 };
 } // end namespace itk
 
@@ -26,8 +26,13 @@
 #include "itkImageScanlineIterator.h"
 #include "itkSpecialCoordinatesImage.h"
 #include "itkDefaultConvertPixelTraits.h"
+#include "itkMath.h"
 
+#include <algorithm>    // For min and max.
+#include <cmath>        // For abs.
+#include <cstring>      // For strcmp and memcpy.
 #include <type_traits>  // For is_same.
+#include <vector>       // For the per scan line sample buffers.
 
 namespace itk
 {
@@ -46,6 +51,7 @@ ResampleImageFilter< TInputImage, TOutputImage, TInterpolatorPrecisionType, TTra
 
   m_Size.Fill( 0 );
   m_OutputStartIndex.Fill( 0 );
+  m_GridShift.Fill( 0 );
 
   m_OutputDirection.SetIdentity();
 
@@ -152,6 +158,11 @@ ResampleImageFilter< TInputImage, TOutputImage, TInterpolatorPrecisionType, TTra
                                          zeroComponent );
       }
     }
+
+  // Detect the degenerate but common case of an identity transform or
+  // a whole-voxel translation between matching grids, which needs no
+  // interpolation at all.
+  m_UseGridShiftFastPath = this->CanCopyInputRows();
 }
 
 template< typename TInputImage,
@@ -193,6 +204,13 @@ ResampleImageFilter< TInputImage, TOutputImage, TInterpolatorPrecisionType, TTra
   const bool isSpecialCoordinatesImage = ( dynamic_cast< const InputSpecialCoordinatesImageType * >( this->GetInput() )
        || dynamic_cast< const OutputSpecialCoordinatesImageType * >( this->GetOutput() ) );
 
+  // When the transform reduces to an integer grid shift, the output is
+  // assembled from plain row copies.
+  if ( m_UseGridShiftFastPath && !isSpecialCoordinatesImage )
+    {
+    this->GridShiftThreadedGenerateData(outputRegionForThread, RowCopyIsPossibleType());
+    return;
+    }
 
   // Check whether we can use a fast path for resampling. Fast path
   // can be used if the transformation is linear. Transform respond
@@ -346,7 +364,7 @@ ResampleImageFilter< TInputImage, TOutputImage, TInterpolatorPrecisionType, TTra
 
 
   // Create an iterator that will walk the output region for this thread.
-  using OutputIterator = ImageRegionIteratorWithIndex< TOutputImage >;
+  using OutputIterator = ImageScanlineIterator< TOutputImage >;
   OutputIterator outIt(outputPtr, outputRegionForThread);
 
   // Define a few indices that will be used to translate from an input pixel
@@ -354,42 +372,93 @@ ResampleImageFilter< TInputImage, TOutputImage, TInterpolatorPrecisionType, TTra
   PointType outputPoint;         // Coordinates of current output pixel
   PointType inputPoint;          // Coordinates of current input pixel
 
-  ContinuousInputIndexType inputIndex;
-
   using OutputType = typename InterpolatorType::OutputType;
 
-  // Walk the output region
-  outIt.GoToBegin();
+  // Buffer one output scan line of mapped positions so the samples
+  // inside the input buffer can go through the interpolator's batched
+  // entry point.
+  const SizeValueType numberOfSamples = outputRegionForThread.GetSize(0);
 
+  std::vector< ContinuousInputIndexType > sampleIndices(numberOfSamples);
+  std::vector< unsigned char >            sampleIsInside(numberOfSamples);
+  std::vector< OutputType >               sampleValues(numberOfSamples);
+
+  // Walk the output region
   while ( !outIt.IsAtEnd() )
     {
-    // Determine the index of the current output pixel
-    outputPtr->TransformIndexToPhysicalPoint(outIt.GetIndex(), outputPoint);
-
-    // Compute corresponding input pixel position
-    inputPoint = transformPtr->TransformPoint(outputPoint);
-    const bool isInsideInput = inputPtr->TransformPhysicalPointToContinuousIndex(inputPoint, inputIndex);
+    IndexType index = outIt.GetIndex();
 
-    OutputType value;
-    // Evaluate input at right position and copy to the output
-    if( m_Interpolator->IsInsideBuffer(inputIndex) && ( !isSpecialCoordinatesImage || isInsideInput ) )
+    for ( SizeValueType k = 0; k < numberOfSamples; k++ )
       {
-      value = m_Interpolator->EvaluateAtContinuousIndex(inputIndex);
-      outIt.Set( Self::CastPixelWithBoundsChecking(value) );
+      // Determine the index of the current output pixel
+      outputPtr->TransformIndexToPhysicalPoint(index, outputPoint);
+
+      // Compute corresponding input pixel position
+      inputPoint = transformPtr->TransformPoint(outputPoint);
+      const bool isInsideInput =
+        inputPtr->TransformPhysicalPointToContinuousIndex(inputPoint, sampleIndices[k]);
+
+      sampleIsInside[k] = m_Interpolator->IsInsideBuffer(sampleIndices[k])
+                          && ( !isSpecialCoordinatesImage || isInsideInput );
+      ++index[0];
       }
-    else
+
+    this->EvaluateScanlineThroughInterpolator( outIt, &sampleIndices[0],
+      &sampleIsInside[0], &sampleValues[0], numberOfSamples );
+    outIt.NextLine();
+    }
+}
+
+template< typename TInputImage,
+          typename TOutputImage,
+          typename TInterpolatorPrecisionType,
+          typename TTransformPrecisionType >
+void
+ResampleImageFilter< TInputImage, TOutputImage, TInterpolatorPrecisionType, TTransformPrecisionType >
+::EvaluateScanlineThroughInterpolator(
+  ImageScanlineIterator< TOutputImage > & outIt,
+  const ContinuousInputIndexType *sampleIndices,
+  const unsigned char *sampleIsInside,
+  typename InterpolatorType::OutputType *sampleValues,
+  SizeValueType numberOfSamples)
+{
+  // Batch maximal runs of samples inside the input buffer
+  SizeValueType k = 0;
+  while ( k < numberOfSamples )
+    {
+    if ( sampleIsInside[k] )
       {
-      if( m_Extrapolator.IsNull() )
+      const SizeValueType runStart = k;
+      while ( k < numberOfSamples && sampleIsInside[k] )
         {
-        outIt.Set( m_DefaultPixelValue ); // default background value
-        }
-      else
-        {
-        value = m_Extrapolator->EvaluateAtContinuousIndex( inputIndex );
-        outIt.Set( Self::CastPixelWithBoundsChecking(value) );
+        ++k;
         }
+      m_Interpolator->EvaluateBatchAtContinuousIndex( sampleIndices + runStart,
+        k - runStart, sampleValues + runStart );
       }
+    else
+      {
+      ++k;
+      }
+    }
 
+  // Copy the values to the output
+  for ( k = 0; k < numberOfSamples; k++ )
+    {
+    if ( sampleIsInside[k] )
+      {
+      outIt.Set( Self::CastPixelWithBoundsChecking(sampleValues[k]) );
+      }
+    else if ( m_Extrapolator.IsNull() )
+      {
+      outIt.Set( m_DefaultPixelValue ); // default background value
+      }
+    else
+      {
+      const typename InterpolatorType::OutputType value =
+        m_Extrapolator->EvaluateAtContinuousIndex( sampleIndices[k] );
+      outIt.Set( Self::CastPixelWithBoundsChecking(value) );
+      }
     ++outIt;
     }
 }
@@ -419,11 +488,6 @@ ResampleImageFilter< TInputImage, TOutputImage, TInterpolatorPrecisionType, TTra
 
   using OutputType = typename InterpolatorType::OutputType;
 
-  // Cache information from the superclass
-  PixelType defaultValue = this->GetDefaultPixelValue();
-
-  using OutputType = typename InterpolatorType::OutputType;
-
   // As we walk across a scan line in the output image, we trace
   // an oriented/scaled/translated line in the input image. Each scan
   // line has a starting and ending point. Since all transforms
@@ -437,6 +501,23 @@ ResampleImageFilter< TInputImage, TOutputImage, TInterpolatorPrecisionType, TTra
   // streaming, etc ).
   //
 
+  // The cached-weights fast path below bypasses the interpolator, so
+  // it is only taken when the plain linear interpolator would have
+  // been called. Subclasses of the linear interpolator may override
+  // the evaluation and are excluded by the exact name comparison.
+  const bool linearInterpolation =
+    ( std::strcmp( m_Interpolator->GetNameOfClass(),
+                   "LinearInterpolateImageFunction" ) == 0 );
+
+  // Buffer one output scan line of mapped positions so the samples
+  // inside the input buffer can go through the interpolator's batched
+  // entry point.
+  const SizeValueType numberOfSamples = outputRegionForThread.GetSize(0);
+
+  std::vector< ContinuousInputIndexType > sampleIndices(numberOfSamples);
+  std::vector< unsigned char >            sampleIsInside(numberOfSamples);
+  std::vector< OutputType >               sampleValues(numberOfSamples);
+
   while ( !outIt.IsAtEnd() )
     {
     // Determine the continuous index of the first and end pixel of output
@@ -456,14 +537,39 @@ ResampleImageFilter< TInputImage, TOutputImage, TInterpolatorPrecisionType, TTra
     inputPoint = transformPtr->TransformPoint(outputPoint);
     inputPtr->TransformPhysicalPointToContinuousIndex(inputPoint, endIndex);
 
-    IndexValueType scanlineIndex = outIt.GetIndex()[0];
+    // A linear transform maps every scan line to the same direction in
+    // the input index space. When that direction has at most one
+    // nonzero component, the interpolation weights of all the other
+    // dimensions are constant along the line and can be computed once
+    // per scan line instead of once per pixel.
+    if ( linearInterpolation )
+      {
+      unsigned int scanAxis = 0;
+      unsigned int numberOfVaryingAxes = 0;
+      for ( unsigned int i = 0; i < ImageDimension; ++i )
+        {
+        if ( endIndex[i] != startIndex[i] )
+          {
+          scanAxis = i;
+          ++numberOfVaryingAxes;
+          }
+        }
+      if ( numberOfVaryingAxes <= 1 )
+        {
+        this->ResampleScanlineWithCachedWeights(outIt, startIndex, endIndex, scanAxis);
+        outIt.NextLine();
+        continue;
+        }
+      }
 
+    const IndexValueType scanlineIndex = outIt.GetIndex()[0];
 
-    while ( !outIt.IsAtEndOfLine() )
+    for ( SizeValueType k = 0; k < numberOfSamples; k++ )
       {
-
       // Perform linear interpolation between startIndex and endIndex
-      const double alpha = (scanlineIndex - largestPossibleRegion.GetIndex(0)) / (double)(largestPossibleRegion.GetSize(0));
+      const double alpha = ( scanlineIndex + static_cast< IndexValueType >( k )
+                             - largestPossibleRegion.GetIndex(0) )
+                           / (double)(largestPossibleRegion.GetSize(0));
 
       ContinuousInputIndexType inputIndex( startIndex );
       for (unsigned int i = 0; i < ImageDimension; ++i)
@@ -471,33 +577,351 @@ ResampleImageFilter< TInputImage, TOutputImage, TInterpolatorPrecisionType, TTra
         inputIndex[i] += alpha * ( endIndex[i] - startIndex[i] );
         }
 
-      OutputType value;
-      // Evaluate input at right position and copy to the output
-      if ( m_Interpolator->IsInsideBuffer(inputIndex) )
+      sampleIndices[k] = inputIndex;
+      sampleIsInside[k] = m_Interpolator->IsInsideBuffer(inputIndex);
+      }
+
+    this->EvaluateScanlineThroughInterpolator( outIt, &sampleIndices[0],
+      &sampleIsInside[0], &sampleValues[0], numberOfSamples );
+    outIt.NextLine();
+    }
+}
+
+template< typename TInputImage,
+          typename TOutputImage,
+          typename TInterpolatorPrecisionType,
+          typename TTransformPrecisionType >
+bool
+ResampleImageFilter< TInputImage, TOutputImage, TInterpolatorPrecisionType, TTransformPrecisionType >
+::CanCopyInputRows()
+{
+  // Rows are moved as raw pixel memory, so the input and the output
+  // image must share one pixel layout.
+  if ( !RowCopyIsPossibleType::value )
+    {
+    return false;
+    }
+
+  if ( InputImageDimension != ImageDimension )
+    {
+    return false;
+    }
+
+  // An extrapolator changes the values outside of the input buffer,
+  // which the copy path fills with the default value instead.
+  if ( !m_Extrapolator.IsNull() )
+    {
+    return false;
+    }
+
+  // The copy reproduces the interpolated values only when the
+  // interpolator is exact at grid positions, which holds for the plain
+  // linear and nearest neighbor interpolators. Subclasses may override
+  // the evaluation and are excluded by the exact name comparison.
+  const char * const interpolatorName = m_Interpolator->GetNameOfClass();
+  if ( std::strcmp( interpolatorName, "LinearInterpolateImageFunction" ) != 0
+       && std::strcmp( interpolatorName, "NearestNeighborInterpolateImageFunction" ) != 0 )
+    {
+    return false;
+    }
+
+  const TransformType *transformPtr = this->GetTransform();
+  if ( transformPtr->GetTransformCategory() != TransformType::Linear )
+    {
+    return false;
+    }
+
+  const OutputImageType *outputPtr = this->GetOutput();
+  const InputImageType *inputPtr = this->GetInput();
+
+  const IndexType outputStart = outputPtr->GetLargestPossibleRegion().GetIndex();
+
+  PointType outputPoint;
+  PointType inputPoint;
+
+  // Map the start corner of the output grid into the input index
+  // space. It must land on a grid position, and the offset to it is
+  // the candidate shift. This covers the identity transform as well as
+  // any translation by a whole number of voxels, independently of the
+  // transform class that expresses it.
+  IndexType index = outputStart;
+  ContinuousInputIndexType mappedStart;
+  outputPtr->TransformIndexToPhysicalPoint(index, outputPoint);
+  inputPoint = transformPtr->TransformPoint(outputPoint);
+  inputPtr->TransformPhysicalPointToContinuousIndex(inputPoint, mappedStart);
+
+  const double tolerance = 1e-8; // in voxel units
+
+  for ( unsigned int dim = 0; dim < ImageDimension; ++dim )
+    {
+    const auto rounded = Math::Round< OffsetValueType >( mappedStart[dim] );
+    if ( std::abs( mappedStart[dim] - static_cast< double >( rounded ) ) > tolerance )
+      {
+      return false;
+      }
+    m_GridShift[dim] = rounded - outputStart[dim];
+    }
+
+  // The transform is linear, so the shift extends from the corner to
+  // the whole grid exactly when every unit output grid step maps to
+  // the identical unit input grid step.
+  for ( unsigned int axis = 0; axis < ImageDimension; ++axis )
+    {
+    index = outputStart;
+    index[axis] += 1;
+    ContinuousInputIndexType mappedStep;
+    outputPtr->TransformIndexToPhysicalPoint(index, outputPoint);
+    inputPoint = transformPtr->TransformPoint(outputPoint);
+    inputPtr->TransformPhysicalPointToContinuousIndex(inputPoint, mappedStep);
+    for ( unsigned int dim = 0; dim < ImageDimension; ++dim )
+      {
+      const double expected = mappedStart[dim] + ( dim == axis ? 1.0 : 0.0 );
+      if ( std::abs( mappedStep[dim] - expected ) > tolerance )
         {
-        value = m_Interpolator->EvaluateAtContinuousIndex(inputIndex);
-        outIt.Set( Self::CastPixelWithBoundsChecking(value) );
+        return false;
         }
-      else
+      }
+    }
+
+  return true;
+}
+
+template< typename TInputImage,
+          typename TOutputImage,
+          typename TInterpolatorPrecisionType,
+          typename TTransformPrecisionType >
+void
+ResampleImageFilter< TInputImage, TOutputImage, TInterpolatorPrecisionType, TTransformPrecisionType >
+::GridShiftThreadedGenerateData(const OutputImageRegionType & outputRegionForThread,
+                                std::true_type itkNotUsed(rowCopyIsPossible))
+{
+  OutputImageType *outputPtr = this->GetOutput();
+  const InputImageType *inputPtr = this->GetInput();
+
+  const typename TInputImage::RegionType & inputRegion = inputPtr->GetBufferedRegion();
+
+  const PixelType defaultValue = this->GetDefaultPixelValue();
+
+  using OutputIterator = ImageScanlineIterator< TOutputImage >;
+  OutputIterator outIt(outputPtr, outputRegionForThread);
+
+  const SizeValueType lineLength = outputRegionForThread.GetSize(0);
+  const IndexValueType inputRowBegin = inputRegion.GetIndex(0);
+  const IndexValueType inputRowEnd = inputRowBegin
+                                     + static_cast< IndexValueType >( inputRegion.GetSize(0) );
+
+  while ( !outIt.IsAtEnd() )
+    {
+    const IndexType outputIndex = outIt.GetIndex();
+    PixelType *outLine = &outIt.Value();
+
+    // Input index of the first pixel of this output row. The row only
+    // holds input values when all its fixed coordinates fall inside
+    // the input buffer.
+    typename TInputImage::IndexType inputIndex;
+    bool rowInsideInput = true;
+    for ( unsigned int dim = 0; dim < ImageDimension; ++dim )
+      {
+      inputIndex[dim] = outputIndex[dim] + m_GridShift[dim];
+      if ( dim > 0
+           && ( inputIndex[dim] < inputRegion.GetIndex(dim)
+                || inputIndex[dim] >= inputRegion.GetIndex(dim)
+                     + static_cast< IndexValueType >( inputRegion.GetSize(dim) ) ) )
         {
-        if( m_Extrapolator.IsNull() )
-          {
-          outIt.Set(defaultValue); // default background value
-          }
-        else
-          {
-          value = m_Extrapolator->EvaluateAtContinuousIndex( inputIndex );
-          outIt.Set( Self::CastPixelWithBoundsChecking(value) );
-          }
+        rowInsideInput = false;
         }
+      }
+
+    // Portion of the row that overlaps the input buffer; everything
+    // outside of it is background.
+    const IndexValueType copyBegin = std::max(inputIndex[0], inputRowBegin);
+    const IndexValueType copyEnd = std::min(inputIndex[0]
+                                            + static_cast< IndexValueType >( lineLength ),
+                                            inputRowEnd);
 
-      ++outIt;
-      ++scanlineIndex;
+    if ( !rowInsideInput || copyEnd <= copyBegin )
+      {
+      std::fill_n(outLine, lineLength, defaultValue);
       }
+    else
+      {
+      const auto headLength = static_cast< SizeValueType >( copyBegin - inputIndex[0] );
+      const auto copyLength = static_cast< SizeValueType >( copyEnd - copyBegin );
+
+      std::fill_n(outLine, headLength, defaultValue);
+
+      typename TInputImage::IndexType inputCopyIndex = inputIndex;
+      inputCopyIndex[0] = copyBegin;
+      std::memcpy(outLine + headLength,
+                  &inputPtr->GetPixel(inputCopyIndex),
+                  copyLength * sizeof( PixelType ));
+
+      std::fill_n(outLine + headLength + copyLength,
+                  lineLength - headLength - copyLength,
+                  defaultValue);
+      }
+
+    outIt.GoToEndOfLine();
     outIt.NextLine();
     }
 }
 
+template< typename TInputImage,
+          typename TOutputImage,
+          typename TInterpolatorPrecisionType,
+          typename TTransformPrecisionType >
+void
+ResampleImageFilter< TInputImage, TOutputImage, TInterpolatorPrecisionType, TTransformPrecisionType >
+::GridShiftThreadedGenerateData(const OutputImageRegionType & outputRegionForThread,
+                                std::false_type itkNotUsed(rowCopyIsPossible))
+{
+  // Never reached: CanCopyInputRows() rejects images without row copy
+  // support, so the fast path flag cannot be set for them. The regular
+  // linear path handles the region instead.
+  this->LinearThreadedGenerateData(outputRegionForThread);
+}
+
+template< typename TInputImage,
+          typename TOutputImage,
+          typename TInterpolatorPrecisionType,
+          typename TTransformPrecisionType >
+void
+ResampleImageFilter< TInputImage, TOutputImage, TInterpolatorPrecisionType, TTransformPrecisionType >
+::ResampleScanlineWithCachedWeights(ImageScanlineIterator< TOutputImage > & outIt,
+                                    const ContinuousInputIndexType & scanStartIndex,
+                                    const ContinuousInputIndexType & scanEndIndex,
+                                    unsigned int scanAxis)
+{
+  const InputImageType *inputPtr = this->GetInput();
+
+  using InputIndexType = typename InputImageType::IndexType;
+  using InputIndexValueType = typename InputImageType::IndexValueType;
+  using OutputType = typename InterpolatorType::OutputType;
+
+  const InputImageRegionType & bufferedRegion = inputPtr->GetBufferedRegion();
+
+  // Base neighbor indices and fractional offsets of the dimensions
+  // that do not vary along the scan line. Neighbors reaching past the
+  // buffer are folded back onto the edge pixel with their weights left
+  // untouched, exactly as LinearInterpolateImageFunction does.
+  InputIndexType lowerIndex;
+  InputIndexType upperIndex;
+  double fraction[ImageDimension];
+  for ( unsigned int dim = 0; dim < ImageDimension; ++dim )
+    {
+    const auto floorIndex = Math::Floor< InputIndexValueType >( scanStartIndex[dim] );
+    fraction[dim] = static_cast< double >( scanStartIndex[dim] )
+                    - static_cast< double >( floorIndex );
+    const InputIndexValueType first = bufferedRegion.GetIndex(dim);
+    const InputIndexValueType last = first
+      + static_cast< InputIndexValueType >( bufferedRegion.GetSize(dim) ) - 1;
+    lowerIndex[dim] = std::min( std::max( floorIndex, first ), last );
+    upperIndex[dim] = std::min( std::max( floorIndex + 1, first ), last );
+    }
+
+  // Each corner combines a lower or upper neighbor choice in every
+  // frozen dimension. The scan axis component is filled in per pixel.
+  constexpr unsigned int numberOfCorners = 1u << ( ImageDimension - 1 );
+  InputIndexType cornerIndex[numberOfCorners];
+  double         cornerWeight[numberOfCorners];
+  for ( unsigned int corner = 0; corner < numberOfCorners; ++corner )
+    {
+    double         weight = 1.0;
+    InputIndexType index;
+    unsigned int   upper = corner;
+    for ( unsigned int dim = 0; dim < ImageDimension; ++dim )
+      {
+      if ( dim == scanAxis )
+        {
+        index[dim] = 0;
+        continue;
+        }
+      if ( upper & 1 )
+        {
+        index[dim] = upperIndex[dim];
+        weight *= fraction[dim];
+        }
+      else
+        {
+        index[dim] = lowerIndex[dim];
+        weight *= 1.0 - fraction[dim];
+        }
+      upper >>= 1;
+      }
+    cornerIndex[corner] = index;
+    cornerWeight[corner] = weight;
+    }
+
+  const InputIndexValueType scanFirst = bufferedRegion.GetIndex(scanAxis);
+  const InputIndexValueType scanLast = scanFirst
+    + static_cast< InputIndexValueType >( bufferedRegion.GetSize(scanAxis) ) - 1;
+
+  const PixelType defaultValue = this->GetDefaultPixelValue();
+
+  const OutputImageRegionType & largestPossibleRegion =
+    this->GetOutput()->GetLargestPossibleRegion();
+
+  IndexValueType scanlineIndex = outIt.GetIndex()[0];
+
+  ContinuousInputIndexType inputIndex( scanStartIndex );
+
+  while ( !outIt.IsAtEndOfLine() )
+    {
+    // Interpolate between the end points of the scan line as in
+    // LinearThreadedGenerateData() so both code paths map a given
+    // output pixel to the identical input position.
+    const double alpha = ( scanlineIndex - largestPossibleRegion.GetIndex(0) )
+                         / (double)( largestPossibleRegion.GetSize(0) );
+    inputIndex[scanAxis] = scanStartIndex[scanAxis]
+                           + alpha * ( scanEndIndex[scanAxis] - scanStartIndex[scanAxis] );
+
+    if ( m_Interpolator->IsInsideBuffer(inputIndex) )
+      {
+      const auto scanBase = Math::Floor< InputIndexValueType >( inputIndex[scanAxis] );
+      const double scanFraction = static_cast< double >( inputIndex[scanAxis] )
+                                  - static_cast< double >( scanBase );
+      const InputIndexValueType scanLower =
+        std::min( std::max( scanBase, scanFirst ), scanLast );
+      const InputIndexValueType scanUpper =
+        std::min( std::max( scanBase + 1, scanFirst ), scanLast );
+
+      InputIndexType index = cornerIndex[0];
+      index[scanAxis] = scanLower;
+      OutputType value = static_cast< OutputType >( inputPtr->GetPixel(index) )
+                         * ( cornerWeight[0] * ( 1.0 - scanFraction ) );
+      index[scanAxis] = scanUpper;
+      value += static_cast< OutputType >( inputPtr->GetPixel(index) )
+               * ( cornerWeight[0] * scanFraction );
+      for ( unsigned int corner = 1; corner < numberOfCorners; ++corner )
+        {
+        index = cornerIndex[corner];
+        index[scanAxis] = scanLower;
+        value += static_cast< OutputType >( inputPtr->GetPixel(index) )
+                 * ( cornerWeight[corner] * ( 1.0 - scanFraction ) );
+        index[scanAxis] = scanUpper;
+        value += static_cast< OutputType >( inputPtr->GetPixel(index) )
+                 * ( cornerWeight[corner] * scanFraction );
+        }
+      outIt.Set( Self::CastPixelWithBoundsChecking(value) );
+      }
+    else
+      {
+      if ( m_Extrapolator.IsNull() )
+        {
+        outIt.Set(defaultValue); // default background value
+        }
+      else
+        {
+        OutputType value = m_Extrapolator->EvaluateAtContinuousIndex( inputIndex );
+        outIt.Set( Self::CastPixelWithBoundsChecking(value) );
+        }
+      }
+
+    ++outIt;
+    ++scanlineIndex;
+    }
+}
+
 template< typename TInputImage,
           typename TOutputImage,
           typename TInterpolatorPrecisionType,
@@ -19,6 +19,7 @@
 // The header file to be tested:
 #include "itkResampleImageFilter.h"
 
+#include "itkAffineTransform.h"
 #include "itkImage.h"
 
 // Google Test header file:
@@ -32,6 +33,28 @@
 namespace
 {
 
+// An affine transform that hides its category, forcing the resample
+// filter onto its generic per-pixel code path. Used to check the
+// scanline fast path against the reference implementation.
+template <typename TCoordRep, unsigned int NDimensions>
+class CategoryHidingAffineTransform :
+  public itk::AffineTransform<TCoordRep, NDimensions>
+{
+public:
+  using Self = CategoryHidingAffineTransform;
+  using Superclass = itk::AffineTransform<TCoordRep, NDimensions>;
+  using Pointer = itk::SmartPointer<Self>;
+  using ConstPointer = itk::SmartPointer<const Self>;
+
+  itkSimpleNewMacro(Self);
+  itkTypeMacro(CategoryHidingAffineTransform, AffineTransform);
+
+  typename Superclass::TransformCategoryType GetTransformCategory() const override
+  {
+    return Superclass::UnknownTransformCategory;
+  }
+};
+
 // Returns the first pixel value from the output image of a ResampleImageFilter
 // whose input is a 1x1 image, having the specified input pixel value. The
 // filter uses a default interpolator and a default (identity) transform.
@@ -117,3 +140,74 @@ TEST(ResampleImageFilter, FilterPreservesMinAndMaxInt64PixelValuesByDefault)
   // Note: The following expectation would fail on ITK version <= 4.13.1:
   Expect_ResampleImageFilter_preserves_pixel_value(std::numeric_limits<std::int64_t>::max());
 }
+
+
+// Resamples under axis-aligned affine transforms, where the linear
+// code path caches the interpolation weights per scan line, and
+// compares the output with the generic per-pixel code path.
+TEST(ResampleImageFilter, LinearFastPathMatchesGenericPath)
+{
+  constexpr unsigned int Dimension = 2;
+  using ImageType = itk::Image<float, Dimension>;
+  using TransformType = itk::AffineTransform<double, Dimension>;
+  using HiddenTransformType = CategoryHidingAffineTransform<double, Dimension>;
+  using FilterType = itk::ResampleImageFilter<ImageType, ImageType>;
+
+  const auto image = ImageType::New();
+  const ImageType::SizeType imageSize = { { 16, 12 } };
+  image->SetRegions(imageSize);
+  image->Allocate();
+
+  std::default_random_engine randomEngine;
+  for (itk::ImageRegionIterator<ImageType>
+         it(image, image->GetLargestPossibleRegion());
+       !it.IsAtEnd(); ++it)
+  {
+    it.Set(static_cast<float>(
+      std::uniform_real_distribution<>{ 0.0, 100.0 }(randomEngine)));
+  }
+
+  // Axis-aligned scaling and translation, including an off-grid
+  // translation so every pixel needs true interpolation.
+  const auto transform = TransformType::New();
+  const auto hiddenTransform = HiddenTransformType::New();
+  TransformType::OutputVectorType scale;
+  scale[0] = 0.75;
+  scale[1] = 1.25;
+  TransformType::OutputVectorType translation;
+  translation[0] = 0.3;
+  translation[1] = -1.7;
+  for (TransformType * t :
+       { transform.GetPointer(),
+         static_cast<TransformType *>(hiddenTransform.GetPointer()) })
+  {
+    t->Scale(scale);
+    t->Translate(translation);
+  }
+
+  const auto fastFilter = FilterType::New();
+  fastFilter->SetInput(image);
+  fastFilter->SetSize(imageSize);
+  fastFilter->SetTransform(transform);
+  fastFilter->SetDefaultPixelValue(-1.0f);
+  fastFilter->Update();
+
+  const auto genericFilter = FilterType::New();
+  genericFilter->SetInput(image);
+  genericFilter->SetSize(imageSize);
+  genericFilter->SetTransform(hiddenTransform);
+  genericFilter->SetDefaultPixelValue(-1.0f);
+  genericFilter->Update();
+
+  const itk::ImageRegionConstIterator<ImageType>
+    fastIt(fastFilter->GetOutput(),
+           fastFilter->GetOutput()->GetLargestPossibleRegion());
+  const itk::ImageRegionConstIterator<ImageType>
+    genericIt(genericFilter->GetOutput(),
+              genericFilter->GetOutput()->GetLargestPossibleRegion());
+  for (auto it1 = fastIt, it2 = genericIt; !it1.IsAtEnd(); ++it1, ++it2)
+  {
+    EXPECT_NEAR(it1.Get(), it2.Get(), 1e-4)
+      << " at index " << it1.GetIndex();
+  }
+}
@@ -21,6 +21,8 @@
 #include "itkUnaryGeneratorImageFilter.h"
 #include "itkMath.h"
 
+#include <type_traits>
+
 namespace itk
 {
 namespace Functor
@@ -48,7 +50,14 @@ public:
 
   inline TOutput operator()(const TInput & A) const
   {
-    return static_cast<TOutput>( std::exp( static_cast<double>( A ) ) );
+    // The approximation is exact at the precision of any output type
+    // narrower than double and keeps the pixel loop vectorizable.
+    if ( std::is_same< TOutput, double >::value
+         || std::is_same< TOutput, long double >::value )
+      {
+      return static_cast<TOutput>( std::exp( static_cast<double>( A ) ) );
+      }
+    return static_cast<TOutput>( Math::FastApproximateExp( static_cast<double>( A ) ) );
   }
 };
 }
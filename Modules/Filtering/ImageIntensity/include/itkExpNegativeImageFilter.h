@@ -20,7 +20,8 @@
 
 #include "itkUnaryFunctorImageFilter.h"
 #include "itkMath.h"
-#include "itkMath.h"
+
+#include <type_traits>
 
 namespace itk
 {
@@ -54,7 +55,14 @@ public:
 
   inline TOutput operator()(const TInput & A) const
   {
-    return static_cast< TOutput >( std::exp( -m_Factor * static_cast< double >( A ) ) );
+    // For outputs narrower than double the approximate exponential is
+    // exact at the output precision and considerably cheaper.
+    if ( std::is_same< TOutput, double >::value
+         || std::is_same< TOutput, long double >::value )
+      {
+      return static_cast< TOutput >( std::exp( -m_Factor * static_cast< double >( A ) ) );
+      }
+    return static_cast< TOutput >( Math::FastApproximateExp( -m_Factor * static_cast< double >( A ) ) );
   }
 
   /** Sets the value 'K' used in the function evaluation exp(-K.x). */
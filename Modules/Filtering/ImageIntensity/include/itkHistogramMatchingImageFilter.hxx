@@ -20,8 +20,10 @@
 
 #include "itkHistogramMatchingImageFilter.h"
 #include "itkImageRegionIterator.h"
+#include "itkMultiThreaderBase.h"
 #include "itkNumericTraits.h"
 #include "itkMath.h"
+#include <mutex>
 #include <vector>
 
 namespace itk
@@ -337,26 +339,44 @@ HistogramMatchingImageFilter< TInputImage, TOutputImage, THistogramMeasurement >
   THistogramMeasurement & maxValue,
   THistogramMeasurement & meanValue)
 {
-  using ConstIterator = ImageRegionConstIterator< InputImageType >;
-  ConstIterator iter( image, image->GetBufferedRegion() );
-
+  std::mutex mutex;
   double        sum = 0.0;
   SizeValueType count = 0;
 
-  minValue = static_cast< THistogramMeasurement >( iter.Get() );
-  maxValue = minValue;
+  minValue = NumericTraits< THistogramMeasurement >::max();
+  maxValue = NumericTraits< THistogramMeasurement >::NonpositiveMin();
 
-  while ( !iter.IsAtEnd() )
+  // accumulate per-thread partial results and merge them under the lock
+  this->GetMultiThreader()->template ParallelizeImageRegion< ImageDimension >(
+    image->GetBufferedRegion(),
+    [image, &mutex, &sum, &count, &minValue, &maxValue](const typename InputImageType::RegionType & regionForThread)
     {
-    const auto value = static_cast< THistogramMeasurement >( iter.Get() );
-    sum += static_cast< double >( value );
+      double        localSum = 0.0;
+      SizeValueType localCount = 0;
+      auto localMin = NumericTraits< THistogramMeasurement >::max();
+      auto localMax = NumericTraits< THistogramMeasurement >::NonpositiveMin();
+
+      using ConstIterator = ImageRegionConstIterator< InputImageType >;
+      ConstIterator iter( image, regionForThread );
+      while ( !iter.IsAtEnd() )
+        {
+        const auto value = static_cast< THistogramMeasurement >( iter.Get() );
+        localSum += static_cast< double >( value );
 
-    if ( value < minValue ) { minValue = value; }
-    if ( value > maxValue ) { maxValue = value; }
+        if ( value < localMin ) { localMin = value; }
+        if ( value > localMax ) { localMax = value; }
 
-    ++iter;
-    ++count;
-    }
+        ++iter;
+        ++localCount;
+        }
+
+      std::lock_guard< std::mutex > mutexHolder( mutex );
+      sum += localSum;
+      count += localCount;
+      if ( localMin < minValue ) { minValue = localMin; }
+      if ( localMax > maxValue ) { maxValue = localMax; }
+    },
+    nullptr);
 
   meanValue = static_cast< THistogramMeasurement >( sum / static_cast< double >( count ) );
 }
@@ -393,31 +413,56 @@ HistogramMatchingImageFilter< TInputImage, TOutputImage, THistogramMeasurement >
     histogram->SetToZero();
   }
 
-  typename HistogramType::IndexType index(1);
-  typename HistogramType::MeasurementVectorType measurement(1);
-  using MeasurementType = typename HistogramType::MeasurementType;
-  measurement[0] = NumericTraits< MeasurementType >::ZeroValue();
-
     {
-
-    // put each image pixel into the histogram
-    using ConstIterator = ImageRegionConstIterator< InputImageType >;
-    ConstIterator iter( image, image->GetBufferedRegion() );
-
-    iter.GoToBegin();
-    while ( !iter.IsAtEnd() )
+    // put each image pixel into the histogram. Each thread counts into
+    // a flat partial over the bin range and the partials are merged
+    // under the lock; the initialized histogram itself is only read
+    // concurrently, through its const GetIndex().
+    std::mutex mutex;
+    std::vector< SizeValueType > frequency(m_NumberOfHistogramLevels, 0);
+
+    this->GetMultiThreader()->template ParallelizeImageRegion< ImageDimension >(
+      image->GetBufferedRegion(),
+      [this, image, histogram, minValue, maxValue, &mutex, &frequency](const typename InputImageType::RegionType & regionForThread)
       {
-      InputPixelType value = iter.Get();
-
-      if ( static_cast< double >( value ) >= minValue
-           && static_cast< double >( value ) <= maxValue )
-        {
-        // add sample to histogram
-        measurement[0] = value;
-        histogram->GetIndex( measurement, index );
-        histogram->IncreaseFrequencyOfIndex( index, 1 );
-        }
-      ++iter;
+        std::vector< SizeValueType > localFrequency(this->m_NumberOfHistogramLevels, 0);
+        typename HistogramType::IndexType index(1);
+        typename HistogramType::MeasurementVectorType measurement(1);
+
+        using ConstIterator = ImageRegionConstIterator< InputImageType >;
+        ConstIterator iter( image, regionForThread );
+
+        iter.GoToBegin();
+        while ( !iter.IsAtEnd() )
+          {
+          InputPixelType value = iter.Get();
+
+          if ( static_cast< double >( value ) >= minValue
+               && static_cast< double >( value ) <= maxValue )
+            {
+            // add sample to histogram
+            measurement[0] = value;
+            histogram->GetIndex( measurement, index );
+            if ( static_cast< SizeValueType >( index[0] ) < localFrequency.size() )
+              {
+              localFrequency[index[0]]++;
+              }
+            }
+          ++iter;
+          }
+
+        std::lock_guard< std::mutex > mutexHolder( mutex );
+        for ( SizeValueType bin = 0; bin < frequency.size(); bin++ )
+          {
+          frequency[bin] += localFrequency[bin];
+          }
+      },
+      nullptr);
+
+    using AbsoluteFrequencyType = typename HistogramType::AbsoluteFrequencyType;
+    for ( SizeValueType bin = 0; bin < m_NumberOfHistogramLevels; bin++ )
+      {
+      histogram->SetFrequency( bin, static_cast< AbsoluteFrequencyType >( frequency[bin] ) );
       }
     }
 }
@@ -21,6 +21,8 @@
 #include "itkUnaryGeneratorImageFilter.h"
 #include "itkMath.h"
 
+#include <type_traits>
+
 namespace itk
 {
 namespace Functor
@@ -48,7 +50,14 @@ public:
 
   inline TOutput operator()(const TInput & A) const
   {
-    return static_cast< TOutput >( std::log( static_cast< double >( A ) ) );
+    // Output types narrower than double cannot resolve the error of the
+    // approximation, which spares a math library call per pixel.
+    if ( std::is_same< TOutput, double >::value
+         || std::is_same< TOutput, long double >::value )
+      {
+      return static_cast< TOutput >( std::log( static_cast< double >( A ) ) );
+      }
+    return static_cast< TOutput >( Math::FastApproximateLog( static_cast< double >( A ) ) );
   }
 };
 }
@@ -21,6 +21,8 @@
 #include "itkUnaryFunctorImageFilter.h"
 #include "itkMath.h"
 
+#include <type_traits>
+
 namespace itk
 {
 /** \class SigmoidImageFilter
@@ -80,7 +82,13 @@ public:
   inline TOutput operator()(const TInput & A) const
   {
     const double x = ( static_cast< double >( A ) - m_Beta ) / m_Alpha;
-    const double e = 1.0 / ( 1.0 + std::exp(-x) );
+    // Output types with less precision than double cannot resolve the
+    // error of the approximate exponential, which avoids a math library
+    // call per pixel.
+    const double expx = ( std::is_same< TOutput, double >::value
+                          || std::is_same< TOutput, long double >::value ) ?
+      std::exp(-x) : Math::FastApproximateExp(-x);
+    const double e = 1.0 / ( 1.0 + expx );
     const double v =
       ( m_OutputMaximum - m_OutputMinimum ) * e + m_OutputMinimum;
 
@@ -20,10 +20,13 @@
 
 #include "itkImageToImageFilter.h"
 #include "itkConstShapedNeighborhoodIterator.h"
+#include "itkMultiThreaderBase.h"
+#include <algorithm>
 #include <atomic>
 #include <deque>
 #include <functional>
 #include <mutex>
+#include <utility>
 #include <vector>
 
 namespace itk
@@ -133,7 +136,9 @@ protected:
 
   using LineMapType = std::vector< LineEncodingType >;
 
-  using UnionFindType = std::vector< InternalLabelType >;
+  // The union-find entries are atomic so that the merge phase can link
+  // labels concurrently without serializing on a global lock.
+  using UnionFindType = std::vector< std::atomic< InternalLabelType > >;
   using ConsecutiveVectorType = std::vector< OutputPixelType >;
 
   SizeValueType IndexToLinearIndex( const IndexType& index ) const
@@ -155,74 +160,174 @@ protected:
   void InitUnion(InternalLabelType numberOfLabels)
   {
     m_UnionFind = UnionFindType( numberOfLabels + 1 );
-
-    typename LineMapType::iterator MapBegin, MapEnd, LineIt;
-    MapBegin = m_LineMap.begin();
-    MapEnd = m_LineMap.end();
-    LineIt = MapBegin;
+    m_UnionFind[0] = 0;
+
+    // Compute the first label of every line by an exclusive prefix sum
+    // of the per-line run counts, then number the runs of each line
+    // independently so that this pass scales with the merge phase that
+    // follows. The labels are identical to a serial raster-order scan.
+    const SizeValueType lineCount = m_LineMap.size();
+    std::vector< InternalLabelType > firstLabelOfLine( lineCount );
     InternalLabelType label = 1;
-    for ( LineIt = MapBegin; LineIt != MapEnd; ++LineIt )
+    for ( SizeValueType line = 0; line < lineCount; ++line )
       {
-      LineEncodingIterator cIt;
-      for ( cIt = LineIt->begin(); cIt != LineIt->end(); ++cIt )
-        {
-        cIt->label = label;
-        m_UnionFind[label] = label;
-        label++;
-        }
+      firstLabelOfLine[line] = label;
+      label += m_LineMap[line].size();
       }
+
+    MultiThreaderBase * multiThreader = m_EnclosingFilter->GetMultiThreader();
+    multiThreader->ParallelizeArray(
+      0,
+      lineCount,
+      [this, &firstLabelOfLine]( SizeValueType line )
+      {
+        InternalLabelType lineLabel = firstLabelOfLine[line];
+        for ( LineEncodingIterator cIt = m_LineMap[line].begin();
+              cIt != m_LineMap[line].end();
+              ++cIt, ++lineLabel )
+          {
+          cIt->label = lineLabel;
+          m_UnionFind[lineLabel] = lineLabel;
+          }
+      },
+      nullptr );
   }
 
   InternalLabelType LookupSet(const InternalLabelType label)
   {
+    // Lock-free find with path halving: whenever a grandparent is
+    // visible, re-point the current entry to it so that concurrent and
+    // subsequent lookups walk shorter chains. Losing a race to another
+    // thread only leaves a longer chain behind, never a wrong root.
     InternalLabelType l = label;
-    while (l != m_UnionFind[l])
+    InternalLabelType parent = m_UnionFind[l].load( std::memory_order_relaxed );
+    while ( l != parent )
       {
-      l = m_UnionFind[l]; //transitively sets equivalence
+      const InternalLabelType grandparent = m_UnionFind[parent].load( std::memory_order_relaxed );
+      if ( grandparent != parent )
+        {
+        m_UnionFind[l].compare_exchange_weak( parent, grandparent );
+        }
+      l = parent;
+      parent = grandparent;
       }
     return l;
   }
 
   void LinkLabels(const InternalLabelType label1, const InternalLabelType label2)
   {
-    std::lock_guard<std::mutex> mutexHolder(m_Mutex);
     InternalLabelType E1 = this->LookupSet(label1);
     InternalLabelType E2 = this->LookupSet(label2);
 
-    if ( E1 < E2 )
+    while ( E1 != E2 )
       {
-      m_UnionFind[E2] = E1;
-      }
-    else
-      {
-      m_UnionFind[E1] = E2;
+      if ( E2 < E1 )
+        {
+        std::swap( E1, E2 );
+        }
+      // Hang the larger root below the smaller one, so that the
+      // representative of a component stays the label reached first in
+      // raster order. The compare-exchange only succeeds while E2 is
+      // still its own parent, i.e. still a root; if another thread got
+      // there first, chase the new roots and retry.
+      InternalLabelType expected = E2;
+      if ( m_UnionFind[E2].compare_exchange_weak( expected, E1 ) )
+        {
+        return;
+        }
+      E1 = this->LookupSet(E1);
+      E2 = this->LookupSet(E2);
       }
   }
 
   SizeValueType CreateConsecutive(OutputPixelType backgroundValue)
   {
-    const size_t N = m_UnionFind.size();
+    const SizeValueType N = m_UnionFind.size();
 
     m_Consecutive = ConsecutiveVectorType( N );
     m_Consecutive[ 0 ] = backgroundValue;
 
-    OutputPixelType consecutiveLabel = 0;
-    SizeValueType count = 0;
+    if ( N <= 1 )
+      {
+      return 0;
+      }
 
-    for ( size_t i = 1; i < N; i++ )
+    // The consecutive labels enumerate the roots in increasing label
+    // order, skipping the background value once. Express the mapping in
+    // terms of the rank of each root so that it can be evaluated
+    // independently per chunk.
+    SizeValueType backgroundRank = NumericTraits< SizeValueType >::max();
+    if ( NumericTraits< OutputPixelType >::IsNonnegative( backgroundValue ) )
       {
-      const auto label = static_cast< size_t >( m_UnionFind[i] );
-      if ( label == i )
-        {
-        if ( consecutiveLabel == backgroundValue )
+      backgroundRank = static_cast< SizeValueType >( backgroundValue );
+      }
+
+    MultiThreaderBase * multiThreader = m_EnclosingFilter->GetMultiThreader();
+    SizeValueType numberOfChunks = multiThreader->GetNumberOfWorkUnits();
+    numberOfChunks = std::min( numberOfChunks, N - 1 );
+    numberOfChunks = std::max( numberOfChunks, static_cast< SizeValueType >( 1 ) );
+    const SizeValueType chunkSize = ( N - 1 + numberOfChunks - 1 ) / numberOfChunks;
+
+    // First parallel pass: flatten each entry onto its root, so the
+    // write phase resolves labels with a single lookup, and count the
+    // roots of each chunk.
+    std::vector< SizeValueType > rootsPerChunk( numberOfChunks, 0 );
+    multiThreader->ParallelizeArray(
+      0,
+      numberOfChunks,
+      [this, &rootsPerChunk, chunkSize, N]( SizeValueType chunk )
+      {
+        const SizeValueType begin = 1 + chunk * chunkSize;
+        const SizeValueType end = std::min( begin + chunkSize, N );
+        SizeValueType rootCount = 0;
+        for ( SizeValueType i = begin; i < end; ++i )
           {
-          ++consecutiveLabel;
+          const InternalLabelType root = this->LookupSet( i );
+          if ( root == i )
+            {
+            ++rootCount;
+            }
+          else
+            {
+            m_UnionFind[i] = root;
+            }
           }
-        m_Consecutive[label] = consecutiveLabel;
-        ++consecutiveLabel;
-        ++count;
-        }
+        rootsPerChunk[chunk] = rootCount;
+      },
+      nullptr );
+
+    // Serial exclusive prefix sum over the per-chunk root counts; only
+    // one term per chunk remains serial.
+    std::vector< SizeValueType > firstRankOfChunk( numberOfChunks );
+    SizeValueType count = 0;
+    for ( SizeValueType chunk = 0; chunk < numberOfChunks; ++chunk )
+      {
+      firstRankOfChunk[chunk] = count;
+      count += rootsPerChunk[chunk];
       }
+
+    // Second parallel pass: assign the consecutive labels, each chunk
+    // starting at the rank established by the prefix sum.
+    multiThreader->ParallelizeArray(
+      0,
+      numberOfChunks,
+      [this, &firstRankOfChunk, chunkSize, N, backgroundRank]( SizeValueType chunk )
+      {
+        const SizeValueType begin = 1 + chunk * chunkSize;
+        const SizeValueType end = std::min( begin + chunkSize, N );
+        SizeValueType rank = firstRankOfChunk[chunk];
+        for ( SizeValueType i = begin; i < end; ++i )
+          {
+          if ( m_UnionFind[i].load( std::memory_order_relaxed ) == i )
+            {
+            m_Consecutive[i] =
+              static_cast< OutputPixelType >( rank >= backgroundRank ? rank + 1 : rank );
+            ++rank;
+            }
+          }
+      },
+      nullptr );
+
     return count;
   }
 
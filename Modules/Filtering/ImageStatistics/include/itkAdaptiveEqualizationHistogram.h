@@ -20,8 +20,10 @@
 
 #include "itksys/hash_map.hxx"
 #include "itkStructHashFunction.h"
+#include "itkIntTypes.h"
 #include "itkMath.h"
 #include <cmath>
+#include <vector>
 namespace itk
 {
 namespace Function
@@ -132,6 +134,160 @@ private:
 
 };
 
+/* \class VectorAdaptiveEqualizationHistogram
+ *
+ * Flat histogram used for the small integer pixel types. The counters
+ * live in a plain vector indexed by gray level, so adding and removing
+ * a pixel while the window slides is a single array update, and the
+ * occupied range [m_CurrentMin, m_CurrentMax] keeps the per pixel
+ * evaluation of the cumulative function from scanning the empty part
+ * of a 16 bit range.
+ *
+ * \sa AdaptiveEqualizationHistogram
+ * \ingroup ITKImageStatistics
+ */
+template< class TInputPixel, class TOutputPixel >
+class VectorAdaptiveEqualizationHistogram
+{
+public:
+
+  using RealType = float;
+
+  VectorAdaptiveEqualizationHistogram()
+    {
+    m_Vector.resize(NumericTraits< TInputPixel >::max() - NumericTraits< TInputPixel >::NonpositiveMin() + 1, 0);
+    // empty sentinels: the first AddPixel() pulls both bounds onto the
+    // added bin
+    m_CurrentMin = static_cast< OffsetValueType >( m_Vector.size() );
+    m_CurrentMax = 0;
+    }
+
+  void AddPixel(const TInputPixel & p)
+  {
+    const OffsetValueType offset = p - NumericTraits < TInputPixel > ::NonpositiveMin();
+
+    m_Vector[offset]++;
+    if ( offset < m_CurrentMin )
+      {
+      m_CurrentMin = offset;
+      }
+    if ( offset > m_CurrentMax )
+      {
+      m_CurrentMax = offset;
+      }
+  }
+
+  void RemovePixel(const TInputPixel & p)
+  {
+    const OffsetValueType offset = p - NumericTraits < TInputPixel > ::NonpositiveMin();
+
+    itkAssertInDebugAndIgnoreInReleaseMacro( m_Vector[offset] > 0 );
+
+    m_Vector[offset]--;
+    // shrink the occupied range lazily; when the histogram empties the
+    // bounds cross and become the sentinels again
+    while ( m_CurrentMin <= m_CurrentMax && m_Vector[m_CurrentMin] == 0 )
+      {
+      m_CurrentMin++;
+      }
+    while ( m_CurrentMax >= m_CurrentMin && m_Vector[m_CurrentMax] == 0 )
+      {
+      m_CurrentMax--;
+      }
+  }
+
+  TOutputPixel GetValue(const TInputPixel &pixel)
+    {
+
+      // Normalize input pixels to [-0.5 0.5] gray level.
+      // AdaptiveHistogramEqualization compute kernel components with
+      // float, but use double for accumulate and temporaries.
+      const double iscale = (double)m_Maximum - m_Minimum;
+
+      double sum = 0.0;
+      const RealType u = ( (double)pixel - m_Minimum ) / iscale - 0.5;
+      for ( OffsetValueType offset = m_CurrentMin; offset <= m_CurrentMax; ++offset )
+        {
+        if ( m_Vector[offset] == 0 )
+          {
+          continue;
+          }
+        const auto level = static_cast< TInputPixel >( offset + NumericTraits < TInputPixel > ::NonpositiveMin() );
+        const RealType v =  ( (double)level - m_Minimum ) / iscale - 0.5;
+        const double ikernel =  m_KernelSize - m_BoundaryCount;
+        sum += m_Vector[offset] * CumulativeFunction(u,v) / ikernel;
+        }
+
+      return (TOutputPixel)( iscale * ( sum + 0.5 ) + m_Minimum );
+    }
+
+  void AddBoundary() {++m_BoundaryCount;}
+
+  void RemoveBoundary() {--m_BoundaryCount;}
+
+  void SetAlpha( RealType alpha ) {m_Alpha=alpha;}
+  void SetBeta( RealType beta ) {m_Beta=beta;}
+  void SetKernelSize( RealType kernelSize ) {m_KernelSize=kernelSize;}
+
+  void SetMinimum( TInputPixel minimum ) {m_Minimum=minimum;}
+  void SetMaximum( TInputPixel maximum ) {m_Maximum=maximum;}
+
+private:
+  RealType m_Alpha;
+  RealType m_Beta;
+  RealType m_KernelSize;
+
+  TInputPixel m_Minimum;
+  TInputPixel m_Maximum;
+
+  RealType CumulativeFunction(RealType u, RealType v)
+  {
+    // Calculate cumulative function
+    const RealType s = itk::Math::sgn(u - v);
+    const RealType ad = itk::Math::abs( 2.0 * ( u - v ) );
+
+    return 0.5 * s * std::pow(ad, m_Alpha) - m_Beta * 0.5 * s * ad + m_Beta * u;
+  }
+
+private:
+  std::vector< size_t > m_Vector;
+  OffsetValueType       m_CurrentMin;
+  OffsetValueType       m_CurrentMax;
+  size_t                m_BoundaryCount{0};
+
+};
+
+/// \cond HIDE_SPECIALIZATION_DOCUMENTATION
+
+// use the flat histogram for the 8 and 16 bit pixel types, as done for
+// the moving histogram of the mathematical morphology filters
+
+template< class TOutputPixel >
+class AdaptiveEqualizationHistogram<unsigned char, TOutputPixel>:
+  public VectorAdaptiveEqualizationHistogram<unsigned char, TOutputPixel>
+{
+};
+
+template< class TOutputPixel >
+class AdaptiveEqualizationHistogram<signed char, TOutputPixel>:
+  public VectorAdaptiveEqualizationHistogram<signed char, TOutputPixel>
+{
+};
+
+template< class TOutputPixel >
+class AdaptiveEqualizationHistogram<unsigned short, TOutputPixel>:
+  public VectorAdaptiveEqualizationHistogram<unsigned short, TOutputPixel>
+{
+};
+
+template< class TOutputPixel >
+class AdaptiveEqualizationHistogram<short, TOutputPixel>:
+  public VectorAdaptiveEqualizationHistogram<short, TOutputPixel>
+{
+};
+
+/// \endcond
+
 } // end namespace Function
 } // end namespace itk
 
@@ -23,6 +23,7 @@
 #include "itkSimpleDataObjectDecorator.h"
 #include "itkHistogram.h"
 #include <mutex>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
@@ -351,6 +352,36 @@ private:
 
   void MergeMap( MapType &, MapType &) const;
 
+  /** When the label pixel type is a small integer, each thread can
+   * index a dense table of pointers into its label map, so the
+   * statistics entry of a pixel is found without hashing. */
+  static constexpr bool UseDenseLabelTable =
+    std::is_integral< LabelPixelType >::value
+    && !std::is_same< LabelPixelType, bool >::value
+    && sizeof( LabelPixelType ) <= 2;
+
+  static size_t DenseLabelTableSize(std::true_type)
+  {
+    using UnsignedLabelType = typename std::make_unsigned< LabelPixelType >::type;
+    return static_cast< size_t >( std::numeric_limits< UnsignedLabelType >::max() ) + 1;
+  }
+
+  static size_t DenseLabelTableSize(std::false_type)
+  {
+    return 0;
+  }
+
+  static size_t DenseLabelIndex(LabelPixelType label, std::true_type)
+  {
+    using UnsignedLabelType = typename std::make_unsigned< LabelPixelType >::type;
+    return static_cast< size_t >( static_cast< UnsignedLabelType >( label ) );
+  }
+
+  static size_t DenseLabelIndex(LabelPixelType, std::false_type)
+  {
+    return 0;
+  }
+
   MapType                       m_LabelStatistics;
   ValidLabelValuesContainerType m_ValidLabelValues;
 
@@ -206,7 +206,49 @@ LabelStatisticsImageFilter< TInputImage, TLabelImage >
   ImageScanlineConstIterator< TLabelImage > labelIt (this->GetLabelInput(),
                                                      outputRegionForThread);
 
-  MapIterator mapIt = localStatistics.end();
+  // Finds the entry for a label, creating it - with or without a
+  // histogram - on the first visit.
+  auto findOrCreateLabel = [this, &localStatistics](const LabelPixelType & label)
+    -> typename MapType::mapped_type *
+    {
+    MapIterator mapIt = localStatistics.find(label);
+    if ( mapIt == localStatistics.end() )
+      {
+      // create a new statistics object
+      if ( m_UseHistograms )
+        {
+        mapIt = localStatistics.emplace( label,
+                                         LabelStatistics(m_NumBins[0],
+                                                         m_LowerBound,
+                                                         m_UpperBound) ).first;
+        }
+      else
+        {
+        mapIt = localStatistics.emplace( label, LabelStatistics() ).first;
+        }
+      }
+    return &mapIt->second;
+    };
+
+  // Label images are spatially coherent, so consecutive pixels
+  // usually carry the same label: remember the entry of the previous
+  // pixel and only look a label up when it changes. When a lookup is
+  // needed and the label type is a small integer, a dense table of
+  // pointers into the map replaces the hash probe. Pointers into an
+  // unordered_map stay valid across insertions, so both caches are
+  // safe while the map grows.
+  const std::integral_constant< bool, UseDenseLabelTable > denseTag{};
+  const size_t denseTableSize = DenseLabelTableSize(denseTag);
+  const bool useDenseTable = UseDenseLabelTable
+    && outputRegionForThread.GetNumberOfPixels() >= denseTableSize;
+  std::vector< typename MapType::mapped_type * > denseTable;
+  if ( useDenseTable )
+    {
+    denseTable.assign(denseTableSize, nullptr);
+    }
+
+  typename MapType::mapped_type *labelStatsPointer = nullptr;
+  LabelPixelType previousLabel = LabelPixelType();
 
   // do the work
   while ( !it.IsAtEnd() )
@@ -218,24 +260,26 @@ LabelStatisticsImageFilter< TInputImage, TLabelImage >
       const LabelPixelType & label = labelIt.Get();
 
       // is the label already in this thread?
-      mapIt = localStatistics.find(label);
-      if ( mapIt == localStatistics.end() )
+      if ( labelStatsPointer == nullptr || label != previousLabel )
         {
-        // create a new statistics object
-        if ( m_UseHistograms )
+        previousLabel = label;
+        if ( useDenseTable )
           {
-          mapIt = localStatistics.emplace( label,
-                                           LabelStatistics(m_NumBins[0],
-                                                           m_LowerBound,
-                                                           m_UpperBound) ).first;
+          typename MapType::mapped_type **tableEntry =
+            &denseTable[DenseLabelIndex(label, denseTag)];
+          if ( *tableEntry == nullptr )
+            {
+            *tableEntry = findOrCreateLabel(label);
+            }
+          labelStatsPointer = *tableEntry;
           }
         else
           {
-          mapIt = localStatistics.emplace( label, LabelStatistics() ).first;
+          labelStatsPointer = findOrCreateLabel(label);
           }
         }
 
-      typename MapType::mapped_type &labelStats = mapIt->second;
+      typename MapType::mapped_type &labelStats = *labelStatsPointer;
 
       // update the values for this label and this thread
       if ( value < labelStats.m_Minimum )
@@ -22,6 +22,7 @@
 #include "itkNumericTraits.h"
 #include "itkArray.h"
 #include "itkSimpleDataObjectDecorator.h"
+#include "itkRunLengthMask.h"
 #include <mutex>
 #include "itkCompensatedSummation.h"
 
@@ -139,6 +140,17 @@ public:
 
   const RealObjectType * GetSumOfSquaresOutput() const;
 
+  /** RunLengthMask type alias support */
+  using RunLengthMaskType = RunLengthMask< Self::ImageDimension >;
+
+  /** Set/Get an optional run-length mask. When set, the statistics
+   * are accumulated over the pixels inside the mask runs only; the
+   * pixels outside are neither read nor counted. The runs are indexed
+   * in the input image space.
+   * \sa RunLengthMask */
+  itkSetConstObjectMacro(RunLengthMask, RunLengthMaskType);
+  itkGetConstObjectMacro(RunLengthMask, RunLengthMaskType);
+
   /** Make a DataObject of the correct type to be used as the specified
    * output. */
   using DataObjectPointerArraySizeType = ProcessObject::DataObjectPointerArraySizeType;
@@ -178,6 +190,12 @@ protected:
   void EnlargeOutputRequestedRegion(DataObject *data) override;
 
 private:
+  /** Masked variant of DynamicThreadedGenerateData: accumulates over
+   * the mask runs intersecting the thread region only. */
+  void MaskedDynamicThreadedGenerateData(const RegionType & regionForThread);
+
+  typename RunLengthMaskType::ConstPointer m_RunLengthMask;
+
   CompensatedSummation<RealType> m_ThreadSum;
   CompensatedSummation<RealType> m_SumOfSquares;
 
@@ -0,0 +1,92 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkBinaryDilateLabelMapFilter_h
+#define itkBinaryDilateLabelMapFilter_h
+
+#include "itkBinaryMorphologyLabelMapFilter.h"
+
+namespace itk
+{
+/** \class BinaryDilateLabelMapFilter
+ * \brief Run-length binary dilation of the objects of a label map.
+ *
+ * Each label object is dilated with a flat box structuring element of the
+ * given radius, directly on its run-length representation: the runs of each
+ * line are first extended along the fastest moving axis, then the lines are
+ * propagated to their neighbor lines along the remaining axes and merged
+ * with interval arithmetic. The result is exactly the dilation computed by
+ * BinaryDilateImageFilter with a box kernel, restricted to the label map
+ * region, but only the runs are touched instead of every pixel in the
+ * structuring element neighborhood.
+ *
+ * The label objects are processed in parallel, one object at a time per
+ * thread. Objects dilated into contact keep their own label and may end up
+ * with overlapping lines; see BinaryMorphologyLabelMapFilter for how such
+ * overlaps are resolved.
+ *
+ * \sa BinaryErodeLabelMapFilter, BinaryDilateImageFilter
+ * \ingroup MathematicalMorphologyImageFilters
+ * \ingroup ITKLabelMap
+ */
+template< typename TImage >
+class ITK_TEMPLATE_EXPORT BinaryDilateLabelMapFilter:
+  public BinaryMorphologyLabelMapFilter< TImage >
+{
+public:
+  ITK_DISALLOW_COPY_AND_ASSIGN(BinaryDilateLabelMapFilter);
+
+  /** Standard class type aliases. */
+  using Self = BinaryDilateLabelMapFilter;
+  using Superclass = BinaryMorphologyLabelMapFilter< TImage >;
+  using Pointer = SmartPointer< Self >;
+  using ConstPointer = SmartPointer< const Self >;
+
+  /** Some convenient type alias. */
+  using ImageType = TImage;
+  using IndexType = typename Superclass::IndexType;
+  using RegionType = typename Superclass::RegionType;
+  using LabelObjectType = typename Superclass::LabelObjectType;
+  using RadiusType = typename Superclass::RadiusType;
+
+  /** ImageDimension constants */
+  static constexpr unsigned int ImageDimension = TImage::ImageDimension;
+
+  /** Standard New method. */
+  itkNewMacro(Self);
+
+  /** Runtime information support. */
+  itkTypeMacro(BinaryDilateLabelMapFilter, BinaryMorphologyLabelMapFilter);
+
+protected:
+  BinaryDilateLabelMapFilter() = default;
+  ~BinaryDilateLabelMapFilter() override = default;
+
+  void ThreadedProcessLabelObject(LabelObjectType *labelObject) override;
+
+private:
+  using IntervalListType = typename Superclass::IntervalListType;
+  using IntervalType = typename Superclass::IntervalType;
+  using LineMapType = typename Superclass::LineMapType;
+};                                        // end of class
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#include "itkBinaryDilateLabelMapFilter.hxx"
+#endif
+
+#endif
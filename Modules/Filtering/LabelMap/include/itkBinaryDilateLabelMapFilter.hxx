@@ -0,0 +1,93 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkBinaryDilateLabelMapFilter_hxx
+#define itkBinaryDilateLabelMapFilter_hxx
+
+#include "itkBinaryDilateLabelMapFilter.h"
+
+#include <algorithm>
+
+namespace itk
+{
+template< typename TImage >
+void
+BinaryDilateLabelMapFilter< TImage >
+::ThreadedProcessLabelObject(LabelObjectType *labelObject)
+{
+  const RegionType & region = this->GetOutput()->GetLargestPossibleRegion();
+  const RadiusType & radius = this->GetRadius();
+
+  LineMapType lines;
+  this->BuildLineMap(labelObject, lines);
+
+  // Dilate along the fastest moving axis: extend every run by the radius on
+  // both sides and merge the runs which have grown into each other.
+  const auto radius0 = static_cast< IndexValueType >( radius[0] );
+  const IndexValueType low0 = region.GetIndex(0);
+  const IndexValueType high0 = low0 + static_cast< IndexValueType >( region.GetSize(0) );
+  for ( auto & item : lines )
+    {
+    for ( auto & interval : item.second )
+      {
+      interval.first = std::max(interval.first - radius0, low0);
+      interval.second = std::min(interval.second + radius0, high0);
+      }
+    Self::MergeIntervalList(item.second);
+    }
+
+  // Dilate along each of the remaining axes: every line contributes its runs
+  // to the neighbor lines within the radius, and the contributions are
+  // merged per line.
+  for ( unsigned int d = 1; d < ImageDimension; d++ )
+    {
+    const auto radiusD = static_cast< IndexValueType >( radius[d] );
+    if ( radiusD == 0 )
+      {
+      continue;
+      }
+
+    const IndexValueType lowD = region.GetIndex(d);
+    const IndexValueType highD = lowD + static_cast< IndexValueType >( region.GetSize(d) ) - 1;
+
+    LineMapType dilated;
+    for ( const auto & item : lines )
+      {
+      for ( IndexValueType o = -radiusD; o <= radiusD; o++ )
+        {
+        IndexType line = item.first;
+        line[d] += o;
+        if ( line[d] < lowD || line[d] > highD )
+          {
+          continue;
+          }
+        IntervalListType & target = dilated[line];
+        target.insert( target.end(), item.second.begin(), item.second.end() );
+        }
+      }
+    for ( auto & item : dilated )
+      {
+      Self::MergeIntervalList(item.second);
+      }
+    lines.swap(dilated);
+    }
+
+  this->StoreLineMap(lines, labelObject);
+}
+} // end namespace itk
+
+#endif
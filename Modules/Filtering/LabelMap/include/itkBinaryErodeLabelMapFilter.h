@@ -0,0 +1,105 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkBinaryErodeLabelMapFilter_h
+#define itkBinaryErodeLabelMapFilter_h
+
+#include "itkBinaryMorphologyLabelMapFilter.h"
+
+namespace itk
+{
+/** \class BinaryErodeLabelMapFilter
+ * \brief Run-length binary erosion of the objects of a label map.
+ *
+ * Each label object is eroded with a flat box structuring element of the
+ * given radius, directly on its run-length representation: the runs of each
+ * line are first shrunk along the fastest moving axis, then each line is
+ * intersected with its neighbor lines along the remaining axes using
+ * interval arithmetic. The result is exactly the erosion computed by
+ * BinaryErodeImageFilter with a box kernel, but only the runs are touched
+ * instead of every pixel in the structuring element neighborhood.
+ *
+ * As in BinaryErodeImageFilter, the pixels outside the label map region are
+ * considered to be foreground by default, so objects touching the region
+ * border are not eroded from that side. Set BoundaryToForeground to false
+ * to treat the outside as background instead.
+ *
+ * The label objects are processed in parallel, one object at a time per
+ * thread. An object eroded to nothing is left in the label map as an empty
+ * object.
+ *
+ * \sa BinaryDilateLabelMapFilter, BinaryErodeImageFilter
+ * \ingroup MathematicalMorphologyImageFilters
+ * \ingroup ITKLabelMap
+ */
+template< typename TImage >
+class ITK_TEMPLATE_EXPORT BinaryErodeLabelMapFilter:
+  public BinaryMorphologyLabelMapFilter< TImage >
+{
+public:
+  ITK_DISALLOW_COPY_AND_ASSIGN(BinaryErodeLabelMapFilter);
+
+  /** Standard class type aliases. */
+  using Self = BinaryErodeLabelMapFilter;
+  using Superclass = BinaryMorphologyLabelMapFilter< TImage >;
+  using Pointer = SmartPointer< Self >;
+  using ConstPointer = SmartPointer< const Self >;
+
+  /** Some convenient type alias. */
+  using ImageType = TImage;
+  using IndexType = typename Superclass::IndexType;
+  using RegionType = typename Superclass::RegionType;
+  using LabelObjectType = typename Superclass::LabelObjectType;
+  using RadiusType = typename Superclass::RadiusType;
+
+  /** ImageDimension constants */
+  static constexpr unsigned int ImageDimension = TImage::ImageDimension;
+
+  /** Standard New method. */
+  itkNewMacro(Self);
+
+  /** Runtime information support. */
+  itkTypeMacro(BinaryErodeLabelMapFilter, BinaryMorphologyLabelMapFilter);
+
+  /** Set/Get whether the pixels outside the label map region are considered
+   * to be foreground. Defaults to true, like in BinaryErodeImageFilter. */
+  itkSetMacro(BoundaryToForeground, bool);
+  itkGetConstMacro(BoundaryToForeground, bool);
+  itkBooleanMacro(BoundaryToForeground);
+
+protected:
+  BinaryErodeLabelMapFilter();
+  ~BinaryErodeLabelMapFilter() override = default;
+
+  void ThreadedProcessLabelObject(LabelObjectType *labelObject) override;
+
+  void PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  using IntervalListType = typename Superclass::IntervalListType;
+  using IntervalType = typename Superclass::IntervalType;
+  using LineMapType = typename Superclass::LineMapType;
+
+  bool m_BoundaryToForeground;
+};                                        // end of class
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#include "itkBinaryErodeLabelMapFilter.hxx"
+#endif
+
+#endif
@@ -0,0 +1,147 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkBinaryErodeLabelMapFilter_hxx
+#define itkBinaryErodeLabelMapFilter_hxx
+
+#include "itkBinaryErodeLabelMapFilter.h"
+
+namespace itk
+{
+template< typename TImage >
+BinaryErodeLabelMapFilter< TImage >
+::BinaryErodeLabelMapFilter()
+{
+  m_BoundaryToForeground = true;
+}
+
+template< typename TImage >
+void
+BinaryErodeLabelMapFilter< TImage >
+::ThreadedProcessLabelObject(LabelObjectType *labelObject)
+{
+  const RegionType & region = this->GetOutput()->GetLargestPossibleRegion();
+  const RadiusType & radius = this->GetRadius();
+
+  LineMapType lines;
+  this->BuildLineMap(labelObject, lines);
+
+  // Erode along the fastest moving axis: shrink every run by the radius on
+  // both sides, except at the region border when the outside counts as
+  // foreground, and drop the runs which vanish.
+  const auto radius0 = static_cast< IndexValueType >( radius[0] );
+  const IndexValueType low0 = region.GetIndex(0);
+  const IndexValueType high0 = low0 + static_cast< IndexValueType >( region.GetSize(0) );
+  auto lineIt = lines.begin();
+  while ( lineIt != lines.end() )
+    {
+    IntervalListType eroded;
+    for ( const auto & interval : lineIt->second )
+      {
+      IntervalType shrunk = interval;
+      if ( !m_BoundaryToForeground || shrunk.first != low0 )
+        {
+        shrunk.first += radius0;
+        }
+      if ( !m_BoundaryToForeground || shrunk.second != high0 )
+        {
+        shrunk.second -= radius0;
+        }
+      if ( shrunk.first < shrunk.second )
+        {
+        eroded.push_back(shrunk);
+        }
+      }
+    if ( eroded.empty() )
+      {
+      lineIt = lines.erase(lineIt);
+      }
+    else
+      {
+      lineIt->second.swap(eroded);
+      ++lineIt;
+      }
+    }
+
+  // Erode along each of the remaining axes: a line survives where all of its
+  // neighbor lines within the radius are foreground too, so each line is
+  // intersected with its neighbors. Neighbor lines outside the region count
+  // as full lines when the outside is foreground.
+  for ( unsigned int d = 1; d < ImageDimension; d++ )
+    {
+    const auto radiusD = static_cast< IndexValueType >( radius[d] );
+    if ( radiusD == 0 )
+      {
+      continue;
+      }
+
+    const IndexValueType lowD = region.GetIndex(d);
+    const IndexValueType highD = lowD + static_cast< IndexValueType >( region.GetSize(d) ) - 1;
+
+    LineMapType eroded;
+    for ( const auto & item : lines )
+      {
+      IntervalListType result = item.second;
+      IntervalListType intersection;
+      for ( IndexValueType o = -radiusD; o <= radiusD && !result.empty(); o++ )
+        {
+        if ( o == 0 )
+          {
+          continue;
+          }
+        IndexType line = item.first;
+        line[d] += o;
+        if ( line[d] < lowD || line[d] > highD )
+          {
+          if ( m_BoundaryToForeground )
+            {
+            continue; // a full neighbor line leaves the intersection unchanged
+            }
+          result.clear();
+          break;
+          }
+        const auto neighbor = lines.find(line);
+        if ( neighbor == lines.end() )
+          {
+          result.clear();
+          break;
+          }
+        Self::IntersectIntervalLists(result, neighbor->second, intersection);
+        result.swap(intersection);
+        }
+      if ( !result.empty() )
+        {
+        eroded[item.first] = result;
+        }
+      }
+    lines.swap(eroded);
+    }
+
+  this->StoreLineMap(lines, labelObject);
+}
+
+template< typename TImage >
+void
+BinaryErodeLabelMapFilter< TImage >
+::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+  os << indent << "BoundaryToForeground: " << m_BoundaryToForeground << std::endl;
+}
+} // end namespace itk
+
+#endif
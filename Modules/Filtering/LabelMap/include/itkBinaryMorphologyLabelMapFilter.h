@@ -0,0 +1,141 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkBinaryMorphologyLabelMapFilter_h
+#define itkBinaryMorphologyLabelMapFilter_h
+
+#include "itkInPlaceLabelMapFilter.h"
+#include "itkLexicographicCompare.h"
+
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace itk
+{
+/** \class BinaryMorphologyLabelMapFilter
+ * \brief Base class for run-length binary erosion and dilation on label maps.
+ *
+ * Binary morphology with a flat rectangular (box) structuring element can be
+ * computed directly on the run-length representation stored in a LabelMap:
+ * the box decomposes into one line segment per image axis, and each of those
+ * 1-D erosions or dilations is interval arithmetic on the sorted runs of a
+ * line. For the mostly uniform masks LabelMap is designed for, this touches
+ * a few intervals per line instead of every pixel in the structuring element
+ * neighborhood, while producing exactly the same result as the voxel-wise
+ * filters with a box kernel.
+ *
+ * Each label object is processed independently, as the binary mask of that
+ * object. After a dilation, objects which have grown into contact keep their
+ * own label; where the lines of several objects overlap, the usual LabelMap
+ * convention applies and the object visited last when the map is converted
+ * to an image wins.
+ *
+ * This class provides the radius and the interval machinery shared by
+ * BinaryDilateLabelMapFilter and BinaryErodeLabelMapFilter, which implement
+ * the per-object processing.
+ *
+ * \sa BinaryDilateLabelMapFilter, BinaryErodeLabelMapFilter, BinaryDilateImageFilter
+ * \ingroup MathematicalMorphologyImageFilters
+ * \ingroup ITKLabelMap
+ */
+template< typename TImage >
+class ITK_TEMPLATE_EXPORT BinaryMorphologyLabelMapFilter:
+  public InPlaceLabelMapFilter< TImage >
+{
+public:
+  ITK_DISALLOW_COPY_AND_ASSIGN(BinaryMorphologyLabelMapFilter);
+
+  /** Standard class type aliases. */
+  using Self = BinaryMorphologyLabelMapFilter;
+  using Superclass = InPlaceLabelMapFilter< TImage >;
+  using Pointer = SmartPointer< Self >;
+  using ConstPointer = SmartPointer< const Self >;
+
+  /** Some convenient type alias. */
+  using ImageType = TImage;
+  using ImagePointer = typename ImageType::Pointer;
+  using ImageConstPointer = typename ImageType::ConstPointer;
+  using PixelType = typename ImageType::PixelType;
+  using IndexType = typename ImageType::IndexType;
+  using RegionType = typename ImageType::RegionType;
+  using SizeType = typename ImageType::SizeType;
+  using LabelObjectType = typename ImageType::LabelObjectType;
+  using LengthType = typename LabelObjectType::LengthType;
+
+  using RadiusType = SizeType;
+
+  /** ImageDimension constants */
+  static constexpr unsigned int ImageDimension = TImage::ImageDimension;
+
+  /** Runtime information support. */
+  itkTypeMacro(BinaryMorphologyLabelMapFilter, InPlaceLabelMapFilter);
+
+  /** Set/Get the radius of the box structuring element. */
+  itkSetMacro(Radius, RadiusType);
+  itkGetConstReferenceMacro(Radius, RadiusType);
+
+  /** Set the radius to the same value along every axis. */
+  void SetRadius(SizeValueType radius)
+  {
+    RadiusType r;
+
+    r.Fill(radius);
+    this->SetRadius(r);
+  }
+
+protected:
+  BinaryMorphologyLabelMapFilter();
+  ~BinaryMorphologyLabelMapFilter() override = default;
+
+  void PrintSelf(std::ostream & os, Indent indent) const override;
+
+  /** A run along the fastest moving axis, as the half open interval
+   * [first, second). */
+  using IntervalType = std::pair< IndexValueType, IndexValueType >;
+  using IntervalListType = std::vector< IntervalType >;
+
+  /** The runs of a label object, grouped by line. The key is the line index
+   * with its first component zeroed out. */
+  using LineMapType = std::map< IndexType, IntervalListType, Functor::CoLexicographicCompare >;
+
+  /** Collect the lines of a label object into a line map with sorted,
+   * non-overlapping intervals per line. */
+  void BuildLineMap(const LabelObjectType *labelObject, LineMapType & lineMap) const;
+
+  /** Replace the lines of a label object with the content of a line map. */
+  void StoreLineMap(const LineMapType & lineMap, LabelObjectType *labelObject) const;
+
+  /** Sort an interval list and merge the overlapping and touching
+   * intervals. */
+  static void MergeIntervalList(IntervalListType & intervals);
+
+  /** Intersect two sorted, non-overlapping interval lists. */
+  static void IntersectIntervalLists(const IntervalListType & first,
+                                     const IntervalListType & second,
+                                     IntervalListType & result);
+
+private:
+  RadiusType m_Radius;
+};                                        // end of class
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#include "itkBinaryMorphologyLabelMapFilter.hxx"
+#endif
+
+#endif
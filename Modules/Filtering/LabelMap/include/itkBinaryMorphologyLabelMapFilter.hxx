@@ -0,0 +1,148 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkBinaryMorphologyLabelMapFilter_hxx
+#define itkBinaryMorphologyLabelMapFilter_hxx
+
+#include "itkBinaryMorphologyLabelMapFilter.h"
+
+#include <algorithm>
+
+namespace itk
+{
+template< typename TImage >
+BinaryMorphologyLabelMapFilter< TImage >
+::BinaryMorphologyLabelMapFilter()
+{
+  m_Radius.Fill(1);
+}
+
+template< typename TImage >
+void
+BinaryMorphologyLabelMapFilter< TImage >
+::BuildLineMap(const LabelObjectType *labelObject, LineMapType & lineMap) const
+{
+  lineMap.clear();
+
+  typename LabelObjectType::ConstLineIterator lit(labelObject);
+  while ( !lit.IsAtEnd() )
+    {
+    const IndexType & idx = lit.GetLine().GetIndex();
+    const auto length = static_cast< IndexValueType >( lit.GetLine().GetLength() );
+
+    IndexType line = idx;
+    line[0] = 0;
+    lineMap[line].push_back( IntervalType( idx[0], idx[0] + length ) );
+    ++lit;
+    }
+
+  // the lines of a label object may be unsorted and may overlap
+  for ( auto & item : lineMap )
+    {
+    Self::MergeIntervalList(item.second);
+    }
+}
+
+template< typename TImage >
+void
+BinaryMorphologyLabelMapFilter< TImage >
+::StoreLineMap(const LineMapType & lineMap, LabelObjectType *labelObject) const
+{
+  labelObject->Clear();
+
+  for ( const auto & item : lineMap )
+    {
+    IndexType idx = item.first;
+    for ( const auto & interval : item.second )
+      {
+      idx[0] = interval.first;
+      labelObject->AddLine( idx, static_cast< LengthType >( interval.second - interval.first ) );
+      }
+    }
+  labelObject->Optimize();
+}
+
+template< typename TImage >
+void
+BinaryMorphologyLabelMapFilter< TImage >
+::MergeIntervalList(IntervalListType & intervals)
+{
+  if ( intervals.empty() )
+    {
+    return;
+    }
+
+  std::sort( intervals.begin(), intervals.end() );
+
+  IntervalListType merged;
+  merged.push_back( intervals[0] );
+  for ( size_t i = 1; i < intervals.size(); i++ )
+    {
+    if ( intervals[i].first <= merged.back().second )
+      {
+      merged.back().second = std::max(merged.back().second, intervals[i].second);
+      }
+    else
+      {
+      merged.push_back( intervals[i] );
+      }
+    }
+  intervals.swap(merged);
+}
+
+template< typename TImage >
+void
+BinaryMorphologyLabelMapFilter< TImage >
+::IntersectIntervalLists(const IntervalListType & first,
+                         const IntervalListType & second,
+                         IntervalListType & result)
+{
+  result.clear();
+
+  size_t i = 0;
+  size_t j = 0;
+  while ( i < first.size() && j < second.size() )
+    {
+    const IndexValueType low = std::max(first[i].first, second[j].first);
+    const IndexValueType high = std::min(first[i].second, second[j].second);
+    if ( low < high )
+      {
+      result.push_back( IntervalType(low, high) );
+      }
+    // drop the interval which ends first
+    if ( first[i].second < second[j].second )
+      {
+      i++;
+      }
+    else
+      {
+      j++;
+      }
+    }
+}
+
+template< typename TImage >
+void
+BinaryMorphologyLabelMapFilter< TImage >
+::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+  os << indent << "Radius: " << m_Radius << std::endl;
+}
+} // end namespace itk
+
+#endif
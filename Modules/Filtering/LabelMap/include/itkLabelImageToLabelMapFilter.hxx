@@ -22,6 +22,10 @@
 #include "itkNumericTraits.h"
 #include "itkProgressReporter.h"
 #include "itkImageLinearConstIteratorWithIndex.h"
+#include "itkMultiThreaderBase.h"
+
+#include <map>
+#include <vector>
 
 namespace itk
 {
@@ -134,8 +138,16 @@ LabelImageToLabelMapFilter< TInputImage, TOutputImage >
 {
   OutputImageType *output = this->GetOutput();
 
-  // merge the lines from the temporary images in the output image
-  // don't use the first image - that's the output image
+  // Merge the objects from the temporary images in the output image -
+  // don't use the first image, that's the output image. Objects whose
+  // label appears in only one temporary image are moved as is; for the
+  // others only the cheap bookkeeping is done here, and the line
+  // merging itself - the expensive part with many objects - is run in
+  // parallel below, one object per work unit.
+  using MergeTaskType = std::pair< LabelObjectType *, std::vector< LabelObjectType * > >;
+  std::vector< MergeTaskType >                       mergeTasks;
+  std::map< OutputImagePixelType, SizeValueType >    taskForLabel;
+
   for ( ThreadIdType i = 1; i < this->GetNumberOfWorkUnits(); i++ )
     {
     for ( typename OutputImageType::Iterator it( m_TemporaryImages[i] );
@@ -145,13 +157,17 @@ LabelImageToLabelMapFilter< TInputImage, TOutputImage >
       LabelObjectType *labelObject = it.GetLabelObject();
       if ( output->HasLabel( labelObject->GetLabel() ) )
         {
-        // merge the lines in the output's object
+        // register the lines of this object for the parallel merge
         LabelObjectType * lo = output->GetLabelObject( labelObject->GetLabel() );
-        typename LabelObjectType::ConstLineIterator lit( labelObject );
-        while( ! lit.IsAtEnd() )
+        auto taskIt = taskForLabel.find( labelObject->GetLabel() );
+        if ( taskIt == taskForLabel.end() )
           {
-          lo->AddLine( lit.GetLine() );
-          ++lit;
+          taskForLabel[labelObject->GetLabel()] = mergeTasks.size();
+          mergeTasks.push_back( MergeTaskType( lo, { labelObject } ) );
+          }
+        else
+          {
+          mergeTasks[taskIt->second].second.push_back( labelObject );
           }
         }
       else
@@ -162,6 +178,28 @@ LabelImageToLabelMapFilter< TInputImage, TOutputImage >
       }
     }
 
+  if ( !mergeTasks.empty() )
+    {
+    // each object is only touched by one work unit, so no locking is
+    // needed
+    MultiThreaderBase::Pointer threader = MultiThreaderBase::New();
+    threader->ParallelizeArray( 0, static_cast< SizeValueType >( mergeTasks.size() ),
+      [&mergeTasks](SizeValueType task)
+        {
+        LabelObjectType * lo = mergeTasks[task].first;
+        for ( LabelObjectType * labelObject : mergeTasks[task].second )
+          {
+          typename LabelObjectType::ConstLineIterator lit( labelObject );
+          while( ! lit.IsAtEnd() )
+            {
+            lo->AddLine( lit.GetLine() );
+            ++lit;
+            }
+          }
+        },
+      nullptr );
+    }
+
   // release the data in the temp images
   m_TemporaryImages.clear();
 }
@@ -18,7 +18,7 @@
 #ifndef itkLabelObject_h
 #define itkLabelObject_h
 
-#include <deque>
+#include <vector>
 #include "itkLightObject.h"
 #include "itkLabelObjectLine.h"
 #include "itkWeakPointer.h"
@@ -105,7 +105,9 @@ public:
 
   /**
    * Return true if the object contain the given index and false otherwise.
-   * Worst case complexity is O(L) where L is the number of lines in the object.
+   * After Optimize() has been called the sorted lines are searched by
+   * bisection in O(log L); otherwise the worst case complexity is O(L),
+   * where L is the number of lines in the object.
    */
   bool HasIndex(const IndexType & idx) const;
 
@@ -252,7 +254,7 @@ public:
     }
 
   private:
-    using LineContainerType = typename std::deque< LineType >;
+    using LineContainerType = typename std::vector< LineType >;
     using InternalIteratorType = typename LineContainerType::const_iterator;
     InternalIteratorType m_Iterator;
     InternalIteratorType m_Begin;
@@ -347,7 +349,7 @@ public:
 
   private:
 
-    using LineContainerType = typename std::deque< LineType >;
+    using LineContainerType = typename std::vector< LineType >;
     using InternalIteratorType = typename LineContainerType::const_iterator;
     void NextValidLine()
     {
@@ -373,10 +375,17 @@ protected:
   void PrintSelf(std::ostream & os, Indent indent) const override;
 
 private:
-  using LineContainerType = typename std::deque< LineType >;
+  // the runs are kept in one contiguous block; a deque would pay one
+  // allocation per block and scatter the lines across the heap
+  using LineContainerType = typename std::vector< LineType >;
 
   LineContainerType m_LineContainer;
   LabelType         m_Label;
+
+  /** True while the lines are known to be sorted and disjoint, i.e.
+   * since the last Optimize() no line has been added out of order.
+   * Sorted lines can be searched by bisection. */
+  bool m_LinesAreSorted;
 };
 } // end namespace itk
 
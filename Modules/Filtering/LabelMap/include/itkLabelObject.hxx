@@ -30,6 +30,7 @@ LabelObject< TLabel, VImageDimension >::LabelObject()
 {
   m_Label = NumericTraits< LabelType >::ZeroValue();
   m_LineContainer.clear();
+  m_LinesAreSorted = true;
 }
 
 template< typename TLabel, unsigned int VImageDimension >
@@ -79,13 +80,32 @@ LabelObject< TLabel, VImageDimension >::SetLabel(const LabelType & label)
 
 /**
  * Return true if the object contain the given index and false otherwise.
- * Worst case complexity is O(L) where L is the number of lines in the object.
+ * After Optimize() the sorted lines are searched by bisection; the worst
+ * case complexity otherwise is O(L) where L is the number of lines in
+ * the object.
  */
 template< typename TLabel, unsigned int VImageDimension >
 bool
 LabelObject< TLabel, VImageDimension >
 ::HasIndex(const IndexType & idx) const
 {
+  if ( m_LinesAreSorted && !m_LineContainer.empty() )
+    {
+    // The lines are sorted and disjoint: the only line which can
+    // contain the index is the last one not beyond it.
+    typename Functor::LabelObjectLineComparator< LineType > comparator;
+    const LineType probe( idx, NumericTraits< LengthType >::max() );
+
+    auto it = std::upper_bound(m_LineContainer.begin(), m_LineContainer.end(),
+                               probe, comparator);
+    if ( it == m_LineContainer.begin() )
+      {
+      return false;
+      }
+    --it;
+    return it->HasIndex(idx);
+    }
+
   auto end = m_LineContainer.end();
 
   for ( auto it = m_LineContainer.begin();
@@ -144,6 +164,7 @@ LabelObject< TLabel, VImageDimension >
         ++newIdx[0];
         LengthType newLength = orgLineLength - it->GetLength() - 1;
         m_LineContainer.push_back( LineType( newIdx, newLength ) );
+        m_LinesAreSorted = false;
         return true;
         }
       }
@@ -197,6 +218,7 @@ LabelObject< TLabel, VImageDimension >
 ::AddLine(const LineType & line)
 {
   m_LineContainer.push_back(line);
+  m_LinesAreSorted = false;
 }
 
 template< typename TLabel, unsigned int VImageDimension >
@@ -382,6 +404,10 @@ LabelObject< TLabel, VImageDimension >
     // complete the last line
     this->AddLine(currentIdx, currentLength);
     }
+
+  // the lines are now sorted and disjoint, which enables the bisection
+  // search in HasIndex()
+  m_LinesAreSorted = true;
 }
 
 template< typename TLabel, unsigned int VImageDimension >
@@ -404,6 +430,7 @@ LabelObject< TLabel, VImageDimension >
 ::Clear()
 {
   m_LineContainer.clear();
+  m_LinesAreSorted = true;
 }
 
 template< typename TLabel, unsigned int VImageDimension >
@@ -106,49 +106,81 @@ StatisticsLabelMapFilter< TImage, TFeatureImage >
   principalMoments.Fill(0);
 
 
-  // iterate over all the indexes
-  typename LabelObjectType::ConstIndexIterator it( labelObject );
-  while( ! it.IsAtEnd() )
+  // Iterate run by run, so the feature values of a run are read
+  // contiguously from the buffer and the physical position is updated
+  // incrementally along the line instead of being recomputed through
+  // the direction matrix for every pixel.
+  using LengthType = typename LabelObjectType::LengthType;
+
+  const FeatureImagePixelType *featureBuffer = featureImage->GetBufferPointer();
+
+  // the physical step from one pixel of a line to the next
+  PointType physicalStep;
+  for ( unsigned int i = 0; i < ImageDimension; i++ )
     {
-    const IndexType & idx = it.GetIndex();
-    const FeatureImagePixelType & v = featureImage->GetPixel(idx);
-    mv[0] = v;
-    histogram->GetIndex(mv, histogramIndex);
-    histogram->IncreaseFrequencyOfIndex(histogramIndex, 1);
-
-    // update min and max
-    if ( v <= min )
-      {
-      min = v;
-      minIdx = idx;
-      }
-    if ( v >= max )
-      {
-      max = v;
-      maxIdx = idx;
-      }
+    physicalStep[i] = output->GetDirection()[i][0] * output->GetSpacing()[0];
+    }
+
+  typename LabelObjectType::ConstLineIterator lit( labelObject );
+  while( ! lit.IsAtEnd() )
+    {
+    const IndexType & firstIdx = lit.GetLine().GetIndex();
+    const LengthType  length = lit.GetLine().GetLength();
 
-    //increase the sums
-    sum += v;
-    sum2 += std::pow( (double)v, 2 );
-    sum3 += std::pow( (double)v, 3 );
-    sum4 += std::pow( (double)v, 4 );
+    const FeatureImagePixelType *line = featureBuffer + featureImage->ComputeOffset(firstIdx);
 
-    // moments
     PointType physicalPosition;
-    output->TransformIndexToPhysicalPoint(idx, physicalPosition);
-    for ( unsigned int i = 0; i < ImageDimension; i++ )
+    output->TransformIndexToPhysicalPoint(firstIdx, physicalPosition);
+
+    for ( LengthType p = 0; p < length; p++ )
       {
-      centerOfGravity[i] += physicalPosition[i] * v;
-      centralMoments[i][i] += v * physicalPosition[i] * physicalPosition[i];
-      for ( unsigned int j = i + 1; j < ImageDimension; j++ )
+      const FeatureImagePixelType v = line[p];
+      mv[0] = v;
+      histogram->GetIndex(mv, histogramIndex);
+      histogram->IncreaseFrequencyOfIndex(histogramIndex, 1);
+
+      // update min and max
+      if ( v <= min )
+        {
+        min = v;
+        minIdx = firstIdx;
+        minIdx[0] += static_cast< IndexValueType >( p );
+        }
+      if ( v >= max )
+        {
+        max = v;
+        maxIdx = firstIdx;
+        maxIdx[0] += static_cast< IndexValueType >( p );
+        }
+
+      //increase the sums
+      const double v1 = v;
+      const double v2 = v1 * v1;
+      sum += v1;
+      sum2 += v2;
+      sum3 += v2 * v1;
+      sum4 += v2 * v2;
+
+      // moments
+      for ( unsigned int i = 0; i < ImageDimension; i++ )
+        {
+        centerOfGravity[i] += physicalPosition[i] * v1;
+        centralMoments[i][i] += v1 * physicalPosition[i] * physicalPosition[i];
+        for ( unsigned int j = i + 1; j < ImageDimension; j++ )
+          {
+          double weight = v1 * physicalPosition[i] * physicalPosition[j];
+          centralMoments[i][j] += weight;
+          centralMoments[j][i] += weight;
+          }
+        }
+
+      // advance along the line
+      for ( unsigned int i = 0; i < ImageDimension; i++ )
         {
-        double weight = v * physicalPosition[i] * physicalPosition[j];
-        centralMoments[i][j] += weight;
-        centralMoments[j][i] += weight;
+        physicalPosition[i] += physicalStep[i];
         }
       }
-    ++it;
+    ++lit;
     }
 
   // final computations
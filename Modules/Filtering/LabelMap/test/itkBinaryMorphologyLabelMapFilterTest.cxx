@@ -0,0 +1,197 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkBinaryDilateLabelMapFilter.h"
+#include "itkBinaryErodeLabelMapFilter.h"
+#include "itkBinaryImageToLabelMapFilter.h"
+#include "itkLabelMapToBinaryImageFilter.h"
+#include "itkImageRegionConstIteratorWithIndex.h"
+
+namespace
+{
+
+using ImageType = itk::Image< unsigned char, 2 >;
+
+// Reference box morphology computed pixel by pixel.
+ImageType::Pointer BruteForceBoxMorphology( const ImageType *input,
+                                            const itk::Size< 2 > & radius,
+                                            bool dilate,
+                                            bool boundaryToForeground )
+{
+  const ImageType::RegionType region = input->GetLargestPossibleRegion();
+
+  ImageType::Pointer output = ImageType::New();
+  output->SetRegions( region );
+  output->Allocate();
+
+  itk::ImageRegionConstIteratorWithIndex< ImageType > it( input, region );
+  for ( it.GoToBegin(); !it.IsAtEnd(); ++it )
+    {
+    const ImageType::IndexType center = it.GetIndex();
+    bool anyForeground = false;
+    bool allForeground = true;
+    for ( itk::IndexValueType oy = -static_cast< itk::IndexValueType >( radius[1] );
+          oy <= static_cast< itk::IndexValueType >( radius[1] ); oy++ )
+      {
+      for ( itk::IndexValueType ox = -static_cast< itk::IndexValueType >( radius[0] );
+            ox <= static_cast< itk::IndexValueType >( radius[0] ); ox++ )
+        {
+        ImageType::IndexType idx = center;
+        idx[0] += ox;
+        idx[1] += oy;
+        if ( !region.IsInside( idx ) )
+          {
+          if ( !boundaryToForeground )
+            {
+            allForeground = false;
+            }
+          continue;
+          }
+        if ( input->GetPixel( idx ) != 0 )
+          {
+          anyForeground = true;
+          }
+        else
+          {
+          allForeground = false;
+          }
+        }
+      }
+    output->SetPixel( center, ( dilate ? anyForeground : allForeground ) ? 255 : 0 );
+    }
+  return output;
+}
+
+bool ImagesMatch( const ImageType *a, const ImageType *b, const char *name )
+{
+  itk::ImageRegionConstIteratorWithIndex< ImageType > it( a, a->GetLargestPossibleRegion() );
+  for ( it.GoToBegin(); !it.IsAtEnd(); ++it )
+    {
+    if ( it.Get() != b->GetPixel( it.GetIndex() ) )
+      {
+      std::cerr << name << ": mismatch at " << it.GetIndex()
+                << ": " << static_cast< int >( it.Get() )
+                << " != " << static_cast< int >( b->GetPixel( it.GetIndex() ) ) << std::endl;
+      return false;
+      }
+    }
+  return true;
+}
+
+} // end anonymous namespace
+
+int itkBinaryMorphologyLabelMapFilterTest( int, char * [] )
+{
+  // A small mask with an L-shaped object, an isolated blob and an object
+  // touching the region border.
+  ImageType::Pointer input = ImageType::New();
+  ImageType::SizeType size = {{20, 16}};
+  ImageType::RegionType region;
+  region.SetSize( size );
+  input->SetRegions( region );
+  input->Allocate(true);
+
+  for ( int x = 4; x <= 10; x++ )
+    {
+    for ( int y = 4; y <= 6; y++ )
+      {
+      input->SetPixel( {{x, y}}, 255 );
+      }
+    }
+  for ( int x = 4; x <= 6; x++ )
+    {
+    for ( int y = 7; y <= 11; y++ )
+      {
+      input->SetPixel( {{x, y}}, 255 );
+      }
+    }
+  for ( int x = 14; x <= 16; x++ )
+    {
+    for ( int y = 9; y <= 12; y++ )
+      {
+      input->SetPixel( {{x, y}}, 255 );
+      }
+    }
+  for ( int x = 0; x <= 3; x++ )
+    {
+    for ( int y = 0; y <= 2; y++ )
+      {
+      input->SetPixel( {{x, y}}, 255 );
+      }
+    }
+
+  using ConverterType = itk::BinaryImageToLabelMapFilter< ImageType >;
+  using LabelMapType = ConverterType::OutputImageType;
+  using BackConverterType = itk::LabelMapToBinaryImageFilter< LabelMapType, ImageType >;
+
+  itk::Size< 2 > radius = {{2, 1}};
+
+  // Dilation
+  {
+  ConverterType::Pointer converter = ConverterType::New();
+  converter->SetInput( input );
+  converter->SetInputForegroundValue( 255 );
+
+  using DilateType = itk::BinaryDilateLabelMapFilter< LabelMapType >;
+  DilateType::Pointer dilate = DilateType::New();
+  dilate->SetInput( converter->GetOutput() );
+  dilate->SetRadius( radius );
+
+  BackConverterType::Pointer backConverter = BackConverterType::New();
+  backConverter->SetInput( dilate->GetOutput() );
+  backConverter->SetForegroundValue( 255 );
+  backConverter->Update();
+
+  ImageType::Pointer expected = BruteForceBoxMorphology( input, radius, true, false );
+  if ( !ImagesMatch( expected, backConverter->GetOutput(), "dilation" ) )
+    {
+    return EXIT_FAILURE;
+    }
+  }
+
+  // Erosion, with the outside of the region counting as foreground and as
+  // background
+  for ( int boundaryToForeground = 0; boundaryToForeground <= 1; boundaryToForeground++ )
+    {
+    ConverterType::Pointer converter = ConverterType::New();
+    converter->SetInput( input );
+    converter->SetInputForegroundValue( 255 );
+
+    using ErodeType = itk::BinaryErodeLabelMapFilter< LabelMapType >;
+    ErodeType::Pointer erode = ErodeType::New();
+    erode->SetInput( converter->GetOutput() );
+    erode->SetRadius( radius );
+    erode->SetBoundaryToForeground( boundaryToForeground != 0 );
+
+    BackConverterType::Pointer backConverter = BackConverterType::New();
+    backConverter->SetInput( erode->GetOutput() );
+    backConverter->SetForegroundValue( 255 );
+    backConverter->Update();
+
+    ImageType::Pointer expected =
+      BruteForceBoxMorphology( input, radius, false, boundaryToForeground != 0 );
+    if ( !ImagesMatch( expected, backConverter->GetOutput(),
+                       boundaryToForeground ? "erosion" : "erosion (background boundary)" ) )
+      {
+      return EXIT_FAILURE;
+      }
+    }
+
+  std::cout << "Test PASSED." << std::endl;
+  return EXIT_SUCCESS;
+}
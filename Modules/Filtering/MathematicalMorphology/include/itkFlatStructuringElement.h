@@ -139,7 +139,11 @@ public:
    */
   static Self Box(RadiusType radius);
 
-  /** Create a ball structuring element */
+  /** Create a ball structuring element. When the radial line
+   * decomposition reproduces the ball shape exactly - which is the
+   * common case for the small and isotropic radii - the element is
+   * marked decomposable, so the fast line based erosion and dilation
+   * algorithms are selected automatically. */
   static Self Ball(RadiusType radius, bool radiusIsParametric = false);
 
   /** Create a cross structuring element */
@@ -190,6 +194,15 @@ public:
    */
   void ComputeBufferFromLines();
 
+  /**
+   * Attempt the classic radial decomposition of the convex shape
+   * currently stored in the buffer. The lines are kept, and the element
+   * marked decomposable, only when dilating with them reproduces the
+   * buffer exactly, so enabling the line based algorithms never changes
+   * the result of a filter. Returns whether a decomposition was found.
+   */
+  bool ComputeLinesFromBuffer();
+
   /**
    * The RadiusIsParametric mode ensures that the area of the foreground
    * corresponds to the radius that was specified.
@@ -768,6 +768,10 @@ FlatStructuringElement< VDimension > FlatStructuringElement< VDimension >
   // Clean up
   //   ...temporary image should be cleaned up by SmartPointers automatically
 
+  // enable the fast line based algorithms when they can reproduce this
+  // exact shape
+  res.ComputeLinesFromBuffer();
+
   return res;
 }
 
@@ -1003,6 +1007,62 @@ FlatStructuringElement< VDimension >::ComputeBufferFromLines()
     }
 }
 
+template< unsigned int VDimension >
+bool
+FlatStructuringElement< VDimension >::ComputeLinesFromBuffer()
+{
+  // the radial decomposition is only implemented for dimension 2 and 3
+  if ( VDimension != 2 && VDimension != 3 )
+    {
+    return false;
+    }
+  for ( unsigned int i = 0; i < VDimension; i++ )
+    {
+    if ( this->GetRadius()[i] == 0 )
+      {
+      return false;
+      }
+    }
+
+  // candidate decompositions, from the cheapest one to the finest
+  // approximation. In 3D GeneratePolygon() only supports the platonic
+  // solid based facet counts.
+  std::vector< unsigned int > candidates;
+  if ( VDimension == 2 )
+    {
+    candidates = { 2, 3, 4, 6, 8 };
+    }
+  else
+    {
+    candidates = { 7, 6, 10, 16 };
+    }
+
+  for ( unsigned int lines : candidates )
+    {
+    Self trial = Self::Polygon(this->GetRadius(), lines);
+    // only keep the decomposition when it reproduces the shape in the
+    // buffer exactly - a filter switching to the line based algorithm
+    // must not change its output
+    bool identical = true;
+    ConstIterator trial_it = trial.Begin();
+    for ( ConstIterator kernel_it = this->Begin(); kernel_it != this->End(); ++kernel_it, ++trial_it )
+      {
+      if ( *kernel_it != *trial_it )
+        {
+        identical = false;
+        break;
+        }
+      }
+    if ( identical )
+      {
+      m_Lines = trial.GetLines();
+      m_Decomposable = true;
+      return true;
+      }
+    }
+  return false;
+}
+
 /** Check if size of input Image is odd in all dimensions, throwing exception if even */
 template< unsigned int VDimension >
 typename FlatStructuringElement< VDimension >::RadiusType
@@ -1051,6 +1111,9 @@ FlatStructuringElement< VDimension >::FromImage(
       }
     }
 
+  // the image may hold a shape with an exact radial decomposition
+  res.ComputeLinesFromBuffer();
+
   return res;
 }
 
@@ -36,8 +36,11 @@ namespace itk
  * convergence. In the convergence case, the filter is equivalent to
  * "reconstruction by dilation". This filter is implemented to handle
  * both scenarios.  The one iteration case is multi-threaded.  The
- * convergence case is delegated to another instance of the same
- * filter (but configured to run a single iteration).
+ * convergence case is delegated to the
+ * ReconstructionByDilationImageFilter, which implements Vincent's
+ * hybrid raster/anti-raster and FIFO queue algorithm and converges in
+ * roughly two passes over the image instead of one full pass per
+ * elementary dilation.
  *
  * The marker image must be less than or equal to the mask image
  * (on a pixel by pixel basis).
@@ -46,15 +49,6 @@ namespace itk
  * book "Morphological Image Analysis: Principles and Applications",
  * Second Edition, Springer, 2003.
  *
- * A noniterative version of this algorithm can be found in the
- * ReconstructionByDilationImageFilter. This noniterative solution is
- * much faster than the implementation provided here.  All ITK filters
- * that previously used GrayscaleGeodesicDiliateImageFilter as part of
- * their implementation have been converted to use the
- * ReconstructionByDilationImageFilter. The
- * GrayscaleGeodesicDilateImageFilter is maintained for backward
- * compatibility.
- *
  * \sa MorphologyImageFilter, GrayscaleDilateImageFilter,
  * GrayscaleFunctionDilateImageFilter, BinaryDilateImageFilter, ReconstructionByDilationImageFilter
  * \ingroup ImageEnhancement  MathematicalMorphologyImageFilters
@@ -124,7 +118,7 @@ public:
   itkBooleanMacro(RunOneIteration);
 
   /** Get the number of iterations used to produce the current
-   * output. */
+   * output. The noniterative convergence case always reports 1. */
   itkGetConstMacro(NumberOfIterationsUsed, unsigned long);
 
   /**
@@ -23,6 +23,7 @@
 #include "itkZeroFluxNeumannBoundaryCondition.h"
 #include "itkNumericTraits.h"
 #include "itkGrayscaleGeodesicDilateImageFilter.h"
+#include "itkReconstructionByDilationImageFilter.h"
 #include "itkNeighborhoodAlgorithm.h"
 #include "itkProgressAccumulator.h"
 #include "itkProgressReporter.h"
@@ -187,98 +188,39 @@ GrayscaleGeodesicDilateImageFilter< TInputImage, TOutputImage >
     return;
     }
 
-  // Filter was configured to run until convergence. We need to
-  // delegate to an instance of the filter to run each iteration
-  // separately. For efficiency, we will delegate to an instance that
-  // is templated over <TInputImage, TInputImage> to avoid any
-  // pixelwise casting until the final output image is configured.
-  typename GrayscaleGeodesicDilateImageFilter< TInputImage, TInputImage >::Pointer
-  singleIteration =
-    GrayscaleGeodesicDilateImageFilter< TInputImage, TInputImage >::New();
-  bool done = false;
-
-  // set up the singleIteration filter. we are not using the grafting
-  // mechanism because we only need the requested region to be set up
-  singleIteration->RunOneIterationOn();
-  singleIteration->SetMarkerImage( this->GetMarkerImage() );
-  singleIteration->SetMaskImage( this->GetMaskImage() );
-  singleIteration->GetOutput()
-  ->SetRequestedRegion( this->GetOutput()->GetRequestedRegion() );
+  // Filter was configured to run until convergence. Delegate the whole
+  // reconstruction to the ReconstructionByDilationImageFilter, which
+  // implements Vincent's hybrid algorithm: a raster and an anti-raster
+  // sweep followed by a FIFO driven propagation of the remaining
+  // changes. It converges in roughly two passes over the image plus
+  // the queue work, instead of one full pass per elementary dilation.
+  typename ReconstructionByDilationImageFilter< TInputImage, TOutputImage >::Pointer
+  reconstruction =
+    ReconstructionByDilationImageFilter< TInputImage, TOutputImage >::New();
 
   // Create a process accumulator for tracking the progress of this minipipeline
   ProgressAccumulator::Pointer progress = ProgressAccumulator::New();
   progress->SetMiniPipelineFilter(this);
-  progress->RegisterInternalFilter(singleIteration, 1.0f);
+  progress->RegisterInternalFilter(reconstruction, 1.0f);
 
-  // run until convergence
-  while ( !done )
-    {
-    // run one iteration
-    singleIteration->Update();
-    iterate.CompletedStep();
+  reconstruction->SetMarkerImage( this->GetMarkerImage() );
+  reconstruction->SetMaskImage( this->GetMaskImage() );
+  reconstruction->SetFullyConnected(m_FullyConnected);
 
-    // Check for convergence.  Compare the output of the single
-    // iteration of the algorithm with the current marker image.
-    ImageRegionConstIterator< TInputImage > singleInIt(
-      singleIteration->GetMarkerImage(),
-      singleIteration->GetOutput()->GetRequestedRegion() );
-    ImageRegionIterator< TInputImage > singleOutIt(
-      singleIteration->GetOutput(),
-      singleIteration->GetOutput()->GetRequestedRegion() );
-
-    done = true;
-    while ( !singleOutIt.IsAtEnd() )
-      {
-      // exit early from check on first pixel that is different
-      if ( singleInIt.Get() != singleOutIt.Get() )
-        {
-        done = false;
-        break;        // exit early from check
-        }
-      ++singleInIt;
-      ++singleOutIt;
-      }
+  // graft our output to the reconstruction filter to force the proper
+  // regions to be generated
+  reconstruction->GraftOutput( this->GetOutput() );
 
-    // If we have not converged, then setup the singleIteration filter
-    // for the next iteration.
-    //
-    if ( !done )
-      {
-      // disconnect the current output from the singleIteration object
-      MarkerImagePointer marker = singleIteration->GetOutput();
-      marker->DisconnectPipeline();
-      // assign the old output as the input
-      singleIteration->SetMarkerImage(marker);
-      // since DisconnectPipeline() creates a new output object, we need
-      // to regraft the information onto the output
-      singleIteration->GetOutput()
-      ->SetRequestedRegion( this->GetOutput()->GetRequestedRegion() );
-
-      // Keep track of how many iterations have be done
-      m_NumberOfIterationsUsed++;
-      }
-    }
+  reconstruction->Update();
 
-  // Convert the output of singleIteration to an TOutputImage type
-  // (could use a CastImageFilter here to thread the copy)
-  typename OutputImageType::Pointer outputPtr = this->GetOutput();
-  outputPtr->SetBufferedRegion( outputPtr->GetRequestedRegion() );
-  outputPtr->Allocate();
-
-  // walk the output of the singleIteration
-  ImageRegionIterator< TInputImage > singleIt( singleIteration->GetOutput(),
-                                               outputPtr->GetRequestedRegion() );
-  // walk the real output of the filter
-  ImageRegionIterator< TOutputImage > outIt( outputPtr,
-                                             outputPtr->GetRequestedRegion() );
-
-  // cast and copy
-  while ( !outIt.IsAtEnd() )
-    {
-    outIt.Set( static_cast< OutputImagePixelType >( singleIt.Get() ) );
-    ++outIt;
-    ++singleIt;
-    }
+  // graft the output of the reconstruction filter back onto this
+  // filter's output. this is needed to get the appropriate regions
+  // passed back.
+  this->GraftOutput( reconstruction->GetOutput() );
+
+  // the hybrid algorithm is not iterative
+  m_NumberOfIterationsUsed = 1;
+  iterate.CompletedStep();
 }
 
 template< typename TInputImage, typename TOutputImage >
@@ -190,10 +190,130 @@ public:
   TInputPixel                     m_Boundary;
 };
 
+template< typename TInputPixel, typename TCompare >
+class HierarchicalMorphologyHistogram
+{
+public:
+
+  HierarchicalMorphologyHistogram()
+  {
+    // one counter per gray level, plus one coarse counter per block of
+    // m_BlockSize levels. With a 16 bit pixel type a single removal can
+    // empty the current extremum bin and force a rescan over tens of
+    // thousands of empty bins; the coarse counters let that rescan skip
+    // a whole empty block in one step, so the update cost stays bounded
+    // even on sparse histograms.
+    m_Fine.resize(NumericTraits< TInputPixel >::max() - NumericTraits< TInputPixel >::NonpositiveMin() + 1, 0);
+    m_Coarse.resize( ( m_Fine.size() + m_BlockSize - 1 ) / m_BlockSize, 0 );
+    if ( m_Compare( NumericTraits< TInputPixel >::max(), NumericTraits< TInputPixel >::NonpositiveMin() ) )
+      {
+      m_InitValue = NumericTraits< TInputPixel >::NonpositiveMin();
+      m_CurrentValue = m_InitValue;
+      m_Direction = -1;
+      }
+    else
+      {
+      m_InitValue = NumericTraits< TInputPixel >::max();
+      m_CurrentValue = m_InitValue;
+      m_Direction = 1;
+      }
+    m_Boundary = 0;
+  }
+
+  inline void AddBoundary()
+  {
+    AddPixel(m_Boundary);
+  }
+
+  inline void RemoveBoundary()
+  {
+    RemovePixel(m_Boundary);
+  }
+
+  inline void AddPixel(const TInputPixel & p)
+  {
+    const OffsetValueType offset = p - NumericTraits < TInputPixel > ::NonpositiveMin();
+    m_Fine[offset]++;
+    m_Coarse[offset / m_BlockSize]++;
+    if ( m_Compare(p, m_CurrentValue) )
+      {
+      m_CurrentValue = p;
+      }
+  }
+
+  inline void RemovePixel(const TInputPixel & p)
+  {
+    const OffsetValueType offset = p - NumericTraits < TInputPixel > ::NonpositiveMin();
+    m_Fine[offset]--;
+    m_Coarse[offset / m_BlockSize]--;
+    const OffsetValueType init = m_InitValue - NumericTraits < TInputPixel > ::NonpositiveMin();
+    OffsetValueType       current = m_CurrentValue - NumericTraits < TInputPixel > ::NonpositiveMin();
+    while ( m_Fine[current] == 0 && current != init )
+      {
+      if ( m_Coarse[current / m_BlockSize] == 0 )
+        {
+        // the whole block is empty - jump directly past it
+        if ( m_Direction < 0 )
+          {
+          current = ( current / m_BlockSize ) * m_BlockSize - 1;
+          if ( current < init )
+            {
+            current = init;
+            }
+          }
+        else
+          {
+          current = ( current / m_BlockSize + 1 ) * m_BlockSize;
+          if ( current > init )
+            {
+            current = init;
+            }
+          }
+        }
+      else
+        {
+        current += m_Direction;
+        }
+      }
+    m_CurrentValue = static_cast< TInputPixel >( current + NumericTraits < TInputPixel > ::NonpositiveMin() );
+  }
+
+  inline TInputPixel GetValue()
+  {
+    return m_CurrentValue;
+  }
+
+  inline TInputPixel GetValue(const TInputPixel &)
+  {
+    return GetValue();
+  }
+
+  void SetBoundary(const TInputPixel & val)
+  {
+    m_Boundary = val;
+  }
+
+  static bool UseVectorBasedAlgorithm()
+  {
+    return true;
+  }
+
+  static constexpr OffsetValueType m_BlockSize = 256;
+
+  std::vector< IdentifierType >   m_Fine;
+  std::vector< IdentifierType >   m_Coarse;
+  TInputPixel                     m_InitValue;
+  TInputPixel                     m_CurrentValue;
+  TCompare                        m_Compare;
+  signed int                      m_Direction;
+  TInputPixel                     m_Boundary;
+};
+
 /// \cond HIDE_SPECIALIZATION_DOCUMENTATION
 
 // now create MorphologyHistogram partial specilizations using the VectorMorphologyHistogram
-// as base class
+// as base class for the 8 bit pixel types, and the HierarchicalMorphologyHistogram
+// for the 16 bit ones
 
 template< typename TCompare >
 class MorphologyHistogram<unsigned char, TCompare>:
@@ -213,6 +333,18 @@ class MorphologyHistogram<bool, TCompare>:
 {
 };
 
+template< typename TCompare >
+class MorphologyHistogram<unsigned short, TCompare>:
+  public HierarchicalMorphologyHistogram<unsigned short, TCompare>
+{
+};
+
+template< typename TCompare >
+class MorphologyHistogram<short, TCompare>:
+  public HierarchicalMorphologyHistogram<short, TCompare>
+{
+};
+
 /// \endcond
 
 } // end namespace Function
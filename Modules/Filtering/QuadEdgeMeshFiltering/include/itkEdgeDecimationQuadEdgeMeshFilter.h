@@ -20,6 +20,7 @@
 
 #include <list>
 #include <map>
+#include <vector>
 #include <algorithm>
 
 #include "itkQuadEdgeMeshEulerOperatorJoinVertexFunction.h"
@@ -85,6 +86,16 @@ public:
   using OperatorType = QuadEdgeMeshEulerOperatorJoinVertexFunction< OutputMeshType, OutputQEType >;
   using OperatorPointer = typename OperatorType::Pointer;
 
+  /** When enabled, candidate edges are kept in an approximate lazy-deletion
+   * bucket queue instead of the exact priority queue. Stale entries are
+   * skipped on extraction rather than re-heaped on every collapse, which
+   * makes decimation of very large meshes considerably faster at the price
+   * of quantizing the collapse order to the bucket resolution.
+   * Off by default. */
+  itkSetMacro(UseBucketQueue, bool);
+  itkGetConstMacro(UseBucketQueue, bool);
+  itkBooleanMacro(UseBucketQueue);
+
 protected:
 
   EdgeDecimationQuadEdgeMeshFilter();
@@ -92,6 +103,7 @@ protected:
 
   bool m_Relocate{true};
   bool m_CheckOrientation{false};
+  bool m_UseBucketQueue{false};
 
   PriorityQueuePointer m_PriorityQueue;
   QueueMapType         m_QueueMapper;
@@ -99,6 +111,42 @@ protected:
   PriorityType         m_Priority;
   OperatorPointer      m_JoinVertexFunction;
 
+  /** One candidate of the lazy-deletion bucket queue. An entry becomes
+   * stale when the per-edge state in m_BucketMapper no longer matches it;
+   * stale entries are simply skipped on extraction. */
+  struct BucketQueueEntry
+    {
+    OutputQEType *m_Element;
+    MeasureType   m_Measure;
+    };
+
+  /** Current state of an edge known to the bucket queue. A blocked edge
+   * corresponds to a tagged-out element of the exact priority queue. */
+  struct BucketQueueState
+    {
+    MeasureType m_Measure;
+    bool        m_Blocked;
+    };
+
+  using BucketQueueMapType = std::map< OutputQEType *, BucketQueueState >;
+
+  std::vector< std::vector< BucketQueueEntry > > m_Buckets;
+  BucketQueueMapType                             m_BucketMapper;
+  std::vector< BucketQueueEntry >                m_BucketStaging;
+  MeasureType                                    m_BucketMeasureMin{};
+  double                                         m_BucketScale{0.};
+  size_t                                         m_CurrentBucket{0};
+  SizeValueType                                  m_NumberOfBucketCandidates{0};
+
+  /** \brief Map a measure value to its bucket */
+  size_t BucketIndex(const MeasureType & iMeasure) const;
+
+  /** \brief Distribute the staged candidates once the measure range is known */
+  void BuildBuckets();
+
+  /** \brief Extract the cheapest valid candidate of the bucket queue */
+  void ExtractFromBucketQueue();
+
   /**
   * \brief Compute the measure value for iEdge
   * \param[in] iEdge
@@ -77,6 +77,11 @@ EdgeDecimationQuadEdgeMeshFilter< TInput, TOutput, TCriterion >::FillPriorityQue
       }
     ++it;
     }
+
+  if ( m_UseBucketQueue )
+    {
+    this->BuildBuckets();
+    }
 }
 
 template< typename TInput, typename TOutput, typename TCriterion >
@@ -89,6 +94,16 @@ EdgeDecimationQuadEdgeMeshFilter< TInput, TOutput, TCriterion >::PushElement(Out
   OutputQEType *temp = ( id_org < id_dest ) ? iEdge : iEdge->GetSym();
   MeasureType   measure = MeasureEdge(temp);
 
+  if ( m_UseBucketQueue )
+    {
+    // stage the candidate; BuildBuckets() distributes them once the
+    // range of the measure is known
+    m_BucketStaging.push_back( { temp, measure } );
+    m_BucketMapper[temp] = { measure, false };
+    ++m_NumberOfBucketCandidates;
+    return;
+    }
+
   auto * qi = new PriorityQueueItemType( temp,
                                                          PriorityType(false, measure) );
 
@@ -96,6 +111,110 @@ EdgeDecimationQuadEdgeMeshFilter< TInput, TOutput, TCriterion >::PushElement(Out
   m_PriorityQueue->Push(qi);
 }
 
+template< typename TInput, typename TOutput, typename TCriterion >
+size_t
+EdgeDecimationQuadEdgeMeshFilter< TInput, TOutput, TCriterion >::BucketIndex(const MeasureType & iMeasure) const
+{
+  if ( iMeasure <= m_BucketMeasureMin )
+    {
+    return 0;
+    }
+
+  auto index = static_cast< size_t >(
+    static_cast< double >( iMeasure - m_BucketMeasureMin ) * m_BucketScale );
+
+  // measures produced after collapses may exceed the initial range
+  return ( index < m_Buckets.size() ) ? index : m_Buckets.size() - 1;
+}
+
+template< typename TInput, typename TOutput, typename TCriterion >
+void
+EdgeDecimationQuadEdgeMeshFilter< TInput, TOutput, TCriterion >::BuildBuckets()
+{
+  const size_t numberOfBuckets = 2048;
+
+  m_Buckets.clear();
+  m_Buckets.resize(numberOfBuckets);
+  m_CurrentBucket = 0;
+
+  if ( m_BucketStaging.empty() )
+    {
+    return;
+    }
+
+  MeasureType measureMin = m_BucketStaging[0].m_Measure;
+  MeasureType measureMax = m_BucketStaging[0].m_Measure;
+
+  for ( size_t i = 1; i < m_BucketStaging.size(); i++ )
+    {
+    const MeasureType & measure = m_BucketStaging[i].m_Measure;
+    measureMin = ( measure < measureMin ) ? measure : measureMin;
+    measureMax = ( measure > measureMax ) ? measure : measureMax;
+    }
+
+  m_BucketMeasureMin = measureMin;
+  if ( measureMax > measureMin )
+    {
+    m_BucketScale = static_cast< double >( numberOfBuckets )
+                    / static_cast< double >( measureMax - measureMin );
+    }
+  else
+    {
+    m_BucketScale = 0.;
+    }
+
+  for ( size_t i = 0; i < m_BucketStaging.size(); i++ )
+    {
+    m_Buckets[this->BucketIndex(m_BucketStaging[i].m_Measure)].push_back(m_BucketStaging[i]);
+    }
+  m_BucketStaging.clear();
+}
+
+template< typename TInput, typename TOutput, typename TCriterion >
+void
+EdgeDecimationQuadEdgeMeshFilter< TInput, TOutput, TCriterion >::ExtractFromBucketQueue()
+{
+  while ( m_CurrentBucket < m_Buckets.size() )
+    {
+    std::vector< BucketQueueEntry > & bucket = m_Buckets[m_CurrentBucket];
+
+    while ( !bucket.empty() )
+      {
+      BucketQueueEntry entry = bucket.back();
+      bucket.pop_back();
+
+      auto map_it = m_BucketMapper.find(entry.m_Element);
+      if ( map_it == m_BucketMapper.end()
+           || map_it->second.m_Blocked
+           || Math::NotExactlyEquals(map_it->second.m_Measure, entry.m_Measure) )
+        {
+        // stale or blocked entry left behind by a lazy deletion
+        continue;
+        }
+
+      if ( !IsEdgeOKToBeProcessed(entry.m_Element) )
+        {
+        m_BucketMapper.erase(map_it);
+        --m_NumberOfBucketCandidates;
+        continue;
+        }
+
+      m_Element = entry.m_Element;
+      m_Priority = PriorityType(false, entry.m_Measure);
+      m_BucketMapper.erase(map_it);
+      --m_NumberOfBucketCandidates;
+      return;
+      }
+
+    ++m_CurrentBucket;
+    }
+
+  // only blocked candidates remain, report it the way the exact queue
+  // does so that ProcessWithTopologicalGuarantee() stops the decimation
+  m_Element = nullptr;
+  m_Priority = PriorityType( true, NumericTraits< MeasureType >::ZeroValue() );
+}
+
 template< typename TInput, typename TOutput, typename TCriterion >
 bool
 EdgeDecimationQuadEdgeMeshFilter< TInput, TOutput, TCriterion >::
@@ -164,6 +283,12 @@ EdgeDecimationQuadEdgeMeshFilter< TInput, TOutput, TCriterion >::Extract()
 {
   OutputMeshPointer output = this->GetOutput();
 
+  if ( m_UseBucketQueue )
+    {
+    this->ExtractFromBucketQueue();
+    return;
+    }
+
   do
     {
     m_Element = m_PriorityQueue->Peek()->m_Element;
@@ -186,6 +311,19 @@ EdgeDecimationQuadEdgeMeshFilter< TInput, TOutput, TCriterion >::DeleteElement(O
     OutputQEType *temp = ( iEdge->GetOrigin() < iEdge->GetDestination() ) ?
                          iEdge : iEdge->GetSym();
 
+    if ( m_UseBucketQueue )
+      {
+      // lazy deletion: dropping the per-edge state is enough, the bucket
+      // entry is recognized as stale when it surfaces
+      auto bucket_it = m_BucketMapper.find(temp);
+      if ( bucket_it != m_BucketMapper.end() && !bucket_it->second.m_Blocked )
+        {
+        m_BucketMapper.erase(bucket_it);
+        --m_NumberOfBucketCandidates;
+        }
+      return;
+      }
+
     auto map_it = m_QueueMapper.find(temp);
     if ( map_it != m_QueueMapper.end() )
       {
@@ -211,9 +349,36 @@ EdgeDecimationQuadEdgeMeshFilter< TInput, TOutput, TCriterion >::PushOrUpdateEle
     temp = temp->GetSym();
     }
 
+  MeasureType measure = MeasureEdge(temp);
+
+  if ( m_UseBucketQueue )
+    {
+    auto bucket_it = m_BucketMapper.find(temp);
+    if ( bucket_it != m_BucketMapper.end() )
+      {
+      if ( bucket_it->second.m_Blocked )
+        {
+        return;
+        }
+      bucket_it->second.m_Measure = measure;
+      }
+    else
+      {
+      m_BucketMapper[temp] = { measure, false };
+      ++m_NumberOfBucketCandidates;
+      }
+    const size_t bucketIndex = this->BucketIndex(measure);
+    m_Buckets[bucketIndex].push_back( { temp, measure } );
+    if ( bucketIndex < m_CurrentBucket )
+      {
+      // collapses can create candidates cheaper than the current bucket
+      m_CurrentBucket = bucketIndex;
+      }
+    return;
+    }
+
   auto map_it = m_QueueMapper.find(temp);
 
-  MeasureType measure = MeasureEdge(temp);
   if ( map_it != m_QueueMapper.end() )
     {
     if ( !map_it->second->m_Priority.first )
@@ -549,6 +714,24 @@ template< typename TInput, typename TOutput, typename TCriterion >
 void
 EdgeDecimationQuadEdgeMeshFilter< TInput, TOutput, TCriterion >::TagElementOut(OutputQEType *iEdge)
 {
+  if ( m_UseBucketQueue )
+    {
+    auto bucket_it = m_BucketMapper.find(iEdge);
+    if ( bucket_it != m_BucketMapper.end() )
+      {
+      if ( !bucket_it->second.m_Blocked )
+        {
+        bucket_it->second.m_Blocked = true;
+        --m_NumberOfBucketCandidates;
+        }
+      }
+    else
+      {
+      m_BucketMapper[iEdge] = { NumericTraits< MeasureType >::ZeroValue(), true };
+      }
+    return;
+    }
+
   auto map_it = m_QueueMapper.find(iEdge);
 
   if ( map_it != m_QueueMapper.end() )
@@ -589,6 +772,15 @@ template< typename TInput, typename TOutput, typename TCriterion >
 bool
 EdgeDecimationQuadEdgeMeshFilter< TInput, TOutput, TCriterion >::IsCriterionSatisfied()
 {
+  if ( m_UseBucketQueue )
+    {
+    if ( m_NumberOfBucketCandidates == 0 )
+      {
+      return true;
+      }
+    return this->m_Criterion->is_satisfied(this->GetOutput(), 0, m_Priority.second);
+    }
+
   if ( m_PriorityQueue->Empty() )
     {
     return true;
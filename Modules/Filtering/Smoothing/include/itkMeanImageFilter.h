@@ -18,7 +18,7 @@
 #ifndef itkMeanImageFilter_h
 #define itkMeanImageFilter_h
 
-#include "itkBoxImageFilter.h"
+#include "itkNeighborhoodScanlineImageFilter.h"
 #include "itkImage.h"
 #include "itkNumericTraits.h"
 
@@ -46,7 +46,7 @@ namespace itk
  */
 template< typename TInputImage, typename TOutputImage >
 class ITK_TEMPLATE_EXPORT MeanImageFilter:
-  public BoxImageFilter< TInputImage, TOutputImage >
+  public NeighborhoodScanlineImageFilter< TInputImage, TOutputImage >
 {
 public:
   ITK_DISALLOW_COPY_AND_ASSIGN(MeanImageFilter);
@@ -61,7 +61,7 @@ public:
 
   /** Standard class type aliases. */
   using Self = MeanImageFilter;
-  using Superclass = BoxImageFilter< InputImageType, OutputImageType >;
+  using Superclass = NeighborhoodScanlineImageFilter< InputImageType, OutputImageType >;
   using Pointer = SmartPointer< Self >;
   using ConstPointer = SmartPointer< const Self >;
 
@@ -69,7 +69,7 @@ public:
   itkNewMacro(Self);
 
   /** Run-time type information (and related methods). */
-  itkTypeMacro(MeanImageFilter, BoxImageFilter);
+  itkTypeMacro(MeanImageFilter, NeighborhoodScanlineImageFilter);
 
   /** Image type alias support */
   using InputPixelType = typename InputImageType::PixelType;
@@ -81,6 +81,8 @@ public:
 
   using InputSizeType = typename InputImageType::SizeType;
 
+  using ConstNeighborhoodIteratorType = typename Superclass::ConstNeighborhoodIteratorType;
+
 #ifdef ITK_USE_CONCEPT_CHECKING
   // Begin concept checking
   itkConceptMacro( InputHasNumericTraitsCheck,
@@ -92,17 +94,22 @@ protected:
   MeanImageFilter();
   ~MeanImageFilter() override = default;
 
-  /** MeanImageFilter can be implemented as a multithreaded filter.
-   * Therefore, this implementation provides a ThreadedGenerateData()
-   * routine which is called for each processing thread. The output
-   * image data is allocated automatically by the superclass prior to
-   * calling ThreadedGenerateData().  ThreadedGenerateData can only
-   * write to the portion of the output image specified by the
-   * parameter "outputRegionForThread"
+  /** Average the neighborhood of one boundary pixel. The superclass
+   * performs the boundary face decomposition and installs the boundary
+   * condition.
+   *
+   * \sa NeighborhoodScanlineImageFilter */
+  OutputPixelType EvaluateAtNeighborhood(const ConstNeighborhoodIteratorType & it) const override;
+
+  /** Average the neighborhoods of one interior scanline through raw
+   * buffer pointers.
    *
-   * \sa BoxImageFilter::ThreadedGenerateData(),
-   *     BoxImageFilter::GenerateData() */
-  void DynamicThreadedGenerateData(const OutputImageRegionType & outputRegionForThread) override;
+   * \sa NeighborhoodScanlineImageFilter */
+  void EvaluateInteriorScanline(const InputPixelType *input,
+                                OutputPixelType *output,
+                                SizeValueType length,
+                                const OffsetValueType *neighborhoodOffsets,
+                                SizeValueType neighborhoodSize) const override;
 
 };
 } // end namespace itk
@@ -19,71 +19,47 @@
 #define itkMeanImageFilter_hxx
 #include "itkMeanImageFilter.h"
 
-#include "itkConstNeighborhoodIterator.h"
-#include "itkNeighborhoodInnerProduct.h"
-#include "itkImageRegionIterator.h"
-#include "itkNeighborhoodAlgorithm.h"
-#include "itkOffset.h"
-#include "itkProgressReporter.h"
-
 namespace itk
 {
 template< typename TInputImage, typename TOutputImage >
 MeanImageFilter< TInputImage, TOutputImage >
-::MeanImageFilter()
-{
-  this->DynamicMultiThreadingOn();
-}
+::MeanImageFilter() = default;
 
 template< typename TInputImage, typename TOutputImage >
-void
+typename MeanImageFilter< TInputImage, TOutputImage >::OutputPixelType
 MeanImageFilter< TInputImage, TOutputImage >
-::DynamicThreadedGenerateData(const OutputImageRegionType & outputRegionForThread)
+::EvaluateAtNeighborhood(const ConstNeighborhoodIteratorType & it) const
 {
-  unsigned int i;
-
-  ZeroFluxNeumannBoundaryCondition< InputImageType > nbc;
+  const unsigned int neighborhoodSize = it.Size();
 
-  ConstNeighborhoodIterator< InputImageType > bit;
-  ImageRegionIterator< OutputImageType >      it;
-
-  typename OutputImageType::Pointer output = this->GetOutput();
-  typename  InputImageType::ConstPointer input  = this->GetInput();
-
-  // Find the data-set boundary "faces"
-  typename NeighborhoodAlgorithm::ImageBoundaryFacesCalculator< InputImageType >::FaceListType faceList;
-  NeighborhoodAlgorithm::ImageBoundaryFacesCalculator< InputImageType > bC;
-  faceList = bC( input, outputRegionForThread, this->GetRadius() );
-
-  typename NeighborhoodAlgorithm::ImageBoundaryFacesCalculator< InputImageType >::FaceListType::iterator fit;
+  InputRealType sum = NumericTraits< InputRealType >::ZeroValue();
+  for ( unsigned int i = 0; i < neighborhoodSize; ++i )
+    {
+    sum += static_cast< InputRealType >( it.GetPixel(i) );
+    }
 
-  InputRealType sum;
+  // get the mean value
+  return static_cast< OutputPixelType >( sum / double(neighborhoodSize) );
+}
 
-  // Process each of the boundary faces.  These are N-d regions which border
-  // the edge of the buffer.
-  for ( fit = faceList.begin(); fit != faceList.end(); ++fit )
+template< typename TInputImage, typename TOutputImage >
+void
+MeanImageFilter< TInputImage, TOutputImage >
+::EvaluateInteriorScanline(const InputPixelType *input,
+                           OutputPixelType *output,
+                           SizeValueType length,
+                           const OffsetValueType *neighborhoodOffsets,
+                           SizeValueType neighborhoodSize) const
+{
+  for ( SizeValueType i = 0; i < length; ++i )
     {
-    bit = ConstNeighborhoodIterator< InputImageType >(this->GetRadius(),
-                                                      input, *fit);
-    unsigned int neighborhoodSize = bit.Size();
-    it = ImageRegionIterator< OutputImageType >(output, *fit);
-    bit.OverrideBoundaryCondition(&nbc);
-    bit.GoToBegin();
-
-    while ( !bit.IsAtEnd() )
+    InputRealType sum = NumericTraits< InputRealType >::ZeroValue();
+    for ( SizeValueType k = 0; k < neighborhoodSize; ++k )
       {
-      sum = NumericTraits< InputRealType >::ZeroValue();
-      for ( i = 0; i < neighborhoodSize; ++i )
-        {
-        sum += static_cast< InputRealType >( bit.GetPixel(i) );
-        }
-
-      // get the mean value
-      it.Set( static_cast< OutputPixelType >( sum / double(neighborhoodSize) ) );
-
-      ++bit;
-      ++it;
+      sum += static_cast< InputRealType >( input[i + neighborhoodOffsets[k]] );
       }
+
+    output[i] = static_cast< OutputPixelType >( sum / double(neighborhoodSize) );
     }
 }
 } // end namespace itk
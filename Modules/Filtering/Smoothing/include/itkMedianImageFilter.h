@@ -21,6 +21,8 @@
 #include "itkBoxImageFilter.h"
 #include "itkImage.h"
 
+#include <type_traits>
+
 namespace itk
 {
 /** \class MedianImageFilter
@@ -111,6 +113,19 @@ protected:
    *     ImageToImageFilter::GenerateData() */
   void DynamicThreadedGenerateData(const OutputImageRegionType & outputRegionForThread) override;
 
+private:
+  /** Compute a face free of boundary effects with a Huang style moving
+   * histogram. The window histogram is updated incrementally as it
+   * slides along each scanline, so the cost per pixel depends on the
+   * window surface instead of its volume, which is dramatically faster
+   * for large radii. The histogram is a flat array indexed by pixel
+   * value and is therefore only built for integral pixel types of at
+   * most 16 bits; the tag overloads leave every other instantiation,
+   * and images whose pixels are not stored directly in the buffer, on
+   * the nth_element path. Returns false when the face was not handled. */
+  bool FilterWithHistogram(const OutputImageRegionType & faceRegion);
+  bool FilterWithHistogram(const OutputImageRegionType & faceRegion, std::false_type);
+  bool FilterWithHistogram(const OutputImageRegionType & faceRegion, std::true_type);
 };
 } // end namespace itk
 
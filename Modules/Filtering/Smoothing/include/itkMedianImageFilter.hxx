@@ -38,6 +38,187 @@ MedianImageFilter< TInputImage, TOutputImage >
   this->DynamicMultiThreadingOn();
 }
 
+template< typename TInputImage, typename TOutputImage >
+bool
+MedianImageFilter< TInputImage, TOutputImage >
+::FilterWithHistogram(const OutputImageRegionType & faceRegion)
+{
+  return this->FilterWithHistogram( faceRegion,
+    std::integral_constant< bool,
+      std::is_integral< InputPixelType >::value
+      && !std::is_same< InputPixelType, bool >::value
+      && sizeof( InputPixelType ) <= 2
+      && std::is_same< InputPixelType, typename TInputImage::InternalPixelType >::value
+      && std::is_same< OutputPixelType, typename TOutputImage::InternalPixelType >::value >() );
+}
+
+template< typename TInputImage, typename TOutputImage >
+bool
+MedianImageFilter< TInputImage, TOutputImage >
+::FilterWithHistogram(const OutputImageRegionType & itkNotUsed(faceRegion), std::false_type)
+{
+  return false;
+}
+
+template< typename TInputImage, typename TOutputImage >
+bool
+MedianImageFilter< TInputImage, TOutputImage >
+::FilterWithHistogram(const OutputImageRegionType & faceRegion, std::true_type)
+{
+  if ( faceRegion.GetNumberOfPixels() == 0 )
+    {
+    return true;
+    }
+
+  typename OutputImageType::Pointer output = this->GetOutput();
+  typename  InputImageType::ConstPointer input  = this->GetInput();
+
+  const InputPixelType *inputBuffer = input->GetBufferPointer();
+  OutputPixelType *outputBuffer = output->GetBufferPointer();
+
+  const InputSizeType radius = this->GetRadius();
+
+  std::vector< OffsetValueType > inputStride(InputImageDimension);
+  inputStride[0] = 1;
+  for ( unsigned int d = 1; d < InputImageDimension; ++d )
+    {
+    inputStride[d] = inputStride[d - 1]
+                     * static_cast< OffsetValueType >( input->GetBufferedRegion().GetSize(d - 1) );
+    }
+
+  // offsets of the window pixels around a center pixel, and of the
+  // hyperplanes that enter and leave the window as it slides one pixel
+  // along dimension zero
+  std::vector< OffsetValueType > windowOffsets;
+  std::vector< OffsetValueType > enterOffsets;
+  std::vector< OffsetValueType > leaveOffsets;
+  const auto lineRadius = static_cast< OffsetValueType >( radius[0] );
+  std::vector< OffsetValueType > k(InputImageDimension);
+  for ( unsigned int d = 1; d < InputImageDimension; ++d )
+    {
+    k[d] = -static_cast< OffsetValueType >( radius[d] );
+    }
+  for ( ;; )
+    {
+    OffsetValueType rest = 0;
+    for ( unsigned int d = 1; d < InputImageDimension; ++d )
+      {
+      rest += k[d] * inputStride[d];
+      }
+    for ( OffsetValueType dx = -lineRadius; dx <= lineRadius; ++dx )
+      {
+      windowOffsets.push_back(rest + dx);
+      }
+    enterOffsets.push_back(rest + lineRadius);
+    leaveOffsets.push_back(rest - lineRadius - 1);
+    unsigned int d = 1;
+    for ( ; d < InputImageDimension; ++d )
+      {
+      if ( ++k[d] <= static_cast< OffsetValueType >( radius[d] ) )
+        {
+        break;
+        }
+      k[d] = -static_cast< OffsetValueType >( radius[d] );
+      }
+    if ( d >= InputImageDimension )
+      {
+      break;
+      }
+    }
+
+  // a flat histogram of the window contents, with a running count of
+  // the pixels in bins strictly below the current median bin so the
+  // median only has to be stepped a little after each window update
+  const auto minBin = static_cast< OffsetValueType >( NumericTraits< InputPixelType >::NonpositiveMin() );
+  const auto numberOfBins = static_cast< size_t >(
+    static_cast< OffsetValueType >( NumericTraits< InputPixelType >::max() ) - minBin ) + 1;
+  std::vector< SizeValueType > counts(numberOfBins, 0);
+  OffsetValueType medianBin = 0;
+  SizeValueType below = 0;
+
+  const auto addPixel = [&counts, &medianBin, &below, minBin](const InputPixelType & p)
+    {
+    const OffsetValueType bin = static_cast< OffsetValueType >( p ) - minBin;
+    ++counts[bin];
+    if ( bin < medianBin )
+      {
+      ++below;
+      }
+    };
+  const auto removePixel = [&counts, &medianBin, &below, minBin](const InputPixelType & p)
+    {
+    const OffsetValueType bin = static_cast< OffsetValueType >( p ) - minBin;
+    --counts[bin];
+    if ( bin < medianBin )
+      {
+      --below;
+      }
+    };
+  const SizeValueType medianTarget = windowOffsets.size() / 2 + 1;
+  const auto medianValue = [&counts, &medianBin, &below, minBin, medianTarget]()
+    {
+    while ( below >= medianTarget )
+      {
+      --medianBin;
+      below -= counts[medianBin];
+      }
+    while ( below + counts[medianBin] < medianTarget )
+      {
+      below += counts[medianBin];
+      ++medianBin;
+      }
+    return static_cast< InputPixelType >( medianBin + minBin );
+    };
+
+  const auto lineLength = static_cast< OffsetValueType >( faceRegion.GetSize(0) );
+  typename OutputImageRegionType::IndexType index = faceRegion.GetIndex();
+  for ( ;; )
+    {
+    const InputPixelType *in = inputBuffer + input->ComputeOffset(index);
+    OutputPixelType *out = outputBuffer + output->ComputeOffset(index);
+
+    for ( const OffsetValueType off : windowOffsets )
+      {
+      addPixel(in[off]);
+      }
+    out[0] = static_cast< OutputPixelType >( medianValue() );
+    for ( OffsetValueType x = 1; x < lineLength; ++x )
+      {
+      for ( const OffsetValueType off : leaveOffsets )
+        {
+        removePixel(in[x + off]);
+        }
+      for ( const OffsetValueType off : enterOffsets )
+        {
+        addPixel(in[x + off]);
+        }
+      out[x] = static_cast< OutputPixelType >( medianValue() );
+      }
+    // drain the last window so the histogram is empty for the next
+    // scanline, which is much cheaper than clearing all the bins
+    for ( const OffsetValueType off : windowOffsets )
+      {
+      removePixel(in[lineLength - 1 + off]);
+      }
+
+    unsigned int d = 1;
+    for ( ; d < InputImageDimension; ++d )
+      {
+      if ( ++index[d] < faceRegion.GetIndex(d)
+                        + static_cast< OffsetValueType >( faceRegion.GetSize(d) ) )
+        {
+        break;
+        }
+      index[d] = faceRegion.GetIndex(d);
+      }
+    if ( d >= InputImageDimension )
+      {
+      break;
+      }
+    }
+  return true;
+}
+
 template< typename TInputImage, typename TOutputImage >
 void
 MedianImageFilter< TInputImage, TOutputImage >
@@ -62,6 +243,13 @@ MedianImageFilter< TInputImage, TOutputImage >
   // the edge of the buffer.
   for ( auto fit = faceList.begin(); fit != faceList.end(); ++fit )
     {
+    // the first face never invokes the boundary condition, so the
+    // moving histogram can slide through it with raw pointers
+    if ( fit == faceList.begin() && this->FilterWithHistogram(*fit) )
+      {
+      continue;
+      }
+
     ImageRegionIterator< OutputImageType > it = ImageRegionIterator< OutputImageType >(output, *fit);
 
     ConstNeighborhoodIterator< InputImageType > bit =
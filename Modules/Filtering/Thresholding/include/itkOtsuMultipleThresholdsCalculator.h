@@ -111,6 +111,17 @@ protected:
                            FrequencyVectorType & classFrequency);
 
 private:
+  /** Find the threshold indexes by exhaustive enumeration of all threshold
+   * combinations.  Needed for the valley emphasis criterion, whose weight
+   * depends on the selected threshold bins themselves and therefore is not
+   * additive over classes. */
+  void ComputeThresholdsByExhaustiveSearch(InstanceIdentifierVectorType & maxVarThresholdIndexes);
+
+  /** Find the threshold indexes by dynamic programming over cumulative
+   * moment tables of the histogram, which maximizes the same criterion in
+   * O(number of bins^2 x number of classes) with the inner scans
+   * parallelized over threshold positions. */
+  void ComputeThresholdsByCumulativeMoments(InstanceIdentifierVectorType & maxVarThresholdIndexes);
 
   SizeValueType m_NumberOfThresholds{ 1 };
   OutputType    m_Output;
@@ -19,6 +19,7 @@
 #define itkOtsuMultipleThresholdsCalculator_hxx
 
 #include "itkMath.h"
+#include "itkMultiThreaderBase.h"
 #include "itkOtsuMultipleThresholdsCalculator.h"
 
 namespace itk
@@ -151,6 +152,43 @@ OtsuMultipleThresholdsCalculator< TInputHistogram >
     itkExceptionMacro(<< "Histogram must be 1-dimensional.");
     }
 
+  InstanceIdentifierVectorType maxVarThresholdIndexes(m_NumberOfThresholds);
+
+  if ( m_ValleyEmphasis )
+    {
+    // The valley emphasis weight depends on the probability at the selected
+    // threshold bins themselves, so the criterion is not additive over
+    // classes and the full combination search is retained for it.
+    this->ComputeThresholdsByExhaustiveSearch(maxVarThresholdIndexes);
+    }
+  else
+    {
+    this->ComputeThresholdsByCumulativeMoments(maxVarThresholdIndexes);
+    }
+
+  // Copy corresponding bin max to threshold vector
+  m_Output.resize(m_NumberOfThresholds);
+
+  for ( SizeValueType j = 0; j < m_NumberOfThresholds; j++ )
+    {
+    if (m_ReturnBinMidpoint)
+      {
+      m_Output[j] = histogram->GetMeasurement(maxVarThresholdIndexes[j],0);
+      }
+    else
+      {
+      m_Output[j] = histogram->GetMaxs()[0][maxVarThresholdIndexes[j]];
+      }
+    }
+}
+
+template< typename TInputHistogram >
+void
+OtsuMultipleThresholdsCalculator< TInputHistogram >
+::ComputeThresholdsByExhaustiveSearch(InstanceIdentifierVectorType & maxVarThresholdIndexes)
+{
+  typename TInputHistogram::ConstPointer histogram = this->GetInputHistogram();
+
   // Compute global mean
   typename TInputHistogram::ConstIterator iter = histogram->Begin();
   typename TInputHistogram::ConstIterator end = histogram->End();
@@ -176,7 +214,7 @@ OtsuMultipleThresholdsCalculator< TInputHistogram >
     thresholdIndexes[j] = j;
     }
 
-  InstanceIdentifierVectorType maxVarThresholdIndexes = thresholdIndexes;
+  maxVarThresholdIndexes = thresholdIndexes;
 
   // Compute frequency and mean of initial classes
   FrequencyType       freqSum = NumericTraits< FrequencyType >::ZeroValue();
@@ -319,20 +357,107 @@ OtsuMultipleThresholdsCalculator< TInputHistogram >
       maxVarThresholdIndexes = thresholdIndexes;
       }
     }
+}
 
-  // Copy corresponding bin max to threshold vector
-  m_Output.resize(m_NumberOfThresholds);
+template< typename TInputHistogram >
+void
+OtsuMultipleThresholdsCalculator< TInputHistogram >
+::ComputeThresholdsByCumulativeMoments(InstanceIdentifierVectorType & maxVarThresholdIndexes)
+{
+  typename TInputHistogram::ConstPointer histogram = this->GetInputHistogram();
 
-  for ( j = 0; j < m_NumberOfThresholds; j++ )
+  const SizeValueType numberOfBins = histogram->GetSize()[0];
+  const SizeValueType numberOfClasses = m_NumberOfThresholds + 1;
+
+  if ( numberOfBins < numberOfClasses )
     {
-    if (m_ReturnBinMidpoint)
-      {
-      m_Output[j] = histogram->GetMeasurement(maxVarThresholdIndexes[j],0);
-      }
-    else
-      {
-      m_Output[j] = histogram->GetMaxs()[0][maxVarThresholdIndexes[j]];
-      }
+    itkExceptionMacro(<< "The histogram must have at least one bin per class.");
+    }
+
+  // Cumulative zeroth and first order moments of the histogram.  The
+  // weighted squared mean contribution of a class covering the bins
+  // (t, b], i.e. omega * mu^2, is then available in constant time as
+  // ( S[b+1] - S[t+1] )^2 / ( W[b+1] - W[t+1] ).
+  std::vector< VarianceType > W(numberOfBins + 1, NumericTraits< VarianceType >::ZeroValue());
+  std::vector< VarianceType > S(numberOfBins + 1, NumericTraits< VarianceType >::ZeroValue());
+  SizeValueType i;
+  for ( i = 0; i < numberOfBins; i++ )
+    {
+    const auto frequency = static_cast< VarianceType >( histogram->GetFrequency(i) );
+    W[i + 1] = W[i] + frequency;
+    S[i + 1] = S[i] + frequency
+               * static_cast< VarianceType >( histogram->GetMeasurementVector(i)[0] );
+    }
+
+  // previousBestValue[b] holds the largest achievable sum of class
+  // contributions when the bins [0, b] are split into the number of classes
+  // handled so far, each class covering at least one bin.
+  // bestLastThreshold[k][b] records the argmax split point for backtracking
+  // the threshold indexes.
+  std::vector< VarianceType > previousBestValue(numberOfBins, NumericTraits< VarianceType >::ZeroValue());
+  std::vector< VarianceType > currentBestValue(numberOfBins, NumericTraits< VarianceType >::ZeroValue());
+  std::vector< InstanceIdentifierVectorType > bestLastThreshold(numberOfClasses + 1);
+
+  for ( i = 0; i < numberOfBins; i++ )
+    {
+    previousBestValue[i] = ( W[i + 1] > 0.0 ) ? S[i + 1] * S[i + 1] / W[i + 1] : 0.0;
+    }
+
+  MultiThreaderBase::Pointer threader = MultiThreaderBase::New();
+
+  for ( SizeValueType k = 2; k <= numberOfClasses; k++ )
+    {
+    // A valid upper bin b of class k leaves at least one bin for each of
+    // the k-1 leading classes and each of the trailing classes.  For the
+    // last class only the final bin needs to be evaluated.
+    const SizeValueType lastBin = numberOfBins - 1 - ( numberOfClasses - k );
+    const SizeValueType beginBin = ( k == numberOfClasses ) ? lastBin : k - 1;
+
+    bestLastThreshold[k].resize(numberOfBins);
+
+    const VarianceType * previous = previousBestValue.data();
+    VarianceType * current = currentBestValue.data();
+    const VarianceType * cumulativeFrequency = W.data();
+    const VarianceType * cumulativeMoment = S.data();
+    InstanceIdentifierType * lastThreshold = bestLastThreshold[k].data();
+
+    threader->ParallelizeArray( beginBin, lastBin + 1,
+      [k, previous, current, cumulativeFrequency, cumulativeMoment, lastThreshold](SizeValueType b)
+        {
+        VarianceType bestValue = NumericTraits< VarianceType >::NonpositiveMin();
+        SizeValueType bestThreshold = k - 2;
+        for ( SizeValueType t = k - 2; t < b; t++ )
+          {
+          const VarianceType w = cumulativeFrequency[b + 1] - cumulativeFrequency[t + 1];
+          const VarianceType s = cumulativeMoment[b + 1] - cumulativeMoment[t + 1];
+          VarianceType value = previous[t];
+          if ( w > 0.0 )
+            {
+            value += s * s / w;
+            }
+          // Strict comparison keeps the smallest split point among ties,
+          // matching the configuration the exhaustive search would retain.
+          if ( value > bestValue )
+            {
+            bestValue = value;
+            bestThreshold = t;
+            }
+          }
+        current[b] = bestValue;
+        lastThreshold[b] = bestThreshold;
+        },
+      nullptr );
+
+    previousBestValue.swap(currentBestValue);
+    }
+
+  // Backtrack the argmax split points to recover the threshold indexes.
+  SizeValueType b = numberOfBins - 1;
+  for ( SizeValueType k = numberOfClasses; k >= 2; k-- )
+    {
+    const SizeValueType t = bestLastThreshold[k][b];
+    maxVarThresholdIndexes[k - 2] = t;
+    b = t;
     }
 }
 
@@ -21,7 +21,7 @@
 #include "itkImageToImageFilter.h"
 #include "itkFixedArray.h"
 #include "itkOtsuMultipleThresholdsCalculator.h"
-#include "itkScalarImageToHistogramGenerator.h"
+#include "itkImageToHistogramFilter.h"
 
 namespace itk
 {
@@ -45,7 +45,7 @@ namespace itk
  * To use this algorithm, simple call the setter: SetValleyEmphasis(true)
  * It is turned off by default.
  *
- * \sa ScalarImageToHistogramGenerator
+ * \sa ImageToHistogramFilter
  * \sa OtsuMultipleThresholdsCalculator
  * \sa ThresholdLabelerImageFilter
  * \ingroup IntensityImageFilters  MultiThreaded
@@ -87,7 +87,7 @@ public:
   using OutputImageRegionType = typename TOutputImage::RegionType;
 
   /** Threshold vector types. */
-  using HistogramGeneratorType = itk::Statistics::ScalarImageToHistogramGenerator< TInputImage >;
+  using HistogramGeneratorType = itk::Statistics::ImageToHistogramFilter< TInputImage >;
   using HistogramType = typename HistogramGeneratorType::HistogramType;
   using OtsuCalculatorType = OtsuMultipleThresholdsCalculator< HistogramType >;
   using ThresholdVectorType = typename OtsuCalculatorType::OutputType;
@@ -42,11 +42,16 @@ OtsuMultipleThresholdsImageFilter< TInputImage, TOutputImage >
   typename ProgressAccumulator::Pointer progress = ProgressAccumulator::New();
   progress->SetMiniPipelineFilter(this);
 
-  // Create a histogram of the image intensities
+  // Create a histogram of the image intensities using the multithreaded
+  // histogram filter.
   typename HistogramGeneratorType::Pointer histogramGenerator = HistogramGeneratorType::New();
   histogramGenerator->SetInput( this->GetInput() );
-  histogramGenerator->SetNumberOfBins(m_NumberOfHistogramBins);
-  histogramGenerator->Compute();
+  typename HistogramGeneratorType::HistogramSizeType hsize(1);
+  hsize[0] = m_NumberOfHistogramBins;
+  histogramGenerator->SetHistogramSize(hsize);
+  histogramGenerator->SetAutoMinimumMaximum(true);
+  progress->RegisterInternalFilter(histogramGenerator, .5f);
+  histogramGenerator->Update();
 
   // Compute the multiple Otsu Thresholds for the input image
   typename OtsuCalculatorType::Pointer otsuHistogramThresholdCalculator = OtsuCalculatorType::New();
@@ -61,7 +66,7 @@ OtsuMultipleThresholdsImageFilter< TInputImage, TOutputImage >
   typename ThresholdLabelerImageFilter< TInputImage, TOutputImage >::Pointer threshold =
     ThresholdLabelerImageFilter< TInputImage, TOutputImage >::New();
 
-  progress->RegisterInternalFilter(threshold, 1.0f);
+  progress->RegisterInternalFilter(threshold, .5f);
   threshold->GraftOutput ( this->GetOutput() );
   threshold->SetInput ( this->GetInput() );
   threshold->SetRealThresholds(m_Thresholds);
@@ -127,6 +127,14 @@ protected:
 
 private:
 
+  /** Fast path of Parse() for floating point data without string
+  * delimiters. The whole file is read into one buffer, split at line
+  * boundaries and converted block-wise on the global thread pool,
+  * writing straight into the Array2D object. Returns false when the
+  * preconditions do not hold, in which case the field by field path
+  * has to run instead. */
+  bool ParseInParallel();
+
   Array2DDataObjectPointer   m_Array2DDataObject;
 
 };
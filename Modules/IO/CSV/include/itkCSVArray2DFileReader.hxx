@@ -19,9 +19,17 @@
 #define itkCSVArray2DFileReader_hxx
 
 #include "itkCSVArray2DFileReader.h"
+#include "itkThreadPool.h"
 
 #include "itksys/SystemTools.hxx"
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <future>
 #include <limits>
+#include <type_traits>
+#include <vector>
 
 namespace itk
 {
@@ -52,6 +60,14 @@ CSVArray2DFileReader <TData>
 
   this->PrepareForParsing();
 
+  // The common numeric case is handled block-parallel from a single
+  // buffer; anything it cannot represent falls through to the
+  // field by field path below.
+  if ( this->ParseInParallel() )
+    {
+    return;
+    }
+
   this->m_InputStream.clear();
   this->m_InputStream.open(this->m_FileName.c_str());
   if ( this->m_InputStream.fail() )
@@ -129,6 +145,265 @@ CSVArray2DFileReader <TData>
   this->m_InputStream.close();
 }
 
+template <typename TData>
+bool
+CSVArray2DFileReader<TData>
+::ParseInParallel()
+{
+  /** The numeric fields are converted with strtod, so only floating
+   *  point types keep the exact semantics of ConvertStringToValueType
+   *  (an unparsable field becomes NaN). Quoted headers still need the
+   *  stateful string delimiter handling of GetNextField(). */
+  if ( !std::is_floating_point<TData>::value
+       || this->m_UseStringDelimiterCharacter )
+    {
+    return false;
+    }
+
+  std::ifstream inputStream(this->m_FileName.c_str(),
+                            std::ios::in | std::ios::binary);
+  if ( inputStream.fail() )
+    {
+    itkExceptionMacro(
+      "The file " << this->m_FileName <<" cannot be opened for reading!"
+      << std::endl
+      << "Reason: "
+      << itksys::SystemTools::GetLastSystemError() );
+    }
+
+  inputStream.seekg(0,std::ios::end);
+  const auto fileLength = static_cast<SizeValueType>( inputStream.tellg() );
+  inputStream.seekg(0);
+  std::string fileBuffer(fileLength,'\0');
+  if ( fileLength > 0 )
+    {
+    inputStream.read(&fileBuffer[0],
+                     static_cast<std::streamsize>( fileLength ));
+    }
+  inputStream.close();
+
+  const char fieldDelimiter = this->m_FieldDelimiterCharacter;
+
+  // Locate the lines and count their fields in one scan.
+  std::vector<SizeValueType> lineOffsets;
+  std::vector<SizeValueType> lineSizes;
+  std::vector<SizeValueType> fieldCounts;
+  SizeValueType scanPosition = 0;
+  while ( scanPosition < fileLength )
+    {
+    std::string::size_type endOfLine = fileBuffer.find('\n',scanPosition);
+    if ( endOfLine == std::string::npos )
+      {
+      endOfLine = fileLength;
+      }
+    SizeValueType lineSize = static_cast<SizeValueType>( endOfLine ) - scanPosition;
+    if ( lineSize > 0 && fileBuffer[scanPosition + lineSize - 1] == '\r' )
+      {
+      lineSize--;
+      }
+    lineOffsets.push_back(scanPosition);
+    lineSizes.push_back(lineSize);
+    if ( lineSize == 0 )
+      {
+      fieldCounts.push_back(0);
+      }
+    else
+      {
+      fieldCounts.push_back(1 + static_cast<SizeValueType>(
+        std::count(fileBuffer.begin() + scanPosition,
+                   fileBuffer.begin() + scanPosition + lineSize,
+                   fieldDelimiter) ));
+      }
+    scanPosition = static_cast<SizeValueType>( endOfLine ) + 1;
+    }
+
+  // Determine the matrix size the same way GetDataDimension() does:
+  // the maximum number of data fields on any line, warning when the
+  // lines disagree.
+  SizeValueType firstDataLine = 0;
+  SizeValueType previousColumns = 0;
+  SizeValueType maxColumns = 0;
+  bool isSame = true;
+  if ( this->m_HasColumnHeaders && !lineOffsets.empty() )
+    {
+    firstDataLine = 1;
+    previousColumns = fieldCounts[0];
+    if ( this->m_HasRowHeaders && previousColumns > 0 )
+      {
+      previousColumns--;
+      }
+    maxColumns = previousColumns;
+    }
+  const SizeValueType rows =
+    static_cast<SizeValueType>( lineOffsets.size() ) - firstDataLine;
+  for (SizeValueType i = 0; i < rows; i++)
+    {
+    SizeValueType currentColumns = fieldCounts[firstDataLine + i];
+    if ( this->m_HasRowHeaders && currentColumns > 0 )
+      {
+      currentColumns--;
+      }
+    if ( !this->m_HasColumnHeaders && i == 0 )
+      {
+      previousColumns = currentColumns;
+      maxColumns = currentColumns;
+      }
+    if ( currentColumns != previousColumns )
+      {
+      isSame = false;
+      if ( currentColumns > maxColumns )
+        {
+        maxColumns = currentColumns;
+        }
+      previousColumns = currentColumns;
+      }
+    }
+  if ( !isSame )
+    {
+    itkWarningMacro( << "Warning: Data appears to contain missing data! "
+                     << "These will be set to NaN." );
+    }
+  const SizeValueType columns = maxColumns;
+
+  this->m_Array2DDataObject->SetMatrixSize(rows,columns);
+
+  /** initialize the matrix to NaN so that missing data will automatically be
+   *  set to this value. */
+  this->m_Array2DDataObject->FillMatrix(std::numeric_limits<TData>::quiet_NaN());
+
+  // The column headers are few; split them serially.
+  if ( this->m_HasColumnHeaders )
+    {
+    this->m_Array2DDataObject->HasColumnHeadersOn();
+    if ( !lineOffsets.empty() )
+      {
+      const char *cursor = fileBuffer.data() + lineOffsets[0];
+      const char *endOfLine = cursor + lineSizes[0];
+      while ( cursor <= endOfLine )
+        {
+        const char *endOfField = static_cast<const char *>(
+          memchr(cursor,fieldDelimiter,endOfLine - cursor) );
+        if ( endOfField == nullptr )
+          {
+          endOfField = endOfLine;
+          }
+        this->m_Array2DDataObject->ColumnHeadersPushBack(
+          std::string(cursor,endOfField) );
+        if ( endOfField == endOfLine )
+          {
+          break;
+          }
+        cursor = endOfField + 1;
+        }
+      }
+    if ( this->m_HasRowHeaders )
+      {
+      this->m_Array2DDataObject->EraseFirstColumnHeader();
+      }
+    }
+
+  // Convert blocks of lines concurrently, each thread writing into its
+  // own rows of the matrix. Row headers land in a presized vector so
+  // they can be pushed in order afterwards.
+  std::vector<std::string> rowHeaders;
+  const bool hasRowHeaders = this->m_HasRowHeaders;
+  if ( hasRowHeaders )
+    {
+    this->m_Array2DDataObject->HasRowHeadersOn();
+    rowHeaders.resize(rows);
+    }
+
+  if ( rows > 0 && ( columns > 0 || hasRowHeaders ) )
+    {
+    Array2DDataObjectType *array = this->m_Array2DDataObject.GetPointer();
+    const char *bufferStart = fileBuffer.data();
+    const SizeValueType numberOfBlocks =
+      std::min( rows, static_cast<SizeValueType>(
+                  ThreadPool::GetGlobalDefaultNumberOfThreads() ) );
+    const SizeValueType rowsPerBlock = ( rows + numberOfBlocks - 1 ) / numberOfBlocks;
+
+    ThreadPool *threadPool = ThreadPool::GetInstance();
+    std::vector< std::future< void > > conversions;
+    conversions.reserve(numberOfBlocks);
+    for (SizeValueType block = 0; block < numberOfBlocks; block++)
+      {
+      const SizeValueType firstRow = block * rowsPerBlock;
+      const SizeValueType lastRow = std::min(firstRow + rowsPerBlock, rows);
+      conversions.push_back( threadPool->AddWork(
+        [firstRow, lastRow, firstDataLine, columns, hasRowHeaders,
+         fieldDelimiter, bufferStart, array, &lineOffsets, &lineSizes,
+         &rowHeaders]
+          {
+          for (SizeValueType row = firstRow; row < lastRow; row++)
+            {
+            const char *cursor = bufferStart + lineOffsets[firstDataLine + row];
+            const char *endOfLine = cursor + lineSizes[firstDataLine + row];
+            if ( hasRowHeaders )
+              {
+              const char *endOfField = static_cast<const char *>(
+                memchr(cursor,fieldDelimiter,endOfLine - cursor) );
+              if ( endOfField == nullptr )
+                {
+                endOfField = endOfLine;
+                }
+              rowHeaders[row].assign(cursor,endOfField);
+              if ( endOfField == endOfLine )
+                {
+                continue;
+                }
+              cursor = endOfField + 1;
+              }
+            for (SizeValueType col = 0; col < columns; col++)
+              {
+              const char *endOfField = static_cast<const char *>(
+                memchr(cursor,fieldDelimiter,endOfLine - cursor) );
+              if ( endOfField == nullptr )
+                {
+                endOfField = endOfLine;
+                }
+              // strtod stops on the delimiter; a conversion that would
+              // run past the field (possibly across the newline into
+              // the next one) or leave non-blank characters behind is
+              // missing data and keeps the NaN fill.
+              char *endOfNumber = nullptr;
+              const double value = std::strtod(cursor,&endOfNumber);
+              bool valid = ( endOfNumber != cursor && endOfNumber <= endOfField );
+              const char *rest = endOfNumber;
+              while ( valid && rest < endOfField )
+                {
+                if ( !std::isspace(static_cast<unsigned char>( *rest )) )
+                  {
+                  valid = false;
+                  }
+                ++rest;
+                }
+              if ( valid )
+                {
+                array->SetMatrixData(row,col,static_cast<TData>( value ));
+                }
+              if ( endOfField == endOfLine )
+                {
+                break;
+                }
+              cursor = endOfField + 1;
+              }
+            }
+          } ) );
+      }
+    for (auto & conversion : conversions)
+      {
+      conversion.get();
+      }
+    }
+
+  for (SizeValueType row = 0; row < static_cast<SizeValueType>( rowHeaders.size() ); row++)
+    {
+    this->m_Array2DDataObject->RowHeadersPushBack(rowHeaders[row]);
+    }
+
+  return true;
+}
+
 /** Update method */
 template<typename TData>
 void
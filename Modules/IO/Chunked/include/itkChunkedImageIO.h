@@ -0,0 +1,167 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkChunkedImageIO_h
+#define itkChunkedImageIO_h
+#include "ITKIOChunkedExport.h"
+
+#include "itkStreamingImageIOBase.h"
+#include <string>
+#include <vector>
+
+namespace itk
+{
+/** \class ChunkedImageIO
+ *
+ * \brief Class that defines how to read and write images stored as a
+ * directory of compressed, fixed-size chunks.
+ *
+ * An image with the ".chunked" extension is a directory, not a file:
+ * \li \c header            text file holding one "key = value" line per
+ *                          item: dimensions, chunk shape, origin,
+ *                          spacing, direction cosines, pixel and
+ *                          component type, byte order and compression
+ * \li \c chunk_i_j_k       one file per chunk of the image, named by
+ *                          the chunk's grid coordinates with the
+ *                          fastest moving dimension first
+ *
+ * Every chunk covers a fixed-size block of the image; chunks on the
+ * high edges are zero padded to full size, and a missing chunk file
+ * reads as zeros, so sparse volumes need not store empty blocks. Each
+ * chunk is deflated (zlib) independently, so chunks are fetched and
+ * compressed concurrently on the thread pool, and the format suits
+ * volumes far larger than memory: streamed read regions are expanded
+ * to chunk boundaries, and streamed or pasted writes touch only the
+ * chunk files intersecting the I/O region. A chunk only partially
+ * covered by a write is read, merged and rewritten, so stream
+ * divisions that match the chunk grid map one to one onto chunk
+ * files.
+ *
+ * \ingroup IOFilters
+ * \ingroup ITKIOChunked
+ */
+class ITKIOChunked_EXPORT ChunkedImageIO: public StreamingImageIOBase
+{
+public:
+  ITK_DISALLOW_COPY_AND_ASSIGN(ChunkedImageIO);
+
+  /** Standard class type aliases. */
+  using Self = ChunkedImageIO;
+  using Superclass = StreamingImageIOBase;
+  using Pointer = SmartPointer< Self >;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(ChunkedImageIO, StreamingImageIOBase);
+
+  /*-------- This part of the interfaces deals with reading data. ----- */
+
+  /** Determine if the file can be read with this ImageIO implementation.
+   * \param FileNameToRead The name of the file to test for reading.
+   * \return Returns true when the name refers to a chunk directory.
+   */
+  bool CanReadFile(const char *FileNameToRead) override;
+
+  /** Set the spacing and dimension information for the set filename. */
+  void ReadImageInformation() override;
+
+  /** Reads the data from disk into the memory buffer provided. Only the
+   * chunks intersecting the IORegion are fetched and inflated, spread
+   * across the thread pool. */
+  void Read(void *buffer) override;
+
+  /*-------- This part of the interfaces deals with writing data. ----- */
+
+  /** Determine if the file can be written with this ImageIO implementation.
+   * \param FileNameToWrite The name of the file to test for writing.
+   * \return Returns true if this ImageIO can write the file specified.
+   */
+  bool CanWriteFile(const char *FileNameToWrite) override;
+
+  /** Create the chunk directory and write the header file. */
+  void WriteImageInformation() override;
+
+  /** Writes the data to disk from the memory buffer provided. Only the
+   * chunk files intersecting the IORegion are written; chunks the
+   * region covers partially are read, merged and rewritten. */
+  void Write(const void *buffer) override;
+
+  /** Set/Get the chunk shape, fastest moving dimension first. An empty
+   * vector (the default) chunks by (N-1)-dimensional slabs, matching
+   * the divisions the streaming region splitter produces. After
+   * ReadImageInformation() this holds the chunk shape of the open
+   * image. */
+  void SetChunkDimensions(const std::vector< SizeValueType > & chunkDimensions);
+  const std::vector< SizeValueType > & GetChunkDimensions() const;
+
+  /** Returns the requested region expanded to chunk boundaries, so
+   * every chunk intersecting the requested region is fetched and
+   * inflated exactly once while streaming. */
+  ImageIORegion
+  GenerateStreamableReadRegionFromRequestedRegion(const ImageIORegion & requestedRegion) const override;
+
+  /** see super class for documentation. Overridden because the name
+   * names a directory, which the superclass cannot remove when a
+   * streamed write replaces an existing image. */
+  unsigned int GetActualNumberOfSplitsForWriting(unsigned int numberOfRequestedSplits,
+                                                 const ImageIORegion & pasteRegion,
+                                                 const ImageIORegion & largestPossibleRegion) override;
+
+protected:
+  ChunkedImageIO();
+  ~ChunkedImageIO() override;
+
+  SizeType GetHeaderSize() const override;
+
+  void PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  /** The name of a chunk file inside the chunk directory, built from
+   * the chunk's grid coordinates. */
+  std::string ChunkFileName(const std::vector< SizeValueType > & chunkGridIndex) const;
+
+  /** The grid coordinates of every chunk intersecting the region. */
+  std::vector< std::vector< SizeValueType > >
+  ComputeIntersectingChunks(const ImageIORegion & region) const;
+
+  /** Fetch, inflate and scatter chunks [first,last) of the list into
+   * the region's buffer. Runs concurrently on the thread pool, one
+   * range per worker; chunk files are independent. */
+  void ReadChunkRange(const std::vector< std::vector< SizeValueType > > & chunks,
+                      size_t first, size_t last,
+                      void *buffer, const ImageIORegion & regionToRead);
+
+  /** Gather, deflate and write chunks [first,last) of the list from
+   * the region's buffer; chunks the region covers partially are read
+   * and merged first. */
+  void WriteChunkRange(const std::vector< std::vector< SizeValueType > > & chunks,
+                       size_t first, size_t last,
+                       const void *buffer, const ImageIORegion & regionToWrite);
+
+  /** Swap an inflated chunk to the system byte order when the image
+   * was written on a machine with the other endianness. */
+  void SwapBytesIfNecessary(void *buffer, SizeValueType numberOfPixels);
+
+  std::vector< SizeValueType > m_ChunkDimensions;
+
+  bool m_ImageInformationWritten{false};
+};
+} // end namespace itk
+
+#endif // itkChunkedImageIO_h
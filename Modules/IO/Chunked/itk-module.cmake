@@ -0,0 +1,18 @@
+set(DOCUMENTATION "This module contains an ImageIO class for reading and writing
+ITK Images stored as a directory of compressed, fixed-size chunks. Every
+chunk is an independent file, so streamed reads and writes map one to one
+onto chunk files, and chunks are fetched and compressed concurrently.")
+
+itk_module(ITKIOChunked
+  ENABLE_SHARED
+  DEPENDS
+    ITKIOImageBase
+  PRIVATE_DEPENDS
+    ITKZLIB
+  TEST_DEPENDS
+    ITKTestKernel
+  FACTORY_NAMES
+    ImageIO::Chunked
+  DESCRIPTION
+    "${DOCUMENTATION}"
+)
@@ -0,0 +1,967 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkChunkedImageIO.h"
+#include "itkByteSwapper.h"
+#include "itkMultiThreaderBase.h"
+#include "itkThreadPool.h"
+#include "itksys/SystemTools.hxx"
+#include "itk_zlib.h"
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <future>
+#include <map>
+#include <sstream>
+
+namespace itk
+{
+
+namespace
+{
+const char *const HeaderFileName = "header";
+const int ChunkedImageVersion = 1;
+
+std::string
+Trim(const std::string & s)
+{
+  const std::string::size_type first = s.find_first_not_of(" \t\r\n");
+  if ( first == std::string::npos )
+    {
+    return std::string();
+    }
+  const std::string::size_type last = s.find_last_not_of(" \t\r\n");
+  return s.substr(first, last - first + 1);
+}
+
+std::string
+RequireValue(const std::map< std::string, std::string > & header,
+             const std::string & key)
+{
+  auto it = header.find(key);
+  if ( it == header.end() )
+    {
+    itkGenericExceptionMacro(<< "Missing \"" << key
+                             << "\" in chunked image header");
+    }
+  return it->second;
+}
+
+template <typename TValue>
+std::vector< TValue >
+ParseValues(const std::string & valueString)
+{
+  std::vector< TValue > values;
+  std::istringstream iss(valueString);
+  TValue value;
+  while ( iss >> value )
+    {
+    values.push_back(value);
+    }
+  return values;
+}
+
+template <typename TComponent>
+void
+SwapRange(void *buffer,
+          ImageIOBase::SizeValueType count,
+          ImageIOBase::ByteOrder byteOrder)
+{
+  if ( byteOrder == ImageIOBase::LittleEndian )
+    {
+    ByteSwapper< TComponent >::SwapRangeFromSystemToLittleEndian(
+      static_cast< TComponent * >( buffer ), count);
+    }
+  else if ( byteOrder == ImageIOBase::BigEndian )
+    {
+    ByteSwapper< TComponent >::SwapRangeFromSystemToBigEndian(
+      static_cast< TComponent * >( buffer ), count);
+    }
+}
+
+// Copy the intersection of a chunk with an I/O region between the
+// chunk's buffer and the region's buffer. Both buffers are laid out
+// fastest moving dimension first, so runs along dimension 0 are
+// contiguous in both.
+void
+CopyChunkRegion(char *regionBuffer,
+                const ImageIORegion & region,
+                char *chunkBuffer,
+                const std::vector< ImageIORegion::IndexValueType > & chunkOrigin,
+                const std::vector< ImageIOBase::SizeValueType > & chunkDims,
+                size_t pixelBytes,
+                bool intoRegion)
+{
+  const unsigned int nDims = region.GetImageDimension();
+  std::vector< ImageIORegion::IndexValueType > begin(nDims);
+  std::vector< ImageIORegion::IndexValueType > end(nDims);
+  for ( unsigned int d = 0; d < nDims; d++ )
+    {
+    begin[d] = std::max(region.GetIndex(d), chunkOrigin[d]);
+    end[d] = std::min< ImageIORegion::IndexValueType >(
+      region.GetIndex(d) + region.GetSize(d),
+      chunkOrigin[d] + chunkDims[d]);
+    if ( end[d] <= begin[d] )
+      {
+      return;
+      }
+    }
+  // pixel strides, fastest moving dimension first
+  std::vector< size_t > regionStride(nDims);
+  std::vector< size_t > chunkStride(nDims);
+  regionStride[0] = 1;
+  chunkStride[0] = 1;
+  for ( unsigned int d = 1; d < nDims; d++ )
+    {
+    regionStride[d] = regionStride[d - 1] * region.GetSize(d - 1);
+    chunkStride[d] = chunkStride[d - 1] * chunkDims[d - 1];
+    }
+  const size_t runBytes = ( end[0] - begin[0] ) * pixelBytes;
+  std::vector< ImageIORegion::IndexValueType > pos(begin);
+  for ( ;; )
+    {
+    size_t regionPixel = begin[0] - region.GetIndex(0);
+    size_t chunkPixel = begin[0] - chunkOrigin[0];
+    for ( unsigned int d = 1; d < nDims; d++ )
+      {
+      regionPixel += ( pos[d] - region.GetIndex(d) ) * regionStride[d];
+      chunkPixel += ( pos[d] - chunkOrigin[d] ) * chunkStride[d];
+      }
+    if ( intoRegion )
+      {
+      memcpy(regionBuffer + regionPixel * pixelBytes,
+             chunkBuffer + chunkPixel * pixelBytes,
+             runBytes);
+      }
+    else
+      {
+      memcpy(chunkBuffer + chunkPixel * pixelBytes,
+             regionBuffer + regionPixel * pixelBytes,
+             runBytes);
+      }
+    unsigned int d = 1;
+    for ( ; d < nDims; d++ )
+      {
+      if ( ++pos[d] < end[d] )
+        {
+        break;
+        }
+      pos[d] = begin[d];
+      }
+    if ( d >= nDims )
+      {
+      break;
+      }
+    }
+}
+
+} // end anonymous namespace
+
+ChunkedImageIO::ChunkedImageIO()
+{
+  this->AddSupportedWriteExtension(".chunked");
+  this->AddSupportedReadExtension(".chunked");
+  // chunks are stored in the byte order of the writing machine;
+  // readers on the other endianness swap after inflating
+  if ( ByteSwapper< int >::SystemIsBigEndian() )
+    {
+    this->SetByteOrderToBigEndian();
+    }
+  else
+    {
+    this->SetByteOrderToLittleEndian();
+    }
+  // the point of a chunk store is compressed chunks
+  this->SetUseCompression(true);
+}
+
+ChunkedImageIO::~ChunkedImageIO() = default;
+
+void
+ChunkedImageIO
+::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+  os << indent << "ChunkDimensions: ";
+  for ( auto dim : this->m_ChunkDimensions )
+    {
+    os << dim << " ";
+    }
+  os << std::endl;
+}
+
+void
+ChunkedImageIO
+::SetChunkDimensions(const std::vector< SizeValueType > & chunkDimensions)
+{
+  if ( chunkDimensions != this->m_ChunkDimensions )
+    {
+    this->m_ChunkDimensions = chunkDimensions;
+    this->Modified();
+    }
+}
+
+const std::vector< ImageIOBase::SizeValueType > &
+ChunkedImageIO
+::GetChunkDimensions() const
+{
+  return this->m_ChunkDimensions;
+}
+
+bool
+ChunkedImageIO
+::CanReadFile(const char *FileNameToRead)
+{
+  // a chunked image is a directory holding a header file
+  if ( !itksys::SystemTools::FileIsDirectory(FileNameToRead) )
+    {
+    return false;
+    }
+  std::string headerName(FileNameToRead);
+  headerName += "/";
+  headerName += HeaderFileName;
+  return itksys::SystemTools::FileExists( headerName.c_str(), true );
+}
+
+bool
+ChunkedImageIO
+::CanWriteFile(const char *FileNameToWrite)
+{
+  const std::string filename(FileNameToWrite);
+  if ( filename.empty() )
+    {
+    return false;
+    }
+  const std::string::size_type pos = filename.rfind(".chunked");
+  return pos != std::string::npos && pos == filename.length() - 8;
+}
+
+ImageIOBase::SizeType
+ChunkedImageIO
+::GetHeaderSize() const
+{
+  return 0;
+}
+
+std::string
+ChunkedImageIO
+::ChunkFileName(const std::vector< SizeValueType > & chunkGridIndex) const
+{
+  std::ostringstream name;
+  name << this->m_FileName << "/chunk";
+  for ( auto index : chunkGridIndex )
+    {
+    name << "_" << index;
+    }
+  return name.str();
+}
+
+void
+ChunkedImageIO
+::ReadImageInformation()
+{
+  std::string headerName(this->m_FileName);
+  headerName += "/";
+  headerName += HeaderFileName;
+  std::ifstream headerFile( headerName.c_str() );
+  if ( headerFile.fail() )
+    {
+    itkExceptionMacro(<< "Could not open header of chunked image "
+                      << this->m_FileName);
+    }
+  std::map< std::string, std::string > header;
+  std::string line;
+  while ( std::getline(headerFile, line) )
+    {
+    const std::string::size_type eq = line.find('=');
+    if ( eq == std::string::npos )
+      {
+      continue;
+      }
+    header[Trim( line.substr(0, eq) )] = Trim( line.substr(eq + 1) );
+    }
+
+  const auto version =
+    ParseValues< int >( RequireValue(header, "ChunkedImageVersion") );
+  if ( version.size() != 1 || version[0] > ChunkedImageVersion )
+    {
+    itkExceptionMacro(<< "Unsupported chunked image version in "
+                      << this->m_FileName);
+    }
+
+  const auto nDims =
+    ParseValues< unsigned int >( RequireValue(header, "NDims") );
+  if ( nDims.size() != 1 || nDims[0] == 0 )
+    {
+    itkExceptionMacro(<< "Bad \"NDims\" in chunked image header");
+    }
+  this->SetNumberOfDimensions(nDims[0]);
+
+  const auto dims =
+    ParseValues< SizeValueType >( RequireValue(header, "DimSize") );
+  const auto chunkDims =
+    ParseValues< SizeValueType >( RequireValue(header, "ChunkSize") );
+  const auto origin =
+    ParseValues< double >( RequireValue(header, "Origin") );
+  const auto spacing =
+    ParseValues< double >( RequireValue(header, "Spacing") );
+  if ( dims.size() != nDims[0] || chunkDims.size() != nDims[0]
+       || origin.size() != nDims[0] || spacing.size() != nDims[0] )
+    {
+    itkExceptionMacro(<< "Inconsistent dimensions in header of chunked image "
+                      << this->m_FileName);
+    }
+  for ( unsigned int i = 0; i < nDims[0]; i++ )
+    {
+    if ( chunkDims[i] < 1 || chunkDims[i] > dims[i] )
+      {
+      itkExceptionMacro(<< "Bad \"ChunkSize\" in chunked image header");
+      }
+    this->SetDimensions(i, dims[i]);
+    this->SetOrigin(i, origin[i]);
+    this->SetSpacing(i, spacing[i]);
+    std::ostringstream directionKey;
+    directionKey << "Direction" << i;
+    const auto direction =
+      ParseValues< double >( RequireValue( header, directionKey.str() ) );
+    if ( direction.size() != nDims[0] )
+      {
+      itkExceptionMacro(<< "Bad \"" << directionKey.str()
+                        << "\" in chunked image header");
+      }
+    this->SetDirection(i, direction);
+    }
+  this->m_ChunkDimensions = chunkDims;
+
+  this->SetComponentType(
+    Self::GetComponentTypeFromString( RequireValue(header, "ComponentType") ) );
+  if ( this->GetComponentType() == UNKNOWNCOMPONENTTYPE )
+    {
+    itkExceptionMacro(<< "Unknown \"ComponentType\" in chunked image header");
+    }
+  this->SetPixelType(
+    Self::GetPixelTypeFromString( RequireValue(header, "PixelType") ) );
+  const auto numComponents =
+    ParseValues< unsigned int >( RequireValue(header, "NumberOfComponents") );
+  if ( numComponents.size() != 1 || numComponents[0] == 0 )
+    {
+    itkExceptionMacro(<< "Bad \"NumberOfComponents\" in chunked image header");
+    }
+  this->SetNumberOfComponents(numComponents[0]);
+
+  const std::string byteOrder = RequireValue(header, "ByteOrder");
+  if ( byteOrder == "LittleEndian" )
+    {
+    this->SetByteOrderToLittleEndian();
+    }
+  else if ( byteOrder == "BigEndian" )
+    {
+    this->SetByteOrderToBigEndian();
+    }
+  else
+    {
+    itkExceptionMacro(<< "Bad \"ByteOrder\" in chunked image header");
+    }
+
+  const std::string compression = RequireValue(header, "Compression");
+  if ( compression == "ZLib" )
+    {
+    this->SetUseCompression(true);
+    }
+  else if ( compression == "None" )
+    {
+    this->SetUseCompression(false);
+    }
+  else
+    {
+    itkExceptionMacro(<< "Unsupported \"Compression\" in chunked image header");
+    }
+}
+
+ImageIORegion
+ChunkedImageIO
+::GenerateStreamableReadRegionFromRequestedRegion(const ImageIORegion & requestedRegion) const
+{
+  ImageIORegion streamableRegion =
+    Superclass::GenerateStreamableReadRegionFromRequestedRegion(requestedRegion);
+  //
+  // expand the region to chunk boundaries, so every chunk intersecting
+  // the requested region is fetched and inflated exactly once rather
+  // than once per streamed piece
+  const unsigned int limit =
+    std::min< unsigned int >(this->m_ChunkDimensions.size(),
+                             streamableRegion.GetImageDimension());
+  for ( unsigned int i = 0; i < limit; i++ )
+    {
+    const ImageIORegion::SizeValueType chunk = this->m_ChunkDimensions[i];
+    if ( chunk < 2 )
+      {
+      continue;
+      }
+    const ImageIORegion::IndexValueType begin =
+      ( streamableRegion.GetIndex(i) / chunk ) * chunk;
+    const ImageIORegion::SizeValueType end =
+      std::min< ImageIORegion::SizeValueType >(
+        ( ( streamableRegion.GetIndex(i) + streamableRegion.GetSize(i)
+            + chunk - 1 ) / chunk ) * chunk,
+        this->m_Dimensions[i]);
+    streamableRegion.SetIndex(i, begin);
+    streamableRegion.SetSize(i, end - begin);
+    }
+  return streamableRegion;
+}
+
+unsigned int
+ChunkedImageIO
+::GetActualNumberOfSplitsForWriting(unsigned int numberOfRequestedSplits,
+                                    const ImageIORegion & pasteRegion,
+                                    const ImageIORegion & largestPossibleRegion)
+{
+  if ( pasteRegion == largestPossibleRegion && numberOfRequestedSplits != 1
+       && itksys::SystemTools::FileIsDirectory( this->m_FileName.c_str() ) )
+    {
+    // the superclass unlinks the name as a plain file before a
+    // streamed write replaces an existing image; a chunked image is a
+    // directory
+    if ( !itksys::SystemTools::RemoveADirectory( this->m_FileName.c_str() ) )
+      {
+      itkExceptionMacro(<< "Unable to remove chunk directory for streaming: "
+                        << this->m_FileName);
+      }
+    }
+  return Superclass::GetActualNumberOfSplitsForWriting(numberOfRequestedSplits,
+                                                       pasteRegion,
+                                                       largestPossibleRegion);
+}
+
+std::vector< std::vector< ImageIOBase::SizeValueType > >
+ChunkedImageIO
+::ComputeIntersectingChunks(const ImageIORegion & region) const
+{
+  std::vector< std::vector< SizeValueType > > chunks;
+  const unsigned int nDims = this->GetNumberOfDimensions();
+  std::vector< SizeValueType > first(nDims);
+  std::vector< SizeValueType > last(nDims);
+  for ( unsigned int d = 0; d < nDims; d++ )
+    {
+    if ( region.GetSize(d) == 0 )
+      {
+      return chunks;
+      }
+    first[d] = region.GetIndex(d) / this->m_ChunkDimensions[d];
+    last[d] = ( region.GetIndex(d) + region.GetSize(d) - 1 )
+              / this->m_ChunkDimensions[d];
+    }
+  std::vector< SizeValueType > current(first);
+  for ( ;; )
+    {
+    chunks.push_back(current);
+    unsigned int d = 0;
+    for ( ; d < nDims; d++ )
+      {
+      if ( ++current[d] <= last[d] )
+        {
+        break;
+        }
+      current[d] = first[d];
+      }
+    if ( d >= nDims )
+      {
+      break;
+      }
+    }
+  return chunks;
+}
+
+void
+ChunkedImageIO
+::SwapBytesIfNecessary(void *buffer, SizeValueType numberOfComponents)
+{
+  switch ( this->m_ComponentType )
+    {
+    case CHAR:
+    case UCHAR:
+      break;
+    case SHORT:
+      SwapRange< short >(buffer, numberOfComponents, this->m_ByteOrder);
+      break;
+    case USHORT:
+      SwapRange< unsigned short >(buffer, numberOfComponents, this->m_ByteOrder);
+      break;
+    case INT:
+      SwapRange< int >(buffer, numberOfComponents, this->m_ByteOrder);
+      break;
+    case UINT:
+      SwapRange< unsigned int >(buffer, numberOfComponents, this->m_ByteOrder);
+      break;
+    case LONG:
+      SwapRange< long >(buffer, numberOfComponents, this->m_ByteOrder);
+      break;
+    case ULONG:
+      SwapRange< unsigned long >(buffer, numberOfComponents, this->m_ByteOrder);
+      break;
+    case LONGLONG:
+      SwapRange< long long >(buffer, numberOfComponents, this->m_ByteOrder);
+      break;
+    case ULONGLONG:
+      SwapRange< unsigned long long >(buffer, numberOfComponents, this->m_ByteOrder);
+      break;
+    case FLOAT:
+      SwapRange< float >(buffer, numberOfComponents, this->m_ByteOrder);
+      break;
+    case DOUBLE:
+      SwapRange< double >(buffer, numberOfComponents, this->m_ByteOrder);
+      break;
+    default:
+      itkExceptionMacro(<< "Unknown component type: " << this->m_ComponentType);
+    }
+}
+
+void
+ChunkedImageIO
+::ReadChunkRange(const std::vector< std::vector< SizeValueType > > & chunks,
+                 size_t first, size_t last,
+                 void *buffer, const ImageIORegion & regionToRead)
+{
+  const unsigned int nDims = this->GetNumberOfDimensions();
+  const size_t pixelBytes = this->GetPixelSize();
+  size_t chunkPixels = 1;
+  for ( unsigned int d = 0; d < nDims; d++ )
+    {
+    chunkPixels *= this->m_ChunkDimensions[d];
+    }
+  const size_t chunkBytes = chunkPixels * pixelBytes;
+
+  std::vector< char > chunkBuffer(chunkBytes);
+  for ( size_t c = first; c < last; c++ )
+    {
+    std::vector< ImageIORegion::IndexValueType > chunkOrigin(nDims);
+    for ( unsigned int d = 0; d < nDims; d++ )
+      {
+      chunkOrigin[d] = chunks[c][d] * this->m_ChunkDimensions[d];
+      }
+    const std::string chunkName = this->ChunkFileName(chunks[c]);
+    std::ifstream chunkFile( chunkName.c_str(),
+                             std::ios::in | std::ios::binary | std::ios::ate );
+    if ( chunkFile.fail() )
+      {
+      // a missing chunk file reads as zeros
+      std::fill(chunkBuffer.begin(), chunkBuffer.end(), 0);
+      }
+    else
+      {
+      const std::streamoff fileBytes = chunkFile.tellg();
+      chunkFile.seekg(0, std::ios::beg);
+      if ( this->m_UseCompression )
+        {
+        std::vector< char > fileBuffer(fileBytes);
+        chunkFile.read(fileBuffer.data(), fileBytes);
+        if ( chunkFile.fail() )
+          {
+          itkExceptionMacro(<< "Error reading chunk " << chunkName);
+          }
+        auto inflatedBytes = static_cast< uLongf >( chunkBytes );
+        if ( uncompress(reinterpret_cast< Bytef * >( chunkBuffer.data() ),
+                        &inflatedBytes,
+                        reinterpret_cast< const Bytef * >( fileBuffer.data() ),
+                        static_cast< uLong >( fileBytes )) != Z_OK
+             || inflatedBytes != chunkBytes )
+          {
+          itkExceptionMacro(<< "Error inflating chunk " << chunkName);
+          }
+        }
+      else
+        {
+        if ( static_cast< size_t >( fileBytes ) != chunkBytes )
+          {
+          itkExceptionMacro(<< "Chunk " << chunkName
+                            << " has the wrong size");
+          }
+        chunkFile.read(chunkBuffer.data(), fileBytes);
+        if ( chunkFile.fail() )
+          {
+          itkExceptionMacro(<< "Error reading chunk " << chunkName);
+          }
+        }
+      this->SwapBytesIfNecessary(chunkBuffer.data(),
+                                 chunkPixels * this->GetNumberOfComponents());
+      }
+    CopyChunkRegion(static_cast< char * >( buffer ), regionToRead,
+                    chunkBuffer.data(), chunkOrigin,
+                    this->m_ChunkDimensions, pixelBytes, true);
+    }
+}
+
+void
+ChunkedImageIO
+::Read(void *buffer)
+{
+  const ImageIORegion regionToRead = this->GetIORegion();
+  const std::vector< std::vector< SizeValueType > > chunks =
+    this->ComputeIntersectingChunks(regionToRead);
+  if ( chunks.empty() )
+    {
+    return;
+    }
+
+  const auto numberOfWorkers = static_cast< ThreadIdType >(
+    std::min< size_t >(MultiThreaderBase::GetGlobalDefaultNumberOfThreads(),
+                       chunks.size()) );
+  if ( numberOfWorkers < 2 || ThreadPool::IsPoolWorker() )
+    {
+    // already running on a pool worker: fetch in place rather than
+    // deadlocking the pool with nested work
+    this->ReadChunkRange(chunks, 0, chunks.size(), buffer, regionToRead);
+    return;
+    }
+
+  // every chunk is an independent file, so workers fetch and inflate
+  // their ranges concurrently, scattering into the caller's buffer
+  ThreadPool::Pointer pool = ThreadPool::GetInstance();
+  std::vector< std::future< void > > futures;
+  std::exception_ptr firstError;
+  size_t rangeFirst = chunks.size() / numberOfWorkers
+                      + ( chunks.size() % numberOfWorkers != 0 ? 1 : 0 );
+  for ( ThreadIdType worker = 1; worker < numberOfWorkers; worker++ )
+    {
+    const size_t first = rangeFirst;
+    const size_t last = std::min(
+      first + ( chunks.size() - first ) / ( numberOfWorkers - worker )
+            + ( ( chunks.size() - first ) % ( numberOfWorkers - worker ) != 0 ? 1 : 0 ),
+      chunks.size());
+    rangeFirst = last;
+    futures.push_back(
+      pool->AddWork([this, &chunks, first, last, buffer, regionToRead]()
+        {
+        this->ReadChunkRange(chunks, first, last, buffer, regionToRead);
+        }) );
+    }
+  try
+    {
+    this->ReadChunkRange(chunks, 0,
+                         chunks.size() / numberOfWorkers
+                         + ( chunks.size() % numberOfWorkers != 0 ? 1 : 0 ),
+                         buffer, regionToRead);
+    }
+  catch ( ... )
+    {
+    firstError = std::current_exception();
+    }
+  // join every worker before propagating an error: they scatter into
+  // the caller's buffer
+  for ( auto & future : futures )
+    {
+    try
+      {
+      future.get();
+      }
+    catch ( ... )
+      {
+      if ( !firstError )
+        {
+        firstError = std::current_exception();
+        }
+      }
+    }
+  if ( firstError )
+    {
+    std::rethrow_exception(firstError);
+    }
+}
+
+void
+ChunkedImageIO
+::WriteImageInformation()
+{
+  if ( this->m_ImageInformationWritten )
+    {
+    return;
+    }
+
+  const unsigned int nDims = this->GetNumberOfDimensions();
+  if ( this->m_ChunkDimensions.size() != nDims )
+    {
+    // default to (N-1)-dimensional slab chunks, the divisions the
+    // streaming region splitter produces
+    this->m_ChunkDimensions.assign(this->m_Dimensions.begin(),
+                                   this->m_Dimensions.begin() + nDims);
+    if ( nDims > 1 )
+      {
+      this->m_ChunkDimensions[nDims - 1] = 1;
+      }
+    }
+  for ( unsigned int d = 0; d < nDims; d++ )
+    {
+    this->m_ChunkDimensions[d] =
+      std::max< SizeValueType >(1,
+        std::min(this->m_ChunkDimensions[d], this->m_Dimensions[d]));
+    }
+  // chunks are written in the system byte order
+  if ( ByteSwapper< int >::SystemIsBigEndian() )
+    {
+    this->SetByteOrderToBigEndian();
+    }
+  else
+    {
+    this->SetByteOrderToLittleEndian();
+    }
+
+  if ( !itksys::SystemTools::FileIsDirectory( this->m_FileName.c_str() )
+       && !itksys::SystemTools::MakeDirectory( this->m_FileName.c_str() ) )
+    {
+    itkExceptionMacro(<< "Could not create chunk directory "
+                      << this->m_FileName);
+    }
+
+  std::string headerName(this->m_FileName);
+  headerName += "/";
+  headerName += HeaderFileName;
+  std::ofstream headerFile( headerName.c_str(), std::ios::out | std::ios::trunc );
+  if ( headerFile.fail() )
+    {
+    itkExceptionMacro(<< "Could not open header of chunked image "
+                      << this->m_FileName << " for writing");
+    }
+  headerFile << "ChunkedImageVersion = " << ChunkedImageVersion << "\n";
+  headerFile << "NDims = " << nDims << "\n";
+  headerFile << "DimSize =";
+  for ( unsigned int d = 0; d < nDims; d++ )
+    {
+    headerFile << " " << this->m_Dimensions[d];
+    }
+  headerFile << "\n";
+  headerFile << "ChunkSize =";
+  for ( unsigned int d = 0; d < nDims; d++ )
+    {
+    headerFile << " " << this->m_ChunkDimensions[d];
+    }
+  headerFile << "\n";
+  headerFile.precision(17);
+  headerFile << "Origin =";
+  for ( unsigned int d = 0; d < nDims; d++ )
+    {
+    headerFile << " " << this->m_Origin[d];
+    }
+  headerFile << "\n";
+  headerFile << "Spacing =";
+  for ( unsigned int d = 0; d < nDims; d++ )
+    {
+    headerFile << " " << this->m_Spacing[d];
+    }
+  headerFile << "\n";
+  for ( unsigned int d = 0; d < nDims; d++ )
+    {
+    headerFile << "Direction" << d << " =";
+    for ( unsigned int j = 0; j < nDims; j++ )
+      {
+      headerFile << " " << this->m_Direction[d][j];
+      }
+    headerFile << "\n";
+    }
+  headerFile << "PixelType = "
+             << Self::GetPixelTypeAsString( this->GetPixelType() ) << "\n";
+  headerFile << "ComponentType = "
+             << Self::GetComponentTypeAsString( this->GetComponentType() ) << "\n";
+  headerFile << "NumberOfComponents = " << this->GetNumberOfComponents() << "\n";
+  headerFile << "ByteOrder = "
+             << this->GetByteOrderAsString( this->m_ByteOrder ) << "\n";
+  headerFile << "Compression = "
+             << ( this->m_UseCompression ? "ZLib" : "None" ) << "\n";
+  headerFile.close();
+  if ( headerFile.fail() )
+    {
+    itkExceptionMacro(<< "Error writing header of chunked image "
+                      << this->m_FileName);
+    }
+
+  // only write image information once
+  this->m_ImageInformationWritten = true;
+}
+
+void
+ChunkedImageIO
+::WriteChunkRange(const std::vector< std::vector< SizeValueType > > & chunks,
+                  size_t first, size_t last,
+                  const void *buffer, const ImageIORegion & regionToWrite)
+{
+  const unsigned int nDims = this->GetNumberOfDimensions();
+  const size_t pixelBytes = this->GetPixelSize();
+  size_t chunkPixels = 1;
+  for ( unsigned int d = 0; d < nDims; d++ )
+    {
+    chunkPixels *= this->m_ChunkDimensions[d];
+    }
+  const size_t chunkBytes = chunkPixels * pixelBytes;
+
+  std::vector< char > chunkBuffer(chunkBytes);
+  std::vector< char > deflateBuffer;
+  for ( size_t c = first; c < last; c++ )
+    {
+    std::vector< ImageIORegion::IndexValueType > chunkOrigin(nDims);
+    bool covered = true;
+    for ( unsigned int d = 0; d < nDims; d++ )
+      {
+      chunkOrigin[d] = chunks[c][d] * this->m_ChunkDimensions[d];
+      // the written part of an edge chunk ends at the image edge
+      const auto coveredEnd = std::min< ImageIORegion::IndexValueType >(
+        chunkOrigin[d] + this->m_ChunkDimensions[d],
+        this->m_Dimensions[d]);
+      if ( regionToWrite.GetIndex(d) > chunkOrigin[d]
+           || regionToWrite.GetIndex(d)
+              + static_cast< ImageIORegion::IndexValueType >( regionToWrite.GetSize(d) )
+              < coveredEnd )
+        {
+        covered = false;
+        }
+      }
+    const std::string chunkName = this->ChunkFileName(chunks[c]);
+    if ( covered )
+      {
+      std::fill(chunkBuffer.begin(), chunkBuffer.end(), 0);
+      }
+    else
+      {
+      // the region covers this chunk only partially: merge into the
+      // chunk already on disk. Every chunk belongs to exactly one
+      // worker's range, so nobody else touches this file.
+      ImageIORegion chunkRegion(nDims);
+      for ( unsigned int d = 0; d < nDims; d++ )
+        {
+        chunkRegion.SetIndex(d, chunkOrigin[d]);
+        chunkRegion.SetSize(d, this->m_ChunkDimensions[d]);
+        }
+      std::vector< std::vector< SizeValueType > > self(1, chunks[c]);
+      this->ReadChunkRange(self, 0, 1, chunkBuffer.data(), chunkRegion);
+      }
+    CopyChunkRegion(static_cast< char * >( const_cast< void * >( buffer ) ),
+                    regionToWrite, chunkBuffer.data(), chunkOrigin,
+                    this->m_ChunkDimensions, pixelBytes, false);
+
+    const char *fileData = chunkBuffer.data();
+    size_t fileBytes = chunkBytes;
+    if ( this->m_UseCompression )
+      {
+      auto deflatedBytes =
+        static_cast< uLongf >( compressBound( static_cast< uLong >( chunkBytes ) ) );
+      deflateBuffer.resize(deflatedBytes);
+      if ( compress2(reinterpret_cast< Bytef * >( deflateBuffer.data() ),
+                     &deflatedBytes,
+                     reinterpret_cast< const Bytef * >( chunkBuffer.data() ),
+                     static_cast< uLong >( chunkBytes ),
+                     Z_DEFAULT_COMPRESSION) != Z_OK )
+        {
+        itkExceptionMacro(<< "Error deflating chunk " << chunkName);
+        }
+      fileData = deflateBuffer.data();
+      fileBytes = deflatedBytes;
+      }
+    std::ofstream chunkFile( chunkName.c_str(),
+                             std::ios::out | std::ios::binary | std::ios::trunc );
+    if ( chunkFile.fail() )
+      {
+      itkExceptionMacro(<< "Could not open chunk " << chunkName
+                        << " for writing");
+      }
+    chunkFile.write(fileData, fileBytes);
+    chunkFile.close();
+    if ( chunkFile.fail() )
+      {
+      itkExceptionMacro(<< "Error writing chunk " << chunkName);
+      }
+    }
+}
+
+void
+ChunkedImageIO
+::Write(const void *buffer)
+{
+  this->WriteImageInformation();
+
+  const ImageIORegion regionToWrite = this->GetIORegion();
+  const std::vector< std::vector< SizeValueType > > chunks =
+    this->ComputeIntersectingChunks(regionToWrite);
+  if ( chunks.empty() )
+    {
+    return;
+    }
+
+  const auto numberOfWorkers = static_cast< ThreadIdType >(
+    std::min< size_t >(MultiThreaderBase::GetGlobalDefaultNumberOfThreads(),
+                       chunks.size()) );
+  if ( numberOfWorkers < 2 || ThreadPool::IsPoolWorker() )
+    {
+    // already running on a pool worker: compress in place rather than
+    // deadlocking the pool with nested work
+    this->WriteChunkRange(chunks, 0, chunks.size(), buffer, regionToWrite);
+    return;
+    }
+
+  // every chunk is an independent file owned by exactly one worker's
+  // range, so workers deflate and write their ranges concurrently
+  ThreadPool::Pointer pool = ThreadPool::GetInstance();
+  std::vector< std::future< void > > futures;
+  std::exception_ptr firstError;
+  const size_t firstRangeEnd = chunks.size() / numberOfWorkers
+                               + ( chunks.size() % numberOfWorkers != 0 ? 1 : 0 );
+  size_t rangeFirst = firstRangeEnd;
+  for ( ThreadIdType worker = 1; worker < numberOfWorkers; worker++ )
+    {
+    const size_t first = rangeFirst;
+    const size_t last = std::min(
+      first + ( chunks.size() - first ) / ( numberOfWorkers - worker )
+            + ( ( chunks.size() - first ) % ( numberOfWorkers - worker ) != 0 ? 1 : 0 ),
+      chunks.size());
+    rangeFirst = last;
+    futures.push_back(
+      pool->AddWork([this, &chunks, first, last, buffer, regionToWrite]()
+        {
+        this->WriteChunkRange(chunks, first, last, buffer, regionToWrite);
+        }) );
+    }
+  try
+    {
+    this->WriteChunkRange(chunks, 0, firstRangeEnd, buffer, regionToWrite);
+    }
+  catch ( ... )
+    {
+    firstError = std::current_exception();
+    }
+  // join every worker before propagating an error: they read from the
+  // caller's buffer
+  for ( auto & future : futures )
+    {
+    try
+      {
+      future.get();
+      }
+    catch ( ... )
+      {
+      if ( !firstError )
+        {
+        firstError = std::current_exception();
+        }
+      }
+    }
+  if ( firstError )
+    {
+    std::rethrow_exception(firstError);
+    }
+}
+
+} // end namespace itk
@@ -0,0 +1,194 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkChunkedImageIO.h"
+#include "itkChunkedImageIOFactory.h"
+#include "itkIOTestHelper.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkMath.h"
+
+// Round trip through the chunked directory format: a whole image is
+// written with an explicit chunk shape that does not divide the image
+// evenly, read back and compared, then a sub-region is pasted over
+// part of the image so partially covered chunks exercise the
+// read-merge-rewrite path.
+
+template <typename TPixel>
+int ChunkedImageIOTest(const char *fileName)
+{
+  using ImageType = typename itk::Image<TPixel,3>;
+
+  typename ImageType::SizeType size;
+  size[0] = 10;
+  size[1] = 10;
+  size[2] = 10;
+
+  typename ImageType::Pointer image = ImageType::New();
+  image->SetRegions(size);
+  image->Allocate();
+  itk::ImageRegionIteratorWithIndex<ImageType> it( image, image->GetLargestPossibleRegion() );
+  for(it.GoToBegin(); !it.IsAtEnd(); ++it)
+    {
+    typename ImageType::IndexType idx = it.GetIndex();
+    it.Set(idx[2]*100 + idx[1]*10 + idx[0]);
+    }
+
+  std::vector<itk::ImageIOBase::SizeValueType> chunkDimensions(3,4);
+
+  itk::ChunkedImageIO::Pointer writeIO = itk::ChunkedImageIO::New();
+  writeIO->SetChunkDimensions(chunkDimensions);
+
+  using WriterType = typename itk::ImageFileWriter<ImageType>;
+  typename WriterType::Pointer writer = WriterType::New();
+  writer->SetFileName(fileName);
+  writer->SetInput(image);
+  writer->SetImageIO(writeIO);
+  try
+    {
+    writer->Write();
+    }
+  catch(itk::ExceptionObject &err)
+    {
+    std::cout << "itkChunkedImageIOTest" << std::endl
+              << "Exception Object caught: " << std::endl
+              << err << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // paste a sub-region that is not chunk aligned, so edge chunks of
+  // the pasted block are read, merged and rewritten
+  typename ImageType::RegionType pasteRegion;
+  pasteRegion.SetIndex(0,3);
+  pasteRegion.SetIndex(1,3);
+  pasteRegion.SetIndex(2,3);
+  pasteRegion.SetSize(0,5);
+  pasteRegion.SetSize(1,5);
+  pasteRegion.SetSize(2,5);
+  typename ImageType::Pointer pasteImage = ImageType::New();
+  pasteImage->SetRegions(pasteRegion);
+  pasteImage->Allocate();
+  itk::ImageRegionIteratorWithIndex<ImageType> pit( pasteImage, pasteRegion );
+  for(pit.GoToBegin(); !pit.IsAtEnd(); ++pit)
+    {
+    typename ImageType::IndexType idx = pit.GetIndex();
+    pit.Set(idx[2]*100 + idx[1]*10 + idx[0] + 1);
+    }
+
+  itk::ImageIORegion pasteIORegion(3);
+  itk::ImageIORegionAdaptor<3>::Convert( pasteRegion, pasteIORegion,
+    image->GetLargestPossibleRegion().GetIndex() );
+  itk::ChunkedImageIO::Pointer pasteIO = itk::ChunkedImageIO::New();
+  pasteIO->SetFileName(fileName);
+  try
+    {
+    pasteIO->ReadImageInformation();
+    pasteIO->SetIORegion(pasteIORegion);
+    pasteIO->Write( pasteImage->GetBufferPointer() );
+    }
+  catch(itk::ExceptionObject &err)
+    {
+    std::cout << "itkChunkedImageIOTest" << std::endl
+              << "Exception Object caught: " << std::endl
+              << err << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  itk::ChunkedImageIO::Pointer readIO = itk::ChunkedImageIO::New();
+  using ReaderType = typename itk::ImageFileReader<ImageType>;
+  typename ReaderType::Pointer reader = ReaderType::New();
+  reader->SetFileName(fileName);
+  reader->SetImageIO(readIO);
+  try
+    {
+    reader->Update();
+    }
+  catch(itk::ExceptionObject &err)
+    {
+    std::cout << "itkChunkedImageIOTest" << std::endl
+              << "Exception Object caught: " << std::endl
+              << err << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // the chunk shape must come back from the header
+  if(readIO->GetChunkDimensions() != chunkDimensions)
+    {
+    std::cout << "Chunk dimensions read from header don't match the "
+              << "dimensions the image was written with" << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // a requested region must be expanded to chunk boundaries, clipped
+  // against the image extent
+  itk::ImageIORegion requestedRegion(3);
+  itk::ImageIORegion expectedRegion(3);
+  for(unsigned int i = 0; i < 3; i++)
+    {
+    requestedRegion.SetIndex(i,5);
+    requestedRegion.SetSize(i,4);
+    expectedRegion.SetIndex(i,4);
+    expectedRegion.SetSize(i,6);
+    }
+  itk::ImageIORegion streamableRegion =
+    readIO->GenerateStreamableReadRegionFromRequestedRegion(requestedRegion);
+  if(streamableRegion != expectedRegion)
+    {
+    std::cout << "Streamable region " << streamableRegion
+              << " isn't the requested region " << requestedRegion
+              << " expanded to chunk boundaries: " << expectedRegion
+              << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  itk::ImageRegionIteratorWithIndex<ImageType>
+    rit( reader->GetOutput(), reader->GetOutput()->GetLargestPossibleRegion() );
+  for(rit.GoToBegin(); !rit.IsAtEnd(); ++rit)
+    {
+    typename ImageType::IndexType idx = rit.GetIndex();
+    TPixel origValue(static_cast<TPixel>(
+      idx[2]*100 + idx[1]*10 + idx[0] + ( pasteRegion.IsInside(idx) ? 1 : 0 ) ));
+    if(itk::Math::NotAlmostEquals( rit.Get(), origValue ))
+      {
+      std::cout << "Original Pixel (" << origValue
+                << ") doesn't match read-in Pixel ("
+                << rit.Get() << ") at " << idx << std::endl;
+      return EXIT_FAILURE;
+      }
+    }
+
+  itksys::SystemTools::RemoveADirectory(fileName);
+
+  return EXIT_SUCCESS;
+}
+
+int
+itkChunkedImageIOTest(int ac, char * av [])
+{
+  std::string prefix("");
+  if(ac > 1)
+    {
+    prefix = *++av;
+    --ac;
+    itksys::SystemTools::ChangeDirectory(prefix.c_str());
+    }
+  itk::ObjectFactoryBase::RegisterFactory(itk::ChunkedImageIOFactory::New() );
+
+  int result(0);
+  result += ChunkedImageIOTest<short>("ChunkedShortImage.chunked");
+  result += ChunkedImageIOTest<float>("ChunkedFloatImage.chunked");
+  return result != 0;
+}
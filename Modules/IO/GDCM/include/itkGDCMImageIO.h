@@ -97,6 +97,9 @@ public:
    * file specified. */
   bool CanReadFile(const char *) override;
 
+  /** The DICOM "DICM" marker that follows the 128 byte preamble. */
+  ArrayOfMagicByteSignaturesType GetMagicByteSignatures() const override;
+
   /** Set the spacing and dimesion information for the current filename. */
   void ReadImageInformation() override;
 
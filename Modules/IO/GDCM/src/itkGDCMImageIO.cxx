@@ -121,6 +121,12 @@ GDCMImageIO::~GDCMImageIO()
 
 // This method will only test if the header looks like a
 // GDCM image file.
+GDCMImageIO::ArrayOfMagicByteSignaturesType
+GDCMImageIO::GetMagicByteSignatures() const
+{
+  return { { 128, "DICM" } };
+}
+
 bool GDCMImageIO::CanReadFile(const char *filename)
 {
   std::ifstream file;
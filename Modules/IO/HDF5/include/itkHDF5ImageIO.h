@@ -131,6 +131,21 @@ public:
    * that the IORegions has been set properly. */
   void Write(const void *buffer) override;
 
+  /** Set/Get the chunk shape of the voxel dataset, fastest moving
+   * dimension first and without the component dimension. An empty
+   * vector (the default) chunks by (N-1)-dimensional slabs, matching
+   * the divisions the streaming region splitter produces. After
+   * ReadImageInformation() this holds the chunk shape of the open
+   * file. */
+  void SetChunkDimensions(const std::vector< SizeValueType > & chunkDimensions);
+  const std::vector< SizeValueType > & GetChunkDimensions() const;
+
+  /** Returns the requested region expanded to the chunk boundaries of
+   * the voxel dataset, so every compressed chunk intersecting the
+   * requested region is decompressed exactly once while streaming. */
+  ImageIORegion
+  GenerateStreamableReadRegionFromRequestedRegion(const ImageIORegion & requestedRegion) const override;
+
 protected:
   HDF5ImageIO();
   ~HDF5ImageIO() override;
@@ -193,9 +208,17 @@ private:
   void CloseH5File();
   void CloseDataSet();
 
+  /** Deflate the chunks of the voxel dataset concurrently and write
+   * them with H5Dwrite_chunk, bypassing the serial filter pipeline.
+   * Returns false when the write does not cover the whole image in one
+   * piece, leaving the write to the hyperslab path. */
+  bool TryParallelCompressedWrite(const void *buffer);
+
   H5::H5File  *m_H5File{nullptr};
   H5::DataSet *m_VoxelDataSet{nullptr};
   bool         m_ImageInformationWritten{false};
+
+  std::vector< SizeValueType > m_ChunkDimensions;
 };
 } // end namespace itk
 
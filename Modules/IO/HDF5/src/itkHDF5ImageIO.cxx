@@ -19,10 +19,18 @@
 #include "itkHDF5ImageIO.h"
 #include "itkMetaDataObject.h"
 #include "itkArray.h"
+#include "itkMultiThreaderBase.h"
+#include "itkThreadPool.h"
 #include "itksys/SystemTools.hxx"
 #include "itk_H5Cpp.h"
+#include "itk_zlib.h"
 
 #include <algorithm>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <future>
+#include <utility>
 
 namespace itk
 {
@@ -58,6 +66,30 @@ HDF5ImageIO
   Superclass::PrintSelf(os, indent);
   // just prints out the pointer value.
   os << indent << "H5File: " << this->m_H5File << std::endl;
+  os << indent << "ChunkDimensions: ";
+  for(auto dim : this->m_ChunkDimensions)
+    {
+    os << dim << " ";
+    }
+  os << std::endl;
+}
+
+void
+HDF5ImageIO
+::SetChunkDimensions(const std::vector< SizeValueType > & chunkDimensions)
+{
+  if(chunkDimensions != this->m_ChunkDimensions)
+    {
+    this->m_ChunkDimensions = chunkDimensions;
+    this->Modified();
+    }
+}
+
+const std::vector< ImageIOBase::SizeValueType > &
+HDF5ImageIO
+::GetChunkDimensions() const
+{
+  return this->m_ChunkDimensions;
 }
 
 //
@@ -257,6 +289,66 @@ ComponentToString(ImageIOBase::IOComponentType cType)
     }
   return rval;
 }
+// Gather one chunk of a chunked dataset out of a contiguous image
+// buffer laid out in HDF5 (slowest moving dimension first) order.
+// Edge chunks are clipped against the image extent; HDF5 stores chunks
+// at full size, so the destination buffer is expected to be zeroed.
+void
+GatherChunk(const char *image,
+            unsigned char *chunk,
+            int rank,
+            const hsize_t *imageDims,
+            const hsize_t *chunkDims,
+            const hsize_t *chunkOffset,
+            size_t elementSize)
+{
+  // element strides, slowest moving dimension first
+  std::vector<size_t> imageStride(rank);
+  std::vector<size_t> chunkStride(rank);
+  imageStride[rank - 1] = 1;
+  chunkStride[rank - 1] = 1;
+  for(int d = rank - 2; d >= 0; d--)
+    {
+    imageStride[d] = imageStride[d + 1] * imageDims[d + 1];
+    chunkStride[d] = chunkStride[d + 1] * chunkDims[d + 1];
+    }
+  std::vector<size_t> clipped(rank);
+  for(int d = 0; d < rank; d++)
+    {
+    clipped[d] = std::min<size_t>(chunkDims[d], imageDims[d] - chunkOffset[d]);
+    }
+  const size_t runBytes = clipped[rank - 1] * elementSize;
+  // odometer over every dimension but the fastest moving one; rows
+  // along that dimension are contiguous in both buffers
+  std::vector<size_t> idx(rank, 0);
+  for(;;)
+    {
+    size_t imageElement(0);
+    size_t chunkElement(0);
+    for(int d = 0; d < rank; d++)
+      {
+      imageElement += ( chunkOffset[d] + idx[d] ) * imageStride[d];
+      chunkElement += idx[d] * chunkStride[d];
+      }
+    memcpy(chunk + chunkElement * elementSize,
+           image + imageElement * elementSize,
+           runBytes);
+    int d = rank - 2;
+    for(; d >= 0; d--)
+      {
+      if(++idx[d] < clipped[d])
+        {
+        break;
+        }
+      idx[d] = 0;
+      }
+    if(d < 0)
+      {
+      break;
+      }
+    }
+}
+
 // Function:    H5Object::doesAttrExist
 ///\brief       test for existence of attribut
 ///\param       name - IN: Name of the attribute
@@ -841,6 +933,23 @@ HDF5ImageIO
       }
     delete[] Dims;
     //
+    // remember the chunk shape of the file, so streamed read regions
+    // can be aligned with the chunk boundaries
+    this->m_ChunkDimensions.clear();
+    H5::DSetCreatPropList cplist(imageSet.getCreatePlist());
+    if(cplist.getLayout() == H5D_CHUNKED)
+      {
+      auto * chunkDims = new hsize_t[nDims];
+      cplist.getChunk(static_cast<int>( nDims ),chunkDims);
+      // chunk dims come back in HDF5 (slowest moving first) order
+      const int spatialDims = this->GetNumberOfDimensions();
+      for(int i = 0; i < spatialDims; i++)
+        {
+        this->m_ChunkDimensions.push_back(chunkDims[spatialDims - i - 1]);
+        }
+      delete[] chunkDims;
+      }
+    //
     // read out metadata
     MetaDataDictionary & metaDict = this->GetMetaDataDictionary();
     // Necessary to clear dict if ImageIO object is re-used
@@ -1095,6 +1204,39 @@ HDF5ImageIO
   delete[] offset;
 }
 
+ImageIORegion
+HDF5ImageIO
+::GenerateStreamableReadRegionFromRequestedRegion(const ImageIORegion & requestedRegion) const
+{
+  ImageIORegion streamableRegion =
+    Superclass::GenerateStreamableReadRegionFromRequestedRegion(requestedRegion);
+  //
+  // expand the region to the chunk boundaries of the voxel dataset, so
+  // each compressed chunk intersecting the requested region is
+  // decompressed exactly once rather than once per streamed piece
+  const unsigned int limit =
+    std::min<unsigned int>(this->m_ChunkDimensions.size(),
+                           streamableRegion.GetImageDimension());
+  for(unsigned int i = 0; i < limit; i++)
+    {
+    const ImageIORegion::SizeValueType chunk = this->m_ChunkDimensions[i];
+    if(chunk < 2)
+      {
+      continue;
+      }
+    const ImageIORegion::IndexValueType begin =
+      ( streamableRegion.GetIndex(i) / chunk ) * chunk;
+    const ImageIORegion::SizeValueType end =
+      std::min<ImageIORegion::SizeValueType>(
+        ( ( streamableRegion.GetIndex(i) + streamableRegion.GetSize(i)
+            + chunk - 1 ) / chunk ) * chunk,
+        this->m_Dimensions[i]);
+    streamableRegion.SetIndex(i,begin);
+    streamableRegion.SetSize(i,end - begin);
+    }
+  return streamableRegion;
+}
+
 void
 HDF5ImageIO
 ::Read(void *buffer)
@@ -1231,11 +1373,28 @@ HDF5ImageIO
     H5::PredType dataType = ComponentToPredType(this->GetComponentType());
 
     // set up properties for chunked, compressed writes.
-    // in this case, set the chunk size to be the N-1 dimension
-    // region
+    // by default, set the chunk size to be the N-1 dimension
+    // region -- the divisions the streaming region splitter
+    // produces -- otherwise use the requested chunk shape
     H5::DSetCreatPropList plist;
     plist.setDeflate(5);
-    dims[0] = 1;
+    if(this->m_ChunkDimensions.size() ==
+       static_cast<size_t>( this->GetNumberOfDimensions() ))
+      {
+      // requested chunk shape is fastest moving dimension first and
+      // spatial only; clamp it against the image extent
+      const int spatialDims = this->GetNumberOfDimensions();
+      for(int i(0), j(spatialDims - 1); i < spatialDims; i++, j--)
+        {
+        dims[j] = std::max<hsize_t>(1,
+          std::min<hsize_t>(this->m_ChunkDimensions[i],
+                            this->m_Dimensions[i]));
+        }
+      }
+    else
+      {
+      dims[0] = 1;
+      }
     plist.setChunk(numDims,dims);
     delete[] dims;
 
@@ -1411,6 +1570,171 @@ HDF5ImageIO
   this->m_ImageInformationWritten = true;
 }
 
+bool
+HDF5ImageIO
+::TryParallelCompressedWrite(const void *buffer)
+{
+  // the direct chunk path writes every chunk of the dataset, so it
+  // only applies when the whole image is written in one piece
+  ImageIORegion regionToWrite = this->GetIORegion();
+  const unsigned int spatialDims = this->GetNumberOfDimensions();
+  for(unsigned int i = 0; i < spatialDims; i++)
+    {
+    if(regionToWrite.GetIndex(i) != 0 ||
+       regionToWrite.GetSize(i) != this->m_Dimensions[i])
+      {
+      return false;
+      }
+    }
+
+  H5::DSetCreatPropList cplist(this->m_VoxelDataSet->getCreatePlist());
+  if(cplist.getLayout() != H5D_CHUNKED)
+    {
+    return false;
+    }
+  H5::DataSpace imageSpace = this->m_VoxelDataSet->getSpace();
+  const int rank = imageSpace.getSimpleExtentNdims();
+  std::vector<hsize_t> imageDims(rank);
+  imageSpace.getSimpleExtentDims(imageDims.data());
+  std::vector<hsize_t> chunkDims(rank);
+  cplist.getChunk(rank,chunkDims.data());
+
+  const size_t elementSize = this->m_VoxelDataSet->getDataType().getSize();
+  std::vector<size_t> gridCount(rank);
+  size_t numberOfChunks(1);
+  size_t chunkBytes(elementSize);
+  for(int d = 0; d < rank; d++)
+    {
+    gridCount[d] = ( imageDims[d] + chunkDims[d] - 1 ) / chunkDims[d];
+    numberOfChunks *= gridCount[d];
+    chunkBytes *= chunkDims[d];
+    }
+
+  // a compressed chunk, paired with the filter mask recording whether
+  // deflate was applied (bit 0 set means the chunk is stored raw)
+  using ChunkPayload = std::pair< std::vector< unsigned char >, uint32_t >;
+
+  auto chunkOffset = [rank, &chunkDims, &gridCount](size_t chunk,
+                                                    hsize_t *offset)
+    {
+    size_t remainder = chunk;
+    for(int d = rank - 1; d >= 0; d--)
+      {
+      offset[d] = ( remainder % gridCount[d] ) * chunkDims[d];
+      remainder /= gridCount[d];
+      }
+    };
+
+  auto compressChunk = [buffer, rank, &imageDims, &chunkDims, elementSize,
+                        chunkBytes, &chunkOffset](size_t chunk) -> ChunkPayload
+    {
+    std::vector<hsize_t> offset(rank);
+    chunkOffset(chunk,offset.data());
+    // edge chunks are stored at full size; pad them with zeros
+    std::vector<unsigned char> raw(chunkBytes, 0);
+    GatherChunk(static_cast<const char *>( buffer ),raw.data(),rank,
+                imageDims.data(),chunkDims.data(),offset.data(),elementSize);
+    ChunkPayload payload;
+    uLongf compressedBytes = compressBound(chunkBytes);
+    payload.first.resize(compressedBytes);
+    // level 5 matches the setDeflate(5) filter the dataset was
+    // created with
+    if(compress2(payload.first.data(),&compressedBytes,raw.data(),
+                 chunkBytes,5) != Z_OK)
+      {
+      itkGenericExceptionMacro(<< "deflate failed on HDF5 chunk "
+                               << chunk);
+      }
+    if(compressedBytes >= chunkBytes)
+      {
+      // store incompressible chunks raw, flagging deflate as skipped
+      payload.first = std::move(raw);
+      payload.second = 0x1;
+      }
+    else
+      {
+      payload.first.resize(compressedBytes);
+      payload.second = 0;
+      }
+    return payload;
+    };
+
+  const hid_t dataSetId = this->m_VoxelDataSet->getId();
+  auto writeChunk = [dataSetId, rank, &chunkOffset](size_t chunk,
+                                                    ChunkPayload & payload)
+    {
+    std::vector<hsize_t> offset(rank);
+    chunkOffset(chunk,offset.data());
+    if(H5Dwrite_chunk(dataSetId,H5P_DEFAULT,payload.second,offset.data(),
+                      payload.first.size(),payload.first.data()) < 0)
+      {
+      itkGenericExceptionMacro(<< "H5Dwrite_chunk failed on chunk "
+                               << chunk);
+      }
+    };
+
+  const auto numberOfWorkers = static_cast<ThreadIdType>(
+    std::min<size_t>(MultiThreaderBase::GetGlobalDefaultNumberOfThreads(),
+                     numberOfChunks));
+  if(numberOfWorkers < 2 || ThreadPool::IsPoolWorker())
+    {
+    // already running on a pool worker: compress in place rather than
+    // deadlocking the pool with nested work
+    for(size_t chunk = 0; chunk < numberOfChunks; chunk++)
+      {
+      ChunkPayload payload = compressChunk(chunk);
+      writeChunk(chunk,payload);
+      }
+    return true;
+    }
+
+  // compression runs on the thread pool; the HDF5 library itself is
+  // not thread safe, so completed chunks are handed to H5Dwrite_chunk
+  // here on the calling thread, in order. The window of in-flight
+  // chunks bounds the memory held in chunk buffers.
+  ThreadPool::Pointer pool = ThreadPool::GetInstance();
+  const size_t window = 2 * static_cast<size_t>( numberOfWorkers );
+  std::deque< std::future< ChunkPayload > > pending;
+  std::exception_ptr firstError;
+  size_t nextChunk(0);
+  size_t chunkToWrite(0);
+  while(!pending.empty() ||
+        ( !firstError && nextChunk < numberOfChunks ))
+    {
+    while(!firstError && nextChunk < numberOfChunks &&
+          pending.size() < window)
+      {
+      pending.push_back(pool->AddWork(compressChunk,nextChunk));
+      nextChunk++;
+      }
+    std::future< ChunkPayload > front = std::move(pending.front());
+    pending.pop_front();
+    try
+      {
+      ChunkPayload payload = front.get();
+      if(!firstError)
+        {
+        writeChunk(chunkToWrite,payload);
+        }
+      }
+    catch(...)
+      {
+      // join every in-flight chunk before propagating an error: the
+      // workers read from the caller's buffer
+      if(!firstError)
+        {
+        firstError = std::current_exception();
+        }
+      }
+    chunkToWrite++;
+    }
+  if(firstError)
+    {
+    std::rethrow_exception(firstError);
+    }
+  return true;
+}
+
 /**
  * Write the image Information before writing data
  */
@@ -1440,7 +1764,13 @@ HDF5ImageIO
     H5::PredType dataType = ComponentToPredType(this->GetComponentType());
     H5::DataSpace dspace;
     this->SetupStreaming(&imageSpace,&dspace);
-    this->m_VoxelDataSet->write(buffer,dataType,dspace,imageSpace);
+    // whole-image writes compress their chunks concurrently and store
+    // them directly; partial writes go through the serial hyperslab
+    // path
+    if(!this->TryParallelCompressedWrite(buffer))
+      {
+      this->m_VoxelDataSet->write(buffer,dataType,dspace,imageSpace);
+      }
     delete[] dims;
     }
   // catch failure caused by the H5File operations
@@ -0,0 +1,157 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkHDF5ImageIO.h"
+#include "itkHDF5ImageIOFactory.h"
+#include "itkIOTestHelper.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkMath.h"
+
+// Round trip through the chunked direct-write path: a whole-image
+// write with a user supplied chunk shape compresses its chunks
+// concurrently, and the image dimensions deliberately do not divide
+// evenly by the chunk shape so edge chunks are exercised. On read,
+// the chunk shape must be recovered from the file and streamable read
+// regions must be expanded to chunk boundaries.
+
+template <typename TPixel>
+int HDF5ChunkedCompressionTest(const char *fileName)
+{
+  using ImageType = typename itk::Image<TPixel,3>;
+
+  typename ImageType::SizeType size;
+  size[0] = 10;
+  size[1] = 10;
+  size[2] = 10;
+
+  typename ImageType::Pointer image = ImageType::New();
+  image->SetRegions(size);
+  image->Allocate();
+  itk::ImageRegionIteratorWithIndex<ImageType> it( image, image->GetLargestPossibleRegion() );
+  for(it.GoToBegin(); !it.IsAtEnd(); ++it)
+    {
+    typename ImageType::IndexType idx = it.GetIndex();
+    it.Set(idx[2]*100 + idx[1]*10 + idx[0]);
+    }
+
+  std::vector<itk::ImageIOBase::SizeValueType> chunkDimensions(3,4);
+
+  itk::HDF5ImageIO::Pointer writeIO = itk::HDF5ImageIO::New();
+  writeIO->SetChunkDimensions(chunkDimensions);
+
+  using WriterType = typename itk::ImageFileWriter<ImageType>;
+  typename WriterType::Pointer writer = WriterType::New();
+  writer->SetFileName(fileName);
+  writer->SetInput(image);
+  writer->SetImageIO(writeIO);
+  try
+    {
+    writer->Write();
+    }
+  catch(itk::ExceptionObject &err)
+    {
+    std::cout << "itkHDF5ImageIOChunkedCompressionTest" << std::endl
+              << "Exception Object caught: " << std::endl
+              << err << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  itk::HDF5ImageIO::Pointer readIO = itk::HDF5ImageIO::New();
+  using ReaderType = typename itk::ImageFileReader<ImageType>;
+  typename ReaderType::Pointer reader = ReaderType::New();
+  reader->SetFileName(fileName);
+  reader->SetImageIO(readIO);
+  try
+    {
+    reader->Update();
+    }
+  catch(itk::ExceptionObject &err)
+    {
+    std::cout << "itkHDF5ImageIOChunkedCompressionTest" << std::endl
+              << "Exception Object caught: " << std::endl
+              << err << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // the chunk shape must come back from the file
+  if(readIO->GetChunkDimensions() != chunkDimensions)
+    {
+    std::cout << "Chunk dimensions read from file don't match the "
+              << "dimensions the file was written with" << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // a requested region must be expanded to chunk boundaries, clipped
+  // against the image extent
+  itk::ImageIORegion requestedRegion(3);
+  itk::ImageIORegion expectedRegion(3);
+  for(unsigned int i = 0; i < 3; i++)
+    {
+    requestedRegion.SetIndex(i,5);
+    requestedRegion.SetSize(i,4);
+    expectedRegion.SetIndex(i,4);
+    expectedRegion.SetSize(i,6);
+    }
+  itk::ImageIORegion streamableRegion =
+    readIO->GenerateStreamableReadRegionFromRequestedRegion(requestedRegion);
+  if(streamableRegion != expectedRegion)
+    {
+    std::cout << "Streamable region " << streamableRegion
+              << " isn't the requested region " << requestedRegion
+              << " expanded to chunk boundaries: " << expectedRegion
+              << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  itk::ImageRegionIteratorWithIndex<ImageType>
+    rit( reader->GetOutput(), reader->GetOutput()->GetLargestPossibleRegion() );
+  for(rit.GoToBegin(); !rit.IsAtEnd(); ++rit)
+    {
+    typename ImageType::IndexType idx = rit.GetIndex();
+    TPixel origValue(static_cast<TPixel>(idx[2]*100 + idx[1]*10 + idx[0]));
+    if(itk::Math::NotAlmostEquals( rit.Get(), origValue ))
+      {
+      std::cout << "Original Pixel (" << origValue
+                << ") doesn't match read-in Pixel ("
+                << rit.Get() << ") at " << idx << std::endl;
+      return EXIT_FAILURE;
+      }
+    }
+
+  itk::IOTestHelper::Remove(fileName);
+
+  return EXIT_SUCCESS;
+}
+
+int
+itkHDF5ImageIOChunkedCompressionTest(int ac, char * av [])
+{
+  std::string prefix("");
+  if(ac > 1)
+    {
+    prefix = *++av;
+    --ac;
+    itksys::SystemTools::ChangeDirectory(prefix.c_str());
+    }
+  itk::ObjectFactoryBase::RegisterFactory(itk::HDF5ImageIOFactory::New() );
+
+  int result(0);
+  result += HDF5ChunkedCompressionTest<short>("ChunkedShortImage.hdf5");
+  result += HDF5ChunkedCompressionTest<float>("ChunkedFloatImage.hdf5");
+  result += HDF5ChunkedCompressionTest<itk::RGBPixel<unsigned char> >("ChunkedRGBImage.hdf5");
+  return result != 0;
+}
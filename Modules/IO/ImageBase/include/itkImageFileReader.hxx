@@ -367,6 +367,45 @@ void ImageFileReader< TOutputImage, ConvertPixelTraits >
                  << "Allocating the buffer with the EnlargedRequestedRegion \n"
                  << output->GetRequestedRegion() << "\n");
 
+  // Adopt a memory mapping of the pixel payload instead of allocating
+  // and reading into a buffer, when requested and possible: the pixel
+  // type must need no conversion, the whole image must be read at
+  // once, and the ImageIO must support mapping the current file.
+  if ( m_ImageIO->GetUseMemoryMappedReading() )
+    {
+    m_ImageIO->SetFileName( this->GetFileName().c_str() );
+    m_ImageIO->SetIORegion(m_ActualIORegion);
+
+    ImageIOBase::IOComponentType ioType =
+      ImageIOBase
+      ::MapPixelType< typename ConvertPixelTraits::ComponentType >::CType;
+    if ( m_ImageIO->GetComponentType() == ioType
+         && m_ImageIO->GetNumberOfComponents() == ConvertPixelTraits::GetNumberOfComponents()
+         && m_ActualIORegion.GetNumberOfPixels() == output->GetRequestedRegion().GetNumberOfPixels()
+         && m_ImageIO->CanReadMemoryMapped() )
+      {
+      ImageAllocatorBase::Pointer mappingAllocator;
+      void *mappedBuffer = m_ImageIO->ReadMemoryMapped( mappingAllocator );
+      if ( mappedBuffer != nullptr )
+        {
+        itkDebugMacro(<< "Adopting a memory mapping of the pixel payload");
+
+        using PixelContainerElementType = typename TOutputImage::PixelContainer::Element;
+        const size_t payloadBytes = m_ActualIORegion.GetNumberOfPixels()
+                                    * ( m_ImageIO->GetComponentSize() * m_ImageIO->GetNumberOfComponents() );
+
+        output->SetBufferedRegion( output->GetRequestedRegion() );
+        output->GetPixelContainer()->SetImportPointer(
+          static_cast< PixelContainerElementType * >( mappedBuffer ),
+          static_cast< SizeValueType >( payloadBytes / sizeof( PixelContainerElementType ) ),
+          true, mappingAllocator );
+
+        this->UpdateProgress( 1.0f );
+        return;
+        }
+      }
+    }
+
   // allocated the output image to the size of the enlarge requested region
   this->AllocateOutputs();
 
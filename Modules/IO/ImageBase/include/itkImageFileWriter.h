@@ -23,6 +23,8 @@
 #include "itkImageIOBase.h"
 #include "itkMacro.h"
 
+#include <future>
+
 namespace itk
 {
 /** \brief Base exception class for IO problems during writing.
@@ -146,6 +148,27 @@ public:
    * LargestPossibleRegion. */
   virtual void Write();
 
+  /** \brief Write the input to file on a background thread.
+   *
+   * The pipeline is updated on the calling thread as with Write(), but
+   * the buffer is then snapshotted and handed to a ThreadPool worker
+   * that performs the ImageIO write, so compression and disk flush do
+   * not block the caller. The writer and its input may be reused
+   * immediately. Call WaitForCompletion() to make sure the data is on
+   * disk and to observe any error raised by the background write;
+   * starting another Write() or WriteAsync() first waits for the
+   * pending one. Note that the EndEvent is invoked when the write has
+   * been queued, not when it has finished. Streamed writing
+   * (NumberOfStreamDivisions > 1) and paste regions are not supported
+   * asynchronously. */
+  virtual void WriteAsync();
+
+  /** Wait until a write started by WriteAsync() has finished,
+   * rethrowing any exception the background write raised. Returns
+   * immediately when no write is pending. The destructor waits too,
+   * but absorbs errors. */
+  void WaitForCompletion();
+
   /** Specify the region to write. If left nullptr, then the whole image
    * is written. */
   void SetIORegion(const ImageIORegion & region);
@@ -219,6 +242,11 @@ private:
   bool m_UseInputMetaDataDictionary;        // whether to use the
                                             // MetaDataDictionary from the
                                             // input or not.
+
+  bool m_WriteAsynchronously;               // the current Write() should
+                                            // queue the ImageIO write on a
+                                            // background thread
+  std::future< void > m_BackgroundWrite;    // pending background write, if any
 };
 } // end namespace itk
 
@@ -32,6 +32,7 @@
 #include "itkDiffusionTensor3D.h"
 #include "itkMatrix.h"
 #include "itkImageAlgorithm.h"
+#include "itkThreadPool.h"
 #include <complex>
 
 namespace itk
@@ -48,12 +49,26 @@ ImageFileWriter< TInputImage >
   m_UserSpecifiedIORegion = false;
   m_UserSpecifiedImageIO = false;
   m_NumberOfStreamDivisions = 1;
+  m_WriteAsynchronously = false;
 }
 
 //---------------------------------------------------------
 template< typename TInputImage >
 ImageFileWriter< TInputImage >
-::~ImageFileWriter() = default;
+::~ImageFileWriter()
+{
+  if ( m_BackgroundWrite.valid() )
+    {
+    // a destructor must not throw; use WaitForCompletion() to observe
+    // errors of a background write
+    try
+      {
+      m_BackgroundWrite.get();
+      }
+    catch ( ... )
+      {}
+    }
+}
 
 //---------------------------------------------------------
 template< typename TInputImage >
@@ -109,6 +124,10 @@ ImageFileWriter< TInputImage >
 
   itkDebugMacro(<< "Writing an image file");
 
+  // the ImageIO cannot be reconfigured while a background write still
+  // uses it
+  this->WaitForCompletion();
+
   // Make sure input is available
   if ( input == nullptr )
     {
@@ -368,6 +387,42 @@ ImageFileWriter< TInputImage >
   this->ReleaseInputs();
 }
 
+//---------------------------------------------------------
+template< typename TInputImage >
+void
+ImageFileWriter< TInputImage >
+::WriteAsync()
+{
+  if ( m_NumberOfStreamDivisions > 1 || m_UserSpecifiedIORegion )
+    {
+    itkExceptionMacro(<< "WriteAsync does not support streamed writing or paste regions");
+    }
+
+  m_WriteAsynchronously = true;
+  try
+    {
+    this->Write();
+    }
+  catch ( ... )
+    {
+    m_WriteAsynchronously = false;
+    throw;
+    }
+  m_WriteAsynchronously = false;
+}
+
+//---------------------------------------------------------
+template< typename TInputImage >
+void
+ImageFileWriter< TInputImage >
+::WaitForCompletion()
+{
+  if ( m_BackgroundWrite.valid() )
+    {
+    m_BackgroundWrite.get();
+    }
+}
+
 //---------------------------------------------------------
 template< typename TInputImage >
 void
@@ -422,6 +477,27 @@ ImageFileWriter< TInputImage >
       }
     }
 
+  if ( m_WriteAsynchronously )
+    {
+    // snapshot the region to write so the caller can keep using the
+    // pipeline while the ImageIO compresses and flushes in the
+    // background. WriteAsync forbids streaming, so the buffered region
+    // matched the io region above and a plain copy suffices.
+    InputImagePointer snapshot = InputImageType::New();
+    snapshot->CopyInformation(input);
+    snapshot->SetBufferedRegion(ioRegion);
+    snapshot->Allocate();
+    ImageAlgorithm::Copy( input, snapshot.GetPointer(), ioRegion, ioRegion );
+
+    ImageIOBase::Pointer io = m_ImageIO;
+    m_BackgroundWrite = ThreadPool::GetInstance()->AddWork(
+      [io, snapshot]()
+        {
+        io->Write( (const void *)snapshot->GetBufferPointer() );
+        } );
+    return;
+    }
+
   m_ImageIO->Write(dataPtr);
 }
 
@@ -22,6 +22,7 @@
 #include "itkIOConfigure.h"
 
 #include "itkLightProcessObject.h"
+#include "itkImageAllocatorBase.h"
 #include "itkIndent.h"
 #include "itkImageIORegion.h"
 #include "itkRGBPixel.h"
@@ -215,6 +216,16 @@ public:
   itkGetConstMacro(UseStreamedWriting, bool);
   itkBooleanMacro(UseStreamedWriting);
 
+  /** Set/Get a boolean to request memory-mapped reading. When enabled
+   * and the ImageIO supports it for the current file (see
+   * CanReadMemoryMapped), ImageFileReader adopts a copy-on-write
+   * mapping of the pixel payload instead of reading it into a freshly
+   * allocated buffer, giving zero-copy, page-cache-backed loads of
+   * large uncompressed volumes. */
+  itkSetMacro(UseMemoryMappedReading, bool);
+  itkGetConstMacro(UseMemoryMappedReading, bool);
+  itkBooleanMacro(UseMemoryMappedReading);
+
   /** Set/Get a boolean to perform RGB palette expansion.
     * If true, palette image is read as RGB,
     * if false, palette image is read as Scalar+Palette.
@@ -445,6 +456,35 @@ public:
    */
   const ArrayOfExtensionsType & GetSupportedWriteExtensions() const;
 
+  /** A magic byte signature: the byte offset within the file and the
+   * bytes expected there when the file is in this ImageIO's format. */
+  using MagicByteSignatureType = std::pair< SizeValueType, std::string >;
+  using ArrayOfMagicByteSignaturesType = std::vector< MagicByteSignatureType >;
+
+  /** The magic byte signatures identifying this ImageIO's file formats,
+   * if any. ImageIOFactory reads the header prefix of a file once and
+   * probes the ImageIOs whose signatures match before all others, so a
+   * format with a signature is typically identified with a single
+   * CanReadFile call instead of one per registered ImageIO. An empty
+   * array (the default) means the format has no reliable signature and
+   * the ImageIO is probed after the signature matches. */
+  virtual ArrayOfMagicByteSignaturesType GetMagicByteSignatures() const;
+
+  /** Determine whether the pixel payload of the file set by
+   * ReadImageInformation can be memory mapped directly: the data must
+   * be uncompressed, contiguous, in native byte order and live in a
+   * single file. The default implementation returns false; ImageIOs
+   * that can expose their payload this way override it. */
+  virtual bool CanReadMemoryMapped();
+
+  /** Map the pixel payload of the current file as a private
+   * copy-on-write view and return the address of the first pixel, or
+   * nullptr when the mapping cannot be established, in which case the
+   * caller falls back to Read(). On success the allocator that owns
+   * the mapping is returned through the argument; releasing the buffer
+   * through it unmaps the view. */
+  virtual void * ReadMemoryMapped( ImageAllocatorBase::Pointer & allocator );
+
   template <typename TPixel>
     void SetTypeInfo(const TPixel *);
 
@@ -593,6 +633,10 @@ protected:
   /** Should we use streaming for writing */
   bool m_UseStreamedWriting;
 
+  /** Should reading adopt a memory mapping of the pixel payload when
+   * the ImageIO supports it */
+  bool m_UseMemoryMappedReading;
+
   /** Should we expand RGB palette or stay scalar */
   bool m_ExpandRGBPalette;
 
@@ -697,6 +741,16 @@ protected:
   /** Convenient method to read a buffer as binary. Return true on success. */
   bool ReadBufferAsBinary(std::istream & os, void *buffer, SizeType numberOfBytesToBeRead);
 
+  /** Convenient method to read a contiguous payload concurrently.
+   * Slices of the payload are read into the destination buffer by
+   * thread pool workers, each on its own file descriptor, so large
+   * reads keep the device queue full instead of waiting on one
+   * synchronous stream. Small payloads are read serially. Usable by
+   * any ImageIO whose data is a single contiguous block starting at
+   * fileOffset. Return true on success. */
+  bool ReadBufferAsBinaryParallel(const std::string & fileName, SizeType fileOffset,
+                                  void *buffer, SizeType numberOfBytesToBeRead);
+
   /** Insert an extension to the list of supported extensions for reading. */
   void AddSupportedReadExtension(const char *extension);
 
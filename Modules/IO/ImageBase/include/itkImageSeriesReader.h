@@ -162,6 +162,20 @@ public:
   itkGetConstReferenceMacro(UseStreaming, bool);
   itkBooleanMacro(UseStreaming);
 
+  /** Set/Get whether the slices of the series are decoded
+   * concurrently. Each slice is then read through its own reader and
+   * ImageIO instance directly into its offset of the pre-allocated
+   * output volume, which speeds up series of individually compressed
+   * slices, such as DICOM, considerably. When an ImageIO has been set
+   * with SetImageIO, every worker uses a fresh instance of the same
+   * ImageIO class; settings made on the provided instance are not
+   * replicated, so leave this off for specially configured ImageIOs.
+   * The MetaDataDictionary array is assembled in slice order
+   * regardless of completion order. Off by default. */
+  itkSetMacro(UseParallelReading, bool);
+  itkGetConstMacro(UseParallelReading, bool);
+  itkBooleanMacro(UseParallelReading);
+
 protected:
   ImageSeriesReader() :
     m_ImageIO(nullptr)
@@ -198,11 +212,28 @@ protected:
 
   bool m_UseStreaming{true};
 
+  bool m_UseParallelReading{false};
+
 private:
   using ReaderType = ImageFileReader< TOutputImage >;
 
   int ComputeMovingDimensionIndex(ReaderType *reader);
 
+  /** Read the i-th slice of the series into the output volume, as part
+   * of GenerateData. Returns a deep copy of the slice ImageIO's
+   * MetaDataDictionary when updateMetaDataDictionary is set and the
+   * slice was opened, nullptr otherwise. The caller owns the returned
+   * dictionary. Distinct slices write to disjoint regions of the
+   * output buffer, so this method may be invoked concurrently for
+   * different slice indices when each invocation is given its own
+   * ImageIO (or nullptr for factory selection). */
+  DictionaryRawPointer ReadSliceIntoOutput(int i,
+                                           const ImageRegionType & requestedRegion,
+                                           const ImageRegionType & sliceRegionToRequest,
+                                           const SizeType & validSize,
+                                           bool updateMetaDataDictionary,
+                                           ImageIOBase *imageIO);
+
   /** Modified time of the MetaDataDictionaryArray */
   TimeStamp m_MetaDataDictionaryArrayMTime;
 
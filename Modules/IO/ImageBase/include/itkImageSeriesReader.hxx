@@ -55,6 +55,7 @@ void ImageSeriesReader< TOutputImage >
   os << indent << "ReverseOrder: " << m_ReverseOrder << std::endl;
   os << indent << "ForceOrthogonalDirection: " << m_ForceOrthogonalDirection << std::endl;
   os << indent << "UseStreaming: " << m_UseStreaming << std::endl;
+  os << indent << "UseParallelReading: " << m_UseParallelReading << std::endl;
 
   itkPrintSelfObjectMacro( ImageIO );
 
@@ -281,11 +282,6 @@ void ImageSeriesReader< TOutputImage >
   output->SetBufferedRegion(requestedRegion);
   output->Allocate();
 
-  // progress reported on a per slice basis
-  ProgressReporter progress(this, 0,
-                            requestedRegion.GetSize(TOutputImage::ImageDimension-1),
-                            100);
-
   // We utilize the modified time of the output information to
   // know when the meta array needs to be updated, when the output
   // information is updated so should the meta array.
@@ -295,147 +291,228 @@ void ImageSeriesReader< TOutputImage >
     this->m_OutputInformationMTime > this->m_MetaDataDictionaryArrayMTime
     && m_MetaDataDictionaryArrayUpdate;
 
-  typename  TOutputImage::InternalPixelType *outputBuffer = output->GetBufferPointer();
-  IndexType                           sliceStartIndex = requestedRegion.GetIndex();
   const auto numberOfFiles = static_cast< int >( m_FileNames.size() );
 
-  for ( int i = 0; i != numberOfFiles; ++i )
+  if ( m_UseParallelReading && numberOfFiles > 1 )
     {
-    if ( TOutputImage::ImageDimension != this->m_NumberOfDimensionsInImage )
+    // Decode slices concurrently: slices map to disjoint regions of
+    // the output buffer and every worker gets its own reader and
+    // ImageIO instance. Dictionaries are collected per slice index so
+    // the array is assembled in slice order regardless of completion
+    // order.
+    std::vector< DictionaryRawPointer > sliceDictionaries(numberOfFiles, nullptr);
+    const float progressPerSlice = 1.0f / static_cast< float >( numberOfFiles );
+
+    this->GetMultiThreader()->ParallelizeArray(
+      0, static_cast< SizeValueType >( numberOfFiles ),
+      [this, &requestedRegion, &sliceRegionToRequest, &validSize,
+       needToUpdateMetaDataDictionaryArray, &sliceDictionaries, progressPerSlice]
+      ( SizeValueType i )
+        {
+        ImageIOBase::Pointer sliceImageIO;
+        if ( this->m_ImageIO )
+          {
+          // a fresh per-worker instance of the same ImageIO class
+          sliceImageIO = dynamic_cast< ImageIOBase * >(
+            this->m_ImageIO->CreateAnother().GetPointer() );
+          }
+        sliceDictionaries[i] = this->ReadSliceIntoOutput(
+          static_cast< int >( i ), requestedRegion, sliceRegionToRequest,
+          validSize, needToUpdateMetaDataDictionaryArray, sliceImageIO );
+        this->IncrementProgress(progressPerSlice);
+        },
+      nullptr );
+
+    for ( int i = 0; i < numberOfFiles; ++i )
       {
-      sliceStartIndex[this->m_NumberOfDimensionsInImage] = i;
+      if ( sliceDictionaries[i] )
+        {
+        m_MetaDataDictionaryArray.push_back(sliceDictionaries[i]);
+        }
       }
+    }
+  else
+    {
+    // progress reported on a per slice basis
+    ProgressReporter progress(this, 0,
+                              requestedRegion.GetSize(TOutputImage::ImageDimension - 1),
+                              100);
 
-    const bool insideRequestedRegion = requestedRegion.IsInside(sliceStartIndex);
-    const int  iFileName = ( m_ReverseOrder ? numberOfFiles - i - 1 : i );
+    IndexType sliceStartIndex = requestedRegion.GetIndex();
 
-    // check if we need this slice
-    if ( !insideRequestedRegion && !needToUpdateMetaDataDictionaryArray )
+    for ( int i = 0; i != numberOfFiles; ++i )
       {
-      continue;
-      }
+      if ( TOutputImage::ImageDimension != this->m_NumberOfDimensionsInImage )
+        {
+        sliceStartIndex[this->m_NumberOfDimensionsInImage] = i;
+        }
 
-    // configure reader
-    typename ReaderType::Pointer reader = ReaderType::New();
-    reader->SetFileName( m_FileNames[iFileName].c_str() );
+      DictionaryRawPointer sliceDictionary = this->ReadSliceIntoOutput(
+        i, requestedRegion, sliceRegionToRequest, validSize,
+        needToUpdateMetaDataDictionaryArray, m_ImageIO );
 
-    TOutputImage * readerOutput = reader->GetOutput();
+      if ( sliceDictionary )
+        {
+        m_MetaDataDictionaryArray.push_back(sliceDictionary);
+        }
 
-    if ( m_ImageIO )
-      {
-      reader->SetImageIO(m_ImageIO);
-      }
-    reader->SetUseStreaming(m_UseStreaming);
-    readerOutput->SetRequestedRegion(sliceRegionToRequest);
+      if ( requestedRegion.IsInside(sliceStartIndex) )
+        {
+        // report progress for read slices
+        progress.CompletedPixel();
+        }
+      } // end per slice loop
+    }
+
+  // update the time if we modified the meta array
+  if ( needToUpdateMetaDataDictionaryArray )
+    {
+    m_MetaDataDictionaryArrayMTime.Modified();
+    }
+}
+
+template< typename TOutputImage >
+typename ImageSeriesReader< TOutputImage >::DictionaryRawPointer
+ImageSeriesReader< TOutputImage >
+::ReadSliceIntoOutput(int i,
+                      const ImageRegionType & requestedRegion,
+                      const ImageRegionType & sliceRegionToRequest,
+                      const SizeType & validSize,
+                      bool updateMetaDataDictionary,
+                      ImageIOBase *imageIO)
+{
+  TOutputImage *output = this->GetOutput();
+
+  const auto numberOfFiles = static_cast< int >( m_FileNames.size() );
+
+  IndexType sliceStartIndex = requestedRegion.GetIndex();
+  if ( TOutputImage::ImageDimension != this->m_NumberOfDimensionsInImage )
+    {
+    sliceStartIndex[this->m_NumberOfDimensionsInImage] = i;
+    }
+
+  const bool insideRequestedRegion = requestedRegion.IsInside(sliceStartIndex);
+  const int  iFileName = ( m_ReverseOrder ? numberOfFiles - i - 1 : i );
+
+  // check if we need this slice
+  if ( !insideRequestedRegion && !updateMetaDataDictionary )
+    {
+    return nullptr;
+    }
+
+  // configure reader
+  typename ReaderType::Pointer reader = ReaderType::New();
+  reader->SetFileName( m_FileNames[iFileName].c_str() );
+
+  TOutputImage * readerOutput = reader->GetOutput();
+
+  if ( imageIO )
+    {
+    reader->SetImageIO(imageIO);
+    }
+  reader->SetUseStreaming(m_UseStreaming);
+  readerOutput->SetRequestedRegion(sliceRegionToRequest);
+
+  // update the data or info
+  if ( !insideRequestedRegion )
+    {
+    reader->UpdateOutputInformation();
+    }
+  else
+    {
+    // read the meta data information
+    readerOutput->UpdateOutputInformation();
+
+    // propagate the requested region to determin what the region
+    // will actually be read
+    readerOutput->PropagateRequestedRegion();
 
-    // update the data or info
-    if ( !insideRequestedRegion )
+    // check that the size of each slice is the same
+    if ( readerOutput->GetLargestPossibleRegion().GetSize() != validSize )
       {
-      reader->UpdateOutputInformation();
+      itkExceptionMacro( << "Size mismatch! The size of  "
+                         << m_FileNames[iFileName].c_str()
+                         << " is "
+                         << readerOutput->GetLargestPossibleRegion().GetSize()
+                         << " and does not match the required size "
+                         << validSize
+                         << " from file "
+                         << m_FileNames[m_ReverseOrder ? numberOfFiles - 1 : 0].c_str() );
       }
-    else
-      {
-      // read the meta data information
-      readerOutput->UpdateOutputInformation();
-
-      // propagate the requested region to determin what the region
-      // will actually be read
-      readerOutput->PropagateRequestedRegion();
 
-      // check that the size of each slice is the same
-      if ( readerOutput->GetLargestPossibleRegion().GetSize() != validSize )
-        {
-        itkExceptionMacro( << "Size mismatch! The size of  "
-                           << m_FileNames[iFileName].c_str()
-                           << " is "
-                           << readerOutput->GetLargestPossibleRegion().GetSize()
-                           << " and does not match the required size "
-                           << validSize
-                           << " from file "
-                           << m_FileNames[m_ReverseOrder ? numberOfFiles - 1 : 0].c_str() );
-        }
+    // get the size of the region to be read
+    SizeType readSize = readerOutput->GetRequestedRegion().GetSize();
 
-      // get the size of the region to be read
-      SizeType readSize = readerOutput->GetRequestedRegion().GetSize();
+    if( readSize == sliceRegionToRequest.GetSize() )
+      {
+      // if the buffer of the ImageReader is going to match that of
+      // ourselves, then set the ImageReader's buffer to a section
+      // of ours
 
-      if( readSize == sliceRegionToRequest.GetSize() )
-        {
-        // if the buffer of the ImageReader is going to match that of
-        // ourselves, then set the ImageReader's buffer to a section
-        // of ours
+      typename  TOutputImage::InternalPixelType *outputBuffer = output->GetBufferPointer();
 
-        const size_t  numberOfPixelsInSlice = sliceRegionToRequest.GetNumberOfPixels();
+      const size_t  numberOfPixelsInSlice = sliceRegionToRequest.GetNumberOfPixels();
 
-        using AccessorFunctorType = typename TOutputImage::AccessorFunctorType;
-        const size_t      numberOfInternalComponentsPerPixel =  AccessorFunctorType::GetVectorLength( output );
+      using AccessorFunctorType = typename TOutputImage::AccessorFunctorType;
+      const size_t      numberOfInternalComponentsPerPixel =  AccessorFunctorType::GetVectorLength( output );
 
 
-        const ptrdiff_t   sliceOffset = ( TOutputImage::ImageDimension != this->m_NumberOfDimensionsInImage ) ?
-          ( i - requestedRegion.GetIndex(this->m_NumberOfDimensionsInImage)) : 0;
+      const ptrdiff_t   sliceOffset = ( TOutputImage::ImageDimension != this->m_NumberOfDimensionsInImage ) ?
+        ( i - requestedRegion.GetIndex(this->m_NumberOfDimensionsInImage)) : 0;
 
-        const ptrdiff_t  numberOfPixelComponentsUpToSlice =  numberOfPixelsInSlice * numberOfInternalComponentsPerPixel * sliceOffset;
-        const bool       bufferDelete = false;
+      const ptrdiff_t  numberOfPixelComponentsUpToSlice =  numberOfPixelsInSlice * numberOfInternalComponentsPerPixel * sliceOffset;
+      const bool       bufferDelete = false;
 
-        typename  TOutputImage::InternalPixelType * outputSliceBuffer = outputBuffer + numberOfPixelComponentsUpToSlice;
+      typename  TOutputImage::InternalPixelType * outputSliceBuffer = outputBuffer + numberOfPixelComponentsUpToSlice;
 
-        if ( strcmp(output->GetNameOfClass(), "VectorImage") == 0 )
-          {
-          // if the input image type is a vector image then the number
-          // of components needs to be set for the size
-          readerOutput->GetPixelContainer()->SetImportPointer( outputSliceBuffer,
-                                                               static_cast<unsigned long>( numberOfPixelsInSlice*numberOfInternalComponentsPerPixel ),
-                                                               bufferDelete );
-          }
-        else
-          {
-          // otherwise the actual number of pixels needs to be passed
-          readerOutput->GetPixelContainer()->SetImportPointer( outputSliceBuffer,
-                                                               static_cast<unsigned long>( numberOfPixelsInSlice ),
-                                                               bufferDelete );
-          }
-        readerOutput->UpdateOutputData();
+      if ( strcmp(output->GetNameOfClass(), "VectorImage") == 0 )
+        {
+        // if the input image type is a vector image then the number
+        // of components needs to be set for the size
+        readerOutput->GetPixelContainer()->SetImportPointer( outputSliceBuffer,
+                                                             static_cast<unsigned long>( numberOfPixelsInSlice*numberOfInternalComponentsPerPixel ),
+                                                             bufferDelete );
         }
       else
         {
-        // the read region isn't going to match exactly what we need
-        // to update to buffer created by the reader, then copy
-
-        reader->Update();
-
-        // output of buffer copy
-        ImageRegionType outRegion = requestedRegion;
-        outRegion.SetIndex( sliceStartIndex );
+        // otherwise the actual number of pixels needs to be passed
+        readerOutput->GetPixelContainer()->SetImportPointer( outputSliceBuffer,
+                                                             static_cast<unsigned long>( numberOfPixelsInSlice ),
+                                                             bufferDelete );
+        }
+      readerOutput->UpdateOutputData();
+      }
+    else
+      {
+      // the read region isn't going to match exactly what we need
+      // to update to buffer created by the reader, then copy
 
-        // set the moving dimension to a size of 1
-        if ( TOutputImage::ImageDimension != this->m_NumberOfDimensionsInImage )
-          {
-          outRegion.SetSize(this->m_NumberOfDimensionsInImage, 1);
-          }
+      reader->Update();
 
-        ImageAlgorithm::Copy( readerOutput, output, sliceRegionToRequest, outRegion );
+      // output of buffer copy
+      ImageRegionType outRegion = requestedRegion;
+      outRegion.SetIndex( sliceStartIndex );
 
+      // set the moving dimension to a size of 1
+      if ( TOutputImage::ImageDimension != this->m_NumberOfDimensionsInImage )
+        {
+        outRegion.SetSize(this->m_NumberOfDimensionsInImage, 1);
         }
 
-      // report progress for read slices
-      progress.CompletedPixel();
+      ImageAlgorithm::Copy( readerOutput, output, sliceRegionToRequest, outRegion );
 
-     } // end !insidedRequestedRegion
-
-    // Deep copy the MetaDataDictionary into the array
-    if ( reader->GetImageIO() &&  needToUpdateMetaDataDictionaryArray )
-      {
-      auto newDictionary = new DictionaryType;
-      *newDictionary = reader->GetImageIO()->GetMetaDataDictionary();
-      m_MetaDataDictionaryArray.push_back(newDictionary);
       }
+    } // end !insidedRequestedRegion
 
-    } // end per slice loop
-
-  // update the time if we modified the meta array
-  if ( needToUpdateMetaDataDictionaryArray )
+  // Deep copy the MetaDataDictionary into the array
+  if ( reader->GetImageIO() && updateMetaDataDictionary )
     {
-    m_MetaDataDictionaryArrayMTime.Modified();
+    auto newDictionary = new DictionaryType;
+    *newDictionary = reader->GetImageIO()->GetMetaDataDictionary();
+    return newDictionary;
     }
+
+  return nullptr;
 }
 
 template< typename TOutputImage >
@@ -199,6 +199,19 @@ public:
   itkGetConstReferenceMacro(UseCompression, bool);
   itkBooleanMacro(UseCompression);
 
+  /** Set/Get the maximum number of slices encoded and written
+   * concurrently. The output files are independent, so each slice is
+   * copied into its own buffer and dispatched to the global thread
+   * pool; this bound also limits the number of slice buffers alive at
+   * once. A value of 1 restores the fully serial behavior. The default
+   * is the number of work units of this filter. Slices are always
+   * written serially when an ImageIO instance has been set with
+   * SetImageIO() (or a MetaDataDictionaryArray is used), because that
+   * single instance and its MetaDataDictionary are shared by every
+   * slice. */
+  itkSetClampMacro(MaximumNumberOfConcurrentWrites, unsigned int, 1, ITK_MAX_THREADS);
+  itkGetConstMacro(MaximumNumberOfConcurrentWrites, unsigned int);
+
 protected:
   ImageSeriesWriter();
   ~ImageSeriesWriter() override;
@@ -231,6 +244,9 @@ private:
 
   bool m_UseCompression;
 
+  /** Upper bound on the number of slices in flight on the thread pool. */
+  unsigned int m_MaximumNumberOfConcurrentWrites;
+
   /** Array of MetaDataDictionary used for passing information to each slice */
   DictionaryArrayRawPointer m_MetaDataDictionaryArray{nullptr};
 
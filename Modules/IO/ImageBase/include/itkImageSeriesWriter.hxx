@@ -26,8 +26,11 @@
 #include "itkImageAlgorithm.h"
 #include "itkMetaDataObject.h"
 #include "itkArray.h"
+#include "itkThreadPool.h"
 #include "vnl/algo/vnl_determinant.h"
 #include <cstdio>
+#include <deque>
+#include <future>
 
 #if defined(_MSC_VER)
 #define snprintf _snprintf
@@ -43,6 +46,7 @@ ImageSeriesWriter< TInputImage, TOutputImage >
   m_SeriesFormat("%d")
 {
   m_UseCompression = false;
+  m_MaximumNumberOfConcurrentWrites = this->GetNumberOfWorkUnits();
 }
 
 //---------------------------------------------------------
@@ -273,6 +277,21 @@ ImageSeriesWriter< TInputImage, TOutputImage >
                             expectedNumberOfFiles,
                             expectedNumberOfFiles);
 
+  // Each output file is independent of the others, so the per-slice
+  // copy, encode and write can run concurrently on the global thread
+  // pool. When the user has supplied an ImageIO instance it is shared
+  // by every slice -- its MetaDataDictionary is even updated per slice
+  // -- so that path (which includes the MetaDataDictionaryArray
+  // mechanism) stays serial.
+  unsigned int numberOfConcurrentWrites = m_MaximumNumberOfConcurrentWrites;
+  if ( m_ImageIO || m_MetaDataDictionaryArray )
+    {
+    numberOfConcurrentWrites = 1;
+    }
+
+  ThreadPool * threadPool = ThreadPool::GetInstance();
+  std::deque< std::future< void > > pendingWrites;
+
   // For each "slice" in the input, copy the region to the output,
   // build a filename and write the file.
 
@@ -284,6 +303,44 @@ ImageSeriesWriter< TInputImage, TOutputImage >
     inRegion.SetIndex(inIndex);
     inRegion.SetSize(inSize);
 
+    if ( numberOfConcurrentWrites > 1 )
+      {
+      // Each slice in flight needs its own buffer; the shared
+      // outputImage already carries the slice geometry.
+      typename OutputImageType::Pointer sliceImage = OutputImageType::New();
+      sliceImage->CopyInformation( outputImage );
+      sliceImage->SetRegions(outRegion);
+      sliceImage->SetNumberOfComponentsPerPixel( inputImage->GetNumberOfComponentsPerPixel() );
+      sliceImage->Allocate();
+
+      ImageAlgorithm::Copy(inputImage, sliceImage.GetPointer(), inRegion, outRegion);
+
+      const std::string fileName = m_FileNames[slice];
+      const bool useCompression = m_UseCompression;
+      pendingWrites.push_back( threadPool->AddWork(
+        [sliceImage, fileName, useCompression]
+          {
+          typename WriterType::Pointer writer = WriterType::New();
+          writer->UseInputMetaDataDictionaryOff();
+          writer->SetInput(sliceImage);
+          writer->SetFileName( fileName.c_str() );
+          writer->SetUseCompression(useCompression);
+          writer->Update();
+          } ) );
+
+      // Bound the number of slices (and slice buffers) in flight.
+      // get() rethrows any exception from the write.
+      while ( pendingWrites.size() >= numberOfConcurrentWrites )
+        {
+        pendingWrites.front().get();
+        pendingWrites.pop_front();
+        progress.CompletedPixel();
+        }
+
+      offset += pixelsPerFile;
+      continue;
+      }
+
     // Copy the selected "slice" into the output image.
     ImageAlgorithm::Copy(inputImage, outputImage.GetPointer(), inRegion, outRegion);
 
@@ -368,6 +425,14 @@ ImageSeriesWriter< TInputImage, TOutputImage >
     progress.CompletedPixel();
     offset += pixelsPerFile;
     }
+
+  // Wait for the writes still in flight.
+  while ( !pendingWrites.empty() )
+    {
+    pendingWrites.front().get();
+    pendingWrites.pop_front();
+    progress.CompletedPixel();
+    }
 }
 
 //---------------------------------------------------------
@@ -392,6 +457,7 @@ ImageSeriesWriter< TInputImage, TOutputImage >
   os << indent << "IncrementIndex: " << m_IncrementIndex << std::endl;
   os << indent << "SeriesFormat: " << m_SeriesFormat << std::endl;
   os << indent << "MetaDataDictionaryArray: " << m_MetaDataDictionaryArray << std::endl;
+  os << indent << "MaximumNumberOfConcurrentWrites: " << m_MaximumNumberOfConcurrentWrites << std::endl;
 
   if ( m_UseCompression )
     {
@@ -0,0 +1,99 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkMemoryMappedFileAllocator_h
+#define itkMemoryMappedFileAllocator_h
+#include "ITKIOImageBaseExport.h"
+
+#include "itkImageAllocatorBase.h"
+#include <string>
+
+namespace itk
+{
+/** \class MemoryMappedFileAllocator
+ * \brief Adopts a memory-mapped view of a file region as an image buffer.
+ *
+ * This allocator does not allocate memory: MapFileRegion() maps a region
+ * of a file as a private copy-on-write view and Deallocate() releases the
+ * mapping. An ImageIO that supports memory-mapped reading hands the
+ * mapped pixel payload together with an instance of this class to
+ * ImageFileReader, which imports both into the output image's
+ * ImportImageContainer; the mapping then lives exactly as long as the
+ * pixel buffer.
+ *
+ * The view is copy-on-write, so the image buffer can be modified in
+ * place without affecting the file, while unmodified pages stay backed
+ * by the page cache and are shared between processes reading the same
+ * file.
+ *
+ * Each instance manages at most one mapping. On platforms without a
+ * supported mapping primitive MapFileRegion() returns nullptr and the
+ * caller falls back to buffered reading.
+ *
+ * \sa ImageAllocatorBase
+ * \sa ImageIOBase
+ * \ingroup IOFilters
+ * \ingroup ITKIOImageBase
+ */
+class ITKIOImageBase_EXPORT MemoryMappedFileAllocator:public ImageAllocatorBase
+{
+public:
+  ITK_DISALLOW_COPY_AND_ASSIGN(MemoryMappedFileAllocator);
+
+  /** Standard class type aliases. */
+  using Self = MemoryMappedFileAllocator;
+  using Superclass = ImageAllocatorBase;
+  using Pointer = SmartPointer< Self >;
+  using ConstPointer = SmartPointer< const Self >;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(MemoryMappedFileAllocator, ImageAllocatorBase);
+
+  /** Map numberOfBytes bytes of the file starting at offset as a
+   * private copy-on-write view. The offset is aligned down to the
+   * system page granularity internally. Returns the address of the
+   * byte at offset, or nullptr when the mapping fails or is not
+   * supported on this platform. */
+  void * MapFileRegion(const std::string & fileName,
+                       SizeValueType offset,
+                       SizeValueType numberOfBytes);
+
+  /** This allocator only adopts file mappings; requesting a plain
+   * allocation is an error. */
+  void * Allocate(SizeValueType numberOfBytes) override;
+
+  /** Release the mapping containing the buffer. */
+  void Deallocate(void *buffer, SizeValueType numberOfBytes) override;
+
+protected:
+  MemoryMappedFileAllocator();
+  ~MemoryMappedFileAllocator() override;
+
+  void PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  /** Base address and length of the page-aligned mapping, which may
+   * start before the requested offset. */
+  void *        m_MappedBase{ nullptr };
+  SizeValueType m_MappedLength{ 0 };
+};
+} // end namespace itk
+
+#endif // itkMemoryMappedFileAllocator_h
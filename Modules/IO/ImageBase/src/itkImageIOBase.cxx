@@ -18,9 +18,13 @@
 
 #include "itkImageIOBase.h"
 #include "itkImageRegionSplitterSlowDimension.h"
+#include "itkMultiThreaderBase.h"
+#include "itkThreadPool.h"
 #include <mutex>
 #include "itksys/SystemTools.hxx"
 
+#include <exception>
+#include <future>
 #include <iterator>
 
 namespace itk
@@ -45,6 +49,7 @@ void ImageIOBase::Reset(const bool)
   m_UseCompression = false;
   m_UseStreamedReading = false;
   m_UseStreamedWriting = false;
+  m_UseMemoryMappedReading = false;
   m_ExpandRGBPalette   = true;
   m_IsReadAsScalarPlusPalette  = false;
 
@@ -64,6 +69,28 @@ ImageIOBase::GetSupportedReadExtensions() const
   return this->m_SupportedReadExtensions;
 }
 
+ImageIOBase::ArrayOfMagicByteSignaturesType
+ImageIOBase::GetMagicByteSignatures() const
+{
+  // No reliable signature by default; the factory probes this ImageIO
+  // after those whose signatures match.
+  return ArrayOfMagicByteSignaturesType();
+}
+
+bool
+ImageIOBase::CanReadMemoryMapped()
+{
+  // Only ImageIOs that can expose their pixel payload as a contiguous
+  // native-order region of a single file support memory-mapped reading.
+  return false;
+}
+
+void *
+ImageIOBase::ReadMemoryMapped( ImageAllocatorBase::Pointer & itkNotUsed( allocator ) )
+{
+  return nullptr;
+}
+
 void ImageIOBase::AddSupportedReadExtension(const char *extension)
 {
   this->m_SupportedReadExtensions.push_back(extension);
@@ -328,6 +355,88 @@ ImageIOBase
   return true;
 }
 
+bool
+ImageIOBase
+::ReadBufferAsBinaryParallel(const std::string & fileName, SizeType fileOffset,
+                             void *buffer, SizeType numberOfBytesToBeRead)
+{
+  // slices small enough to finish quickly defeat the purpose; reads
+  // below two slices are not worth a second descriptor
+  constexpr SizeType sliceBytes = SizeType(16) << 20;
+
+  const auto numberOfWorkers = static_cast< ThreadIdType >(
+    std::min< SizeType >(MultiThreaderBase::GetGlobalDefaultNumberOfThreads(),
+                         numberOfBytesToBeRead / sliceBytes) );
+
+  // each worker reads its slice of the payload into its slice of the
+  // buffer through a private stream, so the reads proceed concurrently
+  auto readSlice = [this, &fileName, fileOffset, buffer](SizeType sliceOffset,
+                                                         SizeType sliceSize) -> bool
+    {
+    std::ifstream file;
+    this->OpenFileForReading(file, fileName);
+    file.seekg( static_cast< std::streamoff >( fileOffset + sliceOffset ),
+                std::ios::beg );
+    if ( file.fail() )
+      {
+      return false;
+      }
+    return this->ReadBufferAsBinary(file,
+                                    static_cast< char * >( buffer ) + sliceOffset,
+                                    sliceSize);
+    };
+
+  if ( numberOfWorkers < 2 || ThreadPool::IsPoolWorker() )
+    {
+    // small read, or already running on a pool worker: read in place
+    // rather than deadlocking the pool with nested work
+    return readSlice(0, numberOfBytesToBeRead);
+    }
+
+  const SizeType bytesPerWorker = numberOfBytesToBeRead / numberOfWorkers;
+  ThreadPool::Pointer pool = ThreadPool::GetInstance();
+  std::vector< std::future< bool > > futures;
+  for ( ThreadIdType worker = 1; worker < numberOfWorkers; worker++ )
+    {
+    const SizeType sliceOffset = worker * bytesPerWorker;
+    const SizeType sliceSize = ( worker + 1 < numberOfWorkers )
+                               ? bytesPerWorker
+                               : numberOfBytesToBeRead - sliceOffset;
+    futures.push_back( pool->AddWork(readSlice, sliceOffset, sliceSize) );
+    }
+  bool succeeded = true;
+  std::exception_ptr firstError;
+  try
+    {
+    succeeded = readSlice(0, bytesPerWorker);
+    }
+  catch ( ... )
+    {
+    firstError = std::current_exception();
+    }
+  // join every worker before reporting an error: they write into the
+  // caller's buffer
+  for ( auto & future : futures )
+    {
+    try
+      {
+      succeeded = future.get() && succeeded;
+      }
+    catch ( ... )
+      {
+      if ( !firstError )
+        {
+        firstError = std::current_exception();
+        }
+      }
+    }
+  if ( firstError )
+    {
+    std::rethrow_exception(firstError);
+    }
+  return succeeded;
+}
+
 unsigned int ImageIOBase::GetPixelSize() const
 {
   if ( m_ComponentType == UNKNOWNCOMPONENTTYPE
@@ -1192,6 +1301,14 @@ void ImageIOBase::PrintSelf(std::ostream & os, Indent indent) const
     {
     os << indent << "UseStreamedWriting: Off" << std::endl;
     }
+  if( m_UseMemoryMappedReading )
+    {
+    os << indent << "UseMemoryMappedReading: On" << std::endl;
+    }
+  else
+    {
+    os << indent << "UseMemoryMappedReading: Off" << std::endl;
+    }
   if( m_ExpandRGBPalette )
     {
     os << indent << "ExpandRGBPalette: On" << std::endl;
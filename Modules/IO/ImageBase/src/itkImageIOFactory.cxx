@@ -18,6 +18,7 @@
 
 #include "itkImageIOFactory.h"
 
+#include <fstream>
 #include <mutex>
 
 
@@ -27,6 +28,26 @@ namespace itk
 namespace
 {
 std::mutex createImageIOLock;
+
+// How much of the file start is read for magic byte matching. Large
+// enough for the DICOM preamble (128 bytes) plus its "DICM" marker and
+// the NIfTI magic at offset 344.
+constexpr size_t maxMagicBytePrefixLength = 512;
+
+// Does any of the ImageIO's signatures match the header prefix?
+bool
+MatchesMagicBytes(const ImageIOBase * io, const std::string & headerPrefix)
+{
+  for ( const ImageIOBase::MagicByteSignatureType & signature : io->GetMagicByteSignatures() )
+    {
+    if ( signature.first + signature.second.size() <= headerPrefix.size()
+         && headerPrefix.compare( signature.first, signature.second.size(), signature.second ) == 0 )
+      {
+      return true;
+      }
+    }
+  return false;
+}
 }
 
 ImageIOBase::Pointer
@@ -50,16 +71,50 @@ ImageIOFactory::CreateImageIO(const char *path, FileModeType mode)
                 << std::endl;
       }
     }
-  for (auto & k : possibleImageIO)
+  if ( mode == ReadMode )
     {
-    if ( mode == ReadMode )
+    // Read the header prefix once and probe the ImageIOs whose magic
+    // byte signatures match it before all others. A format with a
+    // signature is then identified by a single CanReadFile call,
+    // instead of every registered ImageIO opening the file in turn.
+    std::string headerPrefix;
+    std::ifstream file( path, std::ios::in | std::ios::binary );
+    if ( file )
+      {
+      char prefixBuffer[maxMagicBytePrefixLength];
+      file.read( prefixBuffer, maxMagicBytePrefixLength );
+      headerPrefix.assign( prefixBuffer, static_cast< size_t >( file.gcount() ) );
+      file.close();
+      }
+
+    std::list< ImageIOBase::Pointer > signatureMismatches;
+    for (auto & k : possibleImageIO)
+      {
+      if ( MatchesMagicBytes( k, headerPrefix ) )
+        {
+        if ( k->CanReadFile(path) )
+          {
+          return k;
+          }
+        }
+      else
+        {
+        signatureMismatches.emplace_back(k);
+        }
+      }
+    // Fall back to full probing; signatures are advisory only and a
+    // file may still be readable by an ImageIO without one.
+    for (auto & k : signatureMismatches)
       {
       if ( k->CanReadFile(path) )
         {
         return k;
         }
       }
-    else if ( mode == WriteMode )
+    }
+  else if ( mode == WriteMode )
+    {
+    for (auto & k : possibleImageIO)
       {
       if ( k->CanWriteFile(path) )
         {
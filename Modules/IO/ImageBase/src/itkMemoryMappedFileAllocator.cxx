@@ -0,0 +1,162 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkMemoryMappedFileAllocator.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(ITK_USE_PTHREADS)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace itk
+{
+
+MemoryMappedFileAllocator::MemoryMappedFileAllocator() = default;
+
+MemoryMappedFileAllocator::~MemoryMappedFileAllocator()
+{
+  if ( m_MappedBase != nullptr )
+    {
+    this->Deallocate( m_MappedBase, m_MappedLength );
+    }
+}
+
+void *
+MemoryMappedFileAllocator
+::MapFileRegion(const std::string & fileName,
+                SizeValueType offset,
+                SizeValueType numberOfBytes)
+{
+  if ( m_MappedBase != nullptr )
+    {
+    itkExceptionMacro( "This allocator already manages a mapping" );
+    }
+
+#if defined(_WIN32)
+  HANDLE file = CreateFileA( fileName.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                             nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr );
+  if ( file == INVALID_HANDLE_VALUE )
+    {
+    return nullptr;
+    }
+
+  HANDLE mapping = CreateFileMappingA( file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr );
+  // The file handle can be closed once the mapping exists.
+  CloseHandle( file );
+  if ( mapping == nullptr )
+    {
+    return nullptr;
+    }
+
+  // MapViewOfFile requires the offset to be a multiple of the
+  // allocation granularity.
+  SYSTEM_INFO systemInfo;
+  GetSystemInfo( &systemInfo );
+  const SizeValueType alignedOffset = offset - offset % systemInfo.dwAllocationGranularity;
+  const SizeValueType alignmentSlop = offset - alignedOffset;
+
+  void *base = MapViewOfFile( mapping, FILE_MAP_COPY,
+                              static_cast< DWORD >( ( alignedOffset >> 32 ) & 0xffffffff ),
+                              static_cast< DWORD >( alignedOffset & 0xffffffff ),
+                              static_cast< SIZE_T >( numberOfBytes + alignmentSlop ) );
+  // The view keeps its own reference to the mapping object.
+  CloseHandle( mapping );
+  if ( base == nullptr )
+    {
+    return nullptr;
+    }
+
+  m_MappedBase = base;
+  m_MappedLength = numberOfBytes + alignmentSlop;
+  return static_cast< char * >( base ) + alignmentSlop;
+#elif defined(ITK_USE_PTHREADS)
+  const int fd = open( fileName.c_str(), O_RDONLY );
+  if ( fd < 0 )
+    {
+    return nullptr;
+    }
+
+  // mmap requires a page-aligned file offset.
+  const auto pageSize = static_cast< SizeValueType >( sysconf( _SC_PAGESIZE ) );
+  const SizeValueType alignedOffset = offset - offset % pageSize;
+  const SizeValueType alignmentSlop = offset - alignedOffset;
+
+  // MAP_PRIVATE gives a copy-on-write view: the buffer is writable,
+  // modifications never reach the file, and clean pages remain shared
+  // page-cache pages.
+  void *base = mmap( nullptr, numberOfBytes + alignmentSlop,
+                     PROT_READ | PROT_WRITE, MAP_PRIVATE, fd,
+                     static_cast< off_t >( alignedOffset ) );
+  // The mapping keeps its own reference to the file.
+  close( fd );
+  if ( base == MAP_FAILED )
+    {
+    return nullptr;
+    }
+
+  m_MappedBase = base;
+  m_MappedLength = numberOfBytes + alignmentSlop;
+  return static_cast< char * >( base ) + alignmentSlop;
+#else
+  (void)fileName;
+  (void)offset;
+  (void)numberOfBytes;
+  return nullptr;
+#endif
+}
+
+void *
+MemoryMappedFileAllocator
+::Allocate( SizeValueType itkNotUsed( numberOfBytes ) )
+{
+  itkExceptionMacro( "MemoryMappedFileAllocator only adopts file mappings;"
+                     " use MapFileRegion" );
+}
+
+void
+MemoryMappedFileAllocator
+::Deallocate( void *buffer, SizeValueType itkNotUsed( numberOfBytes ) )
+{
+  if ( m_MappedBase == nullptr
+       || buffer < m_MappedBase
+       || buffer >= static_cast< char * >( m_MappedBase ) + m_MappedLength )
+    {
+    itkExceptionMacro( "Buffer was not obtained from this allocator's mapping" );
+    }
+#if defined(_WIN32)
+  UnmapViewOfFile( m_MappedBase );
+#elif defined(ITK_USE_PTHREADS)
+  munmap( m_MappedBase, m_MappedLength );
+#endif
+  m_MappedBase = nullptr;
+  m_MappedLength = 0;
+}
+
+void
+MemoryMappedFileAllocator
+::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  os << indent << "MappedBase: " << m_MappedBase << std::endl;
+  os << indent << "MappedLength: " << m_MappedLength << std::endl;
+}
+
+} // end namespace itk
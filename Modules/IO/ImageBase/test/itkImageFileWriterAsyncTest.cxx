@@ -0,0 +1,116 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkImageFileWriter.h"
+#include "itkImageFileReader.h"
+#include "itkImageRegionIterator.h"
+
+// Exercise WriteAsync/WaitForCompletion: the buffer is snapshotted when
+// the write is queued, so modifying the input image afterwards must not
+// change what ends up in the file.
+int itkImageFileWriterAsyncTest(int ac, char* av[])
+{
+  if (ac < 2)
+    {
+    std::cout << "usage: itkIOTests itkImageFileWriterAsyncTest outputFileName" << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  using ImageNDType = itk::Image<unsigned char,2>;
+  using WriterType = itk::ImageFileWriter<ImageNDType>;
+  using ReaderType = itk::ImageFileReader<ImageNDType>;
+
+  ImageNDType::Pointer image = ImageNDType::New();
+  ImageNDType::SizeType size;
+  size.Fill(32);
+  image->SetRegions(size);
+  image->Allocate();
+
+  itk::ImageRegionIterator<ImageNDType> it( image, image->GetBufferedRegion() );
+  unsigned char value = 0;
+  for (; !it.IsAtEnd(); ++it)
+    {
+    it.Set(value++);
+    }
+
+  WriterType::Pointer writer = WriterType::New();
+  try
+    {
+    writer->SetInput(image);
+    writer->SetFileName(av[1]);
+    writer->WriteAsync();
+
+    // the snapshot decouples the file content from the input buffer
+    image->FillBuffer(0);
+
+    writer->WaitForCompletion();
+    // waiting again must be a no-op
+    writer->WaitForCompletion();
+    }
+  catch (itk::ExceptionObject &ex)
+    {
+    std::cout << "caught exception!" << std::endl;
+    std::cout << ex;
+    return EXIT_FAILURE;
+    }
+
+  ReaderType::Pointer reader = ReaderType::New();
+  reader->SetFileName(av[1]);
+  try
+    {
+    reader->Update();
+    }
+  catch (itk::ExceptionObject &ex)
+    {
+    std::cout << "caught exception!" << std::endl;
+    std::cout << ex;
+    return EXIT_FAILURE;
+    }
+
+  itk::ImageRegionIterator<ImageNDType> rit( reader->GetOutput(),
+                                             reader->GetOutput()->GetBufferedRegion() );
+  value = 0;
+  for (; !rit.IsAtEnd(); ++rit)
+    {
+    if ( rit.Get() != value++ )
+      {
+      std::cout << "Pixel " << rit.GetIndex() << " does not match the snapshot value."
+                << std::endl;
+      return EXIT_FAILURE;
+      }
+    }
+
+  // WriteAsync must reject configurations that require streaming
+  writer->SetNumberOfStreamDivisions(4);
+  bool caught = false;
+  try
+    {
+    writer->WriteAsync();
+    }
+  catch (itk::ExceptionObject &)
+    {
+    caught = true;
+    }
+  if ( !caught )
+    {
+    std::cout << "Expected WriteAsync to reject streamed writing." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  return EXIT_SUCCESS;
+}
@@ -62,6 +62,9 @@ public:
    * file specified. */
   bool CanReadFile(const char *) override;
 
+  /** The byte signature identifying this file format. */
+  ArrayOfMagicByteSignaturesType GetMagicByteSignatures() const override;
+
   /** Set the spacing and diemention information for the set filename. */
   void ReadImageInformation() override;
 
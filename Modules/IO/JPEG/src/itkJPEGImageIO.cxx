@@ -87,6 +87,12 @@ public:
   FILE *m_FilePointer;
 };
 
+JPEGImageIO::ArrayOfMagicByteSignaturesType
+JPEGImageIO::GetMagicByteSignatures() const
+{
+  return { { 0, std::string( "\xFF\xD8\xFF", 3 ) } };
+}
+
 bool JPEGImageIO::CanReadFile(const char *file)
 {
   // First check the extension
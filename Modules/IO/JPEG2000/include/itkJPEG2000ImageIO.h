@@ -102,6 +102,15 @@ public:
   /** Define the tile size to use when writing out an image. */
   void SetTileSize(int x, int y);
 
+  /** Set/Get the number of resolution levels to discard when reading.
+   * Each discarded level halves the decoded image along both dimensions,
+   * so pyramid previews do not pay for a full-resolution decode. The
+   * dimensions reported by ReadImageInformation() are the reduced ones.
+   * Streamed (tile sub-region) reading is not combined with discard
+   * levels; the whole reduced image is read at once. Default is 0. */
+  void SetDiscardLevels(unsigned int levels);
+  unsigned int GetDiscardLevels() const;
+
   /** Currently JPEG2000 does not support streamed writing
    *
    * These methods are re-overridden to not support streaming for
@@ -123,6 +132,12 @@ private:
 
   void ComputeRegionInTileBoundaries(unsigned int dimension,
                                      SizeValueType tileSize, ImageIORegion & streamableRegion) const;
+
+  /** Decode the tiles whose reference-grid rows fall in
+   * [bandStartY, bandEndY) into the buffer of regionToRead. Uses a
+   * private decompressor so several bands can be decoded concurrently. */
+  void ReadBandFromTiles(void *buffer, const ImageIORegion & regionToRead,
+                         IndexValueType bandStartY, IndexValueType bandEndY);
 };
 } // end namespace itk
 
@@ -17,8 +17,15 @@
  *=========================================================================*/
 
 #include "itkJPEG2000ImageIO.h"
+#include "itkMultiThreaderBase.h"
+#include "itkThreadPool.h"
 #include "itksys/SystemTools.hxx"
 
+#include <algorithm>
+#include <exception>
+#include <future>
+#include <vector>
+
 // for memset
 // for malloc
 
@@ -64,6 +71,8 @@ public:
   OPJ_UINT32 m_NumberOfTilesInX;
   OPJ_UINT32 m_NumberOfTilesInY;
 
+  unsigned int m_DiscardLevels;
+
   opj_dparameters_t m_DecompressionParameters;  /* decompression parameters */
 };
 
@@ -88,6 +97,8 @@ JPEG2000ImageIO::JPEG2000ImageIO()
   this->m_Internal->m_NumberOfTilesInX = 0;
   this->m_Internal->m_NumberOfTilesInY = 0;
 
+  this->m_Internal->m_DiscardLevels = 0;
+
   const char *extensions[] =
     {
       ".j2k", ".jp2", ".jpt"
@@ -108,6 +119,7 @@ JPEG2000ImageIO::~JPEG2000ImageIO()
 void JPEG2000ImageIO::PrintSelf(std::ostream & os, Indent indent) const
 {
   Superclass::PrintSelf(os, indent);
+  os << indent << "DiscardLevels: " << this->m_Internal->m_DiscardLevels << std::endl;
 }
 
 bool JPEG2000ImageIO::CanReadFile(const char *filename)
@@ -135,6 +147,20 @@ void JPEG2000ImageIO::SetTileSize(int x, int y)
   this->Modified();
 }
 
+void JPEG2000ImageIO::SetDiscardLevels(unsigned int levels)
+{
+  if ( this->m_Internal->m_DiscardLevels != levels )
+    {
+    this->m_Internal->m_DiscardLevels = levels;
+    this->Modified();
+    }
+}
+
+unsigned int JPEG2000ImageIO::GetDiscardLevels() const
+{
+  return this->m_Internal->m_DiscardLevels;
+}
+
 
 void JPEG2000ImageIO::ReadImageInformation()
 {
@@ -154,8 +180,11 @@ void JPEG2000ImageIO::ReadImageInformation()
       << itksys::SystemTools::GetLastSystemError() );
     }
 
-  /* set decoding parameters to default values */
+  /* set decoding parameters to default values; the discard levels must
+   * survive the reset */
   opj_set_default_decoder_parameters(& (this->m_Internal->m_DecompressionParameters) );
+  this->m_Internal->m_DecompressionParameters.cp_reduce =
+    static_cast< int >( this->m_Internal->m_DiscardLevels );
 
   opj_stream_t *cio = opj_stream_create_default_file_stream(l_file, true);
 
@@ -364,8 +393,13 @@ void JPEG2000ImageIO::ReadImageInformation()
   itkDebugMacro(<< "image->x1 = " <<  l_image->x1);
   itkDebugMacro(<< "image->y1 = " <<  l_image->y1);
 
-  this->SetDimensions(0,  l_image->x1);
-  this->SetDimensions(1,  l_image->y1);
+  // A discarded resolution level halves the decoded image along both
+  // dimensions: report the reduced extent so downstream allocation
+  // matches what Read() produces.
+  const unsigned int reduce = this->m_Internal->m_DiscardLevels;
+
+  this->SetDimensions(0, ( l_image->x1 + ( 1u << reduce ) - 1 ) >> reduce);
+  this->SetDimensions(1, ( l_image->y1 + ( 1u << reduce ) - 1 ) >> reduce);
 
   this->SetSpacing(0, 1.0);    // FIXME : Get the real pixel resolution.
   this->SetSpacing(1, 1.0);    // FIXME : Get the real pixel resolution.
@@ -390,6 +424,100 @@ void JPEG2000ImageIO::Read(void *buffer)
 {
   itkDebugMacro(<< "JPEG2000ImageIO::Read() Begin");
 
+  const ImageIORegion regionToRead = this->GetIORegion();
+
+  const unsigned int reduce = this->m_Internal->m_DiscardLevels;
+
+  // Band boundaries are expressed on the reference grid of the
+  // codestream; with discard levels the IORegion lives on the reduced
+  // grid, so its extent is scaled back up here.
+  const IndexValueType refStartY =
+    static_cast< IndexValueType >( regionToRead.GetIndex(1) ) << reduce;
+  const IndexValueType refEndY = refStartY
+    + ( static_cast< IndexValueType >( regionToRead.GetSize(1) ) << reduce );
+
+  const auto tileHeight = static_cast< IndexValueType >( this->m_Internal->m_TileHeight );
+  const auto tileStartY = static_cast< IndexValueType >( this->m_Internal->m_TileStartY );
+
+  SizeValueType numberOfTileRows = 1;
+  IndexValueType firstTileRow = 0;
+  if ( tileHeight > 0 )
+    {
+    firstTileRow = ( refStartY - tileStartY ) / tileHeight;
+    const IndexValueType lastTileRow = ( refEndY - 1 - tileStartY ) / tileHeight;
+    numberOfTileRows = lastTileRow - firstTileRow + 1;
+    }
+
+  // Each band of tile rows is decoded by a private decompressor
+  // instance reading the codestream through its own stream: the
+  // decoder structures are not thread-safe and cannot be shared.
+  const SizeValueType numberOfBands = std::min(
+    static_cast< SizeValueType >( MultiThreaderBase::GetGlobalDefaultNumberOfThreads() ),
+    numberOfTileRows );
+
+  if ( numberOfBands < 2 || ThreadPool::IsPoolWorker() )
+    {
+    this->ReadBandFromTiles(buffer, regionToRead, refStartY, refEndY);
+    itkDebugMacro(<< "JPEG2000ImageIO::Read() End");
+    return;
+    }
+
+  std::vector< std::future< void > > bands;
+  std::exception_ptr firstError;
+
+  for ( SizeValueType band = 1; band < numberOfBands; band++ )
+    {
+    const IndexValueType rowBegin = firstTileRow + ( numberOfTileRows * band ) / numberOfBands;
+    const IndexValueType rowEnd = firstTileRow + ( numberOfTileRows * ( band + 1 ) ) / numberOfBands;
+    const IndexValueType bandStartY = tileStartY + rowBegin * tileHeight;
+    const IndexValueType bandEndY = std::min( refEndY, tileStartY + rowEnd * tileHeight );
+    bands.push_back( ThreadPool::GetInstance()->AddWork(
+      [this, buffer, regionToRead, bandStartY, bandEndY]()
+        { this->ReadBandFromTiles(buffer, regionToRead, bandStartY, bandEndY); } ) );
+    }
+
+  // decode the first band on the calling thread
+  try
+    {
+    const IndexValueType rowEnd = firstTileRow + numberOfTileRows / numberOfBands;
+    const IndexValueType bandEndY = std::min( refEndY, tileStartY + rowEnd * tileHeight );
+    this->ReadBandFromTiles(buffer, regionToRead, refStartY, bandEndY);
+    }
+  catch ( ... )
+    {
+    firstError = std::current_exception();
+    }
+
+  // join every decoder before propagating an error, they write into the
+  // caller's buffer
+  for ( auto & pendingBand : bands )
+    {
+    try
+      {
+      pendingBand.get();
+      }
+    catch ( ... )
+      {
+      if ( !firstError )
+        {
+        firstError = std::current_exception();
+        }
+      }
+    }
+
+  if ( firstError )
+    {
+    std::rethrow_exception(firstError);
+    }
+
+  itkDebugMacro(<< "JPEG2000ImageIO::Read() End");
+}
+
+void
+JPEG2000ImageIO
+::ReadBandFromTiles(void *buffer, const ImageIORegion & regionToRead,
+                    IndexValueType bandStartY, IndexValueType bandEndY)
+{
   FILE *l_file = fopen(this->m_FileName.c_str(), "rb");
 
   if ( !l_file )
@@ -412,7 +540,8 @@ void JPEG2000ImageIO::Read(void *buffer)
       << "Reason: opj_stream_create_default_file_stream returns nullptr" );
     }
 
-  this->m_Internal->m_Dinfo  = nullptr;  /* handle to a decompressor */
+  /* private decompressor handle: concurrent bands must not share one */
+  opj_codec_t *l_dinfo = nullptr;
 
   opj_image_t *l_image = nullptr;
 
@@ -424,8 +553,8 @@ void JPEG2000ImageIO::Read(void *buffer)
       {
       /* JPEG-2000 codestream */
       /* get a decoder handle */
-      this->m_Internal->m_Dinfo = opj_create_decompress(CODEC_J2K);
-      if ( !this->m_Internal->m_Dinfo )
+      l_dinfo = opj_create_decompress(CODEC_J2K);
+      if ( !l_dinfo )
         {
         itkExceptionMacro(
           "JPEG2000ImageIO failed to read file: "
@@ -439,8 +568,8 @@ void JPEG2000ImageIO::Read(void *buffer)
       {
       /* JPEG 2000 compressed image data */
       /* get a decoder handle */
-      this->m_Internal->m_Dinfo = opj_create_decompress(CODEC_JP2);
-      if ( !this->m_Internal->m_Dinfo )
+      l_dinfo = opj_create_decompress(CODEC_JP2);
+      if ( !l_dinfo )
         {
         itkExceptionMacro(
           "JPEG2000ImageIO failed to read file: "
@@ -454,8 +583,8 @@ void JPEG2000ImageIO::Read(void *buffer)
       {
       /* JPEG 2000, JPIP */
       /* get a decoder handle */
-      this->m_Internal->m_Dinfo = opj_create_decompress(CODEC_JPT);
-      if ( !this->m_Internal->m_Dinfo )
+      l_dinfo = opj_create_decompress(CODEC_JPT);
+      if ( !l_dinfo )
         {
         itkExceptionMacro(
           "JPEG2000ImageIO failed to read file: "
@@ -477,8 +606,12 @@ void JPEG2000ImageIO::Read(void *buffer)
 }
   /* catch events using our callbacks and give a local context */
 
-  /* setup the decoder decoding parameters using user parameters */
-  if (!opj_setup_decoder(this->m_Internal->m_Dinfo, &( this->m_Internal->m_DecompressionParameters ) ))
+  /* setup the decoder decoding parameters using user parameters; a
+   * local copy keeps concurrent bands from sharing a mutable struct */
+  opj_dparameters_t l_parameters = this->m_Internal->m_DecompressionParameters;
+  l_parameters.cp_reduce = static_cast< int >( this->m_Internal->m_DiscardLevels );
+
+  if (!opj_setup_decoder(l_dinfo, &l_parameters))
     {
     itkExceptionMacro(
       "JPEG2000ImageIO failed to read file: "
@@ -495,7 +628,7 @@ void JPEG2000ImageIO::Read(void *buffer)
   OPJ_UINT32 l_nb_tiles_y;
 
   bool bResult = opj_read_header(
-    this->m_Internal->m_Dinfo,
+    l_dinfo,
     &l_image,
     &l_tile_x0,
     &l_tile_y0,
@@ -507,8 +640,7 @@ void JPEG2000ImageIO::Read(void *buffer)
 
   if ( !bResult )
     {
-    opj_destroy_codec(this->m_Internal->m_Dinfo);
-    this->m_Internal->m_Dinfo = nullptr;
+    opj_destroy_codec(l_dinfo);
     opj_stream_destroy(l_stream);
     fclose(l_file);
     itkExceptionMacro(
@@ -518,23 +650,25 @@ void JPEG2000ImageIO::Read(void *buffer)
       << "Reason: opj_read_header returns false");
     }
 
- ImageIORegion regionToRead = this->GetIORegion();
+  const unsigned int reduce = this->m_Internal->m_DiscardLevels;
 
   ImageIORegion::SizeType  size  = regionToRead.GetSize();
   ImageIORegion::IndexType start = regionToRead.GetIndex();
 
   const unsigned int sizex = size[0];
-  const unsigned int sizey = size[1];
   // const unsigned int sizez = size[2];
 
   const unsigned int startx = start[0];
   const unsigned int starty = start[1];
   // const unsigned int startz = start[2];
 
-  auto p_start_x = static_cast< OPJ_INT32 >( startx );
-  auto p_start_y = static_cast< OPJ_INT32 >( starty );
-  auto p_end_x   = static_cast< OPJ_INT32 >( startx + sizex );
-  auto p_end_y   = static_cast< OPJ_INT32 >( starty + sizey );
+  /* the decode area is specified on the reference grid of the
+   * codestream, while the IORegion and the output buffer live on the
+   * grid reduced by the discard levels */
+  auto p_start_x = static_cast< OPJ_INT32 >( startx << reduce );
+  auto p_start_y = static_cast< OPJ_INT32 >( bandStartY );
+  auto p_end_x   = static_cast< OPJ_INT32 >( ( startx + sizex ) << reduce );
+  auto p_end_y   = static_cast< OPJ_INT32 >( bandEndY );
 
   itkDebugMacro(<< "opj_set_decode_area() before");
   itkDebugMacro(<< "p_start_x = " << p_start_x);
@@ -543,7 +677,7 @@ void JPEG2000ImageIO::Read(void *buffer)
   itkDebugMacro(<< "p_end_y = " << p_end_y);
 
   bResult = opj_set_decode_area(
-    this->m_Internal->m_Dinfo,
+    l_dinfo,
     p_start_x,
     p_start_y,
     p_end_x,
@@ -554,8 +688,7 @@ void JPEG2000ImageIO::Read(void *buffer)
 
   if ( !bResult )
     {
-    opj_destroy_codec(this->m_Internal->m_Dinfo);
-    this->m_Internal->m_Dinfo = nullptr;
+    opj_destroy_codec(l_dinfo);
     opj_stream_destroy(l_stream);
     fclose(l_file);
     itkExceptionMacro(
@@ -584,7 +717,7 @@ void JPEG2000ImageIO::Read(void *buffer)
   while ( l_go_on )
     {
     bool tileHeaderRead = opj_read_tile_header(
-      this->m_Internal->m_Dinfo,
+      l_dinfo,
       &l_tile_index,
       &l_data_size,
       &l_current_tile_x0,
@@ -600,7 +733,7 @@ void JPEG2000ImageIO::Read(void *buffer)
       free(l_data);
       opj_stream_destroy(l_stream);
       fclose(l_file);
-      opj_destroy_codec(this->m_Internal->m_Dinfo);
+      opj_destroy_codec(l_dinfo);
       opj_image_destroy(l_image);
       itkExceptionMacro(
         "JPEG2000ImageIO failed to read file: "
@@ -628,7 +761,7 @@ void JPEG2000ImageIO::Read(void *buffer)
           {
           opj_stream_destroy(l_stream);
           fclose(l_file);
-          opj_destroy_codec(this->m_Internal->m_Dinfo);
+          opj_destroy_codec(l_dinfo);
           opj_image_destroy(l_image);
           itkExceptionMacro(
             "JPEG2000ImageIO failed to read file: "
@@ -643,7 +776,7 @@ void JPEG2000ImageIO::Read(void *buffer)
         }
 
       bool decodeTileData = opj_decode_tile_data(
-        this->m_Internal->m_Dinfo,
+        l_dinfo,
         l_tile_index,
         l_data,
         l_data_size,
@@ -654,7 +787,7 @@ void JPEG2000ImageIO::Read(void *buffer)
         free(l_data);
         opj_stream_destroy(l_stream);
         fclose(l_file);
-        opj_destroy_codec(this->m_Internal->m_Dinfo);
+        opj_destroy_codec(l_dinfo);
         opj_image_destroy(l_image);
         itkExceptionMacro(
           "JPEG2000ImageIO failed to read file: "
@@ -665,8 +798,15 @@ void JPEG2000ImageIO::Read(void *buffer)
 
       OPJ_BYTE *l_data_ptr = l_data;
 
-      const SizeValueType tsizex = l_current_tile_x1 - l_current_tile_x0;
-      const SizeValueType tsizey = l_current_tile_y1 - l_current_tile_y0;
+      /* tile extents mapped onto the reduced grid; this matches the
+       * decoded payload, which only holds the retained resolution */
+      const OPJ_INT32 r_tile_x0 = ( l_current_tile_x0 + ( 1 << reduce ) - 1 ) >> reduce;
+      const OPJ_INT32 r_tile_y0 = ( l_current_tile_y0 + ( 1 << reduce ) - 1 ) >> reduce;
+      const OPJ_INT32 r_tile_x1 = ( l_current_tile_x1 + ( 1 << reduce ) - 1 ) >> reduce;
+      const OPJ_INT32 r_tile_y1 = ( l_current_tile_y1 + ( 1 << reduce ) - 1 ) >> reduce;
+
+      const SizeValueType tsizex = r_tile_x1 - r_tile_x0;
+      const SizeValueType tsizey = r_tile_y1 - r_tile_y0;
       const SizeValueType numberOfPixels = tsizex * tsizey;
       const SizeValueType numberOfComponents = this->GetNumberOfComponents();
       const SizeValueType sizePerComponentInBytes = l_data_size / ( numberOfPixels * numberOfComponents );
@@ -677,11 +817,11 @@ void JPEG2000ImageIO::Read(void *buffer)
 
       const SizeValueType sizePerStrideXInBytes = sizePerChannelInBytes / tsizey;
       const SizeValueType initialStrideInBytes =
-        ( l_current_tile_y0 - p_start_y ) * sizex * sizePerComponentInBytes * numberOfComponents;
+        ( r_tile_y0 - starty ) * sizex * sizePerComponentInBytes * numberOfComponents;
       const SizeValueType priorStrideInBytes =
-        ( l_current_tile_x0 - p_start_x ) * sizePerComponentInBytes * numberOfComponents;
+        ( r_tile_x0 - startx ) * sizePerComponentInBytes * numberOfComponents;
       const SizeValueType postStrideInBytes =
-        ( p_end_x - l_current_tile_x1 ) * sizePerComponentInBytes * numberOfComponents;
+        ( startx + sizex - r_tile_x1 ) * sizePerComponentInBytes * numberOfComponents;
 
       itkDebugMacro(<< "sizePerStrideYInBytes:   " << sizePerChannelInBytes / tsizex );
       itkDebugMacro(<< "sizePerStrideXInBytes:   " << sizePerStrideXInBytes);
@@ -714,14 +854,14 @@ void JPEG2000ImageIO::Read(void *buffer)
 //       l_go_on = 0;
     }
 
-//  l_image = opj_decode( this->m_Dinfo, l_stream );
+//  l_image = opj_decode( l_dinfo, l_stream );
 
-  if ( !opj_end_decompress(this->m_Internal->m_Dinfo, l_stream) )
+  if ( !opj_end_decompress(l_dinfo, l_stream) )
     {
     free(l_data);
     opj_stream_destroy(l_stream);
     fclose(l_file);
-    opj_destroy_codec(this->m_Internal->m_Dinfo);
+    opj_destroy_codec(l_dinfo);
     opj_image_destroy(l_image);
     itkExceptionMacro(
       "JPEG2000ImageIO failed to read file: "
@@ -732,8 +872,7 @@ void JPEG2000ImageIO::Read(void *buffer)
 
   if ( !l_image )
     {
-    opj_destroy_codec(this->m_Internal->m_Dinfo);
-    this->m_Internal->m_Dinfo = nullptr;
+    opj_destroy_codec(l_dinfo);
     opj_stream_destroy(l_stream);
     fclose(l_file);
     itkExceptionMacro(
@@ -747,10 +886,9 @@ void JPEG2000ImageIO::Read(void *buffer)
   opj_stream_destroy(l_stream);
   fclose(l_file);
 
-  if ( this->m_Internal->m_Dinfo )
+  if ( l_dinfo )
     {
-    opj_destroy_codec(this->m_Internal->m_Dinfo);
-    this->m_Internal->m_Dinfo = nullptr;
+    opj_destroy_codec(l_dinfo);
     }
 
   if( l_image )
@@ -762,8 +900,6 @@ void JPEG2000ImageIO::Read(void *buffer)
     {
     free( l_data );
     }
-
-  itkDebugMacro(<< "JPEG2000ImageIO::Read() End");
 }
 
 bool JPEG2000ImageIO::CanWriteFile(const char *filename)
@@ -1183,7 +1319,9 @@ JPEG2000ImageIO
 
   ImageIORegion streamableRegion(this->m_NumberOfDimensions);
 
-  if ( !m_UseStreamedReading )
+  // Reduced-resolution reads decode the whole (small) image at once,
+  // since the stored tile grid does not align with the reduced grid.
+  if ( !m_UseStreamedReading || this->m_Internal->m_DiscardLevels > 0 )
     {
     return ImageIOBase::GenerateStreamableReadRegionFromRequestedRegion( requestedRegion );
     }
@@ -0,0 +1,116 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkJPEG2000ImageIO.h"
+#include "itkImageFileReader.h"
+#include "itkImageFileWriter.h"
+#include "itkImageRegionIterator.h"
+
+// Write a ramp image to a JPEG 2000 file and read it back discarding
+// resolution levels: each discarded level must halve the decoded image
+// along both dimensions.
+int itkJPEG2000ImageIODiscardLevelsTest( int argc, char * argv[] )
+{
+  if( argc < 2 )
+    {
+    std::cerr << "Usage: " << std::endl;
+    std::cerr << argv[0] << " outputImageFile.j2k" << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  using PixelType = unsigned char;
+  constexpr unsigned int Dimension = 2;
+
+  using ImageType = itk::Image< PixelType, Dimension >;
+
+  const std::string filename = argv[1];
+
+  ImageType::Pointer image = ImageType::New();
+  ImageType::SizeType size;
+  size[0] = 128;
+  size[1] = 96;
+  image->SetRegions( size );
+  image->Allocate();
+
+  itk::ImageRegionIterator< ImageType > it( image, image->GetBufferedRegion() );
+  for (; !it.IsAtEnd(); ++it )
+    {
+    it.Set( static_cast< PixelType >( it.GetIndex()[0] + it.GetIndex()[1] ) );
+    }
+
+  using WriterType = itk::ImageFileWriter< ImageType >;
+  WriterType::Pointer writer = WriterType::New();
+  writer->SetInput( image );
+  writer->SetFileName( filename );
+  writer->SetImageIO( itk::JPEG2000ImageIO::New() );
+
+  try
+    {
+    writer->Update();
+    }
+  catch( itk::ExceptionObject & err )
+    {
+    std::cerr << "ExceptionObject caught !" << std::endl;
+    std::cerr << err << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  for ( unsigned int levels = 0; levels < 3; levels++ )
+    {
+    itk::JPEG2000ImageIO::Pointer io = itk::JPEG2000ImageIO::New();
+    io->SetDiscardLevels( levels );
+
+    if ( io->GetDiscardLevels() != levels )
+      {
+      std::cerr << "SetDiscardLevels/GetDiscardLevels failed" << std::endl;
+      return EXIT_FAILURE;
+      }
+
+    using ReaderType = itk::ImageFileReader< ImageType >;
+    ReaderType::Pointer reader = ReaderType::New();
+    reader->SetFileName( filename );
+    reader->SetImageIO( io );
+
+    try
+      {
+      reader->Update();
+      }
+    catch( itk::ExceptionObject & err )
+      {
+      std::cerr << "ExceptionObject caught !" << std::endl;
+      std::cerr << err << std::endl;
+      return EXIT_FAILURE;
+      }
+
+    ImageType::SizeType expectedSize;
+    expectedSize[0] = ( size[0] + ( 1u << levels ) - 1 ) >> levels;
+    expectedSize[1] = ( size[1] + ( 1u << levels ) - 1 ) >> levels;
+
+    const ImageType::SizeType decodedSize =
+      reader->GetOutput()->GetLargestPossibleRegion().GetSize();
+
+    if ( decodedSize != expectedSize )
+      {
+      std::cerr << "Discarding " << levels << " levels produced size "
+                << decodedSize << ", expected " << expectedSize << std::endl;
+      return EXIT_FAILURE;
+      }
+    }
+
+  return EXIT_SUCCESS;
+}
@@ -128,6 +128,24 @@ public:
   void  SetMeshIO(MeshIOBase *meshIO);
   itkGetModifiableObjectMacro(MeshIO, MeshIOBase);
 
+  /** Streamed (out-of-core) reading. When PointRangeCount is non-zero only
+   * the points [PointRangeFirst, PointRangeFirst + PointRangeCount) and
+   * their point data are read; the output mesh then holds just that range,
+   * with point identifiers renumbered from zero, and no cells, since cell
+   * point references would be invalid under the renumbering. The MeshIO in
+   * use must report CanStreamRead() as true, otherwise GenerateData()
+   * throws. A count of zero, the default, reads the whole file. */
+  itkSetMacro(PointRangeFirst, SizeValueType);
+  itkGetConstMacro(PointRangeFirst, SizeValueType);
+  itkSetMacro(PointRangeCount, SizeValueType);
+  itkGetConstMacro(PointRangeCount, SizeValueType);
+
+  /** Number of points the next GenerateData() will read: the whole file
+   * when no point range is set, otherwise the requested range clamped
+   * against the number of points in the file. Only valid after
+   * GenerateOutputInformation() has run. */
+  SizeValueType GetNumberOfPointsToRead() const;
+
   /** Prepare the allocation of the output mesh during the first back
    * propagation of the pipeline. */
   void GenerateOutputInformation() override;
@@ -171,6 +189,9 @@ protected:
 
 private:
   std::string m_ExceptionMessage;
+
+  SizeValueType m_PointRangeFirst{ 0 };  // streamed reading; a count of
+  SizeValueType m_PointRangeCount{ 0 };  // zero reads the whole file
 };
 } // end namespace itk
 
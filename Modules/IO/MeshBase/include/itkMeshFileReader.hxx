@@ -60,6 +60,8 @@ MeshFileReader< TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits >
 
   os << indent << "UserSpecifiedMeshIO flag: " << m_UserSpecifiedMeshIO << "\n";
   os << indent << "FileName: " << m_FileName << "\n";
+  os << indent << "Point range first: " << m_PointRangeFirst << "\n";
+  os << indent << "Point range count: " << m_PointRangeCount << "\n";
 }
 
 template< typename TOutputMesh, typename ConvertPointPixelTraits, typename ConvertCellPixelTraits >
@@ -113,6 +115,27 @@ MeshFileReader< TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits >
   readTester.close();
 }
 
+template< typename TOutputMesh, typename ConvertPointPixelTraits, typename ConvertCellPixelTraits >
+typename MeshFileReader< TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits >::SizeValueType
+MeshFileReader< TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits >
+::GetNumberOfPointsToRead() const
+{
+  const SizeValueType numberOfPoints = m_MeshIO->GetNumberOfPoints();
+
+  if ( m_PointRangeCount == 0 )
+    {
+    return numberOfPoints;
+    }
+
+  if ( m_PointRangeFirst >= numberOfPoints )
+    {
+    return 0;
+    }
+
+  const SizeValueType remainder = numberOfPoints - m_PointRangeFirst;
+  return ( m_PointRangeCount < remainder ) ? m_PointRangeCount : remainder;
+}
+
 template< typename TOutputMesh, typename ConvertPointPixelTraits, typename ConvertCellPixelTraits >
 template< typename T >
 void
@@ -120,7 +143,7 @@ MeshFileReader< TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits >
 ::ReadPoints(T *buffer)
 {
   typename TOutputMesh::Pointer output = this->GetOutput();
-  output->GetPoints()->Reserve( m_MeshIO->GetNumberOfPoints() );
+  output->GetPoints()->Reserve( this->GetNumberOfPointsToRead() );
   OutputPointType point;
 
   for ( OutputPointIdentifier id = 0; id < output->GetNumberOfPoints(); id++ )
@@ -345,8 +368,26 @@ MeshFileReader< TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits >
 {
   typename TOutputMesh::Pointer output = this->GetOutput();
 
+  // Only the pixels of the requested point range are read when streaming
+  SizeValueType numberOfPointPixels = m_MeshIO->GetNumberOfPointPixels();
+  if ( m_PointRangeCount > 0 )
+    {
+    if ( m_PointRangeFirst >= numberOfPointPixels )
+      {
+      numberOfPointPixels = 0;
+      }
+    else if ( m_PointRangeCount < numberOfPointPixels - m_PointRangeFirst )
+      {
+      numberOfPointPixels = m_PointRangeCount;
+      }
+    else
+      {
+      numberOfPointPixels = numberOfPointPixels - m_PointRangeFirst;
+      }
+    }
+
   char *                inputPointDataBuffer = nullptr;
-  auto * outputPointDataBuffer = new OutputPointPixelType[m_MeshIO->GetNumberOfPointPixels()];
+  auto * outputPointDataBuffer = new OutputPointPixelType[numberOfPointPixels];
 
   try
     {
@@ -368,10 +409,10 @@ MeshFileReader< TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits >
 
       inputPointDataBuffer =
         new char[m_MeshIO->GetNumberOfPointPixelComponents() * m_MeshIO->GetComponentSize( m_MeshIO->GetPointPixelComponentType() )
-                 * m_MeshIO->GetNumberOfPointPixels()];
+                 * numberOfPointPixels];
       m_MeshIO->ReadPointData( static_cast< void * >( inputPointDataBuffer ) );
 
-      this->ConvertPointPixelBuffer( static_cast< void * >( inputPointDataBuffer ), outputPointDataBuffer, m_MeshIO->GetNumberOfPointPixels() );
+      this->ConvertPointPixelBuffer( static_cast< void * >( inputPointDataBuffer ), outputPointDataBuffer, numberOfPointPixels );
       }
     else
       {
@@ -398,7 +439,7 @@ MeshFileReader< TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits >
   delete[] inputPointDataBuffer;
   inputPointDataBuffer = nullptr;
 
-  for ( OutputPointIdentifier id = 0; id < m_MeshIO->GetNumberOfPointPixels(); id++ )
+  for ( OutputPointIdentifier id = 0; id < numberOfPointPixels; id++ )
     {
     output->SetPointData(id, outputPointDataBuffer[id]);
     }
@@ -560,6 +601,20 @@ MeshFileReader< TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits >
   // Get mesh information
   m_MeshIO->ReadMeshInformation();
 
+  // Pass a requested point range down to the MeshIO
+  if ( m_PointRangeCount > 0 )
+    {
+    if ( !m_MeshIO->CanStreamRead() )
+      {
+      itkExceptionMacro(<< "A point range was requested but " << m_MeshIO->GetNameOfClass()
+                        << " does not support streamed reading of this file");
+      }
+    m_MeshIO->SetPointRangeFirst(m_PointRangeFirst);
+    m_MeshIO->SetPointRangeCount( this->GetNumberOfPointsToRead() );
+    }
+
+  const SizeValueType numberOfPointsToRead = this->GetNumberOfPointsToRead();
+
   // Read points
   if ( m_MeshIO->GetUpdatePoints() )
     {
@@ -567,7 +622,7 @@ MeshFileReader< TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits >
       {
       case MeshIOBase::CHAR:
         {
-        auto * pointsBuffer = new char[m_MeshIO->GetNumberOfPoints() * OutputPointDimension];
+        auto * pointsBuffer = new char[numberOfPointsToRead * OutputPointDimension];
         m_MeshIO->ReadPoints( static_cast< void * >( pointsBuffer ) );
         ReadPoints(pointsBuffer);
         delete[] pointsBuffer;
@@ -575,7 +630,7 @@ MeshFileReader< TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits >
         }
       case MeshIOBase::UCHAR:
         {
-        auto * pointsBuffer = new unsigned char[m_MeshIO->GetNumberOfPoints() * OutputPointDimension];
+        auto * pointsBuffer = new unsigned char[numberOfPointsToRead * OutputPointDimension];
         m_MeshIO->ReadPoints( static_cast< void * >( pointsBuffer ) );
         ReadPoints(pointsBuffer);
         delete[] pointsBuffer;
@@ -583,7 +638,7 @@ MeshFileReader< TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits >
         }
       case MeshIOBase::SHORT:
         {
-        auto * pointsBuffer = new short[m_MeshIO->GetNumberOfPoints() * OutputPointDimension];
+        auto * pointsBuffer = new short[numberOfPointsToRead * OutputPointDimension];
         m_MeshIO->ReadPoints( static_cast< void * >( pointsBuffer ) );
         ReadPoints(pointsBuffer);
         delete[] pointsBuffer;
@@ -591,7 +646,7 @@ MeshFileReader< TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits >
         }
       case MeshIOBase::USHORT:
         {
-        auto * pointsBuffer = new unsigned short[m_MeshIO->GetNumberOfPoints() * OutputPointDimension];
+        auto * pointsBuffer = new unsigned short[numberOfPointsToRead * OutputPointDimension];
         m_MeshIO->ReadPoints( static_cast< void * >( pointsBuffer ) );
         ReadPoints(pointsBuffer);
         delete[] pointsBuffer;
@@ -599,7 +654,7 @@ MeshFileReader< TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits >
         }
       case MeshIOBase::INT:
         {
-        auto * pointsBuffer = new int[m_MeshIO->GetNumberOfPoints() * OutputPointDimension];
+        auto * pointsBuffer = new int[numberOfPointsToRead * OutputPointDimension];
         m_MeshIO->ReadPoints( static_cast< void * >( pointsBuffer ) );
         ReadPoints(pointsBuffer);
         delete[] pointsBuffer;
@@ -607,7 +662,7 @@ MeshFileReader< TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits >
         }
       case MeshIOBase::UINT:
         {
-        auto * pointsBuffer = new unsigned int[m_MeshIO->GetNumberOfPoints() * OutputPointDimension];
+        auto * pointsBuffer = new unsigned int[numberOfPointsToRead * OutputPointDimension];
         m_MeshIO->ReadPoints( static_cast< void * >( pointsBuffer ) );
         ReadPoints(pointsBuffer);
         delete[] pointsBuffer;
@@ -615,7 +670,7 @@ MeshFileReader< TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits >
         }
       case MeshIOBase::LONG:
         {
-        auto * pointsBuffer = new long[m_MeshIO->GetNumberOfPoints() * OutputPointDimension];
+        auto * pointsBuffer = new long[numberOfPointsToRead * OutputPointDimension];
         m_MeshIO->ReadPoints( static_cast< void * >( pointsBuffer ) );
         ReadPoints(pointsBuffer);
         delete[] pointsBuffer;
@@ -623,7 +678,7 @@ MeshFileReader< TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits >
         }
       case MeshIOBase::ULONG:
         {
-        auto * pointsBuffer = new unsigned long[m_MeshIO->GetNumberOfPoints() * OutputPointDimension];
+        auto * pointsBuffer = new unsigned long[numberOfPointsToRead * OutputPointDimension];
         m_MeshIO->ReadPoints( static_cast< void * >( pointsBuffer ) );
         ReadPoints(pointsBuffer);
         delete[] pointsBuffer;
@@ -631,7 +686,7 @@ MeshFileReader< TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits >
         }
       case MeshIOBase::LONGLONG:
         {
-        auto * pointsBuffer = new long long[m_MeshIO->GetNumberOfPoints() * OutputPointDimension];
+        auto * pointsBuffer = new long long[numberOfPointsToRead * OutputPointDimension];
         m_MeshIO->ReadPoints( static_cast< void * >( pointsBuffer ) );
         ReadPoints(pointsBuffer);
         delete[] pointsBuffer;
@@ -639,7 +694,7 @@ MeshFileReader< TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits >
         }
       case MeshIOBase::ULONGLONG:
         {
-        auto * pointsBuffer = new unsigned long long[m_MeshIO->GetNumberOfPoints() * OutputPointDimension];
+        auto * pointsBuffer = new unsigned long long[numberOfPointsToRead * OutputPointDimension];
         m_MeshIO->ReadPoints( static_cast< void * >( pointsBuffer ) );
         ReadPoints(pointsBuffer);
         delete[] pointsBuffer;
@@ -647,7 +702,7 @@ MeshFileReader< TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits >
         }
       case MeshIOBase::FLOAT:
         {
-        auto * pointsBuffer = new float[m_MeshIO->GetNumberOfPoints() * OutputPointDimension];
+        auto * pointsBuffer = new float[numberOfPointsToRead * OutputPointDimension];
         m_MeshIO->ReadPoints( static_cast< void * >( pointsBuffer ) );
         ReadPoints(pointsBuffer);
         delete[] pointsBuffer;
@@ -655,7 +710,7 @@ MeshFileReader< TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits >
         }
       case MeshIOBase::DOUBLE:
         {
-        auto * pointsBuffer = new double[m_MeshIO->GetNumberOfPoints() * OutputPointDimension];
+        auto * pointsBuffer = new double[numberOfPointsToRead * OutputPointDimension];
         m_MeshIO->ReadPoints( static_cast< void * >( pointsBuffer ) );
         ReadPoints(pointsBuffer);
         delete[] pointsBuffer;
@@ -663,7 +718,7 @@ MeshFileReader< TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits >
         }
       case MeshIOBase::LDOUBLE:
         {
-        auto * pointsBuffer = new long double[m_MeshIO->GetNumberOfPoints() * OutputPointDimension];
+        auto * pointsBuffer = new long double[numberOfPointsToRead * OutputPointDimension];
         m_MeshIO->ReadPoints( static_cast< void * >( pointsBuffer ) );
         ReadPoints(pointsBuffer);
         delete[] pointsBuffer;
@@ -677,8 +732,10 @@ MeshFileReader< TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits >
       }
     }
 
-  // Read cells
-  if ( m_MeshIO->GetUpdateCells() )
+  // Read cells. When a point range is streamed in the cells are left out:
+  // the point identifiers of the output are renumbered from zero, so the
+  // point references stored with the cells would no longer be valid.
+  if ( m_MeshIO->GetUpdateCells() && m_PointRangeCount == 0 )
     {
     switch ( m_MeshIO->GetCellComponentType() )
       {
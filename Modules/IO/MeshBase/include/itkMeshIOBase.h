@@ -470,6 +470,27 @@ public:
      * file specified. */
   virtual bool CanReadFile(const char *) = 0;
 
+  /** Streamed (out-of-core) reading support. A MeshIO that can read a
+   * contiguous range of points without materializing the rest of the file
+   * overrides this method to return true and honors the point range below
+   * in ReadPoints() and ReadPointData(). The default implementation
+   * returns false, meaning the whole file is always read. */
+  virtual bool CanStreamRead()
+  {
+    return false;
+  }
+
+  /** First point and number of points of the range to be read by the
+   * next ReadPoints() / ReadPointData() call. A count of zero (the
+   * default) reads every point. The range is ignored unless
+   * CanStreamRead() returns true; call ReadMeshInformation() before
+   * querying CanStreamRead(), since streamability may depend on the way
+   * the data is stored in the file. */
+  itkSetMacro(PointRangeFirst, SizeValueType);
+  itkGetConstMacro(PointRangeFirst, SizeValueType);
+  itkSetMacro(PointRangeCount, SizeValueType);
+  itkGetConstMacro(PointRangeCount, SizeValueType);
+
   /** Determin the required information and whether need to ReadPoints,
     ReadCells, ReadPointData and ReadCellData */
   virtual void ReadMeshInformation() = 0;
@@ -745,6 +766,10 @@ protected:
   /** The buffer size of cells */
   SizeValueType m_CellBufferSize;
 
+  /** Point range for streamed reading; a count of zero reads everything */
+  SizeValueType m_PointRangeFirst{0};
+  SizeValueType m_PointRangeCount{0};
+
   /** Flags indicate whether read or write points, cells, point data and cell
     data */
   bool m_UpdatePoints{false};
@@ -225,6 +225,8 @@ MeshIOBase
   os << indent << "Number of cells: " << m_NumberOfCellPixels << std::endl;
   os << indent << "Number of point pixels: " << m_NumberOfPoints << std::endl;
   os << indent << "Number of cell pixels: " << m_NumberOfCells << std::endl;
+  os << indent << "Point range first: " << m_PointRangeFirst << std::endl;
+  os << indent << "Point range count: " << m_PointRangeCount << std::endl;
   os << indent << "Point pixel type: " << GetPixelTypeAsString(m_PointPixelType) << std::endl;
   os << indent << "Cell  pixel type: " << GetPixelTypeAsString(m_CellPixelType) << std::endl;
   os << indent << "Point pixel component type: " << GetComponentTypeAsString(m_PointPixelComponentType) << std::endl;
@@ -72,6 +72,14 @@ public:
   */
   bool CanReadFile(const char *FileNameToRead) override;
 
+  /** Streamed reading of a point range is supported for BINARY files,
+   * where the data blocks have known sizes and the requested range can be
+   * seeked to directly. ASCII files always have to be read as a whole. */
+  bool CanStreamRead() override
+  {
+    return this->m_FileType == BINARY;
+  }
+
   /** Set the spacing and dimension information for the set filename. */
   void ReadMeshInformation() override;
 
@@ -201,12 +209,38 @@ protected:
       if ( line.find("POINTS") != std::string::npos )
         {
         /**  Load the point coordinates into the itk::Mesh */
-        SizeValueType numberOfComponents = this->m_NumberOfPoints * this->m_PointDimension;
+        SizeValueType firstPoint = 0;
+        SizeValueType numberOfPointsToRead = this->m_NumberOfPoints;
+        if ( this->m_PointRangeCount > 0 )
+          {
+          // streamed reading of a point range: seek to the first
+          // requested point and read only the requested block
+          firstPoint = this->m_PointRangeFirst;
+          if ( firstPoint > this->m_NumberOfPoints )
+            {
+            firstPoint = this->m_NumberOfPoints;
+            }
+          numberOfPointsToRead = this->m_NumberOfPoints - firstPoint;
+          if ( this->m_PointRangeCount < numberOfPointsToRead )
+            {
+            numberOfPointsToRead = this->m_PointRangeCount;
+            }
+          }
+        if ( firstPoint > 0 )
+          {
+          inputFile.seekg( static_cast< std::streamoff >( firstPoint * this->m_PointDimension * sizeof( T ) ),
+                           std::ios::cur );
+          }
+        SizeValueType numberOfComponents = numberOfPointsToRead * this->m_PointDimension;
         inputFile.read( reinterpret_cast< char * >( buffer ), numberOfComponents * sizeof( T ) );
         if ( itk::ByteSwapper< T >::SystemIsLittleEndian() )
           {
           itk::ByteSwapper< T >::SwapRangeFromSystemToBigEndian(buffer, numberOfComponents);
           }
+
+        // the sections that follow are of no interest here, do not scan
+        // through their raw data
+        return;
         }
       }
   }
@@ -215,6 +249,16 @@ protected:
 
   void ReadCellsBufferAsBINARY(std::ifstream & inputFile, void *buffer);
 
+  /** Seek over a block of raw binary data in a single jump. */
+  void SkipBinaryBlock(std::ifstream & inputFile, SizeValueType numberOfBytes);
+
+  /** A BINARY file is located section by section through its header lines;
+   * without help that scan would getline through the raw data blocks byte
+   * by byte. This method recognizes the header line of a section other than
+   * the one being read and seeks the stream past its data block.
+   * \return true if the line was a known section header. */
+  bool SkipBinarySection(std::ifstream & inputFile, const StringType & line);
+
   template< typename T >
   void ReadPointDataBufferAsASCII(std::ifstream & inputFile, T *buffer)
   {
@@ -298,12 +342,42 @@ protected:
           }
 
         /** for VECTORS or NORMALS or TENSORS, we could read them directly */
-        SizeValueType numberOfComponents = this->m_NumberOfPointPixels * this->m_NumberOfPointPixelComponents;
+        SizeValueType firstPixel = 0;
+        SizeValueType numberOfPixelsToRead = this->m_NumberOfPointPixels;
+        if ( this->m_PointRangeCount > 0 )
+          {
+          // streamed reading: only the pixels attached to the requested
+          // point range are read
+          firstPixel = this->m_PointRangeFirst;
+          if ( firstPixel > this->m_NumberOfPointPixels )
+            {
+            firstPixel = this->m_NumberOfPointPixels;
+            }
+          numberOfPixelsToRead = this->m_NumberOfPointPixels - firstPixel;
+          if ( this->m_PointRangeCount < numberOfPixelsToRead )
+            {
+            numberOfPixelsToRead = this->m_PointRangeCount;
+            }
+          }
+        if ( firstPixel > 0 )
+          {
+          inputFile.seekg( static_cast< std::streamoff >(
+                             firstPixel * this->m_NumberOfPointPixelComponents * sizeof( T ) ),
+                           std::ios::cur );
+          }
+        SizeValueType numberOfComponents = numberOfPixelsToRead * this->m_NumberOfPointPixelComponents;
         inputFile.read( reinterpret_cast< char * >( buffer ), numberOfComponents * sizeof( T ) );
         if ( itk::ByteSwapper< T >::SystemIsLittleEndian() )
           {
           itk::ByteSwapper< T >::SwapRangeFromSystemToBigEndian(buffer, numberOfComponents);
           }
+        return;
+        }
+      else
+        {
+        // seek over the raw data of the preceding sections instead of
+        // scanning through them line by line
+        this->SkipBinarySection(inputFile, line);
         }
       }
   }
@@ -362,7 +436,7 @@ protected:
     while ( !inputFile.eof() )
       {
       std::getline(inputFile, line, '\n');
-      if ( line.find("POINT_DATA") != std::string::npos )
+      if ( line.find("CELL_DATA") != std::string::npos )
         {
         if ( !inputFile.eof() )
           {
@@ -370,7 +444,7 @@ protected:
           }
         else
           {
-          itkExceptionMacro("UnExpected end of line while trying to read POINT_DATA");
+          itkExceptionMacro("UnExpected end of line while trying to read CELL_DATA");
           }
 
         /** For scalars we have to read the next line of LOOKUP_TABLE */
@@ -396,6 +470,13 @@ protected:
           {
           itk::ByteSwapper< T >::SwapRangeFromSystemToBigEndian(buffer, numberOfComponents);
           }
+        return;
+        }
+      else
+        {
+        // seek over the raw data of the preceding sections instead of
+        // scanning through them line by line
+        this->SkipBinarySection(inputFile, line);
         }
       }
   }
@@ -136,6 +136,90 @@ VTKPolyDataMeshIO::GetComponentTypeFromString(const std::string & pointType)
   return compType;
 }
 
+void
+VTKPolyDataMeshIO
+::SkipBinaryBlock(std::ifstream & inputFile, SizeValueType numberOfBytes)
+{
+  inputFile.seekg(static_cast< std::streamoff >( numberOfBytes ), std::ios::cur);
+  if ( inputFile.fail() )
+    {
+    itkExceptionMacro("Unable to seek over a binary data block of\n" "inputFilename= " << this->m_FileName);
+    }
+}
+
+bool
+VTKPolyDataMeshIO
+::SkipBinarySection(std::ifstream & inputFile, const StringType & line)
+{
+  if ( this->m_FileType != BINARY )
+    {
+    return false;
+    }
+
+  StringStreamType ss;
+  ss << line;
+  StringType item;
+
+  if ( line.find("POINTS") != std::string::npos )
+    {
+    SizeValueType numberOfPoints = 0;
+    ss >> item; // should be "POINTS"
+    ss >> numberOfPoints;
+    this->SkipBinaryBlock( inputFile, numberOfPoints * this->m_PointDimension
+                           * this->GetComponentSize(this->m_PointComponentType) );
+    return true;
+    }
+
+  if ( line.find("VERTICES") != std::string::npos
+       || line.find("LINES") != std::string::npos
+       || line.find("POLYGONS") != std::string::npos )
+    {
+    SizeValueType numberOfCellsInSection = 0;
+    SizeValueType numberOfIndices = 0;
+    ss >> item; // section keyword
+    ss >> numberOfCellsInSection;
+    ss >> numberOfIndices;
+    this->SkipBinaryBlock( inputFile, numberOfIndices * static_cast< SizeValueType >( sizeof( unsigned int ) ) );
+    return true;
+    }
+
+  if ( line.find("POINT_DATA") != std::string::npos || line.find("CELL_DATA") != std::string::npos )
+    {
+    const bool isPointData = line.find("POINT_DATA") != std::string::npos;
+
+    SizeValueType numberOfPixels = 0;
+    ss >> item; // should be "POINT_DATA" or "CELL_DATA"
+    ss >> numberOfPixels;
+
+    // consume the data attribute line, and for plain scalars the
+    // LOOKUP_TABLE line that precedes the data block
+    StringType attributeLine;
+    if ( !inputFile.eof() )
+      {
+      std::getline(inputFile, attributeLine, '\n');
+      }
+    if ( attributeLine.find("SCALARS") != std::string::npos
+         && attributeLine.find("COLOR_SCALARS") == std::string::npos )
+      {
+      std::getline(inputFile, attributeLine, '\n');
+      }
+
+    if ( isPointData )
+      {
+      this->SkipBinaryBlock( inputFile, numberOfPixels * this->m_NumberOfPointPixelComponents
+                             * this->GetComponentSize(this->m_PointPixelComponentType) );
+      }
+    else
+      {
+      this->SkipBinaryBlock( inputFile, numberOfPixels * this->m_NumberOfCellPixelComponents
+                             * this->GetComponentSize(this->m_CellPixelComponentType) );
+      }
+    return true;
+    }
+
+  return false;
+}
+
 void
 VTKPolyDataMeshIO
 ::ReadMeshInformation()
@@ -239,6 +323,13 @@ VTKPolyDataMeshIO
         }
 
       this->m_UpdatePoints = true;
+
+      // jump over the point coordinates instead of scanning through them
+      if ( this->m_FileType == BINARY )
+        {
+        this->SkipBinaryBlock( inputFile, this->m_NumberOfPoints * this->m_PointDimension
+                               * this->GetComponentSize(this->m_PointComponentType) );
+        }
       }
     else if ( line.find("VERTICES") != std::string::npos )
       {
@@ -276,6 +367,11 @@ VTKPolyDataMeshIO
       // Set cell component type
       this->m_CellComponentType = UINT;
       this->m_UpdateCells = true;
+
+      if ( this->m_FileType == BINARY )
+        {
+        this->SkipBinaryBlock( inputFile, numberOfVertexIndices * static_cast< SizeValueType >( sizeof( unsigned int ) ) );
+        }
       }
     else if ( line.find("LINES") != std::string::npos )
       {
@@ -313,6 +409,11 @@ VTKPolyDataMeshIO
       // Set cell component type
       this->m_CellComponentType = UINT;
       this->m_UpdateCells = true;
+
+      if ( this->m_FileType == BINARY )
+        {
+        this->SkipBinaryBlock( inputFile, numberOfLineIndices * static_cast< SizeValueType >( sizeof( unsigned int ) ) );
+        }
       }
     else if ( line.find("POLYGONS") != std::string::npos )
       {
@@ -350,6 +451,11 @@ VTKPolyDataMeshIO
       // Set cell component type
       this->m_CellComponentType = UINT;
       this->m_UpdateCells = true;
+
+      if ( this->m_FileType == BINARY )
+        {
+        this->SkipBinaryBlock( inputFile, numberOfPolygonIndices * static_cast< SizeValueType >( sizeof( unsigned int ) ) );
+        }
       }
     else if ( line.find("POINT_DATA") != std::string::npos )
       {
@@ -485,6 +591,18 @@ VTKPolyDataMeshIO
         this->m_NumberOfPointPixelComponents = this->m_PointDimension * ( this->m_PointDimension + 1 ) / 2;
         this->m_UpdatePointData = true;
         }
+
+      // jump over the point data block instead of scanning through it
+      if ( this->m_FileType == BINARY )
+        {
+        if ( line.find("SCALARS") != std::string::npos && line.find("COLOR_SCALARS") == std::string::npos )
+          {
+          // plain scalars are preceded by a LOOKUP_TABLE line
+          std::getline(inputFile, line, '\n');
+          }
+        this->SkipBinaryBlock( inputFile, this->m_NumberOfPointPixels * this->m_NumberOfPointPixelComponents
+                               * this->GetComponentSize(this->m_PointPixelComponentType) );
+        }
       }
     else if ( line.find("CELL_DATA") != std::string::npos )
       {
@@ -618,6 +736,18 @@ VTKPolyDataMeshIO
         this->m_NumberOfCellPixelComponents = this->m_PointDimension * ( this->m_PointDimension + 1 ) / 2;
         this->m_UpdateCellData = true;
         }
+
+      // jump over the cell data block instead of scanning through it
+      if ( this->m_FileType == BINARY )
+        {
+        if ( line.find("SCALARS") != std::string::npos && line.find("COLOR_SCALARS") == std::string::npos )
+          {
+          // plain scalars are preceded by a LOOKUP_TABLE line
+          std::getline(inputFile, line, '\n');
+          }
+        this->SkipBinaryBlock( inputFile, this->m_NumberOfCellPixels * this->m_NumberOfCellPixelComponents
+                               * this->GetComponentSize(this->m_CellPixelComponentType) );
+        }
       }
     }
 
@@ -859,7 +989,10 @@ VTKPolyDataMeshIO
     return;
     }
 
-  auto * inputBuffer = new unsigned int[this->m_CellBufferSize - this->m_NumberOfCells];
+  const SizeValueType totalNumberOfIndices = this->m_CellBufferSize - this->m_NumberOfCells;
+  SizeValueType       numberOfIndicesRead = 0;
+
+  auto * inputBuffer = new unsigned int[totalNumberOfIndices];
   void *        pv = inputBuffer;
   auto * startBuffer = static_cast< char * >( pv );
   auto * outputBuffer = static_cast< unsigned int * >( buffer );
@@ -867,7 +1000,7 @@ VTKPolyDataMeshIO
   std::string          line;
   MetaDataDictionary & metaDic = this->GetMetaDataDictionary();
 
-  while ( !inputFile.eof() )
+  while ( !inputFile.eof() && numberOfIndicesRead < totalNumberOfIndices )
     {
     std::getline(inputFile, line, '\n');
     if ( line.find("VERTICES") != std::string::npos )
@@ -886,7 +1019,8 @@ VTKPolyDataMeshIO
         }
       this->WriteCellsBuffer(data, outputBuffer, MeshIOBase::VERTEX_CELL, numberOfVertices);
       startBuffer += numberOfVertexIndices * sizeof( unsigned int );
-      outputBuffer += ( numberOfVertexIndices + numberOfVertices ) * sizeof( unsigned int );
+      outputBuffer += numberOfVertexIndices + numberOfVertices;
+      numberOfIndicesRead += numberOfVertexIndices;
       }
     else if ( line.find("LINES") != std::string::npos )
       {
@@ -904,7 +1038,8 @@ VTKPolyDataMeshIO
         }
       this->WriteCellsBuffer(data, outputBuffer, MeshIOBase::LINE_CELL, numberOfLines);
       startBuffer += numberOfLineIndices * sizeof( unsigned int );
-      outputBuffer += ( numberOfLineIndices + numberOfLines ) * sizeof( unsigned int );
+      outputBuffer += numberOfLineIndices + numberOfLines;
+      numberOfIndicesRead += numberOfLineIndices;
       }
     else if ( line.find("POLYGONS") != std::string::npos )
       {
@@ -923,14 +1058,18 @@ VTKPolyDataMeshIO
 
       this->WriteCellsBuffer(data, outputBuffer, MeshIOBase::POLYGON_CELL, numberOfPolygons);
       startBuffer += numberOfPolygonIndices * sizeof( unsigned int );
-      outputBuffer += ( numberOfPolygonIndices + numberOfPolygons ) * sizeof( unsigned int );
+      outputBuffer += numberOfPolygonIndices + numberOfPolygons;
+      numberOfIndicesRead += numberOfPolygonIndices;
+      }
+    else
+      {
+      // seek over the raw data of the other sections instead of scanning
+      // through them line by line
+      this->SkipBinarySection(inputFile, line);
       }
     }
 
-  if ( this->m_CellBufferSize )
-    {
-    delete[] inputBuffer;
-    }
+  delete[] inputBuffer;
 }
 
 void
@@ -95,6 +95,25 @@ public:
       independent files */
   virtual void SetDataFileName(const char *filename);
 
+  /** Set/Get whether compressed pixel data is written as independently
+   * deflated chunks preceded by a binary chunk size table, instead of
+   * one zlib stream over the whole buffer. The chunks carry no state
+   * across each other, so they are compressed and decompressed
+   * concurrently on the global thread pool, and chunked files support
+   * streamed reading, which a whole-stream compressed file cannot.
+   * The chunked payload is an ITK extension of the MetaImage format:
+   * readers using plain MetaIO cannot decode it. Only honored when
+   * UseCompression is on and the file type is binary. */
+  itkSetMacro(UseChunkedCompression, bool);
+  itkGetConstMacro(UseChunkedCompression, bool);
+  itkBooleanMacro(UseChunkedCompression);
+
+  /** Set/Get the number of uncompressed bytes per compression chunk.
+   * Larger chunks compress slightly better, smaller chunks parallelize
+   * and stream at a finer grain. The default is 4 MiB. */
+  itkSetClampMacro(CompressionChunkSize, SizeValueType, 65536, 1 << 30);
+  itkGetConstMacro(CompressionChunkSize, SizeValueType);
+
   /** set the precision in the MetaImage member
    */
   virtual void SetDoublePrecision(unsigned int precision)
@@ -127,7 +146,9 @@ public:
   {
     if ( m_MetaImage.CompressedData() )
       {
-      return false;
+      // chunks decompress independently, so chunked files can still
+      // serve streamed reads
+      return m_ChunkedCompression;
       }
     return true;
   }
@@ -146,6 +167,16 @@ public:
     return true;
   }
 
+  /** Determine if the pixel payload can be memory mapped: the data
+   *  must be uncompressed, in native byte order and stored in a single
+   *  file (either appended to the header as with .mha, or a single
+   *  detached element data file). */
+  bool CanReadMemoryMapped() override;
+
+  /** Map the pixel payload of the current file as a private
+   *  copy-on-write view; see ImageIOBase::ReadMemoryMapped. */
+  void * ReadMemoryMapped( ImageAllocatorBase::Pointer & allocator ) override;
+
   /** Determing the subsampling factor in case
    *  we want a coarse version of the image/
    * \warning this is only used when streaming is on. */
@@ -172,10 +203,32 @@ protected:
 
 private:
 
+  /** Resolve the file holding the raw pixel payload and the byte
+   * offset of the payload within it. Returns false when the payload is
+   * not a contiguous native-order region of a single file. */
+  bool GetPixelPayloadLocation(std::string & dataFileName, SizeValueType & offset);
+
+  /** Write the pixel buffer as independently deflated chunks behind a
+   * MetaIO header describing the chunk layout. */
+  void WriteChunked(const void *buffer);
+
+  /** Fill the requested region of the buffer from a chunked file,
+   * decompressing the overlapping chunks concurrently. */
+  void ReadChunked(void *buffer);
+
   MetaImage m_MetaImage;
 
   unsigned int m_SubSamplingFactor;
 
+  bool          m_UseChunkedCompression;
+  SizeValueType m_CompressionChunkSize;
+
+  /** Chunk layout of the file described by ReadImageInformation(). */
+  bool          m_ChunkedCompression;
+  SizeValueType m_ChunkSizeInFile;
+  SizeValueType m_NumberOfChunksInFile;
+  SizeValueType m_ChunkedPayloadBytes;
+
   static unsigned int m_DefaultDoublePrecision;
 };
 } // end namespace itk
@@ -17,11 +17,18 @@
  *=========================================================================*/
 
 #include "itkMetaImageIO.h"
+#include "itkMemoryMappedFileAllocator.h"
 #include "itkSpatialOrientationAdapter.h"
 #include "itkMetaDataObject.h"
 #include "itkIOCommon.h"
 #include "itksys/SystemTools.hxx"
 #include "itkMath.h"
+#include "itkThreadPool.h"
+#include <atomic>
+#include <cstring>
+#include <future>
+#include <sstream>
+#include <vector>
 
 namespace itk
 {
@@ -33,6 +40,12 @@ MetaImageIO::MetaImageIO()
 {
   m_FileType = Binary;
   m_SubSamplingFactor = 1;
+  m_UseChunkedCompression = false;
+  m_CompressionChunkSize = 4 * 1024 * 1024;
+  m_ChunkedCompression = false;
+  m_ChunkSizeInFile = 0;
+  m_NumberOfChunksInFile = 0;
+  m_ChunkedPayloadBytes = 0;
   if ( MET_SystemByteOrderMSB() )
     {
     m_ByteOrder = BigEndian;
@@ -58,6 +71,9 @@ void MetaImageIO::PrintSelf(std::ostream & os, Indent indent) const
   Superclass::PrintSelf(os, indent);
   m_MetaImage.PrintInfo();
   os << indent << "SubSamplingFactor: " << m_SubSamplingFactor << "\n";
+  os << indent << "UseChunkedCompression: "
+     << ( m_UseChunkedCompression ? "On" : "Off" ) << "\n";
+  os << indent << "CompressionChunkSize: " << m_CompressionChunkSize << "\n";
 }
 
 void MetaImageIO::SetDataFileName(const char *filename)
@@ -399,14 +415,54 @@ void MetaImageIO::ReadImageInformation()
   //
   // save the metadatadictionary in the MetaImage header.
   // NOTE: The MetaIO library only supports typeless strings as metadata
+  // Recover the chunk layout if this file was written with
+  // UseChunkedCompression on. The describing fields are reserved for
+  // the chunked format and are kept out of the metadata dictionary.
+  m_ChunkedCompression = false;
+  m_ChunkSizeInFile = 0;
+  m_NumberOfChunksInFile = 0;
+  m_ChunkedPayloadBytes = 0;
+
   int dictFields = m_MetaImage.GetNumberOfAdditionalReadFields();
   for ( int f = 0; f < dictFields; f++ )
     {
     std::string key( m_MetaImage.GetAdditionalReadFieldName(f) );
     std::string value ( m_MetaImage.GetAdditionalReadFieldValue(f) );
+    if ( key == "ChunkedCompression" )
+      {
+      m_ChunkedCompression = ( value.compare(0, 4, "True") == 0 );
+      continue;
+      }
+    if ( key == "CompressionChunkSize" || key == "CompressionNumberOfChunks"
+         || key == "CompressionTotalBytes" )
+      {
+      SizeValueType parsed = 0;
+      std::istringstream( value ) >> parsed;
+      if ( key == "CompressionChunkSize" )
+        {
+        m_ChunkSizeInFile = parsed;
+        }
+      else if ( key == "CompressionNumberOfChunks" )
+        {
+        m_NumberOfChunksInFile = parsed;
+        }
+      else
+        {
+        m_ChunkedPayloadBytes = parsed;
+        }
+      continue;
+      }
     EncapsulateMetaData< std::string >( thisMetaDict,key,value );
     }
 
+  if ( m_ChunkedCompression
+       && ( m_ChunkSizeInFile == 0 || m_NumberOfChunksInFile == 0
+            || m_ChunkedPayloadBytes == 0 ) )
+    {
+    itkExceptionMacro( "Chunked file is missing its chunk layout fields: "
+                       << this->GetFileName() );
+    }
+
   //
   // Read some metadata
   //
@@ -426,10 +482,101 @@ void MetaImageIO::ReadImageInformation()
     }
 }
 
+bool
+MetaImageIO::GetPixelPayloadLocation(std::string & dataFileName, SizeValueType & offset)
+{
+  if ( m_MetaImage.CompressedData() )
+    {
+    return false;
+    }
+  // Byte swapping cannot be done in place on a mapping shared with the
+  // page cache.
+  if ( m_MetaImage.BinaryDataByteOrderMSB() != MET_SystemByteOrderMSB()
+       && this->GetComponentSize() > 1 )
+    {
+    return false;
+    }
+  const char *elementDataFileName = m_MetaImage.ElementDataFileName();
+  if ( elementDataFileName == nullptr )
+    {
+    return false;
+    }
+  const std::string elementDataFile = elementDataFileName;
+  if ( elementDataFile.empty()
+       || elementDataFile.compare( 0, 4, "LIST" ) == 0
+       || elementDataFile.find('%') != std::string::npos )
+    {
+    // the payload is split over multiple data files
+    return false;
+    }
+  if ( elementDataFile == "LOCAL" )
+    {
+    dataFileName = m_FileName;
+    }
+  else
+    {
+    // a detached element data file is relative to the header
+    const std::string headerDir = itksys::SystemTools::GetFilenamePath( m_FileName );
+    dataFileName = itksys::SystemTools::CollapseFullPath( elementDataFile, headerDir );
+    }
+
+  // For an uncompressed single data file the payload is the last
+  // GetImageSizeInBytes() bytes, whether the data is appended to the
+  // header (.mha), behind a user defined header size, or alone in a
+  // raw file.
+  std::ifstream dataFile( dataFileName.c_str(), std::ios::in | std::ios::binary | std::ios::ate );
+  if ( !dataFile )
+    {
+    return false;
+    }
+  const auto fileLength = static_cast< SizeValueType >( dataFile.tellg() );
+  const auto payloadLength = static_cast< SizeValueType >( this->GetImageSizeInBytes() );
+  if ( fileLength < payloadLength )
+    {
+    return false;
+    }
+  offset = fileLength - payloadLength;
+  return true;
+}
+
+bool
+MetaImageIO::CanReadMemoryMapped()
+{
+  std::string   dataFileName;
+  SizeValueType offset = 0;
+  return this->GetPixelPayloadLocation(dataFileName, offset);
+}
+
+void *
+MetaImageIO::ReadMemoryMapped( ImageAllocatorBase::Pointer & allocator )
+{
+  std::string   dataFileName;
+  SizeValueType offset = 0;
+  if ( !this->GetPixelPayloadLocation(dataFileName, offset) )
+    {
+    return nullptr;
+    }
+  MemoryMappedFileAllocator::Pointer mappingAllocator = MemoryMappedFileAllocator::New();
+  void *buffer = mappingAllocator->MapFileRegion(
+    dataFileName, offset, static_cast< SizeValueType >( this->GetImageSizeInBytes() ) );
+  if ( buffer != nullptr )
+    {
+    allocator = mappingAllocator;
+    }
+  return buffer;
+}
+
 void MetaImageIO::Read(void *buffer)
 {
   const unsigned int nDims = this->GetNumberOfDimensions();
 
+  // chunked files bypass MetaIO's element data handling entirely
+  if ( m_ChunkedCompression )
+    {
+    this->ReadChunked(buffer);
+    return;
+    }
+
   // this will check to see if we are actually streaming
   // we initialize with the dimensions of the file, since if
   // largestRegion and ioRegion don't match, we'll use the streaming
@@ -495,6 +642,193 @@ void MetaImageIO::Read(void *buffer)
     }
 }
 
+void
+MetaImageIO
+::ReadChunked(void *buffer)
+{
+  const unsigned int nDims = this->GetNumberOfDimensions();
+  const auto pixelBytes = static_cast< SizeValueType >( this->GetPixelSize() );
+  const auto totalBytes = static_cast< SizeValueType >( this->GetImageSizeInBytes() );
+  const SizeValueType chunkSize = m_ChunkSizeInFile;
+  const SizeValueType numberOfChunks = m_NumberOfChunksInFile;
+
+  if ( chunkSize * numberOfChunks < totalBytes
+       || chunkSize * ( numberOfChunks - 1 ) >= totalBytes )
+    {
+    itkExceptionMacro( "Chunk layout does not cover the image: "
+                       << this->GetFileName() );
+    }
+
+  // The byte range of the pixel stream covered by the region to read.
+  // The streamable region generator only splits along the slowest
+  // dimension, so the range is contiguous.
+  SizeValueType begin = 0;
+  SizeValueType rangeBytes = totalBytes;
+  if ( m_IORegion.GetImageDimension() == nDims && m_IORegion.GetNumberOfPixels() > 0 )
+    {
+    SizeValueType stride = pixelBytes;
+    for ( unsigned int i = 0; i < nDims; i++ )
+      {
+      if ( i + 1 < nDims
+           && ( m_IORegion.GetIndex()[i] != 0
+                || static_cast< SizeValueType >( m_IORegion.GetSize()[i] )
+                   != this->GetDimensions(i) ) )
+        {
+        itkExceptionMacro(
+          "A streamed read of a chunked file must cover the lower dimensions whole: "
+          << this->GetFileName() );
+        }
+      begin += static_cast< SizeValueType >( m_IORegion.GetIndex()[i] ) * stride;
+      stride *= this->GetDimensions(i);
+      }
+    rangeBytes = static_cast< SizeValueType >( m_IORegion.GetNumberOfPixels() ) * pixelBytes;
+    }
+  if ( rangeBytes == 0 )
+    {
+    return;
+    }
+  const SizeValueType end = begin + rangeBytes;
+
+  // The payload is the last CompressionTotalBytes bytes, whether it is
+  // appended to the header (.mha) or alone in a data file.
+  std::string dataFilePath = m_FileName;
+  const char *elementDataFileName = m_MetaImage.ElementDataFileName();
+  if ( elementDataFileName != nullptr && strlen(elementDataFileName) > 0
+       && strcmp(elementDataFileName, "LOCAL") != 0 )
+    {
+    const std::string headerDir = itksys::SystemTools::GetFilenamePath(m_FileName);
+    dataFilePath = itksys::SystemTools::CollapseFullPath(elementDataFileName, headerDir.c_str());
+    }
+
+  std::ifstream tableStream( dataFilePath.c_str(),
+                             std::ios::in | std::ios::binary | std::ios::ate );
+  if ( !tableStream )
+    {
+    itkExceptionMacro( "Chunked data file cannot be opened: " << dataFilePath );
+    }
+  const auto fileLength = static_cast< SizeValueType >( tableStream.tellg() );
+  if ( fileLength < m_ChunkedPayloadBytes )
+    {
+    itkExceptionMacro( "Chunked data file is truncated: " << dataFilePath );
+    }
+  const SizeValueType payloadOffset = fileLength - m_ChunkedPayloadBytes;
+
+  // the chunk size table is stored little endian ahead of the chunks
+  std::vector< uint64_t > table(numberOfChunks);
+  tableStream.seekg( static_cast< std::streamoff >( payloadOffset ) );
+  tableStream.read( reinterpret_cast< char * >( table.data() ),
+                    static_cast< std::streamsize >( numberOfChunks * sizeof( uint64_t ) ) );
+  if ( tableStream.fail() )
+    {
+    itkExceptionMacro( "Chunk size table cannot be read: " << dataFilePath );
+    }
+  std::vector< SizeValueType > chunkOffsets(numberOfChunks + 1, 0);
+  for ( SizeValueType chunk = 0; chunk < numberOfChunks; chunk++ )
+    {
+    if ( MET_SystemByteOrderMSB() )
+      {
+      MET_ByteOrderSwap8(&table[chunk]);
+      }
+    chunkOffsets[chunk + 1] = chunkOffsets[chunk]
+                              + static_cast< SizeValueType >( table[chunk] );
+    }
+  if ( chunkOffsets[numberOfChunks] + numberOfChunks * sizeof( uint64_t )
+       != m_ChunkedPayloadBytes )
+    {
+    itkExceptionMacro( "Chunk size table is corrupted: " << dataFilePath );
+    }
+  const SizeValueType chunkDataStart = payloadOffset + numberOfChunks * sizeof( uint64_t );
+
+  // Inflate the chunks overlapping the range concurrently, each task
+  // reading through its own stream.
+  const SizeValueType firstChunk = begin / chunkSize;
+  const SizeValueType lastChunk = ( end - 1 ) / chunkSize;
+
+  auto *destination = static_cast< unsigned char * >( buffer );
+  std::atomic< bool > readFailed(false);
+
+  ThreadPool *threadPool = ThreadPool::GetInstance();
+  std::vector< std::future< void > > decompressions;
+  decompressions.reserve(lastChunk - firstChunk + 1);
+  for ( SizeValueType chunk = firstChunk; chunk <= lastChunk; chunk++ )
+    {
+    decompressions.push_back( threadPool->AddWork(
+      [chunk, chunkSize, totalBytes, begin, end, chunkDataStart, destination,
+       &dataFilePath, &chunkOffsets, &table, &readFailed]
+        {
+        const auto compressedLength = static_cast< std::streamsize >( table[chunk] );
+        std::vector< unsigned char > compressed( static_cast< size_t >( compressedLength ) );
+        std::ifstream chunkStream( dataFilePath.c_str(),
+                                   std::ios::in | std::ios::binary );
+        chunkStream.seekg(
+          static_cast< std::streamoff >( chunkDataStart + chunkOffsets[chunk] ) );
+        chunkStream.read( reinterpret_cast< char * >( compressed.data() ),
+                          compressedLength );
+        if ( chunkStream.fail() )
+          {
+          readFailed = true;
+          return;
+          }
+        const SizeValueType uncompressedStart = chunk * chunkSize;
+        const SizeValueType uncompressedLength =
+          std::min(chunkSize, totalBytes - uncompressedStart);
+        if ( uncompressedStart >= begin
+             && uncompressedStart + uncompressedLength <= end )
+          {
+          MET_PerformUncompression(
+            compressed.data(), compressedLength,
+            destination + ( uncompressedStart - begin ),
+            static_cast< METAIO_STL::streamoff >( uncompressedLength ) );
+          }
+        else
+          {
+          // an edge chunk only partly overlaps the requested range
+          std::vector< unsigned char > scratch( static_cast< size_t >( uncompressedLength ) );
+          MET_PerformUncompression(
+            compressed.data(), compressedLength, scratch.data(),
+            static_cast< METAIO_STL::streamoff >( uncompressedLength ) );
+          const SizeValueType overlapStart = std::max(uncompressedStart, begin);
+          const SizeValueType overlapEnd =
+            std::min(uncompressedStart + uncompressedLength, end);
+          memcpy( destination + ( overlapStart - begin ),
+                  scratch.data() + ( overlapStart - uncompressedStart ),
+                  static_cast< size_t >( overlapEnd - overlapStart ) );
+          }
+        } ) );
+    }
+  for ( auto & decompression : decompressions )
+    {
+    decompression.get();
+    }
+  if ( readFailed )
+    {
+    itkExceptionMacro( "Chunked data cannot be read: " << dataFilePath );
+    }
+
+  // chunked payloads are stored in the writer's byte order
+  const unsigned int componentSize = this->GetComponentSize();
+  if ( componentSize > 1
+       && m_MetaImage.BinaryDataByteOrderMSB() != MET_SystemByteOrderMSB() )
+    {
+    for ( SizeValueType i = 0; i < rangeBytes; i += componentSize )
+      {
+      switch ( componentSize )
+        {
+        case 2:
+          MET_ByteOrderSwap2(destination + i);
+          break;
+        case 4:
+          MET_ByteOrderSwap4(destination + i);
+          break;
+        case 8:
+        default:
+          MET_ByteOrderSwap8(destination + i);
+          break;
+        }
+      }
+    }
+}
+
 MetaImage * MetaImageIO::GetMetaImagePointer()
 {
   return &m_MetaImage;
@@ -1114,6 +1448,20 @@ MetaImageIO
     delete[] indexMin;
     delete[] indexMax;
     }
+  else if ( m_UseCompression && m_UseChunkedCompression && binaryData )
+    {
+    try
+      {
+      this->WriteChunked(buffer);
+      }
+    catch ( ... )
+      {
+      delete[] dSize;
+      delete[] eSpacing;
+      delete[] eOrigin;
+      throw;
+      }
+    }
   else
     {
     if ( !m_MetaImage.Write( m_FileName.c_str() ) )
@@ -1134,6 +1482,161 @@ MetaImageIO
   delete[] eOrigin;
 }
 
+void
+MetaImageIO
+::WriteChunked(const void *buffer)
+{
+  const auto totalBytes = static_cast< SizeValueType >( this->GetImageSizeInBytes() );
+  const SizeValueType chunkSize = m_CompressionChunkSize;
+  const SizeValueType numberOfChunks = ( totalBytes + chunkSize - 1 ) / chunkSize;
+
+  // Deflate every chunk as an independent stream. The chunks share no
+  // state, so they all go to the thread pool at once.
+  const auto *source = static_cast< const unsigned char * >( buffer );
+  std::vector< unsigned char * >       compressedChunks(numberOfChunks, nullptr);
+  std::vector< METAIO_STL::streamoff > compressedSizes(numberOfChunks, 0);
+
+  ThreadPool *threadPool = ThreadPool::GetInstance();
+  std::vector< std::future< void > > compressions;
+  compressions.reserve(numberOfChunks);
+  for ( SizeValueType chunk = 0; chunk < numberOfChunks; chunk++ )
+    {
+    compressions.push_back( threadPool->AddWork(
+      [chunk, chunkSize, totalBytes, source, &compressedChunks, &compressedSizes]
+        {
+        const SizeValueType start = chunk * chunkSize;
+        const SizeValueType length = std::min(chunkSize, totalBytes - start);
+        compressedChunks[chunk] = MET_PerformCompression(
+          source + start, static_cast< METAIO_STL::streamoff >( length ),
+          &compressedSizes[chunk] );
+        } ) );
+    }
+  for ( auto & compression : compressions )
+    {
+    compression.get();
+    }
+
+  // the 8 byte little endian size table sits ahead of the chunk data
+  SizeValueType payloadBytes = numberOfChunks * sizeof( uint64_t );
+  for ( SizeValueType chunk = 0; chunk < numberOfChunks; chunk++ )
+    {
+    payloadBytes += static_cast< SizeValueType >( compressedSizes[chunk] );
+    }
+
+  const auto freeChunks = [&compressedChunks]
+    {
+    for ( auto & compressedChunk : compressedChunks )
+      {
+      delete[] compressedChunk;
+      compressedChunk = nullptr;
+      }
+    };
+
+  // the chunk layout goes into short header fields
+  const auto addLayoutField = [this]( const char *name, SizeValueType fieldValue )
+    {
+    std::ostringstream fieldStream;
+    fieldStream << fieldValue;
+    const std::string fieldString = fieldStream.str();
+    m_MetaImage.AddUserField( name, MET_STRING,
+                              static_cast< int >( fieldString.size() ),
+                              fieldString.c_str(), true, -1 );
+    };
+  m_MetaImage.AddUserField( "ChunkedCompression", MET_STRING,
+                            static_cast< int >( strlen("True") ), "True", true, -1 );
+  addLayoutField( "CompressionChunkSize", chunkSize );
+  addLayoutField( "CompressionNumberOfChunks", numberOfChunks );
+  addLayoutField( "CompressionTotalBytes", payloadBytes );
+
+  // The payload is appended to the header for .mha, and lives in a
+  // data file next to the header otherwise. A data file name set with
+  // SetDataFileName() is honored.
+  std::string elementDataFileName = "LOCAL";
+  std::string dataFilePath = m_FileName;
+  const char *existingName = m_MetaImage.ElementDataFileName();
+  const std::string::size_type mhaPos = m_FileName.rfind(".mha");
+  const bool localData = ( mhaPos != std::string::npos )
+                         && ( mhaPos == m_FileName.length() - 4 );
+  if ( existingName != nullptr && strlen(existingName) > 0 )
+    {
+    elementDataFileName = existingName;
+    }
+  else if ( !localData )
+    {
+    elementDataFileName = itksys::SystemTools::GetFilenameWithoutLastExtension(
+        itksys::SystemTools::GetFilenameName(m_FileName) ) + ".zraw";
+    }
+  m_MetaImage.ElementDataFileName( elementDataFileName.c_str() );
+  if ( elementDataFileName != "LOCAL" )
+    {
+    const std::string headerDir = itksys::SystemTools::GetFilenamePath(m_FileName);
+    dataFilePath = itksys::SystemTools::CollapseFullPath( elementDataFileName.c_str(),
+                                                          headerDir.c_str() );
+    }
+
+  // write the header only; the payload is laid out here, not by MetaIO
+  const bool headerWritten = m_MetaImage.MetaObject::Write( m_FileName.c_str() );
+  if ( !headerWritten )
+    {
+    freeChunks();
+    m_MetaImage.ElementDataFileName("");
+    m_MetaImage.ClearUserFields();
+    itkExceptionMacro( "File cannot be written: "
+                       << this->GetFileName()
+                       << std::endl
+                       << "Reason: "
+                       << itksys::SystemTools::GetLastSystemError() );
+    }
+
+  std::ofstream payloadStream;
+  if ( elementDataFileName == "LOCAL" )
+    {
+    payloadStream.open( m_FileName.c_str(),
+                        std::ios::out | std::ios::binary | std::ios::app );
+    }
+  else
+    {
+    payloadStream.open( dataFilePath.c_str(),
+                        std::ios::out | std::ios::binary | std::ios::trunc );
+    }
+  if ( !payloadStream )
+    {
+    freeChunks();
+    m_MetaImage.ElementDataFileName("");
+    m_MetaImage.ClearUserFields();
+    itkExceptionMacro( "Chunked data file cannot be opened for writing: "
+                       << dataFilePath );
+    }
+
+  for ( SizeValueType chunk = 0; chunk < numberOfChunks; chunk++ )
+    {
+    auto tableEntry = static_cast< uint64_t >( compressedSizes[chunk] );
+    if ( MET_SystemByteOrderMSB() )
+      {
+      MET_ByteOrderSwap8(&tableEntry);
+      }
+    payloadStream.write( reinterpret_cast< const char * >( &tableEntry ),
+                         sizeof( tableEntry ) );
+    }
+  for ( SizeValueType chunk = 0; chunk < numberOfChunks; chunk++ )
+    {
+    payloadStream.write( reinterpret_cast< const char * >( compressedChunks[chunk] ),
+                         static_cast< std::streamsize >( compressedSizes[chunk] ) );
+    }
+  freeChunks();
+  payloadStream.close();
+  if ( payloadStream.fail() )
+    {
+    m_MetaImage.ElementDataFileName("");
+    m_MetaImage.ClearUserFields();
+    itkExceptionMacro( "Chunked data cannot be written: " << dataFilePath );
+    }
+
+  // the layout fields must not leak into a later non chunked write
+  m_MetaImage.ElementDataFileName("");
+  m_MetaImage.ClearUserFields();
+}
+
 /** Given a requested region, determine what could be the region that we can
  * read from the file. This is called the streamable region, which will be
  * smaller than the LargestPossibleRegion and greater or equal to the
@@ -1159,6 +1662,17 @@ MetaImageIO
   else
     {
     streamableRegion = requestedRegion;
+    if ( m_ChunkedCompression )
+      {
+      // Chunks cover contiguous spans of the pixel stream, so only
+      // splits along the slowest dimension keep the requested bytes
+      // contiguous; the lower dimensions are read whole.
+      for ( unsigned int i = 0; i + 1 < this->m_NumberOfDimensions; i++ )
+        {
+        streamableRegion.SetSize(i, this->m_Dimensions[i]);
+        streamableRegion.SetIndex(i, 0);
+        }
+      }
     }
 
   return streamableRegion;
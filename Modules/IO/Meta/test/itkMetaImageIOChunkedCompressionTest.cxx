@@ -0,0 +1,161 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkImageFileReader.h"
+#include "itkImageFileWriter.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkMetaImageIO.h"
+
+#include <iostream>
+#include <string>
+
+namespace
+{
+
+using PixelType = unsigned short;
+using ImageType = itk::Image< PixelType, 3 >;
+
+// deterministic value for every voxel so any part of a streamed read
+// can be verified without the original image at hand
+PixelType PixelValue( const ImageType::IndexType & index )
+{
+  return static_cast< PixelType >( ( index[0] + 17 * index[1] + 31 * index[2] ) % 4093 );
+}
+
+} // end anonymous namespace
+
+// Write an image with UseChunkedCompression on, read it back whole, and
+// read a sub region in streamed fashion. Expects the output file name
+// (.mha) as argument.
+int itkMetaImageIOChunkedCompressionTest(int argc, char* argv[])
+{
+  if ( argc < 2 )
+    {
+    std::cerr << "Usage: " << argv[0] << " outputFileName" << std::endl;
+    return EXIT_FAILURE;
+    }
+  const std::string fileName = argv[1];
+
+  // Large enough for several chunks at the smallest chunk size:
+  // 64 x 64 x 32 unsigned short is 256 KiB, four chunks of 64 KiB.
+  ImageType::SizeType size = {{64, 64, 32}};
+  ImageType::RegionType largestRegion;
+  largestRegion.SetSize( size );
+
+  ImageType::Pointer image = ImageType::New();
+  image->SetRegions( largestRegion );
+  image->Allocate();
+
+  itk::ImageRegionIteratorWithIndex< ImageType > it( image, largestRegion );
+  for ( it.GoToBegin(); !it.IsAtEnd(); ++it )
+    {
+    it.Set( PixelValue( it.GetIndex() ) );
+    }
+
+  // write with chunked compression
+  itk::MetaImageIO::Pointer metaOut = itk::MetaImageIO::New();
+  metaOut->SetUseCompression( true );
+  metaOut->UseChunkedCompressionOn();
+  metaOut->SetCompressionChunkSize( 65536 );
+
+  using WriterType = itk::ImageFileWriter< ImageType >;
+  WriterType::Pointer writer = WriterType::New();
+  writer->SetImageIO( metaOut );
+  writer->SetFileName( fileName );
+  writer->SetInput( image );
+  writer->Update();
+
+  // read the whole file back and compare voxel by voxel
+  itk::MetaImageIO::Pointer metaIn = itk::MetaImageIO::New();
+
+  using ReaderType = itk::ImageFileReader< ImageType >;
+  ReaderType::Pointer reader = ReaderType::New();
+  reader->SetImageIO( metaIn );
+  reader->SetFileName( fileName );
+  reader->Update();
+
+  // a chunked file is compressed yet still claims streamed reading
+  if ( !metaIn->CanStreamRead() )
+    {
+    std::cerr << "CanStreamRead() is false for a chunked file." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  itk::ImageRegionIteratorWithIndex< ImageType > readIt( reader->GetOutput(),
+    largestRegion );
+  for ( readIt.GoToBegin(); !readIt.IsAtEnd(); ++readIt )
+    {
+    if ( readIt.Get() != PixelValue( readIt.GetIndex() ) )
+      {
+      std::cerr << "Round trip mismatch at " << readIt.GetIndex() << ": "
+                << readIt.Get() << " != " << PixelValue( readIt.GetIndex() )
+                << std::endl;
+      return EXIT_FAILURE;
+      }
+    }
+
+  // streamed read of a sub region: the streamable region must keep the
+  // requested slices but is free to widen the lower dimensions
+  ImageType::RegionType requestedRegion;
+  ImageType::IndexType requestedIndex = {{5, 6, 10}};
+  ImageType::SizeType requestedSize = {{20, 24, 8}};
+  requestedRegion.SetIndex( requestedIndex );
+  requestedRegion.SetSize( requestedSize );
+
+  itk::MetaImageIO::Pointer metaStream = itk::MetaImageIO::New();
+  ReaderType::Pointer streamedReader = ReaderType::New();
+  streamedReader->SetImageIO( metaStream );
+  streamedReader->SetFileName( fileName );
+  streamedReader->SetUseStreaming( true );
+
+  streamedReader->GetOutput()->UpdateOutputInformation();
+  streamedReader->GetOutput()->SetRequestedRegion( requestedRegion );
+  streamedReader->GetOutput()->PropagateRequestedRegion();
+  streamedReader->GetOutput()->UpdateOutputData();
+
+  const ImageType::RegionType bufferedRegion =
+    streamedReader->GetOutput()->GetBufferedRegion();
+  if ( !bufferedRegion.IsInside( requestedRegion ) )
+    {
+    std::cerr << "Streamed read did not cover the requested region: "
+              << bufferedRegion << std::endl;
+    return EXIT_FAILURE;
+    }
+  if ( bufferedRegion.GetSize()[2] == size[2] )
+    {
+    std::cerr << "Streamed read buffered the whole image: "
+              << bufferedRegion << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  itk::ImageRegionIteratorWithIndex< ImageType > streamedIt(
+    streamedReader->GetOutput(), bufferedRegion );
+  for ( streamedIt.GoToBegin(); !streamedIt.IsAtEnd(); ++streamedIt )
+    {
+    if ( streamedIt.Get() != PixelValue( streamedIt.GetIndex() ) )
+      {
+      std::cerr << "Streamed read mismatch at " << streamedIt.GetIndex()
+                << ": " << streamedIt.Get() << " != "
+                << PixelValue( streamedIt.GetIndex() ) << std::endl;
+      return EXIT_FAILURE;
+      }
+    }
+
+  std::cout << "Test PASSED." << std::endl;
+  return EXIT_SUCCESS;
+}
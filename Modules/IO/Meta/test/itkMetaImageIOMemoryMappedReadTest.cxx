@@ -0,0 +1,121 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkImageFileReader.h"
+#include "itkImageFileWriter.h"
+#include "itkImageRegionIterator.h"
+#include "itkMetaImageIO.h"
+#include "itkTestingMacros.h"
+
+// Write an uncompressed MetaImage and read it back with memory-mapped
+// reading requested, for both the attached (.mha) and detached (.mhd +
+// .raw) layouts, verifying the adopted pixel buffer has the expected
+// content and is writable.
+namespace
+{
+
+using ImageType = itk::Image< unsigned short, 3 >;
+
+ImageType::Pointer CreateTestImage()
+{
+  ImageType::Pointer image = ImageType::New();
+  ImageType::SizeType size;
+  size.Fill(16);
+  image->SetRegions(size);
+  image->Allocate();
+
+  itk::ImageRegionIterator< ImageType > it( image, image->GetBufferedRegion() );
+  unsigned short value = 0;
+  while ( !it.IsAtEnd() )
+    {
+    it.Set(value++);
+    ++it;
+    }
+  return image;
+}
+
+int ReadBackAndCheck( const std::string & fileName )
+{
+  using ReaderType = itk::ImageFileReader< ImageType >;
+  ReaderType::Pointer reader = ReaderType::New();
+  itk::MetaImageIO::Pointer io = itk::MetaImageIO::New();
+  io->UseMemoryMappedReadingOn();
+  reader->SetImageIO(io);
+  reader->SetFileName(fileName);
+  TRY_EXPECT_NO_EXCEPTION( reader->Update() );
+
+  ImageType::Pointer image = reader->GetOutput();
+  itk::ImageRegionIterator< ImageType > it( image, image->GetBufferedRegion() );
+  unsigned short value = 0;
+  while ( !it.IsAtEnd() )
+    {
+    if ( it.Get() != value++ )
+      {
+      std::cerr << "Unexpected pixel value in " << fileName << std::endl;
+      return EXIT_FAILURE;
+      }
+    ++it;
+    }
+
+  // the copy-on-write mapping must be writable in place
+  ImageType::IndexType index;
+  index.Fill(0);
+  image->SetPixel(index, 42);
+  TEST_EXPECT_TRUE( image->GetPixel(index) == 42 );
+
+  return EXIT_SUCCESS;
+}
+
+} // end namespace
+
+int itkMetaImageIOMemoryMappedReadTest(int argc, char *argv[])
+{
+  if ( argc < 2 )
+    {
+    std::cerr << "Usage: " << argv[0] << " outputDirectory" << std::endl;
+    return EXIT_FAILURE;
+    }
+  const std::string outputDirectory = argv[1];
+
+  ImageType::Pointer image = CreateTestImage();
+
+  using WriterType = itk::ImageFileWriter< ImageType >;
+  WriterType::Pointer writer = WriterType::New();
+  writer->SetInput(image);
+
+  // attached layout: header and payload in one file
+  const std::string mhaFileName = outputDirectory + "/MemoryMappedReadTest.mha";
+  writer->SetFileName(mhaFileName);
+  TRY_EXPECT_NO_EXCEPTION( writer->Update() );
+  if ( ReadBackAndCheck(mhaFileName) != EXIT_SUCCESS )
+    {
+    return EXIT_FAILURE;
+    }
+
+  // detached layout: header with a separate raw element data file
+  const std::string mhdFileName = outputDirectory + "/MemoryMappedReadTest.mhd";
+  writer->SetFileName(mhdFileName);
+  TRY_EXPECT_NO_EXCEPTION( writer->Update() );
+  if ( ReadBackAndCheck(mhdFileName) != EXIT_SUCCESS )
+    {
+    return EXIT_FAILURE;
+    }
+
+  std::cout << "Test finished" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -89,6 +89,9 @@ public:
    */
   bool CanReadFile(const char *FileNameToRead) override;
 
+  /** The NIfTI magic strings at offset 344 of the header. */
+  ArrayOfMagicByteSignaturesType GetMagicByteSignatures() const override;
+
   /** Set the spacing and dimension information for the set filename. */
   void ReadImageInformation() override;
 
@@ -131,6 +134,18 @@ public:
   itkSetMacro(LegacyAnalyze75Mode, bool);
   itkGetConstMacro(LegacyAnalyze75Mode, bool);
 
+  /** Set/Get whether gzipped single-file NIfTI images (.nii.gz) are
+   * compressed and decompressed in parallel. Files are then written as a
+   * sequence of independently deflated gzip members whose sizes are
+   * recorded in a gzip extra field, so every member can be inflated
+   * concurrently on a later read; any gzip implementation can still
+   * read them serially. Files without the extra field, two-file images
+   * and sub-region reads fall back to the serial niftilib path.
+   * Off by default. */
+  itkSetMacro(UseParallelCompression, bool);
+  itkGetConstMacro(UseParallelCompression, bool);
+  itkBooleanMacro(UseParallelCompression);
+
 protected:
   NiftiImageIO();
   ~NiftiImageIO() override;
@@ -148,6 +163,17 @@ private:
 
   bool  MustRescale();
 
+  /** Inflate the data members of a block-indexed gzip file concurrently.
+   * Returns a malloc'ed buffer holding the voxel data, or nullptr when
+   * the open file is not laid out in indexed members. */
+  void * TryParallelCompressedLoad();
+
+  /** Deflate the header and fixed-size blocks of the voxel data into
+   * independent gzip members concurrently. Returns false when the
+   * output is not a gzipped single-file NIfTI image, leaving the write
+   * to the serial niftilib path. */
+  bool  TryParallelCompressedWrite();
+
   void  DefineHeaderObjectDataType();
 
   void  SetNIfTIOrientationFromImageIO(unsigned short int origdims, unsigned short int dims);
@@ -173,6 +199,8 @@ private:
 
   bool m_LegacyAnalyze75Mode{true};
 
+  bool m_UseParallelCompression{false};
+
 };
 } // end namespace itk
 
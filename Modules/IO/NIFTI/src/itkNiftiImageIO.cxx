@@ -18,9 +18,17 @@
 #include "itkNiftiImageIO.h"
 #include "itkIOCommon.h"
 #include "itkMetaDataObject.h"
+#include "itkMultiThreaderBase.h"
 #include "itkSpatialOrientationAdapter.h"
+#include "itkThreadPool.h"
+#include "itk_zlib.h"
 #include <nifti1_io.h>
 
+#include <algorithm>
+#include <exception>
+#include <future>
+#include <vector>
+
 namespace itk
 {
 //#define ITK_USE_VERY_VERBOSE_NIFTI_DEBUGGING
@@ -441,6 +449,7 @@ NiftiImageIO
 {
   Superclass::PrintSelf(os, indent);
   os << indent << "LegacyAnalyze75Mode: " << this->m_LegacyAnalyze75Mode << std::endl;
+  os << indent << "UseParallelCompression: " << this->m_UseParallelCompression << std::endl;
 }
 
 bool
@@ -487,6 +496,420 @@ CastCopy(float *to, const void *from, size_t pixelcount)
     }
 }
 
+namespace
+{
+// Layout of the gzip members produced by TryParallelCompressedWrite():
+// the fixed 10-byte base header, a 12-byte extra field, the deflate
+// stream and the 8-byte gzip trailer. The extra subfield "IT" records
+// the compressed and uncompressed member sizes, so a later read can hop
+// from member to member and inflate all of them concurrently.
+constexpr size_t GzipMemberSizesOffset = 16;
+
+// Uncompressed bytes deflated into each data member.
+constexpr size_t GzipDataBlockSize = size_t(1) << 22;
+
+struct GzipMemberLayout
+{
+  size_t FileOffset;
+  size_t CompressedSize;
+  size_t UncompressedOffset;
+  size_t UncompressedSize;
+};
+
+bool ParseIndexedGzipMembers(const std::vector< char > & file,
+                             std::vector< GzipMemberLayout > & members)
+{
+  const auto * bytes = reinterpret_cast< const unsigned char * >( file.data() );
+  size_t offset = 0;
+  size_t uncompressedOffset = 0;
+
+  while ( offset < file.size() )
+    {
+    if ( offset + GzipMemberSizesOffset + 8 > file.size()
+         || bytes[offset] != 0x1f
+         || bytes[offset + 1] != 0x8b
+         || bytes[offset + 2] != 8      // deflate
+         || bytes[offset + 3] != 0x04 ) // FEXTRA and nothing else
+      {
+      return false;
+      }
+
+    const size_t xlen = bytes[offset + 10] + ( size_t( bytes[offset + 11] ) << 8 );
+    if ( xlen != 12
+         || bytes[offset + 12] != 'I'
+         || bytes[offset + 13] != 'T'
+         || bytes[offset + 14] != 8
+         || bytes[offset + 15] != 0 )
+      {
+      return false;
+      }
+
+    GzipMemberLayout member;
+    member.FileOffset = offset;
+    member.CompressedSize = 0;
+    member.UncompressedSize = 0;
+    for ( unsigned int b = 0; b < 4; b++ )
+      {
+      member.CompressedSize |= size_t( bytes[offset + GzipMemberSizesOffset + b] ) << ( 8 * b );
+      member.UncompressedSize |= size_t( bytes[offset + GzipMemberSizesOffset + 4 + b] ) << ( 8 * b );
+      }
+    member.UncompressedOffset = uncompressedOffset;
+
+    if ( member.CompressedSize <= GzipMemberSizesOffset + 8
+         || offset + member.CompressedSize > file.size() )
+      {
+      return false;
+      }
+
+    offset += member.CompressedSize;
+    uncompressedOffset += member.UncompressedSize;
+    members.push_back(member);
+    }
+
+  return !members.empty();
+}
+
+void InflateGzipMember(const unsigned char *in, size_t inSize,
+                       unsigned char *out, size_t outSize)
+{
+  z_stream strm{};
+  if ( inflateInit2(&strm, 15 + 16) != Z_OK )
+    {
+    itkGenericExceptionMacro(<< "inflateInit2 failed");
+    }
+
+  strm.next_in = const_cast< Bytef * >( in );
+  strm.avail_in = static_cast< uInt >( inSize );
+  strm.next_out = out;
+  strm.avail_out = static_cast< uInt >( outSize );
+
+  const int  status = inflate(&strm, Z_FINISH);
+  const bool complete = ( status == Z_STREAM_END && strm.total_out == outSize );
+  inflateEnd(&strm);
+
+  if ( !complete )
+    {
+    itkGenericExceptionMacro(<< "inflating a gzip member failed");
+    }
+}
+
+void DeflateGzipMember(const unsigned char *in, size_t inSize,
+                       std::vector< unsigned char > & out)
+{
+  z_stream strm{};
+  if ( deflateInit2(&strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8,
+                    Z_DEFAULT_STRATEGY) != Z_OK )
+    {
+    itkGenericExceptionMacro(<< "deflateInit2 failed");
+    }
+
+  unsigned char extra[12] = { 'I', 'T', 8, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+  gz_header header{};
+  header.os = 255;
+  header.extra = extra;
+  header.extra_len = 12;
+  if ( deflateSetHeader(&strm, &header) != Z_OK )
+    {
+    deflateEnd(&strm);
+    itkGenericExceptionMacro(<< "deflateSetHeader failed");
+    }
+
+  out.resize( deflateBound( &strm, static_cast< uLong >( inSize ) ) + 32 );
+
+  strm.next_in = const_cast< Bytef * >( in );
+  strm.avail_in = static_cast< uInt >( inSize );
+  strm.next_out = out.data();
+  strm.avail_out = static_cast< uInt >( out.size() );
+
+  const int    status = deflate(&strm, Z_FINISH);
+  const bool   complete = ( status == Z_STREAM_END );
+  const size_t compressedSize = strm.total_out;
+  deflateEnd(&strm);
+
+  if ( !complete )
+    {
+    itkGenericExceptionMacro(<< "deflating a gzip member failed");
+    }
+
+  out.resize(compressedSize);
+
+  // record the member sizes in the extra field for the parallel reader
+  for ( unsigned int b = 0; b < 4; b++ )
+    {
+    out[GzipMemberSizesOffset + b] = static_cast< unsigned char >( compressedSize >> ( 8 * b ) );
+    out[GzipMemberSizesOffset + 4 + b] = static_cast< unsigned char >( inSize >> ( 8 * b ) );
+    }
+}
+} // end anonymous namespace
+
+void * NiftiImageIO::TryParallelCompressedLoad()
+{
+  // only single-file gzipped images in the native byte order are laid
+  // out in indexed members by TryParallelCompressedWrite()
+  if ( this->m_NiftiImage->nifti_type != NIFTI_FTYPE_NIFTI1_1
+       || !nifti_is_gzfile(this->m_NiftiImage->iname)
+       || this->m_NiftiImage->byteorder != nifti_short_order() )
+    {
+    return nullptr;
+    }
+
+  std::ifstream file(this->m_NiftiImage->iname, std::ios::in | std::ios::binary);
+  if ( !file.is_open() )
+    {
+    return nullptr;
+    }
+  file.seekg(0, std::ios::end);
+  const auto fileSize = static_cast< size_t >( file.tellg() );
+  file.seekg(0, std::ios::beg);
+  std::vector< char > compressed(fileSize);
+  file.read(compressed.data(), fileSize);
+  if ( !file )
+    {
+    return nullptr;
+    }
+
+  std::vector< GzipMemberLayout > members;
+  if ( !ParseIndexedGzipMembers(compressed, members) )
+    {
+    return nullptr;
+    }
+
+  const auto   dataOffset = static_cast< size_t >( this->m_NiftiImage->iname_offset );
+  const size_t dataSize = size_t( this->m_NiftiImage->nvox ) * this->m_NiftiImage->nbyper;
+
+  // the writer puts the header and the voxel data in separate members,
+  // so a member boundary is expected exactly at the data offset
+  size_t firstDataMember = members.size();
+  for ( size_t m = 0; m < members.size(); m++ )
+    {
+    if ( members[m].UncompressedOffset == dataOffset )
+      {
+      firstDataMember = m;
+      break;
+      }
+    }
+  const GzipMemberLayout & lastMember = members.back();
+  if ( firstDataMember == members.size()
+       || lastMember.UncompressedOffset + lastMember.UncompressedSize != dataOffset + dataSize )
+    {
+    return nullptr;
+    }
+
+  // malloc to match the allocation the callers of nifti_image_load expect
+  auto * data = static_cast< unsigned char * >( malloc(dataSize) );
+  if ( data == nullptr )
+    {
+    return nullptr;
+    }
+
+  const auto * fileBytes = reinterpret_cast< const unsigned char * >( compressed.data() );
+
+  auto inflateRange = [&members, fileBytes, data, dataOffset](size_t begin, size_t end)
+    {
+    for ( size_t m = begin; m < end; m++ )
+      {
+      InflateGzipMember(fileBytes + members[m].FileOffset,
+                        members[m].CompressedSize,
+                        data + ( members[m].UncompressedOffset - dataOffset ),
+                        members[m].UncompressedSize);
+      }
+    };
+
+  const size_t numberOfDataMembers = members.size() - firstDataMember;
+  const size_t numberOfWorkers = std::min(
+    size_t( MultiThreaderBase::GetGlobalDefaultNumberOfThreads() ), numberOfDataMembers );
+
+  if ( numberOfWorkers < 2 || ThreadPool::IsPoolWorker() )
+    {
+    try
+      {
+      inflateRange(firstDataMember, members.size());
+      }
+    catch ( ... )
+      {
+      free(data);
+      throw;
+      }
+    return data;
+    }
+
+  std::vector< std::future< void > > inflaters;
+  std::exception_ptr firstError;
+
+  for ( size_t worker = 1; worker < numberOfWorkers; worker++ )
+    {
+    const size_t begin = firstDataMember + ( numberOfDataMembers * worker ) / numberOfWorkers;
+    const size_t end = firstDataMember + ( numberOfDataMembers * ( worker + 1 ) ) / numberOfWorkers;
+    inflaters.push_back( ThreadPool::GetInstance()->AddWork(
+      [inflateRange, begin, end]() { inflateRange(begin, end); } ) );
+    }
+
+  try
+    {
+    inflateRange(firstDataMember, firstDataMember + numberOfDataMembers / numberOfWorkers);
+    }
+  catch ( ... )
+    {
+    firstError = std::current_exception();
+    }
+
+  // join every inflater before propagating an error, they write into
+  // the freshly allocated buffer
+  for ( auto & inflater : inflaters )
+    {
+    try
+      {
+      inflater.get();
+      }
+    catch ( ... )
+      {
+      if ( !firstError )
+        {
+        firstError = std::current_exception();
+        }
+      }
+    }
+
+  if ( firstError )
+    {
+    free(data);
+    std::rethrow_exception(firstError);
+    }
+
+  return data;
+}
+
+bool NiftiImageIO::TryParallelCompressedWrite()
+{
+  if ( this->m_NiftiImage->nifti_type != NIFTI_FTYPE_NIFTI1_1
+       || !nifti_is_gzfile(this->m_NiftiImage->fname) )
+    {
+    return false;
+    }
+
+  nifti_set_iname_offset(this->m_NiftiImage);
+  nifti_1_header hdr = nifti_convert_nim2nhdr(this->m_NiftiImage);
+
+  // serialize the header, the extender and the extensions, padded out
+  // to the voxel data offset, exactly as nifti_image_write lays them out
+  std::vector< unsigned char > headerBlob(static_cast< size_t >( this->m_NiftiImage->iname_offset ), 0);
+  if ( headerBlob.size() < sizeof( hdr ) + 4 )
+    {
+    return false;
+    }
+  memcpy(headerBlob.data(), &hdr, sizeof( hdr ));
+  size_t extensionOffset = sizeof( hdr ) + 4;
+  if ( this->m_NiftiImage->num_ext > 0 )
+    {
+    headerBlob[sizeof( hdr )] = 1;
+    for ( int e = 0; e < this->m_NiftiImage->num_ext; e++ )
+      {
+      const nifti1_extension & ext = this->m_NiftiImage->ext_list[e];
+      if ( ext.esize < 8
+           || extensionOffset + ext.esize > headerBlob.size() )
+        {
+        return false;
+        }
+      memcpy(headerBlob.data() + extensionOffset, &ext.esize, sizeof( int ));
+      memcpy(headerBlob.data() + extensionOffset + sizeof( int ), &ext.ecode, sizeof( int ));
+      memcpy(headerBlob.data() + extensionOffset + 2 * sizeof( int ), ext.edata, ext.esize - 8);
+      extensionOffset += ext.esize;
+      }
+    }
+
+  const size_t dataSize = size_t( this->m_NiftiImage->nvox ) * this->m_NiftiImage->nbyper;
+  const auto * dataBytes = static_cast< const unsigned char * >( this->m_NiftiImage->data );
+
+  const size_t numberOfDataMembers = ( dataSize + GzipDataBlockSize - 1 ) / GzipDataBlockSize;
+  std::vector< std::vector< unsigned char > > members(1 + numberOfDataMembers);
+
+  auto deflateRange = [&members, dataBytes, dataSize](size_t begin, size_t end)
+    {
+    for ( size_t m = begin; m < end; m++ )
+      {
+      const size_t blockOffset = ( m - 1 ) * GzipDataBlockSize;
+      DeflateGzipMember(dataBytes + blockOffset,
+                        std::min(GzipDataBlockSize, dataSize - blockOffset),
+                        members[m]);
+      }
+    };
+
+  const size_t numberOfWorkers = std::min(
+    size_t( MultiThreaderBase::GetGlobalDefaultNumberOfThreads() ), numberOfDataMembers );
+
+  if ( numberOfWorkers < 2 || ThreadPool::IsPoolWorker() )
+    {
+    DeflateGzipMember(headerBlob.data(), headerBlob.size(), members[0]);
+    deflateRange(1, members.size());
+    }
+  else
+    {
+    std::vector< std::future< void > > deflaters;
+    std::exception_ptr firstError;
+
+    for ( size_t worker = 1; worker < numberOfWorkers; worker++ )
+      {
+      const size_t begin = 1 + ( numberOfDataMembers * worker ) / numberOfWorkers;
+      const size_t end = 1 + ( numberOfDataMembers * ( worker + 1 ) ) / numberOfWorkers;
+      deflaters.push_back( ThreadPool::GetInstance()->AddWork(
+        [deflateRange, begin, end]() { deflateRange(begin, end); } ) );
+      }
+
+    try
+      {
+      DeflateGzipMember(headerBlob.data(), headerBlob.size(), members[0]);
+      deflateRange(1, 1 + numberOfDataMembers / numberOfWorkers);
+      }
+    catch ( ... )
+      {
+      firstError = std::current_exception();
+      }
+
+    // join every deflater before propagating an error, they write into
+    // the shared member table
+    for ( auto & deflater : deflaters )
+      {
+      try
+        {
+        deflater.get();
+        }
+      catch ( ... )
+        {
+        if ( !firstError )
+          {
+          firstError = std::current_exception();
+          }
+        }
+      }
+
+    if ( firstError )
+      {
+      std::rethrow_exception(firstError);
+      }
+    }
+
+  std::ofstream file(this->m_NiftiImage->fname,
+                     std::ios::out | std::ios::binary | std::ios::trunc);
+  if ( !file.is_open() )
+    {
+    itkExceptionMacro(<< "Failed to open file for writing: "
+                      << this->m_NiftiImage->fname);
+    }
+  for ( const auto & member : members )
+    {
+    file.write(reinterpret_cast< const char * >( member.data() ), member.size());
+    }
+  file.close();
+  if ( file.fail() )
+    {
+    itkExceptionMacro(<< "Failed writing image data to file: "
+                      << this->m_NiftiImage->fname);
+    }
+
+  return true;
+}
+
 void NiftiImageIO::Read(void *buffer)
 {
   void *data = nullptr;
@@ -550,12 +973,21 @@ void NiftiImageIO::Read(void *buffer)
   // all data as a block
   if ( i == this->GetNumberOfDimensions() )
     {
-    if ( nifti_image_load(this->m_NiftiImage) == -1 )
+    if ( this->m_UseParallelCompression )
       {
-      itkExceptionMacro( << "nifti_image_load failed for file: "
-                         << this->GetFileName() );
+      // inflates the members of a block-indexed gzip file concurrently;
+      // returns nullptr when the file is not laid out that way
+      data = this->TryParallelCompressedLoad();
+      }
+    if ( data == nullptr )
+      {
+      if ( nifti_image_load(this->m_NiftiImage) == -1 )
+        {
+        itkExceptionMacro( << "nifti_image_load failed for file: "
+                           << this->GetFileName() );
+        }
+      data = this->m_NiftiImage->data;
       }
-    data = this->m_NiftiImage->data;
     }
   else
     {
@@ -807,6 +1239,14 @@ NiftiImageIO::DetermineFileType(const char *FileNameToRead)
 // This method will only test if the header looks like an
 // Nifti Header.  Some code is redundant with ReadImageInformation
 // a StateMachine could provide a better implementation
+NiftiImageIO::ArrayOfMagicByteSignaturesType
+NiftiImageIO::GetMagicByteSignatures() const
+{
+  // single-file and header/data-pair NIfTI-1 magic strings; gzipped
+  // files do not match and fall back to the regular probing path
+  return { { 344, std::string( "n+1\0", 4 ) }, { 344, std::string( "ni1\0", 4 ) } };
+}
+
 bool
 NiftiImageIO
 ::CanReadFile(const char *FileNameToRead)
@@ -1972,7 +2412,18 @@ NiftiImageIO
     // Need a const cast here so that we don't have to copy the memory
     // for writing.
     this->m_NiftiImage->data = const_cast< void * >( buffer );
-    nifti_image_write(this->m_NiftiImage);
+    try
+      {
+      if ( !this->m_UseParallelCompression || !this->TryParallelCompressedWrite() )
+        {
+        nifti_image_write(this->m_NiftiImage);
+        }
+      }
+    catch ( ... )
+      {
+      this->m_NiftiImage->data = nullptr;
+      throw;
+      }
     this->m_NiftiImage->data = nullptr; // if left pointing to data buffer
     // nifti_image_free will try and free this memory
     }
@@ -2057,7 +2508,19 @@ NiftiImageIO
     //Need a const cast here so that we don't have to copy the memory for
     //writing.
     this->m_NiftiImage->data = static_cast<void *>(nifti_buf);
-    nifti_image_write(this->m_NiftiImage);
+    try
+      {
+      if ( !this->m_UseParallelCompression || !this->TryParallelCompressedWrite() )
+        {
+        nifti_image_write(this->m_NiftiImage);
+        }
+      }
+    catch ( ... )
+      {
+      this->m_NiftiImage->data = nullptr;
+      delete[] nifti_buf;
+      throw;
+      }
     this->m_NiftiImage->data = nullptr; // if left pointing to data buffer
     delete[] nifti_buf;
     }
@@ -61,12 +61,24 @@ public:
    * file specified. */
   bool CanReadFile(const char *) override;
 
+  /** The byte signature identifying this file format. */
+  ArrayOfMagicByteSignaturesType GetMagicByteSignatures() const override;
+
   /** Set the spacing and dimension information for the set filename. */
   void ReadImageInformation() override;
 
   /** Reads the data from disk into the memory buffer provided. */
   void Read(void *buffer) override;
 
+  /** Determine if the pixel payload can be memory mapped: the encoding
+   * must be raw, in native byte order, with the data in a single file
+   * (either an attached .nrrd or one detached data file). */
+  bool CanReadMemoryMapped() override;
+
+  /** Map the pixel payload of the current file as a private
+   * copy-on-write view; see ImageIOBase::ReadMemoryMapped. */
+  void * ReadMemoryMapped( ImageAllocatorBase::Pointer & allocator ) override;
+
   /** Determine the file type. Returns true if this ImageIO can write the
    * file specified. */
   bool CanWriteFile(const char *) override;
@@ -88,6 +100,13 @@ protected:
   int ITKToNrrdComponentType(const ImageIOBase::IOComponentType) const;
 
   ImageIOBase::IOComponentType NrrdToITKComponentType(const int) const;
+
+private:
+  /** Resolve the file holding the raw pixel payload and the byte
+   * offset of the payload within it, by re-reading the header. Returns
+   * false when the payload is not a contiguous native-order region of
+   * a single file. */
+  bool GetPixelPayloadLocation(std::string & dataFileName, SizeValueType & offset);
 };
 } // end namespace itk
 
@@ -18,6 +18,9 @@
 
 #include "itkNrrdImageIO.h"
 #include "NrrdIO.h"
+#include "itkMemoryMappedFileAllocator.h"
+#include "itksys/SystemTools.hxx"
+#include <fstream>
 
 #include "itkMetaDataObject.h"
 #include "itkIOCommon.h"
@@ -158,6 +161,12 @@ NrrdImageIO::ITKToNrrdComponentType(const ImageIOBase::IOComponentType itkCompon
   return nrrdTypeUnknown;
 }
 
+NrrdImageIO::ArrayOfMagicByteSignaturesType
+NrrdImageIO::GetMagicByteSignatures() const
+{
+  return { { 0, "NRRD" } };
+}
+
 bool NrrdImageIO::CanReadFile(const char *filename)
 {
   // Check the extension first to avoid opening files that do not
@@ -687,6 +696,105 @@ void NrrdImageIO::ReadImageInformation()
     }
 }
 
+bool
+NrrdImageIO::GetPixelPayloadLocation(std::string & dataFileName, SizeValueType & offset)
+{
+  Nrrd *       nrrd = nrrdNew();
+  NrrdIoState *nio = nrrdIoStateNew();
+
+  // read just the header, as in ReadImageInformation
+  nrrdIoStateSet(nio, nrrdIoStateSkipData, 1);
+  if ( nrrdLoad(nrrd, this->GetFileName(), nio) != 0 )
+    {
+    char *err = biffGetDone(NRRD);
+    free( err );
+    nrrdIoStateNix(nio);
+    nrrdNuke(nrrd);
+    return false;
+    }
+
+  bool mappable = ( nio->encoding == nrrdEncodingRaw );
+
+  // Byte swapping cannot be done in place on a mapping shared with the
+  // page cache.
+  if ( this->GetComponentSize() > 1 && nio->endian != airMyEndian() )
+    {
+    mappable = false;
+    }
+
+  // The payload must live in a single file: either attached to the
+  // header, or one detached data file.
+  if ( nio->dataFNArr->len > 1 || nio->dataFNFormat != nullptr )
+    {
+    mappable = false;
+    }
+
+  if ( mappable )
+    {
+    if ( nio->dataFNArr->len == 1 )
+      {
+      // a detached data file is relative to the header directory
+      const std::string headerDir = itksys::SystemTools::GetFilenamePath( this->GetFileName() );
+      dataFileName = itksys::SystemTools::CollapseFullPath( nio->dataFN[0], headerDir );
+      }
+    else
+      {
+      dataFileName = this->GetFileName();
+      }
+    }
+
+  nrrdIoStateNix(nio);
+  nrrdNuke(nrrd);
+
+  if ( !mappable )
+    {
+    return false;
+    }
+
+  // For raw encoding the payload runs to the end of the data file, so
+  // its offset is independent of any line or byte skips.
+  std::ifstream dataFile( dataFileName.c_str(), std::ios::in | std::ios::binary | std::ios::ate );
+  if ( !dataFile )
+    {
+    return false;
+    }
+  const auto fileLength = static_cast< SizeValueType >( dataFile.tellg() );
+  const auto payloadLength = static_cast< SizeValueType >( this->GetImageSizeInBytes() );
+  if ( fileLength < payloadLength )
+    {
+    return false;
+    }
+  offset = fileLength - payloadLength;
+  return true;
+}
+
+bool
+NrrdImageIO::CanReadMemoryMapped()
+{
+  std::string   dataFileName;
+  SizeValueType offset = 0;
+  return this->GetPixelPayloadLocation(dataFileName, offset);
+}
+
+void *
+NrrdImageIO::ReadMemoryMapped( ImageAllocatorBase::Pointer & allocator )
+{
+  std::string   dataFileName;
+  SizeValueType offset = 0;
+  if ( !this->GetPixelPayloadLocation(dataFileName, offset) )
+    {
+    return nullptr;
+    }
+  MemoryMappedFileAllocator::Pointer mappingAllocator = MemoryMappedFileAllocator::New();
+  void *buffer = mappingAllocator->MapFileRegion(
+    dataFileName, offset, static_cast< SizeValueType >( this->GetImageSizeInBytes() ) );
+  if ( buffer != nullptr )
+    {
+    allocator = mappingAllocator;
+    }
+  return buffer;
+}
+
 void NrrdImageIO::Read(void *buffer)
 {
   Nrrd *       nrrd = nrrdNew();
@@ -75,6 +75,12 @@ public:
   FILE *m_FilePointer;
 };
 
+PNGImageIO::ArrayOfMagicByteSignaturesType
+PNGImageIO::GetMagicByteSignatures() const
+{
+  return { { 0, std::string( "\x89PNG\r\n\x1a\n", 8 ) } };
+}
+
 bool PNGImageIO::CanReadFile(const char *file)
 {
   // First check the filename
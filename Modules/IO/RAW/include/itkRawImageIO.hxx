@@ -128,12 +128,14 @@ void RawImageIO< TPixel, VImageDimension >
 
   if ( m_FileType == Binary )
     {
-    if ( !this->ReadBufferAsBinary(file, buffer, numberOfBytesToBeRead) )
+    // the payload is one contiguous block, so slices of it can be
+    // read concurrently on private streams
+    if ( !this->ReadBufferAsBinaryParallel(m_FileName, streamStart,
+                                           buffer, numberOfBytesToBeRead) )
       {
       itkExceptionMacro(<< "Read failed: Wanted "
                         << numberOfBytesToBeRead
-                        << " bytes, but read "
-                        << file.gcount() << " bytes.");
+                        << " bytes, but could not read them.");
       }
     }
   else
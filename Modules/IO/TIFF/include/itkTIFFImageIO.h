@@ -65,9 +65,28 @@ public:
    * file specified. */
   bool CanReadFile(const char *) override;
 
+  /** The byte signature identifying this file format. */
+  ArrayOfMagicByteSignaturesType GetMagicByteSignatures() const override;
+
   /** Set the spacing and dimension information for the set filename. */
   void ReadImageInformation() override;
 
+  /** Determine if the file can be read in sub-regions. This is the case
+   * for tiled TIFF files that are decoded natively; only the tiles
+   * intersecting the IORegion are then decompressed. */
+  bool CanStreamRead() override;
+
+  /** Returns the requested region expanded to the enclosing native tile
+   * boundaries, so stream divisions fall on the tile grid and every
+   * intersecting tile is decompressed exactly once. */
+  ImageIORegion GenerateStreamableReadRegionFromRequestedRegion(const ImageIORegion & requested) const override;
+
+  /** The dimensions of the native tile grid of the open file, 0 when
+   * the file is not organized in tiles. Stream divisions aligned with
+   * these avoid decoding tiles more than once. */
+  unsigned int GetTileWidth() const;
+  unsigned int GetTileHeight() const;
+
   /** Reads the data from disk into the memory buffer provided. */
   void Read(void *buffer) override;
 
@@ -189,6 +208,17 @@ private:
                         unsigned int width,
                         unsigned int height);
 
+  /** Decode the part of the current page selected by the IORegion from
+   * the native tiles intersecting it. */
+  void ReadTiledRegion(void *out, size_t pixelOffset);
+
+  template <typename TComponent>
+  void ReadTiles(void *out,
+                 unsigned int startX,
+                 unsigned int startY,
+                 unsigned int sizeX,
+                 unsigned int sizeY);
+
   template <typename TComponent>
     void RGBAImageToBuffer( void *out, const uint32_t *tempImage );
 
@@ -20,12 +20,25 @@
 #include "itkTIFFReaderInternal.h"
 #include "itksys/SystemTools.hxx"
 #include "itkMetaDataObject.h"
+#include "itkThreadPool.h"
 
 #include "itk_tiff.h"
 
+#include <algorithm>
+#include <exception>
+#include <future>
+#include <vector>
+
 namespace itk
 {
 
+TIFFImageIO::ArrayOfMagicByteSignaturesType
+TIFFImageIO::GetMagicByteSignatures() const
+{
+  // little endian and big endian TIFF headers
+  return { { 0, std::string( "II*\0", 4 ) }, { 0, std::string( "MM\0*", 4 ) } };
+}
+
 bool TIFFImageIO::CanReadFile(const char *file)
 {
   // First check the filename
@@ -180,6 +193,64 @@ void TIFFImageIO::ReadVolume(void *buffer)
     }
 }
 
+bool TIFFImageIO::CanStreamRead()
+{
+  // Sub-region reads are only implemented for the native tiled code
+  // path; multi-page files are always read as a whole volume.
+  return m_InternalImage->m_NumberOfTiles > 0
+         && m_InternalImage->CanRead()
+         && this->GetNumberOfDimensions() == 2;
+}
+
+ImageIORegion
+TIFFImageIO::GenerateStreamableReadRegionFromRequestedRegion(const ImageIORegion & requested) const
+{
+  if ( m_InternalImage->m_NumberOfTiles == 0
+       || !m_InternalImage->CanRead()
+       || m_NumberOfDimensions != 2 )
+    {
+    return Superclass::GenerateStreamableReadRegionFromRequestedRegion(requested);
+    }
+
+  // Expand the requested region to the enclosing tile boundaries, so
+  // stream divisions fall on the native tile grid and every
+  // intersecting tile is decompressed exactly once.
+  const SizeValueType tileDims[2] = { m_InternalImage->m_TileWidth,
+                                      m_InternalImage->m_TileHeight };
+
+  ImageIORegion streamableRegion(2);
+  for ( unsigned int i = 0; i < 2; i++ )
+    {
+    SizeValueType idx = 0;
+    SizeValueType size = m_Dimensions[i];
+    if ( requested.GetImageDimension() > i )
+      {
+      idx = static_cast< SizeValueType >( requested.GetIndex(i) );
+      size = requested.GetSize(i);
+      }
+    const SizeValueType begin = ( idx / tileDims[i] ) * tileDims[i];
+    SizeValueType end = ( ( idx + size + tileDims[i] - 1 ) / tileDims[i] ) * tileDims[i];
+    if ( end > m_Dimensions[i] )
+      {
+      end = m_Dimensions[i];
+      }
+    streamableRegion.SetIndex( i, static_cast< ImageIORegion::IndexValueType >( begin ) );
+    streamableRegion.SetSize( i, end - begin );
+    }
+
+  return streamableRegion;
+}
+
+unsigned int TIFFImageIO::GetTileWidth() const
+{
+  return m_InternalImage->m_TileWidth;
+}
+
+unsigned int TIFFImageIO::GetTileHeight() const
+{
+  return m_InternalImage->m_TileHeight;
+}
+
 void TIFFImageIO::Read(void *buffer)
 {
 
@@ -1182,6 +1253,11 @@ void TIFFImageIO::ReadCurrentPage(void *buffer, size_t pixelOffset)
 
     this->InitializeColors();
 
+    if ( m_InternalImage->m_NumberOfTiles > 0 )
+      {
+      this->ReadTiledRegion(buffer, pixelOffset);
+      return;
+      }
 
     if ( m_ComponentType == USHORT )
       {
@@ -1217,6 +1293,177 @@ void TIFFImageIO::ReadCurrentPage(void *buffer, size_t pixelOffset)
 
 }
 
+void TIFFImageIO::ReadTiledRegion(void *buffer, size_t pixelOffset)
+{
+  // determine the part of the current page to decode; the output
+  // buffer is laid out for exactly this region
+  unsigned int startX = 0;
+  unsigned int startY = 0;
+  auto sizeX = static_cast< unsigned int >( m_InternalImage->m_Width );
+  auto sizeY = static_cast< unsigned int >( m_InternalImage->m_Height );
+
+  const ImageIORegion & ioRegion = this->GetIORegion();
+  if ( ioRegion.GetImageDimension() >= 2 && ioRegion.GetNumberOfPixels() > 0 )
+    {
+    startX = static_cast< unsigned int >( ioRegion.GetIndex(0) );
+    sizeX = static_cast< unsigned int >( ioRegion.GetSize(0) );
+    startY = static_cast< unsigned int >( ioRegion.GetIndex(1) );
+    sizeY = static_cast< unsigned int >( ioRegion.GetSize(1) );
+    }
+
+  if ( m_ComponentType == USHORT )
+    {
+    this->ReadTiles< unsigned short >(reinterpret_cast< unsigned short * >( buffer ) + pixelOffset,
+                                      startX, startY, sizeX, sizeY);
+    }
+  else if ( m_ComponentType == SHORT )
+    {
+    this->ReadTiles< short >(reinterpret_cast< short * >( buffer ) + pixelOffset,
+                             startX, startY, sizeX, sizeY);
+    }
+  else if ( m_ComponentType == CHAR )
+    {
+    this->ReadTiles< char >(reinterpret_cast< char * >( buffer ) + pixelOffset,
+                            startX, startY, sizeX, sizeY);
+    }
+  else if ( m_ComponentType == FLOAT )
+    {
+    this->ReadTiles< float >(reinterpret_cast< float * >( buffer ) + pixelOffset,
+                             startX, startY, sizeX, sizeY);
+    }
+  else
+    {
+    this->ReadTiles< unsigned char >(reinterpret_cast< unsigned char * >( buffer ) + pixelOffset,
+                                     startX, startY, sizeX, sizeY);
+    }
+}
+
+template <typename TComponent>
+void TIFFImageIO::ReadTiles(void *_out,
+                            unsigned int startX,
+                            unsigned int startY,
+                            unsigned int sizeX,
+                            unsigned int sizeY)
+{
+  using ComponentType = TComponent;
+
+  if ( m_InternalImage->m_PlanarConfig != PLANARCONFIG_CONTIG
+    && m_InternalImage->m_SamplesPerPixel != 1 )
+    {
+    itkExceptionMacro(<< "This reader can only do PLANARCONFIG_CONTIG or single-component PLANARCONFIG_SEPARATE");
+    }
+
+  const unsigned int tileWidth = m_InternalImage->m_TileWidth;
+  const unsigned int tileHeight = m_InternalImage->m_TileHeight;
+  const size_t       inc = this->GetNumberOfComponents();
+
+  const unsigned int firstTileRow = startY / tileHeight;
+  const unsigned int lastTileRow = ( startY + sizeY - 1 ) / tileHeight;
+  const unsigned int firstTileCol = startX / tileWidth;
+  const unsigned int lastTileCol = ( startX + sizeX - 1 ) / tileWidth;
+
+  const std::string fileName = m_FileName;
+  const tdir_t      directory = TIFFCurrentDirectory(m_InternalImage->m_Image);
+  auto * out = static_cast< ComponentType * >( _out );
+
+  // Decode one row of tiles per task. Every task opens a private TIFF
+  // handle, since libtiff handles cannot be shared between threads,
+  // and writes to a disjoint set of output rows.
+  auto decodeTileRow = [=]( unsigned int tileRow )
+    {
+    TIFF *tif = TIFFOpen( fileName.c_str(), "r" );
+    if ( tif == nullptr || !TIFFSetDirectory(tif, directory) )
+      {
+      if ( tif )
+        {
+        TIFFClose(tif);
+        }
+      itkGenericExceptionMacro(<< "Cannot re-open file for tiled reading: " << fileName);
+      }
+    tdata_t buf = _TIFFmalloc( TIFFTileSize(tif) );
+
+    const unsigned int tileY0 = tileRow * tileHeight;
+    const unsigned int rowBegin = std::max(startY, tileY0);
+    const unsigned int rowEnd = std::min(startY + sizeY, tileY0 + tileHeight);
+
+    for ( unsigned int tileCol = firstTileCol; tileCol <= lastTileCol; ++tileCol )
+      {
+      const unsigned int tileX0 = tileCol * tileWidth;
+      if ( TIFFReadTile(tif, buf, tileX0, tileY0, 0, 0) < 0 )
+        {
+        _TIFFfree(buf);
+        TIFFClose(tif);
+        itkGenericExceptionMacro(<< "Problem reading tile at: " << tileX0 << " " << tileY0);
+        }
+
+      const unsigned int colBegin = std::max(startX, tileX0);
+      const unsigned int colEnd = std::min(startX + sizeX, tileX0 + tileWidth);
+      const size_t       spanLength = static_cast< size_t >( colEnd - colBegin ) * inc;
+
+      for ( unsigned int row = rowBegin; row < rowEnd; ++row )
+        {
+        const ComponentType *src = static_cast< const ComponentType * >( buf )
+          + ( static_cast< size_t >( row - tileY0 ) * tileWidth + ( colBegin - tileX0 ) ) * inc;
+        ComponentType *dst = out
+          + ( static_cast< size_t >( row - startY ) * sizeX + ( colBegin - startX ) ) * inc;
+        std::copy(src, src + spanLength, dst);
+        }
+      }
+
+    _TIFFfree(buf);
+    TIFFClose(tif);
+    };
+
+  // decode serially for a single row of tiles, or when already running
+  // on a pool worker
+  if ( firstTileRow == lastTileRow || ThreadPool::IsPoolWorker() )
+    {
+    for ( unsigned int tileRow = firstTileRow; tileRow <= lastTileRow; ++tileRow )
+      {
+      decodeTileRow(tileRow);
+      }
+    return;
+    }
+
+  std::vector< std::future< void > > decoders;
+  decoders.reserve(lastTileRow - firstTileRow);
+  for ( unsigned int tileRow = firstTileRow + 1; tileRow <= lastTileRow; ++tileRow )
+    {
+    decoders.push_back( ThreadPool::GetInstance()->AddWork(decodeTileRow, tileRow) );
+    }
+
+  std::exception_ptr firstError;
+  try
+    {
+    decodeTileRow(firstTileRow);
+    }
+  catch ( ... )
+    {
+    firstError = std::current_exception();
+    }
+
+  // join every decoder before propagating an error, they write into
+  // the caller's buffer
+  for ( auto & decoder : decoders )
+    {
+    try
+      {
+      decoder.get();
+      }
+    catch ( ... )
+      {
+      if ( !firstError )
+        {
+        firstError = std::current_exception();
+        }
+      }
+    }
+  if ( firstError )
+    {
+    std::rethrow_exception(firstError);
+    }
+}
+
 template <typename TComponent>
 void TIFFImageIO::ReadGenericImage(void *_out,
                                    unsigned int width,
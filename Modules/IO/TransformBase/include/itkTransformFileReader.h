@@ -83,6 +83,18 @@ public:
   itkSetObjectMacro( TransformIO, TransformIOType );
   itkGetConstObjectMacro( TransformIO, TransformIOType );
 
+  /** Set/Get whether the variable transform parameters are loaded
+   * lazily. The request is forwarded to the transform IO before
+   * reading; IOs that support it (e.g. HDF5TransformIOTemplate) leave
+   * the potentially huge parameter arrays on disk, so the transforms on
+   * the output list carry empty parameter arrays until the IO
+   * materializes them fully or in ranges. Kernel transforms are then
+   * not initialized by Update(); call ComputeWMatrix() once their
+   * parameters have been loaded. */
+  itkSetMacro( DeferParameterLoading, bool );
+  itkGetConstMacro( DeferParameterLoading, bool );
+  itkBooleanMacro( DeferParameterLoading );
+
 protected:
   void PrintSelf(std::ostream & os, Indent indent) const override;
 
@@ -92,6 +104,7 @@ protected:
   TransformListType                 m_TransformList;
   typename TransformIOType::Pointer m_TransformIO;
   std::string                       m_FileName;
+  bool                              m_DeferParameterLoading;
 };
 
 /** This helps to meet backward compatibility */
@@ -72,7 +72,8 @@ struct KernelTransformHelper<TParameterType, 0>
 template<typename TParametersValueType>
 TransformFileReaderTemplate<TParametersValueType>
 ::TransformFileReaderTemplate() :
-  m_FileName("") /* to be removed soon. See .h */
+  m_FileName(""), /* to be removed soon. See .h */
+  m_DeferParameterLoading(false)
 {
 }
 
@@ -135,6 +136,7 @@ void TransformFileReaderTemplate<TParametersValueType>
   ioTransformList.clear();
 
   m_TransformIO->SetFileName(m_FileName);
+  m_TransformIO->SetDeferParameterLoading(m_DeferParameterLoading);
   m_TransformIO->Read();
 
   if (ioTransformList.empty())
@@ -151,9 +153,12 @@ void TransformFileReaderTemplate<TParametersValueType>
   // need to be initialized using the transform parameters.
   // kernelTransform->ComputeWMatrix() has to be called after the transform is read but
   // before the transform is used.
+  // A deferred read leaves the parameters empty; the W matrix can only
+  // be computed once they have been materialized.
   std::string transformTypeName = ioTransformList.front()->GetNameOfClass();
   const size_t len = strlen("KernelTransform");// Computed at compile time in most cases
-  if (transformTypeName.size() >= len
+  if (!m_DeferParameterLoading
+      && transformTypeName.size() >= len
       && !transformTypeName.compare(transformTypeName.size()-len , len, "KernelTransform"))
     {
     if( KernelTransformHelper<TParametersValueType,
@@ -202,6 +207,8 @@ void TransformFileReaderTemplate<TParametersValueType>
   Superclass::PrintSelf(os, indent);
 
   os << indent << "FileName: " << m_FileName << std::endl;
+  os << indent << "DeferParameterLoading: "
+     << ( m_DeferParameterLoading ? "true" : "false" ) << std::endl;
 }
 
 } // namespace itk
@@ -116,6 +116,15 @@ public:
   itkGetConstMacro(UseCompression, bool);
   itkBooleanMacro(UseCompression);
 
+  /** Set/Get whether Read() may leave the variable parameter arrays on
+   * disk, reading only the transform types and fixed parameters
+   * eagerly. Derived IO classes that cannot defer loading ignore the
+   * request and read the parameters as usual; see
+   * HDF5TransformIOTemplate for one that honors it. */
+  itkSetMacro(DeferParameterLoading, bool);
+  itkGetConstMacro(DeferParameterLoading, bool);
+  itkBooleanMacro(DeferParameterLoading);
+
   /** The transform type has a string representation used when reading
    * and writing transform files.  In the case where a double-precision
    * transform is to be written as float, or vice versa, the transform
@@ -144,6 +153,8 @@ protected:
   bool                   m_AppendMode{false};
   /** Should we compress the data? */
   bool                   m_UseCompression{false};
+  /** Should Read() leave the variable parameters on disk? */
+  bool                   m_DeferParameterLoading{false};
 
   /* The following struct returns the string name of computation type */
   /* default implementation */
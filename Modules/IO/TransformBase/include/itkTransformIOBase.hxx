@@ -109,6 +109,8 @@ Superclass::PrintSelf(os, indent);
 os << indent << "FileName: " << m_FileName << std::endl;
 os << indent << "AppendMode: "
 << ( m_AppendMode ? "true" : "false" ) << std::endl;
+os << indent << "DeferParameterLoading: "
+<< ( m_DeferParameterLoading ? "true" : "false" ) << std::endl;
 if ( m_ReadTransformList.size() > 0 )
   {
   os << indent << "ReadTransformList: " << std::endl;
@@ -23,6 +23,7 @@
 #include "itkTransformIOBase.h"
 #include <memory>
 #include <string>
+#include <vector>
 #include "itk_H5Cpp.h"
 
 // Avoids KWStyle error from forward declaration below.
@@ -122,6 +123,29 @@ public:
    * pointer to the beginning of the image data. */
   void Write() override;
 
+  /** When DeferParameterLoading is enabled, Read() loads the transform
+   * types and fixed parameters only and keeps the file open: each
+   * variable parameter array stays on disk, described by one entry per
+   * transform in read order. This returns the length of the deferred
+   * array of the indexed transform; composite transforms store no
+   * parameters of their own and report zero. */
+  SizeValueType GetDeferredParameterSize(unsigned int transformIndex) const;
+
+  /** Read \a count values starting at \a start from the deferred
+   * parameter array of the indexed transform into \a buffer, using an
+   * HDF5 hyperslab selection so only the requested range is touched.
+   * A viewer materializes a sub-region or time slice of a displacement
+   * field transform by mapping the region to ranges of the flat
+   * parameter array (via the fixed parameters) and reading each range. */
+  void ReadDeferredParameters(unsigned int transformIndex,
+                              SizeValueType start,
+                              SizeValueType count,
+                              ParametersValueType *buffer) const;
+
+  /** Materialize the complete parameter array of the indexed transform
+   * and pass it to the transform, as an eager Read() would have. */
+  void LoadDeferredParameters(unsigned int transformIndex);
+
 protected:
   HDF5TransformIOTemplate();
   ~HDF5TransformIOTemplate() override;
@@ -143,8 +167,20 @@ private:
   void WriteOneTransform(const int transformIndex,
                          const TransformType *transform);
 
+  /** Bookkeeping for a parameter array left on disk by a deferred
+   * Read(). Composite transforms get a placeholder entry so the
+   * indices stay aligned with the read transform list. */
+  struct DeferredParameterSet
+  {
+    std::string DataSetName;
+    SizeValueType NumberOfParameters{0};
+    TransformPointer Transform;
+  };
+
   std::unique_ptr<H5::H5File> m_H5File;
 
+  std::vector<DeferredParameterSet> m_DeferredParameterSets;
+
   /** Utility function for infering data storage type
    * from class template.
    * @return H5 code PredType
@@ -294,6 +294,85 @@ HDF5TransformIOTemplate<TParametersValueType>
   return FixedParameterArray;
   }
 
+template<typename TParametersValueType>
+SizeValueType
+HDF5TransformIOTemplate<TParametersValueType>
+::GetDeferredParameterSize(unsigned int transformIndex) const
+{
+  if(transformIndex >= this->m_DeferredParameterSets.size())
+    {
+    itkExceptionMacro(<< "No deferred parameters for transform index "
+                      << transformIndex
+                      << ". Was DeferParameterLoading enabled before Read()?");
+    }
+  return this->m_DeferredParameterSets[transformIndex].NumberOfParameters;
+}
+
+template<typename TParametersValueType>
+void
+HDF5TransformIOTemplate<TParametersValueType>
+::ReadDeferredParameters(unsigned int transformIndex,
+                         SizeValueType start,
+                         SizeValueType count,
+                         ParametersValueType *buffer) const
+{
+  if(transformIndex >= this->m_DeferredParameterSets.size())
+    {
+    itkExceptionMacro(<< "No deferred parameters for transform index "
+                      << transformIndex
+                      << ". Was DeferParameterLoading enabled before Read()?");
+    }
+  const DeferredParameterSet &deferred =
+    this->m_DeferredParameterSets[transformIndex];
+  if(start + count > deferred.NumberOfParameters)
+    {
+    itkExceptionMacro(<< "Requested range [" << start << ", " << start + count
+                      << ") exceeds the " << deferred.NumberOfParameters
+                      << " parameters stored for transform index "
+                      << transformIndex);
+    }
+  if(count == 0)
+    {
+    return;
+    }
+  try
+    {
+    H5::DataSet paramSet = this->m_H5File->openDataSet(deferred.DataSetName);
+    H5::DataSpace fileSpace = paramSet.getSpace();
+    const hsize_t h5Start(start);
+    const hsize_t h5Count(count);
+    fileSpace.selectHyperslab(H5S_SELECT_SET,&h5Count,&h5Start);
+    H5::DataSpace memSpace(1,&h5Count);
+    // HDF5 converts the stored precision to the requested memory type
+    paramSet.read(buffer,GetH5TypeFromString(),memSpace,fileSpace);
+    paramSet.close();
+    }
+  catch( H5::Exception & error )
+    {
+    itkExceptionMacro(<< error.getCDetailMsg());
+    }
+}
+
+template<typename TParametersValueType>
+void
+HDF5TransformIOTemplate<TParametersValueType>
+::LoadDeferredParameters(unsigned int transformIndex)
+{
+  const SizeValueType numberOfParameters =
+    this->GetDeferredParameterSize(transformIndex);
+  const DeferredParameterSet &deferred =
+    this->m_DeferredParameterSets[transformIndex];
+  if(deferred.DataSetName.empty())
+    {
+    // composite transforms store no parameters of their own
+    return;
+    }
+  ParametersType params;
+  params.SetSize(numberOfParameters);
+  this->ReadDeferredParameters(transformIndex,0,numberOfParameters,
+                               params.data_block());
+  deferred.Transform->SetParametersByValue(params);
+}
 
 template<typename TParametersValueType>
 void
@@ -339,6 +418,7 @@ HDF5TransformIOTemplate<TParametersValueType>
   // happens in a big try/catch clause
   try
     {
+    this->m_DeferredParameterSets.clear();
     this->m_H5File.reset(new H5::H5File(this->GetFileName(),H5F_ACC_RDONLY));
     // open /TransformGroup
     H5::Group transformGroup = this->m_H5File->openGroup(transformGroupName);
@@ -398,13 +478,43 @@ HDF5TransformIOTemplate<TParametersValueType>
 #endif
           paramsName = transformName + transformParamsNameMisspelled;
         }
-        ParametersType params = this->ReadParameters(paramsName);
-        transform->SetParametersByValue(params);
+        if(this->GetDeferParameterLoading())
+          {
+          // record where the array lives instead of reading it
+          DeferredParameterSet deferred;
+          deferred.DataSetName = paramsName;
+          deferred.Transform = transform;
+          H5::DataSet paramSet = this->m_H5File->openDataSet(paramsName);
+          const H5::DataSpace paramSpace = paramSet.getSpace();
+          hsize_t dim;
+          paramSpace.getSimpleExtentDims(&dim,nullptr);
+          deferred.NumberOfParameters = static_cast<SizeValueType>(dim);
+          paramSet.close();
+          this->m_DeferredParameterSets.push_back(deferred);
+          }
+        else
+          {
+          ParametersType params = this->ReadParameters(paramsName);
+          transform->SetParametersByValue(params);
+          }
+        }
+      else if(this->GetDeferParameterLoading())
+        {
+        // placeholder keeps the entries aligned with the transform list
+        this->m_DeferredParameterSets.push_back(DeferredParameterSet());
         }
       currentTransformGroup.close();
       }
     transformGroup.close();
-    this->m_H5File->close();
+    if(this->GetDeferParameterLoading())
+      {
+      // the deferred arrays are served straight from this file, so it
+      // stays open until the next Read()/Write() or destruction
+      }
+    else
+      {
+      this->m_H5File->close();
+      }
     }
   // catch failure caused by the H5File operations
   catch( H5::Exception & error )
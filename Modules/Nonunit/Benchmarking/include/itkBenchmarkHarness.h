@@ -0,0 +1,155 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkBenchmarkHarness_h
+#define itkBenchmarkHarness_h
+
+#include "itkTimeProbe.h"
+#include "itkIntTypes.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+namespace itk
+{
+/** \class BenchmarkHarness
+ * \brief Times a benchmark kernel repeatedly and reports the results as JSON.
+ *
+ * The harness runs a callable once untimed, to warm object factories,
+ * allocators and the thread pool, and then a configurable number of timed
+ * iterations on a TimeProbe. The report combines the probe statistics with
+ * pixel-throughput figures and the system information collected by
+ * ResourceProbe, so results written by successive builds of the toolkit can
+ * be compared mechanically.
+ *
+ * The expected command line of a benchmark is
+ * \code
+ *   benchmark [reportFile [iterations]]
+ * \endcode
+ * and is decoded by ParseArguments(). When no report file is given the
+ * report goes to standard output.
+ *
+ * \ingroup ITKBenchmarking
+ */
+class BenchmarkHarness
+{
+public:
+  /** The name labels the report; pixelsPerIteration is the number of pixels
+   * one invocation of the kernel produces, used for the throughput figures. */
+  BenchmarkHarness(const std::string & name, const SizeValueType pixelsPerIteration)
+    : m_Name( name ),
+      m_PixelsPerIteration( pixelsPerIteration )
+  {
+    m_Probe.SetNameOfProbe( name.c_str() );
+  }
+
+  /** Set/Get the number of timed iterations. The default of five keeps the
+   * benchmarks cheap enough to run alongside the regression tests. */
+  void SetNumberOfIterations(const unsigned int iterations)
+  {
+    m_NumberOfIterations = iterations;
+  }
+
+  unsigned int GetNumberOfIterations() const
+  {
+    return m_NumberOfIterations;
+  }
+
+  /** Decode the standard benchmark command line: an optional report file
+   * name followed by an optional iteration count. */
+  void ParseArguments(int argc, char *argv[])
+  {
+    if ( argc > 1 )
+      {
+      m_ReportFileName = argv[1];
+      }
+    if ( argc > 2 )
+      {
+      m_NumberOfIterations = static_cast< unsigned int >( std::atoi( argv[2] ) );
+      }
+  }
+
+  /** Run the kernel once untimed and then NumberOfIterations times on the
+   * probe. The kernel must perform the full workload on each call; filters
+   * should therefore be constructed inside the kernel, or marked modified,
+   * so the pipeline cannot satisfy an iteration from its cached output. */
+  template< typename TKernel >
+  void Run(TKernel && kernel)
+  {
+    kernel();
+    for ( unsigned int i = 0; i < m_NumberOfIterations; ++i )
+      {
+      m_Probe.Start();
+      kernel();
+      m_Probe.Stop();
+      }
+  }
+
+  /** Write the JSON report to the given stream. */
+  void WriteReport(std::ostream & os)
+  {
+    const double mean = static_cast< double >( m_Probe.GetMean() );
+    const double minimum = static_cast< double >( m_Probe.GetMinimum() );
+    const double megaPixels = static_cast< double >( m_PixelsPerIteration ) / 1.0e6;
+
+    os << "{\n";
+    os << "  \"Name\": \"" << m_Name << "\",\n";
+    os << "  \"PixelsPerIteration\": " << m_PixelsPerIteration << ",\n";
+    os << "  \"MeanMegaPixelsPerSecond\": "
+       << ( mean > 0.0 ? megaPixels / mean : 0.0 ) << ",\n";
+    os << "  \"PeakMegaPixelsPerSecond\": "
+       << ( minimum > 0.0 ? megaPixels / minimum : 0.0 ) << ",\n";
+    os << "  \"Probe\":\n";
+    m_Probe.JSONReport( os );
+    os << ",\n";
+    os << "  \"SystemInformation\":\n";
+    m_Probe.PrintJSONSystemInformation( os );
+    os << "\n}\n";
+  }
+
+  /** Write the JSON report to the file given on the command line, or to
+   * standard output when none was given. */
+  void WriteReport()
+  {
+    if ( m_ReportFileName.empty() )
+      {
+      this->WriteReport( std::cout );
+      return;
+      }
+    std::ofstream reportFile( m_ReportFileName.c_str() );
+    this->WriteReport( reportFile );
+  }
+
+  /** The report file name given on the command line, possibly empty. Useful
+   * for benchmarks that need scratch files next to the report. */
+  const std::string & GetReportFileName() const
+  {
+    return m_ReportFileName;
+  }
+
+private:
+  std::string   m_Name;
+  std::string   m_ReportFileName;
+  SizeValueType m_PixelsPerIteration;
+  unsigned int  m_NumberOfIterations{ 5 };
+  TimeProbe     m_Probe;
+};
+} // end namespace itk
+
+#endif
@@ -0,0 +1,19 @@
+set(DOCUMENTATION "This module contains performance benchmarks for the hot
+filters of the toolkit. Each benchmark times a fixed workload with itkTimeProbe
+and writes a machine-readable JSON report with pixel-throughput figures and
+system information, so timings can be compared across commits.")
+
+itk_module(ITKBenchmarking
+  DEPENDS
+    ITKCommon
+  TEST_DEPENDS
+    ITKTestKernel
+    ITKImageGrid
+    ITKSmoothing
+    ITKConnectedComponents
+    ITKMetricsv4
+    ITKIOImageBase
+    ITKIOMeta
+  DESCRIPTION
+    "${DOCUMENTATION}"
+)
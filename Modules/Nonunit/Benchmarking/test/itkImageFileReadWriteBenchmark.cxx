@@ -0,0 +1,72 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkBenchmarkHarness.h"
+#include "itkImage.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkImageFileReader.h"
+#include "itkImageFileWriter.h"
+
+/** Times a write/read round trip of a 3D float volume through the
+ * MetaImage format, covering the IO factory, buffer conversion and file
+ * streaming paths. The scratch file is placed next to the report. */
+int itkImageFileReadWriteBenchmark( int argc, char *argv[] )
+{
+  constexpr unsigned int Dimension = 3;
+  using PixelType = float;
+  using ImageType = itk::Image< PixelType, Dimension >;
+
+  ImageType::SizeType size;
+  size.Fill( 128 );
+
+  ImageType::Pointer input = ImageType::New();
+  input->SetRegions( size );
+  input->Allocate();
+
+  itk::ImageRegionIteratorWithIndex< ImageType > it( input, input->GetBufferedRegion() );
+  for ( it.GoToBegin(); !it.IsAtEnd(); ++it )
+    {
+    const ImageType::IndexType & index = it.GetIndex();
+    it.Set( static_cast< PixelType >( index[0] * index[1] + index[2] ) );
+    }
+
+  itk::BenchmarkHarness harness( "ImageFileReadWrite_MetaImage_float_128x128x128",
+                                 size[0] * size[1] * size[2] );
+  harness.ParseArguments( argc, argv );
+
+  const std::string imageFileName = harness.GetReportFileName().empty() ?
+    std::string( "itkImageFileReadWriteBenchmark.mha" ) :
+    harness.GetReportFileName() + ".mha";
+
+  harness.Run( [&input, &imageFileName]()
+    {
+    using WriterType = itk::ImageFileWriter< ImageType >;
+    WriterType::Pointer writer = WriterType::New();
+    writer->SetInput( input );
+    writer->SetFileName( imageFileName );
+    writer->Update();
+
+    using ReaderType = itk::ImageFileReader< ImageType >;
+    ReaderType::Pointer reader = ReaderType::New();
+    reader->SetFileName( imageFileName );
+    reader->Update();
+    } );
+
+  harness.WriteReport();
+  return EXIT_SUCCESS;
+}
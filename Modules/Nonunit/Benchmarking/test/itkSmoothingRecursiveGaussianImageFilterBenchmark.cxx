@@ -0,0 +1,62 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkBenchmarkHarness.h"
+#include "itkImage.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkSmoothingRecursiveGaussianImageFilter.h"
+
+/** Times recursive Gaussian smoothing of a 3D float volume, a fixture of
+ * multi-resolution pyramids and feature extraction pipelines. */
+int itkSmoothingRecursiveGaussianImageFilterBenchmark( int argc, char *argv[] )
+{
+  constexpr unsigned int Dimension = 3;
+  using PixelType = float;
+  using ImageType = itk::Image< PixelType, Dimension >;
+
+  ImageType::SizeType size;
+  size.Fill( 128 );
+
+  ImageType::Pointer input = ImageType::New();
+  input->SetRegions( size );
+  input->Allocate();
+
+  itk::ImageRegionIteratorWithIndex< ImageType > it( input, input->GetBufferedRegion() );
+  for ( it.GoToBegin(); !it.IsAtEnd(); ++it )
+    {
+    const ImageType::IndexType & index = it.GetIndex();
+    // Checkerboard blocks give the smoother sharp edges to work on.
+    it.Set( static_cast< PixelType >( ( ( index[0] / 8 + index[1] / 8 + index[2] / 8 ) % 2 ) * 100 ) );
+    }
+
+  itk::BenchmarkHarness harness( "SmoothingRecursiveGaussianImageFilter_float_128x128x128",
+                                 size[0] * size[1] * size[2] );
+  harness.ParseArguments( argc, argv );
+
+  harness.Run( [&input]()
+    {
+    using FilterType = itk::SmoothingRecursiveGaussianImageFilter< ImageType, ImageType >;
+    FilterType::Pointer filter = FilterType::New();
+    filter->SetInput( input );
+    filter->SetSigma( 2.0 );
+    filter->Update();
+    } );
+
+  harness.WriteReport();
+  return EXIT_SUCCESS;
+}
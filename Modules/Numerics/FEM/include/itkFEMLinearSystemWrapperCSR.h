@@ -0,0 +1,238 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#ifndef itkFEMLinearSystemWrapperCSR_h
+#define itkFEMLinearSystemWrapperCSR_h
+
+#include "itkFEMLinearSystemWrapper.h"
+#include "vnl/vnl_vector.h"
+#include "ITKFEMExport.h"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace itk
+{
+namespace fem
+{
+/**
+ * \class LinearSystemWrapperCSR
+ * \brief LinearSystemWrapper class that stores matrices in compressed
+ *        sparse row format and solves with a preconditioned conjugate
+ *        gradient method.
+ *
+ * The wrapper is built for large systems assembled element by element.
+ * AddMatrixValue() appends the contribution to a coordinate buffer in
+ * constant time instead of searching the sparse structure, so the
+ * assembly cost is proportional to the number of element matrix entries.
+ * The buffered entries are sorted in parallel chunks, merged and
+ * compressed into the CSR arrays the first time the matrix is read,
+ * modified in place or used in a product.
+ *
+ * The system is solved with the conjugate gradient method using a Jacobi
+ * (diagonal) preconditioner; the matrix-vector products are distributed
+ * over the available work units.  The method expects the symmetric
+ * positive definite systems produced by the Solver class.  The stopping
+ * criterion is a relative residual below the given tolerance or the
+ * maximum number of iterations, whichever comes first.
+ *
+ * \sa LinearSystemWrapper
+ * \sa LinearSystemWrapperVNL
+ * \ingroup ITKFEM
+ */
+class ITKFEM_EXPORT LinearSystemWrapperCSR : public LinearSystemWrapper
+{
+public:
+
+  /* values stored in matrices & vectors */
+  using Float = LinearSystemWrapper::Float;
+
+  /* superclass */
+  using Superclass = LinearSystemWrapper;
+
+  /* constructor & destructor */
+  LinearSystemWrapperCSR() : LinearSystemWrapper()
+  {
+  }
+  ~LinearSystemWrapperCSR() override;
+
+  /** Set the relative residual at which the conjugate gradient
+   * iteration is considered converged.  Default is 1e-6. */
+  void SetTolerance(Float tolerance)
+  {
+    m_Tolerance = tolerance;
+  }
+
+  /** Get the relative residual tolerance of the solver. */
+  Float GetTolerance() const
+  {
+    return m_Tolerance;
+  }
+
+  /** Set the maximum number of conjugate gradient iterations.  The
+   * default value 0 stands for twice the system order. */
+  void SetMaximumNumberOfIterations(unsigned int maximumNumberOfIterations)
+  {
+    m_MaximumNumberOfIterations = maximumNumberOfIterations;
+  }
+
+  /** Get the maximum number of conjugate gradient iterations. */
+  unsigned int GetMaximumNumberOfIterations() const
+  {
+    return m_MaximumNumberOfIterations;
+  }
+
+  /** Get the number of iterations used by the last Solve() call. */
+  unsigned int GetNumberOfIterations() const
+  {
+    return m_NumberOfIterations;
+  }
+
+  /* memory management routines */
+  void  InitializeMatrix(unsigned int matrixIndex) override;
+
+  bool  IsMatrixInitialized(unsigned int matrixIndex) override;
+
+  void  DestroyMatrix(unsigned int matrixIndex) override;
+
+  void  InitializeVector(unsigned int vectorIndex) override;
+
+  bool  IsVectorInitialized(unsigned int vectorIndex) override;
+
+  void  DestroyVector(unsigned int vectorIndex) override;
+
+  void  InitializeSolution(unsigned int solutionIndex) override;
+
+  bool  IsSolutionInitialized(unsigned int solutionIndex) override;
+
+  void  DestroySolution(unsigned int solutionIndex) override;
+
+  /* assembly & solving routines */
+  Float GetMatrixValue(unsigned int i, unsigned int j, unsigned int matrixIndex) const override;
+
+  void  SetMatrixValue(unsigned int i, unsigned int j, Float value, unsigned int matrixIndex) override;
+
+  void  AddMatrixValue(unsigned int i, unsigned int j, Float value, unsigned int matrixIndex) override;
+
+  void  GetColumnsOfNonZeroMatrixElementsInRow(unsigned int row, ColumnArray & cols,
+                                               unsigned int matrixIndex) override;
+
+  Float GetVectorValue(unsigned int i, unsigned int vectorIndex) const override
+  {
+    return ( *( m_Vectors[vectorIndex] ) )[i];
+  }
+  void  SetVectorValue(unsigned int i, Float value, unsigned int vectorIndex) override
+  {
+    ( *( m_Vectors[vectorIndex] ) )(i) =  value;
+  }
+  void  AddVectorValue(unsigned int i, Float value, unsigned int vectorIndex) override
+  {
+    ( *( m_Vectors[vectorIndex] ) )(i) += value;
+  }
+  Float GetSolutionValue(unsigned int i, unsigned int solutionIndex) const override;
+
+  void  SetSolutionValue(unsigned int i, Float value, unsigned int solutionIndex) override
+  {
+    ( *( m_Solutions[solutionIndex] ) )(i) =  value;
+  }
+  void  AddSolutionValue(unsigned int i, Float value, unsigned int solutionIndex) override
+  {
+    ( *( m_Solutions[solutionIndex] ) )(i) += value;
+  }
+  void  Solve() override;
+
+  /* matrix & vector manipulation routines */
+  void  ScaleMatrix(Float scale, unsigned int matrixIndex) override;
+
+  void  SwapMatrices(unsigned int matrixIndex1, unsigned int matrixIndex2) override;
+
+  void  SwapVectors(unsigned int vectorIndex1, unsigned int vectorIndex2) override;
+
+  void  SwapSolutions(unsigned int solutionIndex1, unsigned int solutionIndex2) override;
+
+  void  CopySolution2Vector(unsigned solutionIndex, unsigned int vectorIndex) override;
+
+  void  CopyVector2Solution(unsigned int vectorIndex, unsigned int solutionIndex) override;
+
+  void  MultiplyMatrixMatrix(unsigned int resultMatrixIndex, unsigned int leftMatrixIndex,
+                             unsigned int rightMatrixIndex) override;
+
+  void  MultiplyMatrixVector(unsigned int resultVectorIndex, unsigned int matrixIndex,
+                             unsigned int vectorIndex) override;
+
+  void  MultiplyMatrixSolution(unsigned int resultVectorIndex, unsigned int matrixIndex,
+                               unsigned int solutionIndex) override;
+
+private:
+
+  /** One matrix of the system.  Assembled contributions wait in the
+   * coordinate buffer until the compressed structure is needed. */
+  struct CSRMatrix
+    {
+    /** Index of the first entry of each row; has order + 1 elements. */
+    std::vector<std::size_t> RowStart;
+
+    /** Column of each entry, sorted within a row. */
+    std::vector<unsigned int> ColumnIndex;
+
+    /** Value of each entry. */
+    std::vector<Float> Value;
+
+    /** Buffered (row, column, value) contributions not yet merged into
+     * the compressed arrays.  Row and column are packed in one key so
+     * the buffer can be sorted with a single comparison. */
+    std::vector<std::pair<std::uint64_t, Float> > Pending;
+    };
+
+  /** Merge the buffered contributions of a matrix into its compressed
+   * arrays.  Called before any operation that needs the structure. */
+  void FinalizeMatrix(unsigned int matrixIndex) const;
+
+  /** Find the position of an entry in the compressed arrays.  Returns
+   * false when the entry is not part of the structure. */
+  bool FindEntry(const CSRMatrix & matrix, unsigned int i, unsigned int j, std::size_t & position) const;
+
+  /** Compute result = matrix * vector with the rows distributed over
+   * the available work units. */
+  void ParallelMultiply(const CSRMatrix & matrix, const Float *vector, Float *result) const;
+
+  /** Vector of pointers to the CSR matrices.  Mutable because the
+   * compression is performed lazily from const accessors. */
+  mutable std::vector<CSRMatrix *> m_Matrices;
+
+  /** Vector of pointers to the right hand side vectors. */
+  std::vector<vnl_vector<Float> *> m_Vectors;
+
+  /** Vector of pointers to the solution vectors. */
+  std::vector<vnl_vector<Float> *> m_Solutions;
+
+  /** Relative residual tolerance of the conjugate gradient iteration. */
+  Float m_Tolerance{ 1e-6 };
+
+  /** Maximum number of conjugate gradient iterations; 0 stands for
+   * twice the system order. */
+  unsigned int m_MaximumNumberOfIterations{ 0 };
+
+  /** Number of iterations used by the last Solve() call. */
+  unsigned int m_NumberOfIterations{ 0 };
+};
+} // end namespace fem
+} // end namespace itk
+
+#endif // itkFEMLinearSystemWrapperCSR_h
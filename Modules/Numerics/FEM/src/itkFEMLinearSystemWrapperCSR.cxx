@@ -0,0 +1,607 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkFEMLinearSystemWrapperCSR.h"
+#include "itkMultiThreaderBase.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace itk
+{
+namespace fem
+{
+
+namespace
+{
+using EntryType = std::pair<std::uint64_t, LinearSystemWrapper::Float>;
+
+inline std::uint64_t PackKey(unsigned int i, unsigned int j)
+{
+  return ( static_cast<std::uint64_t>( i ) << 32 ) | static_cast<std::uint64_t>( j );
+}
+
+inline bool CompareKeys(const EntryType & a, const EntryType & b)
+{
+  return a.first < b.first;
+}
+}
+
+LinearSystemWrapperCSR::~LinearSystemWrapperCSR()
+{
+  for( auto & matrix : m_Matrices )
+    {
+    delete matrix;
+    }
+  for( auto & vector : m_Vectors )
+    {
+    delete vector;
+    }
+  for( auto & solution : m_Solutions )
+    {
+    delete solution;
+    }
+}
+
+void LinearSystemWrapperCSR::InitializeMatrix(unsigned int matrixIndex)
+{
+  if( m_Matrices.empty() )
+    {
+    m_Matrices.resize(m_NumberOfMatrices, nullptr);
+    }
+
+  // out with old, in with new
+  delete m_Matrices[matrixIndex];
+
+  auto * matrix = new CSRMatrix;
+  matrix->RowStart.assign(this->GetSystemOrder() + 1, 0);
+  m_Matrices[matrixIndex] = matrix;
+}
+
+bool LinearSystemWrapperCSR::IsMatrixInitialized(unsigned int matrixIndex)
+{
+  if( m_Matrices.empty() )
+    {
+    return false;
+    }
+
+  return m_Matrices[matrixIndex] != nullptr;
+}
+
+void LinearSystemWrapperCSR::DestroyMatrix(unsigned int matrixIndex)
+{
+  if( !m_Matrices.empty() )
+    {
+    delete m_Matrices[matrixIndex];
+    m_Matrices[matrixIndex] = nullptr;
+    }
+}
+
+void LinearSystemWrapperCSR::InitializeVector(unsigned int vectorIndex)
+{
+  if( m_Vectors.empty() )
+    {
+    m_Vectors.resize(m_NumberOfVectors, nullptr);
+    }
+
+  delete m_Vectors[vectorIndex];
+
+  m_Vectors[vectorIndex] = new vnl_vector<Float>( this->GetSystemOrder() );
+  m_Vectors[vectorIndex]->fill(0.0);
+}
+
+bool LinearSystemWrapperCSR::IsVectorInitialized(unsigned int vectorIndex)
+{
+  if( m_Vectors.empty() )
+    {
+    return false;
+    }
+
+  return m_Vectors[vectorIndex] != nullptr;
+}
+
+void LinearSystemWrapperCSR::DestroyVector(unsigned int vectorIndex)
+{
+  if( !m_Vectors.empty() )
+    {
+    delete m_Vectors[vectorIndex];
+    m_Vectors[vectorIndex] = nullptr;
+    }
+}
+
+void LinearSystemWrapperCSR::InitializeSolution(unsigned int solutionIndex)
+{
+  if( m_Solutions.empty() )
+    {
+    m_Solutions.resize(m_NumberOfSolutions, nullptr);
+    }
+
+  delete m_Solutions[solutionIndex];
+
+  m_Solutions[solutionIndex] = new vnl_vector<Float>( this->GetSystemOrder() );
+  m_Solutions[solutionIndex]->fill(0.0);
+}
+
+bool LinearSystemWrapperCSR::IsSolutionInitialized(unsigned int solutionIndex)
+{
+  if( m_Solutions.empty() )
+    {
+    return false;
+    }
+
+  return m_Solutions[solutionIndex] != nullptr;
+}
+
+void LinearSystemWrapperCSR::DestroySolution(unsigned int solutionIndex)
+{
+  if( !m_Solutions.empty() )
+    {
+    delete m_Solutions[solutionIndex];
+    m_Solutions[solutionIndex] = nullptr;
+    }
+}
+
+void LinearSystemWrapperCSR::FinalizeMatrix(unsigned int matrixIndex) const
+{
+  CSRMatrix & matrix = *( m_Matrices[matrixIndex] );
+
+  if( matrix.Pending.empty() )
+    {
+    return;
+    }
+
+  std::vector<EntryType> & pending = matrix.Pending;
+
+  // Sort the buffered contributions in parallel chunks and merge the
+  // chunks.  Stable sorting keeps contributions with equal keys in
+  // insertion order, so the summation below does not depend on the
+  // number of work units.
+  MultiThreaderBase::Pointer threader = MultiThreaderBase::New();
+
+  std::size_t numberOfChunks = threader->GetNumberOfWorkUnits();
+  const std::size_t minimumChunkSize = 1024;
+  if( numberOfChunks > pending.size() / minimumChunkSize )
+    {
+    numberOfChunks = pending.size() / minimumChunkSize;
+    }
+  if( numberOfChunks < 1 )
+    {
+    numberOfChunks = 1;
+    }
+
+  std::vector<std::size_t> bounds(numberOfChunks + 1);
+  for( std::size_t c = 0; c <= numberOfChunks; c++ )
+    {
+    bounds[c] = c * pending.size() / numberOfChunks;
+    }
+
+  EntryType *data = pending.data();
+  threader->ParallelizeArray( 0, numberOfChunks,
+    [data, &bounds](SizeValueType chunk)
+      {
+      std::stable_sort(data + bounds[chunk], data + bounds[chunk + 1], CompareKeys);
+      }, nullptr );
+
+  while( bounds.size() > 2 )
+    {
+    // Merge pairs of adjacent sorted chunks, all pairs in parallel.
+    const std::size_t numberOfPairs = ( bounds.size() - 1 ) / 2;
+    threader->ParallelizeArray( 0, numberOfPairs,
+      [data, &bounds](SizeValueType pair)
+        {
+        std::inplace_merge(data + bounds[2 * pair], data + bounds[2 * pair + 1],
+                           data + bounds[2 * pair + 2], CompareKeys);
+        }, nullptr );
+
+    std::vector<std::size_t> mergedBounds;
+    for( std::size_t c = 0; c < bounds.size(); c += 2 )
+      {
+      mergedBounds.push_back(bounds[c]);
+      }
+    if( mergedBounds.back() != bounds.back() )
+      {
+      mergedBounds.push_back(bounds.back());
+      }
+    bounds.swap(mergedBounds);
+    }
+
+  // Merge the already compressed entries, which are sorted by
+  // construction, with the sorted buffer and rebuild the compressed
+  // arrays, summing duplicate entries.
+  std::vector<EntryType> entries;
+  entries.reserve( matrix.ColumnIndex.size() + pending.size() );
+  for( unsigned int row = 0; row < m_Order; row++ )
+    {
+    for( std::size_t k = matrix.RowStart[row]; k < matrix.RowStart[row + 1]; k++ )
+      {
+      entries.emplace_back(PackKey(row, matrix.ColumnIndex[k]), matrix.Value[k]);
+      }
+    }
+  const std::size_t middle = entries.size();
+  entries.insert( entries.end(), pending.begin(), pending.end() );
+  std::inplace_merge(entries.begin(), entries.begin() + middle, entries.end(), CompareKeys);
+
+  pending.clear();
+
+  matrix.ColumnIndex.clear();
+  matrix.Value.clear();
+  matrix.RowStart.assign(m_Order + 1, 0);
+
+  std::size_t k = 0;
+  while( k < entries.size() )
+    {
+    const std::uint64_t key = entries[k].first;
+    Float sum = entries[k].second;
+    k++;
+    while( k < entries.size() && entries[k].first == key )
+      {
+      sum += entries[k].second;
+      k++;
+      }
+    matrix.ColumnIndex.push_back( static_cast<unsigned int>( key & 0xffffffffu ) );
+    matrix.Value.push_back(sum);
+    matrix.RowStart[( key >> 32 ) + 1]++;
+    }
+  for( unsigned int row = 0; row < m_Order; row++ )
+    {
+    matrix.RowStart[row + 1] += matrix.RowStart[row];
+    }
+}
+
+bool LinearSystemWrapperCSR::FindEntry(const CSRMatrix & matrix, unsigned int i, unsigned int j,
+                                       std::size_t & position) const
+{
+  const auto begin = matrix.ColumnIndex.begin() + matrix.RowStart[i];
+  const auto end = matrix.ColumnIndex.begin() + matrix.RowStart[i + 1];
+
+  const auto it = std::lower_bound(begin, end, j);
+  if( it == end || *it != j )
+    {
+    return false;
+    }
+  position = static_cast<std::size_t>( it - matrix.ColumnIndex.begin() );
+  return true;
+}
+
+LinearSystemWrapperCSR::Float LinearSystemWrapperCSR::GetMatrixValue(unsigned int i, unsigned int j,
+                                                                     unsigned int matrixIndex) const
+{
+  this->FinalizeMatrix(matrixIndex);
+
+  const CSRMatrix & matrix = *( m_Matrices[matrixIndex] );
+  std::size_t position;
+  if( this->FindEntry(matrix, i, j, position) )
+    {
+    return matrix.Value[position];
+    }
+  return 0.0;
+}
+
+void LinearSystemWrapperCSR::SetMatrixValue(unsigned int i, unsigned int j, Float value,
+                                            unsigned int matrixIndex)
+{
+  this->FinalizeMatrix(matrixIndex);
+
+  CSRMatrix & matrix = *( m_Matrices[matrixIndex] );
+  std::size_t position;
+  if( this->FindEntry(matrix, i, j, position) )
+    {
+    matrix.Value[position] = value;
+    return;
+    }
+  if( value == 0.0 )
+    {
+    return;
+    }
+
+  // Insert a new entry into the compressed structure.  This is linear
+  // in the number of entries but only happens for values outside of the
+  // assembled pattern, such as the multi freedom constraint terms.
+  const auto begin = matrix.ColumnIndex.begin() + matrix.RowStart[i];
+  const auto end = matrix.ColumnIndex.begin() + matrix.RowStart[i + 1];
+  const auto it = std::lower_bound(begin, end, j);
+  position = static_cast<std::size_t>( it - matrix.ColumnIndex.begin() );
+  matrix.ColumnIndex.insert(matrix.ColumnIndex.begin() + position, j);
+  matrix.Value.insert(matrix.Value.begin() + position, value);
+  for( unsigned int row = i + 1; row <= m_Order; row++ )
+    {
+    matrix.RowStart[row]++;
+    }
+}
+
+void LinearSystemWrapperCSR::AddMatrixValue(unsigned int i, unsigned int j, Float value,
+                                            unsigned int matrixIndex)
+{
+  CSRMatrix & matrix = *( m_Matrices[matrixIndex] );
+
+  if( matrix.Pending.empty() )
+    {
+    // Update entries of the compressed structure in place so repeated
+    // assemblies do not re-sort an unchanged pattern.
+    std::size_t position;
+    if( this->FindEntry(matrix, i, j, position) )
+      {
+      matrix.Value[position] += value;
+      return;
+      }
+    }
+
+  matrix.Pending.emplace_back(PackKey(i, j), value);
+}
+
+void LinearSystemWrapperCSR::GetColumnsOfNonZeroMatrixElementsInRow(unsigned int row, ColumnArray & cols,
+                                                                    unsigned int matrixIndex)
+{
+  this->FinalizeMatrix(matrixIndex);
+
+  const CSRMatrix & matrix = *( m_Matrices[matrixIndex] );
+  cols.assign( matrix.ColumnIndex.begin() + matrix.RowStart[row],
+               matrix.ColumnIndex.begin() + matrix.RowStart[row + 1] );
+}
+
+LinearSystemWrapperCSR::Float LinearSystemWrapperCSR::GetSolutionValue(unsigned int i,
+                                                                       unsigned int solutionIndex) const
+{
+  if( m_Solutions.empty() || m_Solutions[solutionIndex] == nullptr
+      || m_Solutions[solutionIndex]->size() <= i )
+    {
+    return 0.0;
+    }
+  return ( *( m_Solutions[solutionIndex] ) )[i];
+}
+
+void LinearSystemWrapperCSR::ScaleMatrix(Float scale, unsigned int matrixIndex)
+{
+  CSRMatrix & matrix = *( m_Matrices[matrixIndex] );
+
+  for( auto & value : matrix.Value )
+    {
+    value *= scale;
+    }
+  for( auto & entry : matrix.Pending )
+    {
+    entry.second *= scale;
+    }
+}
+
+void LinearSystemWrapperCSR::SwapMatrices(unsigned int matrixIndex1, unsigned int matrixIndex2)
+{
+  std::swap(m_Matrices[matrixIndex1], m_Matrices[matrixIndex2]);
+}
+
+void LinearSystemWrapperCSR::SwapVectors(unsigned int vectorIndex1, unsigned int vectorIndex2)
+{
+  std::swap(m_Vectors[vectorIndex1], m_Vectors[vectorIndex2]);
+}
+
+void LinearSystemWrapperCSR::SwapSolutions(unsigned int solutionIndex1, unsigned int solutionIndex2)
+{
+  std::swap(m_Solutions[solutionIndex1], m_Solutions[solutionIndex2]);
+}
+
+void LinearSystemWrapperCSR::CopySolution2Vector(unsigned solutionIndex, unsigned int vectorIndex)
+{
+  this->InitializeVector(vectorIndex);
+  *( m_Vectors[vectorIndex] ) = *( m_Solutions[solutionIndex] );
+}
+
+void LinearSystemWrapperCSR::CopyVector2Solution(unsigned int vectorIndex, unsigned int solutionIndex)
+{
+  this->InitializeSolution(solutionIndex);
+  *( m_Solutions[solutionIndex] ) = *( m_Vectors[vectorIndex] );
+}
+
+void LinearSystemWrapperCSR::MultiplyMatrixMatrix(unsigned int resultMatrixIndex, unsigned int leftMatrixIndex,
+                                                  unsigned int rightMatrixIndex)
+{
+  this->FinalizeMatrix(leftMatrixIndex);
+  this->FinalizeMatrix(rightMatrixIndex);
+
+  const CSRMatrix & left = *( m_Matrices[leftMatrixIndex] );
+  const CSRMatrix & right = *( m_Matrices[rightMatrixIndex] );
+
+  auto * result = new CSRMatrix;
+  result->RowStart.assign(m_Order + 1, 0);
+
+  // Row-by-row product with a dense accumulator over the columns of the
+  // current row.
+  std::vector<Float> accumulator(m_Order, 0.0);
+  std::vector<unsigned int> activeColumns;
+  for( unsigned int row = 0; row < m_Order; row++ )
+    {
+    activeColumns.clear();
+    for( std::size_t k = left.RowStart[row]; k < left.RowStart[row + 1]; k++ )
+      {
+      const unsigned int middle = left.ColumnIndex[k];
+      const Float leftValue = left.Value[k];
+      for( std::size_t l = right.RowStart[middle]; l < right.RowStart[middle + 1]; l++ )
+        {
+        const unsigned int column = right.ColumnIndex[l];
+        if( accumulator[column] == 0.0 )
+          {
+          activeColumns.push_back(column);
+          }
+        accumulator[column] += leftValue * right.Value[l];
+        }
+      }
+    std::sort( activeColumns.begin(), activeColumns.end() );
+    for( const unsigned int column : activeColumns )
+      {
+      result->ColumnIndex.push_back(column);
+      result->Value.push_back(accumulator[column]);
+      accumulator[column] = 0.0;
+      }
+    result->RowStart[row + 1] = result->ColumnIndex.size();
+    }
+
+  delete m_Matrices[resultMatrixIndex];
+  m_Matrices[resultMatrixIndex] = result;
+}
+
+void LinearSystemWrapperCSR::ParallelMultiply(const CSRMatrix & matrix, const Float *vector,
+                                              Float *result) const
+{
+  const std::size_t *rowStart = matrix.RowStart.data();
+  const unsigned int *columnIndex = matrix.ColumnIndex.data();
+  const Float *value = matrix.Value.data();
+
+  MultiThreaderBase::Pointer threader = MultiThreaderBase::New();
+  threader->ParallelizeArray( 0, m_Order,
+    [rowStart, columnIndex, value, vector, result](SizeValueType row)
+      {
+      Float sum = 0.0;
+      for( std::size_t k = rowStart[row]; k < rowStart[row + 1]; k++ )
+        {
+        sum += value[k] * vector[columnIndex[k]];
+        }
+      result[row] = sum;
+      }, nullptr );
+}
+
+void LinearSystemWrapperCSR::MultiplyMatrixVector(unsigned int resultVectorIndex, unsigned int matrixIndex,
+                                                  unsigned int vectorIndex)
+{
+  this->FinalizeMatrix(matrixIndex);
+
+  vnl_vector<Float> source = *( m_Vectors[vectorIndex] );
+  this->InitializeVector(resultVectorIndex);
+  this->ParallelMultiply( *( m_Matrices[matrixIndex] ), source.data_block(),
+                          m_Vectors[resultVectorIndex]->data_block() );
+}
+
+void LinearSystemWrapperCSR::MultiplyMatrixSolution(unsigned int resultVectorIndex, unsigned int matrixIndex,
+                                                    unsigned int solutionIndex)
+{
+  this->FinalizeMatrix(matrixIndex);
+
+  this->InitializeVector(resultVectorIndex);
+  this->ParallelMultiply( *( m_Matrices[matrixIndex] ), m_Solutions[solutionIndex]->data_block(),
+                          m_Vectors[resultVectorIndex]->data_block() );
+}
+
+void LinearSystemWrapperCSR::Solve()
+{
+  if( m_Matrices.empty() || m_Matrices[0] == nullptr
+      || m_Vectors.empty() || m_Vectors[0] == nullptr
+      || m_Solutions.empty() || m_Solutions[0] == nullptr )
+    {
+    throw FEMExceptionLinearSystem(__FILE__, __LINE__, "LinearSystemWrapperCSR::Solve",
+                                   "The linear system is not assembled");
+    }
+
+  this->FinalizeMatrix(0);
+
+  const CSRMatrix & matrix = *( m_Matrices[0] );
+  const vnl_vector<Float> & b = *( m_Vectors[0] );
+  vnl_vector<Float> & x = *( m_Solutions[0] );
+
+  const unsigned int n = m_Order;
+
+  m_NumberOfIterations = 0;
+
+  const Float bNorm = b.two_norm();
+  if( bNorm == 0.0 )
+    {
+    x.fill(0.0);
+    return;
+    }
+
+  // Jacobi preconditioner
+  std::vector<Float> inverseDiagonal(n, 1.0);
+  for( unsigned int i = 0; i < n; i++ )
+    {
+    std::size_t position;
+    if( this->FindEntry(matrix, i, i, position) && matrix.Value[position] != 0.0 )
+      {
+      inverseDiagonal[i] = 1.0 / matrix.Value[position];
+      }
+    }
+
+  std::vector<Float> r(n);
+  std::vector<Float> z(n);
+  std::vector<Float> p(n);
+  std::vector<Float> q(n);
+
+  // r = b - A x, supporting a warm started solution vector
+  this->ParallelMultiply( matrix, x.data_block(), r.data() );
+  Float rz = 0.0;
+  for( unsigned int i = 0; i < n; i++ )
+    {
+    r[i] = b[i] - r[i];
+    z[i] = inverseDiagonal[i] * r[i];
+    p[i] = z[i];
+    rz += r[i] * z[i];
+    }
+
+  unsigned int maximumNumberOfIterations = m_MaximumNumberOfIterations;
+  if( maximumNumberOfIterations == 0 )
+    {
+    maximumNumberOfIterations = 2 * n;
+    }
+
+  const Float tolerance = m_Tolerance * bNorm;
+
+  while( m_NumberOfIterations < maximumNumberOfIterations )
+    {
+    Float rNorm = 0.0;
+    for( unsigned int i = 0; i < n; i++ )
+      {
+      rNorm += r[i] * r[i];
+      }
+    if( std::sqrt(rNorm) <= tolerance )
+      {
+      break;
+      }
+
+    this->ParallelMultiply( matrix, p.data(), q.data() );
+
+    Float pq = 0.0;
+    for( unsigned int i = 0; i < n; i++ )
+      {
+      pq += p[i] * q[i];
+      }
+    if( pq <= 0.0 )
+      {
+      // The matrix is not positive definite along this direction;
+      // continuing would diverge.
+      break;
+      }
+
+    const Float alpha = rz / pq;
+    Float rzNew = 0.0;
+    for( unsigned int i = 0; i < n; i++ )
+      {
+      x[i] += alpha * p[i];
+      r[i] -= alpha * q[i];
+      z[i] = inverseDiagonal[i] * r[i];
+      rzNew += r[i] * z[i];
+      }
+
+    const Float beta = rzNew / rz;
+    rz = rzNew;
+    for( unsigned int i = 0; i < n; i++ )
+      {
+      p[i] = z[i] + beta * p[i];
+      }
+
+    m_NumberOfIterations++;
+    }
+}
+
+} // end namespace fem
+} // end namespace itk
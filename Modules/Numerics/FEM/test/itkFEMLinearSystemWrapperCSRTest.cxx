@@ -0,0 +1,270 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkFEMLinearSystemWrapperCSR.h"
+#include <cmath>
+#include <iostream>
+
+/* Testing for the compressed sparse row linear system wrapper */
+int itkFEMLinearSystemWrapperCSRTest(int, char *[])
+{
+
+  /* loop vars for printing */
+  unsigned int i;
+  unsigned int j;
+
+  /* declare wrapper */
+  itk::fem::LinearSystemWrapperCSR it;
+
+  /* system parameters */
+  unsigned int N = 5;
+  unsigned int nMatrices =  3;
+  unsigned int nVectors =   2;
+  unsigned int nSolutions = 2;
+
+  /* Set up the system */
+  it.SetSystemOrder(N);
+  it.SetNumberOfMatrices(nMatrices);
+  it.SetNumberOfVectors(nVectors);
+  it.SetNumberOfSolutions(nSolutions);
+
+  /* Initialize memory */
+  for( i = 0; i < nMatrices; i++ )
+    {
+    it.InitializeMatrix(i);
+    }
+  for( i = 0; i < nVectors; i++ )
+    {
+    it.InitializeVector(i);
+    }
+  for( i = 0; i < nSolutions; i++ )
+    {
+    it.InitializeSolution(i);
+    }
+
+  /*     matrix 0 (symmetric positive definite)
+   * |11  0  0 14 15|
+   * | 0 22  0  0  0|
+   * | 0  0 33  0  0|
+   * |14  0  0 44 45|
+   * |15  0  0 45 55|
+   *
+   * Assemble it element style: accumulate each entry in two halves so
+   * the lazy coordinate buffer has duplicates to merge.
+   */
+  const double denseMatrix[5][5] = {
+      { 11,  0,  0, 14, 15 },
+      {  0, 22,  0,  0,  0 },
+      {  0,  0, 33,  0,  0 },
+      { 14,  0,  0, 44, 45 },
+      { 15,  0,  0, 45, 55 }
+    };
+  for( i = 0; i < N; i++ )
+    {
+    for( j = 0; j < N; j++ )
+      {
+      if ( denseMatrix[i][j] != 0.0 )
+        {
+        it.AddMatrixValue(i, j, 0.5 * denseMatrix[i][j], 0);
+        it.AddMatrixValue(i, j, 0.5 * denseMatrix[i][j], 0);
+        }
+      }
+    }
+
+  /* check the compressed matrix entry by entry, including the zeros
+   * outside of the sparse structure */
+  std::cout << "Matrix 0" << std::endl;
+  for( i = 0; i < N; i++ )
+    {
+    for( j = 0; j < N; j++ )
+      {
+      std::cout << it.GetMatrixValue(i, j, 0) << " ";
+      if ( std::fabs( it.GetMatrixValue(i, j, 0) - denseMatrix[i][j] ) > 1e-10 )
+        {
+        std::cerr << "Wrong matrix value at (" << i << "," << j << ")" << std::endl;
+        return EXIT_FAILURE;
+        }
+      }
+    std::cout << std::endl;
+    }
+  std::cout << std::endl;
+
+  /* SetMatrixValue must overwrite a buffered accumulation, not add to it */
+  it.SetMatrixValue(2, 2, 33, 0);
+  if ( std::fabs( it.GetMatrixValue(2, 2, 0) - 33 ) > 1e-10 )
+    {
+    std::cerr << "SetMatrixValue did not overwrite the entry." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  /* the sparse structure of row 0 holds the columns 0, 3 and 4 */
+  itk::fem::LinearSystemWrapperCSR::ColumnArray columns;
+  it.GetColumnsOfNonZeroMatrixElementsInRow(0, columns, 0);
+  if ( columns.size() != 3 || columns[0] != 0 || columns[1] != 3 || columns[2] != 4 )
+    {
+    std::cerr << "Wrong columns in row 0." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  /* matrix 1 = matrix 0 */
+  for( i = 0; i < N; i++ )
+    {
+    for( j = 0; j < N; j++ )
+      {
+      if ( denseMatrix[i][j] != 0.0 )
+        {
+        it.SetMatrixValue(i, j, denseMatrix[i][j], 1);
+        }
+      }
+    }
+
+  /* matrix 2 = matrix 0 * matrix 1, checked against the dense product */
+  it.MultiplyMatrixMatrix(2, 0, 1);
+  std::cout << "matrix 2 = matrix 0 * matrix 1" << std::endl;
+  for( i = 0; i < N; i++ )
+    {
+    for( j = 0; j < N; j++ )
+      {
+      double expected = 0.0;
+      for( unsigned int k = 0; k < N; k++ )
+        {
+        expected += denseMatrix[i][k] * denseMatrix[k][j];
+        }
+      std::cout << it.GetMatrixValue(i, j, 2) << " ";
+      if ( std::fabs( it.GetMatrixValue(i, j, 2) - expected ) > 1e-10 )
+        {
+        std::cerr << "Wrong product value at (" << i << "," << j << ")" << std::endl;
+        return EXIT_FAILURE;
+        }
+      }
+    std::cout << std::endl;
+    }
+  std::cout << std::endl;
+
+  /* Vector 0 = [1 2 3 4 5] */
+  for( i = 0; i < N; i++ )
+    {
+    it.SetVectorValue(i, i + 1, 0);
+    }
+
+  /* vector 1 = matrix 0 * vector 0 */
+  it.MultiplyMatrixVector(1, 0, 0);
+  std::cout << "Vector 1 = Matrix 0 * Vector 0" << std::endl;
+  for( i = 0; i < N; i++ )
+    {
+    double expected = 0.0;
+    for( j = 0; j < N; j++ )
+      {
+      expected += denseMatrix[i][j] * ( j + 1 );
+      }
+    std::cout << it.GetVectorValue(i, 1) << " ";
+    if ( std::fabs( it.GetVectorValue(i, 1) - expected ) > 1e-10 )
+      {
+      std::cerr << "Wrong matrix-vector product value at " << i << std::endl;
+      return EXIT_FAILURE;
+      }
+    }
+  std::cout << std::endl << std::endl;
+
+  /* solution 1 = [1 2 3 4 5]; vector 1 = matrix 0 * solution 1 must
+   * give the same result */
+  for( i = 0; i < N; i++ )
+    {
+    it.SetSolutionValue(i, i + 1, 1);
+    }
+  it.MultiplyMatrixSolution(1, 0, 1);
+  for( i = 0; i < N; i++ )
+    {
+    double expected = 0.0;
+    for( j = 0; j < N; j++ )
+      {
+      expected += denseMatrix[i][j] * ( j + 1 );
+      }
+    if ( std::fabs( it.GetVectorValue(i, 1) - expected ) > 1e-10 )
+      {
+      std::cerr << "Wrong matrix-solution product value at " << i << std::endl;
+      return EXIT_FAILURE;
+      }
+    }
+
+  /* solve the system: Matrix 0 * x = Vector 0 and verify the residual
+   * against the conjugate gradient tolerance */
+  it.SetTolerance(1e-10);
+  it.Solve();
+  std::cout << "Solve for x in: Matrix 0 * x = Vector 0" << std::endl;
+  std::cout << "Solution 0 after " << it.GetNumberOfIterations()
+            << " iterations" << std::endl;
+  for( i = 0; i < N; i++ )
+    {
+    std::cout << it.GetSolutionValue(i, 0) << " ";
+    }
+  std::cout << std::endl << std::endl;
+  for( i = 0; i < N; i++ )
+    {
+    double residual = -static_cast< double >( i + 1 );
+    for( j = 0; j < N; j++ )
+      {
+      residual += denseMatrix[i][j] * it.GetSolutionValue(j, 0);
+      }
+    if ( std::fabs( residual ) > 1e-6 )
+      {
+      std::cerr << "Residual " << residual << " at row " << i
+                << " exceeds the solver tolerance." << std::endl;
+      return EXIT_FAILURE;
+      }
+    }
+
+  /* swap solutions and copy one back to a vector */
+  it.SwapSolutions(0, 1);
+  it.CopySolution2Vector(1, 0);
+  for( i = 0; i < N; i++ )
+    {
+    if ( std::fabs( it.GetVectorValue(i, 0) - it.GetSolutionValue(i, 1) ) > 1e-10 )
+      {
+      std::cerr << "CopySolution2Vector failed at " << i << std::endl;
+      return EXIT_FAILURE;
+      }
+    }
+
+  /* swap and scale matrices; matrix 2 now holds the original matrix 0 */
+  it.SwapMatrices(0, 2);
+  it.ScaleMatrix(2.0, 2);
+  for( i = 0; i < N; i++ )
+    {
+    for( j = 0; j < N; j++ )
+      {
+      if ( std::fabs( it.GetMatrixValue(i, j, 2) - 2.0 * denseMatrix[i][j] ) > 1e-10 )
+        {
+        std::cerr << "Wrong scaled value at (" << i << "," << j << ")" << std::endl;
+        return EXIT_FAILURE;
+        }
+      }
+    }
+
+  /* swap and scale vectors */
+  it.SwapVectors(0, 1);
+  it.ScaleVector(3.0, 0);
+
+  /* destroy matrix,vector,solution */
+  it.DestroyMatrix(0);
+  it.DestroyVector(1);
+  it.DestroySolution(0);
+
+  std::cout << "Test PASSED." << std::endl;
+  return EXIT_SUCCESS;
+}
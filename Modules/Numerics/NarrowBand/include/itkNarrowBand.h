@@ -21,6 +21,11 @@
 #include "itkLightObject.h"
 #include "itkObjectFactory.h"
 #include "itkNumericTraits.h"
+#if !defined( ITK_WRAPPING_PARSER )
+#include "itkThreadedIteratorRangePartitioner.h"
+#endif
+#include <cstddef>
+#include <iterator>
 #include <vector>
 
 namespace itk
@@ -35,6 +40,9 @@ template< typename TIndexType, typename TDataType >
 class ITK_TEMPLATE_EXPORT BandNode
 {
 public:
+  using IndexType = TIndexType;
+  using DataType = TDataType;
+
   TDataType   m_Data;
   TIndexType  m_Index;
   signed char m_NodeState{0};
@@ -45,6 +53,17 @@ public:
 
 /** \class NarrowBand
  * \brief Narrow Band class
+ *
+ * The nodes of the band are kept in structure-of-arrays form: the indices,
+ * the update values and the node states each live in their own contiguous
+ * array.  Band sweeps that only touch one of the members, such as the
+ * update loops of the narrow band solvers, then read memory sequentially
+ * instead of striding over complete nodes, and the update arithmetic can
+ * be vectorized by the compiler.  The iterators below present the nodes
+ * through small reference proxies, so the member names of BandNode remain
+ * the access interface.  The arrays themselves are available through
+ * GetIndexArray(), GetDataArray() and GetNodeStateArray().
+ *
  * \ingroup ITKNarrowBand
  */
 template< typename NodeType >
@@ -65,10 +84,370 @@ public:
   /** Run-time type information (and related methods). */
   itkTypeMacro(NarrowBand, LightObject);
 
-  using NodeContainerType = std::vector< NodeType >;
-  using SizeType = typename NodeContainerType::size_type;
-  using ConstIterator = typename NodeContainerType::const_iterator;
-  using Iterator = typename NodeContainerType::iterator;
+  /** Types of the node members, taken from the node class. */
+  using IndexType = typename NodeType::IndexType;
+  using DataType = typename NodeType::DataType;
+
+  using SizeType = std::size_t;
+
+  /** Reference to the members of one node of the band.  The members are
+   * stored in separate arrays, so a node reference bundles one element of
+   * each array under the member names of BandNode. */
+  class NodeReferenceType
+  {
+public:
+    DataType &    m_Data;
+    IndexType &   m_Index;
+    signed char & m_NodeState;
+
+    NodeReferenceType(DataType & data, IndexType & index, signed char & state) :
+      m_Data(data),
+      m_Index(index),
+      m_NodeState(state)
+    {}
+
+    /** Assemble a node value from the referenced members. */
+    operator NodeType() const
+    {
+      NodeType node;
+
+      node.m_Data = m_Data;
+      node.m_Index = m_Index;
+      node.m_NodeState = m_NodeState;
+      return node;
+    }
+
+    NodeReferenceType & operator=(const NodeType & node)
+    {
+      m_Data = node.m_Data;
+      m_Index = node.m_Index;
+      m_NodeState = node.m_NodeState;
+      return *this;
+    }
+
+    NodeReferenceType & operator=(const NodeReferenceType & other)
+    {
+      m_Data = other.m_Data;
+      m_Index = other.m_Index;
+      m_NodeState = other.m_NodeState;
+      return *this;
+    }
+
+    NodeReferenceType * operator->()
+    {
+      return this;
+    }
+
+    const NodeReferenceType * operator->() const
+    {
+      return this;
+    }
+  };
+
+  /** Read only reference to the members of one node of the band. */
+  class ConstNodeReferenceType
+  {
+public:
+    const DataType &    m_Data;
+    const IndexType &   m_Index;
+    const signed char & m_NodeState;
+
+    ConstNodeReferenceType(const DataType & data, const IndexType & index, const signed char & state) :
+      m_Data(data),
+      m_Index(index),
+      m_NodeState(state)
+    {}
+
+    /** Assemble a node value from the referenced members. */
+    operator NodeType() const
+    {
+      NodeType node;
+
+      node.m_Data = m_Data;
+      node.m_Index = m_Index;
+      node.m_NodeState = m_NodeState;
+      return node;
+    }
+
+    const ConstNodeReferenceType * operator->() const
+    {
+      return this;
+    }
+  };
+
+  class ConstIterator;
+
+  /** Random access iterator over the nodes of the band.  The iterator
+   * stores a position instead of a pointer, so it stays valid when nodes
+   * are appended to the band. */
+  class Iterator
+  {
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = NodeType;
+    using difference_type = std::ptrdiff_t;
+    using pointer = NodeReferenceType;
+    using reference = NodeReferenceType;
+
+    Iterator() = default;
+
+    reference operator*() const
+    {
+      return NodeReferenceType( m_Band->m_DataContainer[m_Position],
+                                m_Band->m_IndexContainer[m_Position],
+                                m_Band->m_StateContainer[m_Position] );
+    }
+
+    pointer operator->() const
+    {
+      return **this;
+    }
+
+    Iterator & operator++()
+    {
+      ++m_Position;
+      return *this;
+    }
+
+    Iterator operator++(int)
+    {
+      Iterator it(*this);
+
+      ++m_Position;
+      return it;
+    }
+
+    Iterator & operator--()
+    {
+      --m_Position;
+      return *this;
+    }
+
+    Iterator operator--(int)
+    {
+      Iterator it(*this);
+
+      --m_Position;
+      return it;
+    }
+
+    Iterator & operator+=(difference_type n)
+    {
+      m_Position = static_cast< SizeType >( static_cast< difference_type >( m_Position ) + n );
+      return *this;
+    }
+
+    Iterator & operator-=(difference_type n)
+    {
+      return this->operator+=(-n);
+    }
+
+    Iterator operator+(difference_type n) const
+    {
+      Iterator it(*this);
+
+      it += n;
+      return it;
+    }
+
+    Iterator operator-(difference_type n) const
+    {
+      Iterator it(*this);
+
+      it -= n;
+      return it;
+    }
+
+    difference_type operator-(const Iterator & other) const
+    {
+      return static_cast< difference_type >( m_Position ) - static_cast< difference_type >( other.m_Position );
+    }
+
+    bool operator==(const Iterator & other) const
+    {
+      return m_Position == other.m_Position;
+    }
+
+    bool operator!=(const Iterator & other) const
+    {
+      return m_Position != other.m_Position;
+    }
+
+    bool operator<(const Iterator & other) const
+    {
+      return m_Position < other.m_Position;
+    }
+
+    bool operator<=(const Iterator & other) const
+    {
+      return m_Position <= other.m_Position;
+    }
+
+    bool operator>(const Iterator & other) const
+    {
+      return m_Position > other.m_Position;
+    }
+
+    bool operator>=(const Iterator & other) const
+    {
+      return m_Position >= other.m_Position;
+    }
+
+    /** Position of the iterator within the node arrays of the band. */
+    SizeType GetPosition() const
+    {
+      return m_Position;
+    }
+
+private:
+    friend class NarrowBand;
+    friend class ConstIterator;
+
+    Iterator(Self *band, SizeType position) :
+      m_Band(band),
+      m_Position(position)
+    {}
+
+    Self *   m_Band{ nullptr };
+    SizeType m_Position{ 0 };
+  };
+
+  /** Read only random access iterator over the nodes of the band. */
+  class ConstIterator
+  {
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = NodeType;
+    using difference_type = std::ptrdiff_t;
+    using pointer = ConstNodeReferenceType;
+    using reference = ConstNodeReferenceType;
+
+    ConstIterator() = default;
+
+    ConstIterator(const Iterator & it) :
+      m_Band(it.m_Band),
+      m_Position(it.m_Position)
+    {}
+
+    reference operator*() const
+    {
+      return ConstNodeReferenceType( m_Band->m_DataContainer[m_Position],
+                                     m_Band->m_IndexContainer[m_Position],
+                                     m_Band->m_StateContainer[m_Position] );
+    }
+
+    pointer operator->() const
+    {
+      return **this;
+    }
+
+    ConstIterator & operator++()
+    {
+      ++m_Position;
+      return *this;
+    }
+
+    ConstIterator operator++(int)
+    {
+      ConstIterator it(*this);
+
+      ++m_Position;
+      return it;
+    }
+
+    ConstIterator & operator--()
+    {
+      --m_Position;
+      return *this;
+    }
+
+    ConstIterator operator--(int)
+    {
+      ConstIterator it(*this);
+
+      --m_Position;
+      return it;
+    }
+
+    ConstIterator & operator+=(difference_type n)
+    {
+      m_Position = static_cast< SizeType >( static_cast< difference_type >( m_Position ) + n );
+      return *this;
+    }
+
+    ConstIterator & operator-=(difference_type n)
+    {
+      return this->operator+=(-n);
+    }
+
+    ConstIterator operator+(difference_type n) const
+    {
+      ConstIterator it(*this);
+
+      it += n;
+      return it;
+    }
+
+    ConstIterator operator-(difference_type n) const
+    {
+      ConstIterator it(*this);
+
+      it -= n;
+      return it;
+    }
+
+    difference_type operator-(const ConstIterator & other) const
+    {
+      return static_cast< difference_type >( m_Position ) - static_cast< difference_type >( other.m_Position );
+    }
+
+    bool operator==(const ConstIterator & other) const
+    {
+      return m_Position == other.m_Position;
+    }
+
+    bool operator!=(const ConstIterator & other) const
+    {
+      return m_Position != other.m_Position;
+    }
+
+    bool operator<(const ConstIterator & other) const
+    {
+      return m_Position < other.m_Position;
+    }
+
+    bool operator<=(const ConstIterator & other) const
+    {
+      return m_Position <= other.m_Position;
+    }
+
+    bool operator>(const ConstIterator & other) const
+    {
+      return m_Position > other.m_Position;
+    }
+
+    bool operator>=(const ConstIterator & other) const
+    {
+      return m_Position >= other.m_Position;
+    }
+
+    /** Position of the iterator within the node arrays of the band. */
+    SizeType GetPosition() const
+    {
+      return m_Position;
+    }
+
+private:
+    friend class NarrowBand;
+
+    ConstIterator(const Self *band, SizeType position) :
+      m_Band(band),
+      m_Position(position)
+    {}
+
+    const Self * m_Band{ nullptr };
+    SizeType     m_Position{ 0 };
+  };
 
   /** Begin is the first valid iterator position within the region.  End is ONE
       PAST the last valid iterator position in the region. */
@@ -82,72 +461,127 @@ public:
 #if !defined( ITK_WRAPPING_PARSER )
   std::vector< RegionType > SplitBand(const SizeType&);
 
+  /** Iterator range domain describing the whole band, for partitioning
+   * with a ThreadedIteratorRangePartitioner in DomainThreader based
+   * algorithms.  The positional iterators partition into stable,
+   * contiguous ranges of the node arrays. */
+  using DomainType = ThreadedIteratorRangePartitionerDomain< Iterator >;
+  using ThreadedPartitionerType = ThreadedIteratorRangePartitioner< Iterator >;
+
+  DomainType GetDomain()
+  {
+    return DomainType( this->Begin(), this->End() );
+  }
+
 #endif
 
   Iterator Begin()
   {
-    return m_NodeContainer.begin();
+    return Iterator(this, 0);
   }
 
   ConstIterator Begin() const
   {
-    return m_NodeContainer.begin();
+    return ConstIterator(this, 0);
   }
 
   Iterator End()
   {
-    return m_NodeContainer.end();
+    return Iterator( this, m_DataContainer.size() );
   }
 
   ConstIterator End() const
   {
-    return m_NodeContainer.end();
+    return ConstIterator( this, m_DataContainer.size() );
   }
 
   SizeType Size() const
   {
-    return m_NodeContainer.size();
+    return m_DataContainer.size();
   }
 
   bool Empty() const
   {
-    return m_NodeContainer.empty();
+    return m_DataContainer.empty();
   }
 
   /** Clear the narrow band container. */
   void Clear()
   {
-    m_NodeContainer.clear();
+    m_DataContainer.clear();
+    m_IndexContainer.clear();
+    m_StateContainer.clear();
   }
 
   void Reserve(SizeType n)
   {
-    m_NodeContainer.reserve(n);
+    m_DataContainer.reserve(n);
+    m_IndexContainer.reserve(n);
+    m_StateContainer.reserve(n);
   }
 
   void PushBack(const NodeType & n)
   {
-    m_NodeContainer.push_back(n);
+    m_DataContainer.push_back(n.m_Data);
+    m_IndexContainer.push_back(n.m_Index);
+    m_StateContainer.push_back(n.m_NodeState);
   }
 
   void PopBack()
   {
-    m_NodeContainer.pop_back();
+    m_DataContainer.pop_back();
+    m_IndexContainer.pop_back();
+    m_StateContainer.pop_back();
   }
 
   void Resize(SizeType n)
   {
-    m_NodeContainer.resize(n);
+    m_DataContainer.resize(n);
+    m_IndexContainer.resize(n);
+    m_StateContainer.resize(n, 0);
+  }
+
+  NodeReferenceType operator[](SizeType n)
+  {
+    return NodeReferenceType(m_DataContainer[n], m_IndexContainer[n], m_StateContainer[n]);
+  }
+
+  ConstNodeReferenceType operator[](SizeType n) const
+  {
+    return ConstNodeReferenceType(m_DataContainer[n], m_IndexContainer[n], m_StateContainer[n]);
+  }
+
+  /** Direct access to the contiguous array of node indices. */
+  IndexType * GetIndexArray()
+  {
+    return m_IndexContainer.data();
+  }
+
+  const IndexType * GetIndexArray() const
+  {
+    return m_IndexContainer.data();
+  }
+
+  /** Direct access to the contiguous array of node update values. */
+  DataType * GetDataArray()
+  {
+    return m_DataContainer.data();
+  }
+
+  const DataType * GetDataArray() const
+  {
+    return m_DataContainer.data();
   }
 
-  NodeType & operator[](SizeType n)
+  /** Direct access to the contiguous array of node states. */
+  signed char * GetNodeStateArray()
   {
-    return m_NodeContainer[n];
+    return m_StateContainer.data();
   }
 
-  const NodeType & operator[](SizeType n) const
+  const signed char * GetNodeStateArray() const
   {
-    return m_NodeContainer[n];
+    return m_StateContainer.data();
   }
 
   /** Set/Get the narrow band total radius. The narrow band width will be twice
@@ -170,7 +604,10 @@ protected:
   float m_InnerRadius{ 0.0 };
 
 private:
-  NodeContainerType m_NodeContainer;
+  /** The members of the nodes, each in its own contiguous array. */
+  std::vector< DataType >   m_DataContainer;
+  std::vector< IndexType >  m_IndexContainer;
+  std::vector< signed char > m_StateContainer;
 };
 } // end namespace itk
 
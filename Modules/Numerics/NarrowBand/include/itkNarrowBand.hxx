@@ -39,7 +39,7 @@ NarrowBand< NodeType >
 ::SplitBand(const SizeType& n)
 {
   SizeType t_n = n;
-  SizeType t_size = m_NodeContainer.size();
+  SizeType t_size = this->Size();
 
   std::vector< RegionType > regionList;
   if ( t_n > t_size )
@@ -276,21 +276,30 @@ NarrowBandImageFilterBase< TInputImage, TOutputImage >
   //const int INNER_MASK = 2;
   constexpr signed char INNER_MASK  = 2;
 
-  typename NarrowBandType::ConstIterator it;
   typename OutputImageType::Pointer image = this->GetOutput();
   typename OutputImageType::PixelType oldvalue;
   typename OutputImageType::PixelType newvalue;
-  for ( it = regionToProcess.first; it != regionToProcess.last; ++it )
+
+  // The node members are stored in separate contiguous arrays, so the
+  // assigned range is swept through the arrays directly and the data and
+  // state loads stay sequential.
+  const IndexType *   indexArray = m_NarrowBand->GetIndexArray();
+  const PixelType *   dataArray = m_NarrowBand->GetDataArray();
+  const signed char * stateArray = m_NarrowBand->GetNodeStateArray();
+
+  const typename NarrowBandType::SizeType last = regionToProcess.last.GetPosition();
+  bool touched = m_TouchedForThread[threadId];
+  for ( typename NarrowBandType::SizeType n = regionToProcess.first.GetPosition(); n < last; ++n )
     {
-    oldvalue = image->GetPixel(it->m_Index);
-    newvalue = oldvalue + dt * it->m_Data;
+    oldvalue = image->GetPixel(indexArray[n]);
+    newvalue = oldvalue + dt * dataArray[n];
     //Check whether solution is out the inner band or not
-    m_TouchedForThread[threadId] =
-        ( m_TouchedForThread[threadId]
-          || ( !( it->m_NodeState & INNER_MASK )
-               && ( ( oldvalue > 0 ) != ( newvalue > 0 ) ) ) );
-    image->SetPixel(it->m_Index, newvalue);
+    touched = ( touched
+                || ( !( stateArray[n] & INNER_MASK )
+                     && ( ( oldvalue > 0 ) != ( newvalue > 0 ) ) ) );
+    image->SetPixel(indexArray[n], newvalue);
     }
+  m_TouchedForThread[threadId] = touched;
 }
 
 template< typename TInputImage, typename TOutputImage >
@@ -319,13 +328,17 @@ NarrowBandImageFilterBase< TInputImage, TOutputImage >
   // determine a time step for this iteration.
   globalData = df->GetGlobalDataPointer();
 
-  typename NarrowBandType::Iterator bandIt;
   NeighborhoodIteratorType outputIt( radius, output, output->GetRequestedRegion() );
 
-  for ( bandIt = regionToProcess.first; bandIt != regionToProcess.last; ++bandIt )
+  // Write the updates straight into the contiguous data array of the band.
+  const IndexType * indexArray = m_NarrowBand->GetIndexArray();
+  PixelType *       dataArray = m_NarrowBand->GetDataArray();
+
+  const typename NarrowBandType::SizeType last = regionToProcess.last.GetPosition();
+  for ( typename NarrowBandType::SizeType n = regionToProcess.first.GetPosition(); n < last; ++n )
     {
-    outputIt.SetLocation(bandIt->m_Index);
-    bandIt->m_Data = df->ComputeUpdate(outputIt, globalData);
+    outputIt.SetLocation(indexArray[n]);
+    dataArray[n] = df->ComputeUpdate(outputIt, globalData);
     }
 
   // Ask the finite difference function to compute the time step for
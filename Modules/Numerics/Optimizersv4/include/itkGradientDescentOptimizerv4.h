@@ -184,6 +184,26 @@ public:
   itkGetConstReferenceMacro(ReturnBestParametersAndValue, bool);
   itkBooleanMacro(ReturnBestParametersAndValue);
 
+  /** Flag. Set to average the metric gradient over iterations before it
+   *  is used to take a step. The average is exponential, controlled by
+   *  SetGradientAveragingDecay(), and is formed from the raw metric
+   *  gradient, before scales and the learning rate are applied.
+   *  Averaging damps the noise introduced when the metric evaluates a
+   *  different random subset of its sample points at each iteration, as
+   *  with stochastic (minibatch) sampling in the v4 image metrics, and
+   *  it steadies per-iteration learning rate estimation, which then
+   *  operates on the averaged gradient. Off by default. */
+  itkSetMacro(UseGradientAveraging, bool);
+  itkGetConstReferenceMacro(UseGradientAveraging, bool);
+  itkBooleanMacro(UseGradientAveraging);
+
+  /** Set/Get the decay of the exponential gradient average. Zero
+   *  reduces the average to the plain per-iteration gradient, while
+   *  values close to one average over many past iterations at the cost
+   *  of responding slowly to changes in the gradient. Default is 0.75. */
+  itkSetClampMacro(GradientAveragingDecay, TInternalComputationValueType, 0.0, 1.0);
+  itkGetConstReferenceMacro(GradientAveragingDecay, TInternalComputationValueType);
+
   /** Start and run the optimization. */
   void StartOptimization( bool doOnlyInitialization = false ) override;
 
@@ -202,6 +222,10 @@ protected:
    * Includes transform update. */
   virtual void AdvanceOneStep();
 
+  /** Fold the current gradient into the running exponential average and
+   * replace it by the average for this step. */
+  virtual void AverageGradient();
+
   /** Modify the gradient by scales and weights over a given index range. */
   void ModifyGradientByScalesOverSubRange( const IndexRangeType& subrange ) override;
 
@@ -227,6 +251,12 @@ protected:
 
   bool                          m_ReturnBestParametersAndValue{ false };
 
+  /** Running exponential average of the metric gradient, used when
+   * gradient averaging is enabled. */
+  bool                          m_UseGradientAveraging{ false };
+  TInternalComputationValueType m_GradientAveragingDecay;
+  DerivativeType                m_AveragedGradient;
+
   /** Store the previous gradient value at each iteration,
    * so we can detect the changes in gradient direction.
    * This is needed by the regular step gradient descent and
@@ -29,7 +29,8 @@ GradientDescentOptimizerv4Template<TInternalComputationValueType>
   m_LearningRate( NumericTraits<TInternalComputationValueType>::OneValue() ),
   m_MinimumConvergenceValue( 1e-8 ),
   m_ConvergenceValue( NumericTraits<TInternalComputationValueType>::max() ),
-  m_CurrentBestValue( NumericTraits<MeasureType>::max() )
+  m_CurrentBestValue( NumericTraits<MeasureType>::max() ),
+  m_GradientAveragingDecay( 0.75 )
 
 {
   this->m_PreviousGradient.Fill( NumericTraits<TInternalComputationValueType>::ZeroValue() );
@@ -56,6 +57,10 @@ GradientDescentOptimizerv4Template<TInternalComputationValueType>
   this->m_CurrentIteration = 0;
   this->m_ConvergenceValue = NumericTraits<TInternalComputationValueType>::max();
 
+  // Restart the gradient average. AverageGradient re-seeds it from the
+  // first gradient of this run when the sizes differ.
+  this->m_AveragedGradient.SetSize( 0 );
+
   if( ! doOnlyInitialization )
     {
     this->ResumeOptimization();
@@ -145,6 +150,14 @@ GradientDescentOptimizerv4Template<TInternalComputationValueType>
         }
       }
 
+    // Replace the gradient by its running average when enabled. This
+    // acts on the raw metric gradient, before scales and the learning
+    // rate are applied below.
+    if ( this->m_UseGradientAveraging )
+      {
+      this->AverageGradient();
+      }
+
     // Advance one step along the gradient.
     // This will modify the gradient and update the transform.
     this->AdvanceOneStep();
@@ -196,6 +209,30 @@ GradientDescentOptimizerv4Template<TInternalComputationValueType>
   this->InvokeEvent( IterationEvent() );
 }
 
+template<typename TInternalComputationValueType>
+void
+GradientDescentOptimizerv4Template<TInternalComputationValueType>
+::AverageGradient()
+{
+  if ( this->m_AveragedGradient.GetSize() != this->m_Gradient.GetSize() )
+    {
+    // First iteration of a run, or the number of parameters changed:
+    // start the average from the current gradient.
+    this->m_AveragedGradient = this->m_Gradient;
+    return;
+    }
+
+  const TInternalComputationValueType decay = this->m_GradientAveragingDecay;
+  const TInternalComputationValueType update =
+    NumericTraits<TInternalComputationValueType>::OneValue() - decay;
+
+  for ( SizeValueType j = 0; j < this->m_Gradient.GetSize(); j++ )
+    {
+    this->m_AveragedGradient[j] = decay * this->m_AveragedGradient[j] + update * this->m_Gradient[j];
+    this->m_Gradient[j] = this->m_AveragedGradient[j];
+    }
+}
+
 template<typename TInternalComputationValueType>
 void
 GradientDescentOptimizerv4Template<TInternalComputationValueType>
@@ -294,6 +331,11 @@ GradientDescentOptimizerv4Template<TInternalComputationValueType>
     << std::endl;
   os << indent << "ReturnBestParametersAndValue: "
     << ( this->m_ReturnBestParametersAndValue ? "On" : "Off" ) << std::endl;
+  os << indent << "UseGradientAveraging: "
+    << ( this->m_UseGradientAveraging ? "On" : "Off" ) << std::endl;
+  os << indent << "GradientAveragingDecay: "
+    << static_cast< typename NumericTraits< TInternalComputationValueType >::PrintType >( this->m_GradientAveragingDecay )
+    << std::endl;
   os << indent << "PreviousGradient: "
     << static_cast< typename NumericTraits< DerivativeType >::PrintType >( this->m_PreviousGradient )
     << std::endl;
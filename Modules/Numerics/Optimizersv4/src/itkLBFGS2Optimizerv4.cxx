@@ -156,10 +156,17 @@ LBFGS2Optimizerv4::EvaluateCost( const LBFGS2Optimizerv4::PrecisionType *x,
                                  const LBFGS2Optimizerv4::PrecisionType
                                )
 {
-  ParametersType xItk(n);
-  std::memcpy(xItk.data_block(), x, n * sizeof(LBFGS2Optimizerv4::PrecisionType) );
-
-  DerivativeType gItk(n);
+  // The line search evaluates the metric at several trial points per
+  // iteration. The parameter and gradient blocks owned by liblbfgs are
+  // aliased into the ITK arrays instead of being copied, so a trial
+  // evaluation does not allocate or copy the full parameter vector; for
+  // B-spline sized problems those copies were a measurable part of every
+  // line search trial. The metric copies the parameters it is handed, so
+  // the liblbfgs block is not modified through the alias.
+  ParametersType xItk;
+  xItk.SetData(const_cast<LBFGS2Optimizerv4::PrecisionType *>(x), n, false);
+
+  DerivativeType gItk;
   gItk.SetData(g, n, false);
 
   MeasureType value;
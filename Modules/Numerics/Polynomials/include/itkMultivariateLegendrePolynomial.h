@@ -149,20 +149,37 @@ public:
   const CoefficientArrayType & GetCoefficients() const;
 
   /** In the case which the bias field is 2D, it returns bias value at
-   * the point which is specified by the index */
+   * the point which is specified by the index.
+   *
+   * For indexes inside the domain the per-axis Legendre basis values
+   * come from tables precomputed at construction, so evaluating a new
+   * coefficient set only costs the contraction against the cached
+   * tables. Indexes outside the domain fall back to the recurrence. */
   double Evaluate(IndexType & index)
   {
     if ( m_Dimension == 2 )
       {
       if ( index[1] != m_PrevY )
         {
-        // normalized y [-1, 1]
-        double norm_y =  m_NormFactor[1]
-                        * static_cast< double >( index[1] - 1 );
-        this->CalculateXCoef(norm_y, m_CoefficientArray);
+        if ( this->InsideDomain(1, index[1]) )
+          {
+          this->CalculateXCoefFromBasis(index[1], m_CoefficientArray);
+          }
+        else
+          {
+          // normalized y [-1, 1]
+          double norm_y =  m_NormFactor[1]
+                          * static_cast< double >( index[1] - 1 );
+          this->CalculateXCoef(norm_y, m_CoefficientArray);
+          }
         m_PrevY = index[1];
         }
 
+      if ( this->InsideDomain(0, index[0]) )
+        {
+        return this->ContractXBasis(index[0]);
+        }
+
       // normalized x [-1, 1]
       double norm_x =  m_NormFactor[0]
                       * static_cast< double >( index[0] - 1 );
@@ -173,22 +190,41 @@ public:
       {
       if ( index[2] != m_PrevZ )
         {
-        // normalized z [-1, 1]
-        double norm_z =  m_NormFactor[2]
-                        * static_cast< double >( index[2] - 1 );
-        this->CalculateYCoef(norm_z, m_CoefficientArray);
+        if ( this->InsideDomain(2, index[2]) )
+          {
+          this->CalculateYCoefFromBasis(index[2], m_CoefficientArray);
+          }
+        else
+          {
+          // normalized z [-1, 1]
+          double norm_z =  m_NormFactor[2]
+                          * static_cast< double >( index[2] - 1 );
+          this->CalculateYCoef(norm_z, m_CoefficientArray);
+          }
         m_PrevZ = index[2];
         }
 
       if ( index[1] != m_PrevY )
         {
-        // normalized y [-1, 1]
-        double norm_y =  m_NormFactor[1]
-                        * static_cast< double >( index[1] - 1 );
-        this->CalculateXCoef(norm_y, m_CachedYCoef);
+        if ( this->InsideDomain(1, index[1]) )
+          {
+          this->CalculateXCoefFromBasis(index[1], m_CachedYCoef);
+          }
+        else
+          {
+          // normalized y [-1, 1]
+          double norm_y =  m_NormFactor[1]
+                          * static_cast< double >( index[1] - 1 );
+          this->CalculateXCoef(norm_y, m_CachedYCoef);
+          }
         m_PrevY = index[1];
         }
 
+      if ( this->InsideDomain(0, index[0]) )
+        {
+        return this->ContractXBasis(index[0]);
+        }
+
       // normalized x [-1, 1]
       double norm_x =  m_NormFactor[0]
                       * static_cast< double >( index[0] - 1 );
@@ -284,6 +320,27 @@ protected:
   void CalculateYCoef(double norm_z, const CoefficientArrayType & coef);
 
 private:
+  /** Fill the per-axis basis tables with the Legendre polynomial values
+   * at every coordinate of the domain. */
+  void BuildBasisTables();
+
+  /** True when a basis table row exists for the coordinate along the
+   * given dimension. */
+  bool InsideDomain(unsigned int dimension, IndexValueType coordinate) const
+  {
+    return coordinate >= 0
+           && static_cast< unsigned long >( coordinate ) < m_DomainSize[dimension];
+  }
+
+  /** Contract the cached x coefficients against the cached x basis row. */
+  double ContractXBasis(IndexValueType x) const;
+
+  /** Compute m_CachedXCoef from the cached basis row of the y axis. */
+  void CalculateXCoefFromBasis(IndexValueType y, const CoefficientArrayType & coef);
+
+  /** Compute m_CachedYCoef from the cached basis row of the z axis. */
+  void CalculateYCoefFromBasis(IndexValueType z, const CoefficientArrayType & coef);
+
   DomainSizeType m_DomainSize;
   unsigned int   m_Dimension;
   unsigned int   m_Degree;
@@ -294,6 +351,13 @@ private:
   CoefficientArrayType m_CachedYCoef;
   CoefficientArrayType m_CachedZCoef;
 
+  /** Per-axis Legendre basis tables. m_CachedBasis[dim] holds
+   * P_0 .. P_Degree evaluated at every coordinate of the axis, in
+   * coordinate-major order. The tables depend only on the domain size
+   * and the degree, never on the coefficients, so they are built once
+   * at construction. */
+  std::vector< DoubleArrayType > m_CachedBasis;
+
   DoubleArrayType m_NormFactor;
   IndexValueType  m_PrevY;
   IndexValueType  m_PrevZ;
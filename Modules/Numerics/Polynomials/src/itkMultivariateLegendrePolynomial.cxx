@@ -56,6 +56,8 @@ MultivariateLegendrePolynomial
     m_NormFactor[j] = 2.0f
                       / ( static_cast< double >( m_DomainSize[j] ) - 1.0f );
     }
+
+  this->BuildBasisTables();
 }
 
 MultivariateLegendrePolynomial
@@ -212,6 +214,103 @@ void MultivariateLegendrePolynomial
     }
 }
 
+void MultivariateLegendrePolynomial
+::BuildBasisTables()
+{
+  // table[n * (degree + 1) + k] = P_k at the n-th coordinate, using the
+  // same normalization as Evaluate. The values depend only on the
+  // coordinate, so every later evaluation reads them back instead of
+  // running the recurrence.
+  m_CachedBasis.resize(m_Dimension);
+  for ( unsigned int dim = 0; dim < m_Dimension; dim++ )
+    {
+    DoubleArrayType & table = m_CachedBasis[dim];
+    table.resize( m_DomainSize[dim] * ( m_Degree + 1 ) );
+    for ( unsigned long n = 0; n < m_DomainSize[dim]; n++ )
+      {
+      const double x = m_NormFactor[dim] * ( static_cast< double >( n ) - 1.0 );
+
+      double *basis = &table[n * ( m_Degree + 1 )];
+      basis[0] = 1.0;
+      if ( m_Degree > 0 )
+        {
+        basis[1] = x;
+        }
+      // k P_k = (2k - 1) x P_(k-1) - (k - 1) P_(k-2)
+      for ( unsigned int k = 2; k <= m_Degree; k++ )
+        {
+        basis[k] = ( x * basis[k - 1] * ( 2 * k - 1 )
+                     - basis[k - 2] * ( k - 1 ) ) / k;
+        }
+      }
+    }
+}
+
+double MultivariateLegendrePolynomial
+::ContractXBasis(IndexValueType x) const
+{
+  const double *basis =
+    &m_CachedBasis[0][static_cast< size_t >( x ) * ( m_Degree + 1 )];
+
+  double sum = 0.0;
+  for ( unsigned int lx = 0; lx <= m_Degree; lx++ )
+    {
+    sum += m_CachedXCoef[lx] * basis[lx];
+    }
+  return sum;
+}
+
+void MultivariateLegendrePolynomial
+::CalculateXCoefFromBasis(IndexValueType y, const CoefficientArrayType & coef)
+{
+  // compute x_coef[i] = sum (0 <= j <= m-i) pij * P(y)]
+  const double *basis =
+    &m_CachedBasis[1][static_cast< size_t >( y ) * ( m_Degree + 1 )];
+
+  int offset = 0;
+  for ( unsigned int lx = 0; lx <= m_Degree; lx++ )
+    {
+    double sum = 0.0;
+    for ( unsigned int ly = 0; ly <= m_Degree - lx; ly++ )
+      {
+      sum += coef[offset + ly] * basis[ly];
+      }
+    m_CachedXCoef[lx] = sum;
+
+    offset += ( m_Degree + 1 - lx );
+    }
+}
+
+void MultivariateLegendrePolynomial
+::CalculateYCoefFromBasis(IndexValueType z, const CoefficientArrayType & coef)
+{
+  // compute y_coef[i,j] = sum (0 <= k <= m-i-j) pijk * P(z)
+  const double *basis =
+    &m_CachedBasis[2][static_cast< size_t >( z ) * ( m_Degree + 1 )];
+
+  unsigned int       y_index = 0;
+  unsigned int       c_index  = 0;
+  const unsigned int lxmax = m_Degree;
+
+  for ( unsigned int lx = 0; lx <= lxmax; lx++ )
+    {
+    const unsigned int lymax = m_Degree - lx;
+    for ( unsigned int ly = 0; ly <= lymax; ly++, c_index++ )
+      {
+      unsigned int z_index = c_index;
+      unsigned int lzmax  = m_Degree - lx - ly;
+      double       sum = 0.0;
+      for ( unsigned int lz = 0; lz <= lzmax; lz++ )
+        {
+        sum += coef[z_index] * basis[lz];
+        z_index += ( ( m_Degree + 1 - lz ) * ( m_Degree + 2 - lz ) / 2 ) - lx;
+        }
+      m_CachedYCoef[y_index] = sum;
+      ++y_index;
+      }
+    }
+}
+
 double MultivariateLegendrePolynomial
 ::LegendreSum(const double x, int n, const CoefficientArrayType & coef,
               int offset)
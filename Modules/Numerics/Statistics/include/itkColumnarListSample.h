@@ -0,0 +1,320 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkColumnarListSample_h
+#define itkColumnarListSample_h
+
+#include "itkObjectFactory.h"
+#include "itkMeasurementVectorTraits.h"
+#include "itkSample.h"
+
+#include <vector>
+
+namespace itk
+{
+namespace Statistics
+{
+/** \class ColumnarListSample
+ *  \brief A Sample that stores each measurement vector component in its
+ *         own contiguous array.
+ *
+ * ColumnarListSample offers the same interface as ListSample, but keeps
+ * the measurements in column major (structure-of-arrays) form: component
+ * d of all measurement vectors occupies one contiguous array, available
+ * through GetComponentArray().  Statistics algorithms that sweep over
+ * whole components at a time, such as the mean and covariance sample
+ * filters, then read memory sequentially and their accumulation loops
+ * can be vectorized by the compiler.  Algorithms written against the
+ * generic Sample interface keep working: GetMeasurementVector() gathers
+ * the components of the requested measurement into an internal vector.
+ * Per-vector access is therefore more expensive than with ListSample,
+ * which is the price of the columnar layout.
+ *
+ * The measurement vector size must be set before inserting measurements,
+ * either explicitly with SetMeasurementVectorSize() or implicitly through
+ * a fixed size measurement vector type.
+ *
+ * \sa Sample, ListSample
+ * \ingroup ITKStatistics
+ */
+
+template< typename TMeasurementVector >
+class ITK_TEMPLATE_EXPORT ColumnarListSample:public Sample< TMeasurementVector >
+{
+public:
+  ITK_DISALLOW_COPY_AND_ASSIGN(ColumnarListSample);
+
+  /** Standard class type alias. */
+  using Self = ColumnarListSample;
+  using Superclass = Sample< TMeasurementVector >;
+  using Pointer = SmartPointer< Self >;
+  using ConstPointer = SmartPointer< const Self >;
+
+  /** Standard macros */
+  itkTypeMacro(ColumnarListSample, Sample);
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Typedefs inherited from the superclass */
+  using MeasurementVectorType = typename Superclass::MeasurementVectorType;
+  using MeasurementVectorSizeType = typename Superclass::MeasurementVectorSizeType;
+  using MeasurementType = typename Superclass::MeasurementType;
+  using AbsoluteFrequencyType = typename Superclass::AbsoluteFrequencyType;
+  using TotalAbsoluteFrequencyType = typename Superclass::TotalAbsoluteFrequencyType;
+  using InstanceIdentifier = typename Superclass::InstanceIdentifier;
+
+  /** Value type of a measurement (component of the measurement
+   * vector) */
+  using ValueType = MeasurementVectorType;
+
+  /** One column: the values of one component for all measurements. */
+  using ColumnType = std::vector< MeasurementType >;
+
+  /** internal data container type */
+  using InternalDataContainerType = std::vector< ColumnType >;
+
+  /** Set the length of the measurement vectors.  Allocates one column
+   * per component; only allowed while the sample is empty. */
+  void SetMeasurementVectorSize(MeasurementVectorSizeType s) override;
+
+  /** Resize the container. Using Resize() and then SetMeasurementVector() is
+   * much faster than using PushBack() continuously. Whenever the total
+   * number of measurement vectors is known the users should prefer calling
+   * Resize() first and then set the values by calling
+   * SetMeasurementVector(). */
+  void Resize(InstanceIdentifier newsize);
+
+  /** Removes all the elements in the Sample */
+  void Clear();
+
+  /** Inserts a measurement at the end of the list */
+  void PushBack(const MeasurementVectorType & mv);
+
+  /** Get the number of measurement vectors in the sample */
+  InstanceIdentifier Size() const override;
+
+  /** Get the measurement associated with the specified
+   * InstanceIdentifier.  The components are gathered from the columns
+   * into an internal vector, so the returned reference is only valid
+   * until the next call to this method on the same sample. */
+  const MeasurementVectorType & GetMeasurementVector(InstanceIdentifier id) const override;
+
+  /** Set a component a measurement to a particular value. */
+  void SetMeasurement(InstanceIdentifier id,
+                      unsigned int dim,
+                      const MeasurementType & value);
+
+  /** Replace a measurement with a different measurement */
+  void SetMeasurementVector(InstanceIdentifier id,
+                            const MeasurementVectorType & mv);
+
+  /** Get the frequency of a measurement. Returns 1 if the measurement
+   * exist. */
+  AbsoluteFrequencyType GetFrequency(InstanceIdentifier id) const override;
+
+  /** Get the total frequency of the sample.  This is equivalent to
+   * the size of the sample. */
+  TotalAbsoluteFrequencyType GetTotalFrequency() const override;
+
+  /** Direct access to the contiguous array holding component \c dim of
+   * all measurement vectors. */
+  MeasurementType * GetComponentArray(unsigned int dim)
+  {
+    return m_InternalContainer[dim].data();
+  }
+
+  const MeasurementType * GetComponentArray(unsigned int dim) const
+  {
+    return m_InternalContainer[dim].data();
+  }
+
+  /** Method to graft another sample */
+  void Graft(const DataObject *thatObject) override;
+
+  /** \class ConstIterator
+   * \brief Const Iterator
+   * \ingroup ITKStatistics
+   */
+  class ConstIterator
+  {
+    friend class ColumnarListSample;
+
+public:
+
+    ConstIterator(const ColumnarListSample *sample)
+    {
+      *this = sample->Begin();
+    }
+
+    ConstIterator(const ConstIterator & iter)
+    {
+      m_Sample = iter.m_Sample;
+      m_InstanceIdentifier = iter.m_InstanceIdentifier;
+    }
+
+    ConstIterator & operator=(const ConstIterator & iter)
+    {
+      m_Sample = iter.m_Sample;
+      m_InstanceIdentifier = iter.m_InstanceIdentifier;
+      return *this;
+    }
+
+    AbsoluteFrequencyType GetFrequency() const
+    {
+      return 1;
+    }
+
+    const MeasurementVectorType & GetMeasurementVector() const
+    {
+      m_Sample->AssembleMeasurementVector(m_InstanceIdentifier, this->m_MeasurementVectorCache);
+      return this->m_MeasurementVectorCache;
+    }
+
+    InstanceIdentifier GetInstanceIdentifier() const
+    {
+      return m_InstanceIdentifier;
+    }
+
+    ConstIterator & operator++()
+    {
+      ++m_InstanceIdentifier;
+      return *this;
+    }
+
+    bool operator!=(const ConstIterator & it)
+    {
+      return ( m_InstanceIdentifier != it.m_InstanceIdentifier );
+    }
+
+    bool operator==(const ConstIterator & it)
+    {
+      return ( m_InstanceIdentifier == it.m_InstanceIdentifier );
+    }
+
+protected:
+    // This method should only be available to the ColumnarListSample class
+    ConstIterator(const ColumnarListSample *sample, InstanceIdentifier iid)
+    {
+      m_Sample = sample;
+      m_InstanceIdentifier = iid;
+    }
+
+private:
+    ConstIterator() = delete;
+
+    const ColumnarListSample *    m_Sample;
+    InstanceIdentifier            m_InstanceIdentifier;
+    mutable MeasurementVectorType m_MeasurementVectorCache;
+  };
+
+  /** \class Iterator
+   * \brief Iterator
+   * \ingroup ITKStatistics
+   */
+  class Iterator:public ConstIterator
+  {
+    friend class ColumnarListSample;
+
+public:
+
+    Iterator(Self *sample):ConstIterator(sample)
+    {}
+
+    Iterator(const Iterator & iter):ConstIterator(iter)
+    {}
+
+    Iterator & operator=(const Iterator & iter)
+    {
+      this->ConstIterator::operator=(iter);
+      return *this;
+    }
+
+protected:
+
+    Iterator(Self *sample, InstanceIdentifier iid):ConstIterator(sample, iid)
+    {}
+
+private:
+    // To ensure const-correctness these method must not be in the public API.
+    // The are purposly not implemented, since they should never be called.
+    Iterator() = delete;
+    Iterator(const Self *sample) = delete;
+    Iterator(const Self *sample, InstanceIdentifier iid) = delete;
+    Iterator(const ConstIterator & it) = delete;
+    ConstIterator & operator=(const ConstIterator & it) = delete;
+  };
+
+  /** returns an iterator that points to the beginning of the container */
+  Iterator Begin()
+  {
+    Iterator iter(this, 0);
+
+    return iter;
+  }
+
+  /** returns an iterator that points to the end of the container */
+  Iterator End()
+  {
+    Iterator iter( this, this->Size() );
+
+    return iter;
+  }
+
+  /** returns an iterator that points to the beginning of the container */
+  ConstIterator Begin() const
+  {
+    ConstIterator iter(this, 0);
+
+    return iter;
+  }
+
+  /** returns an iterator that points to the end of the container */
+  ConstIterator End() const
+  {
+    ConstIterator iter( this, this->Size() );
+
+    return iter;
+  }
+
+protected:
+
+  ColumnarListSample();
+  ~ColumnarListSample() override = default;
+  void PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  /** Gather the components of one measurement from the columns. */
+  void AssembleMeasurementVector(InstanceIdentifier id, MeasurementVectorType & mv) const;
+
+  /** One column per measurement vector component. */
+  InternalDataContainerType m_InternalContainer;
+
+  /** Number of measurements stored in each column. */
+  InstanceIdentifier m_Size{ 0 };
+
+  /** Scratch vector handed out by GetMeasurementVector(). */
+  mutable MeasurementVectorType m_MeasurementVectorInternal;
+};
+} // end of namespace Statistics
+} // end of namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#include "itkColumnarListSample.hxx"
+#endif
+
+#endif
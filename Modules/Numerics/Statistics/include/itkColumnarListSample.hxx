@@ -0,0 +1,210 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkColumnarListSample_hxx
+#define itkColumnarListSample_hxx
+
+#include "itkColumnarListSample.h"
+
+namespace itk
+{
+namespace Statistics
+{
+template< typename TMeasurementVector >
+ColumnarListSample< TMeasurementVector >
+::ColumnarListSample() = default;
+
+template< typename TMeasurementVector >
+void
+ColumnarListSample< TMeasurementVector >
+::SetMeasurementVectorSize(MeasurementVectorSizeType s)
+{
+  this->Superclass::SetMeasurementVectorSize(s);
+  this->m_InternalContainer.resize( this->GetMeasurementVectorSize() );
+}
+
+template< typename TMeasurementVector >
+void
+ColumnarListSample< TMeasurementVector >
+::Resize(InstanceIdentifier newsize)
+{
+  // For fixed size measurement vector types the columns are allocated
+  // here, since SetMeasurementVectorSize() need not have been called.
+  this->m_InternalContainer.resize( this->GetMeasurementVectorSize() );
+  for ( auto & column : this->m_InternalContainer )
+    {
+    column.resize(newsize);
+    }
+  this->m_Size = newsize;
+}
+
+template< typename TMeasurementVector >
+void
+ColumnarListSample< TMeasurementVector >
+::Clear()
+{
+  for ( auto & column : this->m_InternalContainer )
+    {
+    column.clear();
+    }
+  this->m_Size = 0;
+}
+
+template< typename TMeasurementVector >
+void
+ColumnarListSample< TMeasurementVector >
+::PushBack(const MeasurementVectorType & mv)
+{
+  const MeasurementVectorSizeType measurementVectorSize = this->GetMeasurementVectorSize();
+
+  if ( measurementVectorSize != NumericTraits<MeasurementVectorType>::GetLength(mv) )
+    {
+    itkExceptionMacro("MeasurementVectorSize: " << measurementVectorSize
+      << " doesn't match input measurement vector length: " << NumericTraits<MeasurementVectorType>::GetLength(mv));
+    }
+  if ( this->m_InternalContainer.size() != measurementVectorSize )
+    {
+    this->m_InternalContainer.resize(measurementVectorSize);
+    }
+  for ( unsigned int dim = 0; dim < measurementVectorSize; ++dim )
+    {
+    this->m_InternalContainer[dim].push_back(mv[dim]);
+    }
+  ++this->m_Size;
+}
+
+template< typename TMeasurementVector >
+typename ColumnarListSample< TMeasurementVector >::InstanceIdentifier
+ColumnarListSample< TMeasurementVector >
+::Size() const
+{
+  return this->m_Size;
+}
+
+template< typename TMeasurementVector >
+typename ColumnarListSample< TMeasurementVector >::TotalAbsoluteFrequencyType
+ColumnarListSample< TMeasurementVector >
+::GetTotalFrequency() const
+{
+  // Since the entries are unique, the total
+  // frequency is equal to the number of entries.
+  return this->Size();
+}
+
+template< typename TMeasurementVector >
+void
+ColumnarListSample< TMeasurementVector >
+::AssembleMeasurementVector(InstanceIdentifier instanceId, MeasurementVectorType & mv) const
+{
+  const MeasurementVectorSizeType measurementVectorSize = this->GetMeasurementVectorSize();
+
+  NumericTraits<MeasurementVectorType>::SetLength(mv, measurementVectorSize);
+  for ( unsigned int dim = 0; dim < measurementVectorSize; ++dim )
+    {
+    mv[dim] = this->m_InternalContainer[dim][instanceId];
+    }
+}
+
+template< typename TMeasurementVector >
+const typename ColumnarListSample< TMeasurementVector >::MeasurementVectorType &
+ColumnarListSample< TMeasurementVector >
+::GetMeasurementVector(InstanceIdentifier instanceId) const
+{
+  if ( instanceId < this->m_Size )
+    {
+    this->AssembleMeasurementVector(instanceId, this->m_MeasurementVectorInternal);
+    return this->m_MeasurementVectorInternal;
+    }
+  itkExceptionMacro("MeasurementVector " << instanceId << " does not exist");
+}
+
+template< typename TMeasurementVector >
+void
+ColumnarListSample< TMeasurementVector >
+::SetMeasurement(InstanceIdentifier instanceId,
+                 unsigned int dim,
+                 const MeasurementType & value)
+{
+  if ( instanceId < this->m_Size )
+    {
+    this->m_InternalContainer[dim][instanceId] = value;
+    }
+}
+
+template< typename TMeasurementVector >
+void
+ColumnarListSample< TMeasurementVector >
+::SetMeasurementVector(InstanceIdentifier instanceId,
+                       const MeasurementVectorType & mv)
+{
+  if ( instanceId < this->m_Size )
+    {
+    const MeasurementVectorSizeType measurementVectorSize = this->GetMeasurementVectorSize();
+    for ( unsigned int dim = 0; dim < measurementVectorSize; ++dim )
+      {
+      this->m_InternalContainer[dim][instanceId] = mv[dim];
+      }
+    }
+}
+
+template< typename TMeasurementVector >
+typename ColumnarListSample< TMeasurementVector >::AbsoluteFrequencyType
+ColumnarListSample< TMeasurementVector >
+::GetFrequency(InstanceIdentifier instanceId) const
+{
+  if ( instanceId < this->m_Size )
+    {
+    return 1;
+    }
+  else
+    {
+    return 0;
+    }
+}
+
+template< typename TMeasurementVector >
+void
+ColumnarListSample< TMeasurementVector >
+::Graft(const DataObject *thatObject)
+{
+  this->Superclass::Graft(thatObject);
+
+  const auto * thatConst = dynamic_cast< const Self * >( thatObject );
+  if ( thatConst )
+    {
+    auto * that = const_cast< Self * >( thatConst );
+    this->m_InternalContainer = that->m_InternalContainer;
+    this->m_Size = that->m_Size;
+    }
+}
+
+template< typename TMeasurementVector >
+void
+ColumnarListSample< TMeasurementVector >
+::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  os << indent << "Internal Data Container: "
+     << &m_InternalContainer << std::endl;
+  os << indent << "Number of samples: "
+     << this->m_Size << std::endl;
+}
+} // end of namespace Statistics
+} // end of namespace itk
+
+#endif
@@ -19,7 +19,11 @@
 #define itkCovarianceSampleFilter_hxx
 
 #include "itkCovarianceSampleFilter.h"
-#include "itkMeanSampleFilter.h"
+
+#include <algorithm>
+#include <vector>
+#include "itkColumnarListSample.h"
+#include "itkMultiThreaderBase.h"
 
 namespace itk
 {
@@ -139,58 +143,227 @@ CovarianceSampleFilter< TSample >
   auto * decoratedMeanOutput = itkDynamicCastInDebugMode< MeasurementVectorDecoratedType * >(
                                  this->ProcessObject::GetOutput(1) );
 
-  // calculate mean
-  using MeanFilterType = MeanSampleFilter< SampleType >;
-  typename MeanFilterType::Pointer meanFilter = MeanFilterType::New();
-
-  meanFilter->SetInput( input );
-  meanFilter->Update();
+  // One-pass covariance algorithm: every chunk of the sample is reduced
+  // to its weight, mean and centered comoment matrix, and the chunk
+  // moments are combined in chunk order with Chan's pairwise update.
+  // The mean and the covariance therefore come out of a single sweep
+  // over the sample, the chunks can be processed in parallel, and the
+  // fixed chunk boundaries keep the result independent of the number of
+  // work units.
+  const SizeValueType size = input->Size();
+
+  // number of distinct entries of the symmetric comoment matrix
+  const unsigned int comomentSize = ( measurementVectorSize * ( measurementVectorSize + 1 ) ) / 2;
+
+  constexpr SizeValueType chunkSize = 65536;
+  const SizeValueType     numberOfChunks = ( size + chunkSize - 1 ) / chunkSize;
+
+  std::vector< MeasurementRealType > chunkWeights( numberOfChunks,
+    NumericTraits< MeasurementRealType >::ZeroValue() );
+  std::vector< MeasurementRealType > chunkMeans( numberOfChunks * measurementVectorSize,
+    NumericTraits< MeasurementRealType >::ZeroValue() );
+  std::vector< MeasurementRealType > chunkComoments( numberOfChunks * comomentSize,
+    NumericTraits< MeasurementRealType >::ZeroValue() );
+
+  // Columnar samples expose each component as one contiguous array, so a
+  // chunk is reduced with sequential sweeps over the columns. Other
+  // samples are traversed through per-chunk iterator copies (the list
+  // sample adaptors cache the gathered measurement vector in a single
+  // mutable member, so index based access from several threads would
+  // race) and reduced with weighted Welford updates.
+  using ColumnarSampleType = ColumnarListSample< MeasurementVectorType >;
+  const auto * columnarInput = dynamic_cast< const ColumnarSampleType * >( input );
+
+  if ( columnarInput != nullptr )
+    {
+    this->GetMultiThreader()->ParallelizeArray( 0, numberOfChunks,
+      [columnarInput, &chunkWeights, &chunkMeans, &chunkComoments, size, measurementVectorSize]
+      ( SizeValueType chunk )
+        {
+        const SizeValueType first = chunk * chunkSize;
+        const SizeValueType last = std::min( size, ( chunk + 1 ) * chunkSize );
+        const auto          count = static_cast< MeasurementRealType >( last - first );
+
+        MeasurementRealType *const chunkMean = &chunkMeans[chunk * measurementVectorSize];
+        MeasurementRealType *const chunkComoment =
+          &chunkComoments[chunk * ( ( measurementVectorSize * ( measurementVectorSize + 1 ) ) / 2 )];
+
+        for ( unsigned int dim = 0; dim < measurementVectorSize; ++dim )
+          {
+          const typename ColumnarSampleType::MeasurementType *const column =
+            columnarInput->GetComponentArray(dim);
+
+          MeasurementRealType sum = NumericTraits< MeasurementRealType >::ZeroValue();
+          for ( SizeValueType i = first; i < last; ++i )
+            {
+            sum += static_cast< MeasurementRealType >( column[i] );
+            }
+          chunkMean[dim] = sum / count;
+          }
+
+        unsigned int entry = 0;
+        for ( unsigned int row = 0; row < measurementVectorSize; ++row )
+          {
+          const typename ColumnarSampleType::MeasurementType *const rowColumn =
+            columnarInput->GetComponentArray(row);
+          const MeasurementRealType rowMean = chunkMean[row];
+
+          for ( unsigned int col = 0; col < row + 1; ++col )
+            {
+            const typename ColumnarSampleType::MeasurementType *const colColumn =
+              columnarInput->GetComponentArray(col);
+            const MeasurementRealType colMean = chunkMean[col];
+
+            MeasurementRealType sum = NumericTraits< MeasurementRealType >::ZeroValue();
+            for ( SizeValueType i = first; i < last; ++i )
+              {
+              sum += ( static_cast< MeasurementRealType >( rowColumn[i] ) - rowMean )
+                     * ( static_cast< MeasurementRealType >( colColumn[i] ) - colMean );
+              }
+            chunkComoment[entry] = sum;
+            ++entry;
+            }
+          }
+
+        chunkWeights[chunk] = count;
+        },
+      this );
+    }
+  else
+    {
+    std::vector< typename SampleType::ConstIterator > chunkFirst;
+    chunkFirst.reserve( numberOfChunks );
 
-  const typename MeanFilterType::MeasurementVectorRealType mean = meanFilter->GetMean();
-  decoratedMeanOutput->Set( mean );
+    typename SampleType::ConstIterator positionIter = input->Begin();
+    for ( SizeValueType i = 0; i < size; ++i, ++positionIter )
+      {
+      if ( i % chunkSize == 0 )
+        {
+        chunkFirst.push_back( positionIter );
+        }
+      }
 
-  // covariance algorithm
-  MeasurementVectorRealType diff;
-  NumericTraits<MeasurementVectorRealType>::SetLength( diff, measurementVectorSize );
+    this->GetMultiThreader()->ParallelizeArray( 0, numberOfChunks,
+      [&chunkFirst, &chunkWeights, &chunkMeans, &chunkComoments, size, measurementVectorSize]
+      ( SizeValueType chunk )
+        {
+        typename SampleType::ConstIterator iter = chunkFirst[chunk];
+
+        MeasurementRealType        chunkWeight = NumericTraits< MeasurementRealType >::ZeroValue();
+        MeasurementRealType *const chunkMean = &chunkMeans[chunk * measurementVectorSize];
+        MeasurementRealType *const chunkComoment =
+          &chunkComoments[chunk * ( ( measurementVectorSize * ( measurementVectorSize + 1 ) ) / 2 )];
+
+        std::vector< MeasurementRealType > diff( measurementVectorSize );
+        std::vector< MeasurementRealType > residual( measurementVectorSize );
+
+        const SizeValueType last = std::min( size, ( chunk + 1 ) * chunkSize );
+        for ( SizeValueType sampleVectorIndex = chunk * chunkSize;
+              sampleVectorIndex < last;
+              ++sampleVectorIndex, ++iter )
+          {
+          const MeasurementVectorType & measurement = iter.GetMeasurementVector();
+
+          const auto frequency = static_cast< MeasurementRealType >( iter.GetFrequency() );
+          if ( frequency == NumericTraits< MeasurementRealType >::ZeroValue() )
+            {
+            continue;
+            }
+          chunkWeight += frequency;
+
+          const MeasurementRealType ratio = frequency / chunkWeight;
+          for ( unsigned int dim = 0; dim < measurementVectorSize; ++dim )
+            {
+            const auto component = static_cast< MeasurementRealType >( measurement[dim] );
+
+            diff[dim] = ( component - chunkMean[dim] );
+            chunkMean[dim] += ( ratio * diff[dim] );
+            residual[dim] = ( component - chunkMean[dim] );
+            }
+
+          unsigned int entry = 0;
+          for ( unsigned int row = 0; row < measurementVectorSize; ++row )
+            {
+            for ( unsigned int col = 0; col < row + 1; ++col )
+              {
+              chunkComoment[entry] += ( frequency * diff[row] * residual[col] );
+              ++entry;
+              }
+            }
+          }
+
+        chunkWeights[chunk] = chunkWeight;
+        },
+      this );
+    }
 
-  using TotalFrequencyType = typename SampleType::TotalAbsoluteFrequencyType;
-  TotalFrequencyType totalFrequency = NumericTraits< TotalFrequencyType >::ZeroValue();
+  // combine the chunk moments in chunk order with Chan's pairwise update
+  MeasurementRealType totalFrequency = NumericTraits< MeasurementRealType >::ZeroValue();
 
-  typename SampleType::ConstIterator iter =      input->Begin();
-  const typename SampleType::ConstIterator end = input->End();
+  std::vector< MeasurementRealType > mergedMean( measurementVectorSize,
+    NumericTraits< MeasurementRealType >::ZeroValue() );
+  std::vector< MeasurementRealType > mergedComoment( comomentSize,
+    NumericTraits< MeasurementRealType >::ZeroValue() );
+  std::vector< MeasurementRealType > delta( measurementVectorSize );
 
-  // fills the lower triangle and the diagonal cells in the covariance matrix
-  for (; iter != end; ++iter )
+  for ( SizeValueType chunk = 0; chunk < numberOfChunks; ++chunk )
     {
-    const MeasurementVectorType & measurement = iter.GetMeasurementVector();
+    const MeasurementRealType chunkWeight = chunkWeights[chunk];
 
-    const typename SampleType::AbsoluteFrequencyType frequency = iter.GetFrequency();
-    totalFrequency += frequency;
+    if ( chunkWeight == NumericTraits< MeasurementRealType >::ZeroValue() )
+      {
+      continue;
+      }
+
+    const MeasurementRealType *const chunkMean = &chunkMeans[chunk * measurementVectorSize];
+    const MeasurementRealType *const chunkComoment = &chunkComoments[chunk * comomentSize];
+
+    const MeasurementRealType mergedWeight = totalFrequency + chunkWeight;
 
     for ( unsigned int dim = 0; dim < measurementVectorSize; ++dim )
       {
-      const auto component = static_cast< MeasurementRealType >( measurement[dim] );
-
-      diff[dim] = ( component - mean[dim] );
+      delta[dim] = ( chunkMean[dim] - mergedMean[dim] );
       }
 
-    // updates the covariance matrix
+    const MeasurementRealType deltaScale = ( totalFrequency * chunkWeight ) / mergedWeight;
+
+    unsigned int entry = 0;
     for ( unsigned int row = 0; row < measurementVectorSize; ++row )
       {
       for ( unsigned int col = 0; col < row + 1; ++col )
         {
-        output(row, col) +=
-          ( static_cast< MeasurementRealType >( frequency ) * diff[row] * diff[col] );
+        mergedComoment[entry] += ( chunkComoment[entry] + deltaScale * delta[row] * delta[col] );
+        ++entry;
         }
       }
+
+    const MeasurementRealType meanRatio = chunkWeight / mergedWeight;
+    for ( unsigned int dim = 0; dim < measurementVectorSize; ++dim )
+      {
+      mergedMean[dim] += ( meanRatio * delta[dim] );
+      }
+
+    totalFrequency = mergedWeight;
     }
 
-  // fills the upper triangle using the lower triangle
-  for ( unsigned int row = 1; row < measurementVectorSize; ++row )
+  // store the mean computed along the way
+  MeasurementVectorRealType mean;
+  NumericTraits<MeasurementVectorRealType>::SetLength( mean, measurementVectorSize );
+  for ( unsigned int dim = 0; dim < measurementVectorSize; ++dim )
+    {
+    mean[dim] = mergedMean[dim];
+    }
+  decoratedMeanOutput->Set( mean );
+
+  // fills the covariance matrix from the merged comoment
+  unsigned int entry = 0;
+  for ( unsigned int row = 0; row < measurementVectorSize; ++row )
     {
-    for ( unsigned int col = 0; col < row; ++col )
+    for ( unsigned int col = 0; col < row + 1; ++col )
       {
-      output(col, row) = output(row, col);
+      output(row, col) = mergedComoment[entry];
+      output(col, row) = mergedComoment[entry];
+      ++entry;
       }
     }
 
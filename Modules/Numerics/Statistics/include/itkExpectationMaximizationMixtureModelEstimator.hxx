@@ -19,9 +19,14 @@
 #define itkExpectationMaximizationMixtureModelEstimator_hxx
 
 #include "itkExpectationMaximizationMixtureModelEstimator.h"
+#include "itkCompensatedSummation.h"
+#include "itkMultiThreaderBase.h"
 #include "itkNumericTraits.h"
 #include "itkMath.h"
 
+#include <algorithm>
+#include <vector>
+
 namespace itk
 {
 namespace Statistics
@@ -173,70 +178,96 @@ ExpectationMaximizationMixtureModelEstimator< TSample >
     return false;
     }
 
-  double                temp;
-  size_t                numberOfComponents = m_ComponentVector.size();
-  std::vector< double > tempWeights(numberOfComponents, 0. );
-
-  typename TSample::ConstIterator iter = m_Sample->Begin();
-  typename TSample::ConstIterator last = m_Sample->End();
-  // Note: The data type of componentIndex shoub be unsigned int
-  //       because itk::Array only supports 'unsigned int' number of elements.
-  unsigned int componentIndex;
+  const size_t        numberOfComponents = m_ComponentVector.size();
+  const SizeValueType size = m_Sample->Size();
 
   using FrequencyType = typename TSample::AbsoluteFrequencyType;
-  FrequencyType frequency;
-  FrequencyType zeroFrequency = NumericTraits< FrequencyType >::ZeroValue();
-  typename TSample::MeasurementVectorType mvector;
-  double density;
-  double densitySum;
-  double minDouble = NumericTraits<double>::epsilon();
-
-  SizeValueType measurementVectorIndex = 0;
-
-  while ( iter != last )
+  const FrequencyType zeroFrequency = NumericTraits< FrequencyType >::ZeroValue();
+  const double        minDouble = NumericTraits<double>::epsilon();
+
+  // The responsibilities of distinct measurement vectors are independent,
+  // so the sample is processed in chunks of a fixed size. The chunk size
+  // does not depend on the number of threads, which keeps the computed
+  // weights identical for any thread count.
+  constexpr SizeValueType chunkSize = 65536;
+  const SizeValueType     numberOfChunks = ( size + chunkSize - 1 ) / chunkSize;
+
+  // Every chunk traverses the sample through its own iterator copy. The
+  // list sample adaptors cache the measurement vector returned by their
+  // random access interface in a single mutable member, so index based
+  // access from several threads would race.
+  std::vector< typename TSample::ConstIterator > chunkFirst;
+  chunkFirst.reserve(numberOfChunks);
+
+  typename TSample::ConstIterator positionIter = m_Sample->Begin();
+  for ( SizeValueType i = 0; i < size; ++i, ++positionIter )
     {
-    mvector = iter.GetMeasurementVector();
-    frequency = iter.GetFrequency();
-    densitySum = 0.0;
-    if ( frequency > zeroFrequency )
+    if ( i % chunkSize == 0 )
       {
-      for ( componentIndex = 0; componentIndex < numberOfComponents;
-            ++componentIndex )
-        {
-        double t_prop = m_Proportions[ componentIndex ];
-        double t_value = m_ComponentVector[ componentIndex ]->Evaluate(mvector);
-        density = t_prop * t_value;
-        tempWeights[ componentIndex ] = density;
-        densitySum += density;
-        }
+      chunkFirst.push_back(positionIter);
+      }
+    }
 
-      for ( componentIndex = 0; componentIndex < numberOfComponents;
-            ++componentIndex )
-        {
-        temp = tempWeights[static_cast<unsigned int>(componentIndex)];
+  MultiThreaderBase::Pointer threader = MultiThreaderBase::New();
+  threader->ParallelizeArray( 0, numberOfChunks,
+    [this, &chunkFirst, size, numberOfComponents, zeroFrequency, minDouble]
+    ( SizeValueType chunk )
+      {
+      std::vector< double > tempWeights(numberOfComponents, 0.);
+
+      typename TSample::ConstIterator         iter = chunkFirst[chunk];
+      typename TSample::MeasurementVectorType mvector;
 
-        // just to make sure temp does not blow up!
-        if ( densitySum > NumericTraits<double>::epsilon() )
+      // Note: The data type of componentIndex shoub be unsigned int
+      //       because itk::Array only supports 'unsigned int' number of elements.
+      unsigned int componentIndex;
+
+      const SizeValueType last = std::min(size, ( chunk + 1 ) * chunkSize);
+      for ( SizeValueType measurementVectorIndex = chunk * chunkSize;
+            measurementVectorIndex < last;
+            ++measurementVectorIndex, ++iter )
+        {
+        mvector = iter.GetMeasurementVector();
+        const FrequencyType frequency = iter.GetFrequency();
+        double densitySum = 0.0;
+        if ( frequency > zeroFrequency )
           {
-          temp /= densitySum;
+          for ( componentIndex = 0; componentIndex < numberOfComponents;
+                ++componentIndex )
+            {
+            double t_prop = m_Proportions[ componentIndex ];
+            double t_value = m_ComponentVector[ componentIndex ]->Evaluate(mvector);
+            double density = t_prop * t_value;
+            tempWeights[ componentIndex ] = density;
+            densitySum += density;
+            }
+
+          for ( componentIndex = 0; componentIndex < numberOfComponents;
+                ++componentIndex )
+            {
+            double temp = tempWeights[static_cast<unsigned int>(componentIndex)];
+
+            // just to make sure temp does not blow up!
+            if ( densitySum > NumericTraits<double>::epsilon() )
+              {
+              temp /= densitySum;
+              }
+            m_ComponentVector[static_cast<unsigned int>(componentIndex)]->SetWeight(measurementVectorIndex,
+                                                         temp);
+            }
+          }
+        else
+          {
+          for ( componentIndex = 0; componentIndex < numberOfComponents;
+                ++componentIndex )
+            {
+            m_ComponentVector[componentIndex]->SetWeight(measurementVectorIndex,
+                                                         minDouble);
+            }
           }
-        m_ComponentVector[static_cast<unsigned int>(componentIndex)]->SetWeight(measurementVectorIndex,
-                                                     temp);
-        }
-      }
-    else
-      {
-      for ( componentIndex = 0; componentIndex < numberOfComponents;
-            ++componentIndex )
-        {
-        m_ComponentVector[componentIndex]->SetWeight(measurementVectorIndex,
-                                                     minDouble);
         }
-      }
-
-    ++iter;
-    ++measurementVectorIndex;
-    }
+      },
+    nullptr );
 
   return true;
 }
@@ -318,26 +349,56 @@ bool
 ExpectationMaximizationMixtureModelEstimator< TSample >
 ::UpdateProportions()
 {
-  size_t numberOfComponents = m_ComponentVector.size();
-  size_t sampleSize = m_Sample->Size();
+  const size_t        numberOfComponents = m_ComponentVector.size();
+  const SizeValueType sampleSize = m_Sample->Size();
   auto totalFrequency = static_cast< double >( m_Sample->GetTotalFrequency() );
-  size_t   i, j;
-  double tempSum;
+  size_t i;
   bool   updated = false;
 
+  // Compensated partial sums of the responsibilities, one slot per chunk
+  // and component. The chunk size is fixed and the slots are merged in
+  // chunk order below, so the proportions do not depend on the number of
+  // threads.
+  constexpr SizeValueType chunkSize = 65536;
+  const SizeValueType     numberOfChunks = ( sampleSize + chunkSize - 1 ) / chunkSize;
+
+  std::vector< double > partialSums(numberOfChunks * numberOfComponents, 0.);
+
+  if ( totalFrequency > NumericTraits<double>::epsilon() )
+    {
+    MultiThreaderBase::Pointer threader = MultiThreaderBase::New();
+    threader->ParallelizeArray( 0, numberOfChunks,
+      [this, &partialSums, sampleSize, numberOfComponents]( SizeValueType chunk )
+        {
+        const SizeValueType first = chunk * chunkSize;
+        const SizeValueType last = std::min(sampleSize, first + chunkSize);
+        for ( size_t component = 0; component < numberOfComponents; ++component )
+          {
+          CompensatedSummation< double > sum;
+          for ( SizeValueType j = first; j < last; ++j )
+            {
+            sum += ( m_ComponentVector[static_cast<unsigned int>( component )]->GetWeight(static_cast<unsigned int>( j ))
+                     * m_Sample->GetFrequency(static_cast<unsigned int>( j )) );
+            }
+          partialSums[chunk * numberOfComponents + component] = sum.GetSum();
+          }
+        },
+      nullptr );
+    }
+
   for ( i = 0; i < numberOfComponents; ++i )
     {
-    tempSum = 0.;
+    double tempSum = 0.;
 
     if( totalFrequency > NumericTraits<double>::epsilon() )
       {
-      for ( j = 0; j < sampleSize; ++j )
+      CompensatedSummation< double > sum;
+      for ( SizeValueType chunk = 0; chunk < numberOfChunks; ++chunk )
         {
-        tempSum += ( m_ComponentVector[static_cast<unsigned int>( i )]->GetWeight(static_cast<unsigned int>( j ))
-                     * m_Sample->GetFrequency(static_cast<unsigned int>( j )) );
+        sum += partialSums[chunk * numberOfComponents + i];
         }
 
-      tempSum /= totalFrequency;
+      tempSum = sum.GetSum() / totalFrequency;
       }
 
     if ( Math::NotAlmostEquals( tempSum, m_Proportions[static_cast<unsigned int>( i )] ) )
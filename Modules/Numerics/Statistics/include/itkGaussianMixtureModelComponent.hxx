@@ -194,18 +194,6 @@ GaussianMixtureModelComponent< TSample >
 
   const WeightArrayType & weights = this->GetWeights();
 
-  typename TSample::ConstIterator iter = this->GetSample()->Begin();
-  typename TSample::ConstIterator end =  this->GetSample()->End();
-
-  typename TSample::MeasurementVectorType measurements;
-
-  // why these lines???
-  while ( iter != end )
-    {
-    measurements = iter.GetMeasurementVector();
-    ++iter;
-    }
-
   m_MeanEstimator->SetWeights(weights);
   m_MeanEstimator->Update();
 
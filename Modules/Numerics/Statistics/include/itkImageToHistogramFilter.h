@@ -19,6 +19,7 @@
 #define itkImageToHistogramFilter_h
 
 #include <mutex>
+#include <unordered_map>
 
 #include "itkHistogram.h"
 #include "itkImageTransformer.h"
@@ -71,6 +72,15 @@ public:
   using HistogramMeasurementType = typename HistogramType::MeasurementType;
   using HistogramMeasurementVectorType = typename HistogramType::MeasurementVectorType;
 
+  /** Sparse accumulator used for the per-thread partial histograms. Only
+   * the occupied bins are stored, keyed by the linear bin identifier of
+   * the output histogram, so the memory consumed by a thread is bounded
+   * by the number of distinct bins it visits rather than by the full bin
+   * grid. This matters for joint multi-component histograms, where the
+   * dense grid can be orders of magnitude larger than its occupancy. */
+  using SparseHistogramMapType = std::unordered_map< typename HistogramType::InstanceIdentifier,
+                                                     typename HistogramType::AbsoluteFrequencyType >;
+
 public:
 
   /** Return the output histogram. */
@@ -136,10 +146,12 @@ protected:
 
 
   virtual void ThreadedMergeHistogram( HistogramPointer &&histogram );
+  virtual void ThreadedMergeSparseHistogram( SparseHistogramMapType &&histogramMap );
 
   std::mutex m_Mutex;
 
-  HistogramPointer m_MergeHistogram;
+  HistogramPointer      m_MergeHistogram;
+  SparseHistogramMapType m_MergeSparseHistogram;
 
   HistogramMeasurementVectorType m_Minimum;
   HistogramMeasurementVectorType m_Maximum;
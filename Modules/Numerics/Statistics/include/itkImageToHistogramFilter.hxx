@@ -184,6 +184,7 @@ ImageToHistogramFilter< TImage >
   m_Maximum.Fill( NumericTraits<ValueType>::NonpositiveMin() );
 
   m_MergeHistogram = nullptr;
+  m_MergeSparseHistogram.clear();
 }
 
 template< typename TImage >
@@ -192,8 +193,22 @@ ImageToHistogramFilter< TImage >
 ::AfterThreadedGenerateData()
 {
   HistogramType *outputHistogram = this->GetOutput();
-  outputHistogram->Graft(m_MergeHistogram);
-  m_MergeHistogram = nullptr;
+  if ( m_MergeHistogram.IsNotNull() )
+    {
+    // a derived class merged full histograms, adopt the result
+    outputHistogram->Graft(m_MergeHistogram);
+    m_MergeHistogram = nullptr;
+    }
+  else
+    {
+    // apply the merged sparse partials to the already initialized (and
+    // zero filled) output histogram
+    for ( auto & bin : m_MergeSparseHistogram )
+      {
+      outputHistogram->IncreaseFrequency( bin.first, bin.second );
+      }
+    m_MergeSparseHistogram.clear();
+    }
 }
 
 
@@ -238,13 +253,14 @@ ImageToHistogramFilter< TImage >
 ::ThreadedComputeHistogram(const RegionType & inputRegionForThread)
 {
   const unsigned int nbOfComponents = this->GetInput()->GetNumberOfComponentsPerPixel();
-  const HistogramType *outputHistogram = this->GetOutput();
 
-  HistogramPointer histogram = HistogramType::New();
-  histogram->SetClipBinsAtEnds(outputHistogram->GetClipBinsAtEnds());
-  histogram->SetMeasurementVectorSize(nbOfComponents);
-  histogram->Initialize(outputHistogram->GetSize(), m_Minimum, m_Maximum);
+  // The output histogram has already been initialized with the final bin
+  // boundaries, so its GetIndex() can be shared read-only between the
+  // threads. The partial frequencies are accumulated in a sparse map
+  // instead of a dense per-thread histogram copy.
+  const HistogramType *outputHistogram = this->GetOutput();
 
+  SparseHistogramMapType localHistogram;
 
   ImageRegionConstIterator< TImage > inputIt( this->GetInput(), inputRegionForThread );
   inputIt.GoToBegin();
@@ -255,12 +271,12 @@ ImageToHistogramFilter< TImage >
     {
     const PixelType & p = inputIt.Get();
     NumericTraits<PixelType>::AssignToArray( p, m );
-    histogram->GetIndex( m, index );
-    histogram->IncreaseFrequencyOfIndex( index, 1 );
+    outputHistogram->GetIndex( m, index );
+    ++localHistogram[ outputHistogram->GetInstanceIdentifier( index ) ];
     ++inputIt;
     }
 
-  this->ThreadedMergeHistogram( std::move(histogram) );
+  this->ThreadedMergeSparseHistogram( std::move(localHistogram) );
 }
 
 template< typename TImage >
@@ -307,6 +323,47 @@ ImageToHistogramFilter< TImage >
     }
 }
 
+template< typename TImage >
+void
+ImageToHistogramFilter< TImage >
+::ThreadedMergeSparseHistogram(SparseHistogramMapType &&histogramMap)
+{
+  while (true)
+    {
+
+    std::unique_lock<std::mutex> lock(m_Mutex);
+
+    if (m_MergeSparseHistogram.empty())
+      {
+      m_MergeSparseHistogram = std::move(histogramMap);
+      return;
+      }
+    else
+      {
+
+      // merge/reduce the local results with current values in m_MergeSparseHistogram
+
+      // take ownership locally
+      SparseHistogramMapType toMergeHistogram;
+      swap( m_MergeSparseHistogram, toMergeHistogram );
+
+      // allow other threads to merge data
+      lock.unlock();
+
+      // merge the smaller map into the bigger one, only the occupied
+      // bins are visited
+      if ( toMergeHistogram.size() > histogramMap.size() )
+        {
+        swap( toMergeHistogram, histogramMap );
+        }
+      for ( const auto & bin : toMergeHistogram )
+        {
+        histogramMap[ bin.first ] += bin.second;
+        }
+      }
+    }
+}
+
 template< typename TImage >
 void
 ImageToHistogramFilter< TImage >
@@ -684,6 +684,13 @@ public:
   void Search( const MeasurementVectorType &, double,
     InstanceIdentifierVectorType & ) const;
 
+  /** Searches the k-nearest neighbors of a batch of query points. The
+   * queries are independent of each other and are answered in
+   * parallel. The result vector is resized to the number of queries;
+   * entry i holds the neighbors of query i. */
+  void Search( const std::vector<MeasurementVectorType> &, unsigned int,
+    std::vector<InstanceIdentifierVectorType> & ) const;
+
   /** Returns true if the intermediate k-nearest neighbors exist within
    * the the bounding box defined by the lowerBound and the
    * upperBound. Otherwise returns false. Returns false if the ball
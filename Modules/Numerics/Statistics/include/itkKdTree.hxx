@@ -19,6 +19,7 @@
 #define itkKdTree_hxx
 
 #include "itkKdTree.h"
+#include "itkMultiThreaderBase.h"
 
 namespace itk
 {
@@ -235,6 +236,35 @@ KdTree<TSample>
   result = nearestNeighbors.GetNeighbors();
 }
 
+template<typename TSample>
+void
+KdTree<TSample>
+::Search( const std::vector<MeasurementVectorType> & queries,
+  unsigned int numberOfNeighborsRequested,
+  std::vector<InstanceIdentifierVectorType> & results ) const
+{
+  if( numberOfNeighborsRequested > this->Size() )
+    {
+    itkExceptionMacro( "The numberOfNeighborsRequested for the nearest "
+      << "neighbor search should be less than or equal to the number of "
+      << "the measurement vectors." );
+    }
+
+  results.resize( queries.size() );
+
+  // The single query Search method only uses local variables, so the
+  // queries can be answered concurrently. Each query writes its own
+  // entry of the results vector.
+  MultiThreaderBase::Pointer threader = MultiThreaderBase::New();
+  threader->ParallelizeArray( 0, queries.size(),
+    [this, &queries, numberOfNeighborsRequested, &results]( SizeValueType index )
+    {
+      this->Search( queries[index], numberOfNeighborsRequested,
+        results[index] );
+    },
+    nullptr );
+}
+
 template<typename TSample>
 inline int
 KdTree<TSample>
@@ -135,6 +135,16 @@ public:
    * held in the 'sample' that is passed to this class */
   itkGetConstMacro(MeasurementVectorSize, unsigned int);
 
+  /** Set/Get whether large subtrees are built concurrently. The left
+   * and the right subtree of a nonterminal node partition disjoint
+   * ranges of the internal Subsample, so they can be built in parallel
+   * without changing the resulting tree. Subtrees smaller than an
+   * automatically chosen threshold are still built serially to avoid
+   * spawning overhead near the leaves. Default is off. */
+  itkSetMacro(UseParallelConstruction, bool);
+  itkGetConstMacro(UseParallelConstruction, bool);
+  itkBooleanMacro(UseParallelConstruction);
+
 protected:
   /** Constructor */
   KdTreeGenerator();
@@ -165,6 +175,14 @@ protected:
                                     MeasurementVectorType & upperBound,
                                     unsigned int level);
 
+  /** Returns true when the subtrees of a nonterminal node covering the
+   * given number of instances should be built concurrently. */
+  bool ShouldBuildSubtreesConcurrently(unsigned int numberOfInstances) const
+  {
+    return m_UseParallelConstruction
+           && numberOfInstances >= m_ParallelConstructionThreshold;
+  }
+
 private:
   /** Pointer to the input (source) sample */
   TSample *m_SourceSample;
@@ -181,17 +199,15 @@ private:
   /** Pointer to the resulting k-d tree. */
   OutputPointer m_Tree;
 
-  /** Temporary lower bound for the TreeGenerationLoop */
-  MeasurementVectorType m_TempLowerBound;
-
-  /** Temporary upper bound for the TreeGenerationLoop */
-  MeasurementVectorType m_TempUpperBound;
-
-  /** Temporary mean for the TreeGenerationLoop */
-  MeasurementVectorType m_TempMean;
-
   /** Length of a measurement vector */
   MeasurementVectorSizeType m_MeasurementVectorSize;
+
+  /** Flag enabling the concurrent construction of large subtrees. */
+  bool m_UseParallelConstruction;
+
+  /** Minimum number of instances a nonterminal node must cover before
+   * its subtrees are built concurrently. Computed in GenerateData. */
+  unsigned int m_ParallelConstructionThreshold;
 };  // end of class
 } // end of namespace Statistics
 } // end of namespace itk
@@ -19,6 +19,10 @@
 #define itkKdTreeGenerator_hxx
 
 #include  "itkKdTreeGenerator.h"
+#include  "itkMultiThreaderBase.h"
+
+#include <algorithm>
+#include <future>
 
 namespace itk
 {
@@ -32,6 +36,8 @@ KdTreeGenerator< TSample >
   m_BucketSize = 16;
   m_Subsample = SubsampleType::New();
   m_MeasurementVectorSize = 0;
+  m_UseParallelConstruction = false;
+  m_ParallelConstructionThreshold = NumericTraits< unsigned int >::max();
 }
 
 template< typename TSample >
@@ -54,6 +60,8 @@ KdTreeGenerator< TSample >
   os << indent << "Bucket Size: " << m_BucketSize << std::endl;
   os << indent << "MeasurementVectorSize: "
      << m_MeasurementVectorSize << std::endl;
+  os << indent << "UseParallelConstruction: "
+     << ( m_UseParallelConstruction ? "On" : "Off" ) << std::endl;
 }
 
 template< typename TSample >
@@ -65,9 +73,6 @@ KdTreeGenerator< TSample >
   m_Subsample->SetSample(sample);
   m_Subsample->InitializeWithAllInstances();
   m_MeasurementVectorSize = sample->GetMeasurementVectorSize();
-  NumericTraits<MeasurementVectorType>::SetLength(m_TempLowerBound, m_MeasurementVectorSize);
-  NumericTraits<MeasurementVectorType>::SetLength(m_TempUpperBound, m_MeasurementVectorSize);
-  NumericTraits<MeasurementVectorType>::SetLength(m_TempMean, m_MeasurementVectorSize);
 }
 
 template< typename TSample >
@@ -115,6 +120,21 @@ KdTreeGenerator< TSample >
     upperBound[d] = NumericTraits< MeasurementType >::max();
     }
 
+  // Subtrees smaller than this threshold are built serially. One
+  // additional worker is spawned per halving above the threshold, so
+  // roughly the default number of work units end up busy.
+  m_ParallelConstructionThreshold = NumericTraits< unsigned int >::max();
+  const ThreadIdType numberOfThreads =
+    MultiThreaderBase::GetGlobalDefaultNumberOfThreads();
+  if ( m_UseParallelConstruction && numberOfThreads > 1 )
+    {
+    constexpr unsigned int minimumSubtreeSize = 4096;
+    m_ParallelConstructionThreshold =
+      std::max( minimumSubtreeSize,
+                static_cast< unsigned int >( m_Subsample->Size()
+                                             / numberOfThreads ) );
+    }
+
   KdTreeNodeType *root =
     this->GenerateTreeLoop(0, m_Subsample->Size(), lowerBound, upperBound, 0);
   m_Tree->SetRoot(root);
@@ -141,16 +161,25 @@ KdTreeGenerator< TSample >
 
   SubsamplePointer subsample = this->GetSubsample();
 
+  // The bounds and the mean are local so that this routine stays
+  // reentrant when subtrees are built concurrently.
+  MeasurementVectorType tempLowerBound;
+  NumericTraits<MeasurementVectorType>::SetLength(tempLowerBound, m_MeasurementVectorSize);
+  MeasurementVectorType tempUpperBound;
+  NumericTraits<MeasurementVectorType>::SetLength(tempUpperBound, m_MeasurementVectorSize);
+  MeasurementVectorType tempMean;
+  NumericTraits<MeasurementVectorType>::SetLength(tempMean, m_MeasurementVectorSize);
+
   // find most widely spread dimension
   Algorithm::FindSampleBoundAndMean< SubsampleType >(subsample,
                                                      beginIndex, endIndex,
-                                                     m_TempLowerBound, m_TempUpperBound,
-                                                     m_TempMean);
+                                                     tempLowerBound, tempUpperBound,
+                                                     tempMean);
 
   maxSpread = NumericTraits< MeasurementType >::NonpositiveMin();
   for ( i = 0; i < m_MeasurementVectorSize; i++ )
     {
-    spread = m_TempUpperBound[i] - m_TempLowerBound[i];
+    spread = tempUpperBound[i] - tempLowerBound[i];
     if ( spread >= maxSpread )
       {
       maxSpread = spread;
@@ -176,17 +205,47 @@ KdTreeGenerator< TSample >
   dimensionLowerBound = lowerBound[partitionDimension];
   dimensionUpperBound = upperBound[partitionDimension];
 
-  upperBound[partitionDimension] = partitionValue;
-  const unsigned int beginLeftIndex = beginIndex;
-  const unsigned int endLeftIndex   = medianIndex;
-  NodeType *         left = GenerateTreeLoop(beginLeftIndex, endLeftIndex, lowerBound, upperBound, level + 1);
-  upperBound[partitionDimension] = dimensionUpperBound;
-
-  lowerBound[partitionDimension] = partitionValue;
+  const unsigned int beginLeftIndex  = beginIndex;
+  const unsigned int endLeftIndex    = medianIndex;
   const unsigned int beginRightIndex = medianIndex + 1;
   const unsigned int endRightIndex   = endIndex;
-  NodeType *         right = GenerateTreeLoop(beginRightIndex, endRightIndex, lowerBound, upperBound, level + 1);
-  lowerBound[partitionDimension] = dimensionLowerBound;
+
+  NodeType *left = nullptr;
+  NodeType *right = nullptr;
+  if ( this->ShouldBuildSubtreesConcurrently(endIndex - beginIndex) )
+    {
+    // The two subtrees partition disjoint index ranges of the
+    // subsample, so the left one can be built on a worker thread while
+    // the right one is built here. The worker gets its own copies of
+    // the bounds because both branches modify them during recursion.
+    MeasurementVectorType leftLowerBound = lowerBound;
+    MeasurementVectorType leftUpperBound = upperBound;
+    leftUpperBound[partitionDimension] = partitionValue;
+    std::future< NodeType * > leftFuture =
+      std::async(std::launch::async,
+                 [this, beginLeftIndex, endLeftIndex, level,
+                  leftLowerBound, leftUpperBound]() mutable {
+                   return this->GenerateTreeLoop(beginLeftIndex, endLeftIndex,
+                                                 leftLowerBound, leftUpperBound,
+                                                 level + 1);
+                 });
+
+    lowerBound[partitionDimension] = partitionValue;
+    right = GenerateTreeLoop(beginRightIndex, endRightIndex, lowerBound, upperBound, level + 1);
+    lowerBound[partitionDimension] = dimensionLowerBound;
+
+    left = leftFuture.get();
+    }
+  else
+    {
+    upperBound[partitionDimension] = partitionValue;
+    left = GenerateTreeLoop(beginLeftIndex, endLeftIndex, lowerBound, upperBound, level + 1);
+    upperBound[partitionDimension] = dimensionUpperBound;
+
+    lowerBound[partitionDimension] = partitionValue;
+    right = GenerateTreeLoop(beginRightIndex, endRightIndex, lowerBound, upperBound, level + 1);
+    lowerBound[partitionDimension] = dimensionLowerBound;
+    }
 
   using KdTreeNonterminalNodeType = KdTreeNonterminalNode< TSample >;
 
@@ -21,6 +21,7 @@
 #include "itkMeanSampleFilter.h"
 
 #include <vector>
+#include "itkColumnarListSample.h"
 #include "itkCompensatedSummation.h"
 #include "itkMeasurementVectorTraits.h"
 
@@ -149,21 +150,46 @@ MeanSampleFilter< TSample >
   using TotalFrequencyType = typename SampleType::TotalAbsoluteFrequencyType;
   TotalFrequencyType totalFrequency = NumericTraits< TotalFrequencyType >::ZeroValue();
 
-  typename SampleType::ConstIterator iter =      input->Begin();
-  const typename SampleType::ConstIterator end = input->End();
+  // Columnar samples expose each component as one contiguous array, so
+  // the sums are accumulated with one sequential sweep per component
+  // instead of gathering every measurement vector.
+  using ColumnarSampleType = ColumnarListSample< MeasurementVectorType >;
+  const auto * columnarInput = dynamic_cast< const ColumnarSampleType * >( input );
 
-  for (; iter != end; ++iter )
+  if ( columnarInput != nullptr )
     {
-    const MeasurementVectorType & measurement = iter.GetMeasurementVector();
-
-    const typename SampleType::AbsoluteFrequencyType frequency = iter.GetFrequency();
-    totalFrequency += frequency;
+    const SizeValueType size = columnarInput->Size();
 
     for ( unsigned int dim = 0; dim < measurementVectorSize; dim++ )
       {
-      const auto component = static_cast< MeasurementRealType >( measurement[dim] );
+      const typename ColumnarSampleType::MeasurementType *const column =
+        columnarInput->GetComponentArray(dim);
+
+      for ( SizeValueType i = 0; i < size; ++i )
+        {
+        sum[dim] += static_cast< MeasurementRealType >( column[i] );
+        }
+      }
+    totalFrequency = static_cast< TotalFrequencyType >( size );
+    }
+  else
+    {
+    typename SampleType::ConstIterator iter =      input->Begin();
+    const typename SampleType::ConstIterator end = input->End();
+
+    for (; iter != end; ++iter )
+      {
+      const MeasurementVectorType & measurement = iter.GetMeasurementVector();
+
+      const typename SampleType::AbsoluteFrequencyType frequency = iter.GetFrequency();
+      totalFrequency += frequency;
+
+      for ( unsigned int dim = 0; dim < measurementVectorSize; dim++ )
+        {
+        const auto component = static_cast< MeasurementRealType >( measurement[dim] );
 
-      sum[dim] += ( component * static_cast< MeasurementRealType >( frequency ) );
+        sum[dim] += ( component * static_cast< MeasurementRealType >( frequency ) );
+        }
       }
     }
 
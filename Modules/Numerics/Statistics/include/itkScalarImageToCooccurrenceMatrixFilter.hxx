@@ -22,6 +22,11 @@
 
 #include "itkConstNeighborhoodIterator.h"
 #include "itkMath.h"
+#include "itkMultiThreaderBase.h"
+
+#include <map>
+#include <mutex>
+#include <utility>
 
 namespace itk
 {
@@ -204,62 +209,91 @@ ScalarImageToCooccurrenceMatrixFilter< TImageType,
                                                                                      RegionType region)
 {
   // Iterate over all of those pixels and offsets, adding each
-  // co-occurrence pair to the histogram
+  // co-occurrence pair to the histogram. Each chunk of the region is
+  // walked by its own thread, which gathers its counts into a private
+  // sparse partial matrix; the partials are then folded into the output
+  // histogram under a lock. The counts are integers, so the result is
+  // identical to a serial accumulation.
 
   const ImageType *input = this->GetInput();
 
   auto * output = static_cast< HistogramType * >( this->ProcessObject::GetOutput(0) );
 
-  using NeighborhoodIteratorType = ConstNeighborhoodIterator< ImageType >;
-  NeighborhoodIteratorType neighborIt;
-  neighborIt = NeighborhoodIteratorType(radius, input, region);
+  std::mutex mergeMutex;
 
-  MeasurementVectorType cooccur( output->GetMeasurementVectorSize() );
-
-  for ( neighborIt.GoToBegin(); !neighborIt.IsAtEnd(); ++neighborIt )
-    {
-    const PixelType centerPixelIntensity = neighborIt.GetCenterPixel();
-    if ( centerPixelIntensity < m_Min
-         || centerPixelIntensity > m_Max )
+  this->GetMultiThreader()->template ParallelizeImageRegion< ImageType::ImageDimension >(
+    region,
+    [this, input, output, radius, &mergeMutex]( const RegionType & subRegion )
       {
-      continue; // don't put a pixel in the histogram if the value
-                // is out-of-bounds.
-      }
+      using NeighborhoodIteratorType = ConstNeighborhoodIterator< ImageType >;
+      NeighborhoodIteratorType neighborIt(radius, input, subRegion);
 
-    typename OffsetVector::ConstIterator offsets;
-    typename HistogramType::IndexType index;
-    for ( offsets = m_Offsets->Begin(); offsets != m_Offsets->End(); ++offsets )
-      {
-      bool            pixelInBounds;
-      const PixelType pixelIntensity =
-        neighborIt.GetPixel(offsets.Value(), pixelInBounds);
+      MeasurementVectorType cooccur( output->GetMeasurementVectorSize() );
+
+      using PartialMatrixType = std::map< std::pair< IndexValueType, IndexValueType >,
+                                          typename HistogramType::AbsoluteFrequencyType >;
+      PartialMatrixType partial;
 
-      if ( !pixelInBounds )
+      for ( neighborIt.GoToBegin(); !neighborIt.IsAtEnd(); ++neighborIt )
         {
-        continue; // don't put a pixel in the histogram if it's out-of-bounds.
+        const PixelType centerPixelIntensity = neighborIt.GetCenterPixel();
+        if ( centerPixelIntensity < m_Min
+             || centerPixelIntensity > m_Max )
+          {
+          continue; // don't put a pixel in the histogram if the value
+                    // is out-of-bounds.
+          }
+
+        typename OffsetVector::ConstIterator offsets;
+        typename HistogramType::IndexType index;
+        for ( offsets = m_Offsets->Begin(); offsets != m_Offsets->End(); ++offsets )
+          {
+          bool            pixelInBounds;
+          const PixelType pixelIntensity =
+            neighborIt.GetPixel(offsets.Value(), pixelInBounds);
+
+          if ( !pixelInBounds )
+            {
+            continue; // don't put a pixel in the histogram if it's out-of-bounds.
+            }
+
+          if ( pixelIntensity < m_Min
+               || pixelIntensity > m_Max )
+            {
+            continue; // don't put a pixel in the histogram if the value
+                      // is out-of-bounds.
+            }
+
+          // Now make both possible co-occurrence combinations and increment the
+          // partial matrix with them.
+
+          cooccur[0] = centerPixelIntensity;
+          cooccur[1] = pixelIntensity;
+          output->GetIndex( cooccur, index );
+          ++partial[std::make_pair( index[0], index[1] )];
+
+          cooccur[1] = centerPixelIntensity;
+          cooccur[0] = pixelIntensity;
+          output->GetIndex( cooccur, index );
+          ++partial[std::make_pair( index[0], index[1] )];
+          }
         }
 
-      if ( pixelIntensity < m_Min
-           || pixelIntensity > m_Max )
+      if ( partial.empty() )
         {
-        continue; // don't put a pixel in the histogram if the value
-                  // is out-of-bounds.
+        return;
         }
 
-      // Now make both possible co-occurrence combinations and increment the
-      // histogram with them.
-
-      cooccur[0] = centerPixelIntensity;
-      cooccur[1] = pixelIntensity;
-      output->GetIndex( cooccur, index );
-      output->IncreaseFrequencyOfIndex( index, 1 );
-
-      cooccur[1] = centerPixelIntensity;
-      cooccur[0] = pixelIntensity;
-      output->GetIndex( cooccur, index );
-      output->IncreaseFrequencyOfIndex( index, 1 );
-      }
-    }
+      std::lock_guard< std::mutex > lock(mergeMutex);
+      typename HistogramType::IndexType mergeIndex( output->GetMeasurementVectorSize() );
+      for ( const auto & entry : partial )
+        {
+        mergeIndex[0] = entry.first.first;
+        mergeIndex[1] = entry.first.second;
+        output->IncreaseFrequencyOfIndex( mergeIndex, entry.second );
+        }
+      },
+    nullptr );
 }
 
 template< typename TImageType, typename THistogramFrequencyContainer >
@@ -276,71 +310,97 @@ ScalarImageToCooccurrenceMatrixFilter< TImageType,
 
   auto * output = static_cast< HistogramType * >( this->ProcessObject::GetOutput(0) );
 
-  // Iterate over all of those pixels and offsets, adding each
-  // co-occurrence pair to the histogram
-  using NeighborhoodIteratorType = ConstNeighborhoodIterator< ImageType >;
-  NeighborhoodIteratorType neighborIt, maskNeighborIt;
-  neighborIt = NeighborhoodIteratorType(radius, input, region);
-  maskNeighborIt = NeighborhoodIteratorType(radius, maskImage, region);
-
-  MeasurementVectorType cooccur( output->GetMeasurementVectorSize() );
-  typename HistogramType::IndexType index;
-  for ( neighborIt.GoToBegin(), maskNeighborIt.GoToBegin();
-        !neighborIt.IsAtEnd(); ++neighborIt, ++maskNeighborIt )
-    {
-    if ( maskNeighborIt.GetCenterPixel() != m_InsidePixelValue )
+  // The masked walk is chunked the same way as the unmasked one: private
+  // sparse partial matrices per chunk, merged into the output histogram
+  // under a lock once the chunk has been consumed.
+  std::mutex mergeMutex;
+
+  this->GetMultiThreader()->template ParallelizeImageRegion< ImageType::ImageDimension >(
+    region,
+    [this, input, output, maskImage, radius, &mergeMutex]( const RegionType & subRegion )
       {
-      continue; // Go to the next loop if we're not in the mask
-      }
+      using NeighborhoodIteratorType = ConstNeighborhoodIterator< ImageType >;
+      NeighborhoodIteratorType neighborIt(radius, input, subRegion);
+      NeighborhoodIteratorType maskNeighborIt(radius, maskImage, subRegion);
 
-    const PixelType centerPixelIntensity = neighborIt.GetCenterPixel();
+      MeasurementVectorType cooccur( output->GetMeasurementVectorSize() );
+      typename HistogramType::IndexType index;
 
-    if ( centerPixelIntensity < this->GetMin()
-         || centerPixelIntensity > this->GetMax() )
-      {
-      continue; // don't put a pixel in the histogram if the value
-                // is out-of-bounds.
-      }
+      using PartialMatrixType = std::map< std::pair< IndexValueType, IndexValueType >,
+                                          typename HistogramType::AbsoluteFrequencyType >;
+      PartialMatrixType partial;
 
-    typename OffsetVector::ConstIterator offsets;
-    for ( offsets = this->GetOffsets()->Begin(); offsets != this->GetOffsets()->End(); ++offsets )
-      {
-      if ( maskNeighborIt.GetPixel( offsets.Value() ) != m_InsidePixelValue )
+      for ( neighborIt.GoToBegin(), maskNeighborIt.GoToBegin();
+            !neighborIt.IsAtEnd(); ++neighborIt, ++maskNeighborIt )
         {
-        continue; // Go to the next loop if we're not in the mask
+        if ( maskNeighborIt.GetCenterPixel() != m_InsidePixelValue )
+          {
+          continue; // Go to the next loop if we're not in the mask
+          }
+
+        const PixelType centerPixelIntensity = neighborIt.GetCenterPixel();
+
+        if ( centerPixelIntensity < this->GetMin()
+             || centerPixelIntensity > this->GetMax() )
+          {
+          continue; // don't put a pixel in the histogram if the value
+                    // is out-of-bounds.
+          }
+
+        typename OffsetVector::ConstIterator offsets;
+        for ( offsets = this->GetOffsets()->Begin(); offsets != this->GetOffsets()->End(); ++offsets )
+          {
+          if ( maskNeighborIt.GetPixel( offsets.Value() ) != m_InsidePixelValue )
+            {
+            continue; // Go to the next loop if we're not in the mask
+            }
+
+          bool            pixelInBounds;
+          const PixelType pixelIntensity =
+            neighborIt.GetPixel(offsets.Value(), pixelInBounds);
+
+          if ( !pixelInBounds )
+            {
+            continue; // don't put a pixel in the histogram if it's out-of-bounds.
+            }
+
+          if ( pixelIntensity < this->GetMin()
+               || pixelIntensity > this->GetMax() )
+            {
+            continue; // don't put a pixel in the histogram if the value
+                      // is out-of-bounds.
+            }
+
+          // Now make both possible co-occurrence combinations and increment the
+          // partial matrix with them.
+
+          cooccur[0] = centerPixelIntensity;
+          cooccur[1] = pixelIntensity;
+          output->GetIndex( cooccur, index );
+          ++partial[std::make_pair( index[0], index[1] )];
+
+          cooccur[1] = centerPixelIntensity;
+          cooccur[0] = pixelIntensity;
+          output->GetIndex( cooccur, index );
+          ++partial[std::make_pair( index[0], index[1] )];
+          }
         }
 
-      bool            pixelInBounds;
-      const PixelType pixelIntensity =
-        neighborIt.GetPixel(offsets.Value(), pixelInBounds);
-
-      if ( !pixelInBounds )
+      if ( partial.empty() )
         {
-        continue; // don't put a pixel in the histogram if it's out-of-bounds.
+        return;
         }
 
-      if ( pixelIntensity < this->GetMin()
-           || pixelIntensity > this->GetMax() )
+      std::lock_guard< std::mutex > lock(mergeMutex);
+      typename HistogramType::IndexType mergeIndex( output->GetMeasurementVectorSize() );
+      for ( const auto & entry : partial )
         {
-        continue; // don't put a pixel in the histogram if the value
-                  // is out-of-bounds.
+        mergeIndex[0] = entry.first.first;
+        mergeIndex[1] = entry.first.second;
+        output->IncreaseFrequencyOfIndex( mergeIndex, entry.second );
         }
-
-      // Now make both possible co-occurrence combinations and increment the
-      // histogram with them.
-
-      cooccur[0] = centerPixelIntensity;
-      cooccur[1] = pixelIntensity;
-      output->GetIndex( cooccur, index );
-      output->IncreaseFrequencyOfIndex(index, 1);
-
-
-      cooccur[1] = centerPixelIntensity;
-      cooccur[0] = pixelIntensity;
-      output->GetIndex( cooccur, index );
-      output->IncreaseFrequencyOfIndex(index, 1);
-      }
-    }
+      },
+    nullptr );
 }
 
 template< typename TImageType, typename THistogramFrequencyContainer >
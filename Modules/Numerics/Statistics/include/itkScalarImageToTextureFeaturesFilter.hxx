@@ -19,9 +19,12 @@
 #define itkScalarImageToTextureFeaturesFilter_hxx
 
 #include "itkScalarImageToTextureFeaturesFilter.h"
+#include "itkMultiThreaderBase.h"
 #include "itkNeighborhood.h"
 #include "itkMath.h"
 
+#include <vector>
+
 namespace itk
 {
 namespace Statistics
@@ -114,25 +117,73 @@ ScalarImageToTextureFeaturesFilter< TImage, THistogramFrequencyContainer >::Full
     features[i] = new double[numFeatures];
     }
 
-  // For each offset, calculate each feature
+  // For each offset, calculate each feature. The offsets are independent of
+  // one another, so each one gets its own co-occurrence generator and
+  // feature calculator and the per-offset computations run as parallel
+  // tasks. The input (and mask) are grafted into task-private images so
+  // that no task triggers a pipeline update on a shared data object.
   typename OffsetVector::ConstIterator offsetIt;
   size_t offsetNum, featureNum;
   using InternalTextureFeatureName = typename TextureFeaturesFilterType::TextureFeatureName;
 
-  for ( offsetIt = m_Offsets->Begin(), offsetNum = 0;
-        offsetIt != m_Offsets->End(); ++offsetIt, offsetNum++ )
+  std::vector< OffsetType > offsetTable;
+  offsetTable.reserve(numOffsets);
+  for ( offsetIt = m_Offsets->Begin(); offsetIt != m_Offsets->End(); ++offsetIt )
     {
-    this->m_GLCMGenerator->SetOffset( offsetIt.Value() );
-    this->m_GLCMCalculator->Update();
+    offsetTable.push_back( offsetIt.Value() );
+    }
 
-    typename FeatureNameVector::ConstIterator fnameIt;
-    for ( fnameIt = m_RequestedFeatures->Begin(), featureNum = 0;
-          fnameIt != m_RequestedFeatures->End(); ++fnameIt, featureNum++ )
-      {
-      features[offsetNum][featureNum] = this->m_GLCMCalculator->GetFeature( (InternalTextureFeatureName)fnameIt.Value() );
-      }
+  const ImageType *input = this->m_GLCMGenerator->GetInput();
+  const ImageType *maskImage = nullptr;
+  if ( this->m_GLCMGenerator->GetNumberOfIndexedInputs() > 1 )
+    {
+    maskImage = this->m_GLCMGenerator->GetMaskImage();
     }
 
+  this->GetMultiThreader()->ParallelizeArray( 0, numOffsets,
+    [this, features, input, maskImage, &offsetTable]( SizeValueType taskNum )
+      {
+      typename ImageType::Pointer taskInput = ImageType::New();
+      taskInput->Graft(input);
+      taskInput->SetRequestedRegion( input->GetRequestedRegion() );
+
+      typename CooccurrenceMatrixFilterType::Pointer glcmGenerator =
+        CooccurrenceMatrixFilterType::New();
+      glcmGenerator->SetInput(taskInput);
+      glcmGenerator->SetOffset( offsetTable[taskNum] );
+      glcmGenerator->SetNumberOfBinsPerAxis( this->m_GLCMGenerator->GetNumberOfBinsPerAxis() );
+      glcmGenerator->SetPixelValueMinMax( this->m_GLCMGenerator->GetMin(),
+                                          this->m_GLCMGenerator->GetMax() );
+      glcmGenerator->SetNormalize( this->m_GLCMGenerator->GetNormalize() );
+
+      if ( maskImage != nullptr )
+        {
+        typename ImageType::Pointer taskMask = ImageType::New();
+        taskMask->Graft(maskImage);
+        taskMask->SetRequestedRegion( maskImage->GetRequestedRegion() );
+        glcmGenerator->SetMaskImage(taskMask);
+        glcmGenerator->SetInsidePixelValue( this->m_GLCMGenerator->GetInsidePixelValue() );
+        }
+
+      // The offsets already occupy the thread pool, so keep each task's
+      // co-occurrence accumulation on a single work unit.
+      glcmGenerator->GetMultiThreader()->SetNumberOfWorkUnits(1);
+
+      typename TextureFeaturesFilterType::Pointer glcmCalculator =
+        TextureFeaturesFilterType::New();
+      glcmCalculator->SetInput( glcmGenerator->GetOutput() );
+      glcmCalculator->Update();
+
+      typename FeatureNameVector::ConstIterator fnameIt;
+      size_t fNum;
+      for ( fnameIt = m_RequestedFeatures->Begin(), fNum = 0;
+            fnameIt != m_RequestedFeatures->End(); ++fnameIt, fNum++ )
+        {
+        features[taskNum][fNum] = glcmCalculator->GetFeature( (InternalTextureFeatureName)fnameIt.Value() );
+        }
+      },
+    nullptr );
+
   // Now get the mean and deviaton of each feature across the offsets.
   m_FeatureMeans->clear();
   m_FeatureStandardDeviations->clear();
@@ -20,6 +20,8 @@
 
 #include "itkWeightedCentroidKdTreeGenerator.h"
 
+#include <future>
+
 namespace itk
 {
 namespace Statistics
@@ -81,16 +83,28 @@ WeightedCentroidKdTreeGenerator< TSample >
       }
     }
 
+  // The bounds and the mean are local so that this routine stays
+  // reentrant when subtrees are built concurrently.
+  MeasurementVectorType tempLowerBound;
+  NumericTraits<MeasurementVectorType>::SetLength( tempLowerBound,
+    this->GetMeasurementVectorSize() );
+  MeasurementVectorType tempUpperBound;
+  NumericTraits<MeasurementVectorType>::SetLength( tempUpperBound,
+    this->GetMeasurementVectorSize() );
+  MeasurementVectorType tempMean;
+  NumericTraits<MeasurementVectorType>::SetLength( tempMean,
+    this->GetMeasurementVectorSize() );
+
   // find most widely spread dimension
   Algorithm::FindSampleBoundAndMean< SubsampleType >(this->GetSubsample(),
                                                      beginIndex, endIndex,
-                                                     m_TempLowerBound, m_TempUpperBound,
-                                                     m_TempMean);
+                                                     tempLowerBound, tempUpperBound,
+                                                     tempMean);
 
   maxSpread = NumericTraits< MeasurementType >::NonpositiveMin();
   for ( i = 0; i < this->GetMeasurementVectorSize(); i++ )
     {
-    spread = m_TempUpperBound[i] - m_TempLowerBound[i];
+    spread = tempUpperBound[i] - tempLowerBound[i];
     if ( spread >= maxSpread )
       {
       maxSpread = spread;
@@ -116,17 +130,47 @@ WeightedCentroidKdTreeGenerator< TSample >
   dimensionLowerBound = lowerBound[partitionDimension];
   dimensionUpperBound = upperBound[partitionDimension];
 
-  upperBound[partitionDimension] = partitionValue;
-  const unsigned int beginLeftIndex = beginIndex;
-  const unsigned int endLeftIndex   = medianIndex;
-  KdTreeNodeType *   left = this->GenerateTreeLoop(beginLeftIndex, endLeftIndex, lowerBound, upperBound, level + 1);
-  upperBound[partitionDimension] = dimensionUpperBound;
-
-  lowerBound[partitionDimension] = partitionValue;
+  const unsigned int beginLeftIndex  = beginIndex;
+  const unsigned int endLeftIndex    = medianIndex;
   const unsigned int beginRightIndex = medianIndex + 1;
-  const unsigned int endRighIndex    = endIndex;
-  KdTreeNodeType *   right = this->GenerateTreeLoop(beginRightIndex, endRighIndex, lowerBound, upperBound, level + 1);
-  lowerBound[partitionDimension] = dimensionLowerBound;
+  const unsigned int endRightIndex   = endIndex;
+
+  KdTreeNodeType *left = nullptr;
+  KdTreeNodeType *right = nullptr;
+  if ( this->ShouldBuildSubtreesConcurrently(endIndex - beginIndex) )
+    {
+    // Build the left subtree on a worker thread while the right one is
+    // built here; the two cover disjoint index ranges of the subsample.
+    // The worker receives its own copies of the bounds because both
+    // branches modify them during recursion.
+    MeasurementVectorType leftLowerBound = lowerBound;
+    MeasurementVectorType leftUpperBound = upperBound;
+    leftUpperBound[partitionDimension] = partitionValue;
+    std::future< KdTreeNodeType * > leftFuture =
+      std::async(std::launch::async,
+                 [this, beginLeftIndex, endLeftIndex, level,
+                  leftLowerBound, leftUpperBound]() mutable {
+                   return this->GenerateTreeLoop(beginLeftIndex, endLeftIndex,
+                                                 leftLowerBound, leftUpperBound,
+                                                 level + 1);
+                 });
+
+    lowerBound[partitionDimension] = partitionValue;
+    right = this->GenerateTreeLoop(beginRightIndex, endRightIndex, lowerBound, upperBound, level + 1);
+    lowerBound[partitionDimension] = dimensionLowerBound;
+
+    left = leftFuture.get();
+    }
+  else
+    {
+    upperBound[partitionDimension] = partitionValue;
+    left = this->GenerateTreeLoop(beginLeftIndex, endLeftIndex, lowerBound, upperBound, level + 1);
+    upperBound[partitionDimension] = dimensionUpperBound;
+
+    lowerBound[partitionDimension] = partitionValue;
+    right = this->GenerateTreeLoop(beginRightIndex, endRightIndex, lowerBound, upperBound, level + 1);
+    lowerBound[partitionDimension] = dimensionLowerBound;
+    }
 
   using KdTreeNonterminalNodeType = KdTreeWeightedCentroidNonterminalNode< TSample >;
 
@@ -20,6 +20,11 @@
 
 #include "itkWeightedCovarianceSampleFilter.h"
 #include "itkWeightedMeanSampleFilter.h"
+#include "itkCompensatedSummation.h"
+#include "itkMultiThreaderBase.h"
+
+#include <algorithm>
+#include <vector>
 
 namespace itk
 {
@@ -212,46 +217,117 @@ WeightedCovarianceSampleFilter< TSample >
   decoratedMeanOutput->Set( mean );
 
   // covariance algorithm
-  MeasurementVectorRealType diff;
-  NumericTraits<MeasurementVectorRealType>::SetLength( diff, measurementVectorSize );
+  using MeasurementRealAccumulateType = CompensatedSummation< MeasurementRealType >;
+  using WeightAccumulateType = CompensatedSummation< WeightValueType >;
 
-  WeightValueType totalWeight = NumericTraits< WeightValueType >::ZeroValue();
+  const SizeValueType size = input->Size();
 
-  WeightValueType totalSquaredWeight = NumericTraits< WeightValueType >::ZeroValue();
+  // The sample is accumulated in chunks of a fixed size whose compensated
+  // partial sums are merged in chunk order below, so the estimate does
+  // not depend on the number of threads.
+  constexpr SizeValueType chunkSize = 65536;
+  const SizeValueType     numberOfChunks = ( size + chunkSize - 1 ) / chunkSize;
 
-  typename SampleType::ConstIterator iter =      input->Begin();
-  const typename SampleType::ConstIterator end = input->End();
+  const unsigned int numberOfLowerTriangleEntries =
+    measurementVectorSize * ( measurementVectorSize + 1 ) / 2;
 
-  // fills the lower triangle and the diagonal cells in the covariance matrix
-  for ( unsigned int sampleVectorIndex = 0;
-        iter != end;
-        ++iter, ++sampleVectorIndex )
+  std::vector< MeasurementRealAccumulateType > partialSums( numberOfChunks * numberOfLowerTriangleEntries );
+  std::vector< WeightAccumulateType >          partialWeights( numberOfChunks );
+  std::vector< WeightAccumulateType >          partialSquaredWeights( numberOfChunks );
+
+  // Every chunk traverses the sample through its own iterator copy. The
+  // list sample adaptors cache the measurement vector returned by their
+  // random access interface in a single mutable member, so index based
+  // access from several threads would race.
+  std::vector< typename SampleType::ConstIterator > chunkFirst;
+  chunkFirst.reserve( numberOfChunks );
+
+  typename SampleType::ConstIterator positionIter = input->Begin();
+  for ( SizeValueType i = 0; i < size; ++i, ++positionIter )
     {
-    const MeasurementVectorType & measurement = iter.GetMeasurementVector();
+    if ( i % chunkSize == 0 )
+      {
+      chunkFirst.push_back( positionIter );
+      }
+    }
 
-    const typename SampleType::AbsoluteFrequencyType frequency = iter.GetFrequency();
+  // accumulates the lower triangle and the diagonal cells of the
+  // covariance matrix
+  this->GetMultiThreader()->ParallelizeArray( 0, numberOfChunks,
+    [&chunkFirst, &partialSums, &partialWeights, &partialSquaredWeights,
+     &weightsArray, &mean, size, measurementVectorSize, numberOfLowerTriangleEntries]
+    ( SizeValueType chunk )
+      {
+      MeasurementVectorRealType diff;
+      NumericTraits<MeasurementVectorRealType>::SetLength( diff, measurementVectorSize );
 
-    const WeightValueType rawWeight = weightsArray[sampleVectorIndex];
+      typename SampleType::ConstIterator iter = chunkFirst[chunk];
 
-    const WeightValueType weight = ( rawWeight * static_cast< WeightValueType >( frequency ) );
-    totalWeight += weight;
-    totalSquaredWeight += ( weight * weight );
+      MeasurementRealAccumulateType *const chunkSums = &partialSums[chunk * numberOfLowerTriangleEntries];
+      WeightAccumulateType &               chunkWeight = partialWeights[chunk];
+      WeightAccumulateType &               chunkSquaredWeight = partialSquaredWeights[chunk];
 
-    for ( unsigned int dim = 0; dim < measurementVectorSize; ++dim )
-      {
-      const auto component = static_cast< MeasurementRealType >( measurement[dim] );
+      const SizeValueType last = std::min( size, ( chunk + 1 ) * chunkSize );
+      for ( SizeValueType sampleVectorIndex = chunk * chunkSize;
+            sampleVectorIndex < last;
+            ++sampleVectorIndex, ++iter )
+        {
+        const MeasurementVectorType & measurement = iter.GetMeasurementVector();
 
-      diff[dim] = ( component - mean[dim] );
-      }
+        const typename SampleType::AbsoluteFrequencyType frequency = iter.GetFrequency();
 
-    // updates the covariance matrix
-    for ( unsigned int row = 0; row < measurementVectorSize; ++row )
+        const WeightValueType rawWeight = weightsArray[sampleVectorIndex];
+
+        const WeightValueType weight = ( rawWeight * static_cast< WeightValueType >( frequency ) );
+        chunkWeight += weight;
+        chunkSquaredWeight += ( weight * weight );
+
+        for ( unsigned int dim = 0; dim < measurementVectorSize; ++dim )
+          {
+          const auto component = static_cast< MeasurementRealType >( measurement[dim] );
+
+          diff[dim] = ( component - mean[dim] );
+          }
+
+        unsigned int entry = 0;
+        for ( unsigned int row = 0; row < measurementVectorSize; ++row )
+          {
+          for ( unsigned int col = 0; col < row + 1; ++col )
+            {
+            chunkSums[entry] +=
+              ( static_cast< MeasurementRealType >( weight ) * diff[row] * diff[col] );
+            ++entry;
+            }
+          }
+        }
+      },
+    this );
+
+  // merges the partial sums in chunk order
+  WeightAccumulateType totalWeightSum;
+  WeightAccumulateType totalSquaredWeightSum;
+
+  for ( SizeValueType chunk = 0; chunk < numberOfChunks; ++chunk )
+    {
+    totalWeightSum += partialWeights[chunk].GetSum();
+    totalSquaredWeightSum += partialSquaredWeights[chunk].GetSum();
+    }
+
+  const WeightValueType totalWeight = totalWeightSum.GetSum();
+  const WeightValueType totalSquaredWeight = totalSquaredWeightSum.GetSum();
+
+  unsigned int entry = 0;
+  for ( unsigned int row = 0; row < measurementVectorSize; ++row )
+    {
+    for ( unsigned int col = 0; col < row + 1; ++col )
       {
-      for ( unsigned int col = 0; col < row + 1; ++col )
+      MeasurementRealAccumulateType accumulate;
+      for ( SizeValueType chunk = 0; chunk < numberOfChunks; ++chunk )
         {
-        output(row, col) +=
-          ( static_cast< MeasurementRealType >( weight ) * diff[row] * diff[col] );
+        accumulate += partialSums[chunk * numberOfLowerTriangleEntries + entry].GetSum();
         }
+      output(row, col) = accumulate.GetSum();
+      ++entry;
       }
     }
 
@@ -20,9 +20,12 @@
 
 #include "itkWeightedMeanSampleFilter.h"
 
+#include <algorithm>
 #include <vector>
+#include "itkColumnarListSample.h"
 #include "itkCompensatedSummation.h"
 #include "itkMeasurementVectorTraits.h"
+#include "itkMultiThreaderBase.h"
 
 namespace itk
 {
@@ -100,36 +103,125 @@ WeightedMeanSampleFilter< TSample >
 
   // algorithm start
   using MeasurementRealAccumulateType = CompensatedSummation< MeasurementRealType >;
-  std::vector< MeasurementRealAccumulateType > sum( measurementVectorSize );
+  using WeightAccumulateType = CompensatedSummation< WeightValueType >;
 
   const WeightArrayType & weightsArray = this->GetWeights();
 
-  WeightValueType totalWeight = NumericTraits< WeightValueType >::ZeroValue();
+  const SizeValueType size = input->Size();
 
-  typename SampleType::ConstIterator iter = input->Begin();
-  typename SampleType::ConstIterator end =  input->End();
+  // The sample is accumulated in chunks of a fixed size whose compensated
+  // partial sums are merged in chunk order below, so the estimate does
+  // not depend on the number of threads.
+  constexpr SizeValueType chunkSize = 65536;
+  const SizeValueType     numberOfChunks = ( size + chunkSize - 1 ) / chunkSize;
+
+  std::vector< MeasurementRealAccumulateType > partialSums( numberOfChunks * measurementVectorSize );
+  std::vector< WeightAccumulateType >          partialWeights( numberOfChunks );
 
-  for ( unsigned int sampleVectorIndex = 0;
-        iter != end;
-        ++iter, ++sampleVectorIndex )
+  // Columnar samples expose each component as one contiguous array and
+  // are accumulated straight from the columns. Other samples are
+  // traversed through per-chunk iterator copies: the list sample
+  // adaptors cache the measurement vector returned by their random
+  // access interface in a single mutable member, so index based access
+  // from several threads would race.
+  using ColumnarSampleType = ColumnarListSample< MeasurementVectorType >;
+  const auto * columnarInput = dynamic_cast< const ColumnarSampleType * >( input );
+
+  if ( columnarInput != nullptr )
     {
-    const MeasurementVectorType & measurement = iter.GetMeasurementVector();
+    this->GetMultiThreader()->ParallelizeArray( 0, numberOfChunks,
+      [columnarInput, &partialSums, &partialWeights, &weightsArray, size, measurementVectorSize]
+      ( SizeValueType chunk )
+        {
+        const SizeValueType first = chunk * chunkSize;
+        const SizeValueType last = std::min( size, ( chunk + 1 ) * chunkSize );
+
+        WeightAccumulateType & chunkWeight = partialWeights[chunk];
+        for ( SizeValueType sampleVectorIndex = first; sampleVectorIndex < last; ++sampleVectorIndex )
+          {
+          chunkWeight += weightsArray[sampleVectorIndex];
+          }
+
+        MeasurementRealAccumulateType *const chunkSum = &partialSums[chunk * measurementVectorSize];
+        for ( unsigned int dim = 0; dim < measurementVectorSize; dim++ )
+          {
+          const typename ColumnarSampleType::MeasurementType *const column =
+            columnarInput->GetComponentArray(dim);
+
+          for ( SizeValueType sampleVectorIndex = first; sampleVectorIndex < last; ++sampleVectorIndex )
+            {
+            const auto component = static_cast< MeasurementRealType >( column[sampleVectorIndex] );
+
+            chunkSum[dim] += ( component * weightsArray[sampleVectorIndex] );
+            }
+          }
+        },
+      this );
+    }
+  else
+    {
+    std::vector< typename SampleType::ConstIterator > chunkFirst;
+    chunkFirst.reserve( numberOfChunks );
 
-    const typename SampleType::AbsoluteFrequencyType frequency = iter.GetFrequency();
+    typename SampleType::ConstIterator positionIter = input->Begin();
+    for ( SizeValueType i = 0; i < size; ++i, ++positionIter )
+      {
+      if ( i % chunkSize == 0 )
+        {
+        chunkFirst.push_back( positionIter );
+        }
+      }
 
-    const WeightValueType rawWeight = weightsArray[sampleVectorIndex];
+    this->GetMultiThreader()->ParallelizeArray( 0, numberOfChunks,
+      [&chunkFirst, &partialSums, &partialWeights, &weightsArray, size, measurementVectorSize]
+      ( SizeValueType chunk )
+        {
+        typename SampleType::ConstIterator iter = chunkFirst[chunk];
 
-    const WeightValueType weight = ( rawWeight * static_cast< WeightValueType >( frequency ) );
-    totalWeight += weight;
+        MeasurementRealAccumulateType *const chunkSum = &partialSums[chunk * measurementVectorSize];
+        WeightAccumulateType &               chunkWeight = partialWeights[chunk];
+
+        const SizeValueType last = std::min( size, ( chunk + 1 ) * chunkSize );
+        for ( SizeValueType sampleVectorIndex = chunk * chunkSize;
+              sampleVectorIndex < last;
+              ++sampleVectorIndex, ++iter )
+          {
+          const MeasurementVectorType & measurement = iter.GetMeasurementVector();
 
+          const typename SampleType::AbsoluteFrequencyType frequency = iter.GetFrequency();
+
+          const WeightValueType rawWeight = weightsArray[sampleVectorIndex];
+
+          const WeightValueType weight = ( rawWeight * static_cast< WeightValueType >( frequency ) );
+          chunkWeight += weight;
+
+          for ( unsigned int dim = 0; dim < measurementVectorSize; dim++ )
+            {
+            const auto component = static_cast< MeasurementRealType >( measurement[dim] );
+
+            chunkSum[dim] += ( component * weight );
+            }
+          }
+        },
+      this );
+    }
+
+  // merge the partial sums in chunk order
+  std::vector< MeasurementRealAccumulateType > sum( measurementVectorSize );
+
+  WeightAccumulateType totalWeightSum;
+
+  for ( SizeValueType chunk = 0; chunk < numberOfChunks; ++chunk )
+    {
+    totalWeightSum += partialWeights[chunk].GetSum();
     for ( unsigned int dim = 0; dim < measurementVectorSize; dim++ )
       {
-      const auto component = static_cast< MeasurementRealType >( measurement[dim] );
-
-      sum[dim] += ( component * weight );
+      sum[dim] += partialSums[chunk * measurementVectorSize + dim].GetSum();
       }
     }
 
+  const WeightValueType totalWeight = totalWeightSum.GetSum();
+
   if ( totalWeight > itk::Math::eps )
     {
     for ( unsigned int dim = 0; dim < measurementVectorSize; dim++ )
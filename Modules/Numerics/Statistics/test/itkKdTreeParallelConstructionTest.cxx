@@ -0,0 +1,158 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkListSample.h"
+#include "itkKdTreeGenerator.h"
+#include "itkWeightedCentroidKdTreeGenerator.h"
+#include "itkMersenneTwisterRandomVariateGenerator.h"
+
+int itkKdTreeParallelConstructionTest(int, char* [])
+{
+  using MeasurementVectorType = itk::Array< float >;
+  using SampleType = itk::Statistics::ListSample< MeasurementVectorType >;
+
+  constexpr SampleType::MeasurementVectorSizeType measurementVectorSize = 2;
+  constexpr unsigned int numberOfDataPoints = 20000;
+  constexpr unsigned int numberOfQueryPoints = 100;
+  constexpr unsigned int numberOfNeighbors = 5;
+
+  using NormalGeneratorType =
+    itk::Statistics::MersenneTwisterRandomVariateGenerator;
+  NormalGeneratorType::Pointer randomGenerator = NormalGeneratorType::New();
+  randomGenerator->Initialize( 101 );
+
+  SampleType::Pointer sample = SampleType::New();
+  sample->SetMeasurementVectorSize( measurementVectorSize );
+
+  MeasurementVectorType mv( measurementVectorSize );
+  for ( unsigned int i = 0; i < numberOfDataPoints; ++i )
+    {
+    mv[0] = randomGenerator->GetNormalVariate( 0.0, 100.0 );
+    mv[1] = randomGenerator->GetNormalVariate( 0.0, 100.0 );
+    sample->PushBack( mv );
+    }
+
+  using TreeGeneratorType = itk::Statistics::KdTreeGenerator< SampleType >;
+  using TreeType = TreeGeneratorType::KdTreeType;
+
+  // Build one tree serially and one with concurrent subtree
+  // construction. The partitioning is identical in both cases, so the
+  // two trees must answer every query identically.
+  TreeGeneratorType::Pointer serialGenerator = TreeGeneratorType::New();
+  serialGenerator->SetSample( sample );
+  serialGenerator->SetBucketSize( 16 );
+  serialGenerator->Update();
+
+  TreeGeneratorType::Pointer parallelGenerator = TreeGeneratorType::New();
+  parallelGenerator->SetSample( sample );
+  parallelGenerator->SetBucketSize( 16 );
+  parallelGenerator->UseParallelConstructionOn();
+  if ( !parallelGenerator->GetUseParallelConstruction() )
+    {
+    std::cerr << "UseParallelConstruction flag was not set." << std::endl;
+    return EXIT_FAILURE;
+    }
+  parallelGenerator->Update();
+
+  TreeType::Pointer serialTree = serialGenerator->GetOutput();
+  TreeType::Pointer parallelTree = parallelGenerator->GetOutput();
+
+  std::vector< MeasurementVectorType > queries;
+  for ( unsigned int i = 0; i < numberOfQueryPoints; ++i )
+    {
+    MeasurementVectorType query( measurementVectorSize );
+    query[0] = randomGenerator->GetNormalVariate( 0.0, 100.0 );
+    query[1] = randomGenerator->GetNormalVariate( 0.0, 100.0 );
+    queries.push_back( query );
+    }
+
+  std::vector< TreeType::InstanceIdentifierVectorType > batchedResults;
+  parallelTree->Search( queries, numberOfNeighbors, batchedResults );
+  if ( batchedResults.size() != numberOfQueryPoints )
+    {
+    std::cerr << "Unexpected number of batched results: "
+              << batchedResults.size() << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  for ( unsigned int i = 0; i < numberOfQueryPoints; ++i )
+    {
+    TreeType::InstanceIdentifierVectorType serialNeighbors;
+    serialTree->Search( queries[i], numberOfNeighbors, serialNeighbors );
+
+    TreeType::InstanceIdentifierVectorType parallelNeighbors;
+    parallelTree->Search( queries[i], numberOfNeighbors, parallelNeighbors );
+
+    if ( serialNeighbors != parallelNeighbors )
+      {
+      std::cerr << "Query " << i << ": the serially and the concurrently "
+                << "built trees returned different neighbors." << std::endl;
+      return EXIT_FAILURE;
+      }
+
+    if ( batchedResults[i] != serialNeighbors )
+      {
+      std::cerr << "Query " << i << ": the batched search returned "
+                << "different neighbors." << std::endl;
+      return EXIT_FAILURE;
+      }
+    }
+
+  // Repeat the comparison with the weighted centroid generator.
+  using CentroidGeneratorType =
+    itk::Statistics::WeightedCentroidKdTreeGenerator< SampleType >;
+
+  CentroidGeneratorType::Pointer serialCentroidGenerator =
+    CentroidGeneratorType::New();
+  serialCentroidGenerator->SetSample( sample );
+  serialCentroidGenerator->SetBucketSize( 16 );
+  serialCentroidGenerator->Update();
+
+  CentroidGeneratorType::Pointer parallelCentroidGenerator =
+    CentroidGeneratorType::New();
+  parallelCentroidGenerator->SetSample( sample );
+  parallelCentroidGenerator->SetBucketSize( 16 );
+  parallelCentroidGenerator->UseParallelConstructionOn();
+  parallelCentroidGenerator->Update();
+
+  TreeType::Pointer serialCentroidTree = serialCentroidGenerator->GetOutput();
+  TreeType::Pointer parallelCentroidTree =
+    parallelCentroidGenerator->GetOutput();
+
+  for ( unsigned int i = 0; i < numberOfQueryPoints; ++i )
+    {
+    TreeType::InstanceIdentifierVectorType serialNeighbors;
+    serialCentroidTree->Search( queries[i], numberOfNeighbors,
+      serialNeighbors );
+
+    TreeType::InstanceIdentifierVectorType parallelNeighbors;
+    parallelCentroidTree->Search( queries[i], numberOfNeighbors,
+      parallelNeighbors );
+
+    if ( serialNeighbors != parallelNeighbors )
+      {
+      std::cerr << "Query " << i << ": the serially and the concurrently "
+                << "built weighted centroid trees returned different "
+                << "neighbors." << std::endl;
+      return EXIT_FAILURE;
+      }
+    }
+
+  std::cout << "Test passed." << std::endl;
+  return EXIT_SUCCESS;
+}
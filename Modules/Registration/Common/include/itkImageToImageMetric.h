@@ -245,6 +245,17 @@ public:
 
   itkGetConstReferenceMacro(UseFixedImageSamplesIntensityThreshold, bool);
 
+  /** When the fixed image mask is an ImageMaskSpatialObject, draw random
+   * samples directly from the run-length encoding of the mask instead of
+   * rejecting random fixed image positions against it. With tight masks
+   * most candidate positions fall outside the mask, so this avoids
+   * discarding the bulk of the draws. Sample points are placed at the
+   * centers of non-zero mask pixels. Ignored when an intensity threshold
+   * is in use or when the mask is another kind of spatial object. */
+  itkSetMacro(UseMaskRunLengthSampling, bool);
+  itkGetConstMacro(UseMaskRunLengthSampling, bool);
+  itkBooleanMacro(UseMaskRunLengthSampling);
+
   /** Select whether the metric will be computed using all the pixels on the
    * fixed image region, or only using a set of randomly selected pixels.
    * This value override IntensityThreshold, Masks, and SequentialSampling. */
@@ -390,6 +401,8 @@ public:
   bool m_UseAllPixels{false};
   bool m_UseSequentialSampling{false};
 
+  bool m_UseMaskRunLengthSampling{false};
+
   bool m_ReseedIterator{false};
 
   mutable int m_RandomSeed;
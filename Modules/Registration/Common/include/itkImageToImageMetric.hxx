@@ -19,6 +19,7 @@
 #define itkImageToImageMetric_hxx
 
 #include "itkImageToImageMetric.h"
+#include "itkImageMaskSpatialObject.h"
 #include "itkImageRandomConstIteratorWithIndex.h"
 #include "itkMath.h"
 
@@ -534,6 +535,80 @@ ImageToImageMetric< TFixedImage, TMovingImage >
                           "Sample size does not match desired number of samples");
     }
 
+  if ( m_UseMaskRunLengthSampling && m_FixedImageMask.IsNotNull()
+       && !m_UseFixedImageSamplesIntensityThreshold )
+    {
+    using MaskObjectType = ImageMaskSpatialObject< Self::FixedImageDimension >;
+    const auto *maskObject =
+      dynamic_cast< const MaskObjectType * >( m_FixedImageMask.GetPointer() );
+    if ( maskObject != nullptr && maskObject->GetNumberOfOnPixels() > 0 )
+      {
+      if ( !m_ReseedIterator )
+        {
+        Statistics::MersenneTwisterRandomVariateGenerator::GetInstance()
+        ->SetSeed(m_RandomSeed++);
+        }
+
+      const FixedImageRegionType & fixedRegion = GetFixedImageRegion();
+
+      std::vector< typename MaskObjectType::PointType > maskPoints;
+      typename FixedImageSampleContainer::iterator iter = samples.begin();
+      typename FixedImageSampleContainer::const_iterator end = samples.end();
+      SizeValueType samplesFound = 0;
+      SizeValueType draws = 0;
+      const SizeValueType maximumNumberOfDraws =
+        m_NumberOfFixedImageSamples * 1000;
+      while ( iter != end && draws < maximumNumberOfDraws )
+        {
+        // The runs guarantee every drawn point is inside the mask, but
+        // the mask may extend beyond the fixed image region
+        maskObject->DrawSamples(m_NumberOfFixedImageSamples - samplesFound,
+                                maskPoints);
+        draws += maskPoints.size();
+        for ( auto pointIter = maskPoints.begin();
+              iter != end && pointIter != maskPoints.end(); ++pointIter )
+          {
+          FixedImageIndexType index;
+          m_FixedImage->TransformPhysicalPointToIndex(*pointIter, index);
+          if ( !fixedRegion.IsInside(index) )
+            {
+            continue;
+            }
+          ( *iter ).point = *pointIter;
+          ( *iter ).value = m_FixedImage->GetPixel(index);
+          ( *iter ).valueIndex = 0;
+          ++samplesFound;
+          ++iter;
+          }
+        }
+
+      if ( iter != end )
+        {
+        if ( samplesFound == 0 )
+          {
+          throw ExceptionObject(__FILE__, __LINE__,
+                                "Fixed image mask does not overlap the fixed image region");
+          }
+        // Must be a small overlap, replicate the samples found so far
+        // to fill-in the desired number of samples
+        SizeValueType count = 0;
+        while ( iter != end )
+          {
+          ( *iter ).point = samples[count].point;
+          ( *iter ).value = samples[count].value;
+          ( *iter ).valueIndex = 0;
+          ++count;
+          if ( count >= samplesFound )
+            {
+            count = 0;
+            }
+          ++iter;
+          }
+        }
+      return;
+      }
+    }
+
   // Set up a random interator within the user specified fixed image region.
   using RandomIterator = ImageRandomConstIteratorWithIndex< FixedImageType >;
   RandomIterator randIter( m_FixedImage, GetFixedImageRegion() );
@@ -1505,6 +1580,9 @@ ImageToImageMetric< TFixedImage, TMovingImage >
   os << indent << "UseAllPixels: ";
   os << m_UseAllPixels << std::endl;
 
+  os << indent << "UseMaskRunLengthSampling: ";
+  os << m_UseMaskRunLengthSampling << std::endl;
+
   os << indent << "ReseedIterator: " << m_ReseedIterator << std::endl;
   os << indent << "RandomSeed: " << m_RandomSeed << std::endl;
 
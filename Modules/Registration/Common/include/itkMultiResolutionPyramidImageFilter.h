@@ -21,6 +21,9 @@
 #include "itkImageToImageFilter.h"
 #include "itkArray2D.h"
 
+#include <type_traits>
+#include <vector>
+
 namespace itk
 {
 /** \class MultiResolutionPyramidImageFilter
@@ -231,6 +234,48 @@ protected:
   ScheduleType m_Schedule;
 
   bool m_UseShrinkImageFilter;
+
+private:
+  /** Whether the fused smooth-and-shrink engine applies: both pixel
+   * types must be arithmetic scalars stored contiguously in the image
+   * buffer, which excludes VectorImage, the image adaptors and
+   * aggregate pixel types. */
+  using FusedSmoothShrinkIsPossibleType =
+    std::integral_constant< bool,
+      std::is_arithmetic< typename TInputImage::PixelType >::value
+      && std::is_arithmetic< typename TOutputImage::PixelType >::value
+      && std::is_same< typename TInputImage::InternalPixelType,
+                       typename TInputImage::PixelType >::value
+      && std::is_same< typename TOutputImage::InternalPixelType,
+                       typename TOutputImage::PixelType >::value >;
+
+  /** Compute every level with one smooth-and-decimate pass per
+   * dimension, evaluating the Gaussian kernel only at the sample
+   * positions that survive the subsequent shrink (polyphase
+   * filtering).  The false_type overload keeps the mini-pipeline for
+   * images the fused engine cannot handle. */
+  void FusedGenerateData(std::true_type fusedSmoothShrinkIsPossible);
+  void FusedGenerateData(std::false_type fusedSmoothShrinkIsPossible);
+
+  /** Mini-pipeline implementation: cast, smooth every level with
+   * DiscreteGaussianImageFilter and downsample with either
+   * ShrinkImageFilter or ResampleImageFilter. */
+  void MiniPipelineGenerateData();
+
+  /** Run one polyphase pass: convolve the kernel along the given axis
+   * at the decimated sample positions only, writing an image whose
+   * extent along that axis is the output level extent.  The first tap
+   * of an output sample k sits at input index k * factor +
+   * firstTapOffset; taps outside the input buffer are clamped to the
+   * boundary, the zero-flux Neumann condition of the Gaussian
+   * smoother. */
+  template< typename TPassInputImage, typename TPassOutputImage >
+  void SmoothAndDecimateAxis(const TPassInputImage *passInput,
+                             TPassOutputImage *passOutput,
+                             unsigned int axis,
+                             const std::vector< double > & kernel,
+                             IndexValueType firstTapOffset,
+                             unsigned int factor);
 };
 } // namespace itk
 
@@ -26,9 +26,15 @@
 #include "itkResampleImageFilter.h"
 #include "itkShrinkImageFilter.h"
 #include "itkIdentityTransform.h"
+#include "itkImage.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkMultiThreaderBase.h"
 
 #include "itkMath.h"
 
+#include <algorithm>  // For max and min.
+#include <cmath>      // For floor.
+
 namespace itk
 {
 /**
@@ -244,6 +250,247 @@ template< typename TInputImage, typename TOutputImage >
 void
 MultiResolutionPyramidImageFilter< TInputImage, TOutputImage >
 ::GenerateData()
+{
+  // Use the fused smooth-and-decimate engine when the image layouts
+  // permit it; otherwise run the cast / smooth / shrink mini-pipeline.
+  this->FusedGenerateData( FusedSmoothShrinkIsPossibleType() );
+}
+
+template< typename TInputImage, typename TOutputImage >
+void
+MultiResolutionPyramidImageFilter< TInputImage, TOutputImage >
+::FusedGenerateData(std::false_type itkNotUsed(fusedSmoothShrinkIsPossible))
+{
+  this->MiniPipelineGenerateData();
+}
+
+template< typename TInputImage, typename TOutputImage >
+void
+MultiResolutionPyramidImageFilter< TInputImage, TOutputImage >
+::FusedGenerateData(std::true_type itkNotUsed(fusedSmoothShrinkIsPossible))
+{
+  InputImageConstPointer inputPtr = this->GetInput();
+
+  // The per axis passes accumulate in the real type and hand each
+  // other real valued intermediates, as DiscreteGaussianImageFilter
+  // does between its directional passes.
+  using OutputPixelType = typename TOutputImage::PixelType;
+  using RealPixelType = typename NumericTraits< OutputPixelType >::RealType;
+  using RealImageType = Image< RealPixelType, ImageDimension >;
+  using RegionType = typename TOutputImage::RegionType;
+  using OperatorType = GaussianOperator< RealPixelType, ImageDimension >;
+
+  OperatorType oper;
+
+  unsigned int ilevel, idim;
+
+  for ( ilevel = 0; ilevel < m_NumberOfLevels; ilevel++ )
+    {
+    this->UpdateProgress( static_cast< float >( ilevel )
+                          / static_cast< float >( m_NumberOfLevels ) );
+
+    // Allocate memory for each output
+    OutputImagePointer outputPtr = this->GetOutput(ilevel);
+    outputPtr->SetBufferedRegion( outputPtr->GetRequestedRegion() );
+    outputPtr->Allocate();
+
+    // The shrink stage samples the smoothed image at input index
+    // outputIndex * factor + offset per axis.  Recover the offset the
+    // way ShrinkImageFilter does, by mapping the first output index
+    // into the input grid; the resample path needs the continuous
+    // position since ResampleImageFilter interpolates linearly there.
+    const typename TOutputImage::IndexType outputIndex0 =
+      outputPtr->GetLargestPossibleRegion().GetIndex();
+
+    typename TOutputImage::PointType outputPoint;
+    outputPtr->TransformIndexToPhysicalPoint(outputIndex0, outputPoint);
+
+    typename TInputImage::IndexType inputIndex0;
+    ContinuousIndex< double, ImageDimension > inputContinuousIndex0;
+    if ( this->GetUseShrinkImageFilter() )
+      {
+      inputPtr->TransformPhysicalPointToIndex(outputPoint, inputIndex0);
+      }
+    else
+      {
+      inputPtr->TransformPhysicalPointToContinuousIndex(outputPoint,
+                                                        inputContinuousIndex0);
+      }
+
+    typename RealImageType::Pointer passInputReal;
+    RegionType currentRegion = inputPtr->GetBufferedRegion();
+
+    for ( idim = 0; idim < ImageDimension; idim++ )
+      {
+      const unsigned int factor = m_Schedule[ilevel][idim];
+
+      // Same kernel the mini-pipeline smoother would apply.
+      oper.SetDirection(idim);
+      oper.SetVariance( itk::Math::sqr( 0.5
+                                      * static_cast< float >( factor ) ) );
+      oper.SetMaximumError(m_MaximumError);
+      // the DiscreteGaussianImageFilter default
+      oper.SetMaximumKernelWidth(32);
+      oper.CreateDirectional();
+
+      const auto radius =
+        static_cast< IndexValueType >( oper.GetRadius()[idim] );
+
+      std::vector< double > kernel( oper.Begin(), oper.End() );
+
+      IndexValueType sampleOffset;
+      if ( this->GetUseShrinkImageFilter() )
+        {
+        sampleOffset = std::max( IndexValueType(0),
+          inputIndex0[idim]
+          - outputIndex0[idim] * static_cast< IndexValueType >( factor ) );
+        }
+      else
+        {
+        const double continuousOffset = inputContinuousIndex0[idim]
+          - static_cast< double >( outputIndex0[idim] ) * factor;
+        double phase = continuousOffset - std::floor(continuousOffset);
+        sampleOffset =
+          static_cast< IndexValueType >( std::floor(continuousOffset) );
+        if ( phase > 1.0 - 1e-8 )
+          {
+          ++sampleOffset;
+          phase = 0.0;
+          }
+        if ( phase > 1e-8 )
+          {
+          // Even factors sample halfway between input pixels; fold the
+          // two linear interpolation taps into the kernel.
+          std::vector< double > merged( kernel.size() + 1 );
+          merged[0] = ( 1.0 - phase ) * kernel[0];
+          for ( size_t i = 1; i < kernel.size(); i++ )
+            {
+            merged[i] = ( 1.0 - phase ) * kernel[i] + phase * kernel[i - 1];
+            }
+          merged[kernel.size()] = phase * kernel.back();
+          kernel.swap(merged);
+          }
+        }
+      const IndexValueType firstTapOffset = sampleOffset - radius;
+
+      // This pass decimates axis idim down to the output level extent.
+      RegionType passRegion = currentRegion;
+      passRegion.SetIndex( idim,
+        outputPtr->GetRequestedRegion().GetIndex(idim) );
+      passRegion.SetSize( idim,
+        outputPtr->GetRequestedRegion().GetSize(idim) );
+
+      typename RealImageType::Pointer passOutputReal;
+      if ( idim < ImageDimension - 1 )
+        {
+        passOutputReal = RealImageType::New();
+        passOutputReal->SetRegions(passRegion);
+        passOutputReal->Allocate();
+        }
+
+      if ( idim == 0 )
+        {
+        if ( idim == ImageDimension - 1 )
+          {
+          this->SmoothAndDecimateAxis( inputPtr.GetPointer(),
+            outputPtr.GetPointer(), idim, kernel, firstTapOffset, factor );
+          }
+        else
+          {
+          this->SmoothAndDecimateAxis( inputPtr.GetPointer(),
+            passOutputReal.GetPointer(), idim, kernel, firstTapOffset,
+            factor );
+          }
+        }
+      else if ( idim == ImageDimension - 1 )
+        {
+        this->SmoothAndDecimateAxis( passInputReal.GetPointer(),
+          outputPtr.GetPointer(), idim, kernel, firstTapOffset, factor );
+        }
+      else
+        {
+        this->SmoothAndDecimateAxis( passInputReal.GetPointer(),
+          passOutputReal.GetPointer(), idim, kernel, firstTapOffset,
+          factor );
+        }
+
+      passInputReal = passOutputReal;
+      currentRegion = passRegion;
+      }
+    }
+}
+
+template< typename TInputImage, typename TOutputImage >
+template< typename TPassInputImage, typename TPassOutputImage >
+void
+MultiResolutionPyramidImageFilter< TInputImage, TOutputImage >
+::SmoothAndDecimateAxis(const TPassInputImage *passInput,
+                        TPassOutputImage *passOutput,
+                        unsigned int axis,
+                        const std::vector< double > & kernel,
+                        IndexValueType firstTapOffset,
+                        unsigned int factor)
+{
+  using PassInputPixelType = typename TPassInputImage::PixelType;
+  using PassOutputPixelType = typename TPassOutputImage::PixelType;
+  using PassRegionType = typename TPassOutputImage::RegionType;
+
+  const typename TPassInputImage::RegionType inputRegion =
+    passInput->GetBufferedRegion();
+  const IndexValueType axisFirst = inputRegion.GetIndex(axis);
+  const IndexValueType axisLast = axisFirst
+    + static_cast< IndexValueType >( inputRegion.GetSize(axis) ) - 1;
+  const OffsetValueType axisStride = passInput->GetOffsetTable()[axis];
+  const PassInputPixelType *inputBuffer = passInput->GetBufferPointer();
+
+  this->GetMultiThreader()->template ParallelizeImageRegion< ImageDimension >(
+    passOutput->GetBufferedRegion(),
+    [passInput, passOutput, axis, &kernel, firstTapOffset, factor,
+     axisFirst, axisLast, axisStride, inputBuffer]
+    (const PassRegionType & regionForThread) {
+      const size_t numberOfTaps = kernel.size();
+
+      ImageRegionIteratorWithIndex< TPassOutputImage >
+        outIt(passOutput, regionForThread);
+
+      typename TPassInputImage::IndexType inputIndex;
+
+      while ( !outIt.IsAtEnd() )
+        {
+        const typename TPassOutputImage::IndexType outputIndex =
+          outIt.GetIndex();
+        for ( unsigned int j = 0; j < ImageDimension; j++ )
+          {
+          inputIndex[j] = outputIndex[j];
+          }
+        inputIndex[axis] = axisFirst;
+        const OffsetValueType rowOffset = passInput->ComputeOffset(inputIndex);
+
+        const IndexValueType firstTap = outputIndex[axis]
+          * static_cast< IndexValueType >( factor ) + firstTapOffset;
+
+        double sum = 0.0;
+        for ( size_t i = 0; i < numberOfTaps; i++ )
+          {
+          // Clamp out of bounds taps to the boundary, matching the
+          // zero-flux Neumann condition of the smoother.
+          IndexValueType tap = firstTap + static_cast< IndexValueType >( i );
+          tap = std::min( std::max( tap, axisFirst ), axisLast );
+          sum += kernel[i] * static_cast< double >(
+            inputBuffer[rowOffset + ( tap - axisFirst ) * axisStride] );
+          }
+
+        outIt.Set( static_cast< PassOutputPixelType >( sum ) );
+        ++outIt;
+        }
+    },
+    nullptr);
+}
+
+template< typename TInputImage, typename TOutputImage >
+void
+MultiResolutionPyramidImageFilter< TInputImage, TOutputImage >
+::MiniPipelineGenerateData()
 {
   // Get the input and output pointers
   InputImageConstPointer inputPtr = this->GetInput();
@@ -89,12 +89,25 @@ public:
   /** Set/Get the points from which the bounding box should be computed. */
   itkGetModifiableObjectMacro(Points, PointsContainer );
 
+  /** Build the kd-tree with the concurrent construction path of the
+   * KdTreeGenerator. The resulting tree is identical to a serially built
+   * one; only the time spent in Initialize() changes. Off by default. */
+  itkSetMacro( UseParallelConstruction, bool );
+  itkGetConstMacro( UseParallelConstruction, bool );
+  itkBooleanMacro( UseParallelConstruction );
+
   /** Compute the kd-tree that will facilitate the querying the points. */
   void Initialize();
 
   /** Find the closest point */
   PointIdentifier FindClosestPoint( const PointType &query ) const;
 
+  /** Find the closest point for every query of a batch. The queries are
+   * independent and are answered in parallel; entry i of the result is
+   * the id of the point closest to query i. */
+  void FindClosestPoints( const std::vector<PointType> &queries,
+    std::vector<PointIdentifier> &identifiers ) const;
+
   /** Find the k-nearest neighbors.  Returns the point ids. */
   void Search( const PointType &, unsigned int, NeighborsIdentifierType & )
     const;
@@ -103,6 +116,11 @@ public:
   void FindClosestNPoints( const PointType &, unsigned int,
     NeighborsIdentifierType & ) const;
 
+  /** Find the closest N points for every query of a batch, in parallel.
+   * Entry i of the result holds the point ids for query i. */
+  void FindClosestNPoints( const std::vector<PointType> &, unsigned int,
+    std::vector<NeighborsIdentifierType> & ) const;
+
   /** Find all the points within a specified radius.  Returns the point ids. */
   void Search( const PointType &, double, NeighborsIdentifierType & ) const;
 
@@ -120,6 +138,7 @@ private:
   SampleAdaptorPointer     m_SampleAdaptor;
   TreeGeneratorPointer     m_KdTreeGenerator;
   TreeConstPointer         m_Tree;
+  bool                     m_UseParallelConstruction;
 };
 
 } // end namespace itk
@@ -28,6 +28,7 @@ PointsLocator<TPointsContainer>
 {
   this->m_SampleAdaptor = SampleAdaptorType::New();
   this->m_KdTreeGenerator = TreeGeneratorType::New();
+  this->m_UseParallelConstruction = false;
 }
 
 template<typename TPointsContainer>
@@ -59,6 +60,7 @@ PointsLocator<TPointsContainer>
 
   this->m_KdTreeGenerator->SetSample( this->m_SampleAdaptor );
   this->m_KdTreeGenerator->SetBucketSize( 16 );
+  this->m_KdTreeGenerator->SetUseParallelConstruction( this->m_UseParallelConstruction );
 
   this->m_KdTreeGenerator->Update();
 
@@ -77,6 +79,23 @@ PointsLocator<TPointsContainer>
   return identifiers[0];
 }
 
+template<
+  typename TPointsContainer>
+void
+PointsLocator<TPointsContainer>
+::FindClosestPoints( const std::vector<PointType> &queries,
+  std::vector<PointIdentifier> &identifiers ) const
+{
+  std::vector<NeighborsIdentifierType> neighbors;
+  this->m_Tree->Search( queries, 1u, neighbors );
+
+  identifiers.resize( queries.size() );
+  for( size_t i = 0; i < neighbors.size(); i++ )
+    {
+    identifiers[i] = neighbors[i][0];
+    }
+}
+
 template<
   typename TPointsContainer>
 void
@@ -113,6 +132,24 @@ PointsLocator<TPointsContainer>
   this->m_Tree->Search( query, N, identifiers );
 }
 
+template<
+  typename TPointsContainer>
+void
+PointsLocator<TPointsContainer>
+::FindClosestNPoints( const std::vector<PointType> &queries, unsigned int
+  numberOfNeighborsRequested, std::vector<NeighborsIdentifierType> &identifiers ) const
+{
+  unsigned int N = numberOfNeighborsRequested;
+  if( N > this->m_Points->Size() )
+    {
+    N = this->m_Points->Size();
+
+    itkWarningMacro( "The number of requested neighbors is greater than the "
+     << "total number of points.  Only returning " << N << " points." );
+    }
+  this->m_Tree->Search( queries, N, identifiers );
+}
+
 template<
   typename TPointsContainer>
 void
@@ -143,6 +180,7 @@ PointsLocator<TPointsContainer>
 ::PrintSelf( std::ostream& os, Indent indent ) const
 {
   Superclass::PrintSelf( os, indent );
+  os << indent << "UseParallelConstruction: " << this->m_UseParallelConstruction << std::endl;
 }
 
 } // end namespace itk
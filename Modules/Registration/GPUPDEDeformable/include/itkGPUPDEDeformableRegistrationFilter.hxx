@@ -412,11 +412,31 @@ GPUPDEDeformableRegistrationFilter<TFixedImage, TMovingImage, TDisplacementField
                                            * (localSize[indir] + GPUSmoothingKernelSizes[indir] - 1), nullptr);
 
     // launch kernel
-    this->m_GPUKernelManager->LaunchKernel(m_SmoothDisplacementFieldGPUKernelHandle,
-                                           (int)TDisplacementField::ImageDimension, globalSize,
-                                           localSize );
+    if( this->GetMultiDeviceEnabled() )
+      {
+      // each pass reads the halo written by the previous one, possibly
+      // on another device; LaunchKernelAcrossDevices synchronizes the
+      // queues per pass so the chunks see a coherent input buffer
+      this->LaunchKernelAcrossDevices(m_SmoothDisplacementFieldGPUKernelHandle,
+                                      (int)TDisplacementField::ImageDimension, globalSize,
+                                      localSize );
+      }
+    else
+      {
+      // enqueue without blocking; the in-order command queue already
+      // orders the directional passes after each other, so the host
+      // only waits once per smoothing call instead of once per pass
+      this->m_GPUKernelManager->LaunchKernelWithOffset(m_SmoothDisplacementFieldGPUKernelHandle,
+                                                       (int)TDisplacementField::ImageDimension, globalSize,
+                                                       localSize, nullptr );
+      }
     } // for smoothing direction indir
 
+  if( !this->GetMultiDeviceEnabled() )
+    {
+    this->m_GPUKernelManager->SynchronizeCommandQueue( this->m_GPUKernelManager->GetCurrentCommandQueueID() );
+    }
+
   if( ImageDim % 2 != 0 ) // swap the final result if ImageDim is odd
     {
     DisplacementFieldPointer swapPtr = DisplacementFieldType::New();
@@ -31,6 +31,9 @@
 #include "itkPointSet.h"
 #include "itkDefaultConvertPixelTraits.h"
 #include "itkDefaultImageToImageMetricTraitsv4.h"
+#include "itkMersenneTwisterRandomVariateGenerator.h"
+
+#include <vector>
 
 namespace itk
 {
@@ -431,6 +434,27 @@ public:
   itkGetConstReferenceMacro(UseVirtualSampledPointSet, bool);
   itkBooleanMacro(UseVirtualSampledPointSet);
 
+  /** Set/Get the number of points drawn per evaluation for stochastic
+   * (minibatch) sampling. When non-zero and a sampled point set is in
+   * use, the full virtual sampled point set is kept aside during
+   * Initialize() and a random subset of this many points, drawn with
+   * replacement, becomes the active point set before every call to
+   * GetValue or GetValueAndDerivative. The value and derivative are
+   * averaged over the valid points of the subset as usual, giving an
+   * unbiased but noisy estimate of the full-set result. Intended for
+   * stochastic gradient descent style optimization, where many cheap
+   * noisy gradient evaluations replace few exact ones. Zero, the
+   * default, disables the resampling and the full sampled point set
+   * is evaluated every time. */
+  itkSetMacro(NumberOfStochasticSamples, SizeValueType);
+  itkGetConstReferenceMacro(NumberOfStochasticSamples, SizeValueType);
+
+  /** Reinitialize the seed of the random number generator that draws
+   * the stochastic samples. The seedless form seeds from the wall
+   * clock, making the drawn subsets differ from run to run. */
+  void ReinitializeStochasticSamplingSeed();
+  void ReinitializeStochasticSamplingSeed(int seed);
+
 #if !defined(ITK_LEGACY_REMOVE)
   /** UseFixedSampledPointSet is deprecated and has been replaced
   * with UseSampledPointsSet. */
@@ -464,6 +488,21 @@ public:
   itkGetConstReferenceMacro(UseMovingImageGradientFilter, bool);
   itkBooleanMacro(UseMovingImageGradientFilter);
 
+  /** Set/Get the option for caching the fixed-image evaluations over the
+   * virtual domain. When enabled, the mapped fixed points, fixed pixel
+   * values and, when the gradient source includes the fixed image, fixed
+   * gradients are precomputed during Initialize() and reused at every call
+   * to GetValue or GetValueAndDerivative, rather than being re-evaluated
+   * for each iteration. This assumes the fixed transform and fixed image
+   * do not change between Initialize() and the metric evaluations, which
+   * holds during a registration level and matches the assumption already
+   * made for the precomputed fixed gradient image. The cache stores an
+   * entry for every pixel of the virtual domain, so it trades memory for
+   * per-iteration speed. Off by default. */
+  itkSetMacro(UseFixedImageSampleCache, bool);
+  itkGetConstReferenceMacro(UseFixedImageSampleCache, bool);
+  itkBooleanMacro(UseFixedImageSampleCache);
+
   /** Get number of work units to used in the the most recent
    * evaluation.  Only valid after GetValueAndDerivative() or
    * GetValue() has been called. */
@@ -638,6 +677,32 @@ protected:
                          MovingImagePointType & mappedMovingPoint,
                          MovingImagePixelType & mappedMovingPixelValue ) const;
 
+  /** Look up the precomputed fixed-image evaluation for a virtual domain
+   * point. Returns false when the cache holds no entry for this point, in
+   * which case the caller must evaluate directly. On a cache hit,
+   * \c pointIsValid reports whether the mapped point passed the mask and
+   * image buffer checks, and the remaining parameters are assigned only
+   * when it did. The gradient is assigned only when gradients were cached,
+   * i.e. when the gradient source included the fixed image at the time the
+   * cache was built. */
+  bool GetCachedFixedPointEvaluation( const VirtualIndexType & virtualIndex,
+                         const VirtualPointType & virtualPoint,
+                         bool & pointIsValid,
+                         FixedImagePointType & mappedFixedPoint,
+                         FixedImagePixelType & mappedFixedPixelValue,
+                         FixedImageGradientType & mappedFixedImageGradient ) const;
+
+  /** Precompute the fixed-image evaluations over the virtual domain, or
+   * over the sampled point set when sparse sampling is in use, and store
+   * them in the sample cache. Called from Initialize() when
+   * UseFixedImageSampleCache is enabled. */
+  virtual void ComputeFixedImageSampleCache();
+
+  /** Draw a fresh random subset of the full virtual sampled point set
+   * and make it the active virtual sampled point set. Called before
+   * each evaluation when stochastic sampling is enabled. */
+  virtual void ResampleVirtualSampledPointSet();
+
   /** Compute image derivatives for a Fixed point. */
   virtual void ComputeFixedImageGradientAtPoint( const FixedImagePointType & mappedPoint, FixedImageGradientType & gradient ) const;
 
@@ -733,6 +798,14 @@ protected:
   FixedSampledPointSet */
   bool                                    m_UseVirtualSampledPointSet;
 
+  /** Stochastic (minibatch) sampling. The full virtual sampled point
+   * set is kept aside so the active set can be re-drawn from it before
+   * each evaluation. */
+  SizeValueType                           m_NumberOfStochasticSamples;
+  VirtualPointSetPointer                  m_FullVirtualSampledPointSet;
+  typename Statistics::MersenneTwisterRandomVariateGenerator::Pointer
+                                          m_StochasticSamplingGenerator;
+
   ImageToImageMetricv4();
   ~ImageToImageMetricv4() override;
 
@@ -742,6 +815,12 @@ private:
   /** Map the fixed point set samples to the virtual domain */
   void MapFixedSampledPointSetToVirtual();
 
+  /** Evaluate one virtual domain point and store the result in the
+   * sample cache. */
+  void CacheFixedPointEvaluation( const VirtualIndexType & virtualIndex,
+                                  const VirtualPointType & virtualPoint,
+                                  const bool cacheGradients );
+
   /** Transform a point. Avoid cast if possible */
   void LocalTransformPoint(const typename FixedTransformType::OutputPointType &virtualPoint,
                            typename FixedTransformType::OutputPointType &mappedFixedPoint) const
@@ -796,6 +875,18 @@ private:
   bool                m_UseFloatingPointCorrection;
   DerivativeValueType m_FloatingPointCorrectionResolution;
 
+  /** Flag and storage for the optional fixed-image sample cache. The
+   * parallel arrays are indexed by the offset of the virtual index within
+   * the virtual domain buffered region. Unvisited slots remain unoccupied
+   * when sparse sampling is in use. */
+  bool                                  m_UseFixedImageSampleCache;
+  std::vector< VirtualPointType >       m_FixedImageSampleCacheVirtualPoints;
+  std::vector< FixedImagePointType >    m_FixedImageSampleCacheFixedPoints;
+  std::vector< FixedImagePixelType >    m_FixedImageSampleCacheValues;
+  std::vector< FixedImageGradientType > m_FixedImageSampleCacheGradients;
+  std::vector< bool >                   m_FixedImageSampleCacheOccupied;
+  std::vector< bool >                   m_FixedImageSampleCacheValidity;
+
   MetricTraits m_MetricTraits;
 
   /** Flag to know if derivative should be calculated */
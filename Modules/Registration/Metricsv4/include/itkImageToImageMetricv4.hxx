@@ -24,6 +24,7 @@
 #include "itkCompositeTransform.h"
 #include "itkLinearInterpolateImageFunction.h"
 #include "itkIdentityTransform.h"
+#include "itkImageRegionConstIteratorWithIndex.h"
 
 namespace itk
 {
@@ -65,6 +66,11 @@ ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputat
   this->m_UseMovingImageGradientFilter = true;
   this->m_UseSampledPointSet      = false;
   this->m_UseVirtualSampledPointSet      = false;
+  this->m_UseFixedImageSampleCache = false;
+
+  this->m_NumberOfStochasticSamples = 0;
+  this->m_StochasticSamplingGenerator = Statistics::MersenneTwisterRandomVariateGenerator::New();
+  this->m_StochasticSamplingGenerator->SetSeed( Statistics::MersenneTwisterRandomVariateGenerator::GetNextSeed() );
 
   this->m_FloatingPointCorrectionResolution = 1e6;
   this->m_UseFloatingPointCorrection = false;
@@ -149,6 +155,22 @@ ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputat
     this->MapFixedSampledPointSetToVirtual();
     }
 
+  /* When stochastic sampling is enabled, keep the full sampled point set
+   * aside so a fresh subset can be drawn from it before each evaluation.
+   * The first subset is drawn lazily by InitializeForIteration, so
+   * anything below that walks the sampled points, such as the fixed-image
+   * sample cache, still sees the full set. */
+  if( this->m_NumberOfStochasticSamples > 0 )
+    {
+    if( ! this->m_UseSampledPointSet )
+      {
+      itkExceptionMacro("Stochastic sampling requires a sampled point set. "
+                        "Enable UseSampledPointSet and provide a fixed or "
+                        "virtual sampled point set.");
+      }
+    this->m_FullVirtualSampledPointSet = this->m_VirtualSampledPointSet;
+    }
+
   /* Inititialize interpolators. */
   itkDebugMacro("Initialize Interpolators");
   this->m_FixedInterpolator->SetInputImage( this->m_FixedImage );
@@ -190,6 +212,15 @@ ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputat
     itkDebugMacro("Initialize: ComputeMovingImageGradientFilterImage");
     this->ComputeMovingImageGradientFilterImage();
     }
+
+  /* Precompute the fixed-image evaluations for reuse at each iteration.
+   * As with the fixed gradient image above, this only needs to be
+   * done once per call to Initialize. */
+  if( this->m_UseFixedImageSampleCache )
+    {
+    itkDebugMacro("Initialize: ComputeFixedImageSampleCache");
+    this->ComputeFixedImageSampleCache();
+    }
 }
 
 template<typename TFixedImage,typename TMovingImage,typename TVirtualImage, typename TInternalComputationValueType, typename TMetricTraits>
@@ -266,6 +297,14 @@ void
 ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputationValueType, TMetricTraits>
 ::InitializeForIteration() const
 {
+  /* Draw a fresh minibatch of sampled points for this evaluation. The
+   * cast away from const follows the same convention used when handing
+   * the metric to the threaders in GetValueAndDerivativeExecute. */
+  if( this->m_NumberOfStochasticSamples > 0 && this->m_UseSampledPointSet )
+    {
+    const_cast< Self * >( this )->ResampleVirtualSampledPointSet();
+    }
+
   if( this->m_ComputeDerivative )
     {
     /* This size always comes from the active transform */
@@ -365,6 +404,118 @@ ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputat
   return pointIsValid;
 }
 
+template<typename TFixedImage,typename TMovingImage,typename TVirtualImage, typename TInternalComputationValueType, typename TMetricTraits>
+void
+ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputationValueType, TMetricTraits>
+::ComputeFixedImageSampleCache()
+{
+  const SizeValueType numberOfSlots = this->GetVirtualImage()->GetBufferedRegion().GetNumberOfPixels();
+  const bool cacheGradients = this->GetGradientSourceIncludesFixed();
+
+  this->m_FixedImageSampleCacheVirtualPoints.resize( numberOfSlots );
+  this->m_FixedImageSampleCacheFixedPoints.resize( numberOfSlots );
+  this->m_FixedImageSampleCacheValues.resize( numberOfSlots );
+  if( cacheGradients )
+    {
+    this->m_FixedImageSampleCacheGradients.resize( numberOfSlots );
+    }
+  else
+    {
+    this->m_FixedImageSampleCacheGradients.clear();
+    }
+  this->m_FixedImageSampleCacheOccupied.assign( numberOfSlots, false );
+  this->m_FixedImageSampleCacheValidity.assign( numberOfSlots, false );
+
+  if( this->m_UseSampledPointSet )
+    {
+    /* Cache only the sampled points. Slots for unsampled indecies stay
+     * unoccupied, and lookups for them fall back to direct evaluation. */
+    const SizeValueType numberOfPoints = this->m_VirtualSampledPointSet->GetNumberOfPoints();
+    for( SizeValueType i = 0; i < numberOfPoints; i++ )
+      {
+      const VirtualPointType & virtualPoint = this->m_VirtualSampledPointSet->GetPoint( i );
+      VirtualIndexType virtualIndex;
+      if( this->TransformPhysicalPointToVirtualIndex( virtualPoint, virtualIndex ) )
+        {
+        this->CacheFixedPointEvaluation( virtualIndex, virtualPoint, cacheGradients );
+        }
+      }
+    }
+  else
+    {
+    /* Walk the virtual region densely, deriving points the same way the
+     * dense threader does so that cached entries match its queries. */
+    using IteratorType = ImageRegionConstIteratorWithIndex< VirtualImageType >;
+    VirtualPointType virtualPoint;
+    for( IteratorType it( this->GetVirtualImage(), this->GetVirtualRegion() ); !it.IsAtEnd(); ++it )
+      {
+      const VirtualIndexType & virtualIndex = it.GetIndex();
+      this->GetVirtualImage()->TransformIndexToPhysicalPoint( virtualIndex, virtualPoint );
+      this->CacheFixedPointEvaluation( virtualIndex, virtualPoint, cacheGradients );
+      }
+    }
+}
+
+template<typename TFixedImage,typename TMovingImage,typename TVirtualImage, typename TInternalComputationValueType, typename TMetricTraits>
+void
+ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputationValueType, TMetricTraits>
+::CacheFixedPointEvaluation( const VirtualIndexType & virtualIndex,
+                             const VirtualPointType & virtualPoint,
+                             const bool cacheGradients )
+{
+  const OffsetValueType offset = this->GetVirtualImage()->ComputeOffset( virtualIndex );
+
+  FixedImagePointType mappedFixedPoint;
+  FixedImagePixelType mappedFixedPixelValue;
+  const bool pointIsValid = this->TransformAndEvaluateFixedPoint( virtualPoint, mappedFixedPoint, mappedFixedPixelValue );
+
+  this->m_FixedImageSampleCacheVirtualPoints[offset] = virtualPoint;
+  this->m_FixedImageSampleCacheOccupied[offset] = true;
+  this->m_FixedImageSampleCacheValidity[offset] = pointIsValid;
+  if( pointIsValid )
+    {
+    this->m_FixedImageSampleCacheFixedPoints[offset] = mappedFixedPoint;
+    this->m_FixedImageSampleCacheValues[offset] = mappedFixedPixelValue;
+    if( cacheGradients )
+      {
+      this->ComputeFixedImageGradientAtPoint( mappedFixedPoint, this->m_FixedImageSampleCacheGradients[offset] );
+      }
+    }
+}
+
+template<typename TFixedImage,typename TMovingImage,typename TVirtualImage, typename TInternalComputationValueType, typename TMetricTraits>
+bool
+ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputationValueType, TMetricTraits>
+::GetCachedFixedPointEvaluation( const VirtualIndexType & virtualIndex,
+                         const VirtualPointType & virtualPoint,
+                         bool & pointIsValid,
+                         FixedImagePointType & mappedFixedPoint,
+                         FixedImagePixelType & mappedFixedPixelValue,
+                         FixedImageGradientType & mappedFixedImageGradient ) const
+{
+  const OffsetValueType offset = this->GetVirtualImage()->ComputeOffset( virtualIndex );
+  if( offset < 0
+      || static_cast< SizeValueType >( offset ) >= this->m_FixedImageSampleCacheOccupied.size()
+      || ! this->m_FixedImageSampleCacheOccupied[offset]
+      || this->m_FixedImageSampleCacheVirtualPoints[offset] != virtualPoint )
+    {
+    /* Not in the cache. This happens when distinct sampled points share a
+     * virtual index, or when the cache has not been built. */
+    return false;
+    }
+  pointIsValid = this->m_FixedImageSampleCacheValidity[offset];
+  if( pointIsValid )
+    {
+    mappedFixedPoint = this->m_FixedImageSampleCacheFixedPoints[offset];
+    mappedFixedPixelValue = this->m_FixedImageSampleCacheValues[offset];
+    if( ! this->m_FixedImageSampleCacheGradients.empty() )
+      {
+      mappedFixedImageGradient = this->m_FixedImageSampleCacheGradients[offset];
+      }
+    }
+  return true;
+}
+
 template<typename TFixedImage,typename TMovingImage,typename TVirtualImage, typename TInternalComputationValueType, typename TMetricTraits>
 void
 ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputationValueType, TMetricTraits>
@@ -565,6 +716,48 @@ ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputat
     }
 }
 
+template<typename TFixedImage,typename TMovingImage,typename TVirtualImage, typename TInternalComputationValueType, typename TMetricTraits>
+void
+ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputationValueType, TMetricTraits>
+::ResampleVirtualSampledPointSet()
+{
+  const SizeValueType totalPoints = this->m_FullVirtualSampledPointSet->GetNumberOfPoints();
+
+  SizeValueType numberOfSamples = this->m_NumberOfStochasticSamples;
+  if( numberOfSamples > totalPoints )
+    {
+    numberOfSamples = totalPoints;
+    }
+
+  /* Draw with replacement, which keeps each point an independent,
+   * identically distributed pick from the full set. */
+  typename VirtualPointSetType::Pointer subset = VirtualPointSetType::New();
+  subset->Initialize();
+  for( SizeValueType i = 0; i < numberOfSamples; i++ )
+    {
+    const auto sourceIndex = static_cast< SizeValueType >(
+      this->m_StochasticSamplingGenerator->GetIntegerVariate( totalPoints - 1 ) );
+    subset->SetPoint( i, this->m_FullVirtualSampledPointSet->GetPoint( sourceIndex ) );
+    }
+  this->m_VirtualSampledPointSet = subset;
+}
+
+template<typename TFixedImage,typename TMovingImage,typename TVirtualImage, typename TInternalComputationValueType, typename TMetricTraits>
+void
+ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputationValueType, TMetricTraits>
+::ReinitializeStochasticSamplingSeed()
+{
+  this->m_StochasticSamplingGenerator->SetSeed();
+}
+
+template<typename TFixedImage,typename TMovingImage,typename TVirtualImage, typename TInternalComputationValueType, typename TMetricTraits>
+void
+ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputationValueType, TMetricTraits>
+::ReinitializeStochasticSamplingSeed( int seed )
+{
+  this->m_StochasticSamplingGenerator->SetSeed( seed );
+}
+
 template<typename TFixedImage,typename TMovingImage,typename TVirtualImage, typename TInternalComputationValueType, typename TMetricTraits>
 SizeValueType
 ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputationValueType, TMetricTraits>
@@ -593,6 +786,8 @@ ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputat
   os << indent << "ImageToImageMetricv4: " << std::endl
      << indent << "GetUseFixedImageGradientFilter: " << this->GetUseFixedImageGradientFilter() << std::endl
      << indent << "GetUseMovingImageGradientFilter: " << this->GetUseMovingImageGradientFilter() << std::endl
+     << indent << "GetUseFixedImageSampleCache: " << this->GetUseFixedImageSampleCache() << std::endl
+     << indent << "NumberOfStochasticSamples: " << this->GetNumberOfStochasticSamples() << std::endl
      << indent << "UseFloatingPointCorrection: " << this->GetUseFloatingPointCorrection() << std::endl
      << indent << "FloatingPointCorrectionResolution: " << this->GetFloatingPointCorrectionResolution() << std::endl;
 
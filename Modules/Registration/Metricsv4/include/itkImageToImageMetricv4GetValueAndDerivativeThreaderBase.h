@@ -20,6 +20,7 @@
 
 #include "itkDomainThreader.h"
 #include "itkCompensatedSummation.h"
+#include "itkCompensatedSummationArray.h"
 
 namespace itk
 {
@@ -87,7 +88,10 @@ public:
   using NumberOfParametersType = typename ImageToImageMetricv4Type::NumberOfParametersType;
 
   using CompensatedDerivativeValueType = CompensatedSummation<DerivativeValueType>;
-  using CompensatedDerivativeType = std::vector<CompensatedDerivativeValueType>;
+  /* The per-thread derivative accumulator keeps its sums and
+   * compensations in separate contiguous arrays so that the per-sample
+   * accumulation vectorizes across parameters. */
+  using CompensatedDerivativeType = CompensatedSummationArray<DerivativeValueType>;
 
   /** Access the GetValueAndDerivative() accesor in image metric base. */
   virtual bool GetComputeDerivative() const;
@@ -88,7 +88,7 @@ ImageToImageMetricv4GetValueAndDerivativeThreaderBase< TDomainPartitioner, TImag
          * that holds the result over a particular image region.
          * Use a CompensatedSummation value to provide for better consistency between
          * different number of threads. */
-        this->m_GetValueAndDerivativePerThreadVariables[i].CompensatedDerivatives.resize( globalDerivativeSize );
+        this->m_GetValueAndDerivativePerThreadVariables[i].CompensatedDerivatives.SetLength( globalDerivativeSize );
         }
       }
     }
@@ -106,10 +106,7 @@ ImageToImageMetricv4GetValueAndDerivativeThreaderBase< TDomainPartitioner, TImag
         /* Be sure to init to 0 here, because the threader may not use
          * all the threads if the region is better split into fewer
          * subregions. */
-        for( NumberOfParametersType p = 0; p < this->m_CachedNumberOfParameters; p++ )
-          {
-          this->m_GetValueAndDerivativePerThreadVariables[thread].CompensatedDerivatives[p].ResetToZero();
-          }
+        this->m_GetValueAndDerivativePerThreadVariables[thread].CompensatedDerivatives.ResetToZero();
         }
       }
     }
@@ -142,7 +139,7 @@ ImageToImageMetricv4GetValueAndDerivativeThreaderBase< TDomainPartitioner, TImag
         sum.ResetToZero();
         for (ThreadIdType i=0; i<numThreadsUsed; i++)
           {
-          sum += this->m_GetValueAndDerivativePerThreadVariables[i].CompensatedDerivatives[p].GetSum();
+          sum += this->m_GetValueAndDerivativePerThreadVariables[i].CompensatedDerivatives.GetSum( p );
           }
         (*(this->m_Associate->m_DerivativeResult))[p] += sum.GetSum();
         }
@@ -194,12 +191,24 @@ ImageToImageMetricv4GetValueAndDerivativeThreaderBase< TDomainPartitioner, TImag
    * then we otherwise get when exceptions are caught in MultiThreaderBase. */
   try
     {
-    pointIsValid = this->m_Associate->TransformAndEvaluateFixedPoint( virtualPoint, mappedFixedPoint, mappedFixedPixelValue);
-    if( pointIsValid &&
-        this->m_Associate->GetComputeDerivative() &&
-        this->m_Associate->GetGradientSourceIncludesFixed() )
+    /* When the fixed-image sample cache is enabled, use the evaluation
+     * precomputed during Initialize. A cache miss falls through to
+     * direct evaluation. */
+    bool cacheAnswered = false;
+    if( this->m_Associate->GetUseFixedImageSampleCache() )
+      {
+      cacheAnswered = this->m_Associate->GetCachedFixedPointEvaluation( virtualIndex, virtualPoint,
+        pointIsValid, mappedFixedPoint, mappedFixedPixelValue, mappedFixedImageGradient );
+      }
+    if( ! cacheAnswered )
       {
-      this->m_Associate->ComputeFixedImageGradientAtPoint( mappedFixedPoint, mappedFixedImageGradient );
+      pointIsValid = this->m_Associate->TransformAndEvaluateFixedPoint( virtualPoint, mappedFixedPoint, mappedFixedPixelValue);
+      if( pointIsValid &&
+          this->m_Associate->GetComputeDerivative() &&
+          this->m_Associate->GetGradientSourceIncludesFixed() )
+        {
+        this->m_Associate->ComputeFixedImageGradientAtPoint( mappedFixedPoint, mappedFixedImageGradient );
+        }
       }
     }
   catch( ExceptionObject & exc )
@@ -292,10 +301,10 @@ ImageToImageMetricv4GetValueAndDerivativeThreaderBase< TDomainPartitioner, TImag
         this->m_GetValueAndDerivativePerThreadVariables[threadId].LocalDerivatives[p] = static_cast<DerivativeValueType>( test / correctionResolution );
         }
       }
-    for (NumberOfParametersType p = 0; p < this->m_CachedNumberOfParameters; p++ )
-      {
-      this->m_GetValueAndDerivativePerThreadVariables[threadId].CompensatedDerivatives[p] += this->m_GetValueAndDerivativePerThreadVariables[threadId].LocalDerivatives[p];
-      }
+    /* One compensated summation step per parameter, vectorized across
+     * the parameter array. */
+    this->m_GetValueAndDerivativePerThreadVariables[threadId].CompensatedDerivatives.AddElements(
+      this->m_GetValueAndDerivativePerThreadVariables[threadId].LocalDerivatives.data_block() );
     }
   else
     {
@@ -20,6 +20,7 @@
 
 #include "itkMattesMutualInformationImageToImageMetricv4.h"
 #include "itkCompensatedSummation.h"
+#include "itkMultiThreaderBase.h"
 #include <mutex>
 
 namespace itk
@@ -337,30 +338,42 @@ MattesMutualInformationImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualI
 {
   const ThreadIdType localNumberOfWorkUnitsUsed = this->GetNumberOfWorkUnitsUsed();
 
-  const SizeValueType numberOfVoxels = this->m_NumberOfHistogramBins* this->m_NumberOfHistogramBins;
+  const SizeValueType numberOfBins = this->m_NumberOfHistogramBins;
   JointPDFValueType * const pdfPtrStart = this->m_ThreaderJointPDF[0]->GetBufferPointer();
 
-  for( unsigned int t = 1; t < localNumberOfWorkUnitsUsed; ++t )
-    {
-    JointPDFValueType *             pdfPtr = pdfPtrStart;
-    JointPDFValueType const *       tPdfPtr = this->m_ThreaderJointPDF[t]->GetBufferPointer();
-    JointPDFValueType const * const tPdfPtrEnd = tPdfPtr + numberOfVoxels;
-    while( tPdfPtr < tPdfPtrEnd )
-      {
-      *( pdfPtr++ ) += *( tPdfPtr++ );
-      }
-    for( SizeValueType i = 0; i < this->m_NumberOfHistogramBins; ++i )
+  // Merge the per-thread accumulators with a reduction parallelized over
+  // the fixed-image rows of the histogram. Each work unit owns complete
+  // rows (and the matching fixed-marginal bins), so no two work units
+  // ever touch the same destination bin and no locking is needed. The
+  // per-row sums feed the total joint PDF mass in a second, cheap pass.
+  std::vector< PDFValueType > rowSums( numberOfBins );
+  MultiThreaderBase::Pointer threader = MultiThreaderBase::New();
+  threader->ParallelizeArray( 0, numberOfBins,
+    [this, localNumberOfWorkUnitsUsed, pdfPtrStart, numberOfBins, &rowSums]( SizeValueType row )
       {
-      this->m_ThreaderFixedImageMarginalPDF[0][i] += this->m_ThreaderFixedImageMarginalPDF[t][i];
-      }
-    }
+      JointPDFValueType * const rowStart = pdfPtrStart + row * numberOfBins;
+      for( unsigned int t = 1; t < localNumberOfWorkUnitsUsed; ++t )
+        {
+        JointPDFValueType const * tPdfPtr = this->m_ThreaderJointPDF[t]->GetBufferPointer() + row * numberOfBins;
+        for( SizeValueType i = 0; i < numberOfBins; ++i )
+          {
+          rowStart[i] += tPdfPtr[i];
+          }
+        this->m_ThreaderFixedImageMarginalPDF[0][row] += this->m_ThreaderFixedImageMarginalPDF[t][row];
+        }
+      CompensatedSummation< PDFValueType > rowSum;
+      for( SizeValueType i = 0; i < numberOfBins; ++i )
+        {
+        rowSum += rowStart[i];
+        }
+      rowSums[row] = rowSum.GetSum();
+      },
+    nullptr );
 
-  // Sum of this threads domain into the this->m_JointPDFSum that covers that part of the domain.
-  JointPDFValueType const * pdfPtr = pdfPtrStart;
   CompensatedSummation< PDFValueType > jointPDFSum;
-  for( SizeValueType i = 0; i < numberOfVoxels; ++i )
+  for( SizeValueType row = 0; row < numberOfBins; ++row )
     {
-    jointPDFSum += *( pdfPtr++ );
+    jointPDFSum += rowSums[row];
     }
   this->m_JointPDFSum = jointPDFSum.GetSum();
 }
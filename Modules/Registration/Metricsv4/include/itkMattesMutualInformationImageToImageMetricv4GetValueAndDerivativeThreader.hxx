@@ -337,19 +337,60 @@ MattesMutualInformationImageToImageMetricv4GetValueAndDerivativeThreader< TDomai
                                                               jacobianPositional);
     }
 
+  /**
+   * Evaluate the Parzen weights for the whole four-bin window at once.
+   * When the window index was not clamped at the histogram border, the
+   * kernel arguments fall in the usual support and the weights reduce to
+   * fixed cubic polynomials of the bin fraction; computing them together
+   * as straight-line arithmetic avoids four virtual kernel evaluations
+   * per sample (eight with derivatives) and lets the compiler vectorize.
+   * Clamped samples keep the kernel functors, which handle arguments
+   * outside the support.
+   */
+  PDFValueType parzenValues[4];
+  PDFValueType parzenDerivatives[4];
+  const PDFValueType parzenFraction = movingImageParzenWindowTerm
+    - static_cast<PDFValueType>( movingImageParzenWindowIndex );
+  if( parzenFraction >= 0.0 && parzenFraction < 1.0 )
+    {
+    const PDFValueType f = parzenFraction;
+    const PDFValueType oneMinusF = 1.0 - f;
+    parzenValues[0] = ( 1.0 / 6.0 ) * oneMinusF * oneMinusF * oneMinusF;
+    parzenValues[1] = ( 4.0 - 6.0 * f * f + 3.0 * f * f * f ) / 6.0;
+    parzenValues[3] = ( 1.0 / 6.0 ) * f * f * f;
+    parzenValues[2] = 1.0 - parzenValues[0] - parzenValues[1] - parzenValues[3];
+    if( doComputeDerivative )
+      {
+      parzenDerivatives[0] = 0.5 * oneMinusF * oneMinusF;
+      parzenDerivatives[1] = 2.0 * f - 1.5 * f * f;
+      parzenDerivatives[2] = -2.0 * oneMinusF + 1.5 * oneMinusF * oneMinusF;
+      parzenDerivatives[3] = -0.5 * f * f;
+      }
+    }
+  else
+    {
+    for( SizeValueType bin = 0; bin < 4; ++bin )
+      {
+      const PDFValueType arg = movingImageParzenWindowArg + static_cast<PDFValueType>( bin );
+      parzenValues[bin] = static_cast<PDFValueType>(
+        this->m_MattesAssociate->m_CubicBSplineKernel->Evaluate( arg ) );
+      if( doComputeDerivative )
+        {
+        parzenDerivatives[bin] = this->m_MattesAssociate->m_CubicBSplineDerivativeKernel->Evaluate( arg );
+        }
+      }
+    }
+
   SizeValueType movingParzenBin = 0;
 
   const bool transformIsDisplacement = this->m_MattesAssociate->m_MovingTransform->GetTransformCategory() == MovingTransformType::DisplacementField;
   while( pdfMovingIndex <= pdfMovingIndexMax )
     {
-    const auto val = static_cast<PDFValueType>(
-      this->m_MattesAssociate->m_CubicBSplineKernel ->Evaluate( movingImageParzenWindowArg) );
-    *( pdfPtr++ ) += val;
+    *( pdfPtr++ ) += parzenValues[movingParzenBin];
 
     if( doComputeDerivative )
       {
-      // Compute the cubicBSplineDerivative for later repeated use.
-      const PDFValueType cubicBSplineDerivativeValue = this->m_MattesAssociate->m_CubicBSplineDerivativeKernel->Evaluate(movingImageParzenWindowArg);
+      const PDFValueType cubicBSplineDerivativeValue = parzenDerivatives[movingParzenBin];
 
 
       if( transformIsDisplacement )
@@ -374,25 +415,34 @@ MattesMutualInformationImageToImageMetricv4GetValueAndDerivativeThreader< TDomai
           ( fixedImageParzenWindowIndex  * this->m_MattesAssociate->m_JointPDFDerivatives->GetOffsetTable()[2] )
           + ( pdfMovingIndex * this->m_MattesAssociate->m_JointPDFDerivatives->GetOffsetTable()[1] );
 
-        PDFValueType * derivativeContributionPtr =
+        PDFValueType * const derivativeContributionPtr =
           this->m_MattesAssociate->m_ThreaderDerivativeManager[threadId].GetNextElementAndAddOffset(ThisIndexOffset);
-        for( NumberOfParametersType mu = 0, maxElement = this->GetCachedNumberOfLocalParameters(); mu < maxElement;
-             ++mu )
+        // Accumulate one jacobian row at a time so that both the jacobian
+        // and the contribution buffer are traversed contiguously.
+        const NumberOfParametersType maxElement = this->GetCachedNumberOfLocalParameters();
+        for( SizeValueType dim = 0, lastDim = this->m_MattesAssociate->MovingImageDimension; dim < lastDim; ++dim )
           {
-          PDFValueType innerProduct = 0.0;
-          for( SizeValueType dim = 0, lastDim = this->m_MattesAssociate->MovingImageDimension; dim < lastDim; ++dim )
+          const PDFValueType scaledGradient = movingImageGradient[dim] * cubicBSplineDerivativeValue;
+          const auto * const jacobianRow = jacobian[dim];
+          if( dim == 0 )
             {
-            innerProduct += jacobian[dim][mu] * movingImageGradient[dim];
+            for( NumberOfParametersType mu = 0; mu < maxElement; ++mu )
+              {
+              derivativeContributionPtr[mu] = jacobianRow[mu] * scaledGradient;
+              }
+            }
+          else
+            {
+            for( NumberOfParametersType mu = 0; mu < maxElement; ++mu )
+              {
+              derivativeContributionPtr[mu] += jacobianRow[mu] * scaledGradient;
+              }
             }
-
-          *(derivativeContributionPtr) = innerProduct * cubicBSplineDerivativeValue;
-          ++derivativeContributionPtr;
           }
         this->m_MattesAssociate->m_ThreaderDerivativeManager[threadId].CheckAndReduceIfNecessary();
         }
       }
 
-    movingImageParzenWindowArg += 1.0;
     ++pdfMovingIndex;
     ++movingParzenBin;
     }
@@ -413,17 +463,18 @@ MattesMutualInformationImageToImageMetricv4GetValueAndDerivativeThreader< TDomai
                         const PDFValueType &            cubicBSplineDerivativeValue,
                         DerivativeValueType *           localSupportDerivativeResultPtr) const
 {
-  for( NumberOfParametersType mu = 0, maxElement=this->GetCachedNumberOfLocalParameters(); mu < maxElement; ++mu )
+  // Traverse one jacobian row at a time so that both the jacobian and the
+  // result buffer are walked contiguously; the result accumulates the
+  // scaled gradient contribution of every dimension.
+  const NumberOfParametersType maxElement = this->GetCachedNumberOfLocalParameters();
+  for( SizeValueType dim = 0, lastDim = this->m_MattesAssociate->MovingImageDimension; dim < lastDim; ++dim )
     {
-    PDFValueType innerProduct = 0.0;
-    for( SizeValueType dim = 0, lastDim = this->m_MattesAssociate->MovingImageDimension; dim < lastDim; ++dim )
+    const PDFValueType scaledGradient = movingImageGradient[dim] * cubicBSplineDerivativeValue;
+    const auto * const jacobianRow = jacobian[dim];
+    for( NumberOfParametersType mu = 0; mu < maxElement; ++mu )
       {
-      innerProduct += jacobian[dim][mu] * movingImageGradient[dim];
+      localSupportDerivativeResultPtr[mu] += jacobianRow[mu] * scaledGradient;
       }
-
-    const PDFValueType derivativeContribution = innerProduct * cubicBSplineDerivativeValue;
-    *( localSupportDerivativeResultPtr ) += derivativeContribution;
-    localSupportDerivativeResultPtr++;
     }
 }
 
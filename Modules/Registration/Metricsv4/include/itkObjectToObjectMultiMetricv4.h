@@ -134,6 +134,18 @@ public:
   itkSetMacro(MetricWeights,WeightsArrayType);
   itkGetMacro(MetricWeights,WeightsArrayType);
 
+  /** Set/Get whether the component metrics are evaluated as parallel
+   * tasks on the global thread pool instead of one after another.
+   * Each component still walks the shared sample set itself, so this
+   * mainly helps when several moderately sized metrics leave cores
+   * idle; every component then needs its own derivative buffer, which
+   * can be costly for dense transforms. The combined value and
+   * derivative are identical to the sequential evaluation. Off by
+   * default. */
+  itkSetMacro(EvaluateComponentsConcurrently, bool);
+  itkGetConstMacro(EvaluateComponentsConcurrently, bool);
+  itkBooleanMacro(EvaluateComponentsConcurrently);
+
   /** Add a metric to the queue */
   void AddMetric( MetricType* metric );
 
@@ -210,6 +222,7 @@ private:
   MetricQueueType               m_MetricQueue;
   WeightsArrayType              m_MetricWeights;
   mutable MetricValueArrayType  m_MetricValueArray;
+  bool                          m_EvaluateComponentsConcurrently;
 };
 
 } //end namespace itk
@@ -20,6 +20,9 @@
 
 #include "itkObjectToObjectMultiMetricv4.h"
 #include "itkCompositeTransform.h"
+#include "itkThreadPool.h"
+#include <future>
+#include <vector>
 
 namespace itk
 {
@@ -31,6 +34,8 @@ ObjectToObjectMultiMetricv4<TFixedDimension, TMovingDimension, TVirtualImage, TI
 {
   this->m_MetricQueue.clear();
 
+  this->m_EvaluateComponentsConcurrently = false;
+
   //We want the moving transform to be nullptr by default
   this->m_MovingTransform = nullptr;
 }
@@ -232,9 +237,29 @@ typename ObjectToObjectMultiMetricv4<TFixedDimension, TMovingDimension, TVirtual
 ObjectToObjectMultiMetricv4<TFixedDimension, TMovingDimension, TVirtualImage, TInternalComputationValueType>
 ::GetValue() const
 {
-  for (SizeValueType j = 0; j < this->GetNumberOfMetrics(); j++)
+  if( this->m_EvaluateComponentsConcurrently && this->GetNumberOfMetrics() > 1 )
+    {
+    ThreadPool *threadPool = ThreadPool::GetInstance();
+    std::vector< std::future< void > > evaluations;
+    evaluations.reserve( this->GetNumberOfMetrics() );
+    for (SizeValueType j = 0; j < this->GetNumberOfMetrics(); j++)
+      {
+      evaluations.push_back( threadPool->AddWork( [this, j]
+        {
+        this->m_MetricValueArray[j] = this->m_MetricQueue[j]->GetValue();
+        } ) );
+      }
+    for (auto & evaluation : evaluations)
+      {
+      evaluation.get();
+      }
+    }
+  else
     {
-    this->m_MetricValueArray[j] = this->m_MetricQueue[j]->GetValue();
+    for (SizeValueType j = 0; j < this->GetNumberOfMetrics(); j++)
+      {
+      this->m_MetricValueArray[j] = this->m_MetricQueue[j]->GetValue();
+      }
     }
 
   MeasureType firstValue = this->m_MetricValueArray[0];
@@ -265,12 +290,46 @@ ObjectToObjectMultiMetricv4<TFixedDimension, TMovingDimension, TVirtualImage, TI
   DerivativeType  metricDerivative;
   MeasureType     metricValue = NumericTraits<MeasureType>::ZeroValue();
 
+  /* When requested, evaluate the components as parallel tasks first.
+   * Each task needs its own derivative buffer, unlike the sequential
+   * path below which reuses one, so this trades memory for wall time. */
+  const bool evaluateConcurrently =
+    this->m_EvaluateComponentsConcurrently && this->GetNumberOfMetrics() > 1;
+  std::vector<DerivativeType> metricDerivatives;
+  if( evaluateConcurrently )
+    {
+    metricDerivatives.resize( this->GetNumberOfMetrics() );
+    ThreadPool *threadPool = ThreadPool::GetInstance();
+    std::vector< std::future< void > > evaluations;
+    evaluations.reserve( this->GetNumberOfMetrics() );
+    for (SizeValueType j = 0; j < this->GetNumberOfMetrics(); j++)
+      {
+      evaluations.push_back( threadPool->AddWork( [this, j, &metricDerivatives]
+        {
+        MeasureType value = NumericTraits<MeasureType>::ZeroValue();
+        this->m_MetricQueue[j]->GetValueAndDerivative( value, metricDerivatives[j] );
+        this->m_MetricValueArray[j] = value;
+        } ) );
+      }
+    for (auto & evaluation : evaluations)
+      {
+      evaluation.get();
+      }
+    }
+
   // Loop over metrics
   DerivativeValueType totalMagnitude = NumericTraits<DerivativeValueType>::ZeroValue();
   for (SizeValueType j = 0; j < this->GetNumberOfMetrics(); j++)
     {
-    this->m_MetricQueue[j]->GetValueAndDerivative( metricValue, metricDerivative);
-    this->m_MetricValueArray[j] = metricValue;
+    if( evaluateConcurrently )
+      {
+      metricDerivative.swap( metricDerivatives[j] );
+      }
+    else
+      {
+      this->m_MetricQueue[j]->GetValueAndDerivative( metricValue, metricDerivative);
+      this->m_MetricValueArray[j] = metricValue;
+      }
 
     DerivativeValueType magnitude = metricDerivative.magnitude();
     DerivativeValueType weightOverMagnitude = NumericTraits<DerivativeValueType>::ZeroValue();
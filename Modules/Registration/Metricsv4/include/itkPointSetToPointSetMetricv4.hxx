@@ -526,6 +526,9 @@ PointSetToPointSetMetricv4<TFixedPointSet, TMovingPointSet, TInternalComputation
     if( ! this->m_FixedTransformedPointsLocator )
       {
       this->m_FixedTransformedPointsLocator = PointsLocatorType::New();
+      // the locators are rebuilt whenever the transforms move the points,
+      // so build the kd-trees concurrently
+      this->m_FixedTransformedPointsLocator->UseParallelConstructionOn();
       }
     this->m_FixedTransformedPointsLocator->SetPoints( this->m_FixedTransformedPointSet->GetPoints() );
     this->m_FixedTransformedPointsLocator->Initialize();
@@ -540,6 +543,7 @@ PointSetToPointSetMetricv4<TFixedPointSet, TMovingPointSet, TInternalComputation
     if( ! this->m_MovingTransformedPointsLocator )
       {
       this->m_MovingTransformedPointsLocator = PointsLocatorType::New();
+      this->m_MovingTransformedPointsLocator->UseParallelConstructionOn();
       }
     this->m_MovingTransformedPointsLocator->SetPoints( this->m_MovingTransformedPointSet->GetPoints() );
     this->m_MovingTransformedPointsLocator->Initialize();
@@ -0,0 +1,150 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkMeanSquaresImageToImageMetricv4.h"
+#include "itkTranslationTransform.h"
+#include "itkMath.h"
+
+/* Test the fixed-image sample cache of ImageToImageMetricv4.
+ * The metric value and derivative must be identical with the cache
+ * enabled and disabled, for both dense sampling and a sampled point
+ * set, since the cache stores the results of the same evaluations
+ * that are otherwise performed at each iteration. */
+
+namespace
+{
+
+using ImageType = itk::Image< double, 3 >;
+using MetricType = itk::MeanSquaresImageToImageMetricv4< ImageType, ImageType >;
+
+int CompareCachedAndUncached( MetricType * metric, const char * description )
+{
+  MetricType::MeasureType    valueUncached, valueCached;
+  MetricType::DerivativeType derivativeUncached, derivativeCached;
+
+  try
+    {
+    metric->SetUseFixedImageSampleCache( false );
+    metric->Initialize();
+    metric->GetValueAndDerivative( valueUncached, derivativeUncached );
+
+    metric->SetUseFixedImageSampleCache( true );
+    metric->Initialize();
+    metric->GetValueAndDerivative( valueCached, derivativeCached );
+    }
+  catch( itk::ExceptionObject & exc )
+    {
+    std::cerr << "Caught unexpected exception during " << description
+              << " evaluation: " << exc << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  if( itk::Math::NotExactlyEquals( valueUncached, valueCached ) )
+    {
+    std::cerr << description << ": value mismatch with sample cache: "
+              << valueUncached << " vs " << valueCached << std::endl;
+    return EXIT_FAILURE;
+    }
+  if( derivativeUncached != derivativeCached )
+    {
+    std::cerr << description << ": derivative mismatch with sample cache: "
+              << derivativeUncached << " vs " << derivativeCached << std::endl;
+    return EXIT_FAILURE;
+    }
+  std::cout << description << ": value = " << valueCached << std::endl;
+  return EXIT_SUCCESS;
+}
+
+} // end anonymous namespace
+
+int itkImageToImageMetricv4SampleCacheTest(int, char ** const)
+{
+  constexpr unsigned int imageSize = 10;
+
+  ImageType::SizeType size;
+  size.Fill( imageSize );
+  ImageType::RegionType region;
+  region.SetSize( size );
+
+  ImageType::Pointer fixedImage = ImageType::New();
+  fixedImage->SetRegions( region );
+  fixedImage->Allocate();
+
+  ImageType::Pointer movingImage = ImageType::New();
+  movingImage->SetRegions( region );
+  movingImage->Allocate();
+
+  /* Fill images with simple gradients so the derivative is non-trivial. */
+  itk::ImageRegionIteratorWithIndex<ImageType> itFixed( fixedImage, region );
+  for( itFixed.GoToBegin(); !itFixed.IsAtEnd(); ++itFixed )
+    {
+    itFixed.Set( itFixed.GetIndex()[0] * 2.0 + itFixed.GetIndex()[1] );
+    }
+  itk::ImageRegionIteratorWithIndex<ImageType> itMoving( movingImage, region );
+  for( itMoving.GoToBegin(); !itMoving.IsAtEnd(); ++itMoving )
+    {
+    itMoving.Set( itMoving.GetIndex()[1] * 3.0 + itMoving.GetIndex()[2] );
+    }
+
+  using TransformType = itk::TranslationTransform<double,3>;
+  TransformType::Pointer fixedTransform = TransformType::New();
+  TransformType::Pointer movingTransform = TransformType::New();
+  fixedTransform->SetIdentity();
+  movingTransform->SetIdentity();
+  TransformType::ParametersType parameters( 3 );
+  parameters.Fill( 0.5 );
+  movingTransform->SetParameters( parameters );
+
+  MetricType::Pointer metric = MetricType::New();
+  metric->SetFixedImage( fixedImage );
+  metric->SetMovingImage( movingImage );
+  metric->SetFixedTransform( fixedTransform );
+  metric->SetMovingTransform( movingTransform );
+
+  std::cout << "Testing dense sampling..." << std::endl;
+  if( CompareCachedAndUncached( metric, "Dense sampling" ) == EXIT_FAILURE )
+    {
+    return EXIT_FAILURE;
+    }
+
+  /* Sample every other point of the fixed image. */
+  using PointSetType = MetricType::FixedSampledPointSetType;
+  PointSetType::Pointer pset = PointSetType::New();
+  unsigned long ind = 0, ct = 0;
+  for( itFixed.GoToBegin(); !itFixed.IsAtEnd(); ++itFixed )
+    {
+    if( ct % 2 == 0 )
+      {
+      PointSetType::PointType pt;
+      fixedImage->TransformIndexToPhysicalPoint( itFixed.GetIndex(), pt );
+      pset->SetPoint( ind, pt );
+      ind++;
+      }
+    ct++;
+    }
+  metric->SetFixedSampledPointSet( pset );
+  metric->SetUseSampledPointSet( true );
+
+  std::cout << "Testing sampled point set..." << std::endl;
+  if( CompareCachedAndUncached( metric, "Sampled point set" ) == EXIT_FAILURE )
+    {
+    return EXIT_FAILURE;
+    }
+
+  std::cout << "Test passed." << std::endl;
+  return EXIT_SUCCESS;
+}
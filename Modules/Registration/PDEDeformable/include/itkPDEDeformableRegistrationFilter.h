@@ -116,6 +116,9 @@ public:
   /** Inherit some enums and type alias from the superclass. */
   static constexpr unsigned int ImageDimension = Superclass::ImageDimension;
 
+  /** Time step type. */
+  using TimeStepType = typename Superclass::TimeStepType;
+
   /** Set the fixed image. */
   itkSetInputMacro(FixedImage, FixedImageType);
 
@@ -184,6 +187,19 @@ public:
    * smoothing the update field. */
   itkGetConstReferenceMacro(UpdateFieldStandardDeviations, StandardDeviationsType);
 
+  /** Set/Get whether the scaled update is folded into the first
+   * directional pass of the displacement field smoothing instead of
+   * being applied in a separate sweep over the field. This saves one
+   * full read-modify-write traversal of the field per iteration and
+   * produces the same registration result. Because the update is
+   * deferred until the next smoothing, observers that inspect the
+   * output field between iterations will see a field that lags behind
+   * by one update. This option only takes effect when
+   * SmoothDisplacementField is on. Default is off. */
+  itkSetMacro(FuseUpdateWithSmoothing, bool);
+  itkGetConstMacro(FuseUpdateWithSmoothing, bool);
+  itkBooleanMacro(FuseUpdateWithSmoothing);
+
   /** Stop the registration after the current iteration. */
   virtual void StopRegistration()
   { m_StopRegistrationFlag = true; }
@@ -233,6 +249,12 @@ protected:
    * UpdateFieldStandardDeviations. */
   virtual void SmoothUpdateField();
 
+  /** Apply the update computed by the difference function to the
+   * displacement field. When FuseUpdateWithSmoothing is on, the
+   * application is deferred so that SmoothDisplacementField can fold it
+   * into its first directional pass. */
+  void ApplyUpdate(const TimeStepType& dt) override;
+
   /** This method is called after the solution has been generated. In this case,
    * the filter release the memory of the internal buffers. */
   void PostProcessOutput() override;
@@ -255,6 +277,12 @@ protected:
   void GenerateInputRequestedRegion() override;
 
 private:
+  /** Smooth the displacement field along the first dimension while
+   * adding the deferred scaled update, writing the result into the
+   * supplied image. */
+  void ApplyDeferredUpdateAndSmooth(const DisplacementFieldType *field,
+                                    DisplacementFieldType *smoothedField);
+
   /** Standard deviation for Gaussian smoothing */
   StandardDeviationsType m_StandardDeviations;
   StandardDeviationsType m_UpdateFieldStandardDeviations;
@@ -263,6 +291,11 @@ private:
   bool m_SmoothDisplacementField;
   bool m_SmoothUpdateField;
 
+  /** State of a deferred update when fusion with smoothing is enabled */
+  bool         m_FuseUpdateWithSmoothing;
+  bool         m_UpdateApplicationIsDeferred;
+  TimeStepType m_DeferredUpdateTimeStep;
+
   /** Temporary displacement field use for smoothing the
    * the displacement field. */
   DisplacementFieldPointer m_TempField;
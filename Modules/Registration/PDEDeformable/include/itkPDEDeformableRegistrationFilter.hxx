@@ -26,6 +26,9 @@
 
 #include "itkGaussianOperator.h"
 #include "itkVectorNeighborhoodOperatorImageFilter.h"
+#include "itkConstNeighborhoodIterator.h"
+#include "itkNeighborhoodAlgorithm.h"
+#include "itkMultiThreaderBase.h"
 
 #include "itkMath.h"
 #include "itkMath.h"
@@ -66,6 +69,10 @@ PDEDeformableRegistrationFilter< TFixedImage, TMovingImage, TDisplacementField >
 
   m_SmoothDisplacementField = true;
   m_SmoothUpdateField = false;
+
+  m_FuseUpdateWithSmoothing = false;
+  m_UpdateApplicationIsDeferred = false;
+  m_DeferredUpdateTimeStep = 0.0;
 }
 
 /*
@@ -174,6 +181,8 @@ PDEDeformableRegistrationFilter< TFixedImage, TMovingImage, TDisplacementField >
     os<< ", " << m_UpdateFieldStandardDeviations[j];
     }
   os << "]" << std::endl;
+  os << indent << "Fuse update with smoothing: "
+     << ( m_FuseUpdateWithSmoothing ? "on" : "off" ) << std::endl;
   os << indent << "StopRegistrationFlag: ";
   os << m_StopRegistrationFlag << std::endl;
   os << indent << "MaximumError: ";
@@ -321,6 +330,14 @@ void
 PDEDeformableRegistrationFilter< TFixedImage, TMovingImage, TDisplacementField >
 ::PostProcessOutput()
 {
+  if ( m_UpdateApplicationIsDeferred )
+    {
+    // The last update was never folded into a smoothing pass: apply it
+    // now so the output matches the unfused computation.
+    m_UpdateApplicationIsDeferred = false;
+    this->Superclass::ApplyUpdate(m_DeferredUpdateTimeStep);
+    }
+
   this->Superclass::PostProcessOutput();
   m_TempField->Initialize();
 }
@@ -335,6 +352,26 @@ PDEDeformableRegistrationFilter< TFixedImage, TMovingImage, TDisplacementField >
 {
   this->Superclass::Initialize();
   m_StopRegistrationFlag = false;
+  m_UpdateApplicationIsDeferred = false;
+}
+
+/*
+ * Apply the update, or defer it so that the next smoothing of the
+ * displacement field can fold it into its first directional pass.
+ */
+template< typename TFixedImage, typename TMovingImage, typename TDisplacementField >
+void
+PDEDeformableRegistrationFilter< TFixedImage, TMovingImage, TDisplacementField >
+::ApplyUpdate(const TimeStepType & dt)
+{
+  if ( m_FuseUpdateWithSmoothing && m_SmoothDisplacementField )
+    {
+    m_DeferredUpdateTimeStep = dt;
+    m_UpdateApplicationIsDeferred = true;
+    return;
+    }
+
+  this->Superclass::ApplyUpdate(dt);
 }
 
 /*
@@ -371,10 +408,25 @@ PDEDeformableRegistrationFilter< TFixedImage, TMovingImage, TDisplacementField >
   using PixelContainerPointer = typename DisplacementFieldType::PixelContainerPointer;
   PixelContainerPointer swapPtr;
 
+  unsigned int firstDirection = 0;
+  if ( m_UpdateApplicationIsDeferred )
+    {
+    // Fold the deferred scaled update into the first directional pass,
+    // saving a separate read-modify-write sweep over the field.
+    this->ApplyDeferredUpdateAndSmooth(field, m_TempField);
+    m_UpdateApplicationIsDeferred = false;
+
+    // swap the containers so that the field holds the fused result
+    swapPtr = m_TempField->GetPixelContainer();
+    m_TempField->SetPixelContainer( field->GetPixelContainer() );
+    field->SetPixelContainer(swapPtr);
+    firstDirection = 1;
+    }
+
   // graft the output field onto the mini-pipeline
   smoother->GraftOutput(m_TempField);
 
-  for ( unsigned int j = 0; j < ImageDimension; j++ )
+  for ( unsigned int j = firstDirection; j < ImageDimension; j++ )
     {
     // smooth along this dimension
     oper->SetDirection(j);
@@ -399,13 +451,83 @@ PDEDeformableRegistrationFilter< TFixedImage, TMovingImage, TDisplacementField >
       }
     }
 
-  // graft the output back to this filter
-  m_TempField->SetPixelContainer( field->GetPixelContainer() );
-  this->GraftOutput( smoother->GetOutput() );
+  if ( firstDirection < ImageDimension )
+    {
+    // graft the output back to this filter
+    m_TempField->SetPixelContainer( field->GetPixelContainer() );
+    this->GraftOutput( smoother->GetOutput() );
+    }
 
   delete oper;
 }
 
+/*
+ * Smooth along the first dimension while adding the deferred scaled update
+ */
+template< typename TFixedImage, typename TMovingImage, typename TDisplacementField >
+void
+PDEDeformableRegistrationFilter< TFixedImage, TMovingImage, TDisplacementField >
+::ApplyDeferredUpdateAndSmooth(const DisplacementFieldType *field,
+                               DisplacementFieldType *smoothedField)
+{
+  using VectorType = typename DisplacementFieldType::PixelType;
+  using ScalarType = typename VectorType::ValueType;
+  using OperatorType = GaussianOperator< ScalarType, ImageDimension >;
+
+  OperatorType oper;
+  oper.SetDirection(0);
+  oper.SetVariance( itk::Math::sqr(m_StandardDeviations[0]) );
+  oper.SetMaximumError(m_MaximumError);
+  oper.SetMaximumKernelWidth(m_MaximumKernelWidth);
+  oper.CreateDirectional();
+
+  const DisplacementFieldType * updateField = this->GetUpdateBuffer();
+  const auto dt = static_cast< ScalarType >( m_DeferredUpdateTimeStep );
+
+  this->GetMultiThreader()->template ParallelizeImageRegion< ImageDimension >(
+    field->GetRequestedRegion(),
+    [field, smoothedField, updateField, &oper, dt]
+    ( const typename DisplacementFieldType::RegionType & regionForThread )
+      {
+      using FaceCalculatorType =
+        NeighborhoodAlgorithm::ImageBoundaryFacesCalculator< DisplacementFieldType >;
+      FaceCalculatorType faceCalculator;
+      typename FaceCalculatorType::FaceListType faceList =
+        faceCalculator( field, regionForThread, oper.GetRadius() );
+
+      for ( auto & face : faceList )
+        {
+        ConstNeighborhoodIterator< DisplacementFieldType > fieldIt( oper.GetRadius(), field, face );
+        ConstNeighborhoodIterator< DisplacementFieldType > updateIt( oper.GetRadius(), updateField, face );
+        ImageRegionIterator< DisplacementFieldType >       outIt( smoothedField, face );
+
+        const unsigned int neighborhoodSize = fieldIt.Size();
+        for ( fieldIt.GoToBegin(), updateIt.GoToBegin(); !fieldIt.IsAtEnd();
+              ++fieldIt, ++updateIt, ++outIt )
+          {
+          VectorType sum;
+          unsigned int j;
+          for ( j = 0; j < VectorType::Dimension; j++ )
+            {
+            sum[j] = NumericTraits< ScalarType >::ZeroValue();
+            }
+          for ( unsigned int i = 0; i < neighborhoodSize; i++ )
+            {
+            const VectorType f = fieldIt.GetPixel(i);
+            const VectorType u = updateIt.GetPixel(i);
+            const ScalarType weight = oper[i];
+            for ( j = 0; j < VectorType::Dimension; j++ )
+              {
+              sum[j] += weight * ( f[j] + u[j] * dt );
+              }
+            }
+          outIt.Set(sum);
+          }
+        }
+      },
+    nullptr );
+}
+
 /*
  * Smooth deformation using a separable Gaussian kernel
  */
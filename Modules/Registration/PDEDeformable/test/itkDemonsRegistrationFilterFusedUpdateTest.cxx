@@ -0,0 +1,167 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkDemonsRegistrationFilter.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkMath.h"
+
+/* Verify that folding the scaled update into the first directional pass
+ * of the displacement field smoothing (FuseUpdateWithSmoothing) produces
+ * the same displacement field as the default separate update sweep. */
+
+// Fill an image with a circle.
+template <typename TImage>
+void
+FillWithCircle(
+TImage * image,
+double * center,
+double radius,
+typename TImage::PixelType foregnd,
+typename TImage::PixelType backgnd )
+{
+  using Iterator = itk::ImageRegionIteratorWithIndex<TImage>;
+  Iterator it( image, image->GetBufferedRegion() );
+
+  typename TImage::IndexType index;
+  double r2 = itk::Math::sqr( radius );
+
+  for( it.GoToBegin(); !it.IsAtEnd(); ++it )
+    {
+    index = it.GetIndex();
+    double distance = 0;
+    for( unsigned int j = 0; j < TImage::ImageDimension; j++ )
+      {
+      distance += itk::Math::sqr((double) index[j] - center[j]);
+      }
+    if( distance <= r2 ) it.Set( foregnd );
+    else it.Set( backgnd );
+    }
+}
+
+int itkDemonsRegistrationFilterFusedUpdateTest(int, char* [] )
+{
+  using PixelType = unsigned char;
+  enum {ImageDimension = 2};
+  using ImageType = itk::Image<PixelType,ImageDimension>;
+  using VectorType = itk::Vector<float,ImageDimension>;
+  using FieldType = itk::Image<VectorType,ImageDimension>;
+  using SizeType = ImageType::SizeType;
+  using RegionType = ImageType::RegionType;
+
+  //--------------------------------------------------------
+  std::cout << "Generate input images and initial deformation field";
+  std::cout << std::endl;
+
+  SizeType size;
+  size.Fill( 64 );
+  RegionType region;
+  region.SetSize( size );
+
+  ImageType::Pointer moving = ImageType::New();
+  ImageType::Pointer fixed = ImageType::New();
+  FieldType::Pointer initField = FieldType::New();
+
+  moving->SetLargestPossibleRegion( region );
+  moving->SetBufferedRegion( region );
+  moving->Allocate();
+
+  fixed->SetLargestPossibleRegion( region );
+  fixed->SetBufferedRegion( region );
+  fixed->Allocate();
+
+  initField->SetLargestPossibleRegion( region );
+  initField->SetBufferedRegion( region );
+  initField->Allocate();
+
+  double center[ImageDimension];
+  double radius;
+  PixelType fgnd = 250;
+  PixelType bgnd = 15;
+
+  // fill moving with circle
+  center[0] = 32; center[1] = 28; radius = 12;
+  FillWithCircle<ImageType>( moving, center, radius, fgnd, bgnd );
+
+  // fill fixed with circle
+  center[0] = 32; center[1] = 32; radius = 14;
+  FillWithCircle<ImageType>( fixed, center, radius, fgnd, bgnd );
+
+  // fill initial deformation with zero vectors
+  VectorType zeroVec;
+  zeroVec.Fill( 0.0 );
+  initField->FillBuffer( zeroVec );
+
+  //-------------------------------------------------------------
+  std::cout << "Run registration with and without update fusion";
+  std::cout << std::endl;
+
+  using RegistrationType = itk::DemonsRegistrationFilter<ImageType,ImageType,FieldType>;
+
+  RegistrationType::Pointer registrator = RegistrationType::New();
+
+  registrator->SetInitialDisplacementField( initField );
+  registrator->SetMovingImage( moving );
+  registrator->SetFixedImage( fixed );
+  registrator->SetNumberOfIterations( 20 );
+  registrator->SetStandardDeviations( 1.0 );
+  registrator->Update();
+
+  FieldType::Pointer referenceField = registrator->GetOutput();
+  referenceField->DisconnectPipeline();
+
+  RegistrationType::Pointer fusedRegistrator = RegistrationType::New();
+
+  fusedRegistrator->SetInitialDisplacementField( initField );
+  fusedRegistrator->SetMovingImage( moving );
+  fusedRegistrator->SetFixedImage( fixed );
+  fusedRegistrator->SetNumberOfIterations( 20 );
+  fusedRegistrator->SetStandardDeviations( 1.0 );
+  fusedRegistrator->FuseUpdateWithSmoothingOn();
+  fusedRegistrator->Update();
+
+  if( !fusedRegistrator->GetFuseUpdateWithSmoothing() )
+    {
+    std::cerr << "FuseUpdateWithSmoothing flag was not set." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  //-------------------------------------------------------------
+  std::cout << "Compare the output displacement fields";
+  std::cout << std::endl;
+
+  itk::ImageRegionIteratorWithIndex<FieldType> refIter( referenceField,
+    referenceField->GetBufferedRegion() );
+  itk::ImageRegionIteratorWithIndex<FieldType> fusedIter( fusedRegistrator->GetOutput(),
+    referenceField->GetBufferedRegion() );
+
+  for( refIter.GoToBegin(); !refIter.IsAtEnd(); ++refIter, ++fusedIter )
+    {
+    for( unsigned int j = 0; j < ImageDimension; j++ )
+      {
+      if( itk::Math::NotExactlyEquals( refIter.Get()[j], fusedIter.Get()[j] ) )
+        {
+        std::cerr << "Fields differ at " << refIter.GetIndex() << ": "
+                  << refIter.Get() << " vs " << fusedIter.Get() << std::endl;
+        return EXIT_FAILURE;
+        }
+      }
+    }
+
+  std::cout << "Test passed" << std::endl;
+  return EXIT_SUCCESS;
+}
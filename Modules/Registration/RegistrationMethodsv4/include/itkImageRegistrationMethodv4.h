@@ -29,6 +29,7 @@
 #include "itkPointSetToPointSetMetricv4.h"
 #include "itkShrinkImageFilter.h"
 #include "itkIdentityTransform.h"
+#include "itkSmoothedImagePyramidCache.h"
 #include "itkTransformParametersAdaptorBase.h"
 
 #include <vector>
@@ -189,8 +190,14 @@ public:
   /** Weights type for the optimizer. */
   using OptimizerWeightsType = typename OptimizerType::ScalesType;
 
-  /** enum type for metric sampling strategy */
-  enum MetricSamplingStrategyType { NONE, REGULAR, RANDOM };
+  /** enum type for metric sampling strategy. MASK packs every virtual
+   * domain point inside the fixed image mask into the sampled point
+   * set once per level, so the per-iteration metric work scales with
+   * the masked voxels instead of the full virtual domain; the metric
+   * threaders then partition the packed point list instead of the
+   * image region. A fixed image mask must be set on the metric for
+   * this strategy. */
+  enum MetricSamplingStrategyType { NONE, REGULAR, RANDOM, MASK };
 
   using MetricSamplePointSetType = typename ImageMetricType::FixedSampledPointSetType;
 
@@ -381,6 +388,26 @@ public:
   itkGetConstMacro( SmoothingSigmasAreSpecifiedInPhysicalUnits, bool );
   itkBooleanMacro( SmoothingSigmasAreSpecifiedInPhysicalUnits );
 
+  /** Caches of smoothed images, shared between stages. */
+  using FixedImagePyramidCacheType = SmoothedImagePyramidCache<FixedImageType>;
+  using MovingImagePyramidCacheType = SmoothedImagePyramidCache<MovingImageType>;
+
+  /**
+   * Set/Get an optional cache of smoothed fixed images. When several
+   * stages of a multi-stage pipeline use the same fixed image, shrink
+   * factors and smoothing sigmas, assigning one cache instance to all of
+   * them builds each smoothed level only once instead of once per stage.
+   * Cached levels are reused across stages and are rebuilt only when the
+   * input image is modified. No cache is used by default.
+   */
+  itkSetObjectMacro( FixedImagePyramidCache, FixedImagePyramidCacheType );
+  itkGetModifiableObjectMacro( FixedImagePyramidCache, FixedImagePyramidCacheType );
+
+  /** Set/Get an optional cache of smoothed moving images, shared between
+   * stages in the same way as the fixed image cache. */
+  itkSetObjectMacro( MovingImagePyramidCache, MovingImagePyramidCacheType );
+  itkGetModifiableObjectMacro( MovingImagePyramidCache, MovingImagePyramidCacheType );
+
   /** Make a DataObject of the correct type to be used as the specified output. */
   using DataObjectPointerArraySizeType = ProcessObject::DataObjectPointerArraySizeType;
   using Superclass::MakeOutput;
@@ -490,6 +517,9 @@ protected:
   SmoothingSigmasArrayType                                        m_SmoothingSigmasPerLevel;
   bool                                                            m_SmoothingSigmasAreSpecifiedInPhysicalUnits;
 
+  typename FixedImagePyramidCacheType::Pointer                    m_FixedImagePyramidCache;
+  typename MovingImagePyramidCacheType::Pointer                   m_MovingImagePyramidCache;
+
   bool                                                            m_ReseedIterator;
   int                                                             m_RandomSeed;
   int                                                             m_CurrentRandomSeed;
@@ -603,7 +603,6 @@ ImageRegistrationMethodv4<TFixedImage, TMovingImage, TTransform, TVirtualImage,
       if ( this->m_SmoothingSigmasPerLevel[level] > 0 )
         {
         using FixedImageSmoothingFilterType = SmoothingRecursiveGaussianImageFilter<FixedImageType, FixedImageType>;
-        typename FixedImageSmoothingFilterType::Pointer fixedImageSmoothingFilter = FixedImageSmoothingFilterType::New();
         typename FixedImageSmoothingFilterType::SigmaArrayType fixedImageSigmaArray( this->m_SmoothingSigmasPerLevel[level] );
 
         if( !this->m_SmoothingSigmasAreSpecifiedInPhysicalUnits  )
@@ -614,15 +613,26 @@ ImageRegistrationMethodv4<TFixedImage, TMovingImage, TTransform, TVirtualImage,
             fixedImageSigmaArray[i] *= fixedSpacing[i];
             }
           }
-        fixedImageSmoothingFilter->SetSigmaArray( fixedImageSigmaArray );
-        fixedImageSmoothingFilter->SetInput( this->GetFixedImage( n ) );
 
-        this->m_FixedSmoothImages[n] = fixedImageSmoothingFilter->GetOutput();
-        fixedImageSmoothingFilter->Update();
-        fixedImageSmoothingFilter->GetOutput()->DisconnectPipeline();
+        if( this->m_FixedImagePyramidCache.IsNotNull() )
+          {
+          /* Reuse the smoothed image from a previous stage, or build and
+           * cache it for subsequent stages. */
+          this->m_FixedSmoothImages[n] =
+            this->m_FixedImagePyramidCache->GetSmoothedImage( this->GetFixedImage( n ), fixedImageSigmaArray );
+          }
+        else
+          {
+          typename FixedImageSmoothingFilterType::Pointer fixedImageSmoothingFilter = FixedImageSmoothingFilterType::New();
+          fixedImageSmoothingFilter->SetSigmaArray( fixedImageSigmaArray );
+          fixedImageSmoothingFilter->SetInput( this->GetFixedImage( n ) );
+
+          this->m_FixedSmoothImages[n] = fixedImageSmoothingFilter->GetOutput();
+          fixedImageSmoothingFilter->Update();
+          fixedImageSmoothingFilter->GetOutput()->DisconnectPipeline();
+          }
 
         using MovingImageSmoothingFilterType = SmoothingRecursiveGaussianImageFilter<MovingImageType, MovingImageType>;
-        typename MovingImageSmoothingFilterType::Pointer movingImageSmoothingFilter = MovingImageSmoothingFilterType::New();
         typename MovingImageSmoothingFilterType::SigmaArrayType movingImageSigmaArray( this->m_SmoothingSigmasPerLevel[level] );
 
         if( !this->m_SmoothingSigmasAreSpecifiedInPhysicalUnits  )
@@ -633,12 +643,22 @@ ImageRegistrationMethodv4<TFixedImage, TMovingImage, TTransform, TVirtualImage,
             movingImageSigmaArray[i] *= movingSpacing[i];
             }
           }
-        movingImageSmoothingFilter->SetSigmaArray( movingImageSigmaArray );
-        movingImageSmoothingFilter->SetInput( this->GetMovingImage( n ) );
 
-        this->m_MovingSmoothImages[n] = movingImageSmoothingFilter->GetOutput();
-        movingImageSmoothingFilter->Update();
-        movingImageSmoothingFilter->GetOutput()->DisconnectPipeline();
+        if( this->m_MovingImagePyramidCache.IsNotNull() )
+          {
+          this->m_MovingSmoothImages[n] =
+            this->m_MovingImagePyramidCache->GetSmoothedImage( this->GetMovingImage( n ), movingImageSigmaArray );
+          }
+        else
+          {
+          typename MovingImageSmoothingFilterType::Pointer movingImageSmoothingFilter = MovingImageSmoothingFilterType::New();
+          movingImageSmoothingFilter->SetSigmaArray( movingImageSigmaArray );
+          movingImageSmoothingFilter->SetInput( this->GetMovingImage( n ) );
+
+          this->m_MovingSmoothImages[n] = movingImageSmoothingFilter->GetOutput();
+          movingImageSmoothingFilter->Update();
+          movingImageSmoothingFilter->GetOutput()->DisconnectPipeline();
+          }
         }
       else
         {
@@ -990,6 +1010,38 @@ ImageRegistrationMethodv4<TFixedImage, TMovingImage, TTransform, TVirtualImage,
           }
         break;
         }
+      case MASK:
+        {
+        if( !fixedMaskImage )
+          {
+          itkExceptionMacro( "The MASK sampling strategy requires a fixed image mask on the metric." );
+          }
+        // Pack the masked subset of the dense virtual domain. The grid
+        // points are kept exact (no perturbation) so the metric sees
+        // the same samples a full NONE sweep would, restricted to the
+        // mask; the sampling percentage subsamples within the mask the
+        // same way REGULAR does over the whole domain.
+        const auto sampleCount = static_cast<unsigned long>(
+          std::ceil( 1.0 / this->m_MetricSamplingPercentagePerLevel[this->m_CurrentLevel] ) );
+        unsigned long count = sampleCount;
+        ImageRegionConstIteratorWithIndex<VirtualDomainImageType> It( virtualImage, virtualDomainRegion );
+        for( It.GoToBegin(); !It.IsAtEnd(); ++It )
+          {
+          if( count == sampleCount )
+            {
+            count = 0;
+            SamplePointType point;
+            virtualImage->TransformIndexToPhysicalPoint( It.GetIndex(), point );
+            if( fixedMaskImage->IsInside( point ) )
+              {
+              samplePointSet->SetPoint( index, point );
+              ++index;
+              }
+            }
+          ++count;
+          }
+        break;
+        }
       case RANDOM:
         {
         const unsigned long totalVirtualDomainVoxels = virtualDomainRegion.GetNumberOfPixels();
@@ -1172,6 +1224,9 @@ ImageRegistrationMethodv4<TFixedImage, TMovingImage, TTransform, TVirtualImage,
   os << indent << "RandomSeed: " << m_RandomSeed << std::endl;
   os << indent << "CurrentRandomSeed: " << m_CurrentRandomSeed << std::endl;
 
+  itkPrintSelfObjectMacro( FixedImagePyramidCache );
+  itkPrintSelfObjectMacro( MovingImagePyramidCache );
+
   os << indent << "InPlace: " << ( this->m_InPlace ? "On" : "Off" ) << std::endl;
 
   os << indent << "InitializeCenterOfLinearOutputTransform: "
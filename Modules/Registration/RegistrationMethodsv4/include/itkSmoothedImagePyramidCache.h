@@ -0,0 +1,119 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkSmoothedImagePyramidCache_h
+#define itkSmoothedImagePyramidCache_h
+
+#include "itkObject.h"
+#include "itkSmoothingRecursiveGaussianImageFilter.h"
+
+#include <vector>
+
+namespace itk
+{
+
+/** \class SmoothedImagePyramidCache
+ * \brief Cache of Gaussian-smoothed images shared between registration stages.
+ *
+ * Multi-stage registration pipelines built from several
+ * ImageRegistrationMethodv4 instances typically request the same smoothed
+ * version of the same input image once per stage, because each stage
+ * rebuilds its levels independently. This class stores the smoothed
+ * images so that each pyramid level is computed only once and then shared
+ * between stages. Entries are keyed by the input image and the smoothing
+ * sigmas, and an entry is recomputed when the input image has been
+ * modified since the entry was built.
+ *
+ * A single cache instance can be assigned to the fixed side of several
+ * registration stages via
+ * ImageRegistrationMethodv4::SetFixedImagePyramidCache(), and likewise
+ * for the moving side. The cache is not thread safe; it is intended for
+ * stages that execute sequentially, which is how multi-stage pipelines
+ * are composed.
+ *
+ * \ingroup ITKRegistrationMethodsv4
+ */
+template<typename TImage>
+class ITK_TEMPLATE_EXPORT SmoothedImagePyramidCache
+: public Object
+{
+public:
+  ITK_DISALLOW_COPY_AND_ASSIGN(SmoothedImagePyramidCache);
+
+  /** Standard class type aliases. */
+  using Self = SmoothedImagePyramidCache;
+  using Superclass = Object;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro( Self );
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro( SmoothedImagePyramidCache, Object );
+
+  /** Image type aliases. */
+  using ImageType = TImage;
+  using ImagePointer = typename ImageType::Pointer;
+  using ImageConstPointer = typename ImageType::ConstPointer;
+
+  /** Smoothing filter used to build missing levels. */
+  using SmoothingFilterType = SmoothingRecursiveGaussianImageFilter<ImageType, ImageType>;
+  using SigmaArrayType = typename SmoothingFilterType::SigmaArrayType;
+
+  /** Return the input image smoothed with the given sigmas. The smoothed
+   * image is computed on the first request and the cached result is
+   * returned on subsequent requests, unless the input image has been
+   * modified in the meantime, in which case the entry is rebuilt. */
+  ImagePointer GetSmoothedImage( const ImageType * image, const SigmaArrayType & sigmaArray );
+
+  /** Discard all cached images. */
+  void Clear();
+
+  /** Get the number of images currently held in the cache. */
+  SizeValueType GetNumberOfCachedImages() const
+    {
+    return static_cast<SizeValueType>( this->m_Entries.size() );
+    }
+
+protected:
+  SmoothedImagePyramidCache() = default;
+  ~SmoothedImagePyramidCache() override = default;
+
+  void PrintSelf( std::ostream & os, Indent indent ) const override;
+
+private:
+  /** Run the smoothing filter for a cache miss. */
+  ImagePointer SmoothImage( const ImageType * image, const SigmaArrayType & sigmaArray ) const;
+
+  struct CacheEntry
+    {
+    ImageConstPointer Input;
+    ModifiedTimeType  InputModifiedTime;
+    SigmaArrayType    Sigmas;
+    ImagePointer      Output;
+    };
+
+  std::vector<CacheEntry> m_Entries;
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#include "itkSmoothedImagePyramidCache.hxx"
+#endif
+
+#endif
@@ -0,0 +1,96 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkSmoothedImagePyramidCache_hxx
+#define itkSmoothedImagePyramidCache_hxx
+
+#include "itkSmoothedImagePyramidCache.h"
+
+namespace itk
+{
+
+template<typename TImage>
+typename SmoothedImagePyramidCache<TImage>::ImagePointer
+SmoothedImagePyramidCache<TImage>
+::GetSmoothedImage( const ImageType * image, const SigmaArrayType & sigmaArray )
+{
+  if( image == nullptr )
+    {
+    itkExceptionMacro( "Input image is not present." );
+    }
+
+  for( auto & entry : this->m_Entries )
+    {
+    if( entry.Input.GetPointer() == image && entry.Sigmas == sigmaArray )
+      {
+      if( entry.InputModifiedTime != image->GetMTime() )
+        {
+        /* The input changed since this level was built. Rebuild in place. */
+        entry.Output = this->SmoothImage( image, sigmaArray );
+        entry.InputModifiedTime = image->GetMTime();
+        }
+      return entry.Output;
+      }
+    }
+
+  CacheEntry entry;
+  entry.Input = image;
+  entry.InputModifiedTime = image->GetMTime();
+  entry.Sigmas = sigmaArray;
+  entry.Output = this->SmoothImage( image, sigmaArray );
+  this->m_Entries.push_back( entry );
+
+  return entry.Output;
+}
+
+template<typename TImage>
+typename SmoothedImagePyramidCache<TImage>::ImagePointer
+SmoothedImagePyramidCache<TImage>
+::SmoothImage( const ImageType * image, const SigmaArrayType & sigmaArray ) const
+{
+  typename SmoothingFilterType::Pointer smoothingFilter = SmoothingFilterType::New();
+  smoothingFilter->SetSigmaArray( sigmaArray );
+  smoothingFilter->SetInput( image );
+  smoothingFilter->Update();
+
+  ImagePointer output = smoothingFilter->GetOutput();
+  output->DisconnectPipeline();
+
+  return output;
+}
+
+template<typename TImage>
+void
+SmoothedImagePyramidCache<TImage>
+::Clear()
+{
+  this->m_Entries.clear();
+}
+
+template<typename TImage>
+void
+SmoothedImagePyramidCache<TImage>
+::PrintSelf( std::ostream & os, Indent indent ) const
+{
+  Superclass::PrintSelf( os, indent );
+
+  os << indent << "NumberOfCachedImages: " << this->GetNumberOfCachedImages() << std::endl;
+}
+
+} // end namespace itk
+
+#endif
@@ -0,0 +1,169 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkTimeSeriesImageRegistrationMethod_h
+#define itkTimeSeriesImageRegistrationMethod_h
+
+#include "itkImageRegistrationMethodv4.h"
+
+#include <vector>
+
+namespace itk
+{
+
+/** \class TimeSeriesImageRegistrationMethod
+ * \brief Register every frame of a time series to a common reference.
+ *
+ * Perfusion and cine pipelines typically register each frame of a 4D
+ * acquisition to a reference image by running one ImageRegistrationMethodv4
+ * per frame. Each of those runs rebuilds the fixed-image pyramid and the
+ * metric support structures from scratch and starts the optimization from
+ * the same initial transform, even though consecutive frames are nearly
+ * aligned with each other.
+ *
+ * This class drives a single, user-configured ImageRegistrationMethodv4
+ * over all frames of a series. The registration method is set up once
+ * (fixed image, metric, optimizer, multi-resolution schedule, initial
+ * transform) and reused for every frame, so the metric internals persist
+ * between frames, and a SmoothedImagePyramidCache is installed on the
+ * fixed side so the fixed pyramid levels are built once for the whole
+ * series. When WarmStartFromPreviousFrame is enabled (the default), each
+ * frame's optimization starts from the transform found for the previous
+ * frame, which typically converges in a small fraction of the iterations
+ * a cold start needs.
+ *
+ * The registration method must have an initial transform set and is run
+ * with InPlace disabled, so that every frame produces its own transform
+ * instance. The per-frame result is available from GetFrameTransform().
+ * Frames are processed sequentially because both the warm start and the
+ * reuse of a single metric/optimizer pair order them; each individual
+ * frame registration is internally multi-threaded as usual.
+ *
+ * \ingroup ITKRegistrationMethodsv4
+ */
+template<typename TFixedImage,
+         typename TMovingImage,
+         typename TOutputTransform = Transform<double, TFixedImage::ImageDimension, TFixedImage::ImageDimension> >
+class ITK_TEMPLATE_EXPORT TimeSeriesImageRegistrationMethod
+: public ProcessObject
+{
+public:
+  ITK_DISALLOW_COPY_AND_ASSIGN(TimeSeriesImageRegistrationMethod);
+
+  /** Standard class type aliases. */
+  using Self = TimeSeriesImageRegistrationMethod;
+  using Superclass = ProcessObject;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro( Self );
+
+  /** ImageDimension constants */
+  static constexpr unsigned int ImageDimension = TFixedImage::ImageDimension;
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro( TimeSeriesImageRegistrationMethod, ProcessObject );
+
+  /** Input type aliases for the images and transforms. */
+  using FixedImageType = TFixedImage;
+  using MovingImageType = TMovingImage;
+  using MovingImageConstPointer = typename MovingImageType::ConstPointer;
+  using MovingImagesContainerType = std::vector<MovingImageConstPointer>;
+
+  /** The single-frame registration method driven over the series. */
+  using RegistrationMethodType = ImageRegistrationMethodv4<TFixedImage, TMovingImage, TOutputTransform>;
+  using RegistrationMethodPointer = typename RegistrationMethodType::Pointer;
+
+  using OutputTransformType = TOutputTransform;
+  using OutputTransformPointer = typename OutputTransformType::Pointer;
+  using InitialTransformType = typename RegistrationMethodType::InitialTransformType;
+  using FixedImagePyramidCacheType = typename RegistrationMethodType::FixedImagePyramidCacheType;
+
+  /** Type for the per-frame outputs: decorated transforms, as produced
+   * by the underlying registration method. */
+  using DecoratedOutputTransformType = DataObjectDecorator<OutputTransformType>;
+  using DecoratedOutputTransformPointer = typename DecoratedOutputTransformType::Pointer;
+
+  /** Set/Get the registration method run for each frame. The method must
+   * be fully configured by the caller, including the fixed (reference)
+   * image and an initial transform. Its moving image and initial
+   * transform inputs are driven by this class. */
+  itkSetObjectMacro( Registration, RegistrationMethodType );
+  itkGetModifiableObjectMacro( Registration, RegistrationMethodType );
+
+  /** Set the moving image of the given frame, extending the series as
+   * needed. */
+  virtual void SetMovingImage( SizeValueType frame, const MovingImageType * image );
+
+  /** Append a frame to the series. */
+  virtual void AddMovingImage( const MovingImageType * image );
+
+  /** Get the moving image of the given frame. */
+  const MovingImageType * GetMovingImage( SizeValueType frame ) const;
+
+  /** Get the number of frames in the series. */
+  SizeValueType GetNumberOfFrames() const
+    {
+    return static_cast<SizeValueType>( this->m_MovingImages.size() );
+    }
+
+  /** Start each frame's optimization from the transform found for the
+   * previous frame instead of the user-supplied initial transform.
+   * Consecutive frames of a time series are usually close to each other,
+   * so the warm start saves most of the optimizer iterations. On by
+   * default. */
+  itkSetMacro( WarmStartFromPreviousFrame, bool );
+  itkGetConstMacro( WarmStartFromPreviousFrame, bool );
+  itkBooleanMacro( WarmStartFromPreviousFrame );
+
+  /** Returns the transform resulting from the registration of the given
+   * frame. */
+  virtual DecoratedOutputTransformType * GetOutput( SizeValueType frame );
+  virtual const DecoratedOutputTransformType * GetOutput( SizeValueType frame ) const;
+
+  virtual OutputTransformType * GetModifiableFrameTransform( SizeValueType frame );
+  virtual const OutputTransformType * GetFrameTransform( SizeValueType frame ) const;
+
+  /** Make a DataObject of the correct type to be used as the specified output. */
+  using DataObjectPointerArraySizeType = ProcessObject::DataObjectPointerArraySizeType;
+  using Superclass::MakeOutput;
+  ProcessObject::DataObjectPointer MakeOutput( DataObjectPointerArraySizeType ) override;
+
+protected:
+  TimeSeriesImageRegistrationMethod();
+  ~TimeSeriesImageRegistrationMethod() override = default;
+
+  void PrintSelf( std::ostream & os, Indent indent ) const override;
+
+  /** Register the frames in temporal order. */
+  void GenerateData() override;
+
+private:
+  RegistrationMethodPointer m_Registration;
+
+  MovingImagesContainerType m_MovingImages;
+
+  bool m_WarmStartFromPreviousFrame{ true };
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#include "itkTimeSeriesImageRegistrationMethod.hxx"
+#endif
+
+#endif
@@ -0,0 +1,203 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkTimeSeriesImageRegistrationMethod_hxx
+#define itkTimeSeriesImageRegistrationMethod_hxx
+
+#include "itkTimeSeriesImageRegistrationMethod.h"
+
+namespace itk
+{
+
+template<typename TFixedImage, typename TMovingImage, typename TTransform>
+TimeSeriesImageRegistrationMethod<TFixedImage, TMovingImage, TTransform>
+::TimeSeriesImageRegistrationMethod()
+{
+  this->m_Registration = nullptr;
+
+  this->SetNumberOfRequiredOutputs( 0 );
+}
+
+template<typename TFixedImage, typename TMovingImage, typename TTransform>
+void
+TimeSeriesImageRegistrationMethod<TFixedImage, TMovingImage, TTransform>
+::SetMovingImage( SizeValueType frame, const MovingImageType *image )
+{
+  itkDebugMacro( "setting moving image of frame " << frame << " to " << image );
+
+  if( frame >= this->GetNumberOfFrames() )
+    {
+    this->m_MovingImages.resize( frame + 1 );
+    this->SetNumberOfRequiredOutputs( frame + 1 );
+    }
+  if( this->m_MovingImages[frame] != image )
+    {
+    this->m_MovingImages[frame] = image;
+
+    // Process object is not const-correct, the const_cast is required here.
+    this->ProcessObject::SetNthInput( frame, const_cast<MovingImageType *>( image ) );
+    this->ProcessObject::SetNthOutput( frame, this->MakeOutput( frame ) );
+    this->Modified();
+    }
+}
+
+template<typename TFixedImage, typename TMovingImage, typename TTransform>
+void
+TimeSeriesImageRegistrationMethod<TFixedImage, TMovingImage, TTransform>
+::AddMovingImage( const MovingImageType *image )
+{
+  this->SetMovingImage( this->GetNumberOfFrames(), image );
+}
+
+template<typename TFixedImage, typename TMovingImage, typename TTransform>
+const typename TimeSeriesImageRegistrationMethod<TFixedImage, TMovingImage, TTransform>::MovingImageType *
+TimeSeriesImageRegistrationMethod<TFixedImage, TMovingImage, TTransform>
+::GetMovingImage( SizeValueType frame ) const
+{
+  if( frame >= this->GetNumberOfFrames() )
+    {
+    itkExceptionMacro( "Requested frame " << frame << " but the series has "
+      << this->GetNumberOfFrames() << " frames." );
+    }
+  return this->m_MovingImages[frame];
+}
+
+template<typename TFixedImage, typename TMovingImage, typename TTransform>
+ProcessObject::DataObjectPointer
+TimeSeriesImageRegistrationMethod<TFixedImage, TMovingImage, TTransform>
+::MakeOutput( DataObjectPointerArraySizeType itkNotUsed(output) )
+{
+  return DecoratedOutputTransformType::New().GetPointer();
+}
+
+template<typename TFixedImage, typename TMovingImage, typename TTransform>
+typename TimeSeriesImageRegistrationMethod<TFixedImage, TMovingImage, TTransform>::DecoratedOutputTransformType *
+TimeSeriesImageRegistrationMethod<TFixedImage, TMovingImage, TTransform>
+::GetOutput( SizeValueType frame )
+{
+  return static_cast<DecoratedOutputTransformType *>( this->ProcessObject::GetOutput( frame ) );
+}
+
+template<typename TFixedImage, typename TMovingImage, typename TTransform>
+const typename TimeSeriesImageRegistrationMethod<TFixedImage, TMovingImage, TTransform>::DecoratedOutputTransformType *
+TimeSeriesImageRegistrationMethod<TFixedImage, TMovingImage, TTransform>
+::GetOutput( SizeValueType frame ) const
+{
+  return static_cast<const DecoratedOutputTransformType *>( this->ProcessObject::GetOutput( frame ) );
+}
+
+template<typename TFixedImage, typename TMovingImage, typename TTransform>
+typename TimeSeriesImageRegistrationMethod<TFixedImage, TMovingImage, TTransform>::OutputTransformType *
+TimeSeriesImageRegistrationMethod<TFixedImage, TMovingImage, TTransform>
+::GetModifiableFrameTransform( SizeValueType frame )
+{
+  return this->GetOutput( frame )->GetModifiable();
+}
+
+template<typename TFixedImage, typename TMovingImage, typename TTransform>
+const typename TimeSeriesImageRegistrationMethod<TFixedImage, TMovingImage, TTransform>::OutputTransformType *
+TimeSeriesImageRegistrationMethod<TFixedImage, TMovingImage, TTransform>
+::GetFrameTransform( SizeValueType frame ) const
+{
+  return this->GetOutput( frame )->Get();
+}
+
+template<typename TFixedImage, typename TMovingImage, typename TTransform>
+void
+TimeSeriesImageRegistrationMethod<TFixedImage, TMovingImage, TTransform>
+::GenerateData()
+{
+  const SizeValueType numberOfFrames = this->GetNumberOfFrames();
+
+  if( this->m_Registration.IsNull() )
+    {
+    itkExceptionMacro( "The registration method is not present." );
+    }
+  if( numberOfFrames == 0 )
+    {
+    itkExceptionMacro( "No moving images have been set." );
+    }
+
+  const InitialTransformType * initialTransform = this->m_Registration->GetInitialTransform();
+  if( initialTransform == nullptr )
+    {
+    itkExceptionMacro( "The registration method must have an initial transform "
+      << "set so that each frame can produce its own transform instance." );
+    }
+
+  // Each frame has to yield a distinct output transform, which requires
+  // the registration method to clone its initial transform per run.
+  this->m_Registration->InPlaceOff();
+
+  // Share the smoothed fixed pyramid levels between the frames, unless
+  // the caller already installed a cache of their own.
+  if( this->m_Registration->GetModifiableFixedImagePyramidCache() == nullptr )
+    {
+    typename FixedImagePyramidCacheType::Pointer cache = FixedImagePyramidCacheType::New();
+    this->m_Registration->SetFixedImagePyramidCache( cache );
+    }
+
+  OutputTransformType * previousFrameTransform = nullptr;
+
+  for( SizeValueType frame = 0; frame < numberOfFrames; frame++ )
+    {
+    if( this->m_MovingImages[frame].IsNull() )
+      {
+      itkExceptionMacro( "The moving image of frame " << frame << " is not present." );
+      }
+
+    this->m_Registration->SetMovingImage( this->m_MovingImages[frame] );
+
+    if( this->m_WarmStartFromPreviousFrame && previousFrameTransform != nullptr )
+      {
+      this->m_Registration->SetInitialTransform( previousFrameTransform );
+      }
+    else
+      {
+      this->m_Registration->SetInitialTransform( initialTransform );
+      }
+
+    this->m_Registration->Update();
+
+    OutputTransformType * frameTransform = this->m_Registration->GetModifiableTransform();
+    this->GetOutput( frame )->Set( frameTransform );
+    previousFrameTransform = frameTransform;
+
+    this->UpdateProgress( static_cast<float>( frame + 1 )
+                          / static_cast<float>( numberOfFrames ) );
+    }
+
+  // Leave the registration method the way the caller configured it.
+  this->m_Registration->SetInitialTransform( initialTransform );
+}
+
+template<typename TFixedImage, typename TMovingImage, typename TTransform>
+void
+TimeSeriesImageRegistrationMethod<TFixedImage, TMovingImage, TTransform>
+::PrintSelf( std::ostream & os, Indent indent ) const
+{
+  Superclass::PrintSelf( os, indent );
+
+  os << indent << "Number of frames: " << this->GetNumberOfFrames() << std::endl;
+  os << indent << "Warm start from previous frame: "
+     << ( this->m_WarmStartFromPreviousFrame ? "On" : "Off" ) << std::endl;
+  itkPrintSelfObjectMacro( Registration );
+}
+
+} // end namespace itk
+
+#endif
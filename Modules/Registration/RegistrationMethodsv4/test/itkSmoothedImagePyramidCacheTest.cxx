@@ -0,0 +1,121 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkSmoothedImagePyramidCache.h"
+#include "itkImage.h"
+#include "itkImageRegionIterator.h"
+#include "itkMath.h"
+
+/* Test the smoothed image cache shared between registration stages:
+ * repeated requests must return the cached image, different sigmas
+ * must produce separate entries, the cached result must match a
+ * directly computed smoothing, and modifying the input must trigger
+ * a rebuild. */
+
+int itkSmoothedImagePyramidCacheTest(int, char ** const)
+{
+  using ImageType = itk::Image<float, 2>;
+  using CacheType = itk::SmoothedImagePyramidCache<ImageType>;
+
+  ImageType::SizeType size;
+  size.Fill( 32 );
+  ImageType::RegionType region;
+  region.SetSize( size );
+
+  ImageType::Pointer image = ImageType::New();
+  image->SetRegions( region );
+  image->Allocate();
+
+  itk::ImageRegionIteratorWithIndex<ImageType> it( image, region );
+  for( it.GoToBegin(); !it.IsAtEnd(); ++it )
+    {
+    it.Set( ( it.GetIndex()[0] % 7 ) + ( it.GetIndex()[1] % 5 ) * 2.0f );
+    }
+
+  CacheType::Pointer cache = CacheType::New();
+
+  CacheType::SigmaArrayType sigmas;
+  sigmas.Fill( 2.0 );
+
+  ImageType::Pointer smoothed1 = cache->GetSmoothedImage( image, sigmas );
+  ImageType::Pointer smoothed2 = cache->GetSmoothedImage( image, sigmas );
+
+  if( smoothed1.GetPointer() != smoothed2.GetPointer() )
+    {
+    std::cerr << "Expected the cached image on the second request." << std::endl;
+    return EXIT_FAILURE;
+    }
+  if( cache->GetNumberOfCachedImages() != 1 )
+    {
+    std::cerr << "Expected one cached image, have "
+              << cache->GetNumberOfCachedImages() << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  /* Verify the cached result against a directly computed smoothing. */
+  using SmoothingFilterType = CacheType::SmoothingFilterType;
+  SmoothingFilterType::Pointer smoothingFilter = SmoothingFilterType::New();
+  smoothingFilter->SetSigmaArray( sigmas );
+  smoothingFilter->SetInput( image );
+  smoothingFilter->Update();
+
+  itk::ImageRegionConstIterator<ImageType> itCached( smoothed1, region );
+  itk::ImageRegionConstIterator<ImageType> itDirect( smoothingFilter->GetOutput(), region );
+  for( ; !itCached.IsAtEnd(); ++itCached, ++itDirect )
+    {
+    if( itk::Math::NotExactlyEquals( itCached.Get(), itDirect.Get() ) )
+      {
+      std::cerr << "Cached image does not match direct smoothing." << std::endl;
+      return EXIT_FAILURE;
+      }
+    }
+
+  /* A different sigma array must produce a separate entry. */
+  CacheType::SigmaArrayType otherSigmas;
+  otherSigmas.Fill( 1.0 );
+  ImageType::Pointer smoothed3 = cache->GetSmoothedImage( image, otherSigmas );
+  if( smoothed3.GetPointer() == smoothed1.GetPointer() ||
+      cache->GetNumberOfCachedImages() != 2 )
+    {
+    std::cerr << "Expected a second cache entry for different sigmas." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  /* Modifying the input must trigger a rebuild on the next request. */
+  image->Modified();
+  ImageType::Pointer smoothed4 = cache->GetSmoothedImage( image, sigmas );
+  if( smoothed4.GetPointer() == smoothed1.GetPointer() )
+    {
+    std::cerr << "Expected a rebuilt image after the input was modified." << std::endl;
+    return EXIT_FAILURE;
+    }
+  if( cache->GetNumberOfCachedImages() != 2 )
+    {
+    std::cerr << "Rebuild must replace the stale entry, not add one." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  cache->Clear();
+  if( cache->GetNumberOfCachedImages() != 0 )
+    {
+    std::cerr << "Expected an empty cache after Clear()." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  std::cout << "Test passed." << std::endl;
+  return EXIT_SUCCESS;
+}
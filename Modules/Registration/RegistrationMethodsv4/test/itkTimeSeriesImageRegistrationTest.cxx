@@ -0,0 +1,172 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkTimeSeriesImageRegistrationMethod.h"
+#include "itkGradientDescentOptimizerv4.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkMeanSquaresImageToImageMetricv4.h"
+#include "itkRegistrationParameterScalesFromPhysicalShift.h"
+#include "itkTranslationTransform.h"
+
+#include <cmath>
+
+namespace
+{
+
+// Gaussian blob with the given center
+itk::Image<float, 2>::Pointer CreateBlobImage( double centerX, double centerY )
+{
+  using ImageType = itk::Image<float, 2>;
+
+  ImageType::Pointer image = ImageType::New();
+  ImageType::SizeType size = {{64, 64}};
+  ImageType::RegionType region;
+  region.SetSize( size );
+
+  image->SetRegions( region );
+  image->Allocate();
+
+  itk::ImageRegionIteratorWithIndex<ImageType> it( image, region );
+  while( !it.IsAtEnd() )
+    {
+    const ImageType::IndexType index = it.GetIndex();
+    const double dx = static_cast<double>( index[0] ) - centerX;
+    const double dy = static_cast<double>( index[1] ) - centerY;
+    it.Set( static_cast<float>( 100.0 * std::exp( -( dx * dx + dy * dy ) / ( 2.0 * 8.0 * 8.0 ) ) ) );
+    ++it;
+    }
+  return image;
+}
+
+} // end anonymous namespace
+
+int itkTimeSeriesImageRegistrationTest( int, char* [] )
+{
+  using ImageType = itk::Image<float, 2>;
+  using TransformType = itk::TranslationTransform<double, 2>;
+  using MethodType = itk::TimeSeriesImageRegistrationMethod<ImageType, ImageType, TransformType>;
+  using RegistrationType = MethodType::RegistrationMethodType;
+
+  // The reference and a short series of gradually drifting frames
+  ImageType::Pointer fixedImage = CreateBlobImage( 32.0, 32.0 );
+
+  constexpr unsigned int numberOfFrames = 3;
+  const double frameShifts[numberOfFrames] = { 2.0, 3.0, 4.0 };
+
+  RegistrationType::Pointer registration = RegistrationType::New();
+  registration->SetFixedImage( fixedImage );
+
+  using MetricType = itk::MeanSquaresImageToImageMetricv4<ImageType, ImageType>;
+  MetricType::Pointer metric = MetricType::New();
+  registration->SetMetric( metric );
+
+  using ScalesEstimatorType = itk::RegistrationParameterScalesFromPhysicalShift<MetricType>;
+  ScalesEstimatorType::Pointer scalesEstimator = ScalesEstimatorType::New();
+  scalesEstimator->SetMetric( metric );
+
+  using OptimizerType = itk::GradientDescentOptimizerv4;
+  OptimizerType::Pointer optimizer = OptimizerType::New();
+  optimizer->SetLearningRate( 1.0 );
+  optimizer->SetNumberOfIterations( 100 );
+  optimizer->SetScalesEstimator( scalesEstimator );
+  optimizer->SetDoEstimateLearningRateOnce( false );
+  optimizer->SetDoEstimateLearningRateAtEachIteration( true );
+  registration->SetOptimizer( optimizer );
+
+  registration->SetNumberOfLevels( 2 );
+
+  RegistrationType::ShrinkFactorsArrayType shrinkFactorsPerLevel;
+  shrinkFactorsPerLevel.SetSize( 2 );
+  shrinkFactorsPerLevel[0] = 2;
+  shrinkFactorsPerLevel[1] = 1;
+  registration->SetShrinkFactorsPerLevel( shrinkFactorsPerLevel );
+
+  RegistrationType::SmoothingSigmasArrayType smoothingSigmasPerLevel;
+  smoothingSigmasPerLevel.SetSize( 2 );
+  smoothingSigmasPerLevel[0] = 1;
+  smoothingSigmasPerLevel[1] = 0;
+  registration->SetSmoothingSigmasPerLevel( smoothingSigmasPerLevel );
+
+  TransformType::Pointer initialTransform = TransformType::New();
+  initialTransform->SetIdentity();
+  registration->SetInitialTransform( initialTransform );
+
+  MethodType::Pointer method = MethodType::New();
+  method->SetRegistration( registration );
+  method->WarmStartFromPreviousFrameOn();
+
+  for( unsigned int frame = 0; frame < numberOfFrames; frame++ )
+    {
+    method->AddMovingImage( CreateBlobImage( 32.0 + frameShifts[frame], 32.0 ) );
+    }
+
+  if( method->GetNumberOfFrames() != numberOfFrames )
+    {
+    std::cerr << "Unexpected number of frames: " << method->GetNumberOfFrames() << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  try
+    {
+    method->Update();
+    }
+  catch( itk::ExceptionObject & e )
+    {
+    std::cerr << "Exception caught: " << e << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  for( unsigned int frame = 0; frame < numberOfFrames; frame++ )
+    {
+    const TransformType * frameTransform = method->GetFrameTransform( frame );
+    if( frameTransform == nullptr )
+      {
+      std::cerr << "Frame " << frame << " produced no transform." << std::endl;
+      return EXIT_FAILURE;
+      }
+
+    const TransformType::ParametersType parameters = frameTransform->GetParameters();
+    std::cout << "Frame " << frame << " translation: " << parameters
+              << " (expected " << frameShifts[frame] << ", 0)" << std::endl;
+
+    if( std::abs( parameters[0] - frameShifts[frame] ) > 0.5 || std::abs( parameters[1] ) > 0.5 )
+      {
+      std::cerr << "Frame " << frame << " translation is too far from the known shift."
+                << std::endl;
+      return EXIT_FAILURE;
+      }
+    }
+
+  // Every frame must have its own transform instance
+  if( method->GetFrameTransform( 0 ) == method->GetFrameTransform( 1 ) )
+    {
+    std::cerr << "Frames share a transform instance." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  // The user-supplied initial transform must be left untouched
+  if( registration->GetInitialTransform() != initialTransform.GetPointer() )
+    {
+    std::cerr << "The initial transform of the registration method was not restored."
+              << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  std::cout << "Test PASSED." << std::endl;
+  return EXIT_SUCCESS;
+}
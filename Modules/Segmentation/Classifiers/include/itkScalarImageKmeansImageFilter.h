@@ -138,6 +138,37 @@ public:
   itkGetConstReferenceMacro(UseNonContiguousLabels, bool);
   itkBooleanMacro(UseNonContiguousLabels);
 
+  /** Set/Get the UseHistogramCompression flag. When enabled the K-Means
+   * estimation runs on an intensity histogram of the image instead of on
+   * the KdTree of all pixel values: the weighted Lloyd iterations touch
+   * only the populated histogram bins and the pixels are then labelled in
+   * parallel through a per-bin lookup table. For integer pixel types
+   * whose value range fits into the number of bins the result matches the
+   * exact per-pixel classification; for other inputs the classification
+   * is made at histogram resolution. The default value is false. */
+  itkSetMacro(UseHistogramCompression, bool);
+  itkGetConstReferenceMacro(UseHistogramCompression, bool);
+  itkBooleanMacro(UseHistogramCompression);
+
+  /** Set/Get the number of bins of the compressed histogram. Only used
+   * when UseHistogramCompression is enabled. Defaults to 65536. */
+  itkSetMacro(NumberOfHistogramBins, SizeValueType);
+  itkGetConstReferenceMacro(NumberOfHistogramBins, SizeValueType);
+
+  /** Set/Get the number of mini-batch refinement iterations performed
+   * after the histogram based estimation. Each iteration re-estimates the
+   * class means from a different strided subset of about MiniBatchSize
+   * full-precision pixel values, which removes the quantization of the
+   * histogram for floating point inputs. Only used when
+   * UseHistogramCompression is enabled. Defaults to 0. */
+  itkSetMacro(MiniBatchRefinementIterations, unsigned int);
+  itkGetConstReferenceMacro(MiniBatchRefinementIterations, unsigned int);
+
+  /** Set/Get the number of pixels sampled by one mini-batch refinement
+   * iteration. Defaults to 1048576. */
+  itkSetMacro(MiniBatchSize, SizeValueType);
+  itkGetConstReferenceMacro(MiniBatchSize, SizeValueType);
+
   /** Set Region method to constrain classfication to a certain region */
   void SetImageRegion(const ImageRegionType & region);
 
@@ -170,12 +201,25 @@ protected:
 private:
   using MeansContainer = std::vector< RealPixelType >;
 
+  /** Histogram based flavor of the classification: estimate the class
+   * means on the intensity histogram and label the pixels through a
+   * per-bin lookup table. */
+  void GenerateDataWithHistogramCompression();
+
   MeansContainer m_InitialMeans;
 
   ParametersType m_FinalMeans;
 
   bool m_UseNonContiguousLabels{ false };
 
+  bool m_UseHistogramCompression{ false };
+
+  SizeValueType m_NumberOfHistogramBins{ 65536 };
+
+  unsigned int m_MiniBatchRefinementIterations{ 0 };
+
+  SizeValueType m_MiniBatchSize{ 1048576 };
+
   ImageRegionType m_ImageRegion;
 
   bool m_ImageRegionDefined{ false };
@@ -20,11 +20,17 @@
 
 #include "itkScalarImageKmeansImageFilter.h"
 #include "itkImageRegionExclusionIteratorWithIndex.h"
+#include "itkImageScanlineIterator.h"
 
 #include "itkDistanceToCentroidMembershipFunction.h"
 
+#include "itkMultiThreaderBase.h"
 #include "itkProgressReporter.h"
 
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+
 namespace itk
 {
 template< typename TInputImage, typename TOutputImage >
@@ -60,6 +66,12 @@ void
 ScalarImageKmeansImageFilter< TInputImage, TOutputImage >
 ::GenerateData()
 {
+  if ( m_UseHistogramCompression )
+    {
+    this->GenerateDataWithHistogramCompression();
+    return;
+    }
+
   typename AdaptorType::Pointer adaptor = AdaptorType::New();
 
   // Setup the regions here if a sub-region has been specified to restrict
@@ -217,6 +229,349 @@ ScalarImageKmeansImageFilter< TInputImage, TOutputImage >
     }
 }
 
+template< typename TInputImage, typename TOutputImage >
+void
+ScalarImageKmeansImageFilter< TInputImage, TOutputImage >
+::GenerateDataWithHistogramCompression()
+{
+  using RegionType = typename InputImageType::RegionType;
+  using IndexType = typename InputImageType::IndexType;
+  using InputConstIteratorType = ImageScanlineConstIterator< InputImageType >;
+  using OutputIteratorType = ImageScanlineIterator< OutputImageType >;
+
+  const InputImageType *inputPtr = this->GetInput();
+
+  typename OutputImageType::Pointer outputPtr = this->GetOutput();
+  outputPtr->SetBufferedRegion( outputPtr->GetRequestedRegion() );
+  outputPtr->Allocate();
+
+  RegionType region = outputPtr->GetBufferedRegion();
+
+  // If we constrained the classification to a region, estimate and label
+  // only within the region. Outside pixels are labeled afterwards.
+  if ( m_ImageRegionDefined )
+    {
+    region = m_ImageRegion;
+    }
+
+  const auto numberOfClasses = static_cast< unsigned int >( this->m_InitialMeans.size() );
+
+  MultiThreaderBase *threader = this->GetMultiThreader();
+  std::mutex         mutex;
+
+  //
+  // First pass: the intensity range of the image
+  //
+  InputPixelType minValue = NumericTraits< InputPixelType >::max();
+  InputPixelType maxValue = NumericTraits< InputPixelType >::NonpositiveMin();
+
+  threader->template ParallelizeImageRegion< ImageDimension >( region,
+      [this, inputPtr, &mutex, &minValue, &maxValue]( const RegionType & chunk )
+        {
+        InputPixelType localMin = NumericTraits< InputPixelType >::max();
+        InputPixelType localMax = NumericTraits< InputPixelType >::NonpositiveMin();
+
+        InputConstIteratorType it(inputPtr, chunk);
+        while ( !it.IsAtEnd() )
+          {
+          while ( !it.IsAtEndOfLine() )
+            {
+            const InputPixelType value = it.Get();
+            if ( value < localMin ) { localMin = value; }
+            if ( value > localMax ) { localMax = value; }
+            ++it;
+            }
+          it.NextLine();
+          }
+
+        std::lock_guard< std::mutex > lock(mutex);
+        if ( localMin < minValue ) { minValue = localMin; }
+        if ( localMax > maxValue ) { maxValue = localMax; }
+        }, nullptr );
+
+  const auto minimum = static_cast< double >( minValue );
+  const auto maximum = static_cast< double >( maxValue );
+
+  // For integer pixels whose range fits into the requested number of
+  // bins every intensity gets its own bin and the lookup table
+  // classification is exact.
+  SizeValueType numberOfBins = m_NumberOfHistogramBins;
+  bool          oneBinPerIntensity = false;
+  if ( NumericTraits< InputPixelType >::IsInteger
+       && maximum - minimum + 1.0 <= static_cast< double >( numberOfBins ) )
+    {
+    numberOfBins = static_cast< SizeValueType >( maximum - minimum ) + 1;
+    oneBinPerIntensity = true;
+    }
+
+  const double binWidth = ( oneBinPerIntensity || maximum <= minimum )
+                          ? 1.0 : ( maximum - minimum ) / numberOfBins;
+  const double inverseBinWidth = 1.0 / binWidth;
+
+  // a bin is represented by its exact intensity when it holds a single
+  // one, and by its center otherwise
+  const double binOffset = oneBinPerIntensity ? 0.0 : 0.5;
+
+  auto binOf = [minimum, inverseBinWidth, numberOfBins]( const InputPixelType & value )
+    {
+    auto bin = static_cast< SizeValueType >(
+      ( static_cast< double >( value ) - minimum ) * inverseBinWidth );
+    return ( bin < numberOfBins ) ? bin : numberOfBins - 1;
+    };
+
+  //
+  // Second pass: the intensity histogram
+  //
+  std::vector< SizeValueType > histogram(numberOfBins, 0);
+
+  threader->template ParallelizeImageRegion< ImageDimension >( region,
+      [this, inputPtr, &mutex, &histogram, &binOf, numberOfBins]( const RegionType & chunk )
+        {
+        std::vector< SizeValueType > localHistogram(numberOfBins, 0);
+
+        InputConstIteratorType it(inputPtr, chunk);
+        while ( !it.IsAtEnd() )
+          {
+          while ( !it.IsAtEndOfLine() )
+            {
+            ++localHistogram[binOf( it.Get() )];
+            ++it;
+            }
+          it.NextLine();
+          }
+
+        std::lock_guard< std::mutex > lock(mutex);
+        for ( SizeValueType b = 0; b < numberOfBins; ++b )
+          {
+          histogram[b] += localHistogram[b];
+          }
+        }, nullptr );
+
+  //
+  // Weighted Lloyd iterations over the populated bins, with the same
+  // iteration limit and convergence criterion as the KdTree estimator
+  //
+  std::vector< double > means(numberOfClasses);
+  for ( unsigned int k = 0; k < numberOfClasses; ++k )
+    {
+    means[k] = static_cast< double >( this->m_InitialMeans[k] );
+    }
+
+  auto nearestMean = [&means, numberOfClasses]( double value )
+    {
+    unsigned int nearest = 0;
+    double       minimumDistance = NumericTraits< double >::max();
+    for ( unsigned int k = 0; k < numberOfClasses; ++k )
+      {
+      const double d = value - means[k];
+      if ( d * d < minimumDistance )
+        {
+        minimumDistance = d * d;
+        nearest = k;
+        }
+      }
+    return nearest;
+    };
+
+  constexpr unsigned int maximumNumberOfIterations = 200;
+
+  std::vector< double >        sums(numberOfClasses);
+  std::vector< SizeValueType > counts(numberOfClasses);
+
+  for ( unsigned int iteration = 0; iteration < maximumNumberOfIterations; ++iteration )
+    {
+    std::fill(sums.begin(), sums.end(), 0.0);
+    std::fill(counts.begin(), counts.end(), 0);
+
+    for ( SizeValueType b = 0; b < numberOfBins; ++b )
+      {
+      if ( histogram[b] == 0 )
+        {
+        continue;
+        }
+      const double binCenter = minimum + ( b + binOffset ) * binWidth;
+      const unsigned int k = nearestMean(binCenter);
+      sums[k] += binCenter * histogram[b];
+      counts[k] += histogram[b];
+      }
+
+    double totalChange = 0.0;
+    for ( unsigned int k = 0; k < numberOfClasses; ++k )
+      {
+      if ( counts[k] > 0 )
+        {
+        const double updated = sums[k] / counts[k];
+        totalChange += std::abs(updated - means[k]);
+        means[k] = updated;
+        }
+      }
+
+    if ( totalChange == 0.0 )
+      {
+      break;
+      }
+    }
+
+  //
+  // Optional mini-batch refinement: re-estimate the means from strided
+  // subsets of the full-precision pixel values, one subset per iteration
+  //
+  if ( m_MiniBatchRefinementIterations > 0 )
+    {
+    const SizeValueType totalNumberOfPixels = region.GetNumberOfPixels();
+    const SizeValueType sampleStride =
+      std::max< SizeValueType >( 1, totalNumberOfPixels / std::max< SizeValueType >( 1, m_MiniBatchSize ) );
+
+    // row-major strides within the classified region, to give every
+    // pixel a sampling phase independent of how the region is chunked
+    SizeValueType regionStride[ImageDimension];
+    SizeValueType accumulatedSize = 1;
+    for ( unsigned int d = 0; d < ImageDimension; ++d )
+      {
+      regionStride[d] = accumulatedSize;
+      accumulatedSize *= region.GetSize(d);
+      }
+
+    const RegionType bufferedRegion = inputPtr->GetBufferedRegion();
+    SizeValueType bufferStride[ImageDimension];
+    accumulatedSize = 1;
+    for ( unsigned int d = 0; d < ImageDimension; ++d )
+      {
+      bufferStride[d] = accumulatedSize;
+      accumulatedSize *= bufferedRegion.GetSize(d);
+      }
+
+    const InputPixelType *inputBuffer = inputPtr->GetBufferPointer();
+    const SizeValueType   lineLength = region.GetSize(0);
+
+    // iterate the scanline start pixels only
+    RegionType lineRegion = region;
+    lineRegion.SetSize(0, 1);
+
+    for ( unsigned int iteration = 0; iteration < m_MiniBatchRefinementIterations; ++iteration )
+      {
+      const SizeValueType phase = iteration % sampleStride;
+
+      std::fill(sums.begin(), sums.end(), 0.0);
+      std::fill(counts.begin(), counts.end(), 0);
+
+      threader->template ParallelizeImageRegion< ImageDimension >( lineRegion,
+          [this, inputBuffer, &mutex, &sums, &counts, &nearestMean, &region, &bufferedRegion,
+           &regionStride, &bufferStride, lineLength, sampleStride, phase,
+           numberOfClasses]( const RegionType & chunk )
+            {
+            std::vector< double >        localSums(numberOfClasses, 0.0);
+            std::vector< SizeValueType > localCounts(numberOfClasses, 0);
+
+            ImageRegionConstIteratorWithIndex< InputImageType > lineIt(this->GetInput(), chunk);
+
+            for ( ; !lineIt.IsAtEnd(); ++lineIt )
+              {
+              const IndexType lineIndex = lineIt.GetIndex();
+
+              SizeValueType lineOffset = 0;
+              SizeValueType bufferOffset = 0;
+              for ( unsigned int d = 0; d < ImageDimension; ++d )
+                {
+                lineOffset += ( lineIndex[d] - region.GetIndex(d) ) * regionStride[d];
+                bufferOffset += ( lineIndex[d] - bufferedRegion.GetIndex(d) ) * bufferStride[d];
+                }
+
+              // first pixel of this line whose linear position has the
+              // requested sampling phase
+              const SizeValueType first =
+                ( phase + sampleStride - lineOffset % sampleStride ) % sampleStride;
+
+              for ( SizeValueType x = first; x < lineLength; x += sampleStride )
+                {
+                const auto value = static_cast< double >( inputBuffer[bufferOffset + x] );
+                const unsigned int k = nearestMean(value);
+                localSums[k] += value;
+                ++localCounts[k];
+                }
+              }
+
+            std::lock_guard< std::mutex > lock(mutex);
+            for ( unsigned int k = 0; k < numberOfClasses; ++k )
+              {
+              sums[k] += localSums[k];
+              counts[k] += localCounts[k];
+              }
+            }, nullptr );
+
+      for ( unsigned int k = 0; k < numberOfClasses; ++k )
+        {
+        if ( counts[k] > 0 )
+          {
+          means[k] = sums[k] / counts[k];
+          }
+        }
+      }
+    }
+
+  this->m_FinalMeans = ParametersType(numberOfClasses);
+  for ( unsigned int k = 0; k < numberOfClasses; ++k )
+    {
+    this->m_FinalMeans[k] = means[k];
+    }
+
+  //
+  // Build the bin-to-label lookup table, spreading the labels over the
+  // intensity range when requested, as in the exact classification
+  //
+  unsigned int labelInterval = 1;
+  if ( m_UseNonContiguousLabels )
+    {
+    labelInterval = ( NumericTraits< OutputPixelType >::max() / numberOfClasses ) - 1;
+    }
+
+  std::vector< OutputPixelType > lookupTable(numberOfBins);
+  for ( SizeValueType b = 0; b < numberOfBins; ++b )
+    {
+    const double binCenter = minimum + ( b + binOffset ) * binWidth;
+    lookupTable[b] = static_cast< OutputPixelType >( nearestMean(binCenter) * labelInterval );
+    }
+
+  //
+  // Final pass: label the pixels through the lookup table
+  //
+  threader->template ParallelizeImageRegion< ImageDimension >( region,
+      [this, inputPtr, outputPtr, &lookupTable, &binOf]( const RegionType & chunk )
+        {
+        InputConstIteratorType inputIt(inputPtr, chunk);
+        OutputIteratorType     outputIt(outputPtr, chunk);
+
+        while ( !inputIt.IsAtEnd() )
+          {
+          while ( !inputIt.IsAtEndOfLine() )
+            {
+            outputIt.Set( lookupTable[binOf( inputIt.Get() )] );
+            ++inputIt;
+            ++outputIt;
+            }
+          inputIt.NextLine();
+          outputIt.NextLine();
+          }
+        }, nullptr );
+
+  if ( m_ImageRegionDefined )
+    {
+    // If a region is defined to constrain classification to, we need to label
+    // pixels outside with numberOfClasses + 1.
+    using ExclusionImageIteratorType = ImageRegionExclusionIteratorWithIndex< OutputImageType >;
+    ExclusionImageIteratorType exIt( outputPtr, outputPtr->GetBufferedRegion() );
+    exIt.SetExclusionRegion(region);
+    exIt.GoToBegin();
+
+    const OutputPixelType outsideLabel = labelInterval * numberOfClasses;
+    while ( !exIt.IsAtEnd() )
+      {
+      exIt.Set(outsideLabel);
+      ++exIt;
+      }
+    }
+}
+
 template< typename TInputImage, typename TOutputImage >
 void
 ScalarImageKmeansImageFilter< TInputImage, TOutputImage >
@@ -234,6 +589,10 @@ ScalarImageKmeansImageFilter< TInputImage, TOutputImage >
 
   os << indent << "Final Means " << m_FinalMeans << std::endl;
   os << indent << "Use Contiguous Labels " << m_UseNonContiguousLabels << std::endl;
+  os << indent << "Use Histogram Compression " << m_UseHistogramCompression << std::endl;
+  os << indent << "Number Of Histogram Bins " << m_NumberOfHistogramBins << std::endl;
+  os << indent << "Mini-Batch Refinement Iterations " << m_MiniBatchRefinementIterations << std::endl;
+  os << indent << "Mini-Batch Size " << m_MiniBatchSize << std::endl;
   os << indent << "Image Region Defined: " << m_ImageRegionDefined << std::endl;
   os << indent << "Image Region: " << m_ImageRegion << std::endl;
 }
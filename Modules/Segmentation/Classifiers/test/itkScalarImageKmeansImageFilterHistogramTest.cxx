@@ -0,0 +1,148 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkScalarImageKmeansImageFilter.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkMath.h"
+
+// The histogram-compressed estimation must reproduce the classification
+// of the KdTree based estimation for an integer image, since every
+// intensity then gets its own histogram bin.
+int itkScalarImageKmeansImageFilterHistogramTest(int, char* [] )
+{
+  using PixelType = unsigned char;
+  constexpr unsigned int Dimension = 2;
+
+  using ImageType = itk::Image< PixelType, Dimension >;
+
+  ImageType::SizeType size;
+  size.Fill( 128 );
+
+  ImageType::RegionType region;
+  region.SetSize( size );
+
+  ImageType::Pointer image = ImageType::New();
+  image->SetRegions( region );
+  image->Allocate();
+
+  // three horizontal bands with deterministic intra-band variation
+  itk::ImageRegionIteratorWithIndex< ImageType > it( image, region );
+  for ( ; !it.IsAtEnd(); ++it )
+    {
+    const itk::IndexValueType x = it.GetIndex()[0];
+    const itk::IndexValueType y = it.GetIndex()[1];
+
+    unsigned int value = 30;
+    if ( y >= 42 )
+      {
+      value = 120;
+      }
+    if ( y >= 84 )
+      {
+      value = 210;
+      }
+    value += ( x * 7 + y * 3 ) % 21;
+
+    it.Set( static_cast< PixelType >( value ) );
+    }
+
+  using KMeansFilterType = itk::ScalarImageKmeansImageFilter< ImageType >;
+
+  KMeansFilterType::Pointer kmeansFilter = KMeansFilterType::New();
+  kmeansFilter->SetInput( image );
+  kmeansFilter->AddClassWithInitialMean( 0.0 );
+  kmeansFilter->AddClassWithInitialMean( 128.0 );
+  kmeansFilter->AddClassWithInitialMean( 255.0 );
+  kmeansFilter->Update();
+
+  KMeansFilterType::Pointer histogramKmeansFilter = KMeansFilterType::New();
+  histogramKmeansFilter->SetInput( image );
+  histogramKmeansFilter->AddClassWithInitialMean( 0.0 );
+  histogramKmeansFilter->AddClassWithInitialMean( 128.0 );
+  histogramKmeansFilter->AddClassWithInitialMean( 255.0 );
+  histogramKmeansFilter->UseHistogramCompressionOn();
+  histogramKmeansFilter->Update();
+  histogramKmeansFilter->Print( std::cout );
+
+  const KMeansFilterType::ParametersType & exactMeans =
+    kmeansFilter->GetFinalMeans();
+  const KMeansFilterType::ParametersType & histogramMeans =
+    histogramKmeansFilter->GetFinalMeans();
+
+  for ( unsigned int k = 0; k < exactMeans.Size(); ++k )
+    {
+    std::cout << "cluster[" << k << "] estimated means: "
+              << exactMeans[k] << " " << histogramMeans[k] << std::endl;
+
+    if ( std::abs( exactMeans[k] - histogramMeans[k] ) > 1e-6 )
+      {
+      std::cerr << "Histogram estimated mean deviates from the exact one." << std::endl;
+      return EXIT_FAILURE;
+      }
+    }
+
+  using OutputImageType = KMeansFilterType::OutputImageType;
+
+  itk::ImageRegionConstIterator< OutputImageType >
+    exactLabelIt( kmeansFilter->GetOutput(), region );
+  itk::ImageRegionConstIterator< OutputImageType >
+    histogramLabelIt( histogramKmeansFilter->GetOutput(), region );
+
+  while ( !exactLabelIt.IsAtEnd() )
+    {
+    if ( exactLabelIt.Get() != histogramLabelIt.Get() )
+      {
+      std::cerr << "Histogram classified label " << (int)histogramLabelIt.Get()
+                << " differs from exact label " << (int)exactLabelIt.Get() << std::endl;
+      return EXIT_FAILURE;
+      }
+    ++exactLabelIt;
+    ++histogramLabelIt;
+    }
+
+  // the mini-batch refinement of full-precision values must leave the
+  // means of an integer image essentially unchanged
+  KMeansFilterType::Pointer refinedKmeansFilter = KMeansFilterType::New();
+  refinedKmeansFilter->SetInput( image );
+  refinedKmeansFilter->AddClassWithInitialMean( 0.0 );
+  refinedKmeansFilter->AddClassWithInitialMean( 128.0 );
+  refinedKmeansFilter->AddClassWithInitialMean( 255.0 );
+  refinedKmeansFilter->UseHistogramCompressionOn();
+  refinedKmeansFilter->SetMiniBatchRefinementIterations( 3 );
+  refinedKmeansFilter->SetMiniBatchSize( 4096 );
+  refinedKmeansFilter->Update();
+
+  const KMeansFilterType::ParametersType & refinedMeans =
+    refinedKmeansFilter->GetFinalMeans();
+
+  for ( unsigned int k = 0; k < refinedMeans.Size(); ++k )
+    {
+    std::cout << "cluster[" << k << "] refined mean: "
+              << refinedMeans[k] << std::endl;
+
+    if ( std::abs( refinedMeans[k] - exactMeans[k] ) > 2.0 )
+      {
+      std::cerr << "Mini-batch refined mean deviates too far from the exact one." << std::endl;
+      return EXIT_FAILURE;
+      }
+    }
+
+  std::cout << "Test passed." << std::endl;
+  return EXIT_SUCCESS;
+}
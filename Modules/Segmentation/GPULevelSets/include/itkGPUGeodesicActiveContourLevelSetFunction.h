@@ -0,0 +1,190 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkGPUGeodesicActiveContourLevelSetFunction_h
+#define itkGPUGeodesicActiveContourLevelSetFunction_h
+
+#include "itkGPUFiniteDifferenceFunction.h"
+
+namespace itk
+{
+/** \class GPUGeodesicActiveContourLevelSetFunction
+ *
+ * This function evaluates the right hand side of the geodesic active
+ * contour equation of Caselles et al. on the GPU,
+ *
+ * \f[\phi_t = c\,g\,\kappa|\nabla\phi| - p\,g\,|\nabla\phi|
+ *             + a\,\nabla g \cdot \nabla\phi\f]
+ *
+ * where \f$g\f$ is the edge potential (speed) image and \f$c\f$, \f$p\f$
+ * and \f$a\f$ are the curvature, propagation and advection weights.  The
+ * whole stencil grid is evaluated by a single OpenCL kernel launch per
+ * iteration; upwinding of the propagation and advection terms and the
+ * mean curvature computation match the CPU LevelSetFunction schemes.
+ *
+ * The speed image must have the same grid as the evolving level set and
+ * is expected to be precomputed by the caller (e.g. as a sigmoid of a
+ * gradient magnitude image), as is customary for the CPU geodesic active
+ * contour filter with ReverseExpansionDirection off.
+ *
+ * \ingroup ITKGPULevelSets
+ */
+
+/** Create a helper GPU Kernel class for GPUGeodesicActiveContourLevelSetFunction */
+itkGPUKernelClassMacro(GPUGeodesicActiveContourLevelSetFunctionKernel);
+
+template< typename TImage >
+class ITK_TEMPLATE_EXPORT GPUGeodesicActiveContourLevelSetFunction :
+  public GPUFiniteDifferenceFunction< TImage >
+{
+public:
+  ITK_DISALLOW_COPY_AND_ASSIGN(GPUGeodesicActiveContourLevelSetFunction);
+
+  /** Standard class type aliases. */
+  using Self = GPUGeodesicActiveContourLevelSetFunction;
+  using Superclass = GPUFiniteDifferenceFunction< TImage >;
+  using Pointer = SmartPointer< Self >;
+  using ConstPointer = SmartPointer< const Self >;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods) */
+  itkTypeMacro(GPUGeodesicActiveContourLevelSetFunction,
+               GPUFiniteDifferenceFunction);
+
+  /** Inherit some parameters from the superclass type. */
+  using ImageType = typename Superclass::ImageType;
+  using PixelType = typename Superclass::PixelType;
+  using PixelRealType = typename Superclass::PixelRealType;
+  using TimeStepType = typename Superclass::TimeStepType;
+  using RadiusType = typename Superclass::RadiusType;
+  using NeighborhoodType = typename Superclass::NeighborhoodType;
+  using FloatOffsetType = typename Superclass::FloatOffsetType;
+
+  /** Inherit some parameters from the superclass type. */
+  static constexpr unsigned int ImageDimension = Superclass::ImageDimension;
+
+  /** Get OpenCL Kernel source as a string, creates a GetOpenCLSource method */
+  itkGetOpenCLSourceFromKernelMacro(GPUGeodesicActiveContourLevelSetFunctionKernel);
+
+  /** Set/Get the edge potential (speed) image. */
+  void SetFeatureImage(ImageType *f)
+  {
+    m_FeatureImage = f;
+  }
+
+  ImageType * GetFeatureImage()
+  {
+    return m_FeatureImage.GetPointer();
+  }
+
+  /** Set/Get the weight of the propagation (expansion) term. */
+  void SetPropagationWeight(const PixelType & w)
+  {
+    m_PropagationWeight = w;
+  }
+
+  const PixelType & GetPropagationWeight() const
+  {
+    return m_PropagationWeight;
+  }
+
+  /** Set/Get the weight of the curvature regularization term. */
+  void SetCurvatureWeight(const PixelType & w)
+  {
+    m_CurvatureWeight = w;
+  }
+
+  const PixelType & GetCurvatureWeight() const
+  {
+    return m_CurvatureWeight;
+  }
+
+  /** Set/Get the weight of the edge attraction (advection) term. */
+  void SetAdvectionWeight(const PixelType & w)
+  {
+    m_AdvectionWeight = w;
+  }
+
+  const PixelType & GetAdvectionWeight() const
+  {
+    return m_AdvectionWeight;
+  }
+
+  /** Set/Get the time step. A fixed, user supplied time step is used for
+      all updates, as for the GPU anisotropic diffusion functions. */
+  void SetTimeStep(const TimeStepType & t)
+  {
+    m_TimeStep = t;
+  }
+
+  const TimeStepType & GetTimeStep() const
+  {
+    return m_TimeStep;
+  }
+
+  /** This method is called prior to each iteration of the solver. */
+  void InitializeIteration() override
+  {
+    if( m_FeatureImage.IsNull() )
+      {
+      itkExceptionMacro("The feature (speed) image has not been set");
+      }
+  }
+
+  /** Returns the time step supplied by the user.  We don't need to use the
+   * global data supplied since we are returning a fixed value. */
+  TimeStepType ComputeGlobalTimeStep( void *itkNotUsed(GlobalData) ) const override
+  {
+    return this->GetTimeStep();
+  }
+
+  /** This class does not use global data. */
+  void * GetGlobalDataPointer() const override
+  {
+    return nullptr;
+  }
+
+  void ReleaseGlobalDataPointer( void *itkNotUsed(GlobalData) ) const override
+  {
+  }
+
+  /** Compute the equation value. */
+  void GPUComputeUpdate( const typename TImage::Pointer output, typename TImage::Pointer buffer,
+                         void *globalData ) override;
+
+protected:
+  GPUGeodesicActiveContourLevelSetFunction();
+  ~GPUGeodesicActiveContourLevelSetFunction() override {}
+
+private:
+  typename ImageType::Pointer m_FeatureImage;
+
+  PixelType m_PropagationWeight;
+  PixelType m_CurvatureWeight;
+  PixelType m_AdvectionWeight;
+
+  TimeStepType m_TimeStep;
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#include "itkGPUGeodesicActiveContourLevelSetFunction.hxx"
+#endif
+
+#endif
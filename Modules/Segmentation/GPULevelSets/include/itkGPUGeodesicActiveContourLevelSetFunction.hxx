@@ -0,0 +1,148 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkGPUGeodesicActiveContourLevelSetFunction_hxx
+#define itkGPUGeodesicActiveContourLevelSetFunction_hxx
+
+#include "itkNumericTraits.h"
+#include "itkGPUGeodesicActiveContourLevelSetFunction.h"
+
+#include "itkOpenCLUtil.h"
+#include "itkGPUImage.h"
+
+namespace itk
+{
+template< typename TImage >
+GPUGeodesicActiveContourLevelSetFunction< TImage >
+::GPUGeodesicActiveContourLevelSetFunction() :
+  m_PropagationWeight( NumericTraits< PixelType >::OneValue() ),
+  m_CurvatureWeight( NumericTraits< PixelType >::OneValue() ),
+  m_AdvectionWeight( NumericTraits< PixelType >::OneValue() ),
+  m_TimeStep( 0.125 )
+{
+  RadiusType r;
+
+  for ( unsigned int i = 0; i < ImageDimension; ++i )
+    {
+    r[i] = 1;
+    }
+  this->SetRadius(r);
+
+  //
+  // Create GPU Kernel
+  //
+  std::ostringstream defines;
+
+  if(TImage::ImageDimension > 3)
+    {
+    itkExceptionMacro("GPUGeodesicActiveContourLevelSetFunction supports 1/2/3D image.");
+    }
+
+  defines << "#define DIM_" << TImage::ImageDimension << "\n";
+  defines << "#define BLOCK_SIZE " << OpenCLGetLocalBlockSize(TImage::ImageDimension) << "\n";
+
+  std::string pixeltypename = GetTypename( typeid(typename TImage::PixelType) );
+  defines << "#define PIXELTYPE " << pixeltypename << "\n";
+  defines << "#define ARGTYPE " << pixeltypename << "\n";
+
+  const char* GPUSource = GPUGeodesicActiveContourLevelSetFunction::GetOpenCLSource();
+
+  // load and build program
+  this->m_GPUKernelManager->LoadProgramFromString( GPUSource, defines.str().c_str() );
+
+  // create kernel
+  this->m_ComputeUpdateGPUKernelHandle = this->m_GPUKernelManager->CreateKernel("ComputeUpdate");
+}
+
+template< typename TImage >
+void
+GPUGeodesicActiveContourLevelSetFunction< TImage >
+::GPUComputeUpdate( const typename TImage::Pointer output, typename TImage::Pointer buffer, void *itkNotUsed(globalData) )
+{
+  /** Launch GPU kernel to evaluate the whole update buffer from the
+   * current level set and the speed image */
+  using GPUImageType = typename itk::GPUTraits< TImage >::Type;
+
+  typename GPUImageType::Pointer  inPtr =  dynamic_cast< GPUImageType * >( output.GetPointer() );
+  typename GPUImageType::Pointer  bfPtr =  dynamic_cast< GPUImageType * >( buffer.GetPointer() );
+  typename GPUImageType::Pointer  spPtr =  dynamic_cast< GPUImageType * >( m_FeatureImage.GetPointer() );
+
+  if( spPtr.IsNull() )
+    {
+    itkExceptionMacro("The feature (speed) image is not a GPU image");
+    }
+
+  typename GPUImageType::SizeType outSize = bfPtr->GetLargestPossibleRegion().GetSize();
+
+  int imgSize[3];
+  imgSize[0] = imgSize[1] = imgSize[2] = 1;
+  float imgScale[3];
+  imgScale[0] = imgScale[1] = imgScale[2] = 1.0f;
+
+  int ImageDim = (int)TImage::ImageDimension;
+
+  const typename GPUImageType::SpacingType spacing = inPtr->GetSpacing();
+
+  for(int i=0; i<ImageDim; i++)
+    {
+    imgSize[i] = outSize[i];
+    imgScale[i] = 1.0f / static_cast< float >( spacing[i] );
+    }
+
+  size_t localSize[3], globalSize[3];
+  localSize[0] = localSize[1] = localSize[2] = OpenCLGetLocalBlockSize(ImageDim);
+
+  for(int i=0; i<ImageDim; i++)
+    {
+    globalSize[i] = localSize[i]*(unsigned int)ceil( (float)outSize[i]/(float)localSize[i]);
+    }
+
+  // arguments set up
+  int argidx = 0;
+  this->m_GPUKernelManager->SetKernelArgWithImage(this->m_ComputeUpdateGPUKernelHandle, argidx++,
+                                                  inPtr->GetGPUDataManager() );
+  this->m_GPUKernelManager->SetKernelArgWithImage(this->m_ComputeUpdateGPUKernelHandle, argidx++,
+                                                  bfPtr->GetGPUDataManager() );
+  this->m_GPUKernelManager->SetKernelArgWithImage(this->m_ComputeUpdateGPUKernelHandle, argidx++,
+                                                  spPtr->GetGPUDataManager() );
+
+  this->m_GPUKernelManager->SetKernelArg(this->m_ComputeUpdateGPUKernelHandle, argidx++,
+                                         sizeof(typename TImage::PixelType), &(m_PropagationWeight) );
+  this->m_GPUKernelManager->SetKernelArg(this->m_ComputeUpdateGPUKernelHandle, argidx++,
+                                         sizeof(typename TImage::PixelType), &(m_CurvatureWeight) );
+  this->m_GPUKernelManager->SetKernelArg(this->m_ComputeUpdateGPUKernelHandle, argidx++,
+                                         sizeof(typename TImage::PixelType), &(m_AdvectionWeight) );
+
+  // derivative scale parameter
+  for(int i=0; i<ImageDim; i++)
+    {
+    this->m_GPUKernelManager->SetKernelArg(this->m_ComputeUpdateGPUKernelHandle, argidx++, sizeof(float), &(imgScale[i]) );
+    }
+
+  // image size
+  for(int i=0; i<ImageDim; i++)
+    {
+    this->m_GPUKernelManager->SetKernelArg(this->m_ComputeUpdateGPUKernelHandle, argidx++, sizeof(int), &(imgSize[i]) );
+    }
+
+  // launch kernel
+  this->m_GPUKernelManager->LaunchKernel( this->m_ComputeUpdateGPUKernelHandle, ImageDim, globalSize, localSize );
+}
+
+} // end namespace itk
+
+#endif
@@ -0,0 +1,166 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkGPUGeodesicActiveContourLevelSetImageFilter_h
+#define itkGPUGeodesicActiveContourLevelSetImageFilter_h
+
+#include "itkOpenCLUtil.h"
+#include "itkGPUDenseFiniteDifferenceImageFilter.h"
+#include "itkGPUGeodesicActiveContourLevelSetFunction.h"
+
+namespace itk
+{
+/**
+ * \class GPUGeodesicActiveContourLevelSetImageFilter
+ * This filter evolves a geodesic active contour on the GPU.  The input is
+ * the initial level set (e.g. a signed distance to the initial contour)
+ * and the feature input is the edge potential (speed) image, as produced
+ * for the CPU GeodesicActiveContourLevelSetImageFilter (typically a
+ * sigmoid of a gradient magnitude image).  Both images must be GPUImages
+ * with identical grids.
+ *
+ * \par
+ * Unlike the CPU filter, which is a sparse-field solver, this filter
+ * evolves the equation densely through
+ * GPUDenseFiniteDifferenceImageFilter: the stencil is re-evaluated for
+ * every pixel of the grid each iteration, which on the GPU is cheaper
+ * than maintaining the active layers.  A fixed, user supplied time step
+ * is used, so it must satisfy the usual CFL bound for the chosen weights.
+ *
+ * \par Parameters
+ * PropagationScaling, CurvatureScaling and AdvectionScaling weight the
+ * three terms of the equation, matching the parameters of the CPU
+ * segmentation level set filters.
+ *
+ * \ingroup ITKGPULevelSets
+ */
+template< typename TInputImage, typename TOutputImage, typename TParentImageFilter =
+            DenseFiniteDifferenceImageFilter< TInputImage, TOutputImage > >
+class GPUGeodesicActiveContourLevelSetImageFilter :
+  public GPUDenseFiniteDifferenceImageFilter< TInputImage, TOutputImage, TParentImageFilter >
+{
+public:
+  ITK_DISALLOW_COPY_AND_ASSIGN(GPUGeodesicActiveContourLevelSetImageFilter);
+
+  /** Standard class type aliases. */
+  using Self = GPUGeodesicActiveContourLevelSetImageFilter;
+  using GPUSuperclass = GPUDenseFiniteDifferenceImageFilter< TInputImage, TOutputImage, TParentImageFilter >;
+  using Pointer = SmartPointer< Self >;
+  using ConstPointer = SmartPointer< const Self >;
+
+  /** Standard method for creation through object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time class information. */
+  itkTypeMacro(GPUGeodesicActiveContourLevelSetImageFilter,
+               GPUDenseFiniteDifferenceImageFilter);
+
+  /** Extract information from the superclass. */
+  using InputImageType = typename GPUSuperclass::InputImageType;
+  using OutputImageType = typename GPUSuperclass::OutputImageType;
+  using UpdateBufferType = typename GPUSuperclass::UpdateBufferType;
+  using PixelType = typename GPUSuperclass::PixelType;
+  using TimeStepType = typename GPUSuperclass::TimeStepType;
+
+  /** Extract information from the superclass. */
+  static constexpr unsigned int ImageDimension = GPUSuperclass::ImageDimension;
+
+  /** The level set function driving the evolution. */
+  using FunctionType = GPUGeodesicActiveContourLevelSetFunction< UpdateBufferType >;
+
+  /** Set/Get the edge potential (speed) image. */
+  void SetFeatureImage(OutputImageType *f)
+  {
+    m_GeodesicFunction->SetFeatureImage(f);
+    this->Modified();
+  }
+
+  OutputImageType * GetFeatureImage()
+  {
+    return m_GeodesicFunction->GetFeatureImage();
+  }
+
+  /** Set/Get the weight of the propagation (expansion) term. */
+  void SetPropagationScaling(const PixelType & w)
+  {
+    m_GeodesicFunction->SetPropagationWeight(w);
+    this->Modified();
+  }
+
+  const PixelType & GetPropagationScaling() const
+  {
+    return m_GeodesicFunction->GetPropagationWeight();
+  }
+
+  /** Set/Get the weight of the curvature regularization term. */
+  void SetCurvatureScaling(const PixelType & w)
+  {
+    m_GeodesicFunction->SetCurvatureWeight(w);
+    this->Modified();
+  }
+
+  const PixelType & GetCurvatureScaling() const
+  {
+    return m_GeodesicFunction->GetCurvatureWeight();
+  }
+
+  /** Set/Get the weight of the edge attraction (advection) term. */
+  void SetAdvectionScaling(const PixelType & w)
+  {
+    m_GeodesicFunction->SetAdvectionWeight(w);
+    this->Modified();
+  }
+
+  const PixelType & GetAdvectionScaling() const
+  {
+    return m_GeodesicFunction->GetAdvectionWeight();
+  }
+
+  /** Set/Get the fixed time step used for every update. */
+  void SetTimeStep(const TimeStepType & t)
+  {
+    m_GeodesicFunction->SetTimeStep(t);
+    this->Modified();
+  }
+
+  const TimeStepType & GetTimeStep() const
+  {
+    return m_GeodesicFunction->GetTimeStep();
+  }
+
+#ifdef ITK_USE_CONCEPT_CHECKING
+  // Begin concept checking
+  itkConceptMacro( UpdateBufferHasNumericTraitsCheck,
+                   ( Concept::HasNumericTraits< typename UpdateBufferType::PixelType > ) );
+  // End concept checking
+#endif
+
+protected:
+  GPUGeodesicActiveContourLevelSetImageFilter()
+  {
+    m_GeodesicFunction = FunctionType::New();
+    this->SetDifferenceFunction(m_GeodesicFunction);
+  }
+
+  ~GPUGeodesicActiveContourLevelSetImageFilter() override {}
+
+private:
+  typename FunctionType::Pointer m_GeodesicFunction;
+};
+} // end namespace itk
+
+#endif
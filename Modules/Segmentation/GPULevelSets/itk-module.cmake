@@ -0,0 +1,18 @@
+set(DOCUMENTATION "This module contains GPU implementations of dense level-set
+segmentation filters built on the GPU finite difference framework. The update
+of the geodesic active contour equation (propagation, curvature and advection
+terms) is evaluated as a single OpenCL stencil kernel over the whole grid,
+which makes large 3D contour evolutions practical.")
+
+itk_module(ITKGPULevelSets
+  DEPENDS
+    ITKCommon
+    ITKGPUCommon
+    ITKGPUFiniteDifference
+  COMPILE_DEPENDS
+    ITKLevelSets
+  TEST_DEPENDS
+    ITKTestKernel
+  DESCRIPTION
+    "${DOCUMENTATION}"
+)
@@ -0,0 +1,227 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+// assume input and output pixel type is same
+#define INPIXELTYPE PIXELTYPE
+#define BUFPIXELTYPE PIXELTYPE
+
+// guard against division by a vanishing gradient magnitude
+#define MIN_NORM 1.0e-6f
+
+//
+// Evaluate the right hand side of the geodesic active contour equation
+//
+//   phi_t = c Z(x) kappa |grad phi| - p P(x) |grad phi| - a A(x) . grad phi
+//
+// with Z = P = g (the speed/feature image), A = -grad g, mean curvature
+// kappa computed from central second derivatives and Godunov upwinding
+// for the propagation and advection terms. Neighbor access is clamped at
+// the dataset boundary (zero flux).
+//
+
+//
+// Dim 1
+//
+#ifdef DIM_1
+#define ImageDimension 1
+__kernel void ComputeUpdate(__global const INPIXELTYPE *in, __global BUFPIXELTYPE *buf,
+                            __global const INPIXELTYPE *spd,
+                            ARGTYPE pw, ARGTYPE cw, ARGTYPE aw,
+                            float scalex, int width)
+{
+  int gix = get_global_id(0);
+
+  // NOTE! 1D version is not implemented
+  if(gix < width)
+  {
+    buf[gix] = 0;
+  }
+}
+#endif
+
+//
+// Dim 2
+//
+#ifdef DIM_2
+#define ImageDimension 2
+__kernel void ComputeUpdate(__global const INPIXELTYPE *in, __global BUFPIXELTYPE *buf,
+                            __global const INPIXELTYPE *spd,
+                            ARGTYPE pw, ARGTYPE cw, ARGTYPE aw,
+                            float scalex, float scaley, int width, int height)
+{
+  int gix = get_global_id(0);
+  int giy = get_global_id(1);
+
+  if(gix >= width || giy >= height) return;
+
+  unsigned int gidx = width*giy + gix;
+
+  // clamped neighbor rows/columns
+  int xm = max(gix-1, 0);
+  int xp = min(gix+1, width-1);
+  int ym = max(giy-1, 0);
+  int yp = min(giy+1, height-1);
+
+  float c   = in[width*giy + gix];
+  float w   = in[width*giy + xm];
+  float e   = in[width*giy + xp];
+  float s   = in[width*ym + gix];
+  float n   = in[width*yp + gix];
+  float sw  = in[width*ym + xm];
+  float se  = in[width*ym + xp];
+  float nw  = in[width*yp + xm];
+  float ne  = in[width*yp + xp];
+
+  // centralized first and second derivatives
+  float dx  = (e - w)*0.5f*scalex;
+  float dy  = (n - s)*0.5f*scaley;
+  float dxx = (e - 2.0f*c + w)*scalex*scalex;
+  float dyy = (n - 2.0f*c + s)*scaley*scaley;
+  float dxy = (ne - nw - se + sw)*0.25f*scalex*scaley;
+
+  // one-sided derivatives
+  float dx_f = (e - c)*scalex;
+  float dx_b = (c - w)*scalex;
+  float dy_f = (n - c)*scaley;
+  float dy_b = (c - s)*scaley;
+
+  float grad2 = dx*dx + dy*dy;
+
+  // curvature term: kappa * |grad phi|
+  float curve = (dxx*dy*dy - 2.0f*dx*dy*dxy + dyy*dx*dx) / (grad2 + MIN_NORM);
+
+  float g = spd[gidx];
+
+  float curvature_term = (float)cw * g * curve;
+
+  // propagation term with Godunov upwinding
+  float p = (float)pw * g;
+  float ug2;
+  if(p > 0)
+  {
+    ug2 = pown(max(dx_b,0.0f),2) + pown(min(dx_f,0.0f),2)
+        + pown(max(dy_b,0.0f),2) + pown(min(dy_f,0.0f),2);
+  }
+  else
+  {
+    ug2 = pown(min(dx_b,0.0f),2) + pown(max(dx_f,0.0f),2)
+        + pown(min(dy_b,0.0f),2) + pown(max(dy_f,0.0f),2);
+  }
+  float propagation_term = p * sqrt(ug2);
+
+  // advection field is the negative speed gradient; upwind per component
+  float ax = -(float)aw * (spd[width*giy + xp] - spd[width*giy + xm])*0.5f*scalex;
+  float ay = -(float)aw * (spd[width*yp + gix] - spd[width*ym + gix])*0.5f*scaley;
+
+  float advection_term = ax * ( ax > 0 ? dx_b : dx_f )
+                       + ay * ( ay > 0 ? dy_b : dy_f );
+
+  buf[gidx] = curvature_term - propagation_term - advection_term;
+}
+#endif
+
+//
+// Dim 3
+//
+#ifdef DIM_3
+#define ImageDimension 3
+__kernel void ComputeUpdate(__global const INPIXELTYPE *in, __global BUFPIXELTYPE *buf,
+                            __global const INPIXELTYPE *spd,
+                            ARGTYPE pw, ARGTYPE cw, ARGTYPE aw,
+                            float scalex, float scaley, float scalez,
+                            int width, int height, int depth)
+{
+  int gix = get_global_id(0);
+  int giy = get_global_id(1);
+  int giz = get_global_id(2);
+
+  if(gix >= width || giy >= height || giz >= depth) return;
+
+  unsigned int gidx = (unsigned int)width*((unsigned int)(giz*height + giy)) + (unsigned int)gix;
+
+  int xm = max(gix-1, 0);
+  int xp = min(gix+1, width-1);
+  int ym = max(giy-1, 0);
+  int yp = min(giy+1, height-1);
+  int zm = max(giz-1, 0);
+  int zp = min(giz+1, depth-1);
+
+#define IDX(ix,iy,iz) ((unsigned int)width*((unsigned int)((iz)*height + (iy))) + (unsigned int)(ix))
+
+  float c = in[IDX(gix,giy,giz)];
+
+  float dx  = (in[IDX(xp,giy,giz)] - in[IDX(xm,giy,giz)])*0.5f*scalex;
+  float dy  = (in[IDX(gix,yp,giz)] - in[IDX(gix,ym,giz)])*0.5f*scaley;
+  float dz  = (in[IDX(gix,giy,zp)] - in[IDX(gix,giy,zm)])*0.5f*scalez;
+
+  float dxx = (in[IDX(xp,giy,giz)] - 2.0f*c + in[IDX(xm,giy,giz)])*scalex*scalex;
+  float dyy = (in[IDX(gix,yp,giz)] - 2.0f*c + in[IDX(gix,ym,giz)])*scaley*scaley;
+  float dzz = (in[IDX(gix,giy,zp)] - 2.0f*c + in[IDX(gix,giy,zm)])*scalez*scalez;
+
+  float dxy = (in[IDX(xp,yp,giz)] - in[IDX(xm,yp,giz)] - in[IDX(xp,ym,giz)] + in[IDX(xm,ym,giz)])*0.25f*scalex*scaley;
+  float dxz = (in[IDX(xp,giy,zp)] - in[IDX(xm,giy,zp)] - in[IDX(xp,giy,zm)] + in[IDX(xm,giy,zm)])*0.25f*scalex*scalez;
+  float dyz = (in[IDX(gix,yp,zp)] - in[IDX(gix,ym,zp)] - in[IDX(gix,yp,zm)] + in[IDX(gix,ym,zm)])*0.25f*scaley*scalez;
+
+  float dx_f = (in[IDX(xp,giy,giz)] - c)*scalex;
+  float dx_b = (c - in[IDX(xm,giy,giz)])*scalex;
+  float dy_f = (in[IDX(gix,yp,giz)] - c)*scaley;
+  float dy_b = (c - in[IDX(gix,ym,giz)])*scaley;
+  float dz_f = (in[IDX(gix,giy,zp)] - c)*scalez;
+  float dz_b = (c - in[IDX(gix,giy,zm)])*scalez;
+
+  float grad2 = dx*dx + dy*dy + dz*dz;
+
+  // curvature term: kappa * |grad phi|
+  float curve = ( dxx*(dy*dy + dz*dz) + dyy*(dx*dx + dz*dz) + dzz*(dx*dx + dy*dy)
+                  - 2.0f*(dx*dy*dxy + dx*dz*dxz + dy*dz*dyz) ) / (grad2 + MIN_NORM);
+
+  float g = spd[gidx];
+
+  float curvature_term = (float)cw * g * curve;
+
+  // propagation term with Godunov upwinding
+  float p = (float)pw * g;
+  float ug2;
+  if(p > 0)
+  {
+    ug2 = pown(max(dx_b,0.0f),2) + pown(min(dx_f,0.0f),2)
+        + pown(max(dy_b,0.0f),2) + pown(min(dy_f,0.0f),2)
+        + pown(max(dz_b,0.0f),2) + pown(min(dz_f,0.0f),2);
+  }
+  else
+  {
+    ug2 = pown(min(dx_b,0.0f),2) + pown(max(dx_f,0.0f),2)
+        + pown(min(dy_b,0.0f),2) + pown(max(dy_f,0.0f),2)
+        + pown(min(dz_b,0.0f),2) + pown(max(dz_f,0.0f),2);
+  }
+  float propagation_term = p * sqrt(ug2);
+
+  // advection field is the negative speed gradient; upwind per component
+  float ax = -(float)aw * (spd[IDX(xp,giy,giz)] - spd[IDX(xm,giy,giz)])*0.5f*scalex;
+  float ay = -(float)aw * (spd[IDX(gix,yp,giz)] - spd[IDX(gix,ym,giz)])*0.5f*scaley;
+  float az = -(float)aw * (spd[IDX(gix,giy,zp)] - spd[IDX(gix,giy,zm)])*0.5f*scalez;
+
+  float advection_term = ax * ( ax > 0 ? dx_b : dx_f )
+                       + ay * ( ay > 0 ? dy_b : dy_f )
+                       + az * ( az > 0 ? dz_b : dz_f );
+
+  buf[gidx] = curvature_term - propagation_term - advection_term;
+
+#undef IDX
+}
+#endif
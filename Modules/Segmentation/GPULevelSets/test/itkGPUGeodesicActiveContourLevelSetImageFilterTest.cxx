@@ -0,0 +1,177 @@
+/*=========================================================================
+*
+*  Copyright Insight Software Consortium
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*         http://www.apache.org/licenses/LICENSE-2.0.txt
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+*=========================================================================*/
+
+/**
+ * Test program for GPUGeodesicActiveContourLevelSetImageFilter class
+ *
+ * A circular initial contour is evolved toward a smaller circular edge of
+ * a synthetic edge potential image.  The test checks that the zero level
+ * set moves inward toward the edge and that the evolution stays finite.
+ */
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkTimeProbe.h"
+#include "itkMath.h"
+
+#include "itkOpenCLUtil.h"
+#include "itkGPUImage.h"
+#include "itkGPUKernelManager.h"
+#include "itkGPUContextManager.h"
+#include "itkGPUGeodesicActiveContourLevelSetImageFilter.h"
+
+namespace
+{
+template< typename TImage >
+double ZeroCrossingMeanRadius( const TImage *image, double cx, double cy )
+{
+  // estimate the contour radius as the mean distance of sign changes
+  // along the image rows through the center
+  double accum = 0.0;
+  unsigned int count = 0;
+
+  itk::ImageRegionConstIteratorWithIndex< TImage > it( image, image->GetBufferedRegion() );
+  for ( ; !it.IsAtEnd(); ++it )
+    {
+    typename TImage::IndexType idx = it.GetIndex();
+    typename TImage::IndexType next = idx;
+    next[0] += 1;
+
+    if ( !image->GetBufferedRegion().IsInside( next ) )
+      {
+      continue;
+      }
+    if ( ( it.Get() <= 0 ) != ( image->GetPixel( next ) <= 0 ) )
+      {
+      const double dx = static_cast< double >( idx[0] ) + 0.5 - cx;
+      const double dy = static_cast< double >( idx[1] ) - cy;
+      accum += std::sqrt( dx * dx + dy * dy );
+      ++count;
+      }
+    }
+
+  if ( count == 0 )
+    {
+    return 0.0;
+    }
+  return accum / static_cast< double >( count );
+}
+}
+
+int itkGPUGeodesicActiveContourLevelSetImageFilterTest( int, char* [] )
+{
+  if ( !itk::IsGPUAvailable() )
+    {
+    std::cerr << "OpenCL-enabled GPU is not present." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  constexpr unsigned int Dimension = 2;
+  using PixelType = float;
+  using ImageType = itk::GPUImage< PixelType, Dimension >;
+
+  constexpr double center = 32.0;
+  constexpr double initialRadius = 24.0;
+  constexpr double edgeRadius = 12.0;
+
+  ImageType::SizeType size;
+  size.Fill( 64 );
+
+  ImageType::RegionType region;
+  region.SetSize( size );
+
+  // initial level set: signed distance to a circle of radius 24
+  ImageType::Pointer levelSet = ImageType::New();
+  levelSet->SetRegions( region );
+  levelSet->Allocate();
+
+  // edge potential: close to zero on a circle of radius 12, one elsewhere
+  ImageType::Pointer speed = ImageType::New();
+  speed->SetRegions( region );
+  speed->Allocate();
+
+  itk::ImageRegionIteratorWithIndex< ImageType > it( levelSet, region );
+  for ( ; !it.IsAtEnd(); ++it )
+    {
+    const double x = static_cast< double >( it.GetIndex()[0] ) - center;
+    const double y = static_cast< double >( it.GetIndex()[1] ) - center;
+    const double r = std::sqrt( x * x + y * y );
+
+    it.Set( static_cast< PixelType >( r - initialRadius ) );
+
+    const double d = r - edgeRadius;
+    speed->SetPixel( it.GetIndex(),
+                     static_cast< PixelType >( 1.0 - std::exp( -0.5 * d * d ) ) );
+    }
+
+  const double initialEstimate = ZeroCrossingMeanRadius( levelSet.GetPointer(), center, center );
+
+  using FilterType = itk::GPUGeodesicActiveContourLevelSetImageFilter< ImageType, ImageType >;
+  FilterType::Pointer filter = FilterType::New();
+
+  filter->SetInput( levelSet );
+  filter->SetFeatureImage( speed );
+  filter->SetPropagationScaling( 1.0f );
+  filter->SetCurvatureScaling( 0.2f );
+  filter->SetAdvectionScaling( 1.0f );
+  filter->SetTimeStep( 0.2 );
+  filter->SetNumberOfIterations( 40 );
+  filter->SetMaximumRMSError( 0.0 );
+
+  itk::TimeProbe gputimer;
+  gputimer.Start();
+
+  try
+    {
+    filter->Update();
+    filter->GetOutput()->UpdateBuffers(); // synchronization point
+    }
+  catch ( itk::ExceptionObject & excp )
+    {
+    std::cerr << "Caught exception during filter->Update() " << excp << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  gputimer.Stop();
+  std::cout << "GPU geodesic active contour took " << gputimer.GetMean() << " seconds." << std::endl;
+
+  // the evolution must stay finite
+  itk::ImageRegionConstIteratorWithIndex< ImageType >
+    oIt( filter->GetOutput(), region );
+  for ( ; !oIt.IsAtEnd(); ++oIt )
+    {
+    if ( itk::Math::isnan( oIt.Get() ) || itk::Math::isinf( oIt.Get() ) )
+      {
+      std::cerr << "Non-finite value at " << oIt.GetIndex() << std::endl;
+      return EXIT_FAILURE;
+      }
+    }
+
+  // the contour must have moved inward, toward the edge
+  const double finalEstimate = ZeroCrossingMeanRadius( filter->GetOutput(), center, center );
+
+  std::cout << "Mean contour radius: " << initialEstimate
+            << " -> " << finalEstimate << std::endl;
+
+  if ( finalEstimate >= initialEstimate - 1.0 )
+    {
+    std::cerr << "The contour did not move toward the edge." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -49,6 +49,7 @@ KLMRegionGrowImageFilter< TInputImage, TOutputImage >
   os << indent << "KLM Region grow image filter object" << std::endl;
   os << indent << "Maximum value of lambda parameter: " << m_MaximumLambda << std::endl;
   os << indent << "Current internal value of lambda parameter: " << m_InternalLambda << std::endl;
+  os << indent << "Use lazy border queue: " << m_UseLazyBorderQueue << std::endl;
   os << indent << "Initial number of regions: " << m_InitialNumberOfRegions << std::endl;
   os << indent << "Current number of regions: " << m_NumberOfRegions << std::endl;
 } // end PrintSelf
@@ -560,12 +561,27 @@ KLMRegionGrowImageFilter< TInputImage, TOutputImage >
       }
     }
 
-  std::stable_sort( m_BordersDynamicPointer.begin(),
-                    ( m_BordersDynamicPointer.end() ),
-                    std::greater< KLMDynamicBorderArray< BorderType > >() );
+  if ( m_UseLazyBorderQueue )
+    {
+    // Seed the lazy-deletion queue; the sorted array is not
+    // maintained in this mode
+    m_BorderQueue = BorderQueueType();
+    for ( unsigned int k = 0; k < m_BordersPointer.size(); k++ )
+      {
+      this->PushBorderToQueue( m_BordersPointer[k] );
+      }
+    m_BorderCandidate = nullptr;
+    this->UpdateBorderQueueCandidate();
+    }
+  else
+    {
+    std::stable_sort( m_BordersDynamicPointer.begin(),
+                      ( m_BordersDynamicPointer.end() ),
+                      std::greater< KLMDynamicBorderArray< BorderType > >() );
 
-  m_BorderCandidate = &( m_BordersDynamicPointer[m_BordersDynamicPointer.size() - 1] );
-  m_InternalLambda = m_BorderCandidate->m_Pointer->GetLambda();
+    m_BorderCandidate = &( m_BordersDynamicPointer[m_BordersDynamicPointer.size() - 1] );
+    m_InternalLambda = m_BorderCandidate->m_Pointer->GetLambda();
+    }
 
   if ( m_InternalLambda < 0.0 )
     {
@@ -623,16 +639,19 @@ KLMRegionGrowImageFilter< TInputImage, TOutputImage >
   itkDebugMacro(<< "--------------------");
   itkDebugMacro(<< "   Merging Regions  ");
 
+  BorderType *pBorderCandidate = m_UseLazyBorderQueue ?
+    m_QueueBorderCandidate : m_BorderCandidate->m_Pointer;
+
   // Subtract border length before removing it
-  m_TotalBorderLength -= m_BorderCandidate->m_Pointer->GetBorderLength();
+  m_TotalBorderLength -= pBorderCandidate->GetBorderLength();
   if ( m_TotalBorderLength <= 0 ) { itkExceptionMacro(<< "KLM algorithm error"); }
 
   // Two regions are associated with the candidate border
   KLMSegmentationRegion *pRegion1;
   KLMSegmentationRegion *pRegion2;
 
-  pRegion1 = m_BorderCandidate->m_Pointer->GetRegion1();
-  pRegion2 = m_BorderCandidate->m_Pointer->GetRegion2();
+  pRegion1 = pBorderCandidate->GetRegion1();
+  pRegion2 = pBorderCandidate->GetRegion2();
 
   // For consistency, always assign smaller label: this affects
   // GenerateOutputImage and GenerateLabelledImage
@@ -645,8 +664,8 @@ KLMRegionGrowImageFilter< TInputImage, TOutputImage >
   pRegion1->CombineRegionParameters(pRegion2);
 
   // Remove the common region border from region 1 and region 2
-  pRegion1->DeleteRegionBorder(m_BorderCandidate->m_Pointer);
-  pRegion2->DeleteRegionBorder(m_BorderCandidate->m_Pointer);
+  pRegion1->DeleteRegionBorder(pBorderCandidate);
+  pRegion2->DeleteRegionBorder(pBorderCandidate);
 
   // Assign new equivalence label to the old region and update
   // the region borders, this is needed for ResolveRegions()
@@ -661,14 +680,28 @@ KLMRegionGrowImageFilter< TInputImage, TOutputImage >
   // Recompute the lambda's for all the borders of region1
   pRegion1->UpdateRegionBorderLambda();
 
-  // Remove the common region border from list of sorted borders.
-  // The BorderCandidate is always the last element.
-  // Set the iterator to very last value and then erase that location
-  m_BordersDynamicPointer.erase(m_BordersDynamicPointer.end() - 1);
+  // Remove the common region border from the border candidate structure
+  if ( m_UseLazyBorderQueue )
+    {
+    // The candidate sits on top of the queue; advancing its time
+    // stamp also invalidates any older entries it may still have
+    m_BorderQueue.pop();
+    pBorderCandidate->SetQueueTimeStamp(pBorderCandidate->GetQueueTimeStamp() + 1);
+    m_QueueBorderCandidate = nullptr;
+    }
+  else
+    {
+    // The BorderCandidate is always the last element of the sorted list.
+    // Set the iterator to very last value and then erase that location
+    m_BordersDynamicPointer.erase(m_BordersDynamicPointer.end() - 1);
+    }
 
   // Decrement for the one deleted border and a deleted region
   m_NumberOfRegions--;
-  if ( m_BordersDynamicPointer.empty() ) { itkExceptionMacro(<< "KLM algorithm error"); }
+  if ( !m_UseLazyBorderQueue && m_BordersDynamicPointer.empty() )
+    {
+    itkExceptionMacro(<< "KLM algorithm error");
+    }
 
   // For DEBUG purposes
   if ( this->GetDebug() )
@@ -679,36 +712,105 @@ KLMRegionGrowImageFilter< TInputImage, TOutputImage >
     pRegion2->PrintRegionInfo();
     }
 
-  // If any duplicate borders are found during SpliceRegionBorders,
-  // lambda is set to -1.0, and pRegion1 and pRegion2 are set nullptr
-  // so that after this sort, the duplicate border will be the last
-  // entry in m_BordersDynamicPointer
-
-  // Resort the border list based on the lambda values
-  std::stable_sort( m_BordersDynamicPointer.begin(),
-                    ( m_BordersDynamicPointer.end() ),
-                    std::greater< KLMDynamicBorderArray< BorderType > >() );
-
-  // Assign new BorderCandidate (it is always the last element).
-  // Set Pointer to BorderCandidate to the last element
-  m_BorderCandidate = &( m_BordersDynamicPointer[m_BordersDynamicPointer.size() - 1] );
-  m_InternalLambda = m_BorderCandidate->m_Pointer->GetLambda();
+  if ( m_UseLazyBorderQueue )
+    {
+    // Only the borders of the merged region changed lambda; re-insert
+    // just those and let the superseded entries be discarded when
+    // they surface. Any duplicate borders found during
+    // SpliceRegionBorders were purged from the region border list, so
+    // they are never re-inserted and their remaining queue entries
+    // die through the null region check.
+    auto regionBorderIt = pRegion1->GetRegionBorderItBegin();
+    auto regionBorderItEnd = pRegion1->GetRegionBorderItEnd();
+    while ( regionBorderIt != regionBorderItEnd )
+      {
+      this->PushBorderToQueue(*regionBorderIt);
+      ++regionBorderIt;
+      }
 
-  // Remove any duplicate borders found during SpliceRegionBorders:
-  // lambda = -1.0,  pRegion1 and pRegion2 = nullptr
-  while ( m_BorderCandidate->m_Pointer->GetRegion1() == nullptr
-          || m_BorderCandidate->m_Pointer->GetRegion2() == nullptr )
+    // Assign new BorderCandidate from the top of the queue
+    this->UpdateBorderQueueCandidate();
+    }
+  else
     {
-    m_BordersDynamicPointer.erase(m_BordersDynamicPointer.end() - 1);
+    // If any duplicate borders are found during SpliceRegionBorders,
+    // lambda is set to -1.0, and pRegion1 and pRegion2 are set nullptr
+    // so that after this sort, the duplicate border will be the last
+    // entry in m_BordersDynamicPointer
 
-    // Decrement for the one deleted border
-    if ( m_BordersDynamicPointer.empty() ) { itkExceptionMacro(<< "KLM algorithm error"); }
+    // Resort the border list based on the lambda values
+    std::stable_sort( m_BordersDynamicPointer.begin(),
+                      ( m_BordersDynamicPointer.end() ),
+                      std::greater< KLMDynamicBorderArray< BorderType > >() );
 
+    // Assign new BorderCandidate (it is always the last element).
+    // Set Pointer to BorderCandidate to the last element
     m_BorderCandidate = &( m_BordersDynamicPointer[m_BordersDynamicPointer.size() - 1] );
     m_InternalLambda = m_BorderCandidate->m_Pointer->GetLambda();
+
+    // Remove any duplicate borders found during SpliceRegionBorders:
+    // lambda = -1.0,  pRegion1 and pRegion2 = nullptr
+    while ( m_BorderCandidate->m_Pointer->GetRegion1() == nullptr
+            || m_BorderCandidate->m_Pointer->GetRegion2() == nullptr )
+      {
+      m_BordersDynamicPointer.erase(m_BordersDynamicPointer.end() - 1);
+
+      // Decrement for the one deleted border
+      if ( m_BordersDynamicPointer.empty() ) { itkExceptionMacro(<< "KLM algorithm error"); }
+
+      m_BorderCandidate = &( m_BordersDynamicPointer[m_BordersDynamicPointer.size() - 1] );
+      m_InternalLambda = m_BorderCandidate->m_Pointer->GetLambda();
+      }
     }
 } // end MergeRegions
 
+template< typename TInputImage, typename TOutputImage >
+void
+KLMRegionGrowImageFilter< TInputImage, TOutputImage >
+::PushBorderToQueue(BorderType *border)
+{
+  // A new time stamp supersedes every entry pushed earlier for this
+  // border
+  border->SetQueueTimeStamp(border->GetQueueTimeStamp() + 1);
+
+  BorderQueueEntry entry;
+  entry.m_Border = border;
+  entry.m_Lambda = border->GetLambda();
+  entry.m_MaximumRegionBorderSize = std::max(
+    static_cast< double >( border->GetRegion1()->GetRegionBorderSize() ),
+    static_cast< double >( border->GetRegion2()->GetRegionBorderSize() ) );
+  entry.m_TimeStamp = border->GetQueueTimeStamp();
+
+  m_BorderQueue.push(entry);
+} // end PushBorderToQueue
+
+template< typename TInputImage, typename TOutputImage >
+void
+KLMRegionGrowImageFilter< TInputImage, TOutputImage >
+::UpdateBorderQueueCandidate()
+{
+  while ( !m_BorderQueue.empty() )
+    {
+    const BorderQueueEntry & entry = m_BorderQueue.top();
+
+    // Discard entries of deleted borders and entries superseded by a
+    // lambda recomputation
+    if ( entry.m_Border->GetRegion1() == nullptr
+         || entry.m_Border->GetRegion2() == nullptr
+         || entry.m_TimeStamp != entry.m_Border->GetQueueTimeStamp() )
+      {
+      m_BorderQueue.pop();
+      continue;
+      }
+
+    m_QueueBorderCandidate = entry.m_Border;
+    m_InternalLambda = entry.m_Lambda;
+    return;
+    }
+
+  itkExceptionMacro(<< "KLM algorithm error");
+} // end UpdateBorderQueueCandidate
+
 template< typename TInputImage, typename TOutputImage >
 void
 KLMRegionGrowImageFilter< TInputImage, TOutputImage >
@@ -173,6 +173,13 @@ public:
   /** Evaluate the Lambda for a given border. */
   void EvaluateLambda();
 
+  /** Set/Get the time stamp of the most recent insertion of this
+   * border into the lazy-deletion border queue of
+   * KLMRegionGrowImageFilter. A queue entry carrying an older time
+   * stamp than its border is stale and is discarded when popped. */
+  itkSetMacro(QueueTimeStamp, unsigned int);
+  itkGetConstReferenceMacro(QueueTimeStamp, unsigned int);
+
   /** Print the data associated with each border. */
   void PrintBorderInfo();
 
@@ -188,6 +195,7 @@ protected:
 
 private:
   double                 m_Lambda;
+  unsigned int           m_QueueTimeStamp;
   KLMSegmentationRegion *m_Region1;
   KLMSegmentationRegion *m_Region2;
 };
@@ -23,6 +23,7 @@ KLMSegmentationBorder
 ::KLMSegmentationBorder()
 {
   m_Lambda = 0.0;
+  m_QueueTimeStamp = 0;
   m_Region1 = nullptr;
   m_Region2 = nullptr;
 }
@@ -39,6 +40,7 @@ KLMSegmentationBorder
 {
   Superclass::PrintSelf(os, indent);
   os << indent << "Lambda  = " << m_Lambda << std::endl;
+  os << indent << "QueueTimeStamp = " << m_QueueTimeStamp << std::endl;
   os << indent << "Region1 = " << m_Region1 << std::endl;
   os << indent << "Region2 = " << m_Region2 << std::endl;
 } // end PrintSelf
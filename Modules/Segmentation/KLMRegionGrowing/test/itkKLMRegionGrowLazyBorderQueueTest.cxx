@@ -0,0 +1,99 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkKLMRegionGrowImageFilter.h"
+#include "itkImageRegionIterator.h"
+#include "itkMath.h"
+
+int itkKLMRegionGrowLazyBorderQueueTest(int, char* [] )
+{
+  constexpr unsigned int ImageDimension = 2;
+  constexpr unsigned int NumberOfBands = 1;
+
+  using ImagePixelType = itk::Vector< double, NumberOfBands >;
+  using ImageType = itk::Image< ImagePixelType, ImageDimension >;
+
+  using KLMFilterType = itk::KLMRegionGrowImageFilter< ImageType, ImageType >;
+
+  // Build an image of 8 x 8 atomic blocks whose intensities all
+  // differ, so the border lambdas are distinct and the lazy queue must
+  // reproduce the merge sequence of the sorted border array.
+  ImageType::SizeType size;
+  size.Fill( 16 );
+
+  ImageType::RegionType region;
+  region.SetSize( size );
+
+  ImageType::Pointer image = ImageType::New();
+  image->SetRegions( region );
+  image->Allocate();
+
+  itk::ImageRegionIterator< ImageType > it( image, region );
+  while ( !it.IsAtEnd() )
+    {
+    const ImageType::IndexType index = it.GetIndex();
+
+    ImagePixelType pixel;
+    pixel[0] = static_cast< double >( ( index[0] / 2 ) * ( index[0] / 2 )
+                                      + 13 * ( index[1] / 2 ) );
+    it.Set( pixel );
+    ++it;
+    }
+
+  KLMFilterType::GridSizeType gridSize;
+  gridSize.Fill( 2 );
+
+  auto runKLM = [&] ( bool useLazyBorderQueue ) -> ImageType::Pointer
+    {
+    KLMFilterType::Pointer filter = KLMFilterType::New();
+    filter->SetInput( image );
+    filter->SetGridSize( gridSize );
+    filter->SetMaximumNumberOfRegions( 5 );
+    filter->SetMaximumLambda( 1e45 );
+    if ( useLazyBorderQueue )
+      {
+      filter->UseLazyBorderQueueOn();
+      }
+    filter->Update();
+
+    ImageType::Pointer output = filter->GetOutput();
+    output->DisconnectPipeline();
+    return output;
+    };
+
+  ImageType::Pointer sortedOutput = runKLM( false );
+  ImageType::Pointer lazyOutput = runKLM( true );
+
+  itk::ImageRegionIterator< ImageType > sortedIt( sortedOutput, region );
+  itk::ImageRegionIterator< ImageType > lazyIt( lazyOutput, region );
+  while ( !sortedIt.IsAtEnd() )
+    {
+    if ( itk::Math::NotAlmostEquals( sortedIt.Value()[0], lazyIt.Value()[0] ) )
+      {
+      std::cerr << "Approximation mismatch at " << sortedIt.GetIndex()
+                << ": " << sortedIt.Value()[0] << " != " << lazyIt.Value()[0]
+                << std::endl;
+      return EXIT_FAILURE;
+      }
+    ++sortedIt;
+    ++lazyIt;
+    }
+
+  std::cout << "Test passed." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -21,6 +21,7 @@
 #include "itkLabelVotingImageFilter.h"
 
 #include "itkImageRegionIterator.h"
+#include "itkImageScanlineIterator.h"
 #include "itkProgressReporter.h"
 
 #include "itkMath.h"
@@ -91,14 +92,16 @@ void
 LabelVotingImageFilter< TInputImage, TOutputImage >
 ::DynamicThreadedGenerateData( const OutputImageRegionType & outputRegionForThread )
 {
-  using IteratorType = ImageRegionConstIterator< TInputImage >;
-  using OutIteratorType = ImageRegionIterator< TOutputImage >;
+  using IteratorType = ImageScanlineConstIterator< TInputImage >;
+  using OutIteratorType = ImageScanlineIterator< TOutputImage >;
 
   typename TOutputImage::Pointer output = this->GetOutput();
 
   // Record the number of indexed inputs
   const size_t numberOfInputIndexes = this->GetNumberOfIndexedInputs();
 
+  const SizeValueType lineLength = outputRegionForThread.GetSize(0);
+
   // Create and initialize all input image iterators
   auto * it = new IteratorType[numberOfInputIndexes];
   for ( size_t i = 0; i < numberOfInputIndexes; ++i )
@@ -107,46 +110,91 @@ LabelVotingImageFilter< TInputImage, TOutputImage >
                          outputRegionForThread);
     }
 
+  auto * lineBuffer = new const InputPixelType *[numberOfInputIndexes];
+  auto * agreement = new unsigned char[lineLength];
   auto * votesByLabel = new unsigned int[this->m_TotalLabelCount];
 
   OutIteratorType out = OutIteratorType(output, outputRegionForThread);
-  for ( out.GoToBegin(); !out.IsAtEnd(); ++out )
+  while ( !out.IsAtEnd() )
     {
-    // Reset number of votes per label for all labels
-    std::fill_n( votesByLabel, this->m_TotalLabelCount, 0 );
+    // Scanlines are contiguous in memory, so the whole line of every
+    // input can be processed through raw pointers.
+    OutputPixelType *outLine = &out.Value();
+    for ( size_t i = 0; i < numberOfInputIndexes; ++i )
+      {
+      lineBuffer[i] = &it[i].Value();
+      }
 
-    // count number of votes for the labels
-    for ( unsigned int i = 0; i < numberOfInputIndexes; ++i )
+    // Mark the positions where all inputs agree with a plain equality
+    // scan per input, which the compiler can vectorize. Unanimity is
+    // by far the most common case in practice, and the full tally
+    // below is only run where the mask is cleared.
+    std::fill_n(agreement, lineLength, 1);
+    for ( size_t i = 1; i < numberOfInputIndexes; ++i )
       {
-      const InputPixelType label = it[i].Get();
-      if ( NumericTraits<InputPixelType>::IsNonnegative( label ) )
+      const InputPixelType *reference = lineBuffer[0];
+      const InputPixelType *candidate = lineBuffer[i];
+      for ( SizeValueType x = 0; x < lineLength; ++x )
         {
-        ++votesByLabel[label];
+        agreement[x] = static_cast< unsigned char >( agreement[x] & ( candidate[x] == reference[x] ) );
         }
-      ++( it[i] );
       }
 
-    // Determine the label with the most votes for this pixel
-    out.Set(0);
-    unsigned int maxVotes = votesByLabel[0];
-    for ( size_t l = 1; l < this->m_TotalLabelCount; ++l )
+    for ( SizeValueType x = 0; x < lineLength; ++x )
       {
-      if ( votesByLabel[l] > maxVotes )
+      if ( agreement[x] )
+        {
+        // unanimous vote - the shared label wins outright
+        outLine[x] = static_cast< OutputPixelType >( lineBuffer[0][x] );
+        continue;
+        }
+
+      // Reset number of votes per label for all labels
+      std::fill_n( votesByLabel, this->m_TotalLabelCount, 0 );
+
+      // count number of votes for the labels
+      for ( size_t i = 0; i < numberOfInputIndexes; ++i )
         {
-        maxVotes = votesByLabel[l];
-        out.Set(static_cast<OutputPixelType>(l));
+        const InputPixelType label = lineBuffer[i][x];
+        if ( NumericTraits<InputPixelType>::IsNonnegative( label ) )
+          {
+          ++votesByLabel[label];
+          }
         }
-      else
+
+      // Determine the label with the most votes for this pixel
+      OutputPixelType winner = 0;
+      unsigned int maxVotes = votesByLabel[0];
+      for ( size_t l = 1; l < this->m_TotalLabelCount; ++l )
         {
-        if ( votesByLabel[l] == maxVotes )
+        if ( votesByLabel[l] > maxVotes )
+          {
+          maxVotes = votesByLabel[l];
+          winner = static_cast<OutputPixelType>(l);
+          }
+        else
           {
-          out.Set(this->m_LabelForUndecidedPixels);
+          if ( votesByLabel[l] == maxVotes )
+            {
+            winner = this->m_LabelForUndecidedPixels;
+            }
           }
         }
+      outLine[x] = winner;
+      }
+
+    for ( size_t i = 0; i < numberOfInputIndexes; ++i )
+      {
+      it[i].GoToEndOfLine();
+      it[i].NextLine();
       }
+    out.GoToEndOfLine();
+    out.NextLine();
     }
 
   delete[] it;
+  delete[] lineBuffer;
+  delete[] agreement;
   delete[] votesByLabel;
 }
 
@@ -26,6 +26,8 @@
 #include "itkLabelMap.h"
 #include "itkLexicographicCompare.h"
 
+#include <vector>
+
 namespace itk
 {
 
@@ -96,6 +98,41 @@ public:
   /** Set a layer map with id to the given layer pointer */
   void SetLayer( LayerIdType value, const LayerType& layer );
 
+  /** Compact storage of one sparse-field layer. The node indices stay
+   *  in lexicographic order with every component delta-encoded against
+   *  the previous node, and the node values are pooled in one
+   *  contiguous array, so none of the per-node overhead of the
+   *  std::map layers remains. */
+  struct CompressedLayerType
+  {
+    std::vector< int32_t >    IndexDeltas;
+    std::vector< OutputType > Values;
+  };
+
+  using CompressedLayerMapType = std::map< LayerIdType, CompressedLayerType >;
+
+  /** Pack every layer into its compressed form and release the
+   *  std::map representation. Dormant level sets (e.g. most of the
+   *  contours in a large multi-object evolution) can be parked this
+   *  way; the layers cannot be accessed or evolved again until
+   *  DecompressLayers() is called. The label map is run-length encoded
+   *  already and is left as is. */
+  void CompressLayers();
+
+  /** Rebuild the std::map layers from the compressed representation. */
+  void DecompressLayers();
+
+  /** Returns true while the layers are held in compressed form. */
+  itkGetConstMacro( LayersCompressed, bool );
+
+  /** Move a batch of nodes from one layer to another in a single
+   *  sweep, assigning them the given values. The nodes are inserted
+   *  with a hint, so a sorted batch costs amortized constant time per
+   *  node instead of logarithmic. The status stored in the label map
+   *  is not touched; as in the update filters, maintaining it is the
+   *  caller's responsibility. */
+  void MoveLayerNodes( LayerIdType fromLayer, LayerIdType toLayer, const LayerType& nodes );
+
   /** Set/Get the label map for computing the sparse representation */
   virtual void SetLabelMap( LabelMapType* labelMap );
   itkGetModifiableObjectMacro(LabelMap, LabelMapType );
@@ -115,6 +152,9 @@ protected:
   LabelMapPointer   m_LabelMap;
   LayerIdListType   m_InternalLabelList;
 
+  CompressedLayerMapType m_CompressedLayers;
+  bool                   m_LayersCompressed{false};
+
   /** Initialize the sparse field layers */
   virtual void InitializeLayers() = 0;
 
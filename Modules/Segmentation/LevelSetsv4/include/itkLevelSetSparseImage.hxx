@@ -99,6 +99,8 @@ LevelSetSparseImage< TOutput, VDimension >
     m_Layers.clear();
     LayerMapType newLayers( levelSet->m_Layers );
     std::swap( m_Layers, newLayers );
+    m_CompressedLayers = levelSet->m_CompressedLayers;
+    m_LayersCompressed = levelSet->m_LayersCompressed;
     }
 }
 
@@ -107,6 +109,10 @@ template< typename TOutput, unsigned int VDimension >
 const typename LevelSetSparseImage< TOutput, VDimension >::LayerType&
 LevelSetSparseImage< TOutput, VDimension >::GetLayer( LayerIdType value ) const
 {
+  if( m_LayersCompressed )
+    {
+    itkGenericExceptionMacro( <<"The layers are compressed; call DecompressLayers() first" );
+    }
   auto it = m_Layers.find( value );
   if( it == m_Layers.end() )
     {
@@ -120,6 +126,10 @@ template< typename TOutput, unsigned int VDimension >
 typename LevelSetSparseImage< TOutput, VDimension >::LayerType&
 LevelSetSparseImage< TOutput, VDimension >::GetLayer( LayerIdType value )
 {
+  if( m_LayersCompressed )
+    {
+    itkGenericExceptionMacro( <<"The layers are compressed; call DecompressLayers() first" );
+    }
   auto it = m_Layers.find( value );
   if( it == m_Layers.end() )
     {
@@ -134,6 +144,10 @@ void
 LevelSetSparseImage< TOutput, VDimension >
 ::SetLayer( LayerIdType value, const LayerType& layer )
 {
+  if( m_LayersCompressed )
+    {
+    itkGenericExceptionMacro( <<"The layers are compressed; call DecompressLayers() first" );
+    }
   const LayerMapIterator it = m_Layers.find( value );
   if( it != m_Layers.end() )
     {
@@ -146,6 +160,104 @@ LevelSetSparseImage< TOutput, VDimension >
 }
 
 
+template< typename TOutput, unsigned int VDimension >
+void
+LevelSetSparseImage< TOutput, VDimension >
+::CompressLayers()
+{
+  if( this->m_LayersCompressed )
+    {
+    return;
+    }
+
+  this->m_CompressedLayers.clear();
+
+  for( auto layerIt = m_Layers.begin(); layerIt != m_Layers.end(); ++layerIt )
+    {
+    CompressedLayerType& compressed = this->m_CompressedLayers[ layerIt->first ];
+    compressed.IndexDeltas.reserve( layerIt->second.size() * Dimension );
+    compressed.Values.reserve( layerIt->second.size() );
+
+    InputType previousIndex;
+    previousIndex.Fill( 0 );
+
+    for( auto nodeIt = layerIt->second.begin(); nodeIt != layerIt->second.end(); ++nodeIt )
+      {
+      const InputType& nodeIndex = nodeIt->first;
+      for( unsigned int dim = 0; dim < Dimension; ++dim )
+        {
+        compressed.IndexDeltas.push_back(
+          static_cast< int32_t >( nodeIndex[dim] - previousIndex[dim] ) );
+        }
+      compressed.Values.push_back( nodeIt->second );
+      previousIndex = nodeIndex;
+      }
+
+    // release the node based storage
+    LayerType emptyLayer;
+    std::swap( layerIt->second, emptyLayer );
+    }
+
+  this->m_LayersCompressed = true;
+}
+
+
+template< typename TOutput, unsigned int VDimension >
+void
+LevelSetSparseImage< TOutput, VDimension >
+::DecompressLayers()
+{
+  if( !this->m_LayersCompressed )
+    {
+    return;
+    }
+
+  for( auto compressedIt = m_CompressedLayers.begin();
+       compressedIt != m_CompressedLayers.end(); ++compressedIt )
+    {
+    LayerType& layer = this->m_Layers[ compressedIt->first ];
+
+    InputType nodeIndex;
+    nodeIndex.Fill( 0 );
+
+    SizeValueType deltaPosition = 0;
+    const SizeValueType numberOfNodes = compressedIt->second.Values.size();
+    for( SizeValueType n = 0; n < numberOfNodes; ++n )
+      {
+      for( unsigned int dim = 0; dim < Dimension; ++dim )
+        {
+        nodeIndex[dim] += compressedIt->second.IndexDeltas[ deltaPosition++ ];
+        }
+      // the nodes were packed in lexicographic order, so appending is
+      // always the right position
+      layer.insert( layer.end(),
+        typename LayerType::value_type( nodeIndex, compressedIt->second.Values[n] ) );
+      }
+    }
+
+  this->m_CompressedLayers.clear();
+  this->m_LayersCompressed = false;
+}
+
+
+template< typename TOutput, unsigned int VDimension >
+void
+LevelSetSparseImage< TOutput, VDimension >
+::MoveLayerNodes( LayerIdType fromLayer, LayerIdType toLayer, const LayerType& nodes )
+{
+  LayerType& source = this->GetLayer( fromLayer );
+  LayerType& destination = this->GetLayer( toLayer );
+
+  auto hint = destination.begin();
+  for( auto nodeIt = nodes.begin(); nodeIt != nodes.end(); ++nodeIt )
+    {
+    source.erase( nodeIt->first );
+    hint = destination.insert( hint,
+      typename LayerType::value_type( nodeIt->first, nodeIt->second ) );
+    }
+}
+
+
 template< typename TOutput, unsigned int VDimension >
 void
 LevelSetSparseImage< TOutput, VDimension >
@@ -154,6 +266,8 @@ LevelSetSparseImage< TOutput, VDimension >
   Superclass::Initialize();
 
   this->m_LabelMap = nullptr;
+  this->m_CompressedLayers.clear();
+  this->m_LayersCompressed = false;
   this->InitializeLayers();
   this->InitializeInternalLabelList();
 }
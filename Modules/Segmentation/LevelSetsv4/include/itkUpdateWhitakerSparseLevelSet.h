@@ -28,6 +28,8 @@
 #include "itkLabelMapToLabelImageFilter.h"
 #include "itkLabelImageToLabelMapFilter.h"
 
+#include <vector>
+
 namespace itk
 {
 /**
@@ -159,6 +161,48 @@ protected:
   /** Move identified points into +2 level set layer */
   void MovePointFromPlus2();
 
+  /** Outcome of the classification of one node of a side layer
+   *  (layers -2, -1, +1 and +2). */
+  enum NodeActionType : uint8_t
+    {
+    /** The node keeps its value and stays in its layer. */
+    KeepNode = 0,
+    /** The node gets a new value but stays in its layer. */
+    UpdateNode,
+    /** The node gets a new value and moves one layer closer to the
+     *  zero level set. */
+    PromoteNode,
+    /** The node gets a new value and moves one layer away from the
+     *  zero level set. */
+    DemoteNode,
+    /** The node has no active neighbor in the next layer toward the
+     *  zero level set and moves away with its value unchanged. */
+    DemoteNodeUnchanged
+    };
+
+  /** Contiguous structure-of-arrays copy of one layer. The index and
+   *  value arrays are filled sequentially from the layer map so their
+   *  order matches the map iteration order; the action and new value
+   *  arrays are filled by ClassifySideLayer. */
+  struct LayerSnapshotType
+    {
+    std::vector< LevelSetInputType >  Indices;
+    std::vector< LevelSetOutputType > Values;
+    std::vector< NodeActionType >     Actions;
+    std::vector< LevelSetOutputType > NewValues;
+    };
+
+  /** Copy the nodes of the given layer into the snapshot arrays. */
+  void FillLayerSnapshot( const LevelSetLayerType& layer, LayerSnapshotType& snapshot ) const;
+
+  /** Classify every node of the given side layer in parallel. The
+   *  classification only reads the internal label image and the values
+   *  of nodes outside the layer being classified, so the chunks are
+   *  independent and the outcome is identical to a sequential sweep.
+   *  The decisions are committed afterwards by the sequential part of
+   *  the corresponding UpdateLayer method. */
+  void ClassifySideLayer( LevelSetLayerIdType status, LayerSnapshotType& snapshot );
+
 private:
   LevelSetOutputType m_TimeStep;
   LevelSetOutputType m_RMSChangeAccumulator;
@@ -21,6 +21,7 @@
 
 #include "itkUpdateWhitakerSparseLevelSet.h"
 #include "itkConnectedImageNeighborhoodShape.h"
+#include "itkMultiThreaderBase.h"
 
 namespace itk
 {
@@ -375,113 +376,212 @@ template< unsigned int VDimension,
           typename TLevelSetValueType,
           typename TEquationContainer >
 void UpdateWhitakerSparseLevelSet< VDimension, TLevelSetValueType, TEquationContainer >
-::UpdateLayerMinus1()
+::FillLayerSnapshot( const LevelSetLayerType& layer, LayerSnapshotType& snapshot ) const
 {
-  TermContainerPointer termContainer = this->m_EquationContainer->GetEquation( this->m_CurrentLevelSetId );
+  const auto numberOfNodes = static_cast< SizeValueType >( layer.size() );
 
-  ZeroFluxNeumannBoundaryCondition< LabelImageType > spNBC;
+  snapshot.Indices.clear();
+  snapshot.Values.clear();
+  snapshot.Indices.reserve( numberOfNodes );
+  snapshot.Values.reserve( numberOfNodes );
 
-  typename NeighborhoodIteratorType::RadiusType radius;
-  radius.Fill( 1 );
+  auto nodeIt = layer.begin();
+  while( nodeIt != layer.end() )
+    {
+    snapshot.Indices.push_back( nodeIt->first );
+    snapshot.Values.push_back( nodeIt->second );
+    ++nodeIt;
+    }
 
-  NeighborhoodIteratorType neighIt( radius,
-                                    this->m_InternalImage,
-                                    this->m_InternalImage->GetLargestPossibleRegion() );
+  snapshot.Actions.assign( numberOfNodes, KeepNode );
+  snapshot.NewValues.assign( numberOfNodes,
+                             NumericTraits< LevelSetOutputType >::ZeroValue() );
+}
 
-  neighIt.OverrideBoundaryCondition( &spNBC );
-  neighIt.ActivateOffsets(
-    Experimental::GenerateConnectedImageNeighborhoodShapeOffsets<ImageDimension, 1, false>());
+template< unsigned int VDimension,
+          typename TLevelSetValueType,
+          typename TEquationContainer >
+void UpdateWhitakerSparseLevelSet< VDimension, TLevelSetValueType, TEquationContainer >
+::ClassifySideLayer( const LevelSetLayerIdType status, LayerSnapshotType& snapshot )
+{
+  const auto numberOfNodes = static_cast< SizeValueType >( snapshot.Indices.size() );
 
-  LevelSetLayerType& outputlayerMinus1 = this->m_OutputLevelSet->GetLayer( LevelSetType::MinusOneLayer() );
+  if( numberOfNodes == 0 )
+    {
+    return;
+    }
 
-  LevelSetLayerType& layerMinusTwo = this->m_TempLevelSet->GetLayer( LevelSetType::MinusTwoLayer() );
-  LevelSetLayerType& layerZero = this->m_TempLevelSet->GetLayer( LevelSetType::ZeroLayer() );
+  const bool positiveSide = ( status > LevelSetType::ZeroLayer() );
 
-  auto nodeIt   = outputlayerMinus1.begin();
-  auto nodeEnd  = outputlayerMinus1.end();
+  // label of the adjacent layer toward the zero level set
+  const auto towardZeroLabel =
+      static_cast< LevelSetLayerIdType >( positiveSide ? status - 1 : status + 1 );
 
-  LevelSetInputType inputIndex;
+  const auto statusValue = static_cast< LevelSetOutputType >( status );
+  const LevelSetOutputType promoteBound = positiveSide ? statusValue - 0.5 : statusValue + 0.5;
+  const LevelSetOutputType demoteBound  = positiveSide ? statusValue + 0.5 : statusValue - 0.5;
 
-  while( nodeIt != nodeEnd )
-    {
-    LevelSetInputType currentIndex = nodeIt->first;
-    inputIndex = currentIndex + this->m_Offset;
+  MultiThreaderBase::Pointer threader = MultiThreaderBase::New();
 
-    neighIt.SetLocation( currentIndex );
+  const SizeValueType numberOfChunks =
+      std::min( static_cast< SizeValueType >( threader->GetNumberOfWorkUnits() ), numberOfNodes );
+  const SizeValueType chunkSize = ( numberOfNodes + numberOfChunks - 1 ) / numberOfChunks;
 
-    bool thereIsAPointWithLabelEqualTo0 = false;
+  // Every chunk only reads the internal label image and the values of
+  // nodes outside this layer, and only writes the snapshot entries of
+  // its own range, so no synchronization is needed.
+  threader->ParallelizeArray( 0, numberOfChunks,
+    [this, &snapshot, positiveSide, towardZeroLabel, promoteBound, demoteBound,
+     chunkSize, numberOfNodes]( SizeValueType chunk )
+      {
+      ZeroFluxNeumannBoundaryCondition< LabelImageType > spNBC;
 
-    LevelSetOutputType max = NumericTraits< LevelSetOutputType >::NonpositiveMin();
+      typename NeighborhoodIteratorType::RadiusType radius;
+      radius.Fill( 1 );
 
-    // compute M and check if point with label 0 exists in the neighborhood
-    for( typename NeighborhoodIteratorType::Iterator it = neighIt.Begin();
-         !it.IsAtEnd();
-         ++it )
-      {
-      LevelSetInputType tempIndex = neighIt.GetIndex( it.GetNeighborhoodOffset() );
+      NeighborhoodIteratorType neighIt( radius, this->m_InternalImage,
+                                        this->m_InternalImage->GetLargestPossibleRegion() );
+
+      neighIt.OverrideBoundaryCondition( &spNBC );
+      neighIt.ActivateOffsets(
+        Experimental::GenerateConnectedImageNeighborhoodShapeOffsets<ImageDimension, 1, false>());
 
-      LevelSetLayerIdType label = it.Get();
+      const SizeValueType firstNode = chunk * chunkSize;
+      const SizeValueType lastNode = std::min( firstNode + chunkSize, numberOfNodes );
 
-      if( label >= LevelSetType::ZeroLayer() )
+      for( SizeValueType i = firstNode; i < lastNode; ++i )
         {
-        if( label == LevelSetType::ZeroLayer() )
+        neighIt.SetLocation( snapshot.Indices[i] );
+
+        bool thereIsAPointInTheNextLayer = false;
+
+        LevelSetOutputType extremum = positiveSide ?
+              NumericTraits< LevelSetOutputType >::max() :
+              NumericTraits< LevelSetOutputType >::NonpositiveMin();
+
+        for( typename NeighborhoodIteratorType::Iterator it = neighIt.Begin();
+             !it.IsAtEnd();
+             ++it )
+          {
+          const LevelSetLayerIdType label = it.Get();
+
+          if( positiveSide ? ( label <= towardZeroLabel ) : ( label >= towardZeroLabel ) )
+            {
+            if( label == towardZeroLabel )
+              {
+              thereIsAPointInTheNextLayer = true;
+              }
+            const LevelSetInputType neighborIndex = neighIt.GetIndex( it.GetNeighborhoodOffset() );
+
+            auto phiIt = this->m_TempPhi.find( neighborIndex );
+            if( phiIt != this->m_TempPhi.end() )
+              {
+              extremum = positiveSide ? std::min( extremum, phiIt->second ) :
+                                        std::max( extremum, phiIt->second );
+              }
+            else
+              {
+              itkAssertInDebugAndIgnoreInReleaseMacro( positiveSide );
+              }
+            }
+          } // end for
+
+        if( !thereIsAPointInTheNextLayer )
           {
-          thereIsAPointWithLabelEqualTo0 = true;
+          snapshot.Actions[i] = DemoteNodeUnchanged;
+          snapshot.NewValues[i] = snapshot.Values[i];
+          continue;
           }
 
-        auto phiIt = this->m_TempPhi.find( tempIndex );
-        itkAssertInDebugAndIgnoreInReleaseMacro( phiIt != this->m_TempPhi.end() );
+        const LevelSetOutputType newValue = positiveSide ? extremum + 1. : extremum - 1.;
+        snapshot.NewValues[i] = newValue;
 
-        max = std::max( max, phiIt->second );
+        if( positiveSide ? ( newValue <= promoteBound ) : ( newValue >= promoteBound ) )
+          {
+          snapshot.Actions[i] = PromoteNode;
+          }
+        else if( positiveSide ? ( newValue > demoteBound ) : ( newValue < demoteBound ) )
+          {
+          snapshot.Actions[i] = DemoteNode;
+          }
+        else
+          {
+          snapshot.Actions[i] = UpdateNode;
+          }
         }
-      } // end for
+      }, nullptr );
+}
 
-    if( thereIsAPointWithLabelEqualTo0 )
-      {
-      auto phiIt = this->m_TempPhi.find( currentIndex );
+template< unsigned int VDimension,
+          typename TLevelSetValueType,
+          typename TEquationContainer >
+void UpdateWhitakerSparseLevelSet< VDimension, TLevelSetValueType, TEquationContainer >
+::UpdateLayerMinus1()
+{
+  TermContainerPointer termContainer = this->m_EquationContainer->GetEquation( this->m_CurrentLevelSetId );
 
-      max = max - 1.;
+  LevelSetLayerType& outputlayerMinus1 = this->m_OutputLevelSet->GetLayer( LevelSetType::MinusOneLayer() );
 
-      if( phiIt != this->m_TempPhi.end() )
-        {// change value
-        termContainer->UpdatePixel( inputIndex, phiIt->second, max );
-        phiIt->second = max;
-        nodeIt->second = max;
-        }
-      else
-        { // Kishore: Can this happen?
-        this->m_TempPhi.insert( NodePairType( currentIndex, max ) );
-        }
+  LevelSetLayerType& layerMinusTwo = this->m_TempLevelSet->GetLayer( LevelSetType::MinusTwoLayer() );
+  LevelSetLayerType& layerZero = this->m_TempLevelSet->GetLayer( LevelSetType::ZeroLayer() );
 
-      if( max >= -0.5 )
-        { // change layers only
-        auto tempIt = nodeIt;
-        ++nodeIt;
-        outputlayerMinus1.erase( tempIt );
+  LayerSnapshotType snapshot;
+  this->FillLayerSnapshot( outputlayerMinus1, snapshot );
+  this->ClassifySideLayer( LevelSetType::MinusOneLayer(), snapshot );
 
-        layerZero.insert( NodePairType( currentIndex, max ) );
-        }
-      else if( max < -1.5 )
-        { // change layers only
-        auto tempIt = nodeIt;
-        ++nodeIt;
-        outputlayerMinus1.erase( tempIt );
+  // commit the decisions sequentially, in layer order
+  auto nodeIt = outputlayerMinus1.begin();
 
-        layerMinusTwo.insert( NodePairType( currentIndex, max ) );
-        }
-      else
-        {
-        ++nodeIt;
-        }
+  for( SizeValueType i = 0; i < snapshot.Indices.size(); ++i )
+    {
+    const LevelSetInputType currentIndex = snapshot.Indices[i];
+    const LevelSetInputType inputIndex = currentIndex + this->m_Offset;
+    const LevelSetOutputType newValue = snapshot.NewValues[i];
+
+    itkAssertInDebugAndIgnoreInReleaseMacro( nodeIt->first == currentIndex );
+
+    if( snapshot.Actions[i] == DemoteNodeUnchanged )
+      { // no point with label 0 in the neighborhood: change layers only
+      auto tempIt = nodeIt;
+      ++nodeIt;
+      outputlayerMinus1.erase( tempIt );
+
+      layerMinusTwo.insert( NodePairType( currentIndex, newValue ) );
+      continue;
+      }
+
+    auto phiIt = this->m_TempPhi.find( currentIndex );
+
+    if( phiIt != this->m_TempPhi.end() )
+      {// change value
+      termContainer->UpdatePixel( inputIndex, phiIt->second, newValue );
+      phiIt->second = newValue;
+      nodeIt->second = newValue;
+      }
+    else
+      { // Kishore: Can this happen?
+      this->m_TempPhi.insert( NodePairType( currentIndex, newValue ) );
       }
-    else // !thereIsAPointWithLabelEqualTo0
+
+    if( snapshot.Actions[i] == PromoteNode )
+      { // change layers only
+      auto tempIt = nodeIt;
+      ++nodeIt;
+      outputlayerMinus1.erase( tempIt );
+
+      layerZero.insert( NodePairType( currentIndex, newValue ) );
+      }
+    else if( snapshot.Actions[i] == DemoteNode )
       { // change layers only
       auto tempIt = nodeIt;
-      LevelSetOutputType t = tempIt->second;
       ++nodeIt;
       outputlayerMinus1.erase( tempIt );
 
-      layerMinusTwo.insert( NodePairType( currentIndex, t ) );
+      layerMinusTwo.insert( NodePairType( currentIndex, newValue ) );
+      }
+    else
+      {
+      ++nodeIt;
       }
     }
 }
@@ -492,19 +592,6 @@ template< unsigned int VDimension,
 void UpdateWhitakerSparseLevelSet< VDimension, TLevelSetValueType, TEquationContainer >
 ::UpdateLayerPlus1()
 {
-  ZeroFluxNeumannBoundaryCondition< LabelImageType > spNBC;
-
-  typename NeighborhoodIteratorType::RadiusType radius;
-  radius.Fill( 1 );
-
-  NeighborhoodIteratorType neighIt( radius,
-                                    this->m_InternalImage,
-                                    this->m_InternalImage->GetLargestPossibleRegion() );
-
-  neighIt.OverrideBoundaryCondition( &spNBC );
-  neighIt.ActivateOffsets(
-    Experimental::GenerateConnectedImageNeighborhoodShapeOffsets<ImageDimension, 1, false>());
-
   TermContainerPointer termContainer = this->m_EquationContainer->GetEquation( this->m_CurrentLevelSetId );
 
   LevelSetLayerType& layerPlus2 = this->m_TempLevelSet->GetLayer( LevelSetType::PlusTwoLayer() );
@@ -512,89 +599,60 @@ void UpdateWhitakerSparseLevelSet< VDimension, TLevelSetValueType, TEquationCont
 
   LevelSetLayerType& outputLayerPlus1 = this->m_OutputLevelSet->GetLayer( LevelSetType::PlusOneLayer() );
 
-  auto nodeIt   = outputLayerPlus1.begin();
-  auto nodeEnd  = outputLayerPlus1.end();
+  LayerSnapshotType snapshot;
+  this->FillLayerSnapshot( outputLayerPlus1, snapshot );
+  this->ClassifySideLayer( LevelSetType::PlusOneLayer(), snapshot );
 
-  while( nodeIt != nodeEnd )
+  // commit the decisions sequentially, in layer order
+  auto nodeIt = outputLayerPlus1.begin();
+
+  for( SizeValueType i = 0; i < snapshot.Indices.size(); ++i )
     {
-    const LevelSetInputType currentIndex = nodeIt->first;
+    const LevelSetInputType currentIndex = snapshot.Indices[i];
     const LevelSetInputType inputIndex = currentIndex + this->m_Offset;
+    const LevelSetOutputType newValue = snapshot.NewValues[i];
 
-    neighIt.SetLocation( currentIndex );
-
-    bool thereIsAPointWithLabelEqualTo0 = false;
-
-    LevelSetOutputType max = NumericTraits< LevelSetOutputType >::max();
+    itkAssertInDebugAndIgnoreInReleaseMacro( nodeIt->first == currentIndex );
 
-    for( typename NeighborhoodIteratorType::Iterator it = neighIt.Begin();
-         !it.IsAtEnd();
-         ++it )
-      {
-      LevelSetLayerIdType label = it.Get();
-
-      if( label <= LevelSetType::ZeroLayer() )
-        {
-        if( label == LevelSetType::ZeroLayer() )
-          {
-          thereIsAPointWithLabelEqualTo0 = true;
-          }
-        const LevelSetInputType neighborIndex = neighIt.GetIndex( it.GetNeighborhoodOffset() );
-
-        auto phiIt = this->m_TempPhi.find( neighborIndex );
-        if( phiIt != this->m_TempPhi.end() )
-          {
-          max = std::min( max, phiIt->second );
-          }
-        else
-          {
-          itkDebugMacro( << neighborIndex << "is not in this->m_TempPhi" <<std::endl );
-          }
-        }
-      } // end for
-
-    if( thereIsAPointWithLabelEqualTo0 )
-      {
-      auto phiIt = this->m_TempPhi.find( currentIndex );
-
-      max = max + 1.;
+    if( snapshot.Actions[i] == DemoteNodeUnchanged )
+      { // no point with label 0 in the neighborhood: change layers only
+      auto tempIt = nodeIt;
+      ++nodeIt;
+      outputLayerPlus1.erase( tempIt );
+      layerPlus2.insert( NodePairType( currentIndex, newValue ) );
+      continue;
+      }
 
-      if( phiIt != this->m_TempPhi.end() )
-        {// change in value
-        termContainer->UpdatePixel( inputIndex, phiIt->second, max );
-        phiIt->second = max;
-        nodeIt->second = max;
-        }
-      else
-        {// Kishore: can this happen?
-        this->m_TempPhi.insert( NodePairType( currentIndex, max ) );
-        }
+    auto phiIt = this->m_TempPhi.find( currentIndex );
 
-      if( max <= 0.5 )
-        {//change layers only
-        auto tempIt = nodeIt;
-        ++nodeIt;
-        outputLayerPlus1.erase( tempIt );
-        layerZero.insert( NodePairType( currentIndex, max ) );
-        }
-      else if( max > 1.5 )
-        {//change layers only
-        auto tempIt = nodeIt;
-        ++nodeIt;
-        outputLayerPlus1.erase( tempIt );
-        layerPlus2.insert( NodePairType( currentIndex, max ) );
-        }
-      else
-        {
-        ++nodeIt;
-        }
+    if( phiIt != this->m_TempPhi.end() )
+      {// change in value
+      termContainer->UpdatePixel( inputIndex, phiIt->second, newValue );
+      phiIt->second = newValue;
+      nodeIt->second = newValue;
       }
     else
-      { // change layers only
+      {// Kishore: can this happen?
+      this->m_TempPhi.insert( NodePairType( currentIndex, newValue ) );
+      }
+
+    if( snapshot.Actions[i] == PromoteNode )
+      {//change layers only
+      auto tempIt = nodeIt;
+      ++nodeIt;
+      outputLayerPlus1.erase( tempIt );
+      layerZero.insert( NodePairType( currentIndex, newValue ) );
+      }
+    else if( snapshot.Actions[i] == DemoteNode )
+      {//change layers only
       auto tempIt = nodeIt;
-      LevelSetOutputType t = tempIt->second;
       ++nodeIt;
       outputLayerPlus1.erase( tempIt );
-      layerPlus2.insert( NodePairType( currentIndex, t ) );
+      layerPlus2.insert( NodePairType( currentIndex, newValue ) );
+      }
+    else
+      {
+      ++nodeIt;
       }
     }
 }
@@ -605,110 +663,74 @@ template< unsigned int VDimension,
 void UpdateWhitakerSparseLevelSet< VDimension, TLevelSetValueType, TEquationContainer >
 ::UpdateLayerMinus2()
 {
-  ZeroFluxNeumannBoundaryCondition< LabelImageType > spNBC;
-
-  typename NeighborhoodIteratorType::RadiusType radius;
-  radius.Fill( 1 );
-
-  NeighborhoodIteratorType neighIt( radius,
-                                    this->m_InternalImage,
-                                    this->m_InternalImage->GetLargestPossibleRegion() );
-
-  neighIt.OverrideBoundaryCondition( &spNBC );
-  neighIt.ActivateOffsets(
-    Experimental::GenerateConnectedImageNeighborhoodShapeOffsets<ImageDimension, 1, false>());
-
   TermContainerPointer termContainer = this->m_EquationContainer->GetEquation( this->m_CurrentLevelSetId );
 
   LevelSetLayerType& outputLayerMinus2 = this->m_OutputLevelSet->GetLayer( LevelSetType::MinusTwoLayer() );
   LevelSetLayerType& layerMinus1 = this->m_TempLevelSet->GetLayer( LevelSetType::MinusOneLayer() );
 
+  LayerSnapshotType snapshot;
+  this->FillLayerSnapshot( outputLayerMinus2, snapshot );
+  this->ClassifySideLayer( LevelSetType::MinusTwoLayer(), snapshot );
+
+  // commit the decisions sequentially, in layer order
   auto nodeIt = outputLayerMinus2.begin();
-  const LevelSetLayerIterator nodeEnd = outputLayerMinus2.end();
 
-  while( nodeIt != nodeEnd )
+  for( SizeValueType i = 0; i < snapshot.Indices.size(); ++i )
     {
-    const LevelSetInputType currentIndex = nodeIt->first;
+    const LevelSetInputType currentIndex = snapshot.Indices[i];
     const LevelSetInputType inputIndex = currentIndex + this->m_Offset;
+    const LevelSetOutputType newValue = snapshot.NewValues[i];
 
-    neighIt.SetLocation( currentIndex );
-
-    bool thereIsAPointWithLabelEqualToMinus1 = false;
-
-    LevelSetOutputType max = NumericTraits< LevelSetOutputType >::NonpositiveMin();
-
-    for( typename NeighborhoodIteratorType::Iterator it = neighIt.Begin();
-         !it.IsAtEnd();
-         ++it )
-      {
-      const LevelSetLayerIdType label = it.Get();
+    itkAssertInDebugAndIgnoreInReleaseMacro( nodeIt->first == currentIndex );
 
-      if( label >= LevelSetType::MinusOneLayer() )
-        {
-        if( label == LevelSetType::MinusOneLayer() )
-          {
-          thereIsAPointWithLabelEqualToMinus1 = true;
-          }
-        const LevelSetInputType neighborIndex = neighIt.GetIndex( it.GetNeighborhoodOffset() );
+    if( snapshot.Actions[i] == DemoteNodeUnchanged )
+      { // no point with label -1 in the neighborhood: leave the narrow band
+      auto tempIt = nodeIt;
+      ++nodeIt;
+      this->m_InternalImage->SetPixel( currentIndex, LevelSetType::MinusThreeLayer() );
+      termContainer->UpdatePixel( inputIndex, tempIt->second, LevelSetType::MinusThreeLayer() );
+      outputLayerMinus2.erase( tempIt );
+      this->m_TempPhi.erase( currentIndex );
+      continue;
+      }
 
-        const LevelSetLayerIterator phiIt = this->m_TempPhi.find( neighborIndex );
-        itkAssertInDebugAndIgnoreInReleaseMacro( phiIt != this->m_TempPhi.end() );
+    const LevelSetLayerIterator phiIt = this->m_TempPhi.find( currentIndex );
 
-        max = std::max( max, phiIt->second );
-        }
-      } // end for
+    if( phiIt != this->m_TempPhi.end() )
+      {//change values
+      termContainer->UpdatePixel( inputIndex, phiIt->second, newValue );
+      phiIt->second = newValue;
+      nodeIt->second = newValue;
+      }
+    else
+      {//Kishore: can this happen?
+      this->m_TempPhi.insert(
+            NodePairType( currentIndex, newValue ) );
+      }
 
-    if( thereIsAPointWithLabelEqualToMinus1 )
+    if( snapshot.Actions[i] == PromoteNode ) //change layers only
       {
-      const LevelSetLayerIterator phiIt = this->m_TempPhi.find( currentIndex );
-
-      max = max - 1.;
-
-      if( phiIt != this->m_TempPhi.end() )
-        {//change values
-        termContainer->UpdatePixel( inputIndex, phiIt->second, max );
-        phiIt->second = max;
-        nodeIt->second = max;
-        }
-      else
-        {//Kishore: can this happen?
-        this->m_TempPhi.insert(
-              NodePairType( currentIndex, max ) );
-        }
-
-      if( max >= -1.5 ) //change layers only
-        {
-        auto tempIt = nodeIt;
-        ++nodeIt;
-        outputLayerMinus2.erase( tempIt );
-        layerMinus1.insert( NodePairType( currentIndex, max ) );
-        }
-      else if( max < -2.5 ) //change layers only
-        {
-        auto tempIt = nodeIt;
-        ++nodeIt;
-        outputLayerMinus2.erase( tempIt );
-
-        this->m_InternalImage->SetPixel( currentIndex, LevelSetType::MinusThreeLayer() );
-
-        termContainer->UpdatePixel( inputIndex, max, LevelSetType::MinusThreeLayer() );
-
-        this->m_TempPhi.erase( currentIndex );
-        }
-      else
-        {
-        ++nodeIt;
-        }
+      auto tempIt = nodeIt;
+      ++nodeIt;
+      outputLayerMinus2.erase( tempIt );
+      layerMinus1.insert( NodePairType( currentIndex, newValue ) );
       }
-    else // change value
+    else if( snapshot.Actions[i] == DemoteNode ) //change layers only
       {
       auto tempIt = nodeIt;
       ++nodeIt;
-      this->m_InternalImage->SetPixel( currentIndex, LevelSetType::MinusThreeLayer() );
-      termContainer->UpdatePixel( inputIndex, tempIt->second, LevelSetType::MinusThreeLayer() );
       outputLayerMinus2.erase( tempIt );
+
+      this->m_InternalImage->SetPixel( currentIndex, LevelSetType::MinusThreeLayer() );
+
+      termContainer->UpdatePixel( inputIndex, newValue, LevelSetType::MinusThreeLayer() );
+
       this->m_TempPhi.erase( currentIndex );
       }
+    else
+      {
+      ++nodeIt;
+      }
     }
 }
 
@@ -718,111 +740,73 @@ template< unsigned int VDimension,
 void UpdateWhitakerSparseLevelSet< VDimension, TLevelSetValueType, TEquationContainer >
 ::UpdateLayerPlus2()
 {
-  ZeroFluxNeumannBoundaryCondition< LabelImageType > spNBC;
-
-  typename NeighborhoodIteratorType::RadiusType radius;
-  radius.Fill( 1 );
-
-  NeighborhoodIteratorType neighIt( radius,
-                                    this->m_InternalImage,
-                                    this->m_InternalImage->GetLargestPossibleRegion() );
-
-  neighIt.OverrideBoundaryCondition( &spNBC );
-  neighIt.ActivateOffsets(
-    Experimental::GenerateConnectedImageNeighborhoodShapeOffsets<ImageDimension, 1, false>());
-
   TermContainerPointer termContainer = this->m_EquationContainer->GetEquation( this->m_CurrentLevelSetId );
 
   LevelSetLayerType& outputLayerPlus2 = this->m_OutputLevelSet->GetLayer( LevelSetType::PlusTwoLayer() );
   LevelSetLayerType& layerPlusOne = this->m_TempLevelSet->GetLayer( LevelSetType::PlusOneLayer() );
 
+  LayerSnapshotType snapshot;
+  this->FillLayerSnapshot( outputLayerPlus2, snapshot );
+  this->ClassifySideLayer( LevelSetType::PlusTwoLayer(), snapshot );
+
+  // commit the decisions sequentially, in layer order
   auto nodeIt = outputLayerPlus2.begin();
-  const LevelSetLayerIterator nodeEnd = outputLayerPlus2.end();
 
-  while( nodeIt != nodeEnd )
+  for( SizeValueType i = 0; i < snapshot.Indices.size(); ++i )
     {
-    const LevelSetInputType currentIndex = nodeIt->first;
+    const LevelSetInputType currentIndex = snapshot.Indices[i];
     const LevelSetInputType inputIndex = currentIndex + this->m_Offset;
+    const LevelSetOutputType newValue = snapshot.NewValues[i];
 
-    neighIt.SetLocation( currentIndex );
+    itkAssertInDebugAndIgnoreInReleaseMacro( nodeIt->first == currentIndex );
 
-    bool thereIsAPointWithLabelEqualToPlus1 = false;
-    LevelSetOutputType max = NumericTraits< LevelSetOutputType >::max();
+    if( snapshot.Actions[i] == DemoteNodeUnchanged )
+      { // no point with label +1 in the neighborhood: leave the narrow band
+      auto tempIt = nodeIt;
+      ++nodeIt;
+      this->m_InternalImage->SetPixel( currentIndex, LevelSetType::PlusThreeLayer() );
+      termContainer->UpdatePixel( inputIndex, tempIt->second, LevelSetType::PlusThreeLayer() );
+      outputLayerPlus2.erase( tempIt );
+      this->m_TempPhi.erase( currentIndex );
+      continue;
+      }
 
-    for( typename NeighborhoodIteratorType::Iterator it = neighIt.Begin();
-         !it.IsAtEnd();
-         ++it )
+    auto phiIt = this->m_TempPhi.find( currentIndex );
+
+    if( phiIt != this->m_TempPhi.end() ) // change values
       {
-      LevelSetLayerIdType label = it.Get();
-      if( label <= LevelSetType::PlusOneLayer() )
-        {
-        if( label == LevelSetType::PlusOneLayer() )
-          {
-          thereIsAPointWithLabelEqualToPlus1 = true;
-          }
-        const LevelSetInputType neighborIndex = neighIt.GetIndex( it.GetNeighborhoodOffset() );
-        auto phiIt = this->m_TempPhi.find( neighborIndex );
-        if( phiIt != this->m_TempPhi.end() )
-          {
-          max = std::min( max, phiIt->second );
-          }
-        else
-          {
-          itkDebugMacro( << neighborIndex << " is not in this->m_TempPhi" << std::endl );
-          }
-        }
+      termContainer->UpdatePixel( inputIndex, phiIt->second, newValue );
+      phiIt->second = newValue;
+      nodeIt->second = newValue;
+      }
+    else
+      // todo: remove dead code
+      {//Kishore: can this happen?
+      this->m_TempPhi.insert( NodePairType( currentIndex, newValue ) );
       }
 
-    if( thereIsAPointWithLabelEqualToPlus1 )
+    if( snapshot.Actions[i] == PromoteNode ) // change layers
       {
-      auto phiIt = this->m_TempPhi.find( currentIndex );
-
-      max = max + 1.;
-
-      if( phiIt != this->m_TempPhi.end() ) // change values
-        {
-        termContainer->UpdatePixel( inputIndex, phiIt->second, max );
-        phiIt->second = max;
-        nodeIt->second = max;
-        }
-      else
-        // todo: remove dead code
-        {//Kishore: can this happen?
-        this->m_TempPhi.insert( NodePairType( currentIndex, max ) );
-        }
-
-      if( max <= 1.5 ) // change layers
-        {
-        auto tempIt = nodeIt;
-        ++nodeIt;
-        outputLayerPlus2.erase( tempIt );
-        layerPlusOne.insert( NodePairType( currentIndex, max ) );
-        }
-      else if( max > 2.5 ) // change layers
-        {
-        auto tempIt = nodeIt;
-        ++nodeIt;
-        outputLayerPlus2.erase( tempIt );
-        this->m_InternalImage->SetPixel( currentIndex, LevelSetType::PlusThreeLayer() );
-
-        termContainer->UpdatePixel( inputIndex, max, LevelSetType::PlusThreeLayer() );
-
-        this->m_TempPhi.erase( currentIndex );
-        }
-      else
-        {
-        ++nodeIt;
-        }
+      auto tempIt = nodeIt;
+      ++nodeIt;
+      outputLayerPlus2.erase( tempIt );
+      layerPlusOne.insert( NodePairType( currentIndex, newValue ) );
       }
-    else // change values
+    else if( snapshot.Actions[i] == DemoteNode ) // change layers
       {
       auto tempIt = nodeIt;
       ++nodeIt;
-      this->m_InternalImage->SetPixel( currentIndex, LevelSetType::PlusThreeLayer() );
-      termContainer->UpdatePixel( inputIndex, tempIt->second, LevelSetType::PlusThreeLayer() );
       outputLayerPlus2.erase( tempIt );
+      this->m_InternalImage->SetPixel( currentIndex, LevelSetType::PlusThreeLayer() );
+
+      termContainer->UpdatePixel( inputIndex, newValue, LevelSetType::PlusThreeLayer() );
+
       this->m_TempPhi.erase( currentIndex );
       }
+    else
+      {
+      ++nodeIt;
+      }
     }
 }
 
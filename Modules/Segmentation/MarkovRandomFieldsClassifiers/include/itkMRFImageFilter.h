@@ -243,6 +243,19 @@ public:
   itkSetMacro(SmoothingFactor, double);
   itkGetConstMacro(SmoothingFactor, double);
 
+  /** Enable a checkerboard (red-black) update schedule for the ICM
+   * minimization. The image interior is partitioned into blocks of twice
+   * the neighborhood radius and the blocks of equal parity, which are far
+   * enough apart never to touch each other's neighborhoods, are labelled
+   * concurrently; one sweep per parity is made each iteration. Pixels
+   * whose neighborhood labels did not change in the previous sweeps are
+   * skipped. The schedule visits pixels in a different order than the
+   * default serial raster scan and may therefore converge to a slightly
+   * different labelling. Off by default. */
+  itkSetMacro(UseCheckerboardUpdates, bool);
+  itkGetConstMacro(UseCheckerboardUpdates, bool);
+  itkBooleanMacro(UseCheckerboardUpdates);
+
   /** Set the neighborhood radius */
   void SetNeighborhoodRadius(const NeighborhoodRadiusType &);
 
@@ -336,6 +349,16 @@ protected:
                                        LabelledImageNeighborhoodIterator & labelledIter,
                                        LabelStatusImageNeighborhoodIterator & labelStatusIter);
 
+  /** Overload of the neighborhood operation taking the scratch space as
+   * arguments, so that concurrently labelled blocks of the checkerboard
+   * schedule do not share state. The member function version above
+   * delegates to this one with the member scratch vectors. */
+  virtual void DoNeighborhoodOperation(const InputImageNeighborhoodIterator & imageIter,
+                                       LabelledImageNeighborhoodIterator & labelledIter,
+                                       LabelStatusImageNeighborhoodIterator & labelStatusIter,
+                                       std::vector< double > & neighborInfluence,
+                                       std::vector< double > & mahalanobisDistance);
+
   void GenerateData() override;
 
   void GenerateInputRequestedRegion() override;
@@ -369,6 +392,7 @@ private:
   int               m_TotalNumberOfPixelsInInputImage{1};
   double            m_ErrorTolerance{0.2};
   double            m_SmoothingFactor{1};
+  bool              m_UseCheckerboardUpdates{false};
   double *          m_ClassProbability{nullptr};         //Class liklihood
   unsigned int      m_NumberOfIterations{0};
   StopConditionType m_StopCondition;
@@ -390,6 +414,10 @@ private:
 
   //Function implementing the ICM algorithm to label the images
   void ApplyICMLabeller();
+
+  //Function implementing the parallel checkerboard (red-black) flavor
+  //of the ICM algorithm
+  void ApplyCheckerboardICMLabeller();
 }; // class MRFImageFilter
 } // namespace itk
 
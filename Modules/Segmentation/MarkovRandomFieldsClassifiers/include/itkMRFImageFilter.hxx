@@ -19,6 +19,10 @@
 #define itkMRFImageFilter_hxx
 #include "itkMRFImageFilter.h"
 
+#include "itkMultiThreaderBase.h"
+
+#include <algorithm>
+
 namespace itk
 {
 template< typename TInputImage, typename TClassifiedImage >
@@ -82,6 +86,9 @@ MRFImageFilter< TInputImage, TClassifiedImage >
   os << indent << " Smoothing factor for the MRF neighborhood:"
      << m_SmoothingFactor << std::endl;
 
+  os << indent << " Use checkerboard updates:"
+     << m_UseCheckerboardUpdates << std::endl;
+
   os << indent << "StopCondition: "
      << m_StopCondition << std::endl;
 
@@ -493,7 +500,14 @@ MRFImageFilter< TInputImage, TClassifiedImage >
 ::MinimizeFunctional()
 {
   //This implementation uses the ICM algorithm
-  ApplyICMLabeller();
+  if ( m_UseCheckerboardUpdates )
+    {
+    ApplyCheckerboardICMLabeller();
+    }
+  else
+    {
+    ApplyICMLabeller();
+    }
 }
 
 //-------------------------------------------------------
@@ -585,6 +599,122 @@ MRFImageFilter< TInputImage, TClassifiedImage >
     }
 } //ApplyICMlabeller
 
+//-------------------------------------------------------
+//-------------------------------------------------------
+//Checkerboard (red-black) flavor of the ICM algorithm
+//-------------------------------------------------------
+template< typename TInputImage, typename TClassifiedImage >
+void
+MRFImageFilter< TInputImage, TClassifiedImage >
+::ApplyCheckerboardICMLabeller()
+{
+  InputImageConstPointer inputImage = this->GetInput();
+  LabelledImagePointer   labelledImage = m_ClassifierPtr->GetClassifiedImage();
+
+  //---------------------------------------------------------------------
+  // Determine the interior region (the boundaries are not visited, as
+  // in the serial labeller) and partition it into checkerboard blocks.
+  // Blocks are twice the neighborhood radius long in each dimension, so
+  // blocks of equal parity never read or write each other's
+  // neighborhoods and can be labelled concurrently.
+  //---------------------------------------------------------------------
+  LabelledImageRegionType interiorRegion = labelledImage->GetBufferedRegion();
+
+  SizeValueType blockLength[InputImageDimension];
+  SizeValueType numberOfBlocks[InputImageDimension];
+  SizeValueType totalNumberOfBlocks = 1;
+
+  for ( unsigned int i = 0; i < InputImageDimension; ++i )
+    {
+    const SizeValueType radius = m_InputImageNeighborhoodRadius[i];
+    if ( interiorRegion.GetSize(i) <= 2 * radius )
+      {
+      //No interior pixels to relabel
+      return;
+      }
+    interiorRegion.SetIndex( i, interiorRegion.GetIndex(i) + static_cast< IndexValueType >( radius ) );
+    interiorRegion.SetSize( i, interiorRegion.GetSize(i) - 2 * radius );
+
+    blockLength[i] = ( radius > 0 ) ? 2 * radius : 1;
+    numberOfBlocks[i] = ( interiorRegion.GetSize(i) + blockLength[i] - 1 ) / blockLength[i];
+    totalNumberOfBlocks *= numberOfBlocks[i];
+    }
+
+  //Gather the block regions of each of the 2^Dimension parities
+  std::vector< std::vector< LabelledImageRegionType > >
+  parityBlocks(SizeValueType(1) << InputImageDimension);
+
+  for ( SizeValueType block = 0; block < totalNumberOfBlocks; ++block )
+    {
+    SizeValueType           remainder = block;
+    unsigned int            parity = 0;
+    LabelledImageRegionType blockRegion;
+
+    for ( unsigned int i = 0; i < InputImageDimension; ++i )
+      {
+      const SizeValueType coordinate = remainder % numberOfBlocks[i];
+      remainder /= numberOfBlocks[i];
+      parity |= static_cast< unsigned int >( coordinate & 1 ) << i;
+
+      const SizeValueType begin = coordinate * blockLength[i];
+      blockRegion.SetIndex( i, interiorRegion.GetIndex(i) + static_cast< IndexValueType >( begin ) );
+      blockRegion.SetSize( i, std::min( blockLength[i], interiorRegion.GetSize(i) - begin ) );
+      }
+    parityBlocks[parity].push_back(blockRegion);
+    }
+
+  //---------------------------------------------------------------------
+  // One parallel sweep per parity
+  //---------------------------------------------------------------------
+  MultiThreaderBase *threader = this->GetMultiThreader();
+
+  for ( unsigned int parity = 0; parity < parityBlocks.size(); ++parity )
+    {
+    const std::vector< LabelledImageRegionType > & blocks = parityBlocks[parity];
+    if ( blocks.empty() )
+      {
+      continue;
+      }
+
+    threader->ParallelizeArray( 0, blocks.size(),
+        [this, &blocks, &inputImage, &labelledImage]( SizeValueType blockIndex )
+          {
+          const LabelledImageRegionType & blockRegion = blocks[blockIndex];
+
+          //Per-block scratch space so concurrent blocks share no state
+          std::vector< double > neighborInfluence(m_NumberOfClasses);
+          std::vector< double > mahalanobisDistance(m_NumberOfClasses);
+
+          InputImageNeighborhoodIterator
+          inputIter(m_InputImageNeighborhoodRadius, inputImage, blockRegion);
+
+          LabelledImageNeighborhoodIterator
+          labelledIter(m_LabelledImageNeighborhoodRadius, labelledImage, blockRegion);
+
+          LabelStatusImageNeighborhoodIterator
+          labelStatusIter(m_LabelStatusImageNeighborhoodRadius, m_LabelStatusImage, blockRegion);
+
+          while ( !inputIter.IsAtEnd() )
+            {
+            //Reexamine a pixel only if its label or the label of one of
+            //its neighbors changed in a previous sweep
+            if ( labelStatusIter.GetCenterPixel() != 0 )
+              {
+              this->DoNeighborhoodOperation(inputIter,
+                                            labelledIter,
+                                            labelStatusIter,
+                                            neighborInfluence,
+                                            mahalanobisDistance);
+              }
+
+            ++inputIter;
+            ++labelledIter;
+            ++labelStatusIter;
+            }
+          }, nullptr );
+    }
+} //ApplyCheckerboardICMLabeller
+
 //-------------------------------------------------------
 //-------------------------------------------------------
 //Function that performs the MRF operation with each neighborhood
@@ -596,6 +726,19 @@ MRFImageFilter< TInputImage, TClassifiedImage >
 ::DoNeighborhoodOperation(const InputImageNeighborhoodIterator & imageIter,
                           LabelledImageNeighborhoodIterator & labelledIter,
                           LabelStatusImageNeighborhoodIterator & labelStatusIter)
+{
+  this->DoNeighborhoodOperation(imageIter, labelledIter, labelStatusIter,
+                                m_NeighborInfluence, m_MahalanobisDistance);
+} // end DoNeighborhoodOperation
+
+template< typename TInputImage, typename TClassifiedImage >
+void
+MRFImageFilter< TInputImage, TClassifiedImage >
+::DoNeighborhoodOperation(const InputImageNeighborhoodIterator & imageIter,
+                          LabelledImageNeighborhoodIterator & labelledIter,
+                          LabelStatusImageNeighborhoodIterator & labelStatusIter,
+                          std::vector< double > & neighborInfluence,
+                          std::vector< double > & mahalanobisDistance)
 {
   unsigned int index;
 
@@ -607,9 +750,9 @@ MRFImageFilter< TInputImage, TClassifiedImage >
 
   //Reinitialize the neighborhood influence at the beginning of the
   //neighborhood operation
-  for ( index = 0; index < m_NeighborInfluence.size(); index++ )
+  for ( index = 0; index < neighborInfluence.size(); index++ )
     {
-    m_NeighborInfluence[index] = 0;
+    neighborInfluence[index] = 0;
     }
 
   LabelledImagePixelType labelledPixel;
@@ -619,14 +762,14 @@ MRFImageFilter< TInputImage, TClassifiedImage >
     {
     labelledPixel = labelledIter.GetPixel(i);
     index = (unsigned int)labelledPixel;
-    m_NeighborInfluence[index] += m_MRFNeighborhoodWeight[i];
+    neighborInfluence[index] += m_MRFNeighborhoodWeight[i];
     } //End neighborhood processing
 
   //Add the prior probability to the pixel probability
   for ( index = 0; index < m_NumberOfClasses; index++ )
     {
-    m_MahalanobisDistance[index] = m_NeighborInfluence[index]
-                                   - pixelMembershipValue[index];
+    mahalanobisDistance[index] = neighborInfluence[index]
+                                 - pixelMembershipValue[index];
     }
 
   //Determine the maximum possible distance
@@ -635,7 +778,7 @@ MRFImageFilter< TInputImage, TClassifiedImage >
   double tmpPixDistance;
   for ( index = 0; index < m_NumberOfClasses; index++ )
     {
-    tmpPixDistance = m_MahalanobisDistance[index];
+    tmpPixDistance = mahalanobisDistance[index];
     if ( tmpPixDistance > maximumDistance )
       {
       maximumDistance = tmpPixDistance;
@@ -414,5 +414,58 @@ int itkMRFImageFilterTest(int, char* [] )
     return EXIT_FAILURE;
     }
 
+  //----------------------------------------------------------------------
+  // Rerun the labeller with the parallel checkerboard (red-black) update
+  // schedule and verify that it computes the same labelling
+  //----------------------------------------------------------------------
+  MRFImageFilterType::Pointer applyCheckerboardMRFImageFilter = MRFImageFilterType::New();
+
+  applyCheckerboardMRFImageFilter->SetNumberOfClasses( NUM_CLASSES );
+  applyCheckerboardMRFImageFilter->SetMaximumNumberOfIterations( MAX_NUM_ITER );
+  applyCheckerboardMRFImageFilter->SetErrorTolerance( 0.10 );
+  applyCheckerboardMRFImageFilter->SetSmoothingFactor( 1 );
+  applyCheckerboardMRFImageFilter->SetNeighborhoodRadius( NEIGHBORHOOD_RAD );
+  applyCheckerboardMRFImageFilter->SetInput(vecImage);
+  applyCheckerboardMRFImageFilter->SetClassifier( myClassifier );
+  applyCheckerboardMRFImageFilter->UseCheckerboardUpdatesOn();
+
+  std::cout << "Use checkerboard updates: " <<
+    applyCheckerboardMRFImageFilter->GetUseCheckerboardUpdates() << std::endl;
+
+  applyCheckerboardMRFImageFilter->Update();
+
+  ClassImageType::Pointer outCheckerboardClassImage =
+    applyCheckerboardMRFImageFilter->GetOutput();
+
+  outImageFaceList =
+    outImageFacesCalculator( outCheckerboardClassImage,
+                             outCheckerboardClassImage->GetBufferedRegion(),
+                             outImageNeighborhoodRadius );
+  outImageFaceListIter = outImageFaceList.begin();
+
+  OutImageNeighborhoodIterator
+    nCheckerboardNeighborhoodIter( outImageNeighborhoodRadius,
+                                   outCheckerboardClassImage,
+                                   *outImageFaceListIter );
+
+  int checkerboardSum = 0;
+  while( !nCheckerboardNeighborhoodIter.IsAtEnd() )
+    {
+    outLabel = nCheckerboardNeighborhoodIter.GetCenterValue();
+    checkerboardSum += ( int ) (*outLabel);
+    ++nCheckerboardNeighborhoodIter;
+    }
+
+  if( checkerboardSum == sum )
+    {
+    std::cout<< "Checkerboard MRF labeller Test Passed" << std::endl;
+    }
+  else
+    {
+    std::cout<< "Checkerboard MRF labeller Test failed. Label sum is "
+      << checkerboardSum << " and not " << sum << "." << std::endl;
+    return EXIT_FAILURE;
+    }
+
   return EXIT_SUCCESS;
 }
@@ -25,8 +25,8 @@
 #include "itkMeanImageFunction.h"
 #include "itkSumOfSquaresImageFunction.h"
 #include "itkBinaryThresholdImageFunction.h"
-#include "itkFloodFilledImageFunctionConditionalIterator.h"
-#include "itkProgressReporter.h"
+#include "itkFloodFilledImageFunctionConditionalConstIterator.h"
+#include "itkParallelFrontierFloodFill.h"
 
 namespace itk
 {
@@ -141,7 +141,10 @@ ConfidenceConnectedImageFilter< TInputImage, TOutputImage >
   using FunctionType = BinaryThresholdImageFunction< InputImageType, double >;
   using SecondFunctionType = BinaryThresholdImageFunction< OutputImageType, double >;
 
-  using IteratorType = FloodFilledImageFunctionConditionalIterator< OutputImageType, FunctionType >;
+  // The segmentations are grown with the parallel frontier engine; the
+  // sequential const iterator is kept for the statistics pass, which
+  // accumulates its values in traversal order.
+  using EngineType = ParallelFrontierFloodFill< OutputImageType, FunctionType >;
   using SecondIteratorType = FloodFilledImageFunctionConditionalConstIterator< InputImageType, SecondFunctionType >;
 
   unsigned int loop;
@@ -300,22 +303,14 @@ ConfidenceConnectedImageFilter< TInputImage, TOutputImage >
     << "\nLower intensity = " << lower << ", Upper intensity = " << upper << "\nmean = " << m_Mean
     << " , std::sqrt(variance) = " << std::sqrt(m_Variance) );
 
-  // Segment the image, the iterator walks the output image (so Set()
-  // writes into the output image), starting at the seed point.  As
-  // the iterator walks, if the corresponding pixel in the input image
-  // (accessed via the "function" assigned to the iterator) is within
-  // the [lower, upper] bounds prescribed, the pixel is added to the
-  // output segmentation and its neighbors become candidates for the
-  // iterator to walk.
-  IteratorType it = IteratorType (outputImage, function, m_Seeds);
-  it.GoToBegin();
-  while ( !it.IsAtEnd() )
-    {
-    it.Set(m_ReplaceValue);
-    ++it;
-    }
-
-  ProgressReporter progress(this, 0, region.GetNumberOfPixels() * m_NumberOfIterations);
+  // Segment the image.  The engine grows the region over the output
+  // image, starting at the seed points.  A pixel whose value in the
+  // input image (accessed via the "function" given to the engine) is
+  // within the [lower, upper] bounds prescribed is added to the output
+  // segmentation, and its neighbors become candidates of the next
+  // frontier sweep.
+  EngineType engine(outputImage, function, m_Seeds);
+  engine.Fill(m_ReplaceValue);
 
   for ( loop = 0; loop < m_NumberOfIterations; ++loop )
     {
@@ -404,21 +399,18 @@ ConfidenceConnectedImageFilter< TInputImage, TOutputImage >
     // segmentation and its neighbors become candidates for the
     // iterator to walk.
     outputImage->FillBuffer (NumericTraits< OutputImagePixelType >::ZeroValue());
-    IteratorType thirdIt = IteratorType (outputImage, function, m_Seeds);
-    thirdIt.GoToBegin();
+    EngineType thirdEngine(outputImage, function, m_Seeds);
     try
       {
-      while ( !thirdIt.IsAtEnd() )
-        {
-        thirdIt.Set(m_ReplaceValue);
-        ++thirdIt;
-        progress.CompletedPixel();  // potential exception thrown here
-        }
+      // the engine checks the abort flag between frontier sweeps
+      thirdEngine.Fill(m_ReplaceValue, this);
       }
     catch ( ProcessAborted & )
       {
       break; // interrupt the iterations loop
       }
+    this->UpdateProgress( static_cast< float >( loop + 1 )
+                          / static_cast< float >( m_NumberOfIterations ) );
     }  // end iteration loop
 
   if ( this->GetAbortGenerateData() )
@@ -20,10 +20,7 @@
 
 #include "itkConnectedThresholdImageFilter.h"
 #include "itkBinaryThresholdImageFunction.h"
-#include "itkFloodFilledImageFunctionConditionalIterator.h"
-#include "itkProgressReporter.h"
-
-#include "itkShapedFloodFilledImageFunctionConditionalIterator.h"
+#include "itkParallelFrontierFloodFill.h"
 #include "itkMath.h"
 
 namespace itk
@@ -264,40 +261,15 @@ ConnectedThresholdImageFilter< TInputImage, TOutputImage >
   function->SetInputImage( inputImage );
   function->ThresholdBetween( lower, upper );
 
-  ProgressReporter progress( this, 0, region.GetNumberOfPixels() );
+  // Grow the region with the level-synchronous parallel frontier engine;
+  // the result is the same set of pixels the flood filled iterators
+  // visit, computed with all the available work units.
+  using EngineType = ParallelFrontierFloodFill< OutputImageType, FunctionType >;
+  EngineType engine(outputImage, function, m_Seeds);
+  engine.SetFullyConnected(this->m_Connectivity == FullConnectivity);
+  engine.Fill(m_ReplaceValue, this);
 
-  if ( this->m_Connectivity == FaceConnectivity )
-    {
-    using IteratorType = FloodFilledImageFunctionConditionalIterator< OutputImageType, FunctionType >;
-    IteratorType it (outputImage, function, m_Seeds);
-    it.GoToBegin();
-
-    while ( !it.IsAtEnd() )
-      {
-      it.Set(m_ReplaceValue);
-      ++it;
-      progress.CompletedPixel();  // potential exception thrown here
-      }
-    }
-  else if ( this->m_Connectivity == FullConnectivity )
-    {
-    // Use the fully connected iterator here. The fully connected iterator
-    // below is a superset of the above. However, it is reported to be 20%
-    // slower. Hence we use this "if" block to use the old iterator when
-    // we don't need full connectivity.
-
-    using IteratorType = ShapedFloodFilledImageFunctionConditionalIterator< OutputImageType, FunctionType >;
-    IteratorType it (outputImage, function, m_Seeds);
-    it.FullyConnectedOn();
-    it.GoToBegin();
-
-    while ( !it.IsAtEnd() )
-      {
-      it.Set(m_ReplaceValue);
-      ++it;
-      progress.CompletedPixel();  // potential exception thrown here
-      }
-    }
+  this->UpdateProgress(1.0);
 }
 
 template< typename TInputImage, typename TOutputImage >
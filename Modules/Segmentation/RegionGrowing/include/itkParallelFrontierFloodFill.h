@@ -0,0 +1,260 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkParallelFrontierFloodFill_h
+#define itkParallelFrontierFloodFill_h
+
+#include "itkMultiThreaderBase.h"
+#include "itkProcessObject.h"
+
+#include <atomic>
+#include <vector>
+
+namespace itk
+{
+/** \class ParallelFrontierFloodFill
+ * \brief Level-synchronous parallel replacement for the flood filled
+ * image function conditional iterators.
+ *
+ * The flood fill grows one frontier generation at a time: the current
+ * frontier is partitioned across the work units of a MultiThreaderBase,
+ * every thread tests the neighbors of its share of the frontier with the
+ * supplied image function, and the accepted pixels form the next
+ * frontier.  Duplicate work is suppressed with an atomic visited map, so
+ * every candidate pixel is claimed and evaluated by exactly one thread.
+ * The set of pixels filled is identical to the one visited by
+ * FloodFilledImageFunctionConditionalIterator (or its shaped, fully
+ * connected counterpart); only the traversal order differs, which is
+ * irrelevant to callers that write a single replace value.
+ *
+ * The image function is evaluated concurrently from several threads and
+ * therefore must be usable const-wise from multiple threads, which holds
+ * for the threshold based functions the region growing filters use.
+ *
+ * \sa FloodFilledImageFunctionConditionalIterator
+ * \sa ConnectedThresholdImageFilter
+ * \sa ConfidenceConnectedImageFilter
+ * \ingroup RegionGrowingSegmentation
+ * \ingroup ITKRegionGrowing
+ */
+template< typename TOutputImage, typename TFunction >
+class ParallelFrontierFloodFill
+{
+public:
+  using OutputImageType = TOutputImage;
+  using OutputImagePixelType = typename TOutputImage::PixelType;
+  using FunctionType = TFunction;
+  using RegionType = typename TOutputImage::RegionType;
+  using IndexType = typename TOutputImage::IndexType;
+  using OffsetType = typename TOutputImage::OffsetType;
+  using SeedsContainerType = std::vector< IndexType >;
+
+  static constexpr unsigned int ImageDimension = TOutputImage::ImageDimension;
+
+  ParallelFrontierFloodFill(OutputImageType *outputImage,
+                            FunctionType *function,
+                            const SeedsContainerType & seeds):
+    m_OutputImage(outputImage),
+    m_Function(function),
+    m_Seeds(seeds)
+  {}
+
+  /** Grow across all the face and vertex neighbors instead of the face
+   * neighbors only. */
+  void SetFullyConnected(bool fullyConnected)
+  { m_FullyConnected = fullyConnected; }
+  bool GetFullyConnected() const
+  { return m_FullyConnected; }
+
+  /** Run the flood fill, writing the given value to every accepted pixel
+   * of the output image.  A filter may be supplied to honor its abort
+   * flag between frontier sweeps, in which case a ProcessAborted
+   * exception is thrown on abort.  Returns the number of pixels
+   * filled. */
+  SizeValueType Fill(const OutputImagePixelType & value,
+                     ProcessObject *filter = nullptr)
+  {
+    const RegionType region = m_OutputImage->GetBufferedRegion();
+
+    const std::vector< OffsetType > neighborhood = this->BuildNeighborhood();
+
+    // one flag per pixel of the region; exactly one thread can claim a
+    // candidate pixel, whether it ends up accepted or rejected
+    std::vector< std::atomic< unsigned char > >
+    visited( region.GetNumberOfPixels() );
+
+    SizeValueType numberOfPixels = 0;
+
+    // seeds are claimed sequentially; like the iterators, a seed is
+    // included only when the function accepts it
+    std::vector< IndexType > frontier;
+    for ( const IndexType & seed : m_Seeds )
+      {
+      if ( region.IsInside(seed)
+           && visited[this->OffsetOfIndex(region, seed)]
+                .exchange(1, std::memory_order_relaxed) == 0
+           && m_Function->EvaluateAtIndex(seed) )
+        {
+        m_OutputImage->SetPixel(seed, value);
+        frontier.push_back(seed);
+        ++numberOfPixels;
+        }
+      }
+
+    MultiThreaderBase::Pointer threader = MultiThreaderBase::New();
+    const auto numberOfWorkUnits =
+      static_cast< SizeValueType >( threader->GetNumberOfWorkUnits() );
+    std::vector< std::vector< IndexType > > accepted(numberOfWorkUnits);
+
+    while ( !frontier.empty() )
+      {
+      if ( filter != nullptr && filter->GetAbortGenerateData() )
+        {
+        throw ProcessAborted(__FILE__, __LINE__);
+        }
+
+      const SizeValueType numberOfChunks =
+        std::min( numberOfWorkUnits,
+                  static_cast< SizeValueType >( frontier.size() ) );
+      const SizeValueType chunkSize =
+        ( frontier.size() + numberOfChunks - 1 ) / numberOfChunks;
+
+      threader->ParallelizeArray( 0, numberOfChunks,
+        [this, &frontier, &accepted, &visited, &neighborhood, &region,
+         &value, chunkSize]( SizeValueType chunk )
+          {
+          const SizeValueType begin = chunk * chunkSize;
+          const SizeValueType end =
+            std::min( static_cast< SizeValueType >( frontier.size() ),
+                      begin + chunkSize );
+          for ( SizeValueType i = begin; i < end; ++i )
+            {
+            for ( const OffsetType & offset : neighborhood )
+              {
+              const IndexType neighbor = frontier[i] + offset;
+              if ( !region.IsInside(neighbor) )
+                {
+                continue;
+                }
+              if ( visited[this->OffsetOfIndex(region, neighbor)]
+                     .exchange(1, std::memory_order_relaxed) != 0 )
+                {
+                continue;
+                }
+              if ( m_Function->EvaluateAtIndex(neighbor) )
+                {
+                m_OutputImage->SetPixel(neighbor, value);
+                accepted[chunk].push_back(neighbor);
+                }
+              }
+            }
+          },
+        nullptr );
+
+      // the accepted candidates become the next frontier
+      frontier.clear();
+      for ( std::vector< IndexType > & chunkAccepted : accepted )
+        {
+        numberOfPixels += chunkAccepted.size();
+        frontier.insert( frontier.end(),
+                         chunkAccepted.begin(), chunkAccepted.end() );
+        chunkAccepted.clear();
+        }
+      }
+
+    return numberOfPixels;
+  }
+
+private:
+  /** The linear offset of an index within the buffered region, used to
+   * address the visited map. */
+  SizeValueType OffsetOfIndex(const RegionType & region,
+                              const IndexType & index) const
+  {
+    SizeValueType offset = 0;
+    SizeValueType stride = 1;
+    for ( unsigned int i = 0; i < ImageDimension; ++i )
+      {
+      offset += static_cast< SizeValueType >( index[i]
+                                              - region.GetIndex()[i] ) * stride;
+      stride *= region.GetSize()[i];
+      }
+    return offset;
+  }
+
+  std::vector< OffsetType > BuildNeighborhood() const
+  {
+    std::vector< OffsetType > neighborhood;
+    if ( !m_FullyConnected )
+      {
+      // the face neighbors, as visited by the flood filled iterators
+      for ( unsigned int i = 0; i < ImageDimension; ++i )
+        {
+        for ( int j = -1; j <= 1; j += 2 )
+          {
+          OffsetType offset;
+          offset.Fill(0);
+          offset[i] = j;
+          neighborhood.push_back(offset);
+          }
+        }
+      }
+    else
+      {
+      // every offset in the 3^N neighborhood except the center
+      OffsetType offset;
+      offset.Fill(-1);
+      for ( ;; )
+        {
+        bool isCenter = true;
+        for ( unsigned int i = 0; i < ImageDimension; ++i )
+          {
+          isCenter = isCenter && offset[i] == 0;
+          }
+        if ( !isCenter )
+          {
+          neighborhood.push_back(offset);
+          }
+        unsigned int i = 0;
+        for ( ; i < ImageDimension; ++i )
+          {
+          if ( ++offset[i] <= 1 )
+            {
+            break;
+            }
+          offset[i] = -1;
+          }
+        if ( i == ImageDimension )
+          {
+          break;
+          }
+        }
+      }
+    return neighborhood;
+  }
+
+  OutputImageType *m_OutputImage;
+
+  FunctionType *m_Function;
+
+  const SeedsContainerType & m_Seeds;
+
+  bool m_FullyConnected{false};
+};
+} // end namespace itk
+
+#endif
@@ -0,0 +1,146 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkParallelFrontierFloodFill.h"
+#include "itkBinaryThresholdImageFunction.h"
+#include "itkFloodFilledImageFunctionConditionalIterator.h"
+#include "itkShapedFloodFilledImageFunctionConditionalIterator.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkImageRegionIterator.h"
+#include "itkMersenneTwisterRandomVariateGenerator.h"
+
+int itkParallelFrontierFloodFillTest( int, char* [] )
+{
+  constexpr unsigned int Dimension = 2;
+
+  using PixelType = short;
+  using ImageType = itk::Image< PixelType, Dimension >;
+  using LabelImageType = itk::Image< unsigned char, Dimension >;
+  using FunctionType = itk::BinaryThresholdImageFunction< ImageType, double >;
+
+  // A noisy input whose thresholded foreground forms an irregular,
+  // multiply connected set around the center seed.
+  ImageType::SizeType size;
+  size.Fill( 128 );
+
+  ImageType::RegionType region;
+  region.SetSize( size );
+
+  ImageType::Pointer image = ImageType::New();
+  image->SetRegions( region );
+  image->Allocate();
+
+  using GeneratorType = itk::Statistics::MersenneTwisterRandomVariateGenerator;
+  GeneratorType::Pointer generator = GeneratorType::New();
+  generator->Initialize( 42 );
+
+  itk::ImageRegionIterator< ImageType > it( image, region );
+  for ( ; !it.IsAtEnd(); ++it )
+    {
+    it.Value() = static_cast< PixelType >(
+      generator->GetIntegerVariate( 99 ) );
+    }
+
+  ImageType::IndexType seed;
+  seed.Fill( 64 );
+  // make sure the seed is accepted
+  image->SetPixel( seed, 10 );
+
+  std::vector< ImageType::IndexType > seeds;
+  seeds.push_back( seed );
+
+  FunctionType::Pointer function = FunctionType::New();
+  function->SetInputImage( image );
+  function->ThresholdBetween( 0, 59 );
+
+  constexpr unsigned char replaceValue = 255;
+
+  // both connectivities must reproduce the sequential iterators exactly
+  for ( int fullyConnected = 0; fullyConnected <= 1; ++fullyConnected )
+    {
+    LabelImageType::Pointer reference = LabelImageType::New();
+    reference->SetRegions( region );
+    reference->Allocate( true );
+
+    if ( fullyConnected == 0 )
+      {
+      using IteratorType = itk::FloodFilledImageFunctionConditionalIterator<
+        LabelImageType, FunctionType >;
+      IteratorType flood( reference, function, seeds );
+      for ( flood.GoToBegin(); !flood.IsAtEnd(); ++flood )
+        {
+        flood.Set( replaceValue );
+        }
+      }
+    else
+      {
+      using IteratorType =
+        itk::ShapedFloodFilledImageFunctionConditionalIterator<
+          LabelImageType, FunctionType >;
+      IteratorType flood( reference, function, seeds );
+      flood.FullyConnectedOn();
+      for ( flood.GoToBegin(); !flood.IsAtEnd(); ++flood )
+        {
+        flood.Set( replaceValue );
+        }
+      }
+
+    LabelImageType::Pointer label = LabelImageType::New();
+    label->SetRegions( region );
+    label->Allocate( true );
+
+    using EngineType =
+      itk::ParallelFrontierFloodFill< LabelImageType, FunctionType >;
+    EngineType engine( label, function, seeds );
+    engine.SetFullyConnected( fullyConnected != 0 );
+    const itk::SizeValueType numberOfPixels =
+      engine.Fill( replaceValue );
+
+    itk::SizeValueType referencePixels = 0;
+    itk::ImageRegionConstIterator< LabelImageType >
+      referenceIt( reference, region );
+    itk::ImageRegionConstIterator< LabelImageType > labelIt( label, region );
+    for ( ; !referenceIt.IsAtEnd(); ++referenceIt, ++labelIt )
+      {
+      if ( referenceIt.Get() != labelIt.Get() )
+        {
+        std::cerr << "Mismatch at " << referenceIt.GetIndex()
+                  << " with fully connected = " << fullyConnected
+                  << std::endl;
+        return EXIT_FAILURE;
+        }
+      if ( referenceIt.Get() == replaceValue )
+        {
+        ++referencePixels;
+        }
+      }
+
+    if ( numberOfPixels != referencePixels )
+      {
+      std::cerr << "The engine reported " << numberOfPixels
+                << " pixels but filled " << referencePixels << std::endl;
+      return EXIT_FAILURE;
+      }
+
+    std::cout << "Fully connected = " << fullyConnected << ": "
+              << numberOfPixels << " pixels match." << std::endl;
+    }
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -186,8 +186,6 @@ protected:
 
   DistanceType Distance(const ClusterType &cluster1, const ClusterType &cluster2);
 
-  DistanceType Distance(const ClusterType &cluster, const InputPixelType &v, const PointType &pt);
-
 private:
 
   SuperGridSizeType m_SuperGridSize;
@@ -212,6 +212,7 @@ SLICImageFilter<TInputImage, TOutputImage, TDistancePixel>
 {
   using InputConstIteratorType = ImageScanlineConstIterator<InputImageType>;
   using DistanceIteratorType = ImageScanlineIterator<DistanceImageType>;
+  using OutputIteratorType = ImageScanlineIterator<OutputImageType>;
 
   const InputImageType *inputImage = this->GetInput();
   OutputImageType *outputImage = this->GetOutput();
@@ -228,7 +229,6 @@ SLICImageFilter<TInputImage, TOutputImage, TDistancePixel>
     {
     ClusterType cluster(numberOfClusterComponents, &m_Clusters[i*numberOfClusterComponents]);
     typename InputImageType::RegionType localRegion;
-    typename InputImageType::PointType pt;
     IndexType idx;
 
     for (unsigned int d = 0; d < ImageDimension; ++d)
@@ -249,29 +249,58 @@ SLICImageFilter<TInputImage, TOutputImage, TDistancePixel>
 
     InputConstIteratorType inputIter(inputImage, localRegion);
     DistanceIteratorType   distanceIter(m_DistanceImage, localRegion);
+    OutputIteratorType     outputIter(outputImage, localRegion);
 
+    const double lineStart = localRegion.GetIndex(0);
 
     while ( !inputIter.IsAtEnd() )
       {
+      const IndexType &lineIdx = inputIter.GetIndex();
+
+      // The spatial terms of the distance are constant along a
+      // scanline for all but the fastest moving dimension, so they are
+      // evaluated once per line and only the squared color difference
+      // and the scanline term remain in the pixel loop.
+      DistanceType lineSpatialDistance[ImageDimension];
+      for (unsigned int j = 1; j < ImageDimension; ++j)
+        {
+        const DistanceType d = (cluster[numberOfComponents+j] - lineIdx[j]) * m_DistanceScales[j];
+        lineSpatialDistance[j] = d*d;
+        }
+
       for( size_t x = 0; x < ln; ++x )
         {
-        const IndexType &currentIdx = inputIter.GetIndex();
+        const DistanceType dx = (cluster[numberOfComponents] - (lineStart + static_cast<double>(x))) * m_DistanceScales[0];
+        DistanceType d2 = dx*dx;
+        for (unsigned int j = 1; j < ImageDimension; ++j)
+          {
+          d2 += lineSpatialDistance[j];
+          }
 
-        pt = ContinuousIndexType(currentIdx);
-        const double distance = this->Distance(cluster,
-                                               inputIter.Get(),
-                                               pt);
+        // squared distance in the feature (color) space, a short tight
+        // loop over components the compiler can unroll and vectorize
+        const typename NumericTraits<InputPixelType>::MeasurementVectorType &v = inputIter.Get();
+        DistanceType d1 = 0.0;
+        for (unsigned int c = 0; c < numberOfComponents; ++c)
+          {
+          const DistanceType d = (cluster[c] - v[c]);
+          d1 += d*d;
+          }
+
+        const DistanceType distance = d1+d2;
         if (distance < distanceIter.Get() )
           {
           distanceIter.Set(distance);
-          outputImage->SetPixel(currentIdx, i);
+          outputIter.Set(i);
           }
 
         ++distanceIter;
         ++inputIter;
+        ++outputIter;
         }
       inputIter.NextLine();
       distanceIter.NextLine();
+      outputIter.NextLine();
       }
 
     // for neighborhood iterator size S
@@ -768,32 +797,6 @@ SLICImageFilter<TInputImage, TOutputImage, TDistancePixel>
   return d1+d2;
 }
 
-template<typename TInputImage, typename TOutputImage, typename TDistancePixel>
-typename SLICImageFilter<TInputImage, TOutputImage, TDistancePixel>::DistanceType
-SLICImageFilter<TInputImage, TOutputImage, TDistancePixel>
-::Distance(const ClusterType &cluster, const InputPixelType &_v, const PointType &pt)
-{
-  const unsigned int s = cluster.size();
-  DistanceType d1 = 0.0;
-  DistanceType d2 = 0.0;
-  unsigned int i = 0;
-  const typename NumericTraits<InputPixelType>::MeasurementVectorType &v = _v;
-  for (; i<s-ImageDimension; ++i)
-    {
-    const DistanceType d = (cluster[i] - v[i]);
-    d1 += d*d;
-    }
-
-  for (unsigned int j = 0; j < ImageDimension; ++j)
-    {
-    const DistanceType d = (cluster[i] - pt[j]) * m_DistanceScales[j];
-    d2 += d*d;
-    ++i;
-    }
-  return d1+d2;
-}
-
-
 template<typename TInputImage, typename TOutputImage, typename TDistancePixel>
 void
 SLICImageFilter<TInputImage, TOutputImage, TDistancePixel>
@@ -805,28 +808,25 @@ SLICImageFilter<TInputImage, TOutputImage, TDistancePixel>
 
   OutputImageType *outputImage = this->GetOutput();
 
-  ConstantBoundaryCondition< TOutputImage > lbc;
-  lbc.SetConstant( NumericTraits<  typename OutputImageType::PixelType >::max() );
+  // The breadth first fill works directly on the label and marker
+  // buffers with precomputed dimension strides, which avoids relocating
+  // a neighborhood iterator for every visited pixel.  Face neighbors
+  // outside the requested region are skipped, which is equivalent to
+  // the constant out-of-bounds label used by a boundary condition.
+  const typename OutputImageType::RegionType bufferedRegion = outputImage->GetBufferedRegion();
+  const typename OutputImageType::RegionType workRegion = outputImage->GetRequestedRegion();
 
-  itk::Size<ImageDimension> radius;
-  radius.Fill( 1 );
-  unsigned long center;
-  unsigned long stride[ImageDimension];
-
-  typedef NeighborhoodIterator< TOutputImage,  ConstantBoundaryCondition< TOutputImage > > NeighborhoodType;
-
-  NeighborhoodType labelIt( radius, outputImage, outputImage->GetRequestedRegion() );
-  labelIt.OverrideBoundaryCondition(&lbc);
+  OutputPixelType                     *labelBuffer = outputImage->GetBufferPointer();
+  typename MarkerImageType::PixelType *markerBuffer = m_MarkerImage->GetBufferPointer();
 
-  center = labelIt.Size()/2;
+  IndexValueType stride[ImageDimension];
+  IndexValueType s = 1;
   for ( unsigned int j = 0; j < ImageDimension; ++j )
     {
-    stride[j] = labelIt.GetStride(j);
+    stride[j] = s;
+    s *= static_cast<IndexValueType>( bufferedRegion.GetSize(j) );
     }
 
-  using MarkerNeighborhoodType = NeighborhoodIterator<MarkerImageType>;
-  MarkerNeighborhoodType   markerIter(radius, m_MarkerImage, outputImage->GetRequestedRegion() );
-
   indexStack.clear();
   indexStack.push_back(seed);
   m_MarkerImage->SetPixel(seed, 1);
@@ -835,28 +835,42 @@ SLICImageFilter<TInputImage, TOutputImage, TDistancePixel>
   size_t indexStackCount = 0;
   while( indexStackCount < indexStack.size() )
     {
-    const IndexType &idx = indexStack[indexStackCount++];
+    // copy, the vector may reallocate when neighbors are pushed
+    const IndexType idx = indexStack[indexStackCount++];
 
-    markerIter.SetLocation(idx);
-    labelIt.SetLocation(idx);
+    IndexValueType offset = 0;
     for ( unsigned int j = 0; j < ImageDimension; ++j )
       {
-      unsigned int nIdx = center + stride[j];
+      offset += ( idx[j] - bufferedRegion.GetIndex(j) ) * stride[j];
+      }
 
-      if ( markerIter.GetPixel(nIdx) == 0  &&
-           labelIt.GetPixel(nIdx) == requiredLabel )
+    for ( unsigned int j = 0; j < ImageDimension; ++j )
+      {
+      if ( idx[j] + 1 < workRegion.GetIndex(j) + static_cast<IndexValueType>( workRegion.GetSize(j) ) )
         {
-        indexStack.push_back( labelIt.GetIndex(nIdx));
-        markerIter.SetPixel(nIdx, 1);
-        labelIt.SetPixel(nIdx, outputLabel);
+        const IndexValueType nOffset = offset + stride[j];
+        if ( markerBuffer[nOffset] == 0  &&
+             labelBuffer[nOffset] == requiredLabel )
+          {
+          IndexType nIdx = idx;
+          ++nIdx[j];
+          indexStack.push_back( nIdx );
+          markerBuffer[nOffset] = 1;
+          labelBuffer[nOffset] = outputLabel;
+          }
         }
-      nIdx = center - stride[j];
-      if ( markerIter.GetPixel(nIdx) == 0  &&
-           labelIt.GetPixel(nIdx) == requiredLabel )
+      if ( idx[j] - 1 >= workRegion.GetIndex(j) )
         {
-        indexStack.push_back( labelIt.GetIndex(nIdx));
-        markerIter.SetPixel(nIdx, 1);
-        labelIt.SetPixel(nIdx, outputLabel);
+        const IndexValueType nOffset = offset - stride[j];
+        if ( markerBuffer[nOffset] == 0  &&
+             labelBuffer[nOffset] == requiredLabel )
+          {
+          IndexType nIdx = idx;
+          --nIdx[j];
+          indexStack.push_back( nIdx );
+          markerBuffer[nOffset] = 1;
+          labelBuffer[nOffset] = outputLabel;
+          }
         }
       }
     }
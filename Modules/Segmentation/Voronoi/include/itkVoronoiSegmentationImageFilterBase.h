@@ -22,6 +22,9 @@
 #include "itkVoronoiDiagram2DGenerator.h"
 #include "itkImage.h"
 
+#include <map>
+#include <utility>
+
 namespace itk
 {
 /** \class VoronoiSegmentationImageFilterBase
@@ -144,6 +147,17 @@ public:
   itkGetConstMacro(InteractiveSegmentation, bool);
   itkBooleanMacro(InteractiveSegmentation);
 
+  /** Reuse the cell classification between the refinement iterations.
+   * Adding seeds reshapes only the Voronoi cells around the divided
+   * boundary, so cells whose polygon is unchanged keep the pixel
+   * count and homogeneity label of the previous iteration, and only
+   * the new or reshaped cells are classified, in parallel on the
+   * global multi-threader. TestHomogeneity() must then be reentrant,
+   * which holds for the subclasses provided by ITK. Off by default. */
+  itkSetMacro(UseIncrementalClassification, bool);
+  itkGetConstMacro(UseIncrementalClassification, bool);
+  itkBooleanMacro(UseIncrementalClassification);
+
   /** Set/Get the mean deviation. */
   itkSetMacro(MeanDeviation, double);
   itkGetConstMacro(MeanDeviation, double);
@@ -242,6 +256,22 @@ protected:
 
   std::vector< PointType > m_SeedsToAdded;
 
+  /** Classification of one cell from the previous iteration, keyed by
+   * its seed and reused while the cell polygon is unchanged. */
+  struct CellClassificationType
+  {
+    PointTypeDeque m_Polygon;
+    SizeValueType  m_NumberOfPixels;
+    unsigned char  m_Label;
+  };
+
+  using CellClassificationMapType =
+    std::map< std::pair< double, double >, CellClassificationType >;
+
+  bool m_UseIncrementalClassification{false};
+
+  CellClassificationMapType m_CellClassificationCache;
+
   // private methods:
   // Classify all the voronoi cells as interior , exterior or boundary.
   virtual void ClassifyDiagram();
@@ -21,6 +21,7 @@
 #include "itkVoronoiSegmentationImageFilterBase.h"
 
 #include "itkImageRegionIteratorWithIndex.h"
+#include "itkMultiThreaderBase.h"
 #include "itkVoronoiDiagram2DGenerator.h"
 #include <cmath>
 
@@ -62,6 +63,7 @@ VoronoiSegmentationImageFilterBase< TInputImage, TOutputImage, TBinaryPriorImage
   os << indent << "MeanDeviation = " << m_MeanDeviation << std::endl;
   os << indent << "LastStepSeeds = " << m_LastStepSeeds << std::endl;
   os << indent << "InteractiveSegmentation = " << m_InteractiveSegmentation << std::endl;
+  os << indent << "UseIncrementalClassification = " << m_UseIncrementalClassification << std::endl;
   os << indent << "NumberOfSeedsToAdded = " << m_NumberOfSeedsToAdded
      << std::endl;
   os << indent << "Size = " << m_Size << std::endl;
@@ -361,25 +363,81 @@ VoronoiSegmentationImageFilterBase< TInputImage, TOutputImage, TBinaryPriorImage
   PointIdIterator currPit;
   PointIdIterator currPitEnd;
   PointType       currP;
-  PointTypeDeque  VertList;
   IndexList       PixelPool;
 
+  // Collect the cell polygons; when the incremental classification is
+  // enabled, cells whose polygon did not change since the previous
+  // iteration keep their cached pixel count and label
+  std::vector< PointTypeDeque > cellPolygons(m_NumberOfSeeds);
+  std::vector< int >            cellsToClassify;
+
   for ( int i = 0; i < m_NumberOfSeeds; i++ )
     {
     CellAutoPointer currCell;
     m_WorkingVD->GetCellId(i, currCell);
     currPitEnd = currCell->PointIdsEnd();
-    VertList.clear();
+    PointTypeDeque & VertList = cellPolygons[i];
     for ( currPit = currCell->PointIdsBegin(); currPit != currPitEnd; ++currPit )
       {
       m_WorkingVD->GetPoint( ( *currPit ), &( currP ) );
       VertList.push_back(currP);
       }
 
-    PixelPool.clear();
-    this->GetPixelIndexFromPolygon(VertList, &PixelPool);
-    m_NumberOfPixels[i] = static_cast< int >( PixelPool.size() );
-    m_Label[i] = this->TestHomogeneity(PixelPool);
+    if ( m_UseIncrementalClassification )
+      {
+      const PointType seed = m_WorkingVD->GetSeed(i);
+      auto cachedIt = m_CellClassificationCache.find(
+        std::make_pair(seed[0], seed[1]) );
+      if ( cachedIt != m_CellClassificationCache.end()
+           && cachedIt->second.m_Polygon == VertList )
+        {
+        m_NumberOfPixels[i] = cachedIt->second.m_NumberOfPixels;
+        m_Label[i] = cachedIt->second.m_Label;
+        continue;
+        }
+      }
+
+    cellsToClassify.push_back(i);
+    }
+
+  if ( m_UseIncrementalClassification )
+    {
+    // The new and reshaped cells are independent of each other;
+    // classify them as one parallel batch
+    this->GetMultiThreader()->ParallelizeArray( 0, cellsToClassify.size(),
+      [this, &cellsToClassify, &cellPolygons]( SizeValueType job )
+        {
+        const int i = cellsToClassify[job];
+        IndexList pixelPool;
+        this->GetPixelIndexFromPolygon(cellPolygons[i], &pixelPool);
+        this->m_NumberOfPixels[i] = static_cast< int >( pixelPool.size() );
+        this->m_Label[i] = this->TestHomogeneity(pixelPool);
+        },
+      nullptr );
+
+    // Refresh the cache with the raw homogeneity labels, before the
+    // boundary relabeling below
+    m_CellClassificationCache.clear();
+    for ( int i = 0; i < m_NumberOfSeeds; i++ )
+      {
+      const PointType seed = m_WorkingVD->GetSeed(i);
+      CellClassificationType & cached =
+        m_CellClassificationCache[std::make_pair(seed[0], seed[1])];
+      cached.m_Polygon.swap(cellPolygons[i]);
+      cached.m_NumberOfPixels = m_NumberOfPixels[i];
+      cached.m_Label = m_Label[i];
+      }
+    }
+  else
+    {
+    for ( unsigned int job = 0; job < cellsToClassify.size(); job++ )
+      {
+      const int i = cellsToClassify[job];
+      PixelPool.clear();
+      this->GetPixelIndexFromPolygon(cellPolygons[i], &PixelPool);
+      m_NumberOfPixels[i] = static_cast< int >( PixelPool.size() );
+      m_Label[i] = this->TestHomogeneity(PixelPool);
+      }
     }
 
   m_NumberOfBoundary = 0;
@@ -541,6 +599,10 @@ VoronoiSegmentationImageFilterBase< TInputImage, TOutputImage, TBinaryPriorImage
   m_VDGenerator->SetBoundary(VDsize);
   m_VDGenerator->SetRandomSeeds(m_NumberOfSeeds);
 
+  // A cached classification from a previous run does not apply to the
+  // new input or seeds
+  m_CellClassificationCache.clear();
+
   this->RunSegment();
   if ( m_OutputBoundary )
     {
@@ -0,0 +1,272 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkHierarchicalQueue_h
+#define itkHierarchicalQueue_h
+
+#include "itkIntTypes.h"
+#include "itkNumericTraits.h"
+
+#include <map>
+#include <type_traits>
+#include <vector>
+
+namespace itk
+{
+/** \class HierarchicalQueueStorage
+ * \brief Pooled node storage shared by the hierarchical queue variants.
+ *
+ * The queue elements live in a single contiguous vector of nodes linked
+ * by indices, and popped nodes are recycled through a free list.  Once
+ * the high-water mark of the queue has been reached, pushing an element
+ * therefore performs no allocation at all, unlike the per-element
+ * allocations of a std::queue of per-priority queues.
+ *
+ * \ingroup WatershedSegmentation
+ * \ingroup ITKWatersheds
+ */
+template< typename TElement >
+class HierarchicalQueueStorage
+{
+public:
+  static constexpr SizeValueType NilIndex = NumericTraits< SizeValueType >::max();
+
+protected:
+  struct NodeType {
+    TElement Element;
+    SizeValueType Next;
+  };
+
+  /** The head and tail node of the singly linked list of elements that
+   * share a priority level. */
+  struct LevelType {
+    SizeValueType Head;
+    SizeValueType Tail;
+  };
+
+  SizeValueType AllocateNode(const TElement & element)
+  {
+    SizeValueType node;
+    if ( m_FirstFreeNode != NilIndex )
+      {
+      node = m_FirstFreeNode;
+      m_FirstFreeNode = m_Pool[node].Next;
+      m_Pool[node].Element = element;
+      m_Pool[node].Next = NilIndex;
+      }
+    else
+      {
+      node = static_cast< SizeValueType >( m_Pool.size() );
+      m_Pool.push_back( { element, NilIndex } );
+      }
+    return node;
+  }
+
+  void ReleaseNode(SizeValueType node)
+  {
+    m_Pool[node].Next = m_FirstFreeNode;
+    m_FirstFreeNode = node;
+  }
+
+  void AppendNode(LevelType & level, SizeValueType node)
+  {
+    if ( level.Head == NilIndex )
+      {
+      level.Head = node;
+      }
+    else
+      {
+      m_Pool[level.Tail].Next = node;
+      }
+    level.Tail = node;
+  }
+
+  std::vector< NodeType > m_Pool;
+
+  SizeValueType m_FirstFreeNode{NilIndex};
+};
+
+/** \class MappedHierarchicalQueue
+ * \brief A first-in first-out queue ordered by a priority value, with the
+ * priority levels kept in a sorted map.
+ *
+ * Front() returns the oldest element with the smallest priority value
+ * present in the queue.  This variant places no requirement on the value
+ * type beyond strict weak ordering and is used when the value type does
+ * not permit direct bucket indexing.
+ *
+ * \ingroup WatershedSegmentation
+ * \ingroup ITKWatersheds
+ */
+template< typename TValue, typename TElement >
+class MappedHierarchicalQueue:
+  public HierarchicalQueueStorage< TElement >
+{
+public:
+  using StorageType = HierarchicalQueueStorage< TElement >;
+  using typename StorageType::LevelType;
+
+  void Push(const TValue & value, const TElement & element)
+  {
+    const SizeValueType node = this->AllocateNode(element);
+    auto inserted =
+      m_Levels.insert( { value, LevelType{ StorageType::NilIndex,
+                                           StorageType::NilIndex } } );
+    this->AppendNode(inserted.first->second, node);
+    ++m_Size;
+  }
+
+  bool Empty() const { return m_Size == 0; }
+
+  SizeValueType Size() const { return m_Size; }
+
+  /** The smallest priority value present in the queue.  The queue must
+   * not be empty. */
+  TValue FrontValue() const { return m_Levels.begin()->first; }
+
+  const TElement & Front() const
+  {
+    return this->m_Pool[m_Levels.begin()->second.Head].Element;
+  }
+
+  void Pop()
+  {
+    auto levelIterator = m_Levels.begin();
+    const SizeValueType node = levelIterator->second.Head;
+    levelIterator->second.Head = this->m_Pool[node].Next;
+    if ( levelIterator->second.Head == StorageType::NilIndex )
+      {
+      m_Levels.erase(levelIterator);
+      }
+    this->ReleaseNode(node);
+    --m_Size;
+  }
+
+private:
+  std::map< TValue, LevelType > m_Levels;
+
+  SizeValueType m_Size{0};
+};
+
+/** \class BucketedHierarchicalQueue
+ * \brief A first-in first-out queue ordered by a priority value, with one
+ * directly indexed bucket per possible value.
+ *
+ * The value type must be an integral type small enough that a bucket per
+ * representable value is affordable; with 16 bits this is one megabyte
+ * of bucket headers.  Push, Front and Pop are then constant time
+ * operations: the current level cursor moves backward only when a
+ * smaller value is pushed and forward only past drained buckets, so the
+ * scan over the buckets is amortized over the run of the queue.
+ *
+ * \ingroup WatershedSegmentation
+ * \ingroup ITKWatersheds
+ */
+template< typename TValue, typename TElement >
+class BucketedHierarchicalQueue:
+  public HierarchicalQueueStorage< TElement >
+{
+public:
+  using StorageType = HierarchicalQueueStorage< TElement >;
+  using typename StorageType::LevelType;
+
+  static_assert( std::is_integral< TValue >::value && sizeof( TValue ) <= 2,
+                 "Direct bucket indexing requires a small integral value type." );
+
+  BucketedHierarchicalQueue()
+  {
+    const auto numberOfLevels = static_cast< size_t >(
+      static_cast< IndexValueType >( NumericTraits< TValue >::max() )
+      - static_cast< IndexValueType >( NumericTraits< TValue >::NonpositiveMin() )
+      + 1 );
+    m_Levels.resize( numberOfLevels,
+                     LevelType{ StorageType::NilIndex, StorageType::NilIndex } );
+  }
+
+  void Push(const TValue & value, const TElement & element)
+  {
+    const size_t level = LevelOfValue(value);
+    const SizeValueType node = this->AllocateNode(element);
+    this->AppendNode(m_Levels[level], node);
+    if ( m_Size == 0 || level < m_CurrentLevel )
+      {
+      m_CurrentLevel = level;
+      }
+    ++m_Size;
+  }
+
+  bool Empty() const { return m_Size == 0; }
+
+  SizeValueType Size() const { return m_Size; }
+
+  /** The smallest priority value present in the queue.  The queue must
+   * not be empty. */
+  TValue FrontValue() const
+  {
+    return static_cast< TValue >(
+      static_cast< IndexValueType >( m_CurrentLevel )
+      + static_cast< IndexValueType >( NumericTraits< TValue >::NonpositiveMin() ) );
+  }
+
+  const TElement & Front() const
+  {
+    return this->m_Pool[m_Levels[m_CurrentLevel].Head].Element;
+  }
+
+  void Pop()
+  {
+    LevelType & level = m_Levels[m_CurrentLevel];
+    const SizeValueType node = level.Head;
+    level.Head = this->m_Pool[node].Next;
+    this->ReleaseNode(node);
+    --m_Size;
+    if ( m_Size > 0 )
+      {
+      while ( m_Levels[m_CurrentLevel].Head == StorageType::NilIndex )
+        {
+        ++m_CurrentLevel;
+        }
+      }
+  }
+
+private:
+  static size_t LevelOfValue(const TValue & value)
+  {
+    return static_cast< size_t >(
+      static_cast< IndexValueType >( value )
+      - static_cast< IndexValueType >( NumericTraits< TValue >::NonpositiveMin() ) );
+  }
+
+  std::vector< LevelType > m_Levels;
+
+  size_t m_CurrentLevel{0};
+
+  SizeValueType m_Size{0};
+};
+
+/** The hierarchical queue type appropriate for a priority value type:
+ * directly indexed buckets for 8 and 16 bit integral values, a sorted
+ * map of levels for everything else. */
+template< typename TValue, typename TElement >
+using HierarchicalQueue = typename std::conditional<
+  std::is_integral< TValue >::value && sizeof( TValue ) <= 2,
+  BucketedHierarchicalQueue< TValue, TElement >,
+  MappedHierarchicalQueue< TValue, TElement > >::type;
+
+} // end namespace itk
+
+#endif
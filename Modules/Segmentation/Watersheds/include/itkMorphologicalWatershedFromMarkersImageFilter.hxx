@@ -19,9 +19,8 @@
 #define itkMorphologicalWatershedFromMarkersImageFilter_hxx
 
 #include <algorithm>
-#include <queue>
-#include <list>
 #include "itkMorphologicalWatershedFromMarkersImageFilter.h"
+#include "itkHierarchicalQueue.h"
 #include "itkProgressReporter.h"
 #include "itkImageRegionIterator.h"
 #include "itkImageRegionConstIteratorWithIndex.h"
@@ -120,9 +119,11 @@ MorphologicalWatershedFromMarkersImageFilter< TInputImage, TLabelImage >
     }
 
   // FAH (in french: File d'Attente Hierarchique)
-  using QueueType = std::queue< IndexType >;
-  using MapType = std::map< InputImagePixelType, QueueType >;
-  MapType fah;
+  // For 8 and 16 bit pixel types this selects the bucket-indexed variant,
+  // which floods in constant time per queue operation without allocating
+  // per element.
+  using QueueType = HierarchicalQueue< InputImagePixelType, IndexType >;
+  QueueType fah;
 
   // the radius which will be used for all the shaped iterators
   Size< ImageDimension > radius;
@@ -227,7 +228,7 @@ MorphologicalWatershedFromMarkersImageFilter< TInputImage, TLabelImage >
             {
             // this neighbor is a background pixel and is not already
             // processed; add its index to fah
-            fah[niIt.Get()].push( markerIt.GetIndex()
+            fah.Push( niIt.Get(), markerIt.GetIndex()
                                   + nmIt.GetNeighborhoodOffset() );
             // mark it as already in the fah to avoid adding it several times
             nsIt.Set(true);
@@ -258,74 +259,69 @@ MorphologicalWatershedFromMarkersImageFilter< TInputImage, TLabelImage >
     inputIt.GoToBegin();
 
     // and start flooding
-    while ( !fah.empty() )
+    while ( !fah.Empty() )
       {
       // store the current vars
-      InputImagePixelType currentValue = fah.begin()->first;
-      QueueType           currentQueue = fah.begin()->second;
-      // and remove them from the fah
-      fah.erase( fah.begin() );
-
-      while ( !currentQueue.empty() )
+      InputImagePixelType currentValue = fah.FrontValue();
+      IndexType idx = fah.Front();
+      // and remove the pixel from the fah
+      fah.Pop();
+
+      // move the iterators to the right place
+      OffsetType shift = idx - outputIt.GetIndex();
+      outputIt += shift;
+      statusIt += shift;
+      inputIt += shift;
+
+      // iterate over the neighbors. If there is only one marker value, give
+      // that value to the pixel, else keep it as is (watershed line)
+      LabelImagePixelType marker = wsLabel;
+      bool                collision = false;
+      for ( noIt = outputIt.Begin(); noIt != outputIt.End(); noIt++ )
         {
-        IndexType idx = currentQueue.front();
-        currentQueue.pop();
-
-        // move the iterators to the right place
-        OffsetType shift = idx - outputIt.GetIndex();
-        outputIt += shift;
-        statusIt += shift;
-        inputIt += shift;
-
-        // iterate over the neighbors. If there is only one marker value, give
-        // that value to the pixel, else keep it as is (watershed line)
-        LabelImagePixelType marker = wsLabel;
-        bool                collision = false;
-        for ( noIt = outputIt.Begin(); noIt != outputIt.End(); noIt++ )
+        LabelImagePixelType o = noIt.Get();
+        if ( o != wsLabel )
           {
-          LabelImagePixelType o = noIt.Get();
-          if ( o != wsLabel )
+          if ( marker != wsLabel && o != marker )
             {
-            if ( marker != wsLabel && o != marker )
-              {
-              collision = true;
-              break;
-              }
-            else
-                  { marker = o; }
+            collision = true;
+            break;
             }
+          else
+                { marker = o; }
           }
-        if ( !collision )
+        }
+      if ( !collision )
+        {
+        // set the marker value
+        outputIt.SetCenterPixel(marker);
+        // and propagate to the neighbors
+        for ( niIt = inputIt.Begin(), nsIt = statusIt.Begin();
+              niIt != inputIt.End();
+              niIt++, nsIt++ )
           {
-          // set the marker value
-          outputIt.SetCenterPixel(marker);
-          // and propagate to the neighbors
-          for ( niIt = inputIt.Begin(), nsIt = statusIt.Begin();
-                niIt != inputIt.End();
-                niIt++, nsIt++ )
+          if ( !nsIt.Get() )
             {
-            if ( !nsIt.Get() )
+            // the pixel is not yet processed. add it to the fah, at the
+            // current level if its own level has already been flooded
+            InputImagePixelType GrayVal = niIt.Get();
+            if ( GrayVal <= currentValue )
               {
-              // the pixel is not yet processed. add it to the fah
-              InputImagePixelType GrayVal = niIt.Get();
-              if ( GrayVal <= currentValue )
-                {
-                currentQueue.push( inputIt.GetIndex()
-                                   + niIt.GetNeighborhoodOffset() );
-                }
-              else
-                {
-                fah[GrayVal].push( inputIt.GetIndex()
-                                   + niIt.GetNeighborhoodOffset() );
-                }
-              // mark it as already in the fah
-              nsIt.Set(true);
+              fah.Push( currentValue, inputIt.GetIndex()
+                                      + niIt.GetNeighborhoodOffset() );
               }
+            else
+              {
+              fah.Push( GrayVal, inputIt.GetIndex()
+                                 + niIt.GetNeighborhoodOffset() );
+              }
+            // mark it as already in the fah
+            nsIt.Set(true);
             }
           }
-        // one more pixel in the flooding stage
-        progress.CompletedPixel();
         }
+      // one more pixel in the flooding stage
+      progress.CompletedPixel();
       }
     }
 
@@ -372,7 +368,7 @@ MorphologicalWatershedFromMarkersImageFilter< TInputImage, TLabelImage >
         if ( haveBgNeighbor )
           {
           // there is a background pixel in the neighborhood; add to fah
-          fah[inputIt.GetCenterPixel()].push( markerIt.GetIndex() );
+          fah.Push( inputIt.GetCenterPixel(), markerIt.GetIndex() );
           }
         else
           {
@@ -395,49 +391,43 @@ MorphologicalWatershedFromMarkersImageFilter< TInputImage, TLabelImage >
     inputIt.GoToBegin();
 
     // and start flooding
-    while ( !fah.empty() )
+    while ( !fah.Empty() )
       {
       // store the current vars
-      InputImagePixelType currentValue = fah.begin()->first;
-      QueueType           currentQueue = fah.begin()->second;
-      // and remove them from the fah
-      fah.erase( fah.begin() );
-
-      while ( !currentQueue.empty() )
+      InputImagePixelType currentValue = fah.FrontValue();
+      IndexType idx = fah.Front();
+      // and remove the pixel from the fah
+      fah.Pop();
+
+      // move the iterators to the right place
+      OffsetType shift = idx - outputIt.GetIndex();
+      outputIt += shift;
+      inputIt += shift;
+
+      LabelImagePixelType currentMarker = outputIt.GetCenterPixel();
+      // get the current value of the pixel
+      // iterate over neighbors to propagate the marker
+      for ( noIt = outputIt.Begin(), niIt = inputIt.Begin();
+            noIt != outputIt.End();
+            noIt++, niIt++ )
         {
-        IndexType idx = currentQueue.front();
-        currentQueue.pop();
-
-        // move the iterators to the right place
-        OffsetType shift = idx - outputIt.GetIndex();
-        outputIt += shift;
-        inputIt += shift;
-
-        LabelImagePixelType currentMarker = outputIt.GetCenterPixel();
-        // get the current value of the pixel
-        // iterate over neighbors to propagate the marker
-        for ( noIt = outputIt.Begin(), niIt = inputIt.Begin();
-              noIt != outputIt.End();
-              noIt++, niIt++ )
+        if ( noIt.Get() == wsLabel )
           {
-          if ( noIt.Get() == wsLabel )
+          // the pixel is not yet processed. It can be labeled with the
+          // current label
+          noIt.Set(currentMarker);
+          InputImagePixelType GrayVal = niIt.Get();
+          if ( GrayVal <= currentValue )
             {
-            // the pixel is not yet processed. It can be labeled with the
-            // current label
-            noIt.Set(currentMarker);
-            InputImagePixelType GrayVal = niIt.Get();
-            if ( GrayVal <= currentValue )
-              {
-              currentQueue.push( inputIt.GetIndex()
-                                 + noIt.GetNeighborhoodOffset() );
-              }
-            else
-              {
-              fah[GrayVal].push( inputIt.GetIndex()
-                                 + noIt.GetNeighborhoodOffset() );
-              }
-            progress.CompletedPixel();
+            fah.Push( currentValue, inputIt.GetIndex()
+                                    + noIt.GetNeighborhoodOffset() );
+            }
+          else
+            {
+            fah.Push( GrayVal, inputIt.GetIndex()
+                               + noIt.GetNeighborhoodOffset() );
             }
+          progress.CompletedPixel();
           }
         }
       }
@@ -0,0 +1,213 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkTiledWatershedImageFilter_h
+#define itkTiledWatershedImageFilter_h
+
+#include "itkImageToImageFilter.h"
+#include "itkWatershedSegmenter.h"
+#include "itkWatershedBoundaryResolver.h"
+#include "itkWatershedSegmentTreeGenerator.h"
+#include "itkWatershedEquivalenceRelabeler.h"
+#include "itkWatershedRelabeler.h"
+
+namespace itk
+{
+/** \class TiledWatershedImageFilter
+ * \brief A tile-wise driver for the watershed segmentation algorithm that
+ * bounds the memory consumed by the initial segmentation stage.
+ *
+ * \par
+ * This filter produces the same style of output as
+ * itk::WatershedImageFilter, but computes the initial segmentation one
+ * tile at a time instead of over the whole image at once.  The
+ * watershed::Segmenter component allocates several temporary images the
+ * size of the region it processes, so running it on a large volume can
+ * require several times the memory of the input.  Here the image is split
+ * into slabs along its slowest axis and the Segmenter is re-executed once
+ * per slab, which caps those temporary allocations at roughly the size of
+ * one slab.
+ *
+ * \par
+ * The component filters in the watershed namespace were designed with
+ * this kind of chunked execution in mind.  Each slab is processed with
+ * boundary analysis enabled, so the Segmenter records, in a
+ * watershed::Boundary object, the labels and gradient flow directions on
+ * the faces a slab shares with its neighbors.  After all slabs have been
+ * segmented, a watershed::BoundaryResolver is run on each pair of
+ * adjacent faces to build an EquivalencyTable of labels that belong to
+ * the same basin but were discovered in different slabs.  The accumulated
+ * segment table and the equivalency table are then handed to the
+ * watershed::SegmentTreeGenerator in its merge mode, so the saliency
+ * (flood level) hierarchy is calculated on the fully merged set of
+ * segments, exactly as it would be for a single-chunk execution.
+ *
+ * \par Inputs and Outputs
+ * The input and output types, as well as the Threshold and Level
+ * parameters, match itk::WatershedImageFilter.  See that class for a
+ * discussion of the parameters and of watershed segmentation terminology
+ * in general.  The NumberOfTiles parameter sets how many slabs the image
+ * is split into; it is reduced automatically when the image is too small
+ * along the split axis to support the requested number.
+ *
+ * \par Caveats
+ * Because the Segmenter computes the dynamic range of each chunk
+ * independently, a nonzero Threshold is applied relative to the per-tile
+ * minimum and maximum rather than the global ones, so thresholded results
+ * can differ slightly from the single-chunk filter.  Unlike
+ * itk::WatershedImageFilter, this filter does not cache its merge tree
+ * between executions: changing the Level triggers a full re-execution
+ * rather than a cheap relabeling.
+ *
+ * \ingroup WatershedSegmentation
+ * \sa WatershedImageFilter
+ * \ingroup ITKWatersheds
+ */
+template< typename TInputImage >
+class ITK_TEMPLATE_EXPORT TiledWatershedImageFilter:
+  public ImageToImageFilter< TInputImage, Image< IdentifierType,
+                                                 TInputImage::ImageDimension > >
+{
+public:
+  ITK_DISALLOW_COPY_AND_ASSIGN(TiledWatershedImageFilter);
+
+  /** Standard "Self" type alias.   */
+  using Self = TiledWatershedImageFilter;
+
+  /** The type of input image.   */
+  using InputImageType = TInputImage;
+
+  /** Dimension of the input and output images. */
+  static constexpr unsigned int ImageDimension = TInputImage::ImageDimension;
+
+  /** The type of output image.   */
+  using OutputImageType = Image< IdentifierType, Self::ImageDimension >;
+
+  /** Other convenient type alias   */
+  using RegionType = typename InputImageType::RegionType;
+  using SizeType = typename InputImageType::SizeType;
+  using IndexType = typename InputImageType::IndexType;
+
+  /** Standard super class type alias support */
+  using Superclass = ImageToImageFilter< InputImageType, OutputImageType >;
+
+  /** Typedef support for the input image scalar value type. */
+  using ScalarType = typename InputImageType::PixelType;
+
+  /** The component filters of the tiled mini-pipeline. */
+  using SegmenterType = watershed::Segmenter< InputImageType >;
+  using BoundaryType = typename SegmenterType::BoundaryType;
+  using BoundaryResolverType = watershed::BoundaryResolver< ScalarType,
+                                                            Self::ImageDimension >;
+  using TreeGeneratorType = watershed::SegmentTreeGenerator< ScalarType >;
+  using EquivalenceRelabelerType = watershed::EquivalenceRelabeler< ScalarType,
+                                                                    Self::ImageDimension >;
+  using RelabelerType = watershed::Relabeler< ScalarType, Self::ImageDimension >;
+
+  /** Smart pointer type alias support  */
+  using Pointer = SmartPointer< Self >;
+
+  /** Run-time type information (and related methods) */
+  itkTypeMacro(TiledWatershedImageFilter, ImageToImageFilter);
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Standard process object method.  This filter is not multithreaded. */
+  void GenerateData() override;
+
+  /** Set/Get the input thresholding parameter.  Units are a percentage of
+   * the maximum depth in the image. */
+  void SetThreshold(double);
+
+  itkGetConstMacro(Threshold, double);
+
+  /** Set/Get the flood level for generating the merge tree from the initial
+   * segmentation   */
+  void SetLevel(double);
+
+  itkGetConstMacro(Level, double);
+
+  /** Set/Get the number of slabs the input is split into.  The image is
+   * divided along its slowest axis.  The value is clamped during execution
+   * so that each slab spans at least two pixels along that axis. */
+  itkSetClampMacro(NumberOfTiles, unsigned int, 1,
+                   NumericTraits< unsigned int >::max());
+  itkGetConstMacro(NumberOfTiles, unsigned int);
+
+  /** Get the segmentation tree from the TreeGenerator member filter. */
+  typename TreeGeneratorType::SegmentTreeType *
+  GetSegmentTree()
+  {
+    return m_TreeGenerator->GetOutputSegmentTree();
+  }
+
+  // Override since the filter produces all of its output
+  void EnlargeOutputRequestedRegion(DataObject *data) override;
+
+#ifdef ITK_USE_CONCEPT_CHECKING
+  // Begin concept checking
+  itkConceptMacro( InputEqualityComparableCheck,
+                   ( Concept::EqualityComparable< ScalarType > ) );
+  itkConceptMacro( InputAdditiveOperatorsCheck,
+                   ( Concept::AdditiveOperators< ScalarType > ) );
+  itkConceptMacro( DoubleInputMultiplyOperatorCheck,
+                   ( Concept::MultiplyOperator< double, ScalarType, ScalarType > ) );
+  itkConceptMacro( InputLessThanComparableCheck,
+                   ( Concept::LessThanComparable< ScalarType > ) );
+  // End concept checking
+#endif
+
+protected:
+  TiledWatershedImageFilter();
+  ~TiledWatershedImageFilter() override = default;
+  void PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  /** A Percentage of the maximum depth (max - min pixel value) in the input
+   *  image.  This percentage will be used to threshold the minimum values in
+   *  the image. */
+  double m_Threshold{0.0};
+
+  /** The percentage of the maximum saliency value among adjacencies in the
+   *  segments of the initial segmentation to which "flooding" of the image
+   *  should occur.  A tree of segment merges is calculated up to this
+   *  level. */
+  double m_Level{0.0};
+
+  /** The number of slabs the input is divided into along its slowest
+   *  axis. */
+  unsigned int m_NumberOfTiles{4};
+
+  /** The component parts of the segmentation algorithm.  The Segmenter is
+   * re-executed once per slab and accumulates the segment table and label
+   * range across those executions. */
+  typename SegmenterType::Pointer m_Segmenter;
+
+  typename TreeGeneratorType::Pointer m_TreeGenerator;
+
+  typename EquivalenceRelabelerType::Pointer m_EquivalenceRelabeler;
+
+  typename RelabelerType::Pointer m_Relabeler;
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#include "itkTiledWatershedImageFilter.hxx"
+#endif
+
+#endif
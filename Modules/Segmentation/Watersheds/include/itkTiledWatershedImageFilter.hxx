@@ -0,0 +1,249 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkTiledWatershedImageFilter_hxx
+#define itkTiledWatershedImageFilter_hxx
+
+#include "itkTiledWatershedImageFilter.h"
+#include "itkImageAlgorithm.h"
+
+namespace itk
+{
+template< typename TInputImage >
+TiledWatershedImageFilter< TInputImage >
+::TiledWatershedImageFilter()
+{
+  // Set up the component filters.  The Segmenter runs with boundary
+  // analysis turned on so that it accumulates its segment table and label
+  // range across the per-tile executions, and the tree generator runs in
+  // merge mode so the cross-tile label equivalencies are folded into the
+  // segment table before the merge hierarchy is extracted.
+  m_Segmenter = SegmenterType::New();
+  m_TreeGenerator = TreeGeneratorType::New();
+  m_EquivalenceRelabeler = EquivalenceRelabelerType::New();
+  m_Relabeler = RelabelerType::New();
+
+  m_Segmenter->SetDoBoundaryAnalysis(true);
+  m_Segmenter->SetSortEdgeLists(true);
+  m_Segmenter->SetThreshold( this->GetThreshold() );
+
+  m_TreeGenerator->SetInputSegmentTable( m_Segmenter->GetSegmentTable() );
+  m_TreeGenerator->SetMerge(true);
+  m_TreeGenerator->SetFloodLevel( this->GetLevel() );
+
+  m_Relabeler->SetInputSegmentTree( m_TreeGenerator->GetOutputSegmentTree() );
+  m_Relabeler->SetInputImage( m_EquivalenceRelabeler->GetOutputImage() );
+  m_Relabeler->SetFloodLevel( this->GetLevel() );
+}
+
+template< typename TInputImage >
+void
+TiledWatershedImageFilter< TInputImage >
+::SetThreshold(double val)
+{
+  if ( val < 0.0 )
+    {
+    val = 0.0;
+    }
+  else if ( val > 1.0 )
+    {
+    val = 1.0;
+    }
+
+CLANG_PRAGMA_PUSH
+CLANG_SUPPRESS_Wfloat_equal
+  if ( val != m_Threshold )
+CLANG_PRAGMA_POP
+    {
+    m_Threshold = val;
+    m_Segmenter->SetThreshold(m_Threshold);
+    this->Modified();
+    }
+}
+
+template< typename TInputImage >
+void
+TiledWatershedImageFilter< TInputImage >
+::SetLevel(double val)
+{
+  if ( val < 0.0 )
+    {
+    val = 0.0;
+    }
+  else if ( val > 1.0 )
+    {
+    val = 1.0;
+    }
+
+CLANG_PRAGMA_PUSH
+CLANG_SUPPRESS_Wfloat_equal
+  if ( val != m_Level )
+CLANG_PRAGMA_POP
+    {
+    m_Level = val;
+    m_TreeGenerator->SetFloodLevel(m_Level);
+    m_Relabeler->SetFloodLevel(m_Level);
+    this->Modified();
+    }
+}
+
+template< typename TInputImage >
+void
+TiledWatershedImageFilter< TInputImage >
+::EnlargeOutputRequestedRegion(DataObject *data)
+{
+  Superclass::EnlargeOutputRequestedRegion(data);
+  data->SetRequestedRegionToLargestPossibleRegion();
+}
+
+template< typename TInputImage >
+void
+TiledWatershedImageFilter< TInputImage >
+::GenerateData()
+{
+  using SegmentationImageType = typename SegmenterType::OutputImageType;
+
+  typename InputImageType::Pointer input =
+    const_cast< InputImageType * >( this->GetInput() );
+  const RegionType fullRegion = input->GetLargestPossibleRegion();
+
+  // Decide how to slice the image into slabs.  The split is along the
+  // slowest axis, and the number of slabs is reduced if necessary so that
+  // each slab spans at least two pixels along that axis.
+  constexpr unsigned int splitAxis = ImageDimension - 1;
+  const SizeValueType axisSize = fullRegion.GetSize(splitAxis);
+  auto numberOfTiles = static_cast< SizeValueType >( m_NumberOfTiles );
+  if ( numberOfTiles > axisSize / 2 )
+    {
+    numberOfTiles = ( axisSize / 2 > 0 ) ? axisSize / 2 : 1;
+    }
+  const SizeValueType tileSize = axisSize / numberOfTiles;
+
+  // Reset the per-execution state of the Segmenter.  With boundary
+  // analysis enabled the Segmenter never clears its own segment table or
+  // label counter, which is exactly what lets them accumulate over the
+  // tile loop below, but it also means stale results from a previous
+  // execution of this filter must be discarded here.
+  m_Segmenter->SetInputImage(input);
+  m_Segmenter->SetLargestPossibleRegion(fullRegion);
+  m_Segmenter->GetSegmentTable()->Clear();
+  m_Segmenter->SetCurrentLabel(1);
+
+  // A free-standing image that collects the per-tile basic segmentations.
+  typename SegmentationImageType::Pointer basicSegmentation =
+    SegmentationImageType::New();
+  basicSegmentation->SetRegions(fullRegion);
+  basicSegmentation->Allocate();
+
+  //
+  // Phase one: run the watershed segmentation on each slab.  The region
+  // handed to the Segmenter is the slab padded out one pixel into each
+  // neighboring slab, which is the overlap its boundary analysis expects.
+  // The Boundary object of each run is kept for the resolution phase.
+  //
+  std::vector< typename BoundaryType::Pointer > boundaries(numberOfTiles);
+
+  for ( SizeValueType tile = 0; tile < numberOfTiles; ++tile )
+    {
+    RegionType coreRegion = fullRegion;
+    IndexType coreIndex = coreRegion.GetIndex();
+    SizeType coreSize  = coreRegion.GetSize();
+    coreIndex[splitAxis] += static_cast< IndexValueType >( tile * tileSize );
+    coreSize[splitAxis] = ( tile == numberOfTiles - 1 ) ?
+      axisSize - tile * tileSize : tileSize;
+    coreRegion.SetIndex(coreIndex);
+    coreRegion.SetSize(coreSize);
+
+    RegionType paddedRegion = coreRegion;
+    IndexType paddedIndex = paddedRegion.GetIndex();
+    SizeType paddedSize  = paddedRegion.GetSize();
+    if ( tile > 0 )
+      {
+      paddedIndex[splitAxis] -= 1;
+      paddedSize[splitAxis] += 1;
+      }
+    if ( tile < numberOfTiles - 1 )
+      {
+      paddedSize[splitAxis] += 1;
+      }
+    paddedRegion.SetIndex(paddedIndex);
+    paddedRegion.SetSize(paddedSize);
+
+    boundaries[tile] = BoundaryType::New();
+    m_Segmenter->SetBoundary( boundaries[tile] );
+    m_Segmenter->GetOutputImage()->SetRequestedRegion(paddedRegion);
+    m_Segmenter->Modified();
+    m_Segmenter->GetOutputImage()->Update();
+
+    ImageAlgorithm::Copy( m_Segmenter->GetOutputImage(),
+                          basicSegmentation.GetPointer(),
+                          coreRegion, coreRegion );
+
+    this->UpdateProgress( static_cast< float >( tile + 1 )
+                          / static_cast< float >( numberOfTiles + 1 ) );
+    }
+
+  //
+  // Phase two: resolve the labels across each pair of adjacent slab
+  // faces.  Each resolver appends its equivalencies to the same table,
+  // which afterward relates every pair of labels that belong to a basin
+  // spanning a slab boundary.
+  //
+  EquivalencyTable::Pointer equivalencyTable = EquivalencyTable::New();
+  for ( SizeValueType tile = 0; tile + 1 < numberOfTiles; ++tile )
+    {
+    typename BoundaryResolverType::Pointer resolver =
+      BoundaryResolverType::New();
+    resolver->SetBoundaryA( boundaries[tile] );
+    resolver->SetBoundaryB( boundaries[tile + 1] );
+    resolver->SetFace( static_cast< unsigned short >( splitAxis ) );
+    resolver->SetEquivalencyTable(equivalencyTable);
+    resolver->Update();
+    }
+  equivalencyTable->DisconnectPipeline();
+
+  //
+  // Phase three: generate the merge hierarchy from the accumulated
+  // segment table, pre-merging the segments joined across slab
+  // boundaries, and relabel the assembled initial segmentation up to the
+  // requested flood level.
+  //
+  m_TreeGenerator->SetInputEquivalencyTable(equivalencyTable);
+
+  m_EquivalenceRelabeler->SetInputImage(basicSegmentation);
+  m_EquivalenceRelabeler->SetEquivalencyTable(equivalencyTable);
+
+  m_Relabeler->GraftOutput( this->GetOutput() );
+  m_Relabeler->Update();
+  this->GraftOutput( m_Relabeler->GetOutputImage() );
+
+  this->UpdateProgress(1.0);
+}
+
+template< typename TInputImage >
+void
+TiledWatershedImageFilter< TInputImage >
+::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+  os << indent << "Threshold: " << m_Threshold << std::endl;
+  os << indent << "Level: " << m_Level << std::endl;
+  os << indent << "NumberOfTiles: " << m_NumberOfTiles << std::endl;
+}
+} // end namespace itk
+
+#endif
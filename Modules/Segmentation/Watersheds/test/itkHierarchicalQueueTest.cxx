@@ -0,0 +1,136 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkHierarchicalQueue.h"
+
+#include <iostream>
+#include <queue>
+#include <map>
+
+namespace
+{
+// Compare a hierarchical queue against the std::map of std::queue
+// structure it replaces, on the same mixed sequence of operations.
+template< typename TQueue, typename TValue >
+bool RunSequence( const char * name )
+{
+  TQueue queue;
+
+  std::map< TValue, std::queue< int > > reference;
+  int referenceSize = 0;
+
+  if ( !queue.Empty() || queue.Size() != 0 )
+    {
+    std::cerr << name << ": a default constructed queue is not empty."
+              << std::endl;
+    return false;
+    }
+
+  // a deterministic scattering of priorities, including duplicates
+  int element = 0;
+  auto push = [&]( TValue value )
+    {
+    queue.Push( value, element );
+    reference[value].push( element );
+    ++element;
+    ++referenceSize;
+    };
+
+  auto checkAndPop = [&]() -> bool
+    {
+    const TValue referenceValue = reference.begin()->first;
+    const int referenceElement = reference.begin()->second.front();
+    if ( queue.FrontValue() != referenceValue
+         || queue.Front() != referenceElement )
+      {
+      std::cerr << name << ": expected (" << referenceValue << ", "
+                << referenceElement << "), got (" << queue.FrontValue()
+                << ", " << queue.Front() << ")" << std::endl;
+      return false;
+      }
+    queue.Pop();
+    reference.begin()->second.pop();
+    if ( reference.begin()->second.empty() )
+      {
+      reference.erase( reference.begin() );
+      }
+    --referenceSize;
+    return true;
+    };
+
+  for ( int value : { 7, 3, 3, 12, 0, 7, 120, 3 } )
+    {
+    push( static_cast< TValue >( value ) );
+    }
+
+  // drain part of the queue, then push below, at, and above the front to
+  // exercise the level cursor and the node pool reuse
+  for ( int i = 0; i < 4; ++i )
+    {
+    if ( !checkAndPop() )
+      {
+      return false;
+      }
+    }
+  for ( int value : { 2, 7, 100, 7 } )
+    {
+    push( static_cast< TValue >( value ) );
+    }
+
+  while ( !queue.Empty() )
+    {
+    if ( !checkAndPop() )
+      {
+      return false;
+      }
+    }
+
+  if ( referenceSize != 0 )
+    {
+    std::cerr << name << ": the queue ran out of elements early."
+              << std::endl;
+    return false;
+    }
+
+  return true;
+}
+} // end anonymous namespace
+
+int itkHierarchicalQueueTest( int, char* [] )
+{
+  bool success = true;
+
+  // the bucket-indexed variants used for 8 and 16 bit pixel types
+  success &= RunSequence< itk::HierarchicalQueue< unsigned char, int >,
+                          unsigned char >( "HierarchicalQueue<unsigned char>" );
+  success &= RunSequence< itk::HierarchicalQueue< short, int >,
+                          short >( "HierarchicalQueue<short>" );
+
+  // the sorted map variant used for everything else
+  success &= RunSequence< itk::HierarchicalQueue< float, int >,
+                          float >( "HierarchicalQueue<float>" );
+
+  if ( !success )
+    {
+    std::cerr << "Test failed!" << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
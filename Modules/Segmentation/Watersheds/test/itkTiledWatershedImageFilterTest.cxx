@@ -0,0 +1,140 @@
+/*=========================================================================
+ *
+ *  Copyright Insight Software Consortium
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkTiledWatershedImageFilter.h"
+#include "itkWatershedImageFilter.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkTestingMacros.h"
+
+#include <map>
+
+int itkTiledWatershedImageFilterTest( int, char* [] )
+{
+  constexpr unsigned int Dimension = 2;
+
+  using PixelType = float;
+  using ImageType = itk::Image< PixelType, Dimension >;
+  using LabeledImageType = itk::Image< itk::IdentifierType, Dimension >;
+
+  // A smooth synthetic input with several well separated basins.
+  ImageType::SizeType size;
+  size.Fill( 64 );
+
+  ImageType::RegionType region;
+  region.SetSize( size );
+
+  ImageType::Pointer image = ImageType::New();
+  image->SetRegions( region );
+  image->Allocate();
+
+  itk::ImageRegionIteratorWithIndex< ImageType > it( image, region );
+  for ( ; !it.IsAtEnd(); ++it )
+    {
+    const double x = static_cast< double >( it.GetIndex()[0] ) / 10.0;
+    const double y = static_cast< double >( it.GetIndex()[1] ) / 10.0;
+    it.Value() = static_cast< PixelType >( std::sin( x ) * std::sin( y )
+                                           + 0.01 * ( x + y ) );
+    }
+
+  using TiledFilterType = itk::TiledWatershedImageFilter< ImageType >;
+  TiledFilterType::Pointer tiledFilter = TiledFilterType::New();
+
+  EXERCISE_BASIC_OBJECT_METHODS( tiledFilter, TiledWatershedImageFilter,
+    ImageToImageFilter );
+
+  double threshold = 0.0;
+  tiledFilter->SetThreshold( threshold );
+  TEST_SET_GET_VALUE( threshold, tiledFilter->GetThreshold() );
+
+  double level = 0.1;
+  tiledFilter->SetLevel( level );
+  TEST_SET_GET_VALUE( level, tiledFilter->GetLevel() );
+
+  unsigned int numberOfTiles = 4;
+  tiledFilter->SetNumberOfTiles( numberOfTiles );
+  TEST_SET_GET_VALUE( numberOfTiles, tiledFilter->GetNumberOfTiles() );
+
+  tiledFilter->SetInput( image );
+
+  TRY_EXPECT_NO_EXCEPTION( tiledFilter->Update() );
+
+  // The single-chunk filter provides the reference segmentation.
+  using FilterType = itk::WatershedImageFilter< ImageType >;
+  FilterType::Pointer referenceFilter = FilterType::New();
+  referenceFilter->SetThreshold( threshold );
+  referenceFilter->SetLevel( level );
+  referenceFilter->SetInput( image );
+
+  TRY_EXPECT_NO_EXCEPTION( referenceFilter->Update() );
+
+  // The two outputs describe the same partition of the image up to a
+  // renumbering of the labels.  Count the pixels that disagree with the
+  // most common tiled label found within each reference segment; a small
+  // number of disagreements along the tile seams is tolerated since ties
+  // in the gradient descent can resolve differently there.
+  std::map< itk::IdentifierType, std::map< itk::IdentifierType,
+    itk::SizeValueType > > histogram;
+
+  itk::ImageRegionConstIterator< LabeledImageType >
+    referenceIt( referenceFilter->GetOutput(), region );
+  itk::ImageRegionConstIterator< LabeledImageType >
+    tiledIt( tiledFilter->GetOutput(), region );
+  for ( ; !referenceIt.IsAtEnd(); ++referenceIt, ++tiledIt )
+    {
+    histogram[referenceIt.Get()][tiledIt.Get()]++;
+    }
+
+  if ( histogram.size() < 2 )
+    {
+    std::cerr << "Test failed!" << std::endl;
+    std::cerr << "The reference segmentation has a single segment."
+              << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  itk::SizeValueType disagreements = 0;
+  for ( auto & segment : histogram )
+    {
+    itk::SizeValueType segmentSize = 0;
+    itk::SizeValueType majority = 0;
+    for ( auto & bin : segment.second )
+      {
+      segmentSize += bin.second;
+      majority = std::max( majority, bin.second );
+      }
+    disagreements += segmentSize - majority;
+    }
+
+  const auto numberOfPixels =
+    static_cast< itk::SizeValueType >( region.GetNumberOfPixels() );
+  std::cout << "Segments: " << histogram.size()
+            << "  Disagreeing pixels: " << disagreements << " / "
+            << numberOfPixels << std::endl;
+
+  if ( static_cast< double >( disagreements )
+       > 0.01 * static_cast< double >( numberOfPixels ) )
+    {
+    std::cerr << "Test failed!" << std::endl;
+    std::cerr << "The tiled segmentation deviates from the single-chunk "
+              << "segmentation." << std::endl;
+    return EXIT_FAILURE;
+    }
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
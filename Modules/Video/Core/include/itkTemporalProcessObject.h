@@ -22,6 +22,9 @@
 #include "itkTemporalRegion.h"
 #include "ITKVideoCoreExport.h"
 
+#include <exception>
+#include <thread>
+
 namespace itk
 {
 
@@ -98,6 +101,20 @@ public:
    * able to hold this as a constant. */
   itkGetMacro(UnitOutputNumberOfFrames, SizeValueType);
 
+  /** Enable/Disable pipelined updates. When enabled, GenerateData starts
+   * the upstream update for the next unit of input frames on a background
+   * thread after processing the current unit, so this stage's consumer
+   * works on frame t while the upstream stages produce frame t+1. With
+   * every filter of a chain pipelined, the stages run one frame apart and
+   * hand frames off through the existing ring buffers. The input must
+   * keep enough spare buffers to hold the next unit of frames in addition
+   * to the current one; prefetching is skipped when it does not. Frames
+   * produced ahead of time are simply ignored if the next request turns
+   * out to be different (e.g. after seeking). Off by default. */
+  itkSetMacro(PipelinedUpdate, bool);
+  itkGetMacro(PipelinedUpdate, bool);
+  itkBooleanMacro(PipelinedUpdate);
+
   /** The default implementation of UpdateOutputInformation to handle temporal
    * regions will compute the proper size of the output largest possible
    * temporal region based on the largest possible temporal region of the input,
@@ -145,8 +162,8 @@ protected:
   /** Constructor that initializes members */
   TemporalProcessObject();
 
-  /** Empty Destructor */
-  ~TemporalProcessObject() override = default;
+  /** Destructor waits for any outstanding upstream prefetch */
+  ~TemporalProcessObject() override;
 
   /** ITK print mechanism */
   void PrintSelf(std::ostream & os, Indent indent) const override;
@@ -208,6 +225,16 @@ protected:
    * frame 0 and has infinite duration. */
   virtual TemporalRegion GenerateDefaultLargestPossibleTemporalRegion();
 
+  /** Start updating the given input on a background thread. The input's
+   * requested temporal region must be set before calling. Any exception
+   * thrown by the upstream update is re-thrown by the next call to
+   * WaitForUpstreamPrefetch. */
+  void LaunchUpstreamPrefetch(TemporalDataObject* input);
+
+  /** Wait for an outstanding upstream prefetch to finish. Must be called
+   * before anything touches the input or the upstream pipeline. */
+  void WaitForUpstreamPrefetch();
+
   itkSetMacro(UnitInputNumberOfFrames, SizeValueType);
   itkSetMacro(UnitOutputNumberOfFrames, SizeValueType);
   itkSetMacro(FrameSkipPerOutput, OffsetValueType);
@@ -232,6 +259,16 @@ protected:
    * n, frames n-4 through n+1 are required, whereas if
    * m_InputStencilCurrentFrameIndex = 0, frames n through n+5 are required. */
   SizeValueType  m_InputStencilCurrentFrameIndex{0};
+
+private:
+  /** Flag controlling whether upstream updates for the next unit of input
+   * frames are run on a background thread. */
+  bool m_PipelinedUpdate{false};
+
+  /** Thread running a pipelined upstream update and the exception (if any)
+   * it produced. */
+  std::thread m_UpstreamPrefetchThread;
+  std::exception_ptr m_UpstreamPrefetchException;
 };  // end class TemporalProcessObject
 
 } // end namespace itk
@@ -62,6 +62,8 @@ public:
   using SpacingType = typename FrameType::SpacingType;
   using SizeType = typename FrameType::SizeType;
   using DirectionType = typename FrameType::DirectionType;
+  using PixelContainerType = typename FrameType::PixelContainer;
+  using PixelContainerPointer = typename PixelContainerType::Pointer;
 
   /** Types used to store map between frame numbers and frame meta data */
   using SpatialRegionMapType = typename std::map<SizeValueType, SpatialRegionType>;
@@ -236,6 +238,18 @@ public:
    * InitializeEmptyFrames). */
   void SetAllFramesDirection(DirectionType direction);
 
+  /** When enabled, Allocate() backs all frames of the buffered temporal
+   * region with a single contiguous pixel arena and points each frame's
+   * pixel container at its slice of that arena, so frames become views
+   * rather than independent allocations. The arena is reused by later
+   * calls to Allocate() whenever the total size is unchanged, which
+   * avoids per-frame reallocation during steady-state streaming. All
+   * frames in the buffered temporal region must have buffered spatial
+   * regions covering the same number of pixels. Off by default. */
+  itkSetMacro(UseFrameArena, bool);
+  itkGetConstMacro(UseFrameArena, bool);
+  itkBooleanMacro(UseFrameArena);
+
   /** Allocate memory for the buffered spatial region of each frame in the
    * buffered temporal region. This assumes that all frames in the buffered
    * temporal region have been initialized and that the buffered spatial region
@@ -285,6 +299,11 @@ protected:
     Superclass::Print(os, indent);
   }
 
+  /** Back every frame of the buffered temporal region with a slice of the
+   * contiguous pixel arena, growing or reusing the arena as necessary.
+   * Called by Allocate() when UseFrameArena is enabled. */
+  void AllocateFrameArena();
+
   /** These maps are used to cache a mapping between frame number and spatial
    * region. This is done because frames will often not be in actual existence
    * at the time when the region gets set. */
@@ -297,6 +316,14 @@ protected:
   SpacingMapType       m_SpacingCache;
   DirectionMapType     m_DirectionCache;
   PointMapType         m_OriginCache;
+
+  /** Single contiguous allocation backing all buffered frames when
+   * UseFrameArena is on. The frames reference slices of this container
+   * without owning them, so the arena must outlive the frames; Graft
+   * shares it along with the ring buffer. */
+  PixelContainerPointer m_FrameArena;
+
+  bool m_UseFrameArena{false};
 }; // end class VideoStream
 
 } // end namespace itk
@@ -405,6 +405,10 @@ VideoStream<TFrameType>
 
     // Copy the frame buffer
     this->SetFrameBuffer(const_cast< BufferType* >(videoData->GetFrameBuffer()));
+
+    // Share the pixel arena (if any) so frames that are views into it
+    // keep their backing memory alive
+    this->m_FrameArena = videoData->m_FrameArena;
     }
 }
 
@@ -590,6 +594,14 @@ VideoStream<TFrameType>
                       "to prepare the frame buffer correctly.");
     }
 
+  // If requested, back all frames with one contiguous arena instead of
+  // allocating each frame independently
+  if (m_UseFrameArena)
+    {
+    this->AllocateFrameArena();
+    return;
+    }
+
   // Go through the number of required frames, making sure none are empty and
   // allocating them. We start at 1 and move forwards because frames will be
   // added using AppendFrame which first moves the Head forward, then adds the
@@ -613,6 +625,82 @@ VideoStream<TFrameType>
     }
 }
 
+
+template<typename TFrameType>
+void
+VideoStream<TFrameType>
+::AllocateFrameArena()
+{
+  SizeValueType numFrames = m_BufferedTemporalRegion.GetFrameDuration();
+
+  // Validate the frames and make sure they all cover the same number of
+  // pixels so the arena can be sliced evenly. The loop uses the same
+  // 1-based offsets as Allocate since frames are added with AppendFrame
+  // which moves the Head forward first.
+  SizeValueType framePixels = 0;
+  for (SizeValueType i = 1; i <= numFrames; ++i)
+    {
+    if (!m_DataObjectBuffer->BufferIsFull(i))
+      {
+      itkExceptionMacro("itk::VideoStream::AllocateFrameArena "
+                        "empty frame buffer found at offset " << i << ". Call "
+                        "InitializeEmptyFrames to prepare the frame buffer correctly.");
+      }
+    FrameType* frame = dynamic_cast<FrameType*>(
+                        m_DataObjectBuffer->GetBufferContents(i).GetPointer());
+    if (!frame)
+      {
+      itkExceptionMacro("itk::VideoStream::AllocateFrameArena "
+                        "could not cast frame " << i << " to the correct type.");
+      }
+    SizeValueType currentFramePixels = frame->GetBufferedRegion().GetNumberOfPixels();
+    if (i == 1)
+      {
+      framePixels = currentFramePixels;
+      }
+    else if (currentFramePixels != framePixels)
+      {
+      itkExceptionMacro("itk::VideoStream::AllocateFrameArena "
+                        "all buffered frames must cover the same number of pixels "
+                        "when using a frame arena.");
+      }
+    }
+
+  if (numFrames == 0 || framePixels == 0)
+    {
+    return;
+    }
+
+  // Reserve the arena, recycling the previous allocation whenever the
+  // total size has not changed
+  SizeValueType totalPixels = numFrames * framePixels;
+  if (m_FrameArena.IsNull() || m_FrameArena->Size() != totalPixels)
+    {
+    m_FrameArena = PixelContainerType::New();
+    m_FrameArena->Reserve(totalPixels);
+    }
+
+  // Point each frame at its slice of the arena. Frames that already
+  // reference the correct slice are left untouched so steady-state
+  // streaming reuses the existing views.
+  PixelType* arenaPointer = m_FrameArena->GetImportPointer();
+  for (SizeValueType i = 1; i <= numFrames; ++i)
+    {
+    auto * frame = dynamic_cast<FrameType*>(
+                    m_DataObjectBuffer->GetBufferContents(i).GetPointer());
+    PixelType* slice = arenaPointer + (i - 1) * framePixels;
+    PixelContainerType* container = frame->GetPixelContainer();
+    if (container != nullptr && container->GetImportPointer() == slice &&
+        container->Size() == framePixels)
+      {
+      continue;
+      }
+    PixelContainerPointer view = PixelContainerType::New();
+    view->SetImportPointer(slice, framePixels, false);
+    frame->SetPixelContainer(view);
+    }
+}
+
 } // end namespace itk
 
 #endif
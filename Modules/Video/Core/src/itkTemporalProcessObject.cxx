@@ -33,6 +33,19 @@ TemporalProcessObject::TemporalProcessObject()
 
 {}
 
+//
+// Destructor
+//
+TemporalProcessObject::~TemporalProcessObject()
+{
+  // Wait for an outstanding prefetch; its result can no longer be used so
+  // any exception it produced is discarded
+  if (m_UpstreamPrefetchThread.joinable())
+    {
+    m_UpstreamPrefetchThread.join();
+    }
+}
+
 //
 // PrintSelf
 //
@@ -41,6 +54,45 @@ TemporalProcessObject::PrintSelf(std::ostream & os, Indent indent) const
 {
   Superclass::PrintSelf(os, indent);
   os << indent << "TemporalProcessObject" << std::endl;
+  os << indent << "PipelinedUpdate: " << (m_PipelinedUpdate ? "On" : "Off") << std::endl;
+}
+
+//
+// LaunchUpstreamPrefetch
+//
+void
+TemporalProcessObject::LaunchUpstreamPrefetch(TemporalDataObject* input)
+{
+  m_UpstreamPrefetchException = nullptr;
+  m_UpstreamPrefetchThread = std::thread( [this, input]
+    {
+    try
+      {
+      input->UpdateOutputData();
+      }
+    catch (...)
+      {
+      this->m_UpstreamPrefetchException = std::current_exception();
+      }
+    } );
+}
+
+//
+// WaitForUpstreamPrefetch
+//
+void
+TemporalProcessObject::WaitForUpstreamPrefetch()
+{
+  if (m_UpstreamPrefetchThread.joinable())
+    {
+    m_UpstreamPrefetchThread.join();
+    if (m_UpstreamPrefetchException)
+      {
+      std::exception_ptr prefetchException = m_UpstreamPrefetchException;
+      m_UpstreamPrefetchException = nullptr;
+      std::rethrow_exception(prefetchException);
+      }
+    }
 }
 
 //-PROPAGATE REQUESTED REGION CALLBACKS----------------------------------------
@@ -170,6 +222,10 @@ TemporalProcessObject::GenerateInputRequestedRegion()
     return;
     }
 
+  // The input must not be touched while a pipelined upstream update is
+  // still producing frames
+  this->WaitForUpstreamPrefetch();
+
   // Check that output and input are a TemporalDataObjects
   auto * tOutput = dynamic_cast<TemporalDataObject*>(this->GetOutput(0));
   auto * tInput = dynamic_cast<TemporalDataObject*>(this->GetInput(0));
@@ -271,6 +327,10 @@ TemporalProcessObject::GenerateDefaultLargestPossibleTemporalRegion()
 void
 TemporalProcessObject::UpdateOutputInformation()
 {
+  // Make sure no pipelined upstream update is still running before the
+  // information request propagates up the pipeline
+  this->WaitForUpstreamPrefetch();
+
   // Update using inherited system
   Superclass::UpdateOutputInformation();
 
@@ -409,6 +469,12 @@ TemporalProcessObject::UpdateOutputData(DataObject* itkNotUsed(output))
 void
 TemporalProcessObject::GenerateData()
 {
+  // Wait for a pipelined upstream update started during the previous pass
+  // before anything here touches the input. Frames it produced are already
+  // buffered, so the per-request updates below return without generating
+  // anything new.
+  this->WaitForUpstreamPrefetch();
+
   // Call Pre-processing method
   this->BeforeTemporalStreamingGenerateData();
 
@@ -427,8 +493,14 @@ TemporalProcessObject::GenerateData()
   // Save the full requested and buffered output regions
   TemporalRegion fullOutputRequest = output->GetRequestedTemporalRegion();
 
+  // Grab the set of input requests up front so that the request of the next
+  // pass is known while the current one is being processed
+  const std::vector<TemporalRegion> inputTemporalRegionRequests =
+    this->SplitRequestedTemporalRegion();
+
   // Process each of the temporal sub-regions in sequence
-  for (const auto & inputTemporalRegionRequest : this->SplitRequestedTemporalRegion() )
+  for (SizeValueType requestIndex = 0;
+       requestIndex < inputTemporalRegionRequests.size(); ++requestIndex)
     {
     // If we have an input, set the requested region and make sure its data is ready
     if (this->GetNumberOfInputs())
@@ -441,7 +513,11 @@ TemporalProcessObject::GenerateData()
                           << "cannot cast " << typeid(input).name() << " to "
                           << typeid(TemporalDataObject*).name() );
         }
-      input->SetRequestedTemporalRegion(inputTemporalRegionRequest);
+
+      // Wait for a prefetch started at the end of the previous pass
+      this->WaitForUpstreamPrefetch();
+
+      input->SetRequestedTemporalRegion(inputTemporalRegionRequests[requestIndex]);
 
       // Call Input's UpdateOutputData()
       input->UpdateOutputData();
@@ -489,6 +565,44 @@ TemporalProcessObject::GenerateData()
 
     // Increment outputStartFrame
     outputStartFrame += this->m_UnitOutputNumberOfFrames;
+
+    // While the downstream stage consumes the output generated above, start
+    // producing the input frames for the next pass in the background. For the
+    // last request of this pass, the request of the next pipeline pass is
+    // predicted; the prefetched frames are simply ignored if a different
+    // region ends up being requested (e.g. after seeking).
+    if (m_PipelinedUpdate && this->GetNumberOfInputs())
+      {
+      auto * input = dynamic_cast<TemporalDataObject*>(this->GetInput(0));
+
+      TemporalRegion nextRequest;
+      bool haveNextRequest = false;
+      if (requestIndex + 1 < inputTemporalRegionRequests.size())
+        {
+        nextRequest = inputTemporalRegionRequests[requestIndex + 1];
+        haveNextRequest = true;
+        }
+      else
+        {
+        nextRequest = inputTemporalRegionRequests[requestIndex];
+        nextRequest.SetFrameStart(nextRequest.GetFrameStart() + m_FrameSkipPerOutput);
+        TemporalRegion inputLargestRegion = input->GetLargestPossibleTemporalRegion();
+        haveNextRequest =
+          nextRequest.GetFrameStart() >= inputLargestRegion.GetFrameStart() &&
+          nextRequest.GetFrameStart() + nextRequest.GetFrameDuration() <=
+          inputLargestRegion.GetFrameStart() + inputLargestRegion.GetFrameDuration();
+        }
+
+      // Only prefetch when the input ring buffer has room for the next unit
+      // of frames in addition to the current one
+      if (haveNextRequest &&
+          (OffsetValueType)input->GetNumberOfBuffers() >=
+          (OffsetValueType)m_UnitInputNumberOfFrames + itk::Math::abs(m_FrameSkipPerOutput))
+        {
+        input->SetRequestedTemporalRegion(nextRequest);
+        this->LaunchUpstreamPrefetch(input);
+        }
+      }
     }
 
   // Set the requested and buffered temporal regions to match the full request
@@ -22,6 +22,12 @@
 #include "itkVideoIOFactory.h"
 #include "itkDefaultConvertPixelTraits.h"
 
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 namespace itk
 {
 
@@ -84,6 +90,16 @@ public:
   itkSetMacro(IFrameSafe, bool);
   itkGetMacro(IFrameSafe, bool);
 
+  /** Get/Set the number of frames to decode ahead of the pipeline. When
+   * non-zero, a background thread decodes upcoming frames into an internal
+   * cache between pipeline updates so that steady-state throughput is
+   * bounded by the downstream filters rather than by decode time.
+   * Sequential access benefits the most; seeking drops the cached frames
+   * and restarts read-ahead at the new position. Zero (the default) keeps
+   * the fully synchronous behavior. */
+  void SetDecodeAheadDepth(FrameOffsetType depth);
+  itkGetConstMacro(DecodeAheadDepth, FrameOffsetType);
+
   /** Set up the output information */
   void UpdateOutputInformation() override;
 
@@ -122,6 +138,24 @@ protected:
    * Warning: this will overwrite any currently set VideoIO */
   void InitializeVideoIO();
 
+  /** Seek the VideoIO if necessary and decode the given frame directly
+   * into the output. When decode-ahead is active, this must be called
+   * with m_PrefetchMutex held. */
+  void DecodeFrame(FrameOffsetType frameNumber);
+
+  /** Start the prefetch thread reading ahead from the given frame if it
+   * is not already running. */
+  void StartPrefetchThread(FrameOffsetType nextFrame);
+
+  /** Request termination of the prefetch thread, join it, and drop any
+   * cached frames. */
+  void StopPrefetchThread();
+
+  /** Main loop of the prefetch thread. Decodes frames into
+   * m_PrefetchedFrames until the decode-ahead depth or the end of the
+   * largest possible temporal region is reached. */
+  void PrefetchThreadFunction();
+
 private:
   /** The file to read */
   std::string m_FileName;
@@ -136,6 +170,21 @@ private:
   /** Flag to indicate whether to report the last frame as the last IFrame. On
    * by default. */
   bool m_IFrameSafe;
+
+  /** Number of frames the prefetch thread keeps decoded ahead of the
+   * pipeline. Zero disables decode-ahead. */
+  FrameOffsetType m_DecodeAheadDepth;
+
+  /** Decode-ahead state. The prefetch thread decodes upcoming frames into
+   * m_PrefetchedFrames; all access to the VideoIO and to the cache is
+   * serialized through m_PrefetchMutex. */
+  std::thread m_PrefetchThread;
+  std::mutex m_PrefetchMutex;
+  std::condition_variable m_PrefetchCondition;
+  bool m_PrefetchTerminationRequested;
+  FrameOffsetType m_PrefetchNextFrame;
+  FrameOffsetType m_PrefetchEndFrame;
+  std::map<FrameOffsetType, std::vector<char> > m_PrefetchedFrames;
 };
 
 } // end namespace itk
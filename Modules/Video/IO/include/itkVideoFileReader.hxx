@@ -23,6 +23,8 @@
 
 #include "itkVideoFileReader.h"
 
+#include <cstring>
+
 namespace itk
 {
 
@@ -35,6 +37,10 @@ VideoFileReader< TOutputVideoStream >
   m_VideoIO = nullptr;
   m_PixelConversionNeeded = false;
   m_IFrameSafe = true;
+  m_DecodeAheadDepth = 0;
+  m_PrefetchTerminationRequested = false;
+  m_PrefetchNextFrame = 0;
+  m_PrefetchEndFrame = 0;
 
   // TemporalProcessObject inherited members
   this->SetUnitOutputNumberOfFrames(1);
@@ -44,7 +50,26 @@ VideoFileReader< TOutputVideoStream >
 
 template< typename TOutputVideoStream >
 VideoFileReader< TOutputVideoStream >
-::~VideoFileReader() = default;
+::~VideoFileReader()
+{
+  this->StopPrefetchThread();
+}
+
+template< typename TOutputVideoStream >
+void
+VideoFileReader< TOutputVideoStream >
+::SetDecodeAheadDepth(FrameOffsetType depth)
+{
+  if (depth == m_DecodeAheadDepth)
+    {
+    return;
+    }
+
+  // The thread is restarted lazily with the new depth at the next update
+  this->StopPrefetchThread();
+  m_DecodeAheadDepth = depth;
+  this->Modified();
+}
 
 template< typename TOutputVideoStream >
 void
@@ -243,11 +268,66 @@ VideoFileReader< TOutputVideoStream >
   requestedTemporalRegion = output->GetRequestedTemporalRegion();
   FrameOffsetType frameNum = requestedTemporalRegion.GetFrameStart();
 
+  if (m_DecodeAheadDepth > 0)
+    {
+    this->StartPrefetchThread(frameNum);
+
+    std::unique_lock<std::mutex> lock(m_PrefetchMutex);
+    auto cached = m_PrefetchedFrames.find(frameNum);
+    if (cached != m_PrefetchedFrames.end())
+      {
+      // Take the decoded bytes out of the cache and let the prefetcher
+      // continue while we fill the output frame
+      std::vector<char> loadBuffer = std::move(cached->second);
+      m_PrefetchedFrames.erase(cached);
+      if (m_PrefetchNextFrame <= frameNum)
+        {
+        m_PrefetchNextFrame = frameNum + 1;
+        }
+      lock.unlock();
+      m_PrefetchCondition.notify_one();
+
+      if (this->m_PixelConversionNeeded)
+        {
+        this->DoConvertBuffer(static_cast<void*>(loadBuffer.data()), frameNum);
+        }
+      else
+        {
+        FrameType* frame = output->GetFrame(frameNum);
+        memcpy(reinterpret_cast<void*>(frame->GetBufferPointer()),
+               loadBuffer.data(), loadBuffer.size());
+        }
+      }
+    else
+      {
+      // Random access or the prefetcher has not caught up yet; decode
+      // here and restart read-ahead after this frame
+      m_PrefetchedFrames.clear();
+      this->DecodeFrame(frameNum);
+      m_PrefetchNextFrame = frameNum + 1;
+      lock.unlock();
+      m_PrefetchCondition.notify_one();
+      }
+    }
+  else
+    {
+    this->DecodeFrame(frameNum);
+    }
+
+  // Mark ourselves modified
+  this->Modified();
+}
+
+template< typename TOutputVideoStream >
+void
+VideoFileReader< TOutputVideoStream >
+::DecodeFrame(FrameOffsetType frameNumber)
+{
   // Figure out if we need to skip frames
   FrameOffsetType currentIOFrame = m_VideoIO->GetCurrentFrame();
-  if (frameNum != currentIOFrame)
+  if (frameNumber != currentIOFrame)
     {
-    m_VideoIO->SetNextFrameToRead(frameNum);
+    m_VideoIO->SetNextFrameToRead(frameNumber);
     }
 
   // Read a single frame
@@ -261,17 +341,84 @@ VideoFileReader< TOutputVideoStream >
     this->m_VideoIO->Read(static_cast<void*>(loadBuffer));
 
     // Convert the buffer into the output buffer location
-    this->DoConvertBuffer(static_cast<void*>(loadBuffer), frameNum);
+    this->DoConvertBuffer(static_cast<void*>(loadBuffer), frameNumber);
     delete[] loadBuffer;
     }
   else
     {
-    FrameType* frame = this->GetOutput()->GetFrame(frameNum);
+    FrameType* frame = this->GetOutput()->GetFrame(frameNumber);
     m_VideoIO->Read(reinterpret_cast<void*>(frame->GetBufferPointer()));
     }
+}
 
-  // Mark ourselves modified
-  this->Modified();
+template< typename TOutputVideoStream >
+void
+VideoFileReader< TOutputVideoStream >
+::StartPrefetchThread(FrameOffsetType nextFrame)
+{
+  if (m_PrefetchThread.joinable())
+    {
+    return;
+    }
+
+  TemporalRegion largestRegion =
+    this->GetOutput()->GetLargestPossibleTemporalRegion();
+
+  m_PrefetchTerminationRequested = false;
+  m_PrefetchNextFrame = nextFrame;
+  m_PrefetchEndFrame = largestRegion.GetFrameStart() +
+                       largestRegion.GetFrameDuration();
+  m_PrefetchThread = std::thread(&Self::PrefetchThreadFunction, this);
+}
+
+template< typename TOutputVideoStream >
+void
+VideoFileReader< TOutputVideoStream >
+::StopPrefetchThread()
+{
+  if (!m_PrefetchThread.joinable())
+    {
+    return;
+    }
+
+    {
+    std::lock_guard<std::mutex> lockGuard(m_PrefetchMutex);
+    m_PrefetchTerminationRequested = true;
+    }
+  m_PrefetchCondition.notify_one();
+  m_PrefetchThread.join();
+  m_PrefetchedFrames.clear();
+}
+
+template< typename TOutputVideoStream >
+void
+VideoFileReader< TOutputVideoStream >
+::PrefetchThreadFunction()
+{
+  std::unique_lock<std::mutex> lock(m_PrefetchMutex);
+  while (!m_PrefetchTerminationRequested)
+    {
+    // Sleep while the cache is full or the end of the video is reached
+    if (m_PrefetchedFrames.size() >= static_cast<size_t>(m_DecodeAheadDepth) ||
+        m_PrefetchNextFrame >= m_PrefetchEndFrame)
+      {
+      m_PrefetchCondition.wait(lock);
+      continue;
+      }
+
+    // Decode the next frame into the cache. The lock is held while the
+    // VideoIO is used since it is not thread safe; the pipeline thread
+    // only holds it briefly when it finds its frame in the cache.
+    const FrameOffsetType frameNum = m_PrefetchNextFrame;
+    std::vector<char> buffer(m_VideoIO->GetImageSizeInBytes());
+    if (m_VideoIO->GetCurrentFrame() != frameNum)
+      {
+      m_VideoIO->SetNextFrameToRead(frameNum);
+      }
+    m_VideoIO->Read(static_cast<void*>(buffer.data()));
+    m_PrefetchedFrames[frameNum] = std::move(buffer);
+    m_PrefetchNextFrame = frameNum + 1;
+    }
 }
 
 template< typename TOutputVideoStream >
@@ -365,6 +512,7 @@ VideoFileReader< TOutputVideoStream >
   Superclass::PrintSelf(os, indent);
 
   os << indent << "FileName: " << this->m_FileName << std::endl;
+  os << indent << "DecodeAheadDepth: " << this->m_DecodeAheadDepth << std::endl;
   if (m_VideoIO)
     {
     os << indent << "VideoIO:" << std::endl;